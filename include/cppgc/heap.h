@@ -155,6 +155,17 @@ class V8_EXPORT Heap {
      * GC scheduler follows.
      */
     ResourceConstraints resource_constraints;
+
+    /**
+     * Enables generational garbage collection using sticky mark bits: objects
+     * that survived a garbage collection are old, and minor garbage
+     * collections (see `ForceMinorGarbageCollectionSlow()`) only trace and
+     * reclaim objects allocated since the previous garbage collection.
+     * Old-to-young references are recorded by the write barrier. Requires
+     * cppgc to be built with young generation support
+     * (`cppgc_enable_young_generation`) and is ignored otherwise.
+     */
+    bool enable_generational_gc = false;
   };
 
   /**
@@ -183,6 +194,21 @@ class V8_EXPORT Heap {
       const char* source, const char* reason,
       StackState stack_state = StackState::kMayContainHeapPointers);
 
+  /**
+   * Forces a minor garbage collection that only reclaims objects allocated
+   * since the previous garbage collection. Performs a major garbage
+   * collection instead if generational garbage collection is not active for
+   * this heap, see `HeapOptions::enable_generational_gc`, or if a major
+   * garbage collection is already in progress. Minor garbage collections do
+   * not scan the stack, so the stack must not contain heap pointers.
+   *
+   * \param source String specifying the source (or caller) triggering a
+   *   forced garbage collection.
+   * \param reason String specifying the reason for the forced garbage
+   *   collection.
+   */
+  void ForceMinorGarbageCollectionSlow(const char* source, const char* reason);
+
   /**
    * \returns the opaque handle for allocating objects using
    * `MakeGarbageCollected()`.
@@ -17,6 +17,7 @@ namespace platform {
 
 enum class IdleTaskSupport { kDisabled, kEnabled };
 enum class InProcessStackDumping { kDisabled, kEnabled };
+enum class NumaAffinity { kDisabled, kCurrentNode, kFixedNode };
 
 enum class MessageLoopBehavior : bool {
   kDoNotWait = false,
@@ -35,13 +36,19 @@ enum class MessageLoopBehavior : bool {
  * calling v8::platform::RunIdleTasks to process the idle tasks.
  * If |tracing_controller| is nullptr, the default platform will create a
  * v8::platform::TracingController instance and use it.
+ * If |numa_affinity| is not kDisabled, worker threads only run on the CPUs of
+ * one NUMA node, and pages allocated through the platform's page allocator
+ * prefer memory of that node. This is the node of the thread creating the
+ * platform for kCurrentNode, and |numa_node| for kFixedNode. The affinity is
+ * ignored on operating systems which do not support it.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
     IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
-    std::unique_ptr<v8::TracingController> tracing_controller = {});
+    std::unique_ptr<v8::TracingController> tracing_controller = {},
+    NumaAffinity numa_affinity = NumaAffinity::kDisabled, int numa_node = 0);
 
 /**
  * The same as NewDefaultPlatform but disables the worker thread pool.
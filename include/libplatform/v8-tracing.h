@@ -132,24 +132,32 @@ class V8_PLATFORM_EXPORT TraceWriter {
   void operator=(const TraceWriter&) = delete;
 };
 
+// Threads can add events to a chunk concurrently. Reset must only be called
+// while no thread adds events.
 class V8_PLATFORM_EXPORT TraceBufferChunk {
  public:
   explicit TraceBufferChunk(uint32_t seq);
 
   void Reset(uint32_t new_seq);
-  bool IsFull() const { return next_free_ == kChunkSize; }
+  bool IsFull() const {
+    return next_free_.load(std::memory_order_relaxed) >= kChunkSize;
+  }
+  // Returns nullptr if the chunk is full.
   TraceObject* AddTraceEvent(size_t* event_index);
   TraceObject* GetEventAt(size_t index) { return &chunk_[index]; }
 
-  uint32_t seq() const { return seq_; }
-  size_t size() const { return next_free_; }
+  uint32_t seq() const { return seq_.load(std::memory_order_acquire); }
+  size_t size() const {
+    size_t next_free = next_free_.load(std::memory_order_relaxed);
+    return next_free < kChunkSize ? next_free : kChunkSize;
+  }
 
   static const size_t kChunkSize = 64;
 
  private:
-  size_t next_free_ = 0;
+  std::atomic<size_t> next_free_{0};
   TraceObject chunk_[kChunkSize];
-  uint32_t seq_;
+  std::atomic<uint32_t> seq_;
 
   // Disallow copy and assign
   TraceBufferChunk(const TraceBufferChunk&) = delete;
@@ -307,6 +315,11 @@ class V8_PLATFORM_EXPORT TracingController
   std::unique_ptr<base::Mutex> mutex_;
   std::unique_ptr<TraceConfig> trace_config_;
   std::atomic_bool recording_{false};
+#if !defined(V8_USE_PERFETTO)
+  // Number of threads currently writing to |trace_buffer_|. StopTracing waits
+  // for them before flushing.
+  std::atomic<int> active_writers_{0};
+#endif  // !defined(V8_USE_PERFETTO)
   std::unordered_set<v8::TracingController::TraceStateObserver*> observers_;
 
 #if defined(V8_USE_PERFETTO)
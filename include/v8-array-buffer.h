@@ -151,6 +151,20 @@ class V8_EXPORT ArrayBuffer : public Object {
      */
     virtual void Free(void* data, size_t length) = 0;
 
+    /**
+     * Free |count| memory blocks at once. |data| and |lengths| point to arrays
+     * of |count| elements that hold the start and the size of each block.
+     * The blocks are guaranteed to be previously allocated by |Allocate|.
+     * V8 uses this to release many backing stores at once, e.g. when they
+     * are swept after garbage collection, which allows the allocator to
+     * amortize its locking. This method may be called from a background
+     * thread.
+     *
+     * The default implementation calls |Free| for every block.
+     */
+    virtual void FreeBatch(void* const* data, const size_t* lengths,
+                           size_t count);
+
     /**
      * Reallocate the memory block of size |old_length| to a memory block of
      * size |new_length| by expanding, contracting, or copying the existing
@@ -414,6 +428,36 @@ class V8_EXPORT SharedArrayBuffer : public Object {
    */
   std::shared_ptr<BackingStore> GetBackingStore();
 
+  /**
+   * Size in bytes of the header of a ring buffer, see RingPush.
+   */
+  static constexpr size_t kRingHeaderSize = 8;
+
+  /**
+   * Treats this buffer as a bounded single-producer single-consumer byte ring
+   * and copies up to |length| bytes from |data| into it. Returns the number
+   * of bytes copied, which is smaller than |length| if the ring is full.
+   *
+   * The buffer starts with two 32-bit words, the offset of the next byte to
+   * pop and the offset of the next byte to push, both relative to the data
+   * after the header and initially zero. JavaScript may implement either side
+   * on the same buffer with Atomics, and wait for data on the second word
+   * with Atomics.wait, which RingPush notifies.
+   *
+   * Must only be called by the producer, on a buffer larger than
+   * kRingHeaderSize.
+   */
+  size_t RingPush(const void* data, size_t length);
+
+  /**
+   * Copies up to |length| bytes from the ring in this buffer into |data|, see
+   * RingPush. Returns the number of bytes copied, which is smaller than
+   * |length| if the ring runs empty. Waiters on the first word are notified.
+   *
+   * Must only be called by the consumer.
+   */
+  size_t RingPop(void* data, size_t length);
+
   V8_INLINE static SharedArrayBuffer* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
@@ -169,6 +169,22 @@ class V8_EXPORT Context : public Data {
   /** Returns the microtask queue associated with a current context. */
   MicrotaskQueue* GetMicrotaskQueue();
 
+  /**
+   * Thread CPU time spent while this was the current context, in
+   * microseconds. Only recorded if V8 runs with --context-cpu-time. Time is
+   * sampled when a context is entered or exited, and when a microtask
+   * checkpoint, a compilation or a garbage collection starts or ends. Each
+   * of these is charged to the context that was current when it started.
+   */
+  struct CpuTime {
+    /** All time charged to the context, including the time below. */
+    int64_t total_us = 0;
+    int64_t microtasks_us = 0;
+    int64_t compile_us = 0;
+    int64_t gc_us = 0;
+  };
+  CpuTime GetCpuTime();
+
   /**
    * The field at kDebugIdIndex used to be reserved for the inspector.
    * It now serves no purpose.
@@ -244,6 +260,14 @@ class V8_EXPORT Context : public Data {
    */
   void SetErrorMessageForCodeGenerationFromStrings(Local<String> message);
 
+  /**
+   * Returns the number of bytes that the last full garbage collection
+   * attributed to this context, with kilobyte granularity. The attribution
+   * happens only if V8 runs with --continuous-memory-measurement, otherwise
+   * this returns 0.
+   */
+  size_t GetMeasuredMemorySize() const;
+
   /**
    * Return data that was previously attached to the context snapshot via
    * SnapshotCreator, and removes the reference to it.
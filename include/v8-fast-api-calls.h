@@ -157,6 +157,10 @@
  * Currently supported argument types:
  *  - pointer to an embedder type
  *  - JavaScript array of primitive types
+ *  - JavaScript array of doubles, as a span (FastApiArray<double>)
+ *  - TypedArrays of primitive types and of 8- and 16-bit integers
+ *  - flat one-byte and two-byte strings (FastOneByteString and
+ *    FastTwoByteString)
  *  - bool
  *  - int32_t
  *  - uint32_t
@@ -177,7 +181,7 @@
  * passes NaN values as-is, i.e. doesn't normalize them.
  *
  * To be supported types:
- *  - TypedArrays and ArrayBuffers
+ *  - ArrayBuffers
  *  - arrays of embedder types
  *
  *
@@ -240,6 +244,12 @@ class CTypeInfo {
   enum class Type : uint8_t {
     kVoid,
     kBool,
+    // The 8- and 16-bit integer types are only supported as element types
+    // of TypedArrays.
+    kInt8,
+    kUint8,
+    kInt16,
+    kUint16,
     kInt32,
     kUint32,
     kInt64,
@@ -247,6 +257,8 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kSeqOneByteString,
+    kSeqTwoByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -315,6 +327,11 @@ class CTypeInfo {
            type == Type::kBool;
   }
 
+  static constexpr bool IsSmallIntegralType(Type type) {
+    return type == Type::kInt8 || type == Type::kUint8 ||
+           type == Type::kInt16 || type == Type::kUint16;
+  }
+
  private:
   Type type_;
   SequenceType sequence_type_;
@@ -377,6 +394,28 @@ struct FastApiArrayBuffer {
   size_t byte_length;
 };
 
+// A JavaScript array with unboxed double elements, passed as a span over its
+// backing store. Only packed arrays of doubles take the fast path; any other
+// array falls back to the slow call. Arrays of Smis have tagged elements and
+// can't be viewed as a span, so they should be passed as v8::Local<v8::Array>
+// and copied with TryToCopyAndConvertArrayToCppBuffer instead.
+template <typename T>
+struct FastApiArray : public FastApiTypedArray<T> {};
+
+// A view of the characters of a flat (sequential) one-byte string. The string
+// is not null-terminated. Strings with a different representation, e.g. cons
+// or sliced strings, fall back to the slow call.
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
+// Same as FastOneByteString, for flat (sequential) two-byte strings.
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   // Construct a struct to hold a CFunction's type information.
@@ -429,12 +468,19 @@ struct AnyCType {
     double double_value;
     Local<Object> object_value;
     Local<Array> sequence_value;
+    const FastApiTypedArray<int8_t>* int8_ta_value;
+    const FastApiTypedArray<uint8_t>* uint8_ta_value;
+    const FastApiTypedArray<int16_t>* int16_ta_value;
+    const FastApiTypedArray<uint16_t>* uint16_ta_value;
     const FastApiTypedArray<int32_t>* int32_ta_value;
     const FastApiTypedArray<uint32_t>* uint32_ta_value;
     const FastApiTypedArray<int64_t>* int64_ta_value;
     const FastApiTypedArray<uint64_t>* uint64_ta_value;
     const FastApiTypedArray<float>* float_ta_value;
     const FastApiTypedArray<double>* double_ta_value;
+    const FastApiArray<double>* double_array_value;
+    const FastOneByteString* one_byte_string_value;
+    const FastTwoByteString* two_byte_string_value;
     FastApiCallbackOptions* options_value;
   };
 };
@@ -682,6 +728,10 @@ PRIMITIVE_C_TYPES(DEFINE_TYPE_INFO_TRAITS)
   };
 
 #define TYPED_ARRAY_C_TYPES(V) \
+  V(int8_t, kInt8)             \
+  V(uint8_t, kUint8)           \
+  V(int16_t, kInt16)           \
+  V(uint16_t, kUint16)         \
   V(int32_t, kInt32)           \
   V(uint32_t, kUint32)         \
   V(int64_t, kInt64)           \
@@ -703,6 +753,40 @@ struct TypeInfoHelper<v8::Local<v8::Array>> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastApiArray<double>&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() { return CTypeInfo::Type::kFloat64; }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kIsSequence;
+  }
+};
+
+template <>
+struct TypeInfoHelper<const FastOneByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqOneByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
+template <>
+struct TypeInfoHelper<const FastTwoByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqTwoByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 template <>
 struct TypeInfoHelper<v8::Local<v8::Uint32Array>> {
   static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
@@ -759,13 +843,20 @@ class V8_EXPORT CTypeInfoBuilder {
         uint8_t(kFlags) & uint8_t(CTypeInfo::Flags::kIsRestrictedBit),
         CTypeInfo::IsFloatingPointType(kType),
         "kIsRestrictedBit is only allowed for floating point types.");
-    STATIC_ASSERT_IMPLIES(kSequenceType == CTypeInfo::SequenceType::kIsSequence,
-                          kType == CTypeInfo::Type::kVoid,
-                          "Sequences are only supported from void type.");
+    STATIC_ASSERT_IMPLIES(
+        kSequenceType == CTypeInfo::SequenceType::kIsSequence,
+        kType == CTypeInfo::Type::kVoid || kType == CTypeInfo::Type::kFloat64,
+        "Sequences are only supported from void or double type.");
     STATIC_ASSERT_IMPLIES(
         kSequenceType == CTypeInfo::SequenceType::kIsTypedArray,
-        CTypeInfo::IsPrimitive(kType) || kType == CTypeInfo::Type::kVoid,
+        CTypeInfo::IsPrimitive(kType) ||
+            CTypeInfo::IsSmallIntegralType(kType) ||
+            kType == CTypeInfo::Type::kVoid,
         "TypedArrays are only supported from primitive types or void.");
+    STATIC_ASSERT_IMPLIES(
+        CTypeInfo::IsSmallIntegralType(kType),
+        kSequenceType == CTypeInfo::SequenceType::kIsTypedArray,
+        "8- and 16-bit integer types are only supported for TypedArrays.");
 
     // Return the same type with the merged flags.
     return CTypeInfo(internal::TypeInfoHelper<T>::Type(),
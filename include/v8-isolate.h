@@ -37,6 +37,8 @@ class ScriptOrModule;
 class SharedArrayBuffer;
 
 namespace internal {
+class IsolateGroup;
+class IsolatePool;
 class MicrotaskQueue;
 class ThreadLocalTop;
 }  // namespace internal
@@ -104,10 +106,10 @@ class V8_EXPORT ResourceConstraints {
    * The amount of virtual memory reserved for generated code. This is relevant
    * for 64-bit architectures that rely on code range for calls in code.
    *
-   * When V8_COMPRESS_POINTERS_IN_SHARED_CAGE is defined, there is a shared
-   * process-wide code range that is lazily initialized. This value is used to
-   * configure that shared code range when the first Isolate is
-   * created. Subsequent Isolates ignore this value.
+   * When V8_COMPRESS_POINTERS_IN_SHARED_CAGE is defined, the isolates of an
+   * IsolateGroup share a code range that is lazily initialized. This value is
+   * used to configure that shared code range when the first Isolate of the
+   * group is created. Subsequent Isolates of the group ignore this value.
    */
   size_t code_range_size_in_bytes() const { return code_range_size_; }
   void set_code_range_size_in_bytes(size_t limit) { code_range_size_ = limit; }
@@ -152,6 +154,18 @@ class V8_EXPORT ResourceConstraints {
     initial_young_generation_size_ = initial_size;
   }
 
+  /**
+   * The fraction of the time the embedder is willing to spend at most in
+   * garbage collection, e.g. 0.05 for 5%. If set, the heap grows more
+   * aggressively, bounded only by the maximum generation sizes, and the young
+   * and old generation limits are adjusted to the measured GC costs. The
+   * default of 0 keeps the built-in heap growing strategy.
+   */
+  double gc_time_fraction_goal() const { return gc_time_fraction_goal_; }
+  void set_gc_time_fraction_goal(double fraction) {
+    gc_time_fraction_goal_ = fraction;
+  }
+
  private:
   static constexpr size_t kMB = 1048576u;
   size_t code_range_size_ = 0;
@@ -159,6 +173,7 @@ class V8_EXPORT ResourceConstraints {
   size_t max_young_generation_size_ = 0;
   size_t initial_old_generation_size_ = 0;
   size_t initial_young_generation_size_ = 0;
+  double gc_time_fraction_goal_ = 0;
   uint32_t* stack_limit_ = nullptr;
 };
 
@@ -194,6 +209,101 @@ enum RAILMode : unsigned {
  */
 enum class MemoryPressureLevel { kNone, kModerate, kCritical };
 
+/**
+ * Controls when the functions of an isolate tier up to the optimizing
+ * compilers, see Isolate::SetTieringPolicy. Budgets are measured in the units
+ * of the interrupt budget, roughly bytes of bytecode executed between two
+ * tiering decisions. Smaller budgets tier up earlier, larger budgets give the
+ * compilers more feedback and compile fewer functions. A value of 0 keeps the
+ * default that is given by V8's flags.
+ */
+struct TieringPolicy {
+  /**
+   * Budget until a function gets a feedback vector and Sparkplug code.
+   */
+  int sparkplug_interrupt_budget = 0;
+
+  /**
+   * Budget between two tiering decisions of a function that tiers up to
+   * Maglev, if Maglev is enabled.
+   */
+  int maglev_interrupt_budget = 0;
+
+  /**
+   * Budget between two tiering decisions of a function that tiers up to
+   * TurboFan.
+   */
+  int turbofan_interrupt_budget = 0;
+
+  /**
+   * Maximum number of functions that wait for concurrent TurboFan
+   * compilation. Functions that are hot while the queue is full are tried
+   * again at their next tiering decision. The value is capped by V8's flags.
+   */
+  int max_compile_queue_length = 0;
+
+  /**
+   * Share of the platform's worker threads, between 0 and 1, that compile
+   * TurboFan jobs concurrently. At least one job is compiled at a time.
+   * 0 does not limit the number of threads.
+   */
+  double max_concurrent_compile_share = 0;
+};
+
+/**
+ * An isolate group is a set of isolates which share a pointer compression
+ * cage, and with it the read-only heap, the code range and the shared heap.
+ * JavaScript objects can only be shared between isolates of the same group.
+ *
+ * When V8_COMPRESS_POINTERS_IN_SHARED_CAGE is defined, the heaps of all
+ * isolates of a group are limited to the 4GB of its cage together, and
+ * embedders can create more groups to use more memory. Otherwise, there is
+ * only the default group.
+ *
+ * IsolateGroup objects are handles to reference counted groups. A group is
+ * freed once no handles to it and no isolates in it remain.
+ */
+class V8_EXPORT IsolateGroup {
+ public:
+  /**
+   * Returns the group isolates are created in by Isolate::New() without a
+   * group.
+   */
+  static IsolateGroup GetDefault();
+
+  /**
+   * Returns whether Create() is supported, which requires
+   * V8_COMPRESS_POINTERS_IN_SHARED_CAGE and that the sandbox is not enabled.
+   */
+  static bool CanCreateNewGroups();
+
+  /**
+   * Creates a new group with its own pointer compression cage. Must only be
+   * called if CanCreateNewGroups() returns true.
+   */
+  static IsolateGroup Create();
+
+  IsolateGroup(const IsolateGroup& other);
+  IsolateGroup& operator=(const IsolateGroup& other);
+  IsolateGroup(IsolateGroup&& other) noexcept;
+  IsolateGroup& operator=(IsolateGroup&& other) noexcept;
+  ~IsolateGroup();
+
+  bool operator==(const IsolateGroup& other) const {
+    return isolate_group_ == other.isolate_group_;
+  }
+  bool operator!=(const IsolateGroup& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  friend class Isolate;
+
+  explicit IsolateGroup(internal::IsolateGroup* isolate_group);
+
+  internal::IsolateGroup* isolate_group_;
+};
+
 /**
  * Isolate represents an isolated instance of the V8 engine.  V8 isolates have
  * completely separate states.  Objects from one isolate must not be used in
@@ -573,6 +683,12 @@ class V8_EXPORT Isolate {
    */
   static Isolate* Allocate();
 
+  /**
+   * Like Allocate(), but allocates the isolate in the given |group| instead of
+   * the default group.
+   */
+  static Isolate* Allocate(const IsolateGroup& group);
+
   /**
    * Initialize an Isolate previously allocated by Isolate::Allocate().
    */
@@ -589,6 +705,18 @@ class V8_EXPORT Isolate {
    */
   static Isolate* New(const CreateParams& params);
 
+  /**
+   * Like New(), but creates the isolate in the given |group| instead of the
+   * default group. An isolate attached to a shared isolate must be in the
+   * group of the shared isolate.
+   */
+  static Isolate* New(const IsolateGroup& group, const CreateParams& params);
+
+  /**
+   * Returns the group the isolate was created in.
+   */
+  IsolateGroup GetGroup() const;
+
   /**
    * Returns the entered isolate for the current thread or NULL in
    * case there is no current isolate.
@@ -796,6 +924,27 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  using RuntimeCallStatsSampleCallback = void (*)(const char* name,
+                                                  uint64_t samples,
+                                                  void* data);
+
+  /**
+   * Reports how many CPU profiler ticks hit each runtime call stats counter
+   * (e.g. an IC miss, a compiler phase or a GC phase) since the last call to
+   * ResetRuntimeCallStatsSamples. The callback is invoked once per counter
+   * with at least one sample. Samples are only collected while a CpuProfiler
+   * is running on this isolate and V8 runs with
+   * --runtime-call-stats-sampling, in which case entering and leaving a
+   * counter no longer reads the clock.
+   */
+  void GetRuntimeCallStatsSamples(RuntimeCallStatsSampleCallback callback,
+                                  void* data = nullptr);
+
+  /**
+   * Sets the sample counts reported by GetRuntimeCallStatsSamples to zero.
+   */
+  void ResetRuntimeCallStatsSamples();
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -1351,6 +1500,24 @@ class V8_EXPORT Isolate {
    */
   void IsolateInBackgroundNotification();
 
+  /**
+   * Optional notification that the embedder expects a period of high load,
+   * e.g. a burst of incoming requests or a page load, between
+   * start_in_seconds and end_in_seconds. Both arguments are compared with
+   * MonotonicallyIncreasingTime() and should be based on the same timebase as
+   * that function. V8 uses these notifications to avoid starting expensive
+   * garbage collection work that would overlap with the expected load and to
+   * prefer doing such work in the gaps between load periods.
+   * It is allowed to call this function from another thread while
+   * the isolate is executing long running JavaScript code.
+   */
+  void ExpectedLoadNotification(double start_in_seconds, double end_in_seconds);
+
+  /**
+   * Discards all load periods reported via ExpectedLoadNotification().
+   */
+  void ClearExpectedLoadNotifications();
+
   /**
    * Optional notification which will enable the memory savings mode.
    * V8 uses this notification to guide heuristics which may result in a
@@ -1363,6 +1530,16 @@ class V8_EXPORT Isolate {
    */
   void DisableMemorySavingsMode();
 
+  /**
+   * Sets a soft limit on the memory taken by the bytecode that survives a full
+   * garbage collection. When bytecode flushing is enabled and the budget is
+   * exceeded, bytecode that has not run for the longest time is flushed first
+   * and recompiled lazily if it is needed again. While there is room in the
+   * budget, bytecode is kept for longer than without one. A budget of 0, the
+   * default, flushes bytecode once it reaches a fixed age.
+   */
+  void SetBytecodeFlushingBudget(size_t budget_in_bytes);
+
   /**
    * Optional notification to tell V8 the current performance requirements
    * of the embedder based on RAIL.
@@ -1372,6 +1549,14 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Sets the policy that decides when functions of this isolate are compiled
+   * with the optimizing compilers. Functions pick up the new budgets at their
+   * next tiering decision. Tiering decisions are reported as trace events
+   * in the disabled-by-default-v8.tiering category.
+   */
+  void SetTieringPolicy(const TieringPolicy& policy);
+
   /**
    * Update load start time of the RAIL mode
    */
@@ -1506,6 +1691,21 @@ class V8_EXPORT Isolate {
    */
   void AutomaticallyRestoreInitialHeapLimit(double threshold_percent = 0.5);
 
+  /**
+   * Changes the maximum size of the young generation, which was initially set
+   * through ResourceConstraints. Shrinking releases the memory of the unused
+   * pages. The new size takes effect after the next garbage collection.
+   */
+  void SetMaxYoungGenerationSize(size_t max_young_generation_size_in_bytes);
+
+  /**
+   * Sets the pause time the young generation garbage collector aims for. The
+   * young generation only grows while its collections are estimated to be
+   * shorter, and shrinks when they are estimated to be longer. A target of 0
+   * disables this, which is the default.
+   */
+  void SetYoungGenerationPauseTarget(double milliseconds);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
@@ -1716,6 +1916,45 @@ MaybeLocal<T> Isolate::GetDataFromSnapshotOnce(size_t index) {
   return Local<T>(data);
 }
 
+/**
+ * A pool of isolates that are created ahead of time on worker threads, for
+ * embedders that create isolates on demand. Creating an isolate, which
+ * includes deserializing the startup snapshot, then happens off the thread
+ * that needs the isolate.
+ *
+ * The pool must be destroyed before V8 is disposed. The isolates it hands out
+ * are owned by the embedder and disposed with Isolate::Dispose().
+ */
+class V8_EXPORT IsolatePool {
+ public:
+  /**
+   * Creates a pool that keeps |capacity| isolates created from |params|
+   * ready. The data |params| points to, like the array buffer allocator and
+   * the snapshot blob, must outlive the pool. A stack limit in |params|
+   * applies to the threads that acquire the isolates.
+   */
+  IsolatePool(const Isolate::CreateParams& params, size_t capacity);
+
+  /**
+   * Disposes the isolates that were not handed out.
+   */
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  /**
+   * Returns a new isolate for use on the calling thread, and starts creating
+   * another one in its place. Creates the isolate on the calling thread if
+   * none is ready. Like Isolate::New(), does not change the currently entered
+   * isolate.
+   */
+  Isolate* Acquire();
+
+ private:
+  std::unique_ptr<internal::IsolatePool> impl_;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_ISOLATE_H_
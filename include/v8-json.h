@@ -5,6 +5,9 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -40,6 +43,36 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Parses UTF-8 encoded JSON text that arrives in chunks, e.g. from the
+   * network, without concatenating the chunks first.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    StreamingParser();
+    ~StreamingParser();
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Decodes the next chunk of the text. Chunks may split UTF-8 sequences.
+     * This does not access the isolate, so it may be called on any thread,
+     * and its cost is proportional to the size of the chunk.
+     */
+    void AddChunk(const uint8_t* data, size_t length);
+
+    /**
+     * Parses the text added so far and returns the same value as JSON.parse
+     * of the decoded text would, or throws the same exception. Afterwards,
+     * the parser can be used for the next text.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 }  // namespace v8
@@ -95,6 +95,41 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+enum class GarbageCollectionPhase {
+  kScavenge,
+  kScavengeParallel,
+  kMinorMarkCompact,
+  kMarkCompactAtomicPause,
+  kMarkCompactMark,
+  kMarkCompactClear,
+  kMarkCompactEvacuate,
+  kMarkCompactSweep,
+  kIncrementalMarkingStep,
+  kIncrementalSweepingStep,
+};
+
+/**
+ * Distribution of the main-thread wall clock durations of one garbage
+ * collection phase, accumulated since the previous histogram for the same
+ * phase was reported. Only non-empty buckets are included. Bucket i covers
+ * [bucket_lower_bounds_in_us[i], bucket_upper_bounds_in_us[i]) and the width
+ * of a bucket is at most 1/8 of its lower bound, so percentiles derived from
+ * the buckets have a relative error of at most 12.5%.
+ */
+struct GarbageCollectionPhaseHistogram {
+  GarbageCollectionPhase phase = GarbageCollectionPhase::kScavenge;
+  int64_t sample_count = 0;
+  int64_t min_in_us = -1;
+  int64_t max_in_us = -1;
+  int64_t sum_in_us = -1;
+  int64_t p50_in_us = -1;
+  int64_t p99_in_us = -1;
+  int64_t p999_in_us = -1;
+  std::vector<int64_t> bucket_lower_bounds_in_us;
+  std::vector<int64_t> bucket_upper_bounds_in_us;
+  std::vector<int64_t> bucket_counts;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -143,6 +178,7 @@ struct WasmModulesPerIsolate {
   V(GarbageCollectionFullMainThreadIncrementalSweep)        \
   V(GarbageCollectionFullMainThreadBatchedIncrementalSweep) \
   V(GarbageCollectionYoungCycle)                            \
+  V(GarbageCollectionPhaseHistogram)                        \
   V(WasmModuleDecoded)                                      \
   V(WasmModuleCompiled)                                     \
   V(WasmModuleInstantiated)                                 \
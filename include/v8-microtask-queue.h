@@ -10,6 +10,7 @@
 #include <memory>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8-microtask.h"     // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -60,6 +61,30 @@ class V8_EXPORT MicrotaskQueue {
                                 MicrotaskCallback callback,
                                 void* data = nullptr) = 0;
 
+  /**
+   * Enqueues the functions to the queue in order, growing the queue at most
+   * once.
+   */
+  virtual void EnqueueMicrotasks(
+      Isolate* isolate, MemorySpan<const Local<Function>> microtasks) = 0;
+
+  /**
+   * Enqueues a call of the callback for each of the data pointers to the
+   * queue in order, growing the queue at most once.
+   */
+  virtual void EnqueueMicrotasks(Isolate* isolate, MicrotaskCallback callback,
+                                 MemorySpan<void* const> data) = 0;
+
+  /**
+   * Enqueues the callback to the queue without entering the isolate. Unlike
+   * the other methods, this may be called from any thread, concurrently with
+   * the isolate's thread. The callback is moved to the queue, and so runs, at
+   * the next microtask checkpoint on the isolate's thread, which the embedder
+   * is responsible for scheduling.
+   */
+  virtual void EnqueueMicrotaskFromAnyThread(MicrotaskCallback callback,
+                                             void* data = nullptr) = 0;
+
   /**
    * Adds a callback to notify the embedder after microtasks were run. The
    * callback is triggered by explicit RunMicrotasks call or automatic
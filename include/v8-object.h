@@ -682,6 +682,22 @@ class V8_EXPORT Object : public Value {
                            Local<Name>* names, Local<Value>* values,
                            size_t length);
 
+  /**
+   * Creates |count| JavaScript objects, which all have Object.prototype as
+   * their prototype and the |num_properties| given |names| as enumerable,
+   * configurable and writable properties, in that order. The |values| are
+   * given row by row: the properties of the i-th object have the values
+   * values[i * num_properties] to values[(i + 1) * num_properties - 1].
+   * The objects are stored to |objects|, which needs room for |count|
+   * elements.
+   * This is equivalent to creating each object with New() and then adding
+   * the properties with CreateDataProperty(), but much faster, as the shape
+   * of the objects is only computed once.
+   */
+  static void NewBatch(Isolate* isolate, Local<Name>* names,
+                       size_t num_properties, Local<Value>* values,
+                       size_t count, Local<Object>* objects);
+
   V8_INLINE static Object* Cast(Value* obj);
 
   /**
@@ -375,6 +375,33 @@ class V8_EXPORT String : public Name {
     const char* cached_data_ = nullptr;
   };
 
+  /**
+   * An ExternalUtf8StringResource is a wrapper around a UTF-8 encoded string
+   * buffer that resides outside V8's heap, see NewExternalUtf8. Note that the
+   * string data must be immutable.
+   */
+  class V8_EXPORT ExternalUtf8StringResource
+      : public ExternalStringResourceBase {
+   public:
+    /**
+     * Override the destructor to manage the life cycle of the underlying
+     * buffer.
+     */
+    ~ExternalUtf8StringResource() override = default;
+
+    /**
+     * The UTF-8 data from the underlying buffer. If the resource is cacheable
+     * then data() must return the same value for all invocations.
+     */
+    virtual const char* data() const = 0;
+
+    /** The number of bytes in the string. */
+    virtual size_t length() const = 0;
+
+   protected:
+    ExternalUtf8StringResource() = default;
+  };
+
   /**
    * If the string is an external string, return the ExternalStringResourceBase
    * regardless of the encoding, otherwise return NULL.  The encoding of the
@@ -477,6 +504,17 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource,
+   * taking ownership of the resource as NewExternalOneByte does. If the data
+   * is pure ASCII, the string is an external one-byte string which uses the
+   * data without copying it, and GetExternalOneByteStringResource() returns a
+   * wrapper around |resource|. Otherwise the data is decoded into a new
+   * string like NewFromUtf8 does, and the resource is disposed right away.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalUtf8(
+      Isolate* isolate, ExternalUtf8StringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -21,6 +21,7 @@
 namespace v8 {
 
 enum class EmbedderStateTag : uint8_t;
+class Function;
 class HeapGraphNode;
 struct HeapStatsUpdate;
 class Object;
@@ -182,6 +183,10 @@ class V8_EXPORT CpuProfileNode {
  */
 class V8_EXPORT CpuProfile {
  public:
+  enum SerializationFormat {
+    kPprof = 0  // See format description near 'Serialize' method.
+  };
+
   /** Returns CPU profile title. */
   Local<String> GetTitle() const;
 
@@ -235,6 +240,20 @@ class V8_EXPORT CpuProfile {
    * All pointers to nodes previously returned become invalid.
    */
   void Delete();
+
+  /**
+   * Prepare a serialized representation of the profile. The result is
+   * written into the stream provided in chunks of specified size.
+   *
+   * For the pprof format, the profile is encoded as an uncompressed
+   * |perftools.profiles.Profile| protocol buffer, as described in
+   * https://github.com/google/pprof/blob/main/proto/profile.proto.
+   * There is one sample per distinct call stack of the top down call tree,
+   * with a sample count and the CPU time in nanoseconds as values. Recording
+   * of individual samples is not required.
+   */
+  void Serialize(OutputStream* stream,
+                 SerializationFormat format = kPprof) const;
 };
 
 enum CpuProfilingMode {
@@ -478,6 +497,13 @@ class V8_EXPORT CpuProfiler {
    */
   static void UseDetailedSourcePositionsForProfiling(Isolate* isolate);
 
+  /**
+   * Returns the number of times optimized code of |function| got
+   * deoptimized in the |isolate|. Functions with the same source share their
+   * count.
+   */
+  static int GetDeoptCount(Isolate* isolate, Local<Function> function);
+
  private:
   CpuProfiler();
   ~CpuProfiler();
@@ -799,6 +825,54 @@ class V8_EXPORT AllocationProfile {
   static const int kNoColumnNumberInfo = Message::kNoColumnInfo;
 };
 
+/**
+ * Changes of the sampled allocations since the previous call to
+ * HeapProfiler::GetAllocationProfileDelta. Allocation stacks are interned:
+ * a stack is identified by the node id of its top frame, and each frame
+ * refers to the stack of its caller by |parent_node_id|. Every frame is
+ * reported once, in the first delta after it was created, and before any
+ * frame or sample referring to it.
+ */
+class V8_EXPORT AllocationProfileDelta {
+ public:
+  /**
+   * A frame of an allocation stack, see AllocationProfile::Node for the
+   * meaning of the fields.
+   */
+  struct Frame {
+    Local<String> name;
+    Local<String> script_name;
+    int script_id;
+    int start_position;
+    int line_number;
+    int column_number;
+    uint32_t node_id;
+    /**
+     * Node id of the caller's frame, or 0 for the root frame.
+     */
+    uint32_t parent_node_id;
+  };
+
+  /**
+   * Frames which were not reported by a previous delta. May include frames
+   * whose samples were already collected.
+   */
+  virtual const std::vector<Frame>& GetNewFrames() = 0;
+
+  /**
+   * Samples recorded since the previous delta and still alive.
+   */
+  virtual const std::vector<AllocationProfile::Sample>& GetNewSamples() = 0;
+
+  /**
+   * Ids of samples reported by a previous delta which have been collected
+   * since.
+   */
+  virtual const std::vector<uint64_t>& GetRemovedSampleIds() = 0;
+
+  virtual ~AllocationProfileDelta() = default;
+};
+
 /**
  * An object graph consisting of embedder objects and V8 objects.
  * Edges of the graph are strong references between the objects.
@@ -1121,6 +1195,15 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Returns the changes of the sampled profile since the previous call. The
+   * first call returns all live samples, so that polling this is cheaper than
+   * repeatedly calling GetAllocationProfile for large profiles. The ownership
+   * of the pointer is transferred to the caller. Returns nullptr if sampling
+   * heap profiler is not active.
+   */
+  AllocationProfileDelta* GetAllocationProfileDelta();
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
@@ -133,6 +133,12 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the memory held for the regexp backtracking stack, including
+   * memory kept for reuse by later regexp executions.
+   */
+  size_t regexp_stack_size() { return regexp_stack_size_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -154,6 +160,7 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t regexp_stack_size_;
 
   friend class V8;
   friend class Isolate;
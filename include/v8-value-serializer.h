@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
 #include <utility>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
@@ -17,6 +18,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -84,6 +86,20 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetSharedValueId(Isolate* isolate,
                                              Local<Value> shared_value);
 
+    /**
+     * Called when the ValueSerializer writes the contents of an ArrayBuffer or
+     * string out of band, see ValueSerializer::SetOutOfBandThreshold. The
+     * |backing_store| holds a copy of the contents which is not referenced by
+     * any JavaScript object. The embedder must keep it alive and return an ID
+     * for it, which will be passed to
+     * ValueDeserializer::Delegate::GetOutOfBandBackingStoreFromId.
+     *
+     * If Nothing<uint32_t>() is returned, the contents are written into the
+     * buffer instead, unless an exception was thrown.
+     */
+    virtual Maybe<uint32_t> GetOutOfBandBackingStoreId(
+        Isolate* isolate, std::shared_ptr<BackingStore> backing_store);
+
     /**
      * Allocates memory for the buffer of at least the size provided. The actual
      * size (which may be greater or equal) is written to |actual_size|. If no
@@ -146,6 +162,18 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Sets the size in bytes from which the contents of ArrayBuffers (including
+   * those of typed arrays and DataViews) and strings are not copied into the
+   * buffer, but into a BackingStore which is passed to
+   * Delegate::GetOutOfBandBackingStoreId. The deserializer adopts the
+   * BackingStore without copying it again. This should not be called when no
+   * Delegate was passed.
+   *
+   * The default of 0 writes all contents into the buffer.
+   */
+  void SetOutOfBandThreshold(size_t byte_length);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -207,6 +235,18 @@ class V8_EXPORT ValueDeserializer {
      */
     virtual MaybeLocal<Value> GetSharedValueFromId(Isolate* isolate,
                                                    uint32_t shared_value_id);
+
+    /**
+     * Get a BackingStore given an ID previously provided by
+     * ValueSerializer::Delegate::GetOutOfBandBackingStoreId. The contents of
+     * the BackingStore are adopted by the deserialized value, so it must not
+     * be handed out again.
+     *
+     * If the BackingStore is not available, an exception should be thrown and
+     * nullptr returned.
+     */
+    virtual std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+        Isolate* isolate, uint32_t id);
   };
 
   ValueDeserializer(Isolate* isolate, const uint8_t* data, size_t size);
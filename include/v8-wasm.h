@@ -64,6 +64,41 @@ class V8_EXPORT CompiledWasmModule {
   const std::string source_url_;
 };
 
+/**
+ * An embedder-provided cache for compiled WebAssembly code which outlives
+ * the process, e.g. because it is backed by the disk. Once installed, V8 looks
+ * up modules in the cache before compiling them, and stores their code in the
+ * cache in the background after top-tier compilation made progress. Entries
+ * are opaque to the embedder, and keys already include everything that would
+ * make the code invalid, like the V8 version, flags, and CPU features.
+ *
+ * All methods can be called concurrently on any thread.
+ */
+class V8_EXPORT WasmCodeCache {
+ public:
+  virtual ~WasmCodeCache() = default;
+
+  /**
+   * Returns the data that was stored for the given key, or an empty buffer if
+   * there is no such entry.
+   */
+  virtual OwnedBuffer Get(MemorySpan<const uint8_t> key) = 0;
+
+  /**
+   * Stores data for the given key, replacing any previous entry. The spans
+   * are only valid for the duration of the call.
+   */
+  virtual void Put(MemorySpan<const uint8_t> key,
+                   MemorySpan<const uint8_t> data) = 0;
+
+  /**
+   * Installs the cache for all isolates of the process, or removes it if
+   * |cache| is null. The cache must stay alive until it is removed again or
+   * V8 is disposed. Must be called after V8 was initialized.
+   */
+  static void Set(WasmCodeCache* cache);
+};
+
 // An instance of WebAssembly.Memory.
 class V8_EXPORT WasmMemoryObject : public Object {
  public:
@@ -49,18 +49,24 @@
 #include "src/debug/debug-wasm-objects.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 #include "src/debug/liveedit.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/futex-emulation.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/isolate-pool.h"
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
+#include "src/execution/shared-ring-buffer.h"
 #include "src/execution/simulator.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
@@ -70,6 +76,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -111,6 +118,7 @@
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/profile-generator-inl.h"
 #include "src/profiler/tick-sample.h"
+#include "src/regexp/regexp-stack.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/runtime/runtime.h"
 #include "src/sandbox/external-pointer.h"
@@ -1040,6 +1048,9 @@ void Context::Enter() {
   i::Handle<i::Context> env = Utils::OpenHandle(this);
   i::Isolate* i_isolate = env->GetIsolate();
   ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  if (i::ContextCpuTime* cpu_time = i_isolate->context_cpu_time()) {
+    cpu_time->Sample();
+  }
   i::HandleScopeImplementer* impl = i_isolate->handle_scope_implementer();
   impl->EnterContext(*env);
   impl->SaveContext(i_isolate->context());
@@ -1055,6 +1066,9 @@ void Context::Exit() {
                        "Cannot exit non-entered context")) {
     return;
   }
+  if (i::ContextCpuTime* cpu_time = i_isolate->context_cpu_time()) {
+    cpu_time->Sample();
+  }
   impl->LeaveContext();
   i_isolate->set_context(impl->RestoreContext());
 }
@@ -2762,6 +2776,28 @@ ScriptCompiler::ConsumeCodeCacheTask::~ConsumeCodeCacheTask() = default;
 
 void ScriptCompiler::ConsumeCodeCacheTask::Run() { impl_->Run(); }
 
+void ScriptCompiler::ConsumeCodeCacheTask::SourceTextAvailable(
+    Isolate* v8_isolate, Local<String> source_text,
+    const ScriptOrigin& origin) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::String> str = Utils::OpenHandle(*(source_text));
+  i::ScriptDetails script_details =
+      GetScriptDetails(i_isolate, origin.ResourceName(), origin.LineOffset(),
+                       origin.ColumnOffset(), origin.SourceMapUrl(),
+                       origin.GetHostDefinedOptions(), origin.Options());
+  impl_->SourceTextAvailable(i_isolate, str, script_details);
+}
+
+bool ScriptCompiler::ConsumeCodeCacheTask::ShouldMergeWithExistingScript()
+    const {
+  return impl_->ShouldMergeWithExistingScript();
+}
+
+void ScriptCompiler::ConsumeCodeCacheTask::MergeWithExistingScript() {
+  impl_->MergeWithExistingScript();
+}
+
 ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
     Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
   if (!i::FLAG_concurrent_cache_deserialization) return nullptr;
@@ -3321,6 +3357,27 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  i::JsonStreamingParser parser;
+};
+
+JSON::StreamingParser::StreamingParser() : private_(new PrivateData) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+void JSON::StreamingParser::AddChunk(const uint8_t* data, size_t length) {
+  private_->parser.AddChunk(base::Vector<const uint8_t>(data, length));
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, ParseStreaming, Value);
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(private_->parser.Finish(i_isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3378,6 +3435,11 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetSharedValueId(
   return Nothing<uint32_t>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetOutOfBandBackingStoreId(
+    Isolate* v8_isolate, std::shared_ptr<BackingStore> backing_store) {
+  return Nothing<uint32_t>();
+}
+
 void* ValueSerializer::Delegate::ReallocateBufferMemory(void* old_buffer,
                                                         size_t size,
                                                         size_t* actual_size) {
@@ -3411,6 +3473,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t byte_length) {
+  private_->serializer.SetOutOfBandThreshold(byte_length);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3488,6 +3554,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return MaybeLocal<SharedArrayBuffer>();
 }
 
+std::shared_ptr<BackingStore>
+ValueDeserializer::Delegate::GetOutOfBandBackingStoreFromId(
+    Isolate* v8_isolate, uint32_t id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->ScheduleThrow(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
 struct ValueDeserializer::PrivateData {
   PrivateData(i::Isolate* i_isolate, base::Vector<const uint8_t> data,
               Delegate* delegate)
@@ -6169,7 +6245,8 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      regexp_stack_size_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -6503,6 +6580,25 @@ v8::MicrotaskQueue* Context::GetMicrotaskQueue() {
   return i::Handle<i::NativeContext>::cast(env)->microtask_queue();
 }
 
+Context::CpuTime Context::GetCpuTime() {
+  i::Handle<i::Context> env = Utils::OpenHandle(this);
+  i::Isolate* i_isolate = env->GetIsolate();
+  using Activity = i::ContextCpuTime::Activity;
+  CpuTime result;
+  // Charge the time since the last sample first.
+  if (i::ContextCpuTime* cpu_time = i_isolate->context_cpu_time()) {
+    cpu_time->Sample();
+  }
+  i::NativeContext context = env->native_context();
+  result.microtasks_us =
+      i::ContextCpuTime::Get(context, Activity::kMicrotasks);
+  result.compile_us = i::ContextCpuTime::Get(context, Activity::kCompile);
+  result.gc_us = i::ContextCpuTime::Get(context, Activity::kGC);
+  result.total_us = i::ContextCpuTime::Get(context, Activity::kScript) +
+                    result.microtasks_us + result.compile_us + result.gc_us;
+  return result;
+}
+
 v8::Local<v8::Object> Context::Global() {
   i::Handle<i::Context> context = Utils::OpenHandle(this);
   i::Isolate* i_isolate = context->GetIsolate();
@@ -6550,6 +6646,15 @@ void Context::SetErrorMessageForCodeGenerationFromStrings(Local<String> error) {
   context->set_error_message_for_code_gen_from_strings(*error_handle);
 }
 
+size_t Context::GetMeasuredMemorySize() const {
+  i::Context context = *Utils::OpenHandle(this);
+  Utils::ApiCheck(context.IsNativeContext(), "Context::GetMeasuredMemorySize",
+                  "Not a native context");
+  return static_cast<size_t>(
+             i::NativeContext::cast(context).measured_memory_kb().value()) *
+         i::KB;
+}
+
 void Context::SetAbortScriptExecution(
     Context::AbortScriptExecutionCallback callback) {
   i::Handle<i::Context> context = Utils::OpenHandle(this);
@@ -6961,6 +7066,62 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalUtf8(
+    Isolate* v8_isolate, v8::String::ExternalUtf8StringResource* resource) {
+  // Exposes pure ASCII UTF-8 data as Latin-1, and disposes the UTF-8 resource
+  // together with itself. Being local to this function lets it forward to the
+  // protected methods of the resource.
+  class AsciiResource final : public ExternalOneByteStringResource {
+   public:
+    explicit AsciiResource(ExternalUtf8StringResource* utf8) : utf8_(utf8) {}
+
+    const char* data() const override { return utf8_->data(); }
+    size_t length() const override { return utf8_->length(); }
+    bool IsCacheable() const override { return utf8_->IsCacheable(); }
+
+   protected:
+    void Dispose() override {
+      utf8_->Dispose();
+      delete this;
+    }
+    void Lock() const override { utf8_->Lock(); }
+    void Unlock() const override { utf8_->Unlock(); }
+
+   private:
+    ExternalUtf8StringResource* const utf8_;
+  };
+
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalUtf8);
+  if (resource->length() == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  const char* data = resource->data();
+  CHECK_NOT_NULL(data);
+  int length = static_cast<int>(resource->length());
+  i::Handle<i::String> string;
+  if (i::String::IsAscii(data, length)) {
+    string = i_isolate->factory()
+                 ->NewExternalStringFromOneByte(new AsciiResource(resource))
+                 .ToHandleChecked();
+  } else {
+    // Non-ASCII data has to be decoded for indexing anyway, so there is no
+    // point in keeping it.
+    string = i_isolate->factory()
+                 ->NewStringFromUtf8(base::Vector<const char>(data, length))
+                 .ToHandleChecked();
+    resource->Dispose();
+  }
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -7146,6 +7307,97 @@ Local<v8::Object> v8::Object::New(Isolate* v8_isolate,
   }
 }
 
+namespace {
+
+// Returns the map for objects with the given properties, which fits the
+// values of all {count} objects, or an empty handle if the objects can't
+// share a fast map.
+i::MaybeHandle<i::Map> MapForObjectBatch(i::Isolate* i_isolate,
+                                         Local<Name>* names,
+                                         size_t num_properties,
+                                         Local<Value>* values, size_t count) {
+  if (num_properties >= i::JSObject::kMapCacheSize) return {};
+  i::Handle<i::Map> map = i_isolate->factory()->ObjectLiteralMapFromCache(
+      i_isolate->native_context(), static_cast<int>(num_properties));
+  for (size_t i = 0; i < num_properties; ++i) {
+    i::Handle<i::Name> name = Utils::OpenHandle(*names[i]);
+    uint32_t index;
+    if (name->AsArrayIndex(&index)) return {};
+    name = i_isolate->factory()->InternalizeName(name);
+    if (map->instance_descriptors(i_isolate).Search(*name, *map).is_found()) {
+      return {};
+    }
+    map = i::Map::TransitionToDataProperty(
+        i_isolate, map, name, Utils::OpenHandle(*values[i]), i::NONE,
+        i::PropertyConstness::kConst, i::StoreOrigin::kNamed);
+    if (map->is_dictionary_map()) return {};
+  }
+  // The map now fits the first object, generalize it for the others.
+  for (size_t i = 1; i < count; ++i) {
+    Local<Value>* row = values + i * num_properties;
+    for (i::InternalIndex descriptor :
+         i::InternalIndex::Range(num_properties)) {
+      map = i::Map::PrepareForDataProperty(
+          i_isolate, map, descriptor, i::PropertyConstness::kConst,
+          Utils::OpenHandle(*row[descriptor.raw_value()]));
+    }
+  }
+  if (map->NumberOfFields(i::ConcurrencyMode::kSynchronous) >
+      map->GetInObjectProperties()) {
+    return {};
+  }
+  return map;
+}
+
+}  // namespace
+
+void v8::Object::NewBatch(Isolate* v8_isolate, Local<Name>* names,
+                          size_t num_properties, Local<Value>* values,
+                          size_t count, Local<Object>* objects) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  API_RCS_SCOPE(i_isolate, Object, NewBatch);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  if (count == 0) return;
+
+  i::Handle<i::Map> map;
+  if (!MapForObjectBatch(i_isolate, names, num_properties, values, count)
+           .ToHandle(&map)) {
+    // Index keys, duplicate keys or too many properties: add the properties
+    // one by one.
+    for (size_t i = 0; i < count; ++i) {
+      i::Handle<i::JSObject> obj =
+          i_isolate->factory()->NewJSObject(i_isolate->object_function());
+      Local<Value>* row = values + i * num_properties;
+      for (size_t j = 0; j < num_properties; ++j) {
+        i::JSObject::DefinePropertyOrElementIgnoreAttributes(
+            obj, Utils::OpenHandle(*names[j]), Utils::OpenHandle(*row[j]))
+            .Check();
+      }
+      objects[i] = Utils::ToLocal(obj);
+    }
+    return;
+  }
+
+  // All fields are in-object, so the objects can be filled in directly.
+  i::Handle<i::DescriptorArray> descriptors(
+      map->instance_descriptors(i_isolate), i_isolate);
+  for (size_t i = 0; i < count; ++i) {
+    i::Handle<i::JSObject> obj = i_isolate->factory()->NewJSObjectFromMap(map);
+    Local<Value>* row = values + i * num_properties;
+    for (i::InternalIndex descriptor :
+         i::InternalIndex::Range(num_properties)) {
+      i::Handle<i::Object> value =
+          Utils::OpenHandle(*row[descriptor.raw_value()]);
+      if (descriptors->GetDetails(descriptor).representation().IsDouble()) {
+        value = i_isolate->factory()->NewHeapNumber(value->Number());
+      }
+      obj->FastPropertyAtPut(i::FieldIndex::ForDescriptor(*map, descriptor),
+                             *value);
+    }
+    objects[i] = Utils::ToLocal(obj);
+  }
+}
+
 Local<v8::Value> v8::NumberObject::New(Isolate* v8_isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   API_RCS_SCOPE(i_isolate, NumberObject, New);
@@ -7832,6 +8084,15 @@ MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+// static
+void WasmCodeCache::Set(WasmCodeCache* cache) {
+#if V8_ENABLE_WEBASSEMBLY
+  i::wasm::GetWasmEngine()->SetCodeCache(cache);
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #if V8_ENABLE_WEBASSEMBLY
   i::Handle<i::WasmMemoryObject> obj = Utils::OpenHandle(this);
@@ -7917,6 +8178,14 @@ void WasmModuleObjectBuilderStreaming::Finish() {}
 
 void WasmModuleObjectBuilderStreaming::Abort(MaybeLocal<Value> exception) {}
 
+void v8::ArrayBuffer::Allocator::FreeBatch(void* const* data,
+                                           const size_t* lengths,
+                                           size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    Free(data[i], lengths[i]);
+  }
+}
+
 void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
                                              size_t new_length) {
   if (old_length == new_length) return data;
@@ -8159,6 +8428,39 @@ size_t v8::SharedArrayBuffer::ByteLength() const {
   return obj->byte_length();
 }
 
+size_t v8::SharedArrayBuffer::RingPush(const void* data, size_t length) {
+  static_assert(kRingHeaderSize == i::SharedRingBuffer::kHeaderSize);
+  i::Handle<i::JSArrayBuffer> obj = Utils::OpenHandle(this);
+  size_t byte_length = obj->byte_length();
+  Utils::ApiCheck(i::SharedRingBuffer::IsValidLength(byte_length),
+                  "v8::SharedArrayBuffer::RingPush",
+                  "Buffer is too small or too large for a ring");
+  size_t pushed = i::SharedRingBuffer::Push(
+      static_cast<uint8_t*>(obj->backing_store()), byte_length,
+      static_cast<const uint8_t*>(data), length);
+  if (pushed > 0) {
+    i::FutexEmulation::Wake(obj, i::SharedRingBuffer::kTailOffset,
+                            i::FutexEmulation::kWakeAll);
+  }
+  return pushed;
+}
+
+size_t v8::SharedArrayBuffer::RingPop(void* data, size_t length) {
+  i::Handle<i::JSArrayBuffer> obj = Utils::OpenHandle(this);
+  size_t byte_length = obj->byte_length();
+  Utils::ApiCheck(i::SharedRingBuffer::IsValidLength(byte_length),
+                  "v8::SharedArrayBuffer::RingPop",
+                  "Buffer is too small or too large for a ring");
+  size_t popped = i::SharedRingBuffer::Pop(
+      static_cast<uint8_t*>(obj->backing_store()), byte_length,
+      static_cast<uint8_t*>(data), length);
+  if (popped > 0) {
+    i::FutexEmulation::Wake(obj, i::SharedRingBuffer::kHeadOffset,
+                            i::FutexEmulation::kWakeAll);
+  }
+  return popped;
+}
+
 Local<SharedArrayBuffer> v8::SharedArrayBuffer::New(Isolate* v8_isolate,
                                                     size_t byte_length) {
   CHECK(i::FLAG_harmony_sharedarraybuffer);
@@ -8611,11 +8913,75 @@ bool Isolate::IsCurrent() const {
   return reinterpret_cast<const i::Isolate*>(this)->IsCurrent();
 }
 
+// static
+IsolateGroup IsolateGroup::GetDefault() {
+  return IsolateGroup(i::IsolateGroup::GetDefault()->Acquire());
+}
+
+// static
+bool IsolateGroup::CanCreateNewGroups() {
+  return i::IsolateGroup::CanCreateNewGroups();
+}
+
+// static
+IsolateGroup IsolateGroup::Create() {
+  Utils::ApiCheck(i::IsolateGroup::CanCreateNewGroups(),
+                  "v8::IsolateGroup::Create",
+                  "Isolate groups are not supported by this build of V8");
+  return IsolateGroup(i::IsolateGroup::New());
+}
+
+IsolateGroup::IsolateGroup(i::IsolateGroup* isolate_group)
+    : isolate_group_(isolate_group) {}
+
+IsolateGroup::IsolateGroup(const IsolateGroup& other)
+    : isolate_group_(other.isolate_group_) {
+  if (isolate_group_ != nullptr) isolate_group_->Acquire();
+}
+
+IsolateGroup& IsolateGroup::operator=(const IsolateGroup& other) {
+  // Acquire first in case of self-assignment.
+  if (other.isolate_group_ != nullptr) other.isolate_group_->Acquire();
+  if (isolate_group_ != nullptr) isolate_group_->Release();
+  isolate_group_ = other.isolate_group_;
+  return *this;
+}
+
+IsolateGroup::IsolateGroup(IsolateGroup&& other) noexcept
+    : isolate_group_(other.isolate_group_) {
+  other.isolate_group_ = nullptr;
+}
+
+IsolateGroup& IsolateGroup::operator=(IsolateGroup&& other) noexcept {
+  if (this != &other) {
+    if (isolate_group_ != nullptr) isolate_group_->Release();
+    isolate_group_ = other.isolate_group_;
+    other.isolate_group_ = nullptr;
+  }
+  return *this;
+}
+
+IsolateGroup::~IsolateGroup() {
+  if (isolate_group_ != nullptr) isolate_group_->Release();
+}
+
 // static
 Isolate* Isolate::Allocate() {
   return reinterpret_cast<Isolate*>(i::Isolate::New());
 }
 
+// static
+Isolate* Isolate::Allocate(const IsolateGroup& group) {
+  Utils::ApiCheck(group.isolate_group_ != nullptr, "v8::Isolate::Allocate",
+                  "The isolate group was moved from");
+  return reinterpret_cast<Isolate*>(i::Isolate::New(group.isolate_group_));
+}
+
+IsolateGroup Isolate::GetGroup() const {
+  const i::Isolate* i_isolate = reinterpret_cast<const i::Isolate*>(this);
+  return IsolateGroup(i_isolate->isolate_group()->Acquire());
+}
+
 Isolate::CreateParams::CreateParams() = default;
 
 Isolate::CreateParams::~CreateParams() = default;
@@ -8682,8 +9048,13 @@ void Isolate::Initialize(Isolate* v8_isolate,
   }
 
   if (params.experimental_attach_to_shared_isolate != nullptr) {
-    i_isolate->set_shared_isolate(reinterpret_cast<i::Isolate*>(
-        params.experimental_attach_to_shared_isolate));
+    i::Isolate* shared_isolate = reinterpret_cast<i::Isolate*>(
+        params.experimental_attach_to_shared_isolate);
+    Utils::ApiCheck(
+        shared_isolate->isolate_group() == i_isolate->isolate_group(),
+        "v8::Isolate::New",
+        "The shared isolate must be in the isolate group of its clients");
+    i_isolate->set_shared_isolate(shared_isolate);
   }
 
   // TODO(v8:2487): Once we got rid of Isolate::Current(), we can remove this.
@@ -8733,6 +9104,20 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
   return v8_isolate;
 }
 
+Isolate* Isolate::New(const IsolateGroup& group,
+                      const Isolate::CreateParams& params) {
+  Isolate* v8_isolate = Allocate(group);
+  Initialize(v8_isolate, params);
+  return v8_isolate;
+}
+
+IsolatePool::IsolatePool(const Isolate::CreateParams& params, size_t capacity)
+    : impl_(std::make_unique<i::IsolatePool>(params, capacity)) {}
+
+IsolatePool::~IsolatePool() = default;
+
+Isolate* IsolatePool::Acquire() { return impl_->Acquire(); }
+
 void Isolate::Dispose() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   if (!Utils::ApiCheck(!i_isolate->IsInUse(), "v8::Isolate::Dispose()",
@@ -8924,6 +9309,7 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   // now we just add the values, thereby over-approximating the peak slightly.
   heap_statistics->malloced_memory_ =
       i_isolate->allocator()->GetCurrentMemoryUsage() +
+      i_isolate->allocator()->GetSegmentPoolStats().pooled_bytes +
       i_isolate->string_table()->GetCurrentMemoryUsage();
   // On 32-bit systems backing_store_bytes() might overflow size_t temporarily
   // due to concurrent array buffer sweeping.
@@ -8937,6 +9323,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->regexp_stack_size_ =
+      i_isolate->regexp_stack()->allocated_size();
 
 #if V8_ENABLE_WEBASSEMBLY
   heap_statistics->malloced_memory_ +=
@@ -9039,6 +9427,26 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::GetRuntimeCallStatsSamples(
+    RuntimeCallStatsSampleCallback callback, void* data) {
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* stats = i_isolate->counters()->runtime_call_stats();
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    uint64_t samples = counter->samples();
+    if (samples > 0) callback(counter->name(), samples, data);
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
+void Isolate::ResetRuntimeCallStatsSamples() {
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->counters()->runtime_call_stats()->ResetSamples();
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9275,6 +9683,17 @@ void Isolate::IsolateInBackgroundNotification() {
   return i_isolate->IsolateInBackgroundNotification();
 }
 
+void Isolate::ExpectedLoadNotification(double start_in_seconds,
+                                       double end_in_seconds) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->ExpectedLoadNotification(start_in_seconds, end_in_seconds);
+}
+
+void Isolate::ClearExpectedLoadNotifications() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->ClearExpectedLoadNotifications();
+}
+
 void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   bool on_isolate_thread =
@@ -9300,11 +9719,21 @@ void Isolate::DisableMemorySavingsMode() {
   i_isolate->DisableMemorySavingsMode();
 }
 
+void Isolate::SetBytecodeFlushingBudget(size_t budget_in_bytes) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->bytecode_flushing_policy()->set_budget(budget_in_bytes);
+}
+
 void Isolate::SetRAILMode(RAILMode rail_mode) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   return i_isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetTieringPolicy(const TieringPolicy& policy) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->tiering_manager()->SetPolicy(policy);
+}
+
 void Isolate::UpdateLoadStartTime() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->UpdateLoadStartTime();
@@ -9460,6 +9889,19 @@ void Isolate::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
   i_isolate->heap()->AutomaticallyRestoreInitialHeapLimit(threshold_percent);
 }
 
+void Isolate::SetMaxYoungGenerationSize(
+    size_t max_young_generation_size_in_bytes) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetMaxYoungGenerationSize(
+      max_young_generation_size_in_bytes);
+}
+
+void Isolate::SetYoungGenerationPauseTarget(double milliseconds) {
+  DCHECK_GE(milliseconds, 0.0);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetScavengePauseTargetMs(milliseconds);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   return i_isolate->IsDead();
@@ -9559,6 +10001,8 @@ void v8::Isolate::DateTimeConfigurationChangeNotification(
       i::Isolate::ICUObjectCacheType::kDefaultSimpleDateFormatForTime);
   i_isolate->clear_cached_icu_object(
       i::Isolate::ICUObjectCacheType::kDefaultSimpleDateFormatForDate);
+  i_isolate->clear_cached_icu_object(
+      i::Isolate::ICUObjectCacheType::kSimpleDateFormat);
 #endif  // V8_INTL_SUPPORT
 }
 
@@ -9920,6 +10364,17 @@ int CpuProfile::GetSamplesCount() const {
   return reinterpret_cast<const i::CpuProfile*>(this)->samples_count();
 }
 
+void CpuProfile::Serialize(OutputStream* stream,
+                           CpuProfile::SerializationFormat format) const {
+  Utils::ApiCheck(format == kPprof, "v8::CpuProfile::Serialize",
+                  "Unknown serialization format");
+  Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::CpuProfile::Serialize",
+                  "Invalid stream chunk size");
+  i::CpuProfilePprofSerializer serializer(
+      reinterpret_cast<const i::CpuProfile*>(this));
+  serializer.Serialize(stream);
+}
+
 CpuProfiler* CpuProfiler::New(Isolate* v8_isolate,
                               CpuProfilingNamingMode naming_mode,
                               CpuProfilingLoggingMode logging_mode) {
@@ -10033,6 +10488,14 @@ void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* v8_isolate) {
       ->SetDetailedSourcePositionsForProfiling(true);
 }
 
+int CpuProfiler::GetDeoptCount(Isolate* v8_isolate, Local<Function> function) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  auto self = Utils::OpenHandle(*function);
+  if (!self->IsJSFunction()) return 0;
+  return isolate->deopt_history()->DeoptCount(
+      i::JSFunction::cast(*self).shared());
+}
+
 uintptr_t CodeEvent::GetCodeStartAddress() {
   return reinterpret_cast<i::CodeEvent*>(this)->code_start_address;
 }
@@ -10304,6 +10767,10 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+AllocationProfileDelta* HeapProfiler::GetAllocationProfileDelta() {
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfileDelta();
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
@@ -27,6 +27,8 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <vector>
+
 #include "src/base/hashmap-entry.h"
 #include "src/base/logging.h"
 #include "src/base/platform/wrappers.h"
@@ -35,6 +37,7 @@
 #include "src/heap/local-factory-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
@@ -370,13 +373,39 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. Non-empty one-byte strings, which are most of them, are looked up
+  // in bulk, so that the string table locks are taken once for all misses.
+  std::vector<AstRawString*> one_byte_strings;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->is_one_byte() && !current->IsEmpty()) {
+      one_byte_strings.push_back(current);
+    } else {
+      current->Internalize(isolate);
+    }
     current = next;
   }
 
+  if (!one_byte_strings.empty()) {
+    std::vector<OneByteStringKey> keys;
+    std::vector<OneByteStringKey*> key_pointers;
+    keys.reserve(one_byte_strings.size());
+    key_pointers.reserve(one_byte_strings.size());
+    for (AstRawString* string : one_byte_strings) {
+      keys.emplace_back(string->raw_hash_field(), string->literal_bytes_);
+      key_pointers.push_back(&keys.back());
+    }
+    std::vector<Handle<String>> results(one_byte_strings.size());
+    isolate->string_table()->LookupKeys(
+        isolate,
+        base::Vector<OneByteStringKey* const>(
+            key_pointers.data(), key_pointers.size()),
+        results.data());
+    for (size_t i = 0; i < one_byte_strings.size(); ++i) {
+      one_byte_strings[i]->set_string(results[i]);
+    }
+  }
+
   ResetStrings();
 }
 template EXPORT_TEMPLATE_DEFINE(
@@ -124,6 +124,7 @@ class AstNode;
 class AstNodeFactory;
 class Declaration;
 class BreakableStatement;
+class ClassLiteralProperty;
 class Expression;
 class IterationStatement;
 class MaterializedLiteral;
@@ -2291,6 +2292,18 @@ class FunctionLiteral final : public Expression {
     return RequiresInstanceMembersInitializer::decode(bit_field_);
   }
 
+  // The instance fields of the class if they can be initialized directly in
+  // this constructor instead of calling the instance members initializer.
+  // Only available when the constructor is compiled from the same AST as its
+  // class.
+  void set_inlined_instance_fields(
+      const ZonePtrList<ClassLiteralProperty>* fields) {
+    inlined_instance_fields_ = fields;
+  }
+  const ZonePtrList<ClassLiteralProperty>* inlined_instance_fields() const {
+    return inlined_instance_fields_;
+  }
+
   void set_has_static_private_methods_or_accessors(bool value) {
     bit_field_ =
         HasStaticPrivateMethodsOrAccessorsField::update(bit_field_, value);
@@ -2369,6 +2382,7 @@ class FunctionLiteral final : public Expression {
   AstConsString* raw_inferred_name_;
   Handle<String> inferred_name_;
   ProducedPreparseData* produced_preparse_data_;
+  const ZonePtrList<ClassLiteralProperty>* inlined_instance_fields_ = nullptr;
 };
 
 // Property is used for passing information
@@ -293,6 +293,31 @@ V8_BASE_EXPORT int32_t SignedMulHigh32(int32_t lhs, int32_t rhs);
 V8_BASE_EXPORT int32_t SignedMulHighAndAdd32(int32_t lhs, int32_t rhs,
                                              int32_t acc);
 
+// UnsignedMul128(lhs, rhs, low) multiplies two unsigned 64-bit values |lhs|
+// and |rhs|, stores the least significant 64 bits of the result in |low|, and
+// returns the most significant 64 bits.
+inline uint64_t UnsignedMul128(uint64_t lhs, uint64_t rhs, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+  *low = static_cast<uint64_t>(product);
+  return static_cast<uint64_t>(product >> 64);
+#elif V8_CC_MSVC && V8_HOST_ARCH_X64
+  return _umul128(lhs, rhs, low);
+#else
+  const uint64_t kMask32 = 0xFFFFFFFFu;
+  uint64_t a = lhs >> 32;
+  uint64_t b = lhs & kMask32;
+  uint64_t c = rhs >> 32;
+  uint64_t d = rhs & kMask32;
+  uint64_t bd = b * d;
+  uint64_t ad = a * d;
+  uint64_t bc = b * c;
+  uint64_t middle = (bd >> 32) + (ad & kMask32) + (bc & kMask32);
+  *low = (middle << 32) | (bd & kMask32);
+  return a * c + (ad >> 32) + (bc >> 32) + (middle >> 32);
+#endif
+}
+
 // SignedDiv32(lhs, rhs) divides |lhs| by |rhs| and returns the quotient
 // truncated to int32. If |rhs| is zero, then zero is returned. If |lhs|
 // is minint and |rhs| is -1, it returns minint.
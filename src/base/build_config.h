@@ -80,6 +80,17 @@
 #endif
 #endif
 
+// Whether SIMD intrinsics can be used in code compiled for the host, i.e.
+// <emmintrin.h> respectively <arm_neon.h> may be included. For NEON, only
+// AArch64 has the across-vector operations (e.g. vmaxvq) that users rely on.
+#if defined(__SSE2__) ||  \
+    (defined(_MSC_VER) && \
+     (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2)))
+#define V8_HOST_HAS_SSE2 1
+#elif defined(__ARM_NEON) && V8_HOST_ARCH_ARM64
+#define V8_HOST_HAS_NEON 1
+#endif
+
 // Target architecture detection. This may be set externally. If not, detect
 // in the same way as the host architecture, that is, target the native
 // environment as presented by the compiler.
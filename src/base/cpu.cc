@@ -774,13 +774,34 @@ CPU::CPU()
       IsProcessorFeaturePresent(PF_ARM_V83_JSCVT_INSTRUCTIONS_AVAILABLE);
 
 #elif V8_OS_LINUX
+  CPUInfo cpu_info;
+
+  // Extract implementor and part number, which identify the core.
+  char* implementer = cpu_info.ExtractField("CPU implementer");
+  if (implementer != nullptr) {
+    char* end;
+    implementer_ = strtol(implementer, &end, 0);
+    if (end == implementer) {
+      implementer_ = 0;
+    }
+    delete[] implementer;
+  }
+  char* part = cpu_info.ExtractField("CPU part");
+  if (part != nullptr) {
+    char* end;
+    part_ = strtol(part, &end, 0);
+    if (end == part) {
+      part_ = 0;
+    }
+    delete[] part;
+  }
+
   // Try to extract the list of CPU features from ELF hwcaps.
   uint32_t hwcaps = ReadELFHWCaps();
   if (hwcaps != 0) {
     has_jscvt_ = (hwcaps & HWCAP_JSCVT) != 0;
   } else {
     // Try to fallback to "Features" CPUInfo field
-    CPUInfo cpu_info;
     char* features = cpu_info.ExtractField("Features");
     has_jscvt_ = HasListItem(features, "jscvt");
     delete[] features;
@@ -59,6 +59,21 @@ class V8_BASE_EXPORT CPU final {
   static const int kArmCortexA9 = 0xc09;
   static const int kArmCortexA12 = 0xc0c;
   static const int kArmCortexA15 = 0xc0f;
+  static const int kArmCortexA53 = 0xd03;
+  static const int kArmCortexA55 = 0xd05;
+  static const int kArmCortexA57 = 0xd07;
+  static const int kArmCortexA72 = 0xd08;
+  static const int kArmCortexA73 = 0xd09;
+  static const int kArmCortexA75 = 0xd0a;
+  static const int kArmCortexA76 = 0xd0b;
+  static const int kArmNeoverseN1 = 0xd0c;
+  static const int kArmCortexA77 = 0xd0d;
+  static const int kArmNeoverseV1 = 0xd40;
+  static const int kArmCortexA78 = 0xd41;
+  static const int kArmCortexX1 = 0xd44;
+  static const int kArmCortexA710 = 0xd47;
+  static const int kArmCortexX2 = 0xd48;
+  static const int kArmNeoverseN2 = 0xd49;
 
   // Denver-specific part code
   static const int kNvidiaDenverV10 = 0x002;
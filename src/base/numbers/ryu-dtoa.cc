@@ -0,0 +1,896 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/ryu-dtoa.h"
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/numbers/double.h"
+
+namespace v8 {
+namespace base {
+
+namespace {
+
+struct UInt128 {
+  uint64_t high;
+  uint64_t low;
+};
+
+constexpr int kMantissaBits = 52;
+constexpr int kExponentBias = 1023;
+constexpr int kPow5InvBitCount = 125;
+constexpr int kPow5BitCount = 125;
+
+// kPow5InvSplit[q] is floor(2^(Pow5Bits(q) - 1 + kPow5InvBitCount) / 5^q) + 1
+// and kPow5Split[i] is 5^i, shifted to have kPow5BitCount significant bits.
+// clang-format off
+static const UInt128 kPow5InvSplit[] = {
+    {0x2000'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x1999'9999'9999'9999, 0x9999'9999'9999'999A},
+    {0x147A'E147'AE14'7AE1, 0x47AE'147A'E147'AE15},
+    {0x1062'4DD2'F1A9'FBE7, 0x6C8B'4395'8106'24DE},
+    {0x1A36'E2EB'1C43'2CA5, 0x7A78'6C22'6809'D496},
+    {0x14F8'B588'E368'F084, 0x61F9'F01B'866E'43AB},
+    {0x10C6'F7A0'B5ED'8D36, 0xB4C7'F349'3858'3622},
+    {0x1AD7'F29A'BCAF'4857, 0x87A6'520E'C08D'236A},
+    {0x1579'8EE2'308C'39DF, 0x9FB8'41A5'66D7'4F88},
+    {0x112E'0BE8'26D6'94B2, 0xE62D'0151'1F12'A607},
+    {0x1B7C'DFD9'D7BD'BAB7, 0xD6AE'6881'CB51'09A4},
+    {0x15FD'7FE1'7964'955F, 0xDEF1'ED34'A2A7'3AEA},
+    {0x1197'9981'2DEA'1119, 0x7F27'F0F6'E885'C8BB},
+    {0x1C25'C268'4976'81C2, 0x650C'B4BE'40D6'0DF8},
+    {0x1684'9B86'A12B'9B01, 0xEA70'9098'33DE'7193},
+    {0x1203'AF9E'E756'159B, 0x21F3'A6E0'297E'C143},
+    {0x1CD2'B297'D889'BC2B, 0x6985'D7CD'0F31'3537},
+    {0x170E'F546'46D4'9689, 0x2137'DFD7'3F5A'90F9},
+    {0x1272'5DD1'D243'ABA0, 0xE75F'E645'CC48'73FA},
+    {0x1D83'C94F'B6D2'AC34, 0xA566'3D3C'7A0D'865D},
+    {0x179C'A10C'9242'235D, 0x511E'9763'94D7'9EB1},
+    {0x12E3'B40A'0E9B'4F7D, 0xDA7E'DF82'DD79'4BC1},
+    {0x1E39'2010'175E'E596, 0x2A64'98D1'625B'AC68},
+    {0x182D'B340'12B2'5144, 0xEEB6'E0A7'81E2'F053},
+    {0x1357'C299'A88E'A76A, 0x5892'4D52'CE4F'26A9},
+    {0x1EF2'D0F5'DA7D'D8AA, 0x2750'7BB7'B07E'A441},
+    {0x18C2'40C4'AECB'13BB, 0x52A6'C95F'C065'5034},
+    {0x13CE'9A36'F23C'0FC9, 0x0EEB'D44C'99EA'A690},
+    {0x1FB0'F6BE'5060'1941, 0xB179'53AD'C311'0A80},
+    {0x195A'5EFE'A6B3'4767, 0xC12D'DC8B'0274'0867},
+    {0x1448'4BFE'EBC2'9F86, 0x3424'B06F'3529'A052},
+    {0x1039'D665'8968'7F9E, 0x901D'59F2'90EE'19DB},
+    {0x19F6'23D5'A8A7'3297, 0x4CFB'C31D'B4B0'295F},
+    {0x14C4'E977'BA1F'5BAC, 0x3D96'35B1'5D59'BAB2},
+    {0x109D'8792'FB4C'4956, 0x97AB'5E27'7DE1'6228},
+    {0x1A95'A5B7'F87A'0EF0, 0xF2AB'C9D8'C968'9D0D},
+    {0x1544'8493'2D2E'725A, 0x5BBC'A17A'3ABA'173E},
+    {0x1103'9D42'8A8B'8EAE, 0xAFCA'1AC8'2EFB'45CB},
+    {0x1B38'FB9D'AA78'E44A, 0xB2DC'F7A6'B192'0945},
+    {0x15C7'2FB1'552D'836E, 0xF57D'92EB'C141'A104},
+    {0x116C'2627'7757'9C58, 0xC464'7589'6767'B403},
+    {0x1BE0'3D0B'F225'C6F4, 0x6D6D'88DB'D8A5'ECD2},
+    {0x164C'FDA3'281E'38C3, 0x8ABE'0716'46EB'23DB},
+    {0x11D7'314F'534B'609C, 0x6EFE'6C11'D255'B649},
+    {0x1C8B'8218'8545'6760, 0xB197'134F'B6EF'8A0E},
+    {0x16D6'01AD'376A'B91A, 0x27AC'0F72'F8BF'A1A5},
+    {0x1244'CE24'2C55'60E1, 0xB956'72C2'6099'4E1E},
+    {0x1D3A'E36D'13BB'CE35, 0xF557'1E03'CDC2'1695},
+    {0x1762'4F8A'762F'D82B, 0x2AAC'1803'0B01'ABAB},
+    {0x12B5'0C6E'C4F3'1355, 0xBBBC'E002'6F34'8956},
+    {0x1DEE'7A4A'D4B8'1EEF, 0x92C7'CCD0'B1ED'A889},
+    {0x17F1'FB6F'1093'4BF2, 0xDBD3'0A40'8E57'BA07},
+    {0x1327'FC58'DA0F'6FF5, 0x7CA8'D500'71DF'C806},
+    {0x1EA6'608E'29B2'4CBB, 0xFAA7'BB33'E966'0CD6},
+    {0x1885'1A0B'548E'A3C9, 0x9552'FC29'8784'D711},
+    {0x139D'AE6F'76D8'8307, 0xAAA8'C9BA'D2D0'AC0E},
+    {0x1F62'B0B2'57C0'D1A5, 0xDDDA'DC5E'1E1A'ACE3},
+    {0x191B'C08E'AC9A'4151, 0x7E48'B04B'4B48'8A4F},
+    {0x1416'33A5'56E1'CDDA, 0xCB6D'59D5'D5D3'A1D9},
+    {0x1011'C2EA'ABE7'D7E2, 0x3C57'7B11'77DC'817B},
+    {0x19B6'04AA'ACA6'2636, 0xC6F2'5E82'5960'CF2A},
+    {0x1491'9D55'56EB'51C5, 0x6BF5'1868'4780'A5BB},
+    {0x1074'7DDD'DF22'A7D1, 0x232A'79ED'0600'8496},
+    {0x1A53'FC96'31D1'0C81, 0xD1DD'8FE1'A334'0756},
+    {0x150F'FD44'F4A7'3D34, 0xA7E4'731A'E8F6'6C45},
+    {0x10D9'976A'5D52'975D, 0x531D'28E2'53F8'569E},
+    {0x1AF5'BF10'9550'F22E, 0xEB61'DB03'B98D'5762},
+    {0x1591'65A6'DDDA'5B58, 0xBC4E'48CF'C7A4'45E8},
+    {0x1141'1E1F'17E1'E2AD, 0x6371'D3D9'6C83'6B20},
+    {0x1B9B'6364'F303'0448, 0x9F1C'8628'AD9F'11CD},
+    {0x1615'E91D'8F35'9D06, 0xE5B0'6B53'BE18'DB0B},
+    {0x11AB'20E4'7291'4A6B, 0xEAF3'890F'CB47'15A2},
+    {0x1C45'016D'841B'AA46, 0x44B8'DB4C'7871'BC37},
+    {0x169D'9ABE'0349'5505, 0x03C7'15D6'C6C1'635F},
+    {0x1217'AEFE'6907'7737, 0x3638'DE45'6BCD'E919},
+    {0x1CF2'B197'0E72'5858, 0x56C1'63A2'4616'41C1},
+    {0x1728'8E12'71F5'1379, 0xDF01'1C81'D1AB'67CE},
+    {0x1286'D80E'C190'DC61, 0x7F34'16CE'4155'ECA5},
+    {0x1DA4'8CE4'68E7'C702, 0x6520'247D'3556'476E},
+    {0x17B6'D71D'20B9'6C01, 0xEA80'1D30'F778'3925},
+    {0x12F8'AC17'4D61'2334, 0xBB99'B0F3'F92C'FA84},
+    {0x1E5A'ACF2'1568'3854, 0x5F5C'4E53'2847'F739},
+    {0x1848'8A5B'4453'6043, 0x7F7D'0B75'B9D3'2C2E},
+    {0x136D'3B7C'36A9'19CF, 0x9930'D5F7'C7DC'2358},
+    {0x1F15'2BF9'F10E'8FB2, 0x8EB4'898C'72F9'D226},
+    {0x18DD'BCC7'F40B'A628, 0x722A'07A3'8F2E'41B8},
+    {0x13E4'9706'5CD6'1E86, 0xC1BB'394F'A5BE'9AFA},
+    {0x1FD4'24D6'FAF0'30D7, 0x9C5E'C219'0930'F7F6},
+    {0x1976'83DF'2F26'8D79, 0x49E5'6814'075A'5FF8},
+    {0x145E'CFE5'BF52'0AC7, 0x6E51'2010'05E1'E660},
+    {0x104B'D984'990E'6F05, 0xF1DA'800C'D181'851A},
+    {0x1A12'F5A0'F4E3'E4D6, 0x4FC4'0014'8268'D4F5},
+    {0x14DB'F7B3'F71C'B711, 0xD969'99AA'01ED'772B},
+    {0x10AF'F95C'C5B0'9274, 0xADEE'1488'018A'C5BC},
+    {0x1AB3'2894'6F80'EA54, 0x497C'EDA6'68DE'092C},
+    {0x155C'2076'BF9A'5510, 0x3ACA'57B8'53E4'D424},
+    {0x1116'805E'FFAE'AA73, 0x623B'7960'431D'7683},
+    {0x1B57'33CB'32B1'10B8, 0x9D2B'F566'D1C8'BD9E},
+    {0x15DF'5CA2'8EF4'0D60, 0x7DBC'C452'416D'647F},
+    {0x117F'7D4E'D8C3'3DE6, 0xCAFD'69DB'678A'B6CC},
+    {0x1BFF'2EE4'8E05'2FD7, 0xAB2F'0FC5'7277'8ADF},
+    {0x1665'BF1D'3E6A'8CAC, 0x88F2'7304'5B92'D580},
+    {0x11EA'FF4A'9855'3D56, 0xD3F5'28D0'4942'4466},
+    {0x1CAB'3210'F3BB'9557, 0xB988'414D'4203'A0A3},
+    {0x16EF'5B40'C2FC'7779, 0x6139'CDD7'6802'E6E9},
+    {0x1259'15CD'68C9'F92D, 0xE761'7179'2002'5254},
+    {0x1D5B'5615'7476'5B7C, 0xA568'B58E'999D'5086},
+    {0x177C'44DD'F6C5'15FD, 0x5120'913E'E14A'A6D2},
+    {0x12C9'D0B1'9237'44CA, 0xA74D'40FF'1AA2'1F0E},
+    {0x1E0F'B44F'5058'6E11, 0x0BAE'CE64'F769'CB4A},
+    {0x180C'903F'7379'F1A7, 0x3C8B'D850'C5EE'3C3B},
+    {0x133D'4032'C2C7'F485, 0xCA09'79DA'37F1'C9C9},
+    {0x1EC8'66B7'9E0C'BA6F, 0xA9A8'C2F6'BFE9'42DB},
+    {0x18A0'522C'7E70'9526, 0x2153'CF2B'CCBA'9BE3},
+    {0x13B3'74F0'6526'DDB8, 0x1AA9'7289'7095'4982},
+    {0x1F85'87E7'083E'2F8C, 0xF775'840F'1A88'759D},
+    {0x1937'9FEC'0698'260A, 0x5F91'3672'7BA0'5E17},
+    {0x142C'7FF0'0546'84D5, 0x1940'F85B'9619'E4DF},
+    {0x1023'998C'D105'3710, 0xE100'C6AF'AB47'EA4C},
+    {0x19D2'8F47'B4D5'24E7, 0xCE67'A44C'453F'DD47},
+    {0x14A8'729F'C3DD'B71F, 0xD852'E9D6'9DCC'B106},
+    {0x1086'C219'697E'2C19, 0x79DB'EE45'4B0A'2738},
+    {0x1A71'368F'0F30'468F, 0x295F'E3A2'11A9'D859},
+    {0x1527'5ED8'D8F3'6BA5, 0xBAB3'1C81'A7BB'137A},
+    {0x10EC'4BE0'AD8F'8951, 0x6228'E39A'EC95'A92F},
+    {0x1B13'AC9A'AF4C'0EE8, 0x9D0E'38F7'E0EF'7517},
+    {0x15A9'56E2'25D6'7253, 0xB0D8'2D93'1A59'2A79},
+    {0x1154'4581'B7DE'C1DC, 0x8D79'BE0F'4847'552E},
+    {0x1BBA'08CF'8C97'9C94, 0x158F'967E'DA0B'BB7C},
+    {0x162E'6D72'D6DF'B076, 0x77A6'11FF'14D6'2F97},
+    {0x11BE'BDF5'78B2'F391, 0xF951'A7FF'43DE'8C79},
+    {0x1C64'6322'5AB7'EC1C, 0xC21C'3FFE'D2FD'AD8E},
+    {0x16B6'B5B5'155F'F017, 0x01B0'3332'4264'8AD8},
+    {0x122B'C490'DDE6'59AC, 0x0159'C28E'9B83'A246},
+    {0x1D12'D41A'FCA3'C2AC, 0xCEF6'0417'5F39'03A3},
+    {0x1742'4348'CA1C'9BBD, 0x725E'69AC'4C2D'9C83},
+    {0x129B'6907'0816'E2FD, 0xF518'5489'D68A'E39C},
+    {0x1DC5'74D8'0CF1'6B2F, 0xEE8D'540F'BDAB'05C6},
+    {0x17D1'2A46'70C1'228C, 0xBED7'7672'FE22'6B05},
+    {0x130D'BB6B'8D67'4ED6, 0xFF12'C528'CB4E'BC04},
+    {0x1E7C'5F12'7BD8'7E24, 0xCB51'3B74'787D'F9A0},
+    {0x1863'7F41'FCAD'31B7, 0x090D'C929'F9FE'614D},
+    {0x1382'CC34'CA24'27C5, 0xA0D7'D421'94CB'810A},
+    {0x1F37'AD21'436D'0C6F, 0x67BF'B9CF'5478'CE77},
+    {0x18F9'574D'CF8A'7059, 0x1FCC'94A5'DD2D'71F9},
+    {0x13FA'AC3E'3FA1'F37A, 0x7FD6'DD51'7DBD'F4C7},
+    {0x1FF7'79FD'329C'B8C3, 0xFFBE'2EE8'C92F'EE0B},
+    {0x1992'C7FD'C216'FA36, 0x6631'BF20'A0F3'24D6},
+    {0x1475'6CCB'01AB'FB5E, 0xB827'CC1A'1A5C'1D78},
+    {0x105D'F0A2'67BC'C918, 0x9353'09AE'7B7C'E460},
+    {0x1A2F'E76A'3F94'74F4, 0x1EEB'42B0'C594'A099},
+    {0x14F3'1F88'32DD'2A5C, 0xE589'0227'0476'E6E1},
+    {0x10C2'7FA0'28B0'EEB0, 0xB7A0'CE85'9D2B'EBE7},
+    {0x1AD0'CC33'744E'4AB4, 0x5901'4A6F'61DF'DFD8},
+    {0x1573'D68F'903E'A229, 0xE0CD'D525'E7E6'4CAD},
+    {0x1129'7872'D9CB'B4EE, 0x4D71'7751'8651'D6F1},
+    {0x1B75'8D84'8FAC'54B0, 0x7BE8'BEE8'D6E9'57E8},
+    {0x15F7'A46A'0C89'DD59, 0xFCBA'3253'DF21'1320},
+    {0x1192'E9EE'706E'4AAE, 0x63C8'2843'18E7'4280},
+    {0x1C1E'4317'1A4A'1117, 0x060D'0D38'27D8'6A66},
+    {0x167E'9C12'7B6E'7412, 0x6B3D'A42C'ECAD'21EB},
+    {0x11FE'E341'FC58'5CDB, 0x88FE'1CF0'BD57'4E56},
+    {0x1CCB'0536'608D'615F, 0x4196'94B4'6225'4A23},
+    {0x1708'D0F8'4D3D'E77F, 0x67AB'AA29'E81D'D4E9},
+    {0x126D'73F9'D764'B932, 0xB956'21BB'2017'DD87},
+    {0x1D7B'ECC2'F23A'C1EA, 0xC223'692B'668C'95A5},
+    {0x1796'5702'5B62'34BB, 0xCE82'BA89'1ED6'DE1D},
+    {0x12DE'AC01'E2B4'F6FC, 0xA535'6207'4BDF'1818},
+    {0x1E31'1336'3787'F194, 0x3B88'9CD8'7964'F359},
+    {0x1827'4291'C606'5ADC, 0xFC6D'4A46'C783'F5E1},
+    {0x1352'9BA7'D19E'AF17, 0x3057'6E9F'0603'2B1A},
+    {0x1EEA'92A6'1C31'1825, 0x1A25'7DCB'3CD1'DE90},
+    {0x18BB'A884'E35A'79B7, 0x481D'FE3C'30A7'E540},
+    {0x13C9'539D'82AE'C7C5, 0xD34B'31C9'C086'5100},
+    {0x1FA8'85C8'D117'A609, 0x5211'E942'CDA3'B4CD},
+    {0x1953'9E3A'40DF'B807, 0x74DB'2102'3E1C'90A4},
+    {0x1442'E4FB'6719'6005, 0xF715'B401'CB4A'0D50},
+    {0x1035'83FC'527A'B337, 0xF8DE'299B'0908'0AA7},
+    {0x19EF'3993'B72A'B859, 0x8E30'4291'A80C'DDD7},
+    {0x14BF'6142'F8EE'F9E1, 0x3E8D'020E'200A'4B13},
+    {0x1099'1A9B'FA58'C7E7, 0x653D'9B3E'8008'3C0F},
+    {0x1A8E'90F9'908E'0CA5, 0x6EC8'F864'000D'2CE4},
+    {0x153E'DA61'4071'A3B7, 0x8BD3'F9E9'99A4'23EA},
+    {0x10FF'151A'99F4'82F9, 0x3CA9'94BA'E150'1CBB},
+    {0x1B31'BB5D'C320'D18E, 0xC775'BAC4'9BB3'612B},
+    {0x15C1'62B1'68E7'0E0B, 0xD2C4'956A'1629'1A89},
+    {0x1167'8227'871F'3E6F, 0xDBD0'7788'11BA'7BA1},
+    {0x1BD8'D03F'3E98'63E6, 0x2C80'BF40'1C5D'929B},
+    {0x1647'0CFF'6546'B651, 0xBD33'CC33'49E4'7549},
+    {0x11D2'70CC'5105'5EA7, 0xCA8F'D68F'6E50'5DD4},
+    {0x1C83'E7AD'4E6E'FDD9, 0x4419'574B'E3B3'C953},
+    {0x16CF'EC8A'A525'97E1, 0x0347'7909'82F6'3AA9},
+    {0x123F'F06E'EA84'7980, 0xCF6C'60D4'68C4'FBBA},
+    {0x1D33'1A4B'10D3'F59A, 0xE57A'3487'0E07'F92A},
+    {0x175C'1508'DA43'2AE2, 0x512E'906C'0B39'9422},
+    {0x12B0'10D3'E1CF'5581, 0xDA8B'A6BC'D5C7'A9B5},
+    {0x1DE6'8153'02E5'559C, 0x90DF'712E'22D9'0F87},
+    {0x17EB'9AA8'CF1D'DE16, 0xDA4C'5A8B'4F14'0C6C},
+    {0x1322'E220'A5B1'7E78, 0xAEA3'7BA2'A5A9'A38A},
+    {0x1E9E'369A'A2B5'9727, 0x7DD2'5F6A'A2A9'05A9},
+    {0x187E'9215'4EF7'AC1F, 0x97DB'7F88'8220'D154},
+    {0x1398'74DD'D8C6'234C, 0x797C'6606'CE80'A777},
+    {0x1F5A'5496'27A3'6BAD, 0x8F2D'700A'E401'0BF1},
+    {0x1915'1078'1FB5'EFBE, 0x0C24'59A2'5000'D65A},
+    {0x1410'D9F9'B2F7'F2FE, 0x701D'1481'D99A'4515},
+    {0x100D'7B2E'28C6'5BFE, 0xC017'439B'147B'6A77},
+    {0x19AF'2B7D'0E0A'2CCA, 0xCCF2'05C4'ED92'43F2},
+    {0x148C'22CA'71A1'BD6F, 0x0A5B'37D0'BE0E'9CC2},
+    {0x1070'1BD5'27B4'978C, 0x0848'F973'CB3E'E3CE},
+    {0x1A4C'F955'0C54'25AC, 0xDA0E'5BEC'7864'9FB0},
+    {0x150A'6110'D6A9'B7BD, 0x7B3E'AFF0'6050'7FC0},
+    {0x10D5'1A73'DEEE'2C97, 0x95CB'BFF3'8040'6633},
+    {0x1AEE'90B9'64B0'4758, 0xEFAC'6652'66CD'7052},
+    {0x158B'A6FA'B6F3'6C47, 0x2623'850E'B8A4'59DB},
+    {0x113C'8595'5F29'236C, 0x1E82'D0D8'93B6'AE49},
+    {0x1B94'08EE'FEA8'38AC, 0xFD9E'1AF4'1F8A'B075},
+    {0x1610'0725'9886'93BD, 0x97B1'AF29'B2D5'59F7},
+    {0x11A6'6C1E'139E'DC97, 0xAC8E'25BA'F577'7B2C},
+    {0x1C3D'79C9'B8FE'2DBF, 0x7A7D'092B'2258'C513},
+    {0x1697'94A1'60CB'57CC, 0x61FD'A0EF'4EAD'6A76},
+    {0x1212'DD4D'E709'1309, 0xE7FE'1A59'0BBD'EEC5},
+    {0x1CEA'FBAF'D80E'84DC, 0xA663'5D5B'45FC'B13A},
+    {0x1722'62F3'133E'D0B0, 0x851C'4AAF'6B30'8DC8},
+    {0x1281'E8C2'75CB'DA26, 0xD0E3'6EF2'BC26'D7D4},
+    {0x1D9C'A79D'8946'29D7, 0xB49F'17EA'C6A4'8C86},
+    {0x17B0'8617'A104'EE46, 0x2A18'DFEF'0550'706B},
+    {0x12F3'9E79'4D9D'8B6B, 0x54E0'B325'9DD9'F389},
+    {0x1E52'9728'7C2F'4578, 0x87CD'EB6F'62F6'5274},
+    {0x1842'1286'C9BF'6AC6, 0xD30B'22BF'825E'A85D},
+    {0x1368'0ED2'3AFF'889F, 0x0F3C'1BCC'684B'B9E4},
+    {0x1F0C'E483'9198'DA98, 0x1860'2C7A'4079'296D},
+    {0x18D7'1D36'0E13'E213, 0x46B3'56C8'3394'2124},
+    {0x13DF'4A91'A4DC'B4DC, 0x388F'78A0'2943'4DB6},
+    {0x1FCB'AA82'A161'2160, 0x5A7F'2766'A86B'AF8A},
+    {0x196F'BB9B'B44D'B44D, 0x1532'85EB'B9EF'BFA2},
+    {0x1459'62E2'F6A4'903D, 0xAA8E'D189'618C'994E},
+    {0x1047'824F'2BB6'D9CA, 0xEED8'A7A1'1AD6'E10C},
+    {0x1A0C'03B1'DF8A'F611, 0x7E27'729B'5E24'9B45},
+    {0x14D6'695B'193B'F80D, 0xFE85'F549'181D'4904},
+    {0x10AB'877C'142F'F9A4, 0xCB9E'5DD4'134A'A0D0},
+    {0x1AAC'0BF9'B9E6'5C3A, 0xDF63'C953'5211'014D},
+    {0x1556'6FFA'FB1E'B02F, 0x191C'A10F'74DA'6771},
+    {0x1111'F32F'2F4B'C025, 0xADB0'80D9'2A48'52C1},
+    {0x1B4F'EB7E'B212'CD09, 0x15E7'348E'AA0D'5134},
+    {0x15D9'8932'280F'0A6D, 0xAB1F'5D3E'EE71'0DC4},
+    {0x117A'D428'200C'0857, 0xBC19'1765'8B8D'A49D},
+    {0x1BF7'B9D9'CCE0'0D59, 0x2CF4'F23C'127C'3A94},
+    {0x165F'C7E1'70B3'3DE0, 0xF0C3'F4FC'DB96'9543},
+    {0x11E6'3981'26F5'CB1A, 0x5A36'5D97'1612'1103},
+    {0x1CA3'8F35'0B22'DE90, 0x9056'FC24'F01C'E804},
+    {0x16E9'3F5D'A282'4BA6, 0xD9DF'301D'8CE3'ECD0},
+    {0x1254'32B1'4ECE'A2EB, 0xE17F'59B1'3D83'23DA},
+    {0x1D53'844E'E47D'D179, 0x68CB'C2B5'2F38'395C},
+    {0x1776'0372'5064'A794, 0x53D6'355D'BF60'2DE3},
+    {0x12C4'CF8E'A6B6'EC76, 0xA978'2AB1'65E6'8B1C},
+    {0x1E07'B27D'D78B'13F1, 0x0F26'AAB5'6FD7'44FA},
+    {0x1806'2864'AC6F'4327, 0x3F52'222A'BFDF'6A62},
+    {0x1338'2050'89F2'9C1F, 0x65DB'4E88'997F'884E},
+    {0x1EC0'33B4'0FEA'9365, 0x6FC5'4A74'28CC'0D4A},
+    {0x1899'C2F6'7322'0F84, 0x596A'A1F6'8709'A43B},
+    {0x13AE'3591'F5B4'D936, 0xADEE'E7F8'6C07'B696},
+    {0x1F7D'2283'22BA'F524, 0x497E'3FF3'E00C'5756},
+    {0x1930'E868'E895'90E9, 0xD464'FFF6'4CD6'AC45},
+    {0x1427'2053'ED44'73EE, 0x4383'FFF8'3D78'89D1},
+    {0x101F'4D0F'F103'8FF1, 0xCF9C'CCC6'9793'A174},
+    {0x19CB'AE7F'E805'B31C, 0x7F61'47A4'25B9'0252},
+    {0x14A2'F1FF'ECD1'5C16, 0xCC4D'D2E9'B7C7'350F},
+    {0x1082'5B33'23DA'B012, 0x3D0B'0F21'5FD2'90D9},
+    {0x1A6A'2B85'062A'B350, 0x61AB'4B68'9950'E7C1},
+    {0x1521'BC6A'6B55'5C40, 0x4E22'A2BA'1440'B967},
+    {0x10E7'C9EE'BC44'49CD, 0x0B4E'E894'DD00'9453},
+    {0x1B0C'764A'C6D3'A948, 0x1217'DA87'C800'ED51},
+    {0x15A3'91D5'6BDC'876C, 0xDB46'486C'A000'BDDA},
+    {0x114F'A7DD'EFE3'9F8A, 0x4905'06BD'4CCD'64AF},
+    {0x1BB2'A62F'E638'FF43, 0xA808'0AC8'7AE2'3AB1},
+    {0x1628'84F3'1E93'FF69, 0x5339'A239'FBE8'2EF4},
+    {0x11BA'03F5'B20F'FF87, 0x75C7'B4FB'2FEC'F25D},
+    {0x1C5C'D322'B67F'FF3F, 0x22D9'2191'E647'EA2E},
+    {0x16B0'A8E8'91FF'FF65, 0xB57A'8141'8506'54F2},
+    {0x1226'ED86'DB33'32B7, 0xC462'0101'3738'43F5},
+    {0x1D0B'15A4'91EB'8459, 0x3A36'6801'F1F3'9FEE},
+    {0x173C'1150'74BC'69E0, 0xFB5E'B99B'27F6'198B},
+    {0x1296'7440'5D63'87E7, 0x2F7E'FAE2'865E'7AD6},
+    {0x1DBD'86CD'6238'D971, 0xE597'F7D0'D6FD'9156},
+    {0x17CA'D23D'E82D'7AC1, 0x8479'930D'78CA'DAAB},
+    {0x1308'A831'868A'C89A, 0xD061'4271'2D6F'1556},
+    {0x1E74'404F'3DAA'DA91, 0x4D68'6A4E'AF18'2222},
+    {0x185D'003F'6488'AEDA, 0xA453'883E'F279'B4E8},
+    {0x137D'99CC'506D'58AE, 0xE9DC'6CFF'2861'5D87},
+    {0x1F2F'5C7A'1A48'8DE4, 0xA960'AE65'0D68'95A4},
+    {0x18F2'B061'AEA0'7183, 0xBAB3'BEB7'3DED'4483},
+    {0x13F5'59E7'BEE6'C136, 0x2EF6'322C'318A'9D36},
+    {0x1FEE'F63F'97D7'9B89, 0xE4BD'1D13'8277'61F0},
+    {0x198B'F832'DFDF'AFA1, 0x83CA'7DA9'352C'4E5A},
+    {0x146F'F9C2'4CB2'F2E7, 0x9CA1'FE20'F756'A515},
+    {0x1059'949B'708F'28B9, 0x4A1B'31B3'F912'1DAA},
+    {0x1A28'EDC5'80E5'0DF5, 0x435E'B5EC'C1B6'95DD},
+    {0x14ED'8B04'671D'A4C4, 0x35E5'5E57'015E'DE4A},
+    {0x10BE'08D0'527E'1D69, 0xC4B7'7EAC'0118'B1D5},
+    {0x1AC9'A7B3'B730'2F0F, 0xA125'9779'9B5A'B622},
+    {0x156E'1FC2'F8F3'58D9, 0x4DB7'AC61'4915'5E81},
+    {0x1124'E635'93F5'E0AD, 0xD7C6'2381'0744'4B9B},
+    {0x1B6E'3D22'8656'3449, 0x593D'059B'3ED3'AC2B},
+    {0x15F1'CA82'0511'C36D, 0xE0FD'9E15'CBDC'89BC},
+    {0x118E'3B9B'3741'6924, 0xB3FE'1811'6FE3'A163},
+    {0x1C16'C5C5'2535'7507, 0x8663'59B5'7FD2'9BD1},
+    {0x1678'9E37'50F7'90D2, 0xD1E9'1491'330E'E30E},
+    {0x11FA'182C'40C6'0D75, 0x74BA'76DA'8F3F'1C0B},
+    {0x1CC3'59E0'67A3'48BB, 0xEDF7'2490'E531'C678},
+    {0x1702'AE4D'1FB5'D3C9, 0x8B2C'1D40'B75B'052D},
+    {0x1268'8B70'E62B'0FD4, 0x6F56'7DCD'5F7C'0424},
+    {0x1D74'124E'3D11'B2ED, 0x7EF0'C948'98C6'6D06},
+    {0x1790'0EA4'FDA7'C257, 0x98C0'A106'E09E'BD9F},
+    {0x12D9'A550'CAEC'9B79, 0x4700'80D2'4D4B'CAE6},
+    {0x1E29'0881'44AD'C58E, 0xD800'CE1D'4879'44A2},
+    {0x1820'D39A'9D57'D13F, 0x1333'D817'6D2D'D082},
+    {0x134D'7615'4AAC'A765, 0xA8F6'4679'2424'A6CE},
+    {0x1EE2'5688'777A'A56F, 0x74BD'3D8E'A03A'A47D},
+    {0x18B5'1206'C5FB'B78C, 0x5D64'313E'E695'5064},
+    {0x13C4'0E6B'D196'2C70, 0x4AB6'8DCB'EBAA'A6B7},
+    {0x1FA0'1712'E8F0'471A, 0x1124'1613'12AA'A457},
+    {0x194C'DF42'53F3'6C14, 0xDA83'44DC'0EEE'E9DF},
+    {0x143D'7F68'4329'2343, 0xE202'9D7C'D8BF'2180},
+    {0x1031'32B9'CF54'1C36, 0x4E68'7DFD'7A32'8133},
+    {0x19E8'5129'4BB9'C6BD, 0x4A40'C995'9050'CEB8},
+    {0x14B9'DA87'6FC7'D231, 0x0833'D477'A6A7'0BC6},
+    {0x1094'AED2'BFD3'0E8D, 0xA029'76C6'1EEC'096B},
+    {0x1A87'7E1D'FFB8'1749, 0x0042'57A3'64AC'DBDF},
+    {0x1539'31B1'9960'12A0, 0xCD01'DFB5'EA23'E319},
+    {0x10FA'8E27'ADE6'754D, 0x70CE'4C91'881C'B5AE},
+    {0x1B2A'7D0C'4970'BBAF, 0x1AE3'ADB5'A694'55E2},
+    {0x15BB'973D'078D'62F2, 0x7BE9'57C4'8543'77E8},
+    {0x1162'DF64'060A'B58E, 0xC987'796A'0435'F987},
+    {0x1BD1'656C'D677'88E4, 0x75A5'8F10'06BC'C271},
+    {0x1641'1DF0'AB92'D3E9, 0xF7B7'A5A6'6BCA'3527},
+    {0x11CD'B18D'560F'0FEE, 0x5FC6'1E1E'BCA1'C41F},
+    {0x1C7C'4F48'89B1'B316, 0xFFA3'6364'6102'D365},
+    {0x16C9'D906'D48E'28DF, 0x32E9'1C50'4D9B'DC51},
+    {0x123B'1405'76D8'20B2, 0x8F20'E373'7149'7D0E},
+    {0x1D2B'533B'F159'CDEA, 0x7E9B'0585'820F'2E7C},
+    {0x1755'DC2F'F447'D7EE, 0xCBAF'379E'01A5'BECA},
+    {0x12AB'168C'C36C'ACBF, 0x0958'F94B'3484'98A1},
+};
+
+static const UInt128 kPow5Split[] = {
+    {0x1000'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1400'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1900'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1F40'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1388'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x186A'0000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1E84'8000'0000'0000, 0x0000'0000'0000'0000},
+    {0x1312'D000'0000'0000, 0x0000'0000'0000'0000},
+    {0x17D7'8400'0000'0000, 0x0000'0000'0000'0000},
+    {0x1DCD'6500'0000'0000, 0x0000'0000'0000'0000},
+    {0x12A0'5F20'0000'0000, 0x0000'0000'0000'0000},
+    {0x1748'76E8'0000'0000, 0x0000'0000'0000'0000},
+    {0x1D1A'94A2'0000'0000, 0x0000'0000'0000'0000},
+    {0x1230'9CE5'4000'0000, 0x0000'0000'0000'0000},
+    {0x16BC'C41E'9000'0000, 0x0000'0000'0000'0000},
+    {0x1C6B'F526'3400'0000, 0x0000'0000'0000'0000},
+    {0x11C3'7937'E080'0000, 0x0000'0000'0000'0000},
+    {0x1634'5785'D8A0'0000, 0x0000'0000'0000'0000},
+    {0x1BC1'6D67'4EC8'0000, 0x0000'0000'0000'0000},
+    {0x1158'E460'913D'0000, 0x0000'0000'0000'0000},
+    {0x15AF'1D78'B58C'4000, 0x0000'0000'0000'0000},
+    {0x1B1A'E4D6'E2EF'5000, 0x0000'0000'0000'0000},
+    {0x10F0'CF06'4DD5'9200, 0x0000'0000'0000'0000},
+    {0x152D'02C7'E14A'F680, 0x0000'0000'0000'0000},
+    {0x1A78'4379'D99D'B420, 0x0000'0000'0000'0000},
+    {0x108B'2A2C'2802'9094, 0x0000'0000'0000'0000},
+    {0x14AD'F4B7'3203'34B9, 0x0000'0000'0000'0000},
+    {0x19D9'71E4'FE84'01E7, 0x4000'0000'0000'0000},
+    {0x1027'E72F'1F12'8130, 0x8800'0000'0000'0000},
+    {0x1431'E0FA'E6D7'217C, 0xAA00'0000'0000'0000},
+    {0x193E'5939'A08C'E9DB, 0xD480'0000'0000'0000},
+    {0x1F8D'EF88'08B0'2452, 0xC9A0'0000'0000'0000},
+    {0x13B8'B5B5'056E'16B3, 0xBE04'0000'0000'0000},
+    {0x18A6'E322'46C9'9C60, 0xAD85'0000'0000'0000},
+    {0x1ED0'9BEA'D87C'0378, 0xD8E6'4000'0000'0000},
+    {0x1342'6172'C74D'822B, 0x878F'E800'0000'0000},
+    {0x1812'F9CF'7920'E2B6, 0x6973'E200'0000'0000},
+    {0x1E17'B843'5769'1B64, 0x03D0'DA80'0000'0000},
+    {0x12CE'D32A'16A1'B11E, 0x8262'8890'0000'0000},
+    {0x1782'87F4'9C4A'1D66, 0x22FB'2AB4'0000'0000},
+    {0x1D63'29F1'C35C'A4BF, 0xABB9'F561'0000'0000},
+    {0x125D'FA37'1A19'E6F7, 0xCB54'395C'A000'0000},
+    {0x16F5'78C4'E0A0'60B5, 0xBE29'47B3'C800'0000},
+    {0x1CB2'D6F6'18C8'78E3, 0x2DB3'99A0'BA00'0000},
+    {0x11EF'C659'CF7D'4B8D, 0xFC90'4004'7440'0000},
+    {0x166B'B7F0'435C'9E71, 0x7BB4'5005'9150'0000},
+    {0x1C06'A5EC'5433'C60D, 0xDAA1'6406'F5A4'0000},
+    {0x1184'27B3'B4A0'5BC8, 0xA8A4'DE84'5986'8000},
+    {0x15E5'31A0'A1C8'72BA, 0xD2CE'1625'6FE8'2000},
+    {0x1B5E'7E08'CA3A'8F69, 0x8781'9BAE'CBE2'2800},
+    {0x111B'0EC5'7E64'99A1, 0xF4B1'014D'3F6D'5900},
+    {0x1561'D276'DDFD'C00A, 0x71DD'41A0'8F48'AF40},
+    {0x1ABA'4714'957D'300D, 0x0E54'9208'B31A'DB10},
+    {0x10B4'6C6C'DD6E'3E08, 0x28F4'DB45'6FF0'C8EA},
+    {0x14E1'8788'14C9'CD8A, 0x3332'1216'CBEC'FB24},
+    {0x1A19'E96A'19FC'40EC, 0xBFFE'969C'7EE8'39ED},
+    {0x1050'31E2'503D'A893, 0xF7FF'1E21'CF51'2434},
+    {0x1464'3E5A'E44D'12B8, 0xF5FE'E5AA'4325'6D41},
+    {0x197D'4DF1'9D60'5767, 0x337E'9F14'D3EE'C892},
+    {0x1FDC'A16E'04B8'6D41, 0x005E'46DA'08EA'7AB6},
+    {0x13E9'E4E4'C2F3'4448, 0xA03A'EC48'4592'8CB2},
+    {0x18E4'5E1D'F3B0'155A, 0xC849'A75A'56F7'2FDE},
+    {0x1F1D'75A5'709C'1AB1, 0x7A5C'1130'ECB4'FBD6},
+    {0x1372'6987'6661'90AE, 0xEC79'8ABE'93F1'1D65},
+    {0x184F'03E9'3FF9'F4DA, 0xA797'ED6E'38ED'64BF},
+    {0x1E62'C4E3'8FF8'7211, 0x517D'E8C9'C728'BDEF},
+    {0x12FD'BB0E'39FB'474A, 0xD2EE'B17E'1C79'76B5},
+    {0x17BD'29D1'C87A'191D, 0x87AA'5DDD'A397'D462},
+    {0x1DAC'7446'3A98'9F64, 0xE994'F555'0C7D'C97B},
+    {0x128B'C8AB'E49F'639F, 0x11FD'1955'27CE'9DED},
+    {0x172E'BAD6'DDC7'3C86, 0xD67C'5FAA'71C2'4568},
+    {0x1CFA'698C'9539'0BA8, 0x8C1B'7795'0E32'D6C2},
+    {0x121C'81F7'DD43'A749, 0x5791'2ABD'28DF'C639},
+    {0x16A3'A275'D494'911B, 0xAD75'756C'7317'B7C8},
+    {0x1C4C'8B13'49B9'B562, 0x98D2'D2C7'8FDD'A5BA},
+    {0x11AF'D6EC'0E14'115D, 0x9F83'C3BC'B9EA'8794},
+    {0x161B'CCA7'1199'15B5, 0x0764'B4AB'E865'2979},
+    {0x1BA2'BFD0'D5FF'5B22, 0x493D'E1D6'E27E'73D7},
+    {0x1145'B7E2'85BF'98F5, 0x6DC6'AD26'4D8F'0866},
+    {0x1597'25DB'272F'7F32, 0xC938'586F'E0F2'CA80},
+    {0x1AFC'EF51'F0FB'5EFF, 0x7B86'6E8B'D92F'7D20},
+    {0x10DE'1593'369D'1B5F, 0xAD34'0517'67BD'AE34},
+    {0x1515'9AF8'0444'6237, 0x9881'065D'41AD'19C1},
+    {0x1A5B'01B6'0555'7AC5, 0x7EA1'47F4'9218'6032},
+    {0x1078'E111'C355'6CBB, 0x6F24'CCF8'DB4F'3C1F},
+    {0x1497'1956'342A'C7EA, 0x4AEE'0037'1223'0B27},
+    {0x19BC'DFAB'C135'79E4, 0xDDA9'8044'D6AB'CDF0},
+    {0x1016'0BCB'58C1'6C2F, 0x0A89'F02B'062B'60B6},
+    {0x141B'8EBE'2EF1'C73A, 0xCD2C'6C35'C7B6'38E4},
+    {0x1922'726D'BAAE'3909, 0x8077'8743'39A3'C71D},
+    {0x1F6B'0F09'2959'C74B, 0xE095'6914'080C'B8E4},
+    {0x13A2'E965'B9D8'1C8F, 0x6C5D'61AC'8507'F38E},
+    {0x188B'A3BF'284E'23B3, 0x4774'BA17'A649'F072},
+    {0x1EAE'8CAE'F261'ACA0, 0x1951'E89D'8FDC'6C8F},
+    {0x132D'17ED'577D'0BE4, 0x0FD3'3162'79E9'C3D9},
+    {0x17F8'5DE8'AD5C'4EDD, 0x13C7'FDBB'1864'34CF},
+    {0x1DF6'7562'D8B3'6294, 0x58B9'FD29'DE7D'4203},
+    {0x12BA'095D'C770'1D9C, 0xB774'3E3A'2B0E'4942},
+    {0x1768'8BB5'394C'2503, 0xE551'4DC8'B5D1'DB92},
+    {0x1D42'AEA2'879F'2E44, 0xDEA5'A13A'E346'5277},
+    {0x1249'AD25'94C3'7CEB, 0x0B27'84C4'CE0B'F38A},
+    {0x16DC'186E'F9F4'5C25, 0xCDF1'65F6'018E'F06D},
+    {0x1C93'1E8A'B871'732F, 0x416D'BF73'81F2'AC88},
+    {0x11DB'F316'B346'E7FD, 0x88E4'97A8'3137'ABD5},
+    {0x1652'EFDC'6018'A1FC, 0xEB1D'BD92'3D85'96CA},
+    {0x1BE7'ABD3'781E'CA7C, 0x25E5'2CF6'CCE6'FC7D},
+    {0x1170'CB64'2B13'3E8D, 0x97AF'3C1A'4010'5DCE},
+    {0x15CC'FE3D'35D8'0E30, 0xFD9B'0B20'D014'7542},
+    {0x1B40'3DCC'834E'11BD, 0x3D01'CDE9'0419'9292},
+    {0x1108'269F'D210'CB16, 0x4621'20B1'A28F'FB9B},
+    {0x154A'3047'C694'FDDB, 0xD7A9'68DE'0B33'FA82},
+    {0x1A9C'BC59'B83A'3D52, 0xCD93'C315'8E00'F923},
+    {0x10A1'F5B8'1324'6653, 0xC07C'59ED'78C0'9BB6},
+    {0x14CA'7326'17ED'7FE8, 0xB09B'7068'D6F0'C2A3},
+    {0x19FD'0FEF'9DE8'DFE2, 0xDCC2'4C83'0CAC'F34C},
+    {0x103E'29F5'C2B1'8BED, 0xC9F9'6FD1'E7EC'180F},
+    {0x144D'B473'335D'EEE9, 0x3C77'CBC6'61E7'1E13},
+    {0x1961'2190'0035'6AA3, 0x8B95'BEB7'FA60'E598},
+    {0x1FB9'69F4'0042'C54C, 0x6E7B'2E65'F8F9'1EFE},
+    {0x13D3'E238'8029'BB4F, 0xC50C'FCFF'BB9B'B35F},
+    {0x18C8'DAC6'A034'2A23, 0xB650'3C3F'AA82'A037},
+    {0x1EFB'1178'4841'34AC, 0xA3E4'4B4F'9523'4844},
+    {0x135C'EAEB'2D28'C0EB, 0xE66E'AF11'BD36'0D2B},
+    {0x1834'25A5'F872'F126, 0xE00A'5AD6'2C83'9075},
+    {0x1E41'2F0F'768F'AD70, 0x980C'F18B'B7A4'7493},
+    {0x12E8'BD69'AA19'CC66, 0x5F08'16F7'52C6'C8DC},
+    {0x17A2'ECC4'14A0'3F7F, 0xF6CA'1CB5'2778'7B13},
+    {0x1D8B'A7F5'19C8'4F5F, 0xF47C'A3E2'7156'99D7},
+    {0x1277'48F9'301D'319B, 0xF8CD'E66D'86D6'2026},
+    {0x1715'1B37'7C24'7E02, 0xF701'6008'E88B'A830},
+    {0x1CDA'6205'5B2D'9D83, 0xB4C1'B80B'22AE'923C},
+    {0x1208'7D43'58FC'8272, 0x50F9'1306'F5AD'1B65},
+    {0x168A'9C94'2F3B'A30E, 0xE537'57C8'B318'623F},
+    {0x1C2D'43B9'3B0A'8BD2, 0x9E85'2DBA'DFDE'7ACF},
+    {0x119C'4A53'C4E6'9763, 0xA313'3C94'CBEB'0CC1},
+    {0x1603'5CE8'B620'3D3C, 0x8BD8'0BB9'FEE5'CFF1},
+    {0x1B84'3422'E3A8'4C8B, 0xAECE'0EA8'7E9F'43EE},
+    {0x1132'A095'CE49'2FD7, 0x4D40'C929'4F23'8A75},
+    {0x157F'48BB'41DB'7BCD, 0x2090'FB73'A2EC'6D12},
+    {0x1ADF'1AEA'1252'5AC0, 0x68B5'3A50'8BA7'8856},
+    {0x10CB'70D2'4B73'78B8, 0x4171'4472'5748'B536},
+    {0x14FE'4D06'DE50'56E6, 0x51CD'958E'ED1A'E283},
+    {0x1A3D'E048'95E4'6C9F, 0xE640'FAF2'A861'9B24},
+    {0x1066'AC2D'5DAE'C3E3, 0xEFE8'9CD7'A93D'00F7},
+    {0x1480'5738'B51A'74DC, 0xEBE2'C40D'938C'4134},
+    {0x19A0'6D06'E261'1214, 0x26DB'7510'F86F'5181},
+    {0x1004'4424'4D7C'AB4C, 0x9849'292A'9B45'92F1},
+    {0x1405'552D'60DB'D61F, 0xBE5B'7375'4216'F7AD},
+    {0x1906'AA78'B912'CBA7, 0xADF2'5052'929C'B598},
+    {0x1F48'5516'E757'7E91, 0x996E'E467'3743'E2FF},
+    {0x138D'352E'5096'AF1A, 0xFFE5'4EC0'828A'6DDF},
+    {0x1870'8279'E4BC'5AE1, 0xBFDE'A270'A32D'0957},
+    {0x1E8C'A318'5DEB'719A, 0x2FD6'4B0C'CBF8'4BAD},
+    {0x1317'E5EF'3AB3'2700, 0x5DE5'EEE7'FF7B'2F4C},
+    {0x17DD'DF6B'095F'F0C0, 0x755F'6AA1'FF59'FB1F},
+    {0x1DD5'5745'CBB7'ECF0, 0x92B7'454A'7F30'79E7},
+    {0x12A5'568B'9F52'F416, 0x5BB2'8B4E'8F7E'4C30},
+    {0x174E'AC2E'8727'B11B, 0xF29F'2E22'335D'DF3C},
+    {0x1D22'573A'28F1'9D62, 0xEF46'F9AA'C035'570B},
+    {0x1235'7684'5997'025D, 0xD58C'5C0A'B821'5667},
+    {0x16C2'D425'6FFC'C2F5, 0x4AEF'730D'6629'AC01},
+    {0x1C73'892E'CBFB'F3B2, 0x9DAB'4FD0'BFB4'1701},
+    {0x11C8'35BD'3F7D'784F, 0xA28B'11E2'77D0'8E60},
+    {0x163A'432C'8F5C'D663, 0x8B2D'D65B'15C4'B1F9},
+    {0x1BC8'D3F7'B334'0BFC, 0x6DF9'4BF1'DB35'DE77},
+    {0x115D'847A'D000'877D, 0xC4BB'CF77'2901'AB0A},
+    {0x15B4'E599'8400'A95D, 0x35EA'C354'F342'15CD},
+    {0x1B22'1EFF'E500'D3B4, 0x8365'742A'3012'9B40},
+    {0x10F5'535F'EF20'8450, 0xD21F'689A'5E0B'A108},
+    {0x1532'A837'EAE8'A565, 0x06A7'42C0'F58E'894A},
+    {0x1A7F'5245'E5A2'CEBE, 0x4851'1371'32F2'2B9D},
+    {0x108F'936B'AF85'C136, 0xED32'AC26'BFD7'5B42},
+    {0x14B3'7846'9B67'3184, 0xA87F'5730'6FCD'3212},
+    {0x19E0'5658'4240'FDE5, 0xD29F'2CFC'8BC0'7E97},
+    {0x102C'35F7'2968'9EAF, 0xA3A3'7C1D'D758'4F1E},
+    {0x1437'4374'F3C2'C65B, 0x8C8C'5B25'4D2E'62E6},
+    {0x1945'1452'30B3'77F2, 0x6FAF'71EE'A079'FB9F},
+    {0x1F96'5966'BCE0'55EF, 0x0B9B'4E6A'4898'7A87},
+    {0x13BD'F7E0'360C'35B5, 0x6741'1102'6D5F'4C94},
+    {0x18AD'75D8'438F'4322, 0xC111'5543'08B7'1FBA},
+    {0x1ED8'D34E'5473'13EB, 0x7155'AA93'CAE4'E7A8},
+    {0x1347'8410'F4C7'EC73, 0x26D5'8A9C'5ECF'10C9},
+    {0x1819'6515'31F9'E78F, 0xF08A'ED43'7682'D4FB},
+    {0x1E1F'BE5A'7E78'6173, 0xECAD'A894'5423'8A3A},
+    {0x12D3'D6F8'8F0B'3CE8, 0x73EC'895C'B496'3664},
+    {0x1788'CCB6'B2CE'0C22, 0x90E7'ABB3'E1BB'C3FD},
+    {0x1D6A'FFE4'5F81'8F2B, 0x3521'96A0'DA2A'B4FD},
+    {0x1262'DFEE'BBB0'F97B, 0x0134'FE24'885A'B11E},
+    {0x16FB'97EA'6A9D'37D9, 0xC182'3DAD'AA71'5D65},
+    {0x1CBA'7DE5'0544'85D0, 0x31E2'CD19'150D'B4BF},
+    {0x11F4'8EAF'234A'D3A2, 0x1F2D'C02F'AD28'90F7},
+    {0x1671'B25A'EC1D'888A, 0xA6F9'303B'9872'B535},
+    {0x1C0E'1EF1'A724'EAAD, 0x50B7'7C4A'7E8F'6282},
+    {0x1188'D357'0877'12AC, 0x5272'ADAE'8F19'9D91},
+    {0x15EB'082C'CA94'D757, 0x670F'591A'32E0'04F6},
+    {0x1B65'CA37'FD3A'0D2D, 0x40D3'2F60'BF98'0633},
+    {0x111F'9E62'FE44'483C, 0x4883'FD9C'77BF'03E0},
+    {0x1567'85FB'BDD5'5A4B, 0x5AA4'FD03'95AE'C4D8},
+    {0x1AC1'677A'AD4A'B0DE, 0x314E'3C44'7B1A'760E},
+    {0x10B8'E0AC'AC4E'AE8A, 0xDED0'E5AA'CCF0'89C9},
+    {0x14E7'18D7'D762'5A2D, 0x9685'1F15'802C'AC3B},
+    {0x1A20'DF0D'CD3A'F0B8, 0xFC26'66DA'E037'D74A},
+    {0x1054'8B68'A044'D673, 0x9D98'0048'CC22'E68E},
+    {0x1469'AE42'C856'0C10, 0x84FE'005A'FF2B'A032},
+    {0x1984'19D3'7A6B'8F14, 0xA63D'8071'BEF6'883E},
+    {0x1FE5'2048'5906'72D9, 0xCFCC'E08E'2EB4'2A4E},
+    {0x13EF'342D'37A4'07C8, 0x21E0'0C58'DD30'9A70},
+    {0x18EB'0138'858D'09BA, 0x2A58'0F6F'147C'C10D},
+    {0x1F25'C186'A6F0'4C28, 0xB4EE'134A'D99B'F150},
+    {0x1377'98F4'2856'2F99, 0x7114'CC0E'C801'76D2},
+    {0x1855'7F31'326B'BB7F, 0xCD59'FF12'7A01'D486},
+    {0x1E6A'DEFD'7F06'AA5F, 0xC0B0'7ED7'1882'49A8},
+    {0x1302'CB5E'6F64'2A7B, 0xD86E'4F46'6F51'6E09},
+    {0x17C3'7E36'0B3D'351A, 0xCE89'E318'0B25'C98B},
+    {0x1DB4'5DC3'8E0C'8261, 0x822C'5BDE'0DEF'3BEE},
+    {0x1290'BA9A'38C7'D17C, 0xF15B'B96A'C8B5'8575},
+    {0x1734'E940'C6F9'C5DC, 0x2DB2'A7C5'7AE2'E6D2},
+    {0x1D02'2390'F8B8'3753, 0x391F'51B6'D99B'A086},
+    {0x1221'563A'9B73'2294, 0x03B3'9312'4801'4454},
+    {0x16A9'ABC9'424F'EB39, 0x04A0'77D6'DA01'9569},
+    {0x1C54'16BB'92E3'E607, 0x45C8'95CC'9081'FAC3},
+    {0x11B4'8E35'3BCE'6FC4, 0x8B9D'5D9F'DA51'3CBA},
+    {0x1621'B1C2'8AC2'0BB5, 0xAE84'B507'D0E5'8BE8},
+    {0x1BAA'1E33'2D72'8EA3, 0x1A25'E249'C51E'EEE3},
+    {0x114A'52DF'FC67'9925, 0xF057'AD6E'1B33'554D},
+    {0x159C'E797'FB81'7F6F, 0x6C6D'98C9'A200'2AA1},
+    {0x1B04'217D'FA61'DF4B, 0x4788'FEFC'0A80'3549},
+    {0x10E2'94EE'BC7D'2B8F, 0x0CB5'9F5D'8690'214E},
+    {0x151B'3A2A'6B9C'7672, 0xCFE3'0734'E834'29A1},
+    {0x1A62'08B5'0683'940F, 0x83DB'C902'2241'340A},
+    {0x107D'4571'2412'3C89, 0xB269'5DA1'5568'C086},
+    {0x149C'96CD'6D16'CBAC, 0x1F03'B509'AAC2'F0A7},
+    {0x19C3'BC80'C85C'7E97, 0x26C4'A24C'1573'ACD1},
+    {0x101A'55D0'7D39'CF1E, 0x783A'E56F'8D68'4C03},
+    {0x1420'EB44'9C88'42E6, 0x1649'9ECB'70C2'5F03},
+    {0x1929'2615'C3AA'539F, 0x9BDC'067E'4CF2'F6C4},
+    {0x1F73'6F9B'3494'E887, 0x82D3'081D'E02F'B476},
+    {0x13A8'25C1'00DD'1154, 0xB1C3'E512'AC1D'D0C9},
+    {0x1892'2F31'4114'55A9, 0xDE34'DE57'5725'44FC},
+    {0x1EB6'BAFD'9159'6B14, 0x55C2'15ED'2CEE'963B},
+    {0x1332'34DE'7AD7'E2EC, 0xB599'4DB4'3C15'1DE5},
+    {0x17FE'C216'198D'DBA7, 0xE2FF'A121'4B1A'655E},
+    {0x1DFE'729B'9FF1'5291, 0xDBBF'8969'9DE0'FEB6},
+    {0x12BF'07A1'43F6'D39B, 0x2957'B5E2'02AC'9F31},
+    {0x176E'C989'94F4'8881, 0xF3AD'A35A'8357'C6FE},
+    {0x1D4A'7BEB'FA31'AAA2, 0x7099'0C31'242D'B8BD},
+    {0x124E'8D73'7C5F'0AA5, 0x865F'A79E'B69C'9376},
+    {0x16E2'30D0'5B76'CD4E, 0xE7F7'9186'6443'B854},
+    {0x1C9A'BD04'7254'80A2, 0xA1F5'75E7'FD54'A669},
+    {0x11E0'B622'C774'D065, 0xA539'69B0'FE54'E801},
+    {0x1658'E3AB'7952'047F, 0x0E87'C41D'3DEA'2202},
+    {0x1BEF'1C96'57A6'859E, 0xD229'B524'8D64'AA82},
+    {0x1175'71DD'F6C8'1383, 0x435A'1136'D85E'EA91},
+    {0x15D2'CE55'747A'1864, 0x1430'9584'8E76'A536},
+    {0x1B47'81EA'D198'9E7D, 0x193C'BAE5'B214'4E83},
+    {0x110C'B132'C2FF'630E, 0x2FC5'F4CF'8F4C'B112},
+    {0x154F'DD7F'73BF'3BD1, 0xBBB7'7203'731F'DD56},
+    {0x1AA3'D4DF'50AF'0AC6, 0x2AA5'4E84'4FE7'D4AC},
+    {0x10A6'650B'926D'66BB, 0xDAA7'5112'B1F0'E4EB},
+    {0x14CF'FE4E'7708'C06A, 0xD151'2557'5E6D'1E26},
+    {0x1A03'FDE2'14CA'F085, 0x85A5'6EAD'3608'65B0},
+    {0x1042'7EAD'4CFE'D653, 0x7387'652C'41C5'3F8E},
+    {0x1453'1E58'A03E'8BE8, 0x5069'3E77'5236'8F71},
+    {0x1967'E5EE'C84E'2EE2, 0x6483'8E15'26C4'334E},
+    {0x1FC1'DF6A'7A61'BA9A, 0xFDA4'719A'7075'4022},
+    {0x13D9'2BA2'8C7D'14A0, 0xDE86'C700'8649'4815},
+    {0x18CF'768B'2F9C'59C9, 0x1628'78C0'A7DB'9A1A},
+    {0x1F03'542D'FB83'703B, 0x5BB2'96F0'D1D2'80A1},
+    {0x1362'149C'BD32'2625, 0x194F'9E56'8323'9064},
+    {0x183A'99C3'EC7E'AFAE, 0x5FA3'85EC'23EC'747E},
+    {0x1E49'4034'E79E'5B99, 0xF78C'6767'2CE7'919D},
+    {0x12ED'C821'10C2'F940, 0x3AB7'C0A0'7C10'BB02},
+    {0x17A9'3A29'54F3'B790, 0x4965'B0C8'9B14'E9C3},
+    {0x1D93'88B3'AA30'A574, 0x5BBF'1CFA'C1DA'2433},
+    {0x127C'3570'4A5E'6768, 0xB957'721C'B928'56A0},
+    {0x171B'42CC'5CF6'0142, 0xE7AD'4EA3'E772'6C48},
+    {0x1CE2'137F'7433'8193, 0xA198'A24C'E14F'075A},
+    {0x120D'4C2F'A8A0'30FC, 0x44FF'6570'0CD1'6498},
+    {0x1690'9F3B'92C8'3D3B, 0x563F'3ECC'1005'BDBE},
+    {0x1C34'C70A'777A'4C8A, 0x2BCF'0E7F'1407'2D2E},
+    {0x11A0'FC66'8AAC'6FD6, 0x5B61'690F'6C84'7C3D},
+    {0x1609'3B80'2D57'8BCB, 0xF239'C353'47A5'9B4C},
+    {0x1B8B'8A60'38AD'6EBE, 0xEEC8'3428'198F'021F},
+    {0x1137'367C'236C'6537, 0x553D'2099'0FF9'6153},
+    {0x1585'041B'2C47'7E85, 0x2A8C'68BF'53F7'B9A8},
+    {0x1AE6'4521'F759'5E26, 0x752F'82EF'28F5'A812},
+    {0x10CF'EB35'3A97'DAD8, 0x093D'B1D5'7999'890B},
+    {0x1503'E602'893D'D18E, 0x0B8D'1E4A'D7FF'EB4E},
+    {0x1A44'DF83'2B8D'45F1, 0x8E70'65DD'8DFF'E622},
+    {0x106B'0BB1'FB38'4BB6, 0xF906'3FAA'78BF'EFD5},
+    {0x1485'CE9E'7A06'5EA4, 0xB747'CF95'16EF'EBCA},
+    {0x19A7'4246'1887'F64D, 0xE519'C37A'5CAB'E6BD},
+    {0x1008'896B'CF54'F9F0, 0xAF30'1A2C'79EB'7036},
+    {0x140A'ABC6'C32A'386C, 0xDAFC'20B7'9866'4C43},
+    {0x190D'56B8'73F4'C688, 0x11BB'28E5'7E7F'DF54},
+    {0x1F50'AC66'90F1'F82A, 0x1629'F31E'DE1F'D72A},
+    {0x1392'6BC0'1A97'3B1A, 0x4DDA'37F3'4AD3'E67A},
+    {0x1877'06B0'213D'09E0, 0xE150'C5F0'1D88'E019},
+    {0x1E94'C85C'298C'4C59, 0x19A4'F76C'24EB'181F},
+    {0x131C'FD39'99F7'AFB7, 0xB007'1AA3'9712'EF13},
+    {0x17E4'3C88'0075'9BA5, 0x9C08'E14C'7CD7'AAD8},
+    {0x1DDD'4BAA'0093'028F, 0x030B'199F'9C0D'958E},
+    {0x12AA'4F4A'405B'E199, 0x61E6'F003'C188'7D79},
+    {0x1754'E31C'D072'D9FF, 0xBA60'AC04'B1EA'9CD7},
+    {0x1D2A'1BE4'048F'907F, 0xA8F8'D705'DE65'440D},
+    {0x123A'516E'82D9'BA4F, 0xC99B'8663'AAFF'4A88},
+    {0x16C8'E5CA'2390'28E3, 0xBC02'67FC'95BF'1D2A},
+    {0x1C7B'1F3C'AC74'331C, 0xAB03'01FB'BB2E'E474},
+    {0x11CC'F385'EBC8'9FF1, 0xEAE1'E13D'54FD'4EC9},
+    {0x1640'3067'66BA'C7EE, 0x659A'598C'AA3C'A27B},
+    {0x1BD0'3C81'4069'79E9, 0xFF00'EFEF'D4CB'CB1A},
+    {0x1162'25D0'C841'EC32, 0x3F60'95F5'E4FF'5EF0},
+    {0x15BA'AF44'FA52'673E, 0xCF38'BB73'5E3F'36AC},
+    {0x1B29'5B16'38E7'010E, 0x8306'EA50'35CF'0457},
+    {0x10F9'D8ED'E390'60A9, 0x11E4'5272'21A1'62B6},
+    {0x1538'4F29'5C74'78D3, 0x565D'670E'AA09'BB64},
+    {0x1A86'62F3'B391'9708, 0x2BF4'C0D2'548C'2A3D},
+    {0x1093'FDD8'503A'FE65, 0x1B78'F883'74D7'9A66},
+    {0x14B8'FD4E'6449'BDFE, 0x6257'36A4'520D'8100},
+    {0x19E7'3CA1'FD5C'2D7D, 0xFAED'044D'6690'E140},
+    {0x1030'85E5'3E59'9C6E, 0xBCD4'22B0'601A'8CC8},
+    {0x143C'A75E'8DF0'038A, 0x6C09'2B5C'7821'2FFA},
+    {0x194B'D136'316C'046D, 0x070B'7633'9629'7BF8},
+    {0x1F9E'C583'BDC7'0588, 0x48CE'53C0'7BB3'DAF6},
+    {0x13C3'3B72'569C'6375, 0x2D80'F458'4D50'68DA},
+    {0x18B4'0A4E'EC43'7C52, 0x78E1'316E'60A4'8310},
+};
+// clang-format on
+
+// Returns ceil(log2(5^e)), or 1 for e == 0. Valid for 0 <= e <= 3528.
+int Pow5Bits(int e) {
+  DCHECK(0 <= e && e <= 3528);
+  return static_cast<int>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+// Returns floor(log10(2^e)). Valid for 0 <= e <= 1650.
+int Log10Pow2(int e) {
+  DCHECK(0 <= e && e <= 1650);
+  return static_cast<int>((static_cast<uint32_t>(e) * 78913) >> 18);
+}
+
+// Returns floor(log10(5^e)). Valid for 0 <= e <= 2620.
+int Log10Pow5(int e) {
+  DCHECK(0 <= e && e <= 2620);
+  return static_cast<int>((static_cast<uint32_t>(e) * 732923) >> 20);
+}
+
+bool MultipleOfPowerOf5(uint64_t value, int p) {
+  DCHECK_NE(value, 0);
+  int count = 0;
+  for (; value % 5 == 0; value /= 5) ++count;
+  return count >= p;
+}
+
+bool MultipleOfPowerOf2(uint64_t value, int p) {
+  DCHECK(0 <= p && p < 64);
+  return (value & ((uint64_t{1} << p) - 1)) == 0;
+}
+
+// Returns floor(m * mul / 2^j), where 64 < j < 128 and m has at most 55
+// significant bits, so that the result fits into 64 bits.
+uint64_t MulShift64(uint64_t m, const UInt128& mul, int j) {
+  uint64_t low_product_low;
+  uint64_t low_product_high =
+      bits::UnsignedMul128(m, mul.low, &low_product_low);
+  USE(low_product_low);
+  uint64_t high_product_low;
+  uint64_t high_product_high =
+      bits::UnsignedMul128(m, mul.high, &high_product_low);
+  uint64_t sum_low = high_product_low + low_product_high;
+  uint64_t sum_high = high_product_high + (sum_low < high_product_low);
+  int shift = j - 64;
+  DCHECK(0 < shift && shift < 64);
+  return (sum_high << (64 - shift)) | (sum_low >> shift);
+}
+
+int DecimalLength(uint64_t value) {
+  int length = 1;
+  for (; value >= 10; value /= 10) ++length;
+  return length;
+}
+
+}  // namespace
+
+void RyuDtoa(double v, Vector<char> buffer, int* length, int* decimal_point) {
+  DCHECK_GT(v, 0);
+  DCHECK(!Double(v).IsSpecial());
+  uint64_t v_bits = Double(v).AsUint64();
+  uint64_t ieee_mantissa = v_bits & ((uint64_t{1} << kMantissaBits) - 1);
+  int ieee_exponent = static_cast<int>(v_bits >> kMantissaBits);
+
+  // The value is m2 * 2^e2. Subtract 2 more from the exponent so that the
+  // bounds halfway to the neighboring doubles are integers too.
+  int e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kExponentBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = ieee_exponent - kExponentBias - kMantissaBits - 2;
+    m2 = (uint64_t{1} << kMantissaBits) | ieee_mantissa;
+  }
+  // Round to even: the bounds belong to the interval if m2 is even.
+  const bool accept_bounds = (m2 & 1) == 0;
+
+  // The value and its bounds are mv, mv + 2 and mv - 1 - mm_shift times 2^e2.
+  // The lower bound is closer if v is a power of two.
+  const uint64_t mv = 4 * m2;
+  const int mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+
+  // Compute vr, vp and vm, the value and its bounds times 2^e2 / 10^e10,
+  // together with whether the digits dropped by the division are all zero.
+  uint64_t vr, vp, vm;
+  int e10;
+  bool vm_is_trailing_zeros = false;
+  bool vr_is_trailing_zeros = false;
+  if (e2 >= 0) {
+    const int q = Log10Pow2(e2) - (e2 > 3);
+    e10 = q;
+    const int k = kPow5InvBitCount + Pow5Bits(q) - 1;
+    const int i = -e2 + q + k;
+    vr = MulShift64(mv, kPow5InvSplit[q], i);
+    vp = MulShift64(mv + 2, kPow5InvSplit[q], i);
+    vm = MulShift64(mv - 1 - mm_shift, kPow5InvSplit[q], i);
+    if (q <= 21) {
+      // Only one of mv, mv + 2 and mv - 1 - mm_shift can be a multiple of 5.
+      if (mv % 5 == 0) {
+        vr_is_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = MultipleOfPowerOf5(mv - 1 - mm_shift, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mv + 2, q);
+      }
+    }
+  } else {
+    const int q = Log10Pow5(-e2) - (-e2 > 1);
+    e10 = q + e2;
+    const int i = -e2 - q;
+    const int k = Pow5Bits(i) - kPow5BitCount;
+    const int j = q - k;
+    vr = MulShift64(mv, kPow5Split[i], j);
+    vp = MulShift64(mv + 2, kPow5Split[i], j);
+    vm = MulShift64(mv - 1 - mm_shift, kPow5Split[i], j);
+    if (q <= 1) {
+      // mv has at least two trailing zero bits, so vr is exact.
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Remove digits as long as the bounds still differ, tracking the last
+  // removed digit of vr to round correctly.
+  int removed = 0;
+  int last_removed_digit = 0;
+  uint64_t output;
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    while (vp / 10 > vm / 10) {
+      vm_is_trailing_zeros &= vm % 10 == 0;
+      vr_is_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<int>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      // The lower bound is part of the interval, so more digits can go.
+      while (vm % 10 == 0) {
+        vr_is_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<int>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0) {
+      // Exactly halfway: round to even.
+      last_removed_digit = 4;
+    }
+    output = vr + ((vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) ||
+                   last_removed_digit >= 5);
+  } else {
+    // The common case, in which no exact ties are possible.
+    bool round_up = false;
+    while (vp / 10 > vm / 10) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+
+  // Rounding up can produce a trailing zero.
+  while (output % 10 == 0) {
+    output /= 10;
+    ++removed;
+  }
+
+  const int output_length = DecimalLength(output);
+  DCHECK_LE(output_length, kRyuDtoaMaximalLength);
+  for (int i = output_length - 1; i >= 0; --i) {
+    buffer[i] = static_cast<char>('0' + output % 10);
+    output /= 10;
+  }
+  buffer[output_length] = '\0';
+  *length = output_length;
+  *decimal_point = e10 + removed + output_length;
+}
+
+}  // namespace base
+}  // namespace v8
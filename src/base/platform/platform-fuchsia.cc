@@ -358,6 +358,9 @@ void OS::DestroySharedMemoryHandle(PlatformSharedMemoryHandle handle) {
 // static
 bool OS::HasLazyCommits() { return true; }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   UNREACHABLE();  // TODO(scottmg): Port, https://crbug.com/731217.
 }
@@ -8,6 +8,7 @@
 #include "src/base/platform/platform-linux.h"
 
 #include <pthread.h>
+#include <sched.h>
 #include <semaphore.h>
 #include <signal.h>
 #include <stdio.h>
@@ -276,6 +277,80 @@ std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   return ::v8::base::GetSharedLibraryAddresses(nullptr);
 }
 
+// static
+bool OS::MarkPagesMergeable(void* address, size_t size) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  DCHECK(IsAligned(size, CommitPageSize()));
+#if defined(MADV_MERGEABLE)
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+int OS::GetCurrentNumaNode() {
+  unsigned cpu;
+  unsigned node;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return -1;
+  return static_cast<int>(node);
+}
+
+// static
+bool OS::SetCurrentThreadNumaNode(int node) {
+  if (node < 0) return false;
+  // The CPUs of a node are listed as ranges, e.g. "0-7,16-23".
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+           node);
+  FILE* fp = fopen(path, "r");
+  if (fp == nullptr) return false;
+  char cpulist[4096];
+  bool read = fgets(cpulist, sizeof(cpulist), fp) != nullptr;
+  fclose(fp);
+  if (!read) return false;
+
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  char* pos = cpulist;
+  while (*pos != '\0' && *pos != '\n') {
+    char* end;
+    size_t first = strtoul(pos, &end, 10);
+    if (end == pos) return false;
+    size_t last = first;
+    if (*end == '-') {
+      pos = end + 1;
+      last = strtoul(pos, &end, 10);
+      if (end == pos) return false;
+    }
+    for (size_t cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu) {
+      CPU_SET(cpu, &cpus);
+    }
+    pos = end;
+    if (*pos == ',') ++pos;
+  }
+  if (CPU_COUNT(&cpus) == 0) return false;
+  // A pid of 0 denotes the calling thread.
+  return sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+}
+
+// static
+bool OS::SetPagesNumaNode(void* address, size_t size, int node) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  DCHECK(IsAligned(size, CommitPageSize()));
+  // From <linux/mempolicy.h>, which is not available everywhere.
+  constexpr int kMpolPreferred = 1;
+  constexpr int kMaxNodes = 1024;
+  using NodeMaskWord = unsigned long;  // NOLINT(runtime/int)
+  constexpr int kBitsPerWord = 8 * sizeof(NodeMaskWord);
+  if (node < 0 || node >= kMaxNodes) return false;
+  NodeMaskWord nodemask[kMaxNodes / kBitsPerWord] = {};
+  nodemask[node / kBitsPerWord] |= NodeMaskWord{1} << (node % kBitsPerWord);
+  // The kernel only looks at the first |maxnode - 1| bits of the mask.
+  return syscall(__NR_mbind, address, size, kMpolPreferred, nodemask,
+                 kMaxNodes + 1, 0) == 0;
+}
+
 // static
 bool OS::RemapPages(const void* address, size_t size, void* new_address,
                     MemoryPermission access) {
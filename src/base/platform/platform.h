@@ -211,6 +211,10 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Hints the OS to back the given committed memory with transparent huge
+  // pages. Returns false if the platform does not support the hint.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -334,6 +338,60 @@ class V8_BASE_EXPORT OS {
                                                void* new_address,
                                                MemoryPermission access);
 
+  // Whether the platform supports marking memory as mergeable with identical
+  // pages of other processes.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsMergeablePagesSupported() {
+#if defined(V8_OS_LINUX)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Hints that the private anonymous memory at |address| is likely identical to
+  // memory in other processes, so that the kernel may back it by shared
+  // physical pages (kernel samepage merging on Linux). Merged pages are copied
+  // again on write.
+  //
+  // Both |address| and |size| must be aligned to the commit page size.
+  //
+  // Must not be called if |IsMergeablePagesSupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool MarkPagesMergeable(void* address,
+                                                       size_t size);
+
+  // Whether the platform supports binding threads and memory to NUMA nodes.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsNumaAffinitySupported() {
+#if defined(V8_OS_LINUX)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Returns the NUMA node of the CPU the calling thread currently runs on, or
+  // -1 if it cannot be determined.
+  //
+  // Must not be called if |IsNumaAffinitySupported()| returns false.
+  static int GetCurrentNumaNode();
+
+  // Restricts the calling thread to the CPUs of NUMA node |node|.
+  //
+  // Must not be called if |IsNumaAffinitySupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool SetCurrentThreadNumaNode(int node);
+
+  // Makes the kernel prefer physical memory of NUMA node |node| when backing
+  // the pages at |address|. Falls back to other nodes if |node| runs out of
+  // memory. The preference is lost when the pages get decommitted.
+  //
+  // Both |address| and |size| must be aligned to the commit page size.
+  //
+  // Must not be called if |IsNumaAffinitySupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool SetPagesNumaNode(void* address,
+                                                     size_t size, int node);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
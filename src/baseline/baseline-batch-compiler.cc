@@ -11,6 +11,7 @@
 
 #include <algorithm>
 
+#include "src/base/platform/mutex.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -98,31 +99,35 @@ class BaselineCompilerTask {
   double time_taken_ms_;
 };
 
+// A function of a batch together with its priority, see
+// BaselineBatchCompiler::kPriorityOffset.
+using PrioritizedFunction = std::pair<int, Handle<SharedFunctionInfo>>;
+
 class BaselineBatchCompilerJob {
  public:
-  BaselineBatchCompilerJob(Isolate* isolate, Handle<WeakFixedArray> task_queue,
-                           int batch_size) {
+  // Creates a job for functions[start, end), which must be sorted by
+  // decreasing priority.
+  BaselineBatchCompilerJob(Isolate* isolate,
+                           const std::vector<PrioritizedFunction>& functions,
+                           size_t start, size_t end)
+      : priority_(functions[start].first) {
+    DCHECK_LT(start, end);
     handles_ = isolate->NewPersistentHandles();
-    tasks_.reserve(batch_size);
-    for (int i = 0; i < batch_size; i++) {
-      MaybeObject maybe_sfi = task_queue->Get(i);
-      // TODO(victorgomes): Do I need to clear the value?
-      task_queue->Set(i, HeapObjectReference::ClearedValue(isolate));
-      HeapObject obj;
-      // Skip functions where weak reference is no longer valid.
-      if (!maybe_sfi.GetHeapObjectIfWeak(&obj)) continue;
-      // Skip functions where the bytecode has been flushed.
-      SharedFunctionInfo shared = SharedFunctionInfo::cast(obj);
-      if (!CanCompileWithConcurrentBaseline(shared, isolate)) continue;
-      tasks_.emplace_back(isolate, handles_.get(), shared);
+    tasks_.reserve(end - start);
+    for (size_t i = start; i < end; i++) {
+      DCHECK_LE(functions[i].first, priority_);
+      tasks_.emplace_back(isolate, handles_.get(), *functions[i].second);
     }
     if (FLAG_trace_baseline_concurrent_compilation) {
       CodeTracer::Scope scope(isolate->GetCodeTracer());
-      PrintF(scope.file(), "[Concurrent Sparkplug] compiling %zu functions\n",
-             tasks_.size());
+      PrintF(scope.file(),
+             "[Concurrent Sparkplug] compiling %zu functions (priority %d)\n",
+             tasks_.size(), priority_);
     }
   }
 
+  int priority() const { return priority_; }
+
   // Executed in the background thread.
   void Compile(LocalIsolate* local_isolate) {
     local_isolate->heap()->AttachPersistentHandles(std::move(handles_));
@@ -144,6 +149,57 @@ class BaselineBatchCompilerJob {
  private:
   std::vector<BaselineCompilerTask> tasks_;
   std::unique_ptr<PersistentHandles> handles_;
+  // The highest priority of the functions in this job.
+  const int priority_;
+};
+
+// Jobs waiting for a worker. Jobs are handed out by decreasing priority, and
+// in the order they were enqueued among jobs of the same priority, so that
+// hot functions do not wait behind batches of cold ones.
+class PrioritizedJobQueue final {
+ public:
+  PrioritizedJobQueue() = default;
+  PrioritizedJobQueue(const PrioritizedJobQueue&) = delete;
+  PrioritizedJobQueue& operator=(const PrioritizedJobQueue&) = delete;
+
+  void Enqueue(std::unique_ptr<BaselineBatchCompilerJob> job) {
+    base::MutexGuard guard(&mutex_);
+    int priority = job->priority();
+    entries_.push_back({priority, next_sequence_number_++, std::move(job)});
+    std::push_heap(entries_.begin(), entries_.end(), Entry::Less);
+    size_.store(entries_.size(), std::memory_order_relaxed);
+  }
+
+  bool Dequeue(std::unique_ptr<BaselineBatchCompilerJob>* job) {
+    base::MutexGuard guard(&mutex_);
+    if (entries_.empty()) return false;
+    std::pop_heap(entries_.begin(), entries_.end(), Entry::Less);
+    *job = std::move(entries_.back().job);
+    entries_.pop_back();
+    size_.store(entries_.size(), std::memory_order_relaxed);
+    return true;
+  }
+
+  bool IsEmpty() const { return size() == 0; }
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Entry {
+    int priority;
+    uint64_t sequence_number;
+    std::unique_ptr<BaselineBatchCompilerJob> job;
+
+    // Orders the max-heap by priority, then by age.
+    static bool Less(const Entry& a, const Entry& b) {
+      if (a.priority != b.priority) return a.priority < b.priority;
+      return a.sequence_number > b.sequence_number;
+    }
+  };
+
+  base::Mutex mutex_;
+  std::vector<Entry> entries_;
+  uint64_t next_sequence_number_ = 0;
+  std::atomic<size_t> size_{0};
 };
 
 class ConcurrentBaselineCompiler {
@@ -151,8 +207,7 @@ class ConcurrentBaselineCompiler {
   class JobDispatcher : public v8::JobTask {
    public:
     JobDispatcher(
-        Isolate* isolate,
-        LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>>* incoming_queue,
+        Isolate* isolate, PrioritizedJobQueue* incoming_queue,
         LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>>* outcoming_queue)
         : isolate_(isolate),
           incoming_queue_(incoming_queue),
@@ -187,7 +242,7 @@ class ConcurrentBaselineCompiler {
 
    private:
     Isolate* isolate_;
-    LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>>* incoming_queue_;
+    PrioritizedJobQueue* incoming_queue_;
     LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>>* outgoing_queue_;
   };
 
@@ -213,8 +268,46 @@ class ConcurrentBaselineCompiler {
   void CompileBatch(Handle<WeakFixedArray> task_queue, int batch_size) {
     DCHECK(FLAG_concurrent_sparkplug);
     RCS_SCOPE(isolate_, RuntimeCallCounterId::kCompileBaseline);
-    incoming_queue_.Enqueue(std::make_unique<BaselineBatchCompilerJob>(
-        isolate_, task_queue, batch_size));
+    HandleScope scope(isolate_);
+    std::vector<PrioritizedFunction> functions;
+    functions.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+      int index = i * BaselineBatchCompiler::kEntryLength;
+      MaybeObject maybe_sfi =
+          task_queue->Get(index + BaselineBatchCompiler::kSharedOffset);
+      int priority =
+          task_queue->Get(index + BaselineBatchCompiler::kPriorityOffset)
+              .ToSmi()
+              .value();
+      for (int j = 0; j < BaselineBatchCompiler::kEntryLength; j++) {
+        task_queue->Set(index + j, HeapObjectReference::ClearedValue(isolate_));
+      }
+      HeapObject obj;
+      // Skip functions where weak reference is no longer valid.
+      if (!maybe_sfi.GetHeapObjectIfWeak(&obj)) continue;
+      // Skip functions where the bytecode has been flushed.
+      SharedFunctionInfo shared = SharedFunctionInfo::cast(obj);
+      if (!CanCompileWithConcurrentBaseline(shared, isolate_)) continue;
+      functions.emplace_back(priority, handle(shared, isolate_));
+    }
+    if (functions.empty()) return;
+
+    std::stable_sort(
+        functions.begin(), functions.end(),
+        [](const PrioritizedFunction& a, const PrioritizedFunction& b) {
+          return a.first > b.first;
+        });
+
+    // Split the batch so that several workers can compile it in parallel. The
+    // hottest functions end up in the first job, which is handed out first.
+    size_t job_count = std::max<size_t>(
+        1, std::min(MaxJobsPerBatch(), functions.size() / kMinJobSize));
+    size_t job_size = (functions.size() + job_count - 1) / job_count;
+    for (size_t start = 0; start < functions.size(); start += job_size) {
+      size_t end = std::min(start + job_size, functions.size());
+      incoming_queue_.Enqueue(std::make_unique<BaselineBatchCompilerJob>(
+          isolate_, functions, start, end));
+    }
     job_handle_->NotifyConcurrencyIncrease();
   }
 
@@ -227,9 +320,18 @@ class ConcurrentBaselineCompiler {
   }
 
  private:
+  // Jobs smaller than this are not worth handing to a separate worker.
+  static constexpr size_t kMinJobSize = 4;
+
+  static size_t MaxJobsPerBatch() {
+    size_t max_threads = FLAG_concurrent_sparkplug_max_threads;
+    if (max_threads > 0) return max_threads;
+    return std::max(1, V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  }
+
   Isolate* isolate_;
   std::unique_ptr<JobHandle> job_handle_ = nullptr;
-  LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> incoming_queue_;
+  PrioritizedJobQueue incoming_queue_;
   LockedQueue<std::unique_ptr<BaselineBatchCompilerJob>> outgoing_queue_;
 };
 
@@ -268,6 +370,38 @@ void BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
     return;
   }
 
+  int priority = function->has_feedback_vector()
+                     ? function->feedback_vector().invocation_count()
+                     : 0;
+
+  // A function that exhausts its interrupt budget again while it is still
+  // waiting in the current batch is hot, so compile the batch right away
+  // rather than waiting for it to fill up.
+  if (UpdateQueuedPriority(*shared, priority)) {
+    if (FLAG_trace_baseline_batch_compilation) {
+      CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+      PrintF(trace_scope.file(),
+             "[Baseline batch compilation] Re-enqueued function ");
+      function->PrintName(trace_scope.file());
+      PrintF(trace_scope.file(),
+             " with priority %d, compiling current batch of %d functions\n",
+             priority, last_index_);
+    }
+    if (FLAG_concurrent_sparkplug) {
+      concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+      ClearBatch();
+    } else {
+      CompileBatch(function);
+    }
+    return;
+  }
+
+  // A function whose baseline code was flushed has been hot before, so it is
+  // likely to stay hot now that it is hot again. Compile the batch right away
+  // rather than interpreting the function until the batch fills up.
+  const bool was_flushed = shared->baseline_code_was_flushed();
+  shared->set_baseline_code_was_flushed(false);
+
   int estimated_size;
   {
     DisallowHeapAllocation no_gc;
@@ -285,7 +419,7 @@ void BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
            estimated_instruction_size_,
            FLAG_baseline_batch_compilation_threshold);
   }
-  if (ShouldCompileBatch()) {
+  if (was_flushed || ShouldCompileBatch()) {
     if (FLAG_trace_baseline_batch_compilation) {
       CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
       PrintF(trace_scope.file(),
@@ -294,20 +428,47 @@ void BaselineBatchCompiler::EnqueueFunction(Handle<JSFunction> function) {
              (last_index_ + 1));
     }
     if (FLAG_concurrent_sparkplug) {
-      Enqueue(shared);
+      Enqueue(shared, priority);
       concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
       ClearBatch();
     } else {
       CompileBatch(function);
     }
   } else {
-    Enqueue(shared);
+    Enqueue(shared, priority);
   }
 }
 
-void BaselineBatchCompiler::Enqueue(Handle<SharedFunctionInfo> shared) {
+void BaselineBatchCompiler::Enqueue(Handle<SharedFunctionInfo> shared,
+                                    int priority) {
   EnsureQueueCapacity();
-  compilation_queue_->Set(last_index_++, HeapObjectReference::Weak(*shared));
+  int index = last_index_++ * kEntryLength;
+  compilation_queue_->Set(index + kSharedOffset,
+                          HeapObjectReference::Weak(*shared));
+  compilation_queue_->Set(index + kPriorityOffset,
+                          MaybeObject::FromSmi(Smi::FromInt(priority)));
+}
+
+bool BaselineBatchCompiler::UpdateQueuedPriority(SharedFunctionInfo shared,
+                                                 int priority) {
+  DisallowGarbageCollection no_gc;
+  for (int i = 0; i < last_index_; i++) {
+    int index = i * kEntryLength;
+    HeapObject obj;
+    if (!compilation_queue_->Get(index + kSharedOffset)
+             .GetHeapObjectIfWeak(&obj) ||
+        obj != shared) {
+      continue;
+    }
+    int queued_priority =
+        compilation_queue_->Get(index + kPriorityOffset).ToSmi().value();
+    if (priority > queued_priority) {
+      compilation_queue_->Set(index + kPriorityOffset,
+                              MaybeObject::FromSmi(Smi::FromInt(priority)));
+    }
+    return true;
+  }
+  return false;
 }
 
 void BaselineBatchCompiler::InstallBatch() {
@@ -318,14 +479,14 @@ void BaselineBatchCompiler::InstallBatch() {
 void BaselineBatchCompiler::EnsureQueueCapacity() {
   if (compilation_queue_.is_null()) {
     compilation_queue_ = isolate_->global_handles()->Create(
-        *isolate_->factory()->NewWeakFixedArray(kInitialQueueSize,
-                                                AllocationType::kOld));
+        *isolate_->factory()->NewWeakFixedArray(
+            kInitialQueueSize * kEntryLength, AllocationType::kOld));
     return;
   }
-  if (last_index_ >= compilation_queue_->length()) {
+  if ((last_index_ + 1) * kEntryLength > compilation_queue_->length()) {
     Handle<WeakFixedArray> new_queue =
-        isolate_->factory()->CopyWeakFixedArrayAndGrow(compilation_queue_,
-                                                       last_index_);
+        isolate_->factory()->CopyWeakFixedArrayAndGrow(
+            compilation_queue_, last_index_ * kEntryLength);
     GlobalHandles::Destroy(compilation_queue_.location());
     compilation_queue_ = isolate_->global_handles()->Create(*new_queue);
   }
@@ -340,9 +501,13 @@ void BaselineBatchCompiler::CompileBatch(Handle<JSFunction> function) {
                               &is_compiled_scope);
   }
   for (int i = 0; i < last_index_; i++) {
-    MaybeObject maybe_sfi = compilation_queue_->Get(i);
+    int index = i * kEntryLength;
+    MaybeObject maybe_sfi = compilation_queue_->Get(index + kSharedOffset);
     MaybeCompileFunction(maybe_sfi);
-    compilation_queue_->Set(i, HeapObjectReference::ClearedValue(isolate_));
+    for (int j = 0; j < kEntryLength; j++) {
+      compilation_queue_->Set(index + j,
+                              HeapObjectReference::ClearedValue(isolate_));
+    }
   }
   ClearBatch();
 }
@@ -21,6 +21,12 @@ class BaselineBatchCompiler {
  public:
   static const int kInitialQueueSize = 32;
 
+  // Each entry of the compilation queue is a weak reference to the
+  // SharedFunctionInfo followed by its priority as a Smi. The priority is the
+  // invocation count of the function when it was last enqueued; hotter
+  // functions are compiled first when a batch is compiled concurrently.
+  enum QueueEntry { kSharedOffset, kPriorityOffset, kEntryLength };
+
   explicit BaselineBatchCompiler(Isolate* isolate);
   ~BaselineBatchCompiler();
   // Enqueues SharedFunctionInfo of |function| for compilation.
@@ -36,8 +42,12 @@ class BaselineBatchCompiler {
   // function, growing the queue if necessary.
   void EnsureQueueCapacity();
 
-  // Enqueues SharedFunctionInfo.
-  void Enqueue(Handle<SharedFunctionInfo> shared);
+  // Enqueues SharedFunctionInfo with the given priority.
+  void Enqueue(Handle<SharedFunctionInfo> shared, int priority);
+
+  // If |shared| is already in the current batch, raises its priority to at
+  // least |priority| and returns true.
+  bool UpdateQueuedPriority(SharedFunctionInfo shared, int priority);
 
   // Returns true if the current batch exceeds the threshold and should be
   // compiled.
@@ -59,7 +69,7 @@ class BaselineBatchCompiler {
   // current batch.
   Handle<WeakFixedArray> compilation_queue_;
 
-  // Last index set in compilation_queue_;
+  // Number of entries in compilation_queue_.
   int last_index_;
 
   // Estimated insturction size of current batch.
@@ -4,6 +4,8 @@
 
 #include "src/bigint/bigint-internal.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace bigint {
 
@@ -18,7 +20,12 @@ bool kAdvancedAlgorithmsEnabledInLibrary = false;
 
 ProcessorImpl::ProcessorImpl(Platform* platform) : platform_(platform) {}
 
-ProcessorImpl::~ProcessorImpl() { delete platform_; }
+ProcessorImpl::ProcessorImpl(ProcessorImpl* parent)
+    : platform_(parent->platform_), parent_(parent) {}
+
+ProcessorImpl::~ProcessorImpl() {
+  if (parent_ == nullptr) delete platform_;
+}
 
 Status ProcessorImpl::get_and_clear_status() {
   Status result = status_;
@@ -26,6 +33,11 @@ Status ProcessorImpl::get_and_clear_status() {
   return result;
 }
 
+int ProcessorImpl::ParallelTaskCount(int length, int threshold) {
+  if (parent_ != nullptr || length < threshold) return 1;
+  return std::min(platform_->MaxParallelism(), kMaxParallelTasks);
+}
+
 Processor* Processor::New(Platform* platform) {
   ProcessorImpl* impl = new ProcessorImpl(platform);
   return static_cast<Processor*>(impl);
@@ -5,6 +5,7 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
 
 #include "src/bigint/bigint.h"
@@ -16,6 +17,11 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Total operand lengths above which multiplications use multiple threads,
+// if the platform supports that.
+constexpr int kToomParallelThreshold = 2000;
+constexpr int kFftParallelThreshold = 5000;
+constexpr int kMaxParallelTasks = 16;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
@@ -29,6 +35,10 @@ class ProcessorImpl : public Processor {
   explicit ProcessorImpl(Platform* platform);
   ~ProcessorImpl();
 
+  // Creates a processor for a part of {parent}'s work, which uses the same
+  // platform but never splits its own work further.
+  explicit ProcessorImpl(ProcessorImpl* parent);
+
   Status get_and_clear_status();
 
   void Multiply(RWDigits Z, Digits X, Digits Y);
@@ -92,12 +102,54 @@ class ProcessorImpl : public Processor {
     }
   }
 
+  // Returns the number of parts that an operation whose operands have
+  // {length} digits in total should be split into, or 1 if it should not use
+  // multiple threads.
+  int ParallelTaskCount(int length, int threshold);
+
+  // Calls {body(i, processor)} for every {i} in [0, count), possibly on
+  // different threads. Each {processor} is used by only one thread at a
+  // time, and an interrupt it observed is reported by {should_terminate()}
+  // afterwards.
+  template <typename Body>
+  void RunInParallel(int count, const Body& body);
+
  private:
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+  ProcessorImpl* parent_{nullptr};
 };
 
+template <typename Body>
+void ProcessorImpl::RunInParallel(int count, const Body& body) {
+  class Task : public Platform::ParallelTask {
+   public:
+    Task(ProcessorImpl* parent, const Body& body)
+        : parent_(parent), body_(body) {}
+
+    void Run(int index) override {
+      // Once any part was interrupted, the others can be skipped.
+      if (interrupted_.load(std::memory_order_relaxed)) return;
+      ProcessorImpl processor(parent_);
+      body_(index, &processor);
+      if (processor.should_terminate()) {
+        interrupted_.store(true, std::memory_order_relaxed);
+      }
+    }
+
+    bool interrupted() const { return interrupted_.load(); }
+
+   private:
+    ProcessorImpl* parent_;
+    const Body& body_;
+    std::atomic<bool> interrupted_{false};
+  };
+  Task task(this, body);
+  platform_->RunInParallel(&task, count);
+  if (task.interrupted()) status_ = Status::kInterrupted;
+}
+
 // These constants are primarily needed for Barrett division in div-barrett.cc,
 // and they're also needed by fast to-string conversion in tostring.cc.
 constexpr int DivideBarrettScratchSpace(int n) { return n + 2; }
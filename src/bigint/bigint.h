@@ -191,6 +191,27 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // A piece of work which can be split into independent parts.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+    // Performs the part with the given {index}. Different parts may run
+    // concurrently on different threads.
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want very large operations to use multiple threads, implement
+  // a Platform subclass that overrides these methods. {MaxParallelism}
+  // returns the number of threads (including the calling one) that
+  // {RunInParallel} can use. {RunInParallel} must call {task->Run(i)} once
+  // for every {i} in [0, count), and return when all of these calls have
+  // returned. {InterruptRequested} must be callable from all of these
+  // threads.
+  virtual int MaxParallelism() { return 1; }
+  virtual void RunInParallel(ParallelTask* task, int count) {
+    for (int i = 0; i < count; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
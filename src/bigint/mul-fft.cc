@@ -455,20 +455,33 @@ class FFTContainer {
   void NormalizeAndRecombine(int omega, int m, RWDigits Z, int chunk_size);
   void CounterWeightAndRecombine(int theta, int m, RWDigits Z, int chunk_size);
 
+  void ForwardFFT(int len, int omega);
   void FFT_ReturnShuffledThreadsafe(int start, int len, int omega,
                                     digit_t* temp);
   void FFT_Recurse(int start, int half, int omega, digit_t* temp);
+  void ForwardButterflies(int start, int half, int k_start, int k_end,
+                          int omega, digit_t* temp);
 
   void BackwardFFT(int start, int len, int omega);
   void BackwardFFT_Threadsafe(int start, int len, int omega, digit_t* temp);
+  void BackwardButterflies(int start, int half, int k_start, int k_end,
+                           int omega, digit_t* temp);
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
  private:
+  int ParallelTaskCount() {
+    return processor_->ParallelTaskCount(n_ * K_, kFftParallelThreshold);
+  }
+  // Runs {butterflies(start, half, k_start, k_end, temp)} for all butterflies
+  // of one FFT level with blocks of {len} parts, split into {tasks} parts.
+  template <typename Butterflies>
+  void RunLevelInParallel(int len, int tasks, const Butterflies& butterflies);
+
   const int n_;       // Number of parts.
   const int K_;       // Always length_ - 1.
   const int length_;  // Length of each part, in digits.
@@ -521,7 +534,7 @@ void FFTContainer::Start_Default(Digits X, int chunk_size, int theta,
   for (; i < n_; i++) {
     memset(part_[i], 0, part_length_in_bytes);
   }
-  FFT_ReturnShuffledThreadsafe(0, n_, omega, temp_);
+  ForwardFFT(n_, omega);
 }
 
 // This version of Start is optimized for the case where ~half of the
@@ -553,7 +566,7 @@ void FFTContainer::Start(Digits X, int chunk_size, int theta, int omega) {
     memset(part_[i], 0, part_length_in_bytes);
     memset(part_[i + nhalf], 0, part_length_in_bytes);
   }
-  FFT_Recurse(0, nhalf, omega, temp_);
+  if (nhalf > 1) ForwardFFT(nhalf, 2 * omega);
 }
 
 // Forward transformation.
@@ -564,15 +577,27 @@ void FFTContainer::FFT_ReturnShuffledThreadsafe(int start, int len, int omega,
                                                 digit_t* temp) {
   DCHECK((len & 1) == 0);  // {len} must be even.
   int half = len / 2;
-  SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
-          length_);
-  for (int k = 1; k < half; k++) {
+  ForwardButterflies(start, half, 0, half, omega, temp);
+  FFT_Recurse(start, half, omega, temp);
+}
+
+// Performs the butterflies {k_start} to {k_end}-1 of the level of the forward
+// FFT that combines parts {start} to {start}+{half}-1 with the {half} parts
+// following them.
+void FFTContainer::ForwardButterflies(int start, int half, int k_start,
+                                      int k_end, int omega, digit_t* temp) {
+  int k = k_start;
+  if (k == 0) {
+    SumDiff(part_[start], part_[start + half], part_[start],
+            part_[start + half], length_);
+    k++;
+  }
+  for (; k < k_end; k++) {
     SumDiff(part_[start + k], temp, part_[start + k], part_[start + half + k],
             length_);
     int w = omega * k;
     ShiftModFn(part_[start + half + k], temp, w, K_);
   }
-  FFT_Recurse(start, half, omega, temp);
 }
 
 // Recursive step of the above, factored out for additional callers.
@@ -583,11 +608,89 @@ void FFTContainer::FFT_Recurse(int start, int half, int omega, digit_t* temp) {
   }
 }
 
+template <typename Butterflies>
+void FFTContainer::RunLevelInParallel(int len, int tasks,
+                                      const Butterflies& butterflies) {
+  const int half = len / 2;
+  const int total = n_ / 2;  // Over all blocks.
+  Storage temp_storage(tasks * length_);
+  digit_t* temps = temp_storage.get();
+  processor_->RunInParallel(tasks, [&](int task, ProcessorImpl*) {
+    int begin = total * task / tasks;
+    int end = total * (task + 1) / tasks;
+    digit_t* temp = temps + task * length_;
+    while (begin < end) {
+      int k_start = begin % half;
+      int k_end = std::min(half, k_start + end - begin);
+      butterflies(begin / half * len, half, k_start, k_end, temp);
+      begin += k_end - k_start;
+    }
+  });
+}
+
+// Performs the forward FFT on all blocks of {len} parts, starting at the
+// level that uses {omega}. When using multiple threads, the first levels
+// split their butterflies among the threads, until there are enough blocks
+// to give each thread its own.
+void FFTContainer::ForwardFFT(int len, int omega) {
+  const int tasks = ParallelTaskCount();
+  if (tasks > 1) {
+    for (; n_ / len < tasks && len > 2; len /= 2, omega *= 2) {
+      RunLevelInParallel(len, tasks,
+                         [&](int start, int half, int k_start, int k_end,
+                             digit_t* temp) {
+                           ForwardButterflies(start, half, k_start, k_end,
+                                              omega, temp);
+                         });
+    }
+    const int blocks = n_ / len;
+    Storage temp_storage(blocks * length_);
+    digit_t* temps = temp_storage.get();
+    processor_->RunInParallel(blocks, [&](int block, ProcessorImpl*) {
+      FFT_ReturnShuffledThreadsafe(block * len, len, omega,
+                                   temps + block * length_);
+    });
+    return;
+  }
+  for (int start = 0; start < n_; start += len) {
+    FFT_ReturnShuffledThreadsafe(start, len, omega, temp_);
+  }
+}
+
 // Backward transformation.
 // We use the "DIT" aka "decimation in time" transform here, because it
 // turns bit-reversed input into normally sorted output.
+// When using multiple threads, the first levels give each thread whole
+// blocks, and the last levels split their butterflies among the threads.
 void FFTContainer::BackwardFFT(int start, int len, int omega) {
-  BackwardFFT_Threadsafe(start, len, omega, temp_);
+  const int tasks = ParallelTaskCount();
+  if (tasks == 1 || start != 0 || len != n_) {
+    return BackwardFFT_Threadsafe(start, len, omega, temp_);
+  }
+  // Blocks need at least 4 parts, see {BackwardFFT_Threadsafe}.
+  int block_len = len;
+  int block_omega = omega;
+  for (; n_ / block_len < tasks && block_len >= 8; block_len /= 2) {
+    block_omega *= 2;
+  }
+  const int blocks = n_ / block_len;
+  {
+    Storage temp_storage(blocks * length_);
+    digit_t* temps = temp_storage.get();
+    processor_->RunInParallel(blocks, [&](int block, ProcessorImpl*) {
+      BackwardFFT_Threadsafe(block * block_len, block_len, block_omega,
+                             temps + block * length_);
+    });
+  }
+  for (len = 2 * block_len, omega = block_omega / 2; len <= n_;
+       len *= 2, omega /= 2) {
+    RunLevelInParallel(len, tasks,
+                       [&](int block_start, int half, int k_start, int k_end,
+                           digit_t* temp) {
+                         BackwardButterflies(block_start, half, k_start,
+                                             k_end, omega, temp);
+                       });
+  }
 }
 
 void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
@@ -600,10 +703,20 @@ void FFTContainer::BackwardFFT_Threadsafe(int start, int len, int omega,
     BackwardFFT_Threadsafe(start, half, 2 * omega, temp);
     BackwardFFT_Threadsafe(start + half, half, 2 * omega, temp);
   }
-  SumDiff(part_[start], part_[start + half], part_[start], part_[start + half],
-          length_);
-  for (int k = 1; k < half; k++) {
-    int w = omega * (len - k);
+  BackwardButterflies(start, half, 0, half, omega, temp);
+}
+
+// Counterpart of {ForwardButterflies}.
+void FFTContainer::BackwardButterflies(int start, int half, int k_start,
+                                       int k_end, int omega, digit_t* temp) {
+  int k = k_start;
+  if (k == 0) {
+    SumDiff(part_[start], part_[start + half], part_[start],
+            part_[start + half], length_);
+    k++;
+  }
+  for (; k < k_end; k++) {
+    int w = omega * (2 * half - k);
     ShiftModFn(temp, part_[start + half + k], w, K_);
     SumDiff(part_[start + k], part_[start + half + k], part_[start + k], temp,
             length_);
@@ -723,7 +836,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
                                              int start, int end,
-                                             digit_t* temp) {
+                                             digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -734,11 +848,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -751,7 +865,21 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  // Every task must process complete pairs of parts, because each pair gets
+  // combined by the first level of the backwards FFT.
+  const int tasks = std::min(ParallelTaskCount(), n_ / 2);
+  if (tasks <= 1) {
+    return DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+  }
+  const int pairs = n_ / 2;
+  Storage temp_storage(tasks * 2 * length_);
+  digit_t* temps = temp_storage.get();
+  processor_->RunInParallel(tasks, [&](int task, ProcessorImpl* processor) {
+    int start = 2 * (pairs * task / tasks);
+    int end = 2 * (pairs * (task + 1) / tasks);
+    DoPointwiseMultiplication(other, start, end, temps + task * 2 * length_,
+                              processor);
+  });
 }
 
 }  // namespace
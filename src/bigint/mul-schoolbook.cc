@@ -12,6 +12,14 @@ namespace bigint {
 // Z := X * y, where y is a single digit.
 void ProcessorImpl::MultiplySingle(RWDigits Z, Digits X, digit_t y) {
   DCHECK(y != 0);
+#if V8_BIGINT_ASM_X64
+  if (HasMulxAdx()) {
+    Z[X.len()] = MultiplyDigitsMulx(RWDigits(Z, 0, X.len()), X, y);
+    AddWorkEstimate(X.len());
+    for (int i = X.len() + 1; i < Z.len(); i++) Z[i] = 0;
+    return;
+  }
+#endif
   digit_t carry = 0;
   digit_t high = 0;
   for (int i = 0; i < X.len(); i++) {
@@ -25,6 +33,24 @@ void ProcessorImpl::MultiplySingle(RWDigits Z, Digits X, digit_t y) {
   for (int i = X.len() + 1; i < Z.len(); i++) Z[i] = 0;
 }
 
+#if V8_BIGINT_ASM_X64
+namespace {
+
+// With the ADX kernel, the classic approach of adding X * Y[i] for each digit
+// of Y is faster than the loop over Z below.
+void MultiplySchoolbookAdx(RWDigits Z, Digits X, Digits Y,
+                           ProcessorImpl* processor) {
+  Z[X.len()] = MultiplyDigitsMulx(RWDigits(Z, 0, X.len()), X, Y[0]);
+  for (int i = 1; i < Y.len(); i++) {
+    Z[X.len() + i] = MultiplyAddDigitsAdx(RWDigits(Z, i, X.len()), X, Y[i]);
+    processor->AddWorkEstimate(X.len());
+  }
+  for (int i = X.len() + Y.len(); i < Z.len(); i++) Z[i] = 0;
+}
+
+}  // namespace
+#endif  // V8_BIGINT_ASM_X64
+
 #define BODY(min, max)                              \
   for (int j = min; j <= max; j++) {                \
     digit_t high;                                   \
@@ -52,6 +78,9 @@ void ProcessorImpl::MultiplySchoolbook(RWDigits Z, Digits X, Digits Y) {
   DCHECK(X.len() >= Y.len());
   DCHECK(Z.len() >= X.len() + Y.len());
   if (X.len() == 0 || Y.len() == 0) return Z.Clear();
+#if V8_BIGINT_ASM_X64
+  if (HasMulxAdx()) return MultiplySchoolbookAdx(Z, X, Y, this);
+#endif
   digit_t next, next_carry = 0, carry = 0;
   // Unrolled first iteration: it's trivial.
   Z[0] = digit_mul(X[0], Y[0], &next);
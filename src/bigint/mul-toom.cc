@@ -72,7 +72,13 @@ void ProcessorImpl::Toom3Main(RWDigits Z, Digits X, Digits Y) {
   // Temporary storage.
   int p_len = i + 1;      // For all px, qx below.
   int r_len = 2 * p_len;  // For all r_x, Rx below.
-  Storage temp_storage(4 * r_len);
+  // When the five pointwise multiplications run in parallel, all of their
+  // inputs and outputs must be live at the same time. We then don't re-use
+  // storage as described below, and instead put p_m2 and q_m2, r_m2, and
+  // r_inf into three additional chunks.
+  const bool parallel =
+      ParallelTaskCount(X.len() + Y.len(), kToomParallelThreshold) > 1;
+  Storage temp_storage((parallel ? 7 : 4) * r_len);
   // We will use the same variable names as the Wikipedia article, as much as
   // C++ lets us: our "p_m1" is their "p(-1)" etc. For consistency with other
   // algorithms, we use X and Y where Wikipedia uses m and n.
@@ -122,39 +128,58 @@ void ProcessorImpl::Toom3Main(RWDigits Z, Digits X, Digits Y) {
   MARK_INVALID(qo);
 
   // Phase 3a: Pointwise multiplication, steps 0, 1, m1.
-  Multiply(r_0, X0, Y0);
-  Multiply(r_1, p_1, q_1);
-  Multiply(r_m1, p_m1, q_m1);
+  if (!parallel) {
+    Multiply(r_0, X0, Y0);
+    Multiply(r_1, p_1, q_1);
+    Multiply(r_m1, p_m1, q_m1);
+  }
   bool r_m1_sign = p_m1_sign != q_m1_sign;
 
   // Phase 2b: Evaluation, steps m2 and inf.
   // p_m2 = (p_m1 + X2) * 2 - X0
-  RWDigits p_m2 = p_1;
-  MARK_INVALID(p_1);
+  RWDigits p_m2 = parallel ? RWDigits(t + 4 * r_len, p_len) : p_1;
+  if (!parallel) MARK_INVALID(p_1);
   bool p_m2_sign = AddSigned(p_m2, p_m1, p_m1_sign, X2, false);
   TimesTwo(p_m2);
   p_m2_sign = SubtractSigned(p_m2, p_m2, p_m2_sign, X0, false);
   // p_inf = X2
 
   // q_m2 = (q_m1 + Y2) * 2 - Y0
-  RWDigits q_m2 = q_1;
-  MARK_INVALID(q_1);
+  RWDigits q_m2 = parallel ? RWDigits(t + 4 * r_len + p_len, p_len) : q_1;
+  if (!parallel) MARK_INVALID(q_1);
   bool q_m2_sign = AddSigned(q_m2, q_m1, q_m1_sign, Y2, false);
   TimesTwo(q_m2);
   q_m2_sign = SubtractSigned(q_m2, q_m2, q_m2_sign, Y0, false);
   // q_inf = Y2
 
   // Phase 3b: Pointwise multiplication, steps m2 and inf.
-  RWDigits r_m2(t, r_len);
-  MARK_INVALID(p_m1);
-  MARK_INVALID(q_m1);
-  Multiply(r_m2, p_m2, q_m2);
+  RWDigits r_m2(parallel ? t + 5 * r_len : t, r_len);
+  RWDigits r_inf(parallel ? t + 6 * r_len : t + r_len, r_len);
   bool r_m2_sign = p_m2_sign != q_m2_sign;
-
-  RWDigits r_inf(t + r_len, r_len);
-  MARK_INVALID(p_m2);
-  MARK_INVALID(q_m2);
-  Multiply(r_inf, X2, Y2);
+  if (parallel) {
+    RunInParallel(5, [&](int index, ProcessorImpl* processor) {
+      switch (index) {
+        case 0:
+          return processor->Multiply(r_0, X0, Y0);
+        case 1:
+          return processor->Multiply(r_1, p_1, q_1);
+        case 2:
+          return processor->Multiply(r_m1, p_m1, q_m1);
+        case 3:
+          return processor->Multiply(r_m2, p_m2, q_m2);
+        default:
+          return processor->Multiply(r_inf, X2, Y2);
+      }
+    });
+    if (should_terminate()) return;
+  } else {
+    MARK_INVALID(p_m1);
+    MARK_INVALID(q_m1);
+    Multiply(r_m2, p_m2, q_m2);
+    MARK_INVALID(p_m2);
+    MARK_INVALID(q_m2);
+    Multiply(r_inf, X2, Y2);
+  }
 
   // Phase 4: Interpolation.
   Digits R0 = r_0;
@@ -4,20 +4,207 @@
 
 #include "src/bigint/vector-arithmetic.h"
 
+#if V8_BIGINT_ASM_X64
+#include <cpuid.h>
+
+#include <atomic>
+#endif
+
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/digit-arithmetic.h"
 
 namespace v8 {
 namespace bigint {
 
+namespace {
+
+// The kernels below process blocks of four digits, and may be given digits
+// arrays which are only 4-byte aligned. Like the portable loops, they finish
+// reading X[i] and Y[i] before writing Z[i], so Z may alias X or Y.
+
+#if V8_BIGINT_ASM_X64
+
+// Z := X + Y + carry for {blocks} * 4 digits. Returns the carry.
+digit_t AddBlocks(digit_t* z, const digit_t* x, const digit_t* y, int blocks,
+                  digit_t carry) {
+  digit_t t;
+  __asm__(
+      // Moves {carry} into the carry flag.
+      "addq $-1, %[carry]\n"
+      "1:\n\t"
+      "movq (%[x]), %[t]\n\t"
+      "adcq (%[y]), %[t]\n\t"
+      "movq %[t], (%[z])\n\t"
+      "movq 8(%[x]), %[t]\n\t"
+      "adcq 8(%[y]), %[t]\n\t"
+      "movq %[t], 8(%[z])\n\t"
+      "movq 16(%[x]), %[t]\n\t"
+      "adcq 16(%[y]), %[t]\n\t"
+      "movq %[t], 16(%[z])\n\t"
+      "movq 24(%[x]), %[t]\n\t"
+      "adcq 24(%[y]), %[t]\n\t"
+      "movq %[t], 24(%[z])\n\t"
+      "leaq 32(%[x]), %[x]\n\t"
+      "leaq 32(%[y]), %[y]\n\t"
+      "leaq 32(%[z]), %[z]\n\t"
+      // {dec} leaves the carry flag alone.
+      "decl %[blocks]\n\t"
+      "jnz 1b\n\t"
+      "movl $0, %k[carry]\n\t"
+      "setc %b[carry]"
+      : [carry] "+r"(carry), [t] "=&r"(t), [x] "+r"(x), [y] "+r"(y),
+        [z] "+r"(z), [blocks] "+r"(blocks)
+      :
+      : "cc", "memory");
+  return carry;
+}
+
+// Z := X - Y - borrow for {blocks} * 4 digits. Returns the borrow.
+digit_t SubtractBlocks(digit_t* z, const digit_t* x, const digit_t* y,
+                       int blocks, digit_t borrow) {
+  digit_t t;
+  __asm__(
+      // Moves {borrow} into the carry flag.
+      "addq $-1, %[borrow]\n"
+      "1:\n\t"
+      "movq (%[x]), %[t]\n\t"
+      "sbbq (%[y]), %[t]\n\t"
+      "movq %[t], (%[z])\n\t"
+      "movq 8(%[x]), %[t]\n\t"
+      "sbbq 8(%[y]), %[t]\n\t"
+      "movq %[t], 8(%[z])\n\t"
+      "movq 16(%[x]), %[t]\n\t"
+      "sbbq 16(%[y]), %[t]\n\t"
+      "movq %[t], 16(%[z])\n\t"
+      "movq 24(%[x]), %[t]\n\t"
+      "sbbq 24(%[y]), %[t]\n\t"
+      "movq %[t], 24(%[z])\n\t"
+      "leaq 32(%[x]), %[x]\n\t"
+      "leaq 32(%[y]), %[y]\n\t"
+      "leaq 32(%[z]), %[z]\n\t"
+      "decl %[blocks]\n\t"
+      "jnz 1b\n\t"
+      "movl $0, %k[borrow]\n\t"
+      "setc %b[borrow]"
+      : [borrow] "+r"(borrow), [t] "=&r"(t), [x] "+r"(x), [y] "+r"(y),
+        [z] "+r"(z), [blocks] "+r"(blocks)
+      :
+      : "cc", "memory");
+  return borrow;
+}
+
+#elif V8_BIGINT_ASM_ARM64
+
+// Z := X + Y + carry for {blocks} * 4 digits. Returns the carry.
+digit_t AddBlocks(digit_t* z, const digit_t* x, const digit_t* y, int blocks,
+                  digit_t carry) {
+  digit_t t0, t1;
+  __asm__(
+      // Moves {carry} into the carry flag.
+      "cmp %[carry], #1\n"
+      "1:\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "adcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "adcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "adcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "adcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      // Neither {sub} nor {cbnz} touch the flags.
+      "sub %w[blocks], %w[blocks], #1\n\t"
+      "cbnz %w[blocks], 1b\n\t"
+      "cset %[carry], cs"
+      : [carry] "+r"(carry), [t0] "=&r"(t0), [t1] "=&r"(t1), [x] "+r"(x),
+        [y] "+r"(y), [z] "+r"(z), [blocks] "+r"(blocks)
+      :
+      : "cc", "memory");
+  return carry;
+}
+
+// Z := X - Y - borrow for {blocks} * 4 digits. Returns the borrow.
+digit_t SubtractBlocks(digit_t* z, const digit_t* x, const digit_t* y,
+                       int blocks, digit_t borrow) {
+  digit_t t0, t1;
+  __asm__(
+      // The carry flag is the inverted borrow: set it iff {borrow} == 0.
+      "cmp xzr, %[borrow]\n"
+      "1:\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "sbcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "sbcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "sbcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "ldr %[t0], [%[x]], #8\n\t"
+      "ldr %[t1], [%[y]], #8\n\t"
+      "sbcs %[t0], %[t0], %[t1]\n\t"
+      "str %[t0], [%[z]], #8\n\t"
+      "sub %w[blocks], %w[blocks], #1\n\t"
+      "cbnz %w[blocks], 1b\n\t"
+      "cset %[borrow], cc"
+      : [borrow] "+r"(borrow), [t0] "=&r"(t0), [t1] "=&r"(t1), [x] "+r"(x),
+        [y] "+r"(y), [z] "+r"(z), [blocks] "+r"(blocks)
+      :
+      : "cc", "memory");
+  return borrow;
+}
+
+#endif  // V8_BIGINT_ASM_ARM64
+
+// Z[i] := X[i] + Y[i] + carry for i in [0, n). Returns the carry.
+inline digit_t AddDigits(RWDigits Z, Digits X, Digits Y, int n,
+                         digit_t carry) {
+  int i = 0;
+#if V8_BIGINT_ASM_X64 || V8_BIGINT_ASM_ARM64
+  if (n >= 4) {
+    carry = AddBlocks(Z.digits(), X.digits(), Y.digits(), n / 4, carry);
+    i = n & ~3;
+  }
+#endif
+  for (; i < n; i++) {
+    Z[i] = digit_add3(X[i], Y[i], carry, &carry);
+  }
+  return carry;
+}
+
+// Z[i] := X[i] - Y[i] - borrow for i in [0, n). Returns the borrow.
+inline digit_t SubtractDigits(RWDigits Z, Digits X, Digits Y, int n,
+                              digit_t borrow) {
+  int i = 0;
+#if V8_BIGINT_ASM_X64 || V8_BIGINT_ASM_ARM64
+  if (n >= 4) {
+    borrow = SubtractBlocks(Z.digits(), X.digits(), Y.digits(), n / 4, borrow);
+    i = n & ~3;
+  }
+#endif
+  for (; i < n; i++) {
+    Z[i] = digit_sub2(X[i], Y[i], borrow, &borrow);
+  }
+  return borrow;
+}
+
+}  // namespace
+
 digit_t AddAndReturnOverflow(RWDigits Z, Digits X) {
   X.Normalize();
   if (X.len() == 0) return 0;
-  digit_t carry = 0;
-  int i = 0;
-  for (; i < X.len(); i++) {
-    Z[i] = digit_add3(Z[i], X[i], carry, &carry);
-  }
+  digit_t carry = AddDigits(Z, Z, X, X.len(), 0);
+  int i = X.len();
   for (; i < Z.len() && carry != 0; i++) {
     Z[i] = digit_add2(Z[i], carry, &carry);
   }
@@ -27,11 +214,8 @@ digit_t AddAndReturnOverflow(RWDigits Z, Digits X) {
 digit_t SubAndReturnBorrow(RWDigits Z, Digits X) {
   X.Normalize();
   if (X.len() == 0) return 0;
-  digit_t borrow = 0;
-  int i = 0;
-  for (; i < X.len(); i++) {
-    Z[i] = digit_sub2(Z[i], X[i], borrow, &borrow);
-  }
+  digit_t borrow = SubtractDigits(Z, Z, X, X.len(), 0);
+  int i = X.len();
   for (; i < Z.len() && borrow != 0; i++) {
     Z[i] = digit_sub(Z[i], borrow, &borrow);
   }
@@ -42,11 +226,8 @@ void Add(RWDigits Z, Digits X, Digits Y) {
   if (X.len() < Y.len()) {
     return Add(Z, Y, X);
   }
-  int i = 0;
-  digit_t carry = 0;
-  for (; i < Y.len(); i++) {
-    Z[i] = digit_add3(X[i], Y[i], carry, &carry);
-  }
+  digit_t carry = AddDigits(Z, X, Y, Y.len(), 0);
+  int i = Y.len();
   for (; i < X.len(); i++) {
     Z[i] = digit_add2(X[i], carry, &carry);
   }
@@ -60,11 +241,8 @@ void Subtract(RWDigits Z, Digits X, Digits Y) {
   X.Normalize();
   Y.Normalize();
   DCHECK(X.len() >= Y.len());
-  int i = 0;
-  digit_t borrow = 0;
-  for (; i < Y.len(); i++) {
-    Z[i] = digit_sub2(X[i], Y[i], borrow, &borrow);
-  }
+  digit_t borrow = SubtractDigits(Z, X, Y, Y.len(), 0);
+  int i = Y.len();
   for (; i < X.len(); i++) {
     Z[i] = digit_sub(X[i], borrow, &borrow);
   }
@@ -74,20 +252,12 @@ void Subtract(RWDigits Z, Digits X, Digits Y) {
 
 digit_t AddAndReturnCarry(RWDigits Z, Digits X, Digits Y) {
   DCHECK(Z.len() >= Y.len() && X.len() >= Y.len());
-  digit_t carry = 0;
-  for (int i = 0; i < Y.len(); i++) {
-    Z[i] = digit_add3(X[i], Y[i], carry, &carry);
-  }
-  return carry;
+  return AddDigits(Z, X, Y, Y.len(), 0);
 }
 
 digit_t SubtractAndReturnBorrow(RWDigits Z, Digits X, Digits Y) {
   DCHECK(Z.len() >= Y.len() && X.len() >= Y.len());
-  digit_t borrow = 0;
-  for (int i = 0; i < Y.len(); i++) {
-    Z[i] = digit_sub2(X[i], Y[i], borrow, &borrow);
-  }
-  return borrow;
+  return SubtractDigits(Z, X, Y, Y.len(), 0);
 }
 
 bool AddSigned(RWDigits Z, Digits X, bool x_negative, Digits Y,
@@ -135,5 +305,127 @@ void SubtractOne(RWDigits Z, Digits X) {
   for (; i < Z.len(); i++) Z[i] = 0;
 }
 
+#if V8_BIGINT_ASM_X64
+
+bool HasMulxAdx() {
+  // 0: not checked yet, 1: unsupported, 2: supported. Racing threads compute
+  // the same result.
+  static std::atomic<int> state{0};
+  int result = state.load(std::memory_order_relaxed);
+  if (result == 0) {
+    constexpr unsigned kBmi2 = 1u << 8;
+    constexpr unsigned kAdx = 1u << 19;
+    unsigned eax, ebx, ecx, edx;
+    bool supported = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+                     (ebx & (kBmi2 | kAdx)) == (kBmi2 | kAdx);
+    result = supported ? 2 : 1;
+    state.store(result, std::memory_order_relaxed);
+  }
+  return result == 2;
+}
+
+digit_t MultiplyDigitsMulx(RWDigits Z, Digits X, digit_t y) {
+  DCHECK(Z.len() == X.len());
+  digit_t carry = 0;
+  int blocks = X.len() / 4;
+  if (blocks > 0) {
+    digit_t* z = Z.digits();
+    const digit_t* x = X.digits();
+    digit_t low, high;
+    __asm__(
+        // Clears the carry flag.
+        "xorl %k[carry], %k[carry]\n"
+        "1:\n\t"
+        "mulxq (%[x]), %[low], %[high]\n\t"
+        "adcq %[carry], %[low]\n\t"
+        "movq %[low], (%[z])\n\t"
+        "mulxq 8(%[x]), %[low], %[carry]\n\t"
+        "adcq %[high], %[low]\n\t"
+        "movq %[low], 8(%[z])\n\t"
+        "mulxq 16(%[x]), %[low], %[high]\n\t"
+        "adcq %[carry], %[low]\n\t"
+        "movq %[low], 16(%[z])\n\t"
+        "mulxq 24(%[x]), %[low], %[carry]\n\t"
+        "adcq %[high], %[low]\n\t"
+        "movq %[low], 24(%[z])\n\t"
+        "leaq 32(%[x]), %[x]\n\t"
+        "leaq 32(%[z]), %[z]\n\t"
+        "decl %[blocks]\n\t"
+        "jnz 1b\n\t"
+        "adcq $0, %[carry]"
+        : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+          [x] "+r"(x), [z] "+r"(z), [blocks] "+r"(blocks)
+        : "d"(y)
+        : "cc", "memory");
+  }
+  for (int i = X.len() & ~3; i < X.len(); i++) {
+    digit_t high;
+    digit_t low = digit_mul(X[i], y, &high);
+    Z[i] = digit_add2(low, carry, &carry);
+    carry += high;
+  }
+  return carry;
+}
+
+digit_t MultiplyAddDigitsAdx(RWDigits Z, Digits X, digit_t y) {
+  DCHECK(Z.len() == X.len());
+  digit_t carry = 0;
+  // {jrcxz} needs the counter in rcx.
+  uintptr_t blocks = X.len() / 4;
+  if (blocks > 0) {
+    digit_t* z = Z.digits();
+    const digit_t* x = X.digits();
+    digit_t low, high;
+    // Two independent carry chains: {adcx} adds the digits of Z using the
+    // carry flag, {adox} adds the high halves of the products using the
+    // overflow flag. Nothing else in the loop may touch these flags.
+    __asm__(
+        // Clears both flags.
+        "xorl %k[carry], %k[carry]\n"
+        "1:\n\t"
+        "mulxq (%[x]), %[low], %[high]\n\t"
+        "adcxq (%[z]), %[low]\n\t"
+        "adoxq %[carry], %[low]\n\t"
+        "movq %[low], (%[z])\n\t"
+        "mulxq 8(%[x]), %[low], %[carry]\n\t"
+        "adcxq 8(%[z]), %[low]\n\t"
+        "adoxq %[high], %[low]\n\t"
+        "movq %[low], 8(%[z])\n\t"
+        "mulxq 16(%[x]), %[low], %[high]\n\t"
+        "adcxq 16(%[z]), %[low]\n\t"
+        "adoxq %[carry], %[low]\n\t"
+        "movq %[low], 16(%[z])\n\t"
+        "mulxq 24(%[x]), %[low], %[carry]\n\t"
+        "adcxq 24(%[z]), %[low]\n\t"
+        "adoxq %[high], %[low]\n\t"
+        "movq %[low], 24(%[z])\n\t"
+        "leaq 32(%[x]), %[x]\n\t"
+        "leaq 32(%[z]), %[z]\n\t"
+        "leaq -1(%[blocks]), %[blocks]\n\t"
+        "jrcxz 2f\n\t"
+        "jmp 1b\n"
+        "2:\n\t"
+        // Adds both flags to the last high half.
+        "movl $0, %k[low]\n\t"
+        "adcxq %[low], %[carry]\n\t"
+        "adoxq %[low], %[carry]"
+        : [carry] "=&r"(carry), [low] "=&r"(low), [high] "=&r"(high),
+          [x] "+r"(x), [z] "+r"(z), [blocks] "+c"(blocks)
+        : "d"(y)
+        : "cc", "memory");
+  }
+  for (int i = X.len() & ~3; i < X.len(); i++) {
+    digit_t high;
+    digit_t low = digit_mul(X[i], y, &high);
+    low = digit_add2(low, carry, &carry);
+    high += carry;
+    Z[i] = digit_add2(Z[i], low, &carry);
+    carry += high;
+  }
+  return carry;
+}
+
+#endif  // V8_BIGINT_ASM_X64
+
 }  // namespace bigint
 }  // namespace v8
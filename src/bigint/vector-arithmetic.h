@@ -10,6 +10,21 @@
 #include "src/bigint/bigint.h"
 #include "src/bigint/digit-arithmetic.h"
 
+// Hand-written kernels for the innermost loops need GCC-style inline assembly.
+// They are invisible to MemorySanitizer, so don't use them there.
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+#define V8_BIGINT_NO_ASM 1
+#endif
+#endif
+#if !V8_BIGINT_NO_ASM && (__GNUC__ || __clang__)
+#if __x86_64__
+#define V8_BIGINT_ASM_X64 1
+#elif __aarch64__
+#define V8_BIGINT_ASM_ARM64 1
+#endif
+#endif
+
 namespace v8 {
 namespace bigint {
 
@@ -44,6 +59,16 @@ inline void Subtract(RWDigits X, digit_t y) {
 digit_t AddAndReturnCarry(RWDigits Z, Digits X, Digits Y);
 digit_t SubtractAndReturnBorrow(RWDigits Z, Digits X, Digits Y);
 
+#if V8_BIGINT_ASM_X64
+// Returns true if the CPU supports the BMI2 and ADX extensions, which the
+// following two functions require.
+bool HasMulxAdx();
+// Z := X * y, for Z.len() == X.len(). Returns the high digit of the product.
+digit_t MultiplyDigitsMulx(RWDigits Z, Digits X, digit_t y);
+// Z += X * y, for Z.len() == X.len(). Returns the carry digit.
+digit_t MultiplyAddDigitsAdx(RWDigits Z, Digits X, digit_t y);
+#endif  // V8_BIGINT_ASM_X64
+
 inline bool IsDigitNormalized(Digits X) { return X.len() == 0 || X.msd() != 0; }
 inline bool IsBitNormalized(Digits X) {
   return (X.msd() >> (kDigitBits - 1)) == 1;
@@ -609,6 +609,39 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
     Return(value);
     BIND(&done);
   }
+
+ private:
+  // Below this number of remaining elements, searching in CSA is cheaper than
+  // calling out to a vectorized C function.
+  static constexpr int kMinLengthForCSearch = 16;
+
+  void GotoIfShortSearch(TNode<IntPtrT> array_length, TNode<IntPtrT> from_index,
+                         Label* if_short) {
+    GotoIf(IntPtrLessThan(IntPtrSub(array_length, from_index),
+                          IntPtrConstant(kMinLengthForCSearch)),
+           if_short);
+  }
+
+  // Searches {elements} from {from_index} with one of the fast C functions in
+  // src/objects/simd.h, and returns the result of the {variant}.
+  TNode<Object> CallCSearch(SearchVariant variant, ExternalReference function,
+                            TNode<FixedArrayBase> elements,
+                            TNode<Object> search_element,
+                            TNode<IntPtrT> array_length,
+                            TNode<IntPtrT> from_index) {
+    TNode<IntPtrT> result = UncheckedCast<IntPtrT>(CallCFunction(
+        ExternalConstant(function), MachineType::IntPtr(),
+        std::make_pair(MachineType::AnyTagged(), elements),
+        std::make_pair(MachineType::UintPtr(), array_length),
+        std::make_pair(MachineType::UintPtr(), from_index),
+        std::make_pair(MachineType::AnyTagged(), search_element)));
+    if (variant == kIncludes) {
+      return SelectBooleanConstant(
+          IntPtrGreaterThanOrEqual(result, IntPtrConstant(0)));
+    }
+    // Not found is -1, which is a Smi as well.
+    return SmiTag(result);
+  }
 };
 
 void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
@@ -681,7 +714,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   GotoIf(IntPtrGreaterThanOrEqual(index_var.value(), array_length_untagged),
          &return_not_found);
 
-  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this);
+  Label if_smis(this), if_smiorobjects(this), if_packed_doubles(this),
+      if_holey_doubles(this);
 
   TNode<Int32T> elements_kind = LoadElementsKind(array);
   TNode<FixedArrayBase> elements = LoadElements(array);
@@ -689,6 +723,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   STATIC_ASSERT(HOLEY_SMI_ELEMENTS == 1);
   STATIC_ASSERT(PACKED_ELEMENTS == 2);
   STATIC_ASSERT(HOLEY_ELEMENTS == 3);
+  GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_SMI_ELEMENTS),
+         &if_smis);
   GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_ELEMENTS),
          &if_smiorobjects);
   GotoIf(
@@ -701,6 +737,17 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
          &if_smiorobjects);
   Goto(&return_not_found);
 
+  BIND(&if_smis);
+  {
+    // A Smi is only equal to an identical Smi, and never to a hole.
+    GotoIfNot(TaggedIsSmi(search_element), &if_smiorobjects);
+    GotoIfShortSearch(array_length_untagged, index_var.value(),
+                      &if_smiorobjects);
+    args.PopAndReturn(CallCSearch(
+        variant, ExternalReference::array_indexof_includes_smi_or_object(),
+        elements, search_element, array_length_untagged, index_var.value()));
+  }
+
   BIND(&if_smiorobjects);
   {
     Callable callable = (variant == kIncludes)
@@ -787,7 +834,13 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
   TNode<Uint16T> search_type = LoadMapInstanceType(map);
   GotoIf(IsStringInstanceType(search_type), &string_loop);
   GotoIf(IsBigIntInstanceType(search_type), &bigint_loop);
-  Goto(&ident_loop);
+  {
+    // Other search elements are only equal to identical elements.
+    GotoIfShortSearch(array_length_untagged, index_var.value(), &ident_loop);
+    Return(CallCSearch(
+        variant, ExternalReference::array_indexof_includes_smi_or_object(),
+        elements, search_element, array_length_untagged, index_var.value()));
+  }
 
   BIND(&ident_loop);
   {
@@ -939,21 +992,41 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
       hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      return_not_found(this), search_number(this), search_in_csa(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&search_number);
 
   BIND(&search_notnan);
   GotoIfNot(IsHeapNumber(CAST(search_element)), &return_not_found);
 
   search_num = LoadHeapNumberValue(CAST(search_element));
 
-  Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  Label* nan_handling =
+      variant == kIncludes ? &search_number : &return_not_found;
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &search_number);
+
+  BIND(&search_number);
+  {
+    // There are no holes, so the C function's NaN search matches
+    // SameValueZero.
+    GotoIfShortSearch(array_length_untagged, index_var.value(),
+                      &search_in_csa);
+    Return(CallCSearch(variant,
+                       ExternalReference::array_indexof_includes_double(),
+                       elements, search_element, array_length_untagged,
+                       index_var.value()));
+  }
+
+  BIND(&search_in_csa);
+  if (variant == kIncludes) {
+    BranchIfFloat64IsNaN(search_num.value(), &nan_loop, &not_nan_loop);
+  } else {
+    Goto(&not_nan_loop);
+  }
 
   BIND(&not_nan_loop);
   {
@@ -1007,13 +1080,13 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
       hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      return_not_found(this), search_not_nan(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&search_not_nan);
 
   BIND(&search_notnan);
   if (variant == kIncludes) {
@@ -1024,7 +1097,18 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &search_not_nan);
+
+  BIND(&search_not_nan);
+  {
+    // Holes are NaNs, which never compare equal to other Numbers.
+    GotoIfShortSearch(array_length_untagged, index_var.value(),
+                      &not_nan_loop);
+    Return(CallCSearch(variant,
+                       ExternalReference::array_indexof_includes_double(),
+                       elements, search_element, array_length_untagged,
+                       index_var.value()));
+  }
 
   BIND(&not_nan_loop);
   {
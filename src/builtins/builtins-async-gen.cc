@@ -29,6 +29,15 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
+  const TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+
+  // Without PromiseHooks and debugging, nothing observes the wrapper promise
+  // for a primitive {value}, or the reject handler for an already fulfilled
+  // {value}. In these cases we queue the reaction job for the resolve handler
+  // right away, without allocating the promise and the reject handler.
+  Label if_fast_primitive(this), if_fast_fulfilled(this), if_general(this),
+      if_await_done(this);
+  TVARIABLE(Object, var_result, UndefinedConstant());
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
@@ -37,11 +46,12 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   {
     TVARIABLE(Object, var_value, value);
     Label if_slow_path(this, Label::kDeferred), if_done(this),
-        if_slow_constructor(this, Label::kDeferred);
-    GotoIf(TaggedIsSmi(value), &if_slow_path);
+        if_slow_constructor(this, Label::kDeferred), if_not_promise(this),
+        if_primitive(this);
+    GotoIf(TaggedIsSmi(value), &if_primitive);
     TNode<HeapObject> value_object = CAST(value);
     const TNode<Map> value_map = LoadMap(value_object);
-    GotoIfNot(IsJSPromiseMap(value_map), &if_slow_path);
+    GotoIfNot(IsJSPromiseMap(value_map), &if_not_promise);
     // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
     // is the (initial) Promise.prototype and the @@species protector is
     // intact, as that guards the lookup path for "constructor" on
@@ -67,6 +77,13 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
              &if_slow_path);
     }
 
+    BIND(&if_not_promise);
+    Branch(IsJSReceiverMap(value_map), &if_slow_path, &if_primitive);
+
+    BIND(&if_primitive);
+    Branch(NeedsAnyPromiseHooks(promiseHookFlags), &if_slow_path,
+           &if_fast_primitive);
+
     BIND(&if_slow_path);
     {
       // We need to mark the {value} wrapper as having {outer_promise}
@@ -80,73 +97,117 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
 
     BIND(&if_done);
     value = var_value.value();
+    GotoIf(NeedsAnyPromiseHooks(promiseHookFlags), &if_general);
+    Branch(PromiseIsFulfilled(CAST(value)), &if_fast_fulfilled, &if_general);
   }
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  BIND(&if_fast_primitive);
   {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
+    TNode<JSFunction> on_resolve = AllocateAwaitResolveClosure(
+        native_context, generator, on_resolve_sfi);
+    EnqueueAwaitFulfillReactionJob(native_context, value, on_resolve);
+    Goto(&if_await_done);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
+  BIND(&if_fast_fulfilled);
+  {
+    TNode<JSFunction> on_resolve = AllocateAwaitResolveClosure(
+        native_context, generator, on_resolve_sfi);
+    var_result =
+        CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                    on_resolve, UndefinedConstant(), UndefinedConstant());
+    Goto(&if_await_done);
+  }
 
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
-
-  // Deal with PromiseHooks and debug support in the runtime. This
-  // also allocates the throwaway promise, which is only needed in
-  // case of PromiseHooks or debugging.
-  TVARIABLE(Object, var_throwaway, UndefinedConstant());
-  Label if_instrumentation(this, Label::kDeferred),
-      if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
-  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
-             promiseHookFlags),
-         &if_instrumentation);
+  BIND(&if_general);
+  {
+    TNode<Context> closure_context =
+        AllocateAwaitContext(native_context, generator);
+
+    // Allocate and initialize resolve handler
+    TNode<HeapObject> on_resolve =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_resolve,
+                            on_resolve_sfi);
+
+    // Allocate and initialize reject handler
+    TNode<HeapObject> on_reject =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_reject,
+                            on_reject_sfi);
+
+    // Deal with PromiseHooks and debug support in the runtime. This
+    // also allocates the throwaway promise, which is only needed in
+    // case of PromiseHooks or debugging.
+    TVARIABLE(Object, var_throwaway, UndefinedConstant());
+    Label if_instrumentation(this, Label::kDeferred),
+        if_instrumentation_done(this);
+    GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
+               promiseHookFlags),
+           &if_instrumentation);
 #ifdef V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
-  // This call to NewJSPromise is to keep behaviour parity with what happens
-  // in Runtime::kDebugAsyncFunctionSuspended below if native hooks are set.
-  // It creates a throwaway promise that will trigger an init event and get
-  // passed into Builtin::kPerformPromiseThen below.
-  GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
-            &if_instrumentation_done);
-  var_throwaway = NewJSPromise(context, value);
+    // This call to NewJSPromise is to keep behaviour parity with what happens
+    // in Runtime::kDebugAsyncFunctionSuspended below if native hooks are set.
+    // It creates a throwaway promise that will trigger an init event and get
+    // passed into Builtin::kPerformPromiseThen below.
+    GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
+              &if_instrumentation_done);
+    var_throwaway = NewJSPromise(context, value);
 #endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
-  Goto(&if_instrumentation_done);
-  BIND(&if_instrumentation);
-  {
-    var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
-                                native_context, value, outer_promise, on_reject,
-                                generator, is_predicted_as_caught);
     Goto(&if_instrumentation_done);
+    BIND(&if_instrumentation);
+    {
+      var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
+                                  native_context, value, outer_promise,
+                                  on_reject, generator, is_predicted_as_caught);
+      Goto(&if_instrumentation_done);
+    }
+    BIND(&if_instrumentation_done);
+
+    var_result =
+        CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                    on_resolve, on_reject, var_throwaway.value());
+    Goto(&if_await_done);
   }
-  BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  BIND(&if_await_done);
+  return var_result.value();
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitContext(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator) {
+  static const int kClosureContextSize =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  TNode<Context> closure_context =
+      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(
+      closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+  return closure_context;
+}
+
+TNode<JSFunction> AsyncBuiltinsAssembler::AllocateAwaitResolveClosure(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+    TNode<SharedFunctionInfo> on_resolve_sfi) {
+  TNode<Context> closure_context =
+      AllocateAwaitContext(native_context, generator);
+  TNode<HeapObject> on_resolve =
+      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+  InitializeNativeClosure(closure_context, native_context, on_resolve,
+                          on_resolve_sfi);
+  return UncheckedCast<JSFunction>(on_resolve);
 }
 
 void AsyncBuiltinsAssembler::InitializeNativeClosure(
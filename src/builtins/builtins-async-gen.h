@@ -42,6 +42,12 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                                         TNode<Oddball> done);
 
  private:
+  // Allocates the context of the await closures, which holds {generator}.
+  TNode<Context> AllocateAwaitContext(TNode<NativeContext> native_context,
+                                      TNode<JSGeneratorObject> generator);
+  TNode<JSFunction> AllocateAwaitResolveClosure(
+      TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+      TNode<SharedFunctionInfo> on_resolve_sfi);
   void InitializeNativeClosure(TNode<Context> context,
                                TNode<NativeContext> native_context,
                                TNode<HeapObject> function,
@@ -753,9 +753,33 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
       TVariable<IntPtrT>* entry_start_position, Label* entry_found,
       Label* not_found);
 
+  // The hash tag and the chain value of an OrderedHashTable entry, see
+  // OrderedHashTable::ChainValue.
+  template <typename CollectionType>
+  TNode<IntPtrT> HashTag(TNode<IntPtrT> hash);
+  template <typename CollectionType>
+  TNode<Smi> ChainValue(TNode<IntPtrT> next_entry, TNode<IntPtrT> hash);
+
   TNode<Word32T> ComputeUnseededHash(TNode<IntPtrT> key);
 };
 
+template <typename CollectionType>
+TNode<IntPtrT> CollectionsBuiltinsAssembler::HashTag(TNode<IntPtrT> hash) {
+  const TNode<Word32T> mixed = Int32Mul(
+      TruncateIntPtrToInt32(hash),
+      Int32Constant(static_cast<int32_t>(CollectionType::kHashTagMultiplier)));
+  return Signed(ChangeUint32ToWord(
+      Word32Shr(mixed, 32 - CollectionType::kHashTagBits)));
+}
+
+template <typename CollectionType>
+TNode<Smi> CollectionsBuiltinsAssembler::ChainValue(TNode<IntPtrT> next_entry,
+                                                    TNode<IntPtrT> hash) {
+  return SmiTag(WordOr(WordShl(HashTag<CollectionType>(hash),
+                               IntPtrConstant(CollectionType::kChainEntryBits)),
+                       IntPtrAdd(next_entry, IntPtrConstant(1))));
+}
+
 template <typename CollectionType>
 void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
     const TNode<CollectionType> table, const TNode<IntPtrT> hash,
@@ -770,6 +794,7 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
       WordAnd(hash, IntPtrSub(number_of_buckets, IntPtrConstant(1)));
   const TNode<IntPtrT> first_entry = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
       table, bucket, CollectionType::HashTableStartIndex() * kTaggedSize)));
+  const TNode<IntPtrT> hash_tag = HashTag<CollectionType>(hash);
 
   // Walk the bucket chain.
   TNode<IntPtrT> entry_start;
@@ -803,6 +828,16 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
                             IntPtrConstant(CollectionType::kEntrySize)),
                   number_of_buckets);
 
+    // Load the chain value of the entry, and only compare the key of the
+    // entry if its hash tag matches.
+    const TNode<IntPtrT> chain = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
+        table, entry_start,
+        (CollectionType::HashTableStartIndex() + CollectionType::kChainOffset) *
+            kTaggedSize)));
+    GotoIfNot(WordEqual(WordShr(chain, CollectionType::kChainEntryBits),
+                        hash_tag),
+              &continue_next_entry);
+
     // Load the key from the entry.
     const TNode<Object> candidate_key = UnsafeLoadFixedArrayElement(
         table, entry_start,
@@ -811,11 +846,10 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
     key_compare(candidate_key, &if_key_found, &continue_next_entry);
 
     BIND(&continue_next_entry);
-    // Load the index of the next entry in the bucket chain.
-    var_entry = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
-        table, entry_start,
-        (CollectionType::HashTableStartIndex() + CollectionType::kChainOffset) *
-            kTaggedSize)));
+    // Continue with the next entry in the bucket chain.
+    var_entry = IntPtrSub(
+        WordAnd(chain, IntPtrConstant(CollectionType::kChainEntryMask)),
+        IntPtrConstant(1));
 
     Goto(&loop);
   }
@@ -1737,7 +1771,8 @@ void CollectionsBuiltinsAssembler::StoreOrderedHashMapNewEntry(
       kTaggedSize * (OrderedHashMap::HashTableStartIndex() +
                      OrderedHashMap::kValueOffset));
   UnsafeStoreFixedArrayElement(
-      table, entry_start, bucket_entry,
+      table, entry_start,
+      ChainValue<OrderedHashMap>(SmiUntag(bucket_entry), hash),
       kTaggedSize * (OrderedHashMap::HashTableStartIndex() +
                      OrderedHashMap::kChainOffset));
 
@@ -1908,7 +1943,8 @@ void CollectionsBuiltinsAssembler::StoreOrderedHashSetNewEntry(
       table, entry_start, key, UPDATE_WRITE_BARRIER,
       kTaggedSize * OrderedHashSet::HashTableStartIndex());
   UnsafeStoreFixedArrayElement(
-      table, entry_start, bucket_entry,
+      table, entry_start,
+      ChainValue<OrderedHashSet>(SmiUntag(bucket_entry), hash),
       kTaggedSize * (OrderedHashSet::HashTableStartIndex() +
                      OrderedHashSet::kChainOffset));
 
@@ -156,6 +156,7 @@ DEF_UNOP(Negate_Baseline, Generate_NegateWithFeedback)
     TVARIABLE(Smi, var_type_feedback);                                         \
     TNode<Oddball> result = RelationalComparison(Operation::k##Name, lhs, rhs, \
                                                  context, &var_type_feedback); \
+    CombineCompareOutcomeFeedback(&var_type_feedback, result);                 \
     UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);          \
                                                                                \
     Return(result);                                                            \
@@ -176,6 +177,7 @@ DEF_COMPARE(GreaterThanOrEqual)
     TNode<Oddball> result = RelationalComparison(                         \
         Operation::k##Name, lhs, rhs,                                     \
         [&]() { return LoadContextFromBaseline(); }, &var_type_feedback); \
+    CombineCompareOutcomeFeedback(&var_type_feedback, result);            \
     auto feedback_vector = LoadFeedbackVectorFromBaseline();              \
     UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);     \
                                                                           \
@@ -197,6 +199,7 @@ TF_BUILTIN(Equal_WithFeedback, CodeStubAssembler) {
   TVARIABLE(Smi, var_type_feedback);
   TNode<Oddball> result = Equal(
       lhs, rhs, [&]() { return context; }, &var_type_feedback);
+  CombineCompareOutcomeFeedback(&var_type_feedback, result);
   UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);
 
   Return(result);
@@ -210,6 +213,7 @@ TF_BUILTIN(StrictEqual_WithFeedback, CodeStubAssembler) {
 
   TVARIABLE(Smi, var_type_feedback);
   TNode<Oddball> result = StrictEqual(lhs, rhs, &var_type_feedback);
+  CombineCompareOutcomeFeedback(&var_type_feedback, result);
   UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);
 
   Return(result);
@@ -224,6 +228,7 @@ TF_BUILTIN(Equal_Baseline, CodeStubAssembler) {
   TNode<Oddball> result = Equal(
       lhs, rhs, [&]() { return LoadContextFromBaseline(); },
       &var_type_feedback);
+  CombineCompareOutcomeFeedback(&var_type_feedback, result);
   auto feedback_vector = LoadFeedbackVectorFromBaseline();
   UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);
 
@@ -237,6 +242,7 @@ TF_BUILTIN(StrictEqual_Baseline, CodeStubAssembler) {
 
   TVARIABLE(Smi, var_type_feedback);
   TNode<Oddball> result = StrictEqual(lhs, rhs, &var_type_feedback);
+  CombineCompareOutcomeFeedback(&var_type_feedback, result);
   auto feedback_vector = LoadFeedbackVectorFromBaseline();
   UpdateFeedback(var_type_feedback.value(), feedback_vector, slot);
 
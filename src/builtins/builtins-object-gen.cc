@@ -82,6 +82,14 @@ class ObjectEntriesValuesBuiltinsAssembler : public ObjectBuiltinsAssembler {
       Label* if_call_runtime_with_fast_path, Label* if_no_properties,
       CollectType collect_type);
 
+  // Allocates the [key, value] array of an entry.
+  TNode<JSArray> AllocateEntry(TNode<Map> array_map, TNode<Name> key,
+                               TNode<Object> value);
+
+  // Loads the field at an index of the enum cache's indices array.
+  TNode<Object> LoadFieldByEnumCacheIndex(TNode<JSObject> object,
+                                          TNode<Smi> encoded_index);
+
   TNode<JSArray> FinalizeValuesOrEntriesJSArray(
       TNode<Context> context, TNode<FixedArray> values_or_entries,
       TNode<IntPtrT> size, TNode<Map> array_map, Label* if_empty);
@@ -270,7 +278,40 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
     // Let desc be ? O.[[GetOwnProperty]](key).
     TNode<DescriptorArray> descriptors = LoadMapDescriptors(map);
     Label loop(this, {&var_descriptor_number, &var_result_index}),
-        after_loop(this), next_descriptor(this);
+        after_loop(this, &var_result_index), next_descriptor(this),
+        if_no_enum_indices(this);
+
+    // If the enum cache has field indices, all enumerable string-keyed
+    // properties are data fields. Read them through the indices, in the
+    // order of the enum cache keys, without decoding the descriptors.
+    TNode<EnumCache> enum_cache = LoadObjectField<EnumCache>(
+        descriptors, DescriptorArray::kEnumCacheOffset);
+    TNode<FixedArray> enum_indices =
+        LoadObjectField<FixedArray>(enum_cache, EnumCache::kIndicesOffset);
+    GotoIf(IntPtrLessThan(LoadAndUntagFixedArrayBaseLength(enum_indices),
+                          object_enum_length),
+           &if_no_enum_indices);
+    {
+      TNode<FixedArray> enum_keys =
+          LoadObjectField<FixedArray>(enum_cache, EnumCache::kKeysOffset);
+      BuildFastLoop<IntPtrT>(
+          IntPtrConstant(0), object_enum_length,
+          [&](TNode<IntPtrT> index) {
+            TNode<Object> value = LoadFieldByEnumCacheIndex(
+                object, CAST(LoadFixedArrayElement(enum_indices, index)));
+            if (collect_type == CollectType::kEntries) {
+              value = AllocateEntry(
+                  array_map, CAST(LoadFixedArrayElement(enum_keys, index)),
+                  value);
+            }
+            StoreFixedArrayElement(values_or_entries, index, value);
+          },
+          1, IndexAdvanceMode::kPost);
+      var_result_index = object_enum_length;
+      Goto(&after_loop);
+    }
+
+    BIND(&if_no_enum_indices);
     Branch(IntPtrEqual(var_descriptor_number.value(), object_enum_length),
            &after_loop, &loop);
 
@@ -315,15 +356,7 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
       TNode<Object> value = var_property_value.value();
 
       if (collect_type == CollectType::kEntries) {
-        // Let entry be CreateArrayFromList(« key, value »).
-        TNode<JSArray> array;
-        TNode<FixedArrayBase> elements;
-        std::tie(array, elements) = AllocateUninitializedJSArrayWithElements(
-            PACKED_ELEMENTS, array_map, SmiConstant(2), base::nullopt,
-            IntPtrConstant(2));
-        StoreFixedArrayElement(CAST(elements), 0, next_key, SKIP_WRITE_BARRIER);
-        StoreFixedArrayElement(CAST(elements), 1, value, SKIP_WRITE_BARRIER);
-        value = array;
+        value = AllocateEntry(array_map, next_key, value);
       }
 
       StoreFixedArrayElement(values_or_entries, var_result_index.value(),
@@ -345,6 +378,60 @@ TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::FastGetOwnValuesOrEntries(
   }
 }
 
+TNode<JSArray> ObjectEntriesValuesBuiltinsAssembler::AllocateEntry(
+    TNode<Map> array_map, TNode<Name> key, TNode<Object> value) {
+  // Let entry be CreateArrayFromList(« key, value »).
+  TNode<JSArray> array;
+  TNode<FixedArrayBase> elements;
+  std::tie(array, elements) = AllocateUninitializedJSArrayWithElements(
+      PACKED_ELEMENTS, array_map, SmiConstant(2), base::nullopt,
+      IntPtrConstant(2));
+  StoreFixedArrayElement(CAST(elements), 0, key, SKIP_WRITE_BARRIER);
+  StoreFixedArrayElement(CAST(elements), 1, value, SKIP_WRITE_BARRIER);
+  return array;
+}
+
+TNode<Object> ObjectEntriesValuesBuiltinsAssembler::LoadFieldByEnumCacheIndex(
+    TNode<JSObject> object, TNode<Smi> encoded_index) {
+  // See FieldIndex::GetLoadByFieldIndex for the encoding.
+  TNode<IntPtrT> index = SmiUntag(encoded_index);
+  TNode<IntPtrT> field_index = WordSar(index, IntPtrConstant(1));
+  TVARIABLE(Object, var_value);
+  Label if_inobject(this), if_backing_store(this), check_double(this),
+      done(this);
+  Branch(IntPtrGreaterThanOrEqual(field_index, IntPtrConstant(0)),
+         &if_inobject, &if_backing_store);
+
+  BIND(&if_inobject);
+  {
+    var_value = LoadObjectField(
+        object, IntPtrAdd(TimesTaggedSize(field_index),
+                          IntPtrConstant(JSObject::kHeaderSize)));
+    Goto(&check_double);
+  }
+
+  BIND(&if_backing_store);
+  {
+    TNode<PropertyArray> properties = CAST(LoadFastProperties(object));
+    var_value = LoadPropertyArrayElement(
+        properties, IntPtrSub(IntPtrConstant(-1), field_index));
+    Goto(&check_double);
+  }
+
+  BIND(&check_double);
+  {
+    // Double fields hold a mutable HeapNumber box, which must not leak.
+    GotoIf(WordEqual(WordAnd(index, IntPtrConstant(1)), IntPtrConstant(0)),
+           &done);
+    var_value = AllocateHeapNumberWithValue(
+        LoadHeapNumberValue(CAST(var_value.value())));
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return var_value.value();
+}
+
 TNode<JSArray>
 ObjectEntriesValuesBuiltinsAssembler::FinalizeValuesOrEntriesJSArray(
     TNode<Context> context, TNode<FixedArray> result, TNode<IntPtrT> size,
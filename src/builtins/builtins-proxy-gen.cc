@@ -209,6 +209,24 @@ TF_BUILTIN(ConstructProxy, ProxiesCodeStubAssembler) {
   { ThrowTypeError(context, MessageTemplate::kProxyRevoked, "construct"); }
 }
 
+void ProxiesCodeStubAssembler::GotoIfConfigurableElement(
+    TNode<Name> name, TNode<Map> target_map, Label* if_configurable) {
+  // Elements with non-default attributes always live in dictionary (or
+  // frozen, sealed or non-extensible) elements, so the invariant checks
+  // pass without looking at the elements.
+  Label not_configurable_element(this);
+  GotoIf(IsCustomElementsReceiverInstanceType(LoadMapInstanceType(target_map)),
+         &not_configurable_element);
+  GotoIfNot(IsInternalizedStringInstanceType(LoadInstanceType(name)),
+            &not_configurable_element);
+  GotoIf(IsSetWord32(LoadNameRawHashField(name),
+                     Name::kDoesNotContainCachedArrayIndexMask),
+         &not_configurable_element);
+  Branch(IsFastElementsKind(LoadMapElementsKind(target_map)), if_configurable,
+         &not_configurable_element);
+  BIND(&not_configurable_element);
+}
+
 void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
     TNode<Context> context, TNode<JSReceiver> target, TNode<JSProxy> proxy,
     TNode<Name> name, TNode<Object> trap_result,
@@ -222,6 +240,7 @@ void ProxiesCodeStubAssembler::CheckGetSetTrapResult(
   Label if_found_value(this), check_in_runtime(this, Label::kDeferred),
       check_passed(this);
 
+  GotoIfConfigurableElement(name, map, &check_passed);
   GotoIfNot(IsUniqueNameNoIndex(name), &check_in_runtime);
   TNode<Uint16T> instance_type = LoadInstanceType(target);
   TryGetOwnProperty(context, target, target, map, instance_type, name,
@@ -332,6 +351,11 @@ void ProxiesCodeStubAssembler::CheckHasTrapResult(TNode<Context> context,
       throw_non_extensible(this, Label::kDeferred), check_passed(this),
       check_in_runtime(this, Label::kDeferred);
 
+  // A configurable element only fails the check if the target is not
+  // extensible.
+  Label if_configurable_element(this);
+  GotoIfConfigurableElement(name, target_map, &if_configurable_element);
+
   // 9.a. Let targetDesc be ? target.[[GetOwnProperty]](P).
   GotoIfNot(IsUniqueNameNoIndex(name), &check_in_runtime);
   TNode<Uint16T> instance_type = LoadInstanceType(target);
@@ -362,6 +386,9 @@ void ProxiesCodeStubAssembler::CheckHasTrapResult(TNode<Context> context,
   BIND(&throw_non_extensible);
   { ThrowTypeError(context, MessageTemplate::kProxyHasNonExtensible, name); }
 
+  BIND(&if_configurable_element);
+  Branch(IsExtensibleMap(target_map), &check_passed, &check_in_runtime);
+
   BIND(&check_in_runtime);
   {
     CallRuntime(Runtime::kCheckProxyHasTrapResult, context, name, target);
@@ -385,6 +412,11 @@ void ProxiesCodeStubAssembler::CheckDeleteTrapResult(TNode<Context> context,
       throw_non_extensible(this, Label::kDeferred), check_passed(this),
       check_in_runtime(this, Label::kDeferred);
 
+  // A configurable element only fails the check if the target is not
+  // extensible.
+  Label if_configurable_element(this);
+  GotoIfConfigurableElement(name, target_map, &if_configurable_element);
+
   // 10. Let targetDesc be ? target.[[GetOwnProperty]](P).
   GotoIfNot(IsUniqueNameNoIndex(name), &check_in_runtime);
   TNode<Uint16T> instance_type = LoadInstanceType(target);
@@ -420,6 +452,9 @@ void ProxiesCodeStubAssembler::CheckDeleteTrapResult(TNode<Context> context,
                    name);
   }
 
+  BIND(&if_configurable_element);
+  Branch(IsExtensibleMap(target_map), &check_passed, &check_in_runtime);
+
   BIND(&check_in_runtime);
   {
     CallRuntime(Runtime::kCheckProxyDeleteTrapResult, context, name, target);
@@ -40,6 +40,12 @@ class ProxiesCodeStubAssembler : public CodeStubAssembler {
  private:
   TNode<Context> CreateProxyRevokeFunctionContext(
       TNode<JSProxy> proxy, TNode<NativeContext> native_context);
+
+  // Jumps to {if_configurable} if {name} is an array index and the {target}
+  // keeps its elements in a fast elements kind, in which case the property
+  // is either missing or a configurable data property.
+  void GotoIfConfigurableElement(TNode<Name> name, TNode<Map> target_map,
+                                 Label* if_configurable);
 };
 
 }  // namespace internal
@@ -357,6 +357,17 @@ V8_WARN_UNUSED_RESULT static Object ConvertCase(
   // might break in the future if we implement more context and locale
   // dependent upper/lower conversions.
   if (String::IsOneByteRepresentationUnderneath(*s)) {
+    {
+      // Return the string itself if it is in the right case already.
+      DisallowGarbageCollection no_gc;
+      String::FlatContent flat_content = s->GetFlatContent(no_gc);
+      if (FindFirstAsciiToConvert<Converter::kIsToLower>(
+              reinterpret_cast<const char*>(
+                  flat_content.ToOneByteVector().begin()),
+              length) == length) {
+        return *s;
+      }
+    }
     // Same length as input.
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
@@ -452,44 +463,58 @@ BUILTIN(StringRaw) {
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, raw_len,
                                      Object::ToLength(isolate, raw_len));
 
-  IncrementalStringBuilder result_builder(isolate);
   // Intentional spec violation: we ignore {length} values >= 2^32, because
   // assuming non-empty chunks they would generate too-long strings anyway.
   const double raw_len_number = raw_len->Number();
   const uint32_t length = raw_len_number > std::numeric_limits<uint32_t>::max()
                               ? std::numeric_limits<uint32_t>::max()
                               : static_cast<uint32_t>(raw_len_number);
-  if (length > 0) {
-    Handle<Object> first_element;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, first_element,
-                                       Object::GetElement(isolate, raw, 0));
+  if (length == 0) return ReadOnlyRoots(isolate).empty_string();
 
-    Handle<String> first_string;
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, first_string, Object::ToString(isolate, first_element));
-    result_builder.AppendString(first_string);
-
-    for (uint32_t i = 1, arg_i = 2; i < length; i++, arg_i++) {
-      if (arg_i < argc) {
-        Handle<String> argument_string;
-        ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-            isolate, argument_string,
-            Object::ToString(isolate, args.at(arg_i)));
-        result_builder.AppendString(argument_string);
+  // Collect the parts first and write them into one sequential string of the
+  // exact length at the end.
+  ReplacementStringBuilder result_builder(
+      isolate->heap(), isolate->factory()->empty_string(),
+      2 * static_cast<int>(std::min<uint32_t>(length, 16)));
+  auto append = [&](Handle<String> string) {
+    if (string->length() > 0) result_builder.AddString(string);
+    return !result_builder.HasOverflowed();
+  };
+
+  Handle<Object> first_element;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, first_element,
+                                     Object::GetElement(isolate, raw, 0));
+
+  Handle<String> first_string;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, first_string, Object::ToString(isolate, first_element));
+  if (!append(first_string)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+  }
+
+  for (uint32_t i = 1, arg_i = 2; i < length; i++, arg_i++) {
+    if (arg_i < argc) {
+      Handle<String> argument_string;
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, argument_string, Object::ToString(isolate, args.at(arg_i)));
+      if (!append(argument_string)) {
+        THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
       }
+    }
 
-      Handle<Object> element;
-      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, element,
-                                         Object::GetElement(isolate, raw, i));
+    Handle<Object> element;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, element,
+                                       Object::GetElement(isolate, raw, i));
 
-      Handle<String> element_string;
-      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, element_string,
-                                         Object::ToString(isolate, element));
-      result_builder.AppendString(element_string);
+    Handle<String> element_string;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, element_string,
+                                       Object::ToString(isolate, element));
+    if (!append(element_string)) {
+      THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
     }
   }
 
-  RETURN_RESULT_OR_FAILURE(isolate, result_builder.Finish());
+  RETURN_RESULT_OR_FAILURE(isolate, result_builder.ToString());
 }
 
 }  // namespace internal
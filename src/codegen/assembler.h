@@ -282,6 +282,12 @@ class V8_EXPORT_PRIVATE AssemblerBase : public Malloced {
   int buffer_size() const { return buffer_->size(); }
   int instruction_size() const { return pc_offset(); }
 
+  // Whether GetCode still has to allocate heap objects for this code on the
+  // main thread's heap.
+  bool has_heap_object_requests() const {
+    return !heap_object_requests_.empty();
+  }
+
   std::unique_ptr<AssemblerBuffer> ReleaseBuffer() {
     std::unique_ptr<AssemblerBuffer> buffer = std::move(buffer_);
     DCHECK_NULL(buffer_);
@@ -0,0 +1,187 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/background-merge-task.h"
+
+#include "src/codegen/compilation-cache.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate.h"
+#include "src/handles/persistent-handles.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Replaces the new SharedFunctionInfos in the constant pool of |bytecode| with
+// their cached counterparts, i.e. makes the closures that the new code creates
+// use the cached SharedFunctionInfos.
+void ForwardConstantPool(
+    BytecodeArray bytecode,
+    const std::vector<Handle<SharedFunctionInfo>>& forwarded) {
+  DisallowGarbageCollection no_gc;
+  FixedArray constant_pool = bytecode.constant_pool();
+  for (int i = 0; i < constant_pool.length(); i++) {
+    Object object = constant_pool.get(i);
+    if (!object.IsSharedFunctionInfo()) continue;
+    int literal_id = SharedFunctionInfo::cast(object).function_literal_id();
+    DCHECK_LT(static_cast<size_t>(literal_id), forwarded.size());
+    if (forwarded[literal_id].is_null()) continue;
+    constant_pool.set(i, *forwarded[literal_id]);
+  }
+}
+
+}  // namespace
+
+BackgroundMergeTask::BackgroundMergeTask() = default;
+BackgroundMergeTask::~BackgroundMergeTask() = default;
+
+void BackgroundMergeTask::SetUpOnMainThread(Isolate* isolate,
+                                            Handle<String> source_text,
+                                            const ScriptDetails& script_details,
+                                            LanguageMode language_mode) {
+  DCHECK_EQ(state_, kNotStarted);
+  HandleScope scope(isolate);
+  Handle<SharedFunctionInfo> toplevel_sfi;
+  if (!isolate->compilation_cache()
+           ->LookupScript(source_text, script_details, language_mode)
+           .ToHandle(&toplevel_sfi)) {
+    state_ = kDone;
+    return;
+  }
+  persistent_handles_ = isolate->NewPersistentHandles();
+  cached_toplevel_sfi_ = persistent_handles_->NewHandle(*toplevel_sfi);
+  cached_script_ =
+      persistent_handles_->NewHandle(Script::cast(toplevel_sfi->script()));
+  state_ = kPendingBackgroundWork;
+}
+
+void BackgroundMergeTask::BeginMergeInBackground(LocalIsolate* isolate,
+                                                 Handle<Script> new_script) {
+  DCHECK_EQ(state_, kPendingBackgroundWork);
+  LocalHeap* local_heap = isolate->heap();
+  local_heap->AttachPersistentHandles(std::move(persistent_handles_));
+  Handle<Script> cached_script = cached_script_.ToHandleChecked();
+
+  // The cached SharedFunctionInfos by function literal id, for the new ones
+  // that are dropped.
+  std::vector<Handle<SharedFunctionInfo>> forwarded;
+  // The bytecode of the new SharedFunctionInfos that are used.
+  std::vector<Handle<BytecodeArray>> used_new_bytecode;
+  {
+    DisallowGarbageCollection no_gc;
+    WeakFixedArray new_infos = new_script->shared_function_infos();
+    WeakFixedArray cached_infos = cached_script->shared_function_infos();
+    // Both scripts have the same source, so this only fails if the cache
+    // entry and the code cache were produced from different sources of the
+    // same length.
+    if (new_infos.length() != cached_infos.length()) {
+      persistent_handles_ = local_heap->DetachPersistentHandles();
+      Reset();
+      return;
+    }
+    forwarded.resize(new_infos.length());
+    for (int i = 0; i < new_infos.length(); i++) {
+      HeapObject new_object;
+      if (!new_infos.Get(i).GetHeapObjectIfWeak(&new_object)) continue;
+      SharedFunctionInfo new_sfi = SharedFunctionInfo::cast(new_object);
+      DCHECK_EQ(new_sfi.function_literal_id(), i);
+
+      HeapObject cached_object;
+      if (cached_infos.Get(i).GetHeapObjectIfWeak(&cached_object)) {
+        SharedFunctionInfo cached_sfi =
+            SharedFunctionInfo::cast(cached_object);
+        forwarded[i] = local_heap->NewPersistentHandle(cached_sfi);
+        if (new_sfi.HasBytecodeArray() && !cached_sfi.is_compiled()) {
+          new_compiled_data_for_cached_sfis_.push_back(
+              {forwarded[i], local_heap->NewPersistentHandle(new_sfi)});
+          used_new_bytecode.push_back(local_heap->NewPersistentHandle(
+              new_sfi.GetBytecodeArray(isolate)));
+        }
+      } else {
+        new_sfi.set_script(*cached_script);
+        used_new_sfis_.push_back(local_heap->NewPersistentHandle(new_sfi));
+        if (new_sfi.HasBytecodeArray()) {
+          used_new_bytecode.push_back(local_heap->NewPersistentHandle(
+              new_sfi.GetBytecodeArray(isolate)));
+        }
+      }
+    }
+  }
+
+  for (Handle<BytecodeArray> bytecode : used_new_bytecode) {
+    ForwardConstantPool(*bytecode, forwarded);
+  }
+
+  persistent_handles_ = local_heap->DetachPersistentHandles();
+  state_ = kPendingForegroundWork;
+}
+
+Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
+    Isolate* isolate) {
+  DCHECK_EQ(state_, kPendingForegroundWork);
+  Handle<Script> cached_script = cached_script_.ToHandleChecked();
+  Handle<SharedFunctionInfo> result =
+      handle(*cached_toplevel_sfi_.ToHandleChecked(), isolate);
+
+  DisallowGarbageCollection no_gc;
+  WeakFixedArray cached_infos = cached_script->shared_function_infos();
+  // The main thread may have compiled functions of the cached script since
+  // the background step. If that created a SharedFunctionInfo where a new one
+  // was to be used, the used new code might refer to the wrong one of the two.
+  bool conflict = false;
+  for (Handle<SharedFunctionInfo> new_sfi : used_new_sfis_) {
+    HeapObject cached_object;
+    if (cached_infos.Get(new_sfi->function_literal_id())
+            .GetHeapObjectIfWeak(&cached_object)) {
+      conflict = true;
+      break;
+    }
+  }
+
+  if (!conflict) {
+    for (Handle<SharedFunctionInfo> new_sfi : used_new_sfis_) {
+      cached_infos.Set(new_sfi->function_literal_id(),
+                       HeapObjectReference::Weak(*new_sfi));
+    }
+    for (const NewCompiledDataForCachedSfi& data :
+         new_compiled_data_for_cached_sfis_) {
+      // Skip the functions that were compiled in the meantime, as well as
+      // those the debugger has seen.
+      if (data.cached_sfi->is_compiled() || data.cached_sfi->HasDebugInfo()) {
+        continue;
+      }
+      // Copy every field but the script, which is the same in both, from the
+      // new SharedFunctionInfo.
+      data.new_sfi->set_script_or_debug_info(
+          data.cached_sfi->script_or_debug_info(kAcquireLoad), kReleaseStore);
+      data.cached_sfi->CopyFrom(*data.new_sfi);
+    }
+  }
+
+  Reset();
+  return result;
+}
+
+void BackgroundMergeTask::Abandon() {
+  DCHECK(HasPendingBackgroundWork());
+  Reset();
+}
+
+void BackgroundMergeTask::Reset() {
+  used_new_sfis_.clear();
+  new_compiled_data_for_cached_sfis_.clear();
+  cached_script_ = {};
+  cached_toplevel_sfi_ = {};
+  persistent_handles_.reset();
+  state_ = kDone;
+}
+
+}  // namespace internal
+}  // namespace v8
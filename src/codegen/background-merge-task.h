@@ -0,0 +1,102 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_BACKGROUND_MERGE_TASK_H_
+#define V8_CODEGEN_BACKGROUND_MERGE_TASK_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class LocalIsolate;
+class PersistentHandles;
+class Script;
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// Merges the script that a background deserialization produced into the
+// script that the isolate's compilation cache already has for the same
+// source, instead of publishing a second copy of the script.
+//
+// The functions of both scripts are matched by their function literal id. The
+// cached script keeps its SharedFunctionInfos, and takes the compiled data of
+// those that only the deserialized script has compiled, as well as the
+// SharedFunctionInfos that only the deserialized script has. Everything that
+// depends on the size of the script, i.e. the matching and redirecting the
+// references of the deserialized code to the cached SharedFunctionInfos, is
+// done on the background thread. The main thread only hands over the chosen
+// objects.
+class V8_EXPORT_PRIVATE BackgroundMergeTask {
+ public:
+  BackgroundMergeTask();
+  ~BackgroundMergeTask();
+  BackgroundMergeTask(const BackgroundMergeTask&) = delete;
+  BackgroundMergeTask& operator=(const BackgroundMergeTask&) = delete;
+
+  // Looks up the script in the isolate's compilation cache. Runs on the main
+  // thread once the source is known. There's nothing to merge unless the
+  // lookup hits.
+  void SetUpOnMainThread(Isolate* isolate, Handle<String> source_text,
+                         const ScriptDetails& script_details,
+                         LanguageMode language_mode);
+
+  // Matches the functions of the deserialized |new_script| with the cached
+  // ones and forwards the references between them. Only writes to the objects
+  // of |new_script|, which no other thread can see yet.
+  void BeginMergeInBackground(LocalIsolate* isolate, Handle<Script> new_script);
+
+  // Hands the new compiled data and SharedFunctionInfos over to the cached
+  // script and returns its top-level SharedFunctionInfo. Gives up on the
+  // handover if the main thread compiled a conflicting function since the
+  // background step, the cached script is still valid in that case.
+  Handle<SharedFunctionInfo> CompleteMergeInForeground(Isolate* isolate);
+
+  bool HasPendingBackgroundWork() const {
+    return state_ == kPendingBackgroundWork;
+  }
+  bool HasPendingForegroundWork() const {
+    return state_ == kPendingForegroundWork;
+  }
+
+  // Drops a merge whose background step never ran.
+  void Abandon();
+
+ private:
+  struct NewCompiledDataForCachedSfi {
+    Handle<SharedFunctionInfo> cached_sfi;
+    Handle<SharedFunctionInfo> new_sfi;
+  };
+
+  enum State {
+    kNotStarted,
+    kPendingBackgroundWork,
+    kPendingForegroundWork,
+    kDone
+  };
+
+  void Reset();
+
+  // Holds all the handles below between the steps.
+  std::unique_ptr<PersistentHandles> persistent_handles_;
+  MaybeHandle<Script> cached_script_;
+  MaybeHandle<SharedFunctionInfo> cached_toplevel_sfi_;
+  // New SharedFunctionInfos for function literals that the cached script has
+  // no SharedFunctionInfo for.
+  std::vector<Handle<SharedFunctionInfo>> used_new_sfis_;
+  // Cached SharedFunctionInfos that aren't compiled, with their compiled
+  // counterparts from the new script.
+  std::vector<NewCompiledDataForCachedSfi> new_compiled_data_for_cached_sfis_;
+  State state_ = kNotStarted;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_BACKGROUND_MERGE_TASK_H_
@@ -8869,6 +8869,82 @@ template void CodeStubAssembler::Add<NameDictionary>(TNode<NameDictionary>,
                                                      TNode<Name>, TNode<Object>,
                                                      Label*);
 
+template <class Dictionary>
+TNode<Dictionary> CodeStubAssembler::RehashForAdd(TNode<Dictionary> dictionary,
+                                                  Label* bailout) {
+  UNREACHABLE();  // Use specializations instead.
+}
+
+template <>
+TNode<NameDictionary> CodeStubAssembler::RehashForAdd(
+    TNode<NameDictionary> dictionary, Label* bailout) {
+  Comment("RehashForAdd");
+  TNode<IntPtrT> capacity = SmiUntag(GetCapacity<NameDictionary>(dictionary));
+
+  // HashTable::EnsureCapacity() pretenures large dictionaries that already
+  // live in old space. Leave those to the runtime.
+  Label allocate(this);
+  TNode<IntPtrT> pretenure_capacity =
+      IntPtrConstant(NameDictionary::kMinCapacityForPretenure);
+  GotoIf(IntPtrLessThanOrEqual(capacity, pretenure_capacity), &allocate);
+  TNode<IntPtrT> page_flags =
+      Load<IntPtrT>(PageFromAddress(BitcastTaggedToWord(dictionary)),
+                    IntPtrConstant(Page::kFlagsOffset));
+  TNode<IntPtrT> young_bit = WordAnd(
+      page_flags, IntPtrConstant(MemoryChunk::kIsInYoungGenerationMask));
+  Branch(WordEqual(young_bit, IntPtrConstant(0)), bailout, &allocate);
+
+  BIND(&allocate);
+  TNode<Smi> nof = GetNumberOfElements<NameDictionary>(dictionary);
+  TNode<IntPtrT> new_capacity =
+      HashTableComputeCapacity(IntPtrAdd(SmiUntag(nof), IntPtrConstant(1)));
+  GotoIf(UintPtrGreaterThan(
+             new_capacity, IntPtrConstant(NameDictionary::kMaxRegularCapacity)),
+         bailout);
+
+  // No more bailouts after this point.
+  TNode<NameDictionary> new_dictionary =
+      AllocateNameDictionaryWithCapacity(new_capacity);
+  SetNumberOfElements<NameDictionary>(new_dictionary, nof);
+  SetNextEnumerationIndex<NameDictionary>(
+      new_dictionary, GetNextEnumerationIndex<NameDictionary>(dictionary));
+  TNode<Smi> hash =
+      CAST(LoadFixedArrayElement(dictionary, NameDictionary::kObjectHashIndex));
+  StoreFixedArrayElement(new_dictionary, NameDictionary::kObjectHashIndex,
+                         hash);
+
+  // Re-insert the live entries, which keeps their enumeration indices.
+  BuildFastLoop<IntPtrT>(
+      IntPtrConstant(NameDictionary::kElementsStartIndex),
+      EntryToIndex<NameDictionary>(capacity),
+      [=](TNode<IntPtrT> key_index) {
+        Label next(this);
+        TNode<Object> key = LoadFixedArrayElement(dictionary, key_index);
+        GotoIf(IsUndefined(key), &next);
+        GotoIf(IsTheHole(key), &next);
+
+        TVARIABLE(IntPtrT, var_new_key_index);
+        FindInsertionEntry<NameDictionary>(new_dictionary, CAST(key),
+                                           &var_new_key_index);
+        TNode<IntPtrT> new_key_index = var_new_key_index.value();
+        StoreFixedArrayElement(new_dictionary, new_key_index, key);
+        StoreValueByKeyIndex<NameDictionary>(
+            new_dictionary, new_key_index,
+            LoadValueByKeyIndex(dictionary, key_index));
+        StoreFixedArrayElement(
+            new_dictionary, new_key_index,
+            LoadFixedArrayElement(
+                dictionary, key_index,
+                NameDictionary::kEntryDetailsIndex * kTaggedSize),
+            SKIP_WRITE_BARRIER,
+            NameDictionary::kEntryDetailsIndex * kTaggedSize);
+        Goto(&next);
+        BIND(&next);
+      },
+      NameDictionary::kEntrySize, IndexAdvanceMode::kPost);
+  return new_dictionary;
+}
+
 template <class Dictionary>
 TNode<Smi> CodeStubAssembler::GetNumberOfElements(
     TNode<Dictionary> dictionary) {
@@ -9680,9 +9756,8 @@ void CodeStubAssembler::LoadPropertyFromFastObject(
     BIND(&rebox_double);
     {
       Comment("rebox_double");
-      TNode<HeapNumber> heap_number =
-          AllocateHeapNumberWithValue(var_double_value.value());
-      *var_value = heap_number;
+      // Integral values do not need a new box.
+      *var_value = ChangeFloat64ToTagged(var_double_value.value());
       Goto(&done);
     }
   }
@@ -10638,6 +10713,14 @@ void CodeStubAssembler::CombineFeedback(TVariable<Smi>* existing_feedback,
   *existing_feedback = SmiOr(existing_feedback->value(), feedback);
 }
 
+void CodeStubAssembler::CombineCompareOutcomeFeedback(
+    TVariable<Smi>* existing_feedback, TNode<Oddball> result) {
+  CombineFeedback(existing_feedback,
+                  SelectSmiConstant(TaggedEqual(result, TrueConstant()),
+                                    CompareOperationFeedback::kTrueOutcome,
+                                    CompareOperationFeedback::kFalseOutcome));
+}
+
 void CodeStubAssembler::CheckForAssociatedProtector(TNode<Name> name,
                                                     Label* if_protector) {
   // This list must be kept in sync with LookupIterator::UpdateProtector!
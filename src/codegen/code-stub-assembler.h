@@ -3182,6 +3182,13 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   void Add(TNode<Dictionary> dictionary, TNode<Name> key, TNode<Object> value,
            Label* bailout);
 
+  // Copies the entries of {dictionary} into a new dictionary without deleted
+  // entries and with enough capacity to Add() one more entry, like
+  // HashTable::EnsureCapacity() does. Jumps to {bailout} for dictionaries
+  // that need to be pretenured or are too large for a regular allocation.
+  template <class Dictionary>
+  TNode<Dictionary> RehashForAdd(TNode<Dictionary> dictionary, Label* bailout);
+
   // Tries to check if {object} has own {unique_name} property.
   void TryHasOwnProperty(TNode<HeapObject> object, TNode<Map> map,
                          TNode<Int32T> instance_type, TNode<Name> unique_name,
@@ -3425,6 +3432,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   void CombineFeedback(TVariable<Smi>* existing_feedback, int feedback);
   void CombineFeedback(TVariable<Smi>* existing_feedback, TNode<Smi> feedback);
 
+  // Combine the outcome of a comparison, i.e. whether {result} is true or
+  // false, with the existing_feedback of its CompareOperation slot.
+  void CombineCompareOutcomeFeedback(TVariable<Smi>* existing_feedback,
+                                     TNode<Oddball> result);
+
   // Overwrite the existing feedback with new_feedback. Do nothing if
   // existing_feedback is nullptr.
   void OverwriteFeedback(TVariable<Smi>* existing_feedback, int new_feedback);
@@ -78,6 +78,41 @@ void CompilationCacheScript::Age() {
 void CompilationCacheEval::Age() { AgeCustom(this); }
 void CompilationCacheRegExp::Age() { AgeByGeneration(this); }
 
+size_t CompilationCacheScript::max_size() const {
+  return FLAG_compilation_cache_script_size * KB;
+}
+size_t CompilationCacheEval::max_size() const {
+  return FLAG_compilation_cache_eval_size * KB;
+}
+size_t CompilationCacheRegExp::max_size() const {
+  return FLAG_compilation_cache_regexp_size * KB;
+}
+
+void CompilationSubCache::AddedEntry(size_t entry_size,
+                                     StatsCounter* evictions) {
+  size_ += entry_size;
+  const size_t budget = max_size();
+  if (budget == 0 || size_ <= budget) return;
+
+  // The younger generations take their share of the budget first, so that
+  // all entries of an older generation are evicted before any entry of a
+  // younger one.
+  size_t remaining_budget = budget / 100 * kEvictionTargetPercent;
+  size_ = 0;
+  for (int generation = 0; generation < generations(); generation++) {
+    if (tables_[generation].IsUndefined(isolate())) continue;
+    CompilationCacheTable table =
+        CompilationCacheTable::cast(tables_[generation]);
+    size_t table_size;
+    int evicted =
+        table.EvictLeastRecentlyUsed(isolate(), remaining_budget, &table_size);
+    if (evicted > 0) evictions->Increment(evicted);
+    DCHECK_LE(table_size, remaining_budget);
+    remaining_budget -= table_size;
+    size_ += table_size;
+  }
+}
+
 void CompilationSubCache::Iterate(RootVisitor* v) {
   v->VisitRootPointers(Root::kCompilationCache, nullptr,
                        FullObjectSlot(&tables_[0]),
@@ -88,6 +123,7 @@ void CompilationSubCache::Clear() {
   MemsetPointer(reinterpret_cast<Address*>(tables_),
                 ReadOnlyRoots(isolate()).undefined_value().ptr(),
                 generations());
+  size_ = 0;
 }
 
 void CompilationSubCache::Remove(Handle<SharedFunctionInfo> function_info) {
@@ -198,9 +234,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
     // with handles during the call.
     DCHECK(HasOrigin(isolate(), function_info, script_details));
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_script_hits()->Increment();
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_script_misses()->Increment();
   }
   return result;
 }
@@ -212,6 +250,9 @@ void CompilationCacheScript::Put(Handle<String> source,
   Handle<CompilationCacheTable> table = GetFirstTable();
   SetFirstTable(CompilationCacheTable::PutScript(table, source, language_mode,
                                                  function_info, isolate()));
+  AddedEntry(CompilationCacheTable::EstimateEntrySize(isolate(), *source,
+                                                      *function_info),
+             isolate()->counters()->compilation_cache_script_evictions());
 }
 
 InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
@@ -231,8 +272,10 @@ InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
       table, source, outer_info, native_context, language_mode, position);
   if (result.has_shared()) {
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_eval_hits()->Increment();
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_eval_misses()->Increment();
   }
   return result;
 }
@@ -249,6 +292,9 @@ void CompilationCacheEval::Put(Handle<String> source,
       CompilationCacheTable::PutEval(table, source, outer_info, function_info,
                                      native_context, feedback_cell, position);
   SetFirstTable(table);
+  AddedEntry(CompilationCacheTable::EstimateEntrySize(isolate(), *source,
+                                                      *function_info),
+             isolate()->counters()->compilation_cache_eval_evictions());
 }
 
 MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(Handle<String> source,
@@ -270,9 +316,11 @@ MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(Handle<String> source,
       Put(source, flags, data);
     }
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_regexp_hits()->Increment();
     return scope.CloseAndEscape(data);
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_regexp_misses()->Increment();
     return MaybeHandle<FixedArray>();
   }
 }
@@ -283,6 +331,9 @@ void CompilationCacheRegExp::Put(Handle<String> source, JSRegExp::Flags flags,
   Handle<CompilationCacheTable> table = GetFirstTable();
   SetFirstTable(
       CompilationCacheTable::PutRegExp(isolate(), table, source, flags, data));
+  AddedEntry(
+      CompilationCacheTable::EstimateEntrySize(isolate(), *source, *data),
+      isolate()->counters()->compilation_cache_regexp_evictions());
 }
 
 void CompilationCache::Remove(Handle<SharedFunctionInfo> function_info) {
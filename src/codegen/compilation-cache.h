@@ -16,6 +16,7 @@ template <typename T>
 class Handle;
 
 class RootVisitor;
+class StatsCounter;
 struct ScriptDetails;
 
 // The compilation cache consists of several generational sub-caches which uses
@@ -23,6 +24,9 @@ struct ScriptDetails;
 // for each generation of the sub-cache. Since the same source code string has
 // different compiled code for scripts and evals, we use separate sub-caches
 // for different compilation modes, to avoid retrieving the wrong result.
+//
+// A sub-cache can also be given a memory budget, in which case it evicts its
+// least recently used entries once their estimated size exceeds the budget.
 class CompilationSubCache {
  public:
   CompilationSubCache(Isolate* isolate, int generations)
@@ -61,9 +65,24 @@ class CompilationSubCache {
   // Number of generations in this sub-cache.
   int generations() const { return generations_; }
 
+  // The estimated size of the entries of all generations, in bytes. This is
+  // an upper bound that becomes exact after each eviction.
+  size_t size() const { return size_; }
+
  protected:
   Isolate* isolate() const { return isolate_; }
 
+  // The memory budget of the sub-cache in bytes, or 0 for no budget.
+  virtual size_t max_size() const = 0;
+
+  // Accounts for a new entry of |entry_size| estimated bytes and evicts the
+  // least recently used entries if the sub-cache is over budget. Eviction
+  // goes down to kEvictionTargetPercent of the budget so that a full
+  // sub-cache doesn't walk its tables on every put.
+  void AddedEntry(size_t entry_size, StatsCounter* evictions);
+
+  static constexpr size_t kEvictionTargetPercent = 75;
+
   // Ageing occurs either by removing the oldest generation, or with
   // custom logic implemented in CompilationCacheTable::Age.
   static void AgeByGeneration(CompilationSubCache* c);
@@ -73,6 +92,7 @@ class CompilationSubCache {
   Isolate* const isolate_;
   const int generations_;
   Object tables_[kMaxGenerations];  // One for each generation.
+  size_t size_ = 0;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationSubCache);
 };
@@ -91,6 +111,9 @@ class CompilationCacheScript : public CompilationSubCache {
 
   void Age() override;
 
+ protected:
+  size_t max_size() const override;
+
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheScript);
 };
@@ -124,6 +147,9 @@ class CompilationCacheEval : public CompilationSubCache {
 
   void Age() override;
 
+ protected:
+  size_t max_size() const override;
+
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheEval);
 };
@@ -141,6 +167,9 @@ class CompilationCacheRegExp : public CompilationSubCache {
 
   void Age() override;
 
+ protected:
+  size_t max_size() const override;
+
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheRegExp);
 };
@@ -5,6 +5,8 @@
 #include "src/codegen/compiler.h"
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <memory>
 
 #include "src/api/api-inl.h"
@@ -19,6 +21,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/codegen/process-wide-script-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/assert-scope.h"
@@ -30,6 +33,7 @@
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
@@ -44,6 +48,7 @@
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
@@ -52,6 +57,7 @@
 #include "src/objects/js-function-inl.h"
 #include "src/objects/map.h"
 #include "src/objects/object-list-macros.h"
+#include "src/objects/osr-optimized-code-cache-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/string.h"
 #include "src/parsing/parse-info.h"
@@ -783,6 +789,56 @@ ExecuteSingleUnoptimizedCompilationJob(
   return job;
 }
 
+// Finalizes an executed |job| for |literal|. Returns false if compilation
+// failed.
+template <typename IsolateT>
+bool FinalizeExecutedUnoptimizedCompilationJob(
+    IsolateT* isolate, std::unique_ptr<UnoptimizedCompilationJob> job,
+    FunctionLiteral* literal, Handle<SharedFunctionInfo> shared_info,
+    Handle<SharedFunctionInfo> outer_shared_info,
+    IsCompiledScope* is_compiled_scope,
+    FinalizeUnoptimizedCompilationDataList*
+        finalize_unoptimized_compilation_data_list,
+    DeferredFinalizationJobDataList*
+        jobs_to_retry_finalization_on_main_thread) {
+  UpdateSharedFunctionFlagsAfterCompilation(literal, *shared_info);
+
+  auto finalization_status = FinalizeSingleUnoptimizedCompilationJob(
+      job.get(), shared_info, isolate,
+      finalize_unoptimized_compilation_data_list);
+
+  switch (finalization_status) {
+    case CompilationJob::SUCCEEDED:
+      if (shared_info.is_identical_to(outer_shared_info)) {
+        // Ensure that the top level function is retained.
+        *is_compiled_scope = shared_info->is_compiled_scope(isolate);
+        DCHECK(is_compiled_scope->is_compiled());
+      }
+      break;
+
+    case CompilationJob::FAILED:
+      return false;
+
+    case CompilationJob::RETRY_ON_MAIN_THREAD:
+      // This should not happen on the main thread.
+      DCHECK((!std::is_same<IsolateT, Isolate>::value));
+      DCHECK_NOT_NULL(jobs_to_retry_finalization_on_main_thread);
+
+      // Clear the literal and ParseInfo to prevent further attempts to
+      // access them.
+      job->compilation_info()->ClearLiteral();
+      job->ClearParseInfo();
+      jobs_to_retry_finalization_on_main_thread->emplace_back(
+          isolate, shared_info, std::move(job));
+      break;
+  }
+  return true;
+}
+
+// Eager inner functions are only compiled in parallel if there are at least
+// this many of them in one round.
+constexpr size_t kMinEagerInnerFunctionsForParallelCompile = 2;
+
 template <typename IsolateT>
 bool IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
     IsolateT* isolate, Handle<SharedFunctionInfo> outer_shared_info,
@@ -821,38 +877,191 @@ bool IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
                                                allocator, &functions_to_compile,
                                                isolate->AsLocalIsolate());
 
-    if (!job) return false;
+    if (!job ||
+        !FinalizeExecutedUnoptimizedCompilationJob(
+            isolate, std::move(job), literal, shared_info, outer_shared_info,
+            is_compiled_scope, finalize_unoptimized_compilation_data_list,
+            jobs_to_retry_finalization_on_main_thread)) {
+      return false;
+    }
+  }
 
-    UpdateSharedFunctionFlagsAfterCompilation(literal, *shared_info);
+  // Report any warnings generated during compilation.
+  if (parse_info->pending_error_handler()->has_pending_warnings()) {
+    parse_info->pending_error_handler()->PrepareWarnings(isolate);
+  }
 
-    auto finalization_status = FinalizeSingleUnoptimizedCompilationJob(
-        job.get(), shared_info, isolate,
-        finalize_unoptimized_compilation_data_list);
+  return true;
+}
 
-    switch (finalization_status) {
-      case CompilationJob::SUCCEEDED:
-        if (shared_info.is_identical_to(outer_shared_info)) {
-          // Ensure that the top level function is retained.
-          *is_compiled_scope = shared_info->is_compiled_scope(isolate);
-          DCHECK(is_compiled_scope->is_compiled());
-        }
-        break;
+// An eagerly compiled function literal whose compilation job is executed by
+// an EagerInnerFunctionCompileJob.
+struct EagerInnerFunctionCompileItem {
+  EagerInnerFunctionCompileItem(FunctionLiteral* literal,
+                                Handle<SharedFunctionInfo> shared_info)
+      : literal(literal), shared_info(shared_info) {}
 
-      case CompilationJob::FAILED:
-        return false;
+  FunctionLiteral* literal;
+  Handle<SharedFunctionInfo> shared_info;
+  // The executed job, or null if execution failed.
+  std::unique_ptr<UnoptimizedCompilationJob> job;
+  // The eager inner literals found while executing the job.
+  std::vector<FunctionLiteral*> eager_inner_literals;
+};
 
-      case CompilationJob::RETRY_ON_MAIN_THREAD:
-        // This should not happen on the main thread.
-        DCHECK((!std::is_same<IsolateT, Isolate>::value));
-        DCHECK_NOT_NULL(jobs_to_retry_finalization_on_main_thread);
-
-        // Clear the literal and ParseInfo to prevent further attempts to
-        // access them.
-        job->compilation_info()->ClearLiteral();
-        job->ClearParseInfo();
-        jobs_to_retry_finalization_on_main_thread->emplace_back(
-            isolate, shared_info, std::move(job));
-        break;
+// Executes the compilation jobs of a list of function literals that were all
+// found by the previous round of compilation, so that they do not depend on
+// each other. Each worker thread uses its own LocalIsolate, which stays parked
+// while bytecode is generated. Only ExecuteJob runs on the workers; everything
+// that touches the heap is left to the thread that posted the job.
+class EagerInnerFunctionCompileJob final : public v8::JobTask {
+ public:
+  EagerInnerFunctionCompileJob(
+      Isolate* isolate_for_local_isolate, LocalIsolate* joining_isolate,
+      ParseInfo* parse_info, Handle<Script> script,
+      AccountingAllocator* allocator, int stack_size,
+      std::vector<EagerInnerFunctionCompileItem>* items)
+      : isolate_for_local_isolate_(isolate_for_local_isolate),
+        joining_isolate_(joining_isolate),
+        parse_info_(parse_info),
+        script_(script),
+        allocator_(allocator),
+        stack_size_(stack_size),
+        items_(items) {}
+
+  void Run(JobDelegate* delegate) override {
+    if (delegate->IsJoiningThread()) {
+      // The posting thread is parked while it joins the job.
+      UnparkedScope unparked_scope(joining_isolate_);
+      RunItems(joining_isolate_, delegate);
+      return;
+    }
+    LocalIsolate local_isolate(isolate_for_local_isolate_,
+                               ThreadKind::kBackground);
+    UnparkedScope unparked_scope(&local_isolate);
+    LocalHandleScope handle_scope(&local_isolate);
+    RunItems(&local_isolate, delegate);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t claimed = next_item_.load(std::memory_order_relaxed);
+    size_t remaining = claimed < items_->size() ? items_->size() - claimed : 0;
+    size_t max_threads = FLAG_parallel_eager_inner_compile_max_threads;
+    return max_threads > 0 ? std::min(max_threads, remaining) : remaining;
+  }
+
+ private:
+  void RunItems(LocalIsolate* isolate, JobDelegate* delegate) {
+    uintptr_t stack_limit = GetCurrentStackPosition() - stack_size_ * KB;
+    while (!delegate->ShouldYield()) {
+      size_t index = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= items_->size()) return;
+      EagerInnerFunctionCompileItem& item = (*items_)[index];
+      std::unique_ptr<UnoptimizedCompilationJob> job(
+          interpreter::Interpreter::NewCompilationJob(
+              parse_info_, item.literal, script_, allocator_,
+              &item.eager_inner_literals, isolate));
+      job->set_stack_limit(stack_limit);
+      if (job->ExecuteJob() == CompilationJob::SUCCEEDED) {
+        item.job = std::move(job);
+      }
+    }
+  }
+
+  Isolate* const isolate_for_local_isolate_;
+  LocalIsolate* const joining_isolate_;
+  ParseInfo* const parse_info_;
+  const Handle<Script> script_;
+  AccountingAllocator* const allocator_;
+  const int stack_size_;
+  std::vector<EagerInnerFunctionCompileItem>* const items_;
+  std::atomic<size_t> next_item_{0};
+};
+
+bool CanExecuteEagerInnerFunctionsInParallel(ParseInfo* parse_info) {
+  if (!FLAG_parallel_eager_inner_compile) return false;
+  // Runtime call stats are collected per thread, in the ParseInfo.
+  if (TracingFlags::is_runtime_stats_enabled()) return false;
+  // These enqueue functions on the lazy compile dispatcher while generating
+  // bytecode, which allocates.
+  if (parse_info->flags().post_parallel_compile_tasks_for_eager_toplevel() ||
+      parse_info->flags().post_parallel_compile_tasks_for_lazy()) {
+    return false;
+  }
+  return true;
+}
+
+// Like IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs, but executes
+// the compilation jobs of each round of eager inner functions (e.g. the IIFEs
+// of a bundle) in parallel.
+bool ParallelExecuteAndFinalizeUnoptimizedCompilationJobs(
+    Isolate* isolate_for_local_isolate, LocalIsolate* isolate,
+    Handle<SharedFunctionInfo> outer_shared_info, Handle<Script> script,
+    ParseInfo* parse_info, AccountingAllocator* allocator, int stack_size,
+    IsCompiledScope* is_compiled_scope,
+    FinalizeUnoptimizedCompilationDataList*
+        finalize_unoptimized_compilation_data_list,
+    DeferredFinalizationJobDataList*
+        jobs_to_retry_finalization_on_main_thread) {
+  DeclarationScope::AllocateScopeInfos(parse_info, isolate);
+
+  std::vector<FunctionLiteral*> functions_to_compile;
+  functions_to_compile.push_back(parse_info->literal());
+
+  bool is_first = true;
+  while (!functions_to_compile.empty()) {
+    std::vector<EagerInnerFunctionCompileItem> items;
+    std::vector<EagerInnerFunctionCompileItem> serial_items;
+    for (FunctionLiteral* literal : functions_to_compile) {
+      Handle<SharedFunctionInfo> shared_info;
+      if (is_first) {
+        DCHECK_EQ(literal->function_literal_id(),
+                  outer_shared_info->function_literal_id());
+        shared_info = outer_shared_info;
+        is_first = false;
+      } else {
+        shared_info = Compiler::GetSharedFunctionInfo(literal, script, isolate);
+      }
+      if (shared_info->is_compiled()) continue;
+      // asm.js validation reports its messages through the ParseInfo.
+      bool is_asm =
+          UseAsmWasm(literal, parse_info->flags().is_asm_wasm_broken());
+      (is_asm ? serial_items : items).emplace_back(literal, shared_info);
+    }
+    functions_to_compile.clear();
+
+    if (items.size() >= kMinEagerInnerFunctionsForParallelCompile) {
+      std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserVisible,
+          std::make_unique<EagerInnerFunctionCompileJob>(
+              isolate_for_local_isolate, isolate, parse_info, script,
+              allocator, stack_size, &items));
+      ParkedScope parked_scope(isolate);
+      job_handle->Join();
+    }
+    std::move(items.begin(), items.end(), std::back_inserter(serial_items));
+
+    for (EagerInnerFunctionCompileItem& item : serial_items) {
+      if (!item.job) {
+        // Not executed in parallel, or failed there, e.g. because of the
+        // smaller stack of the worker. Retry here, where failures are
+        // reported as usual.
+        item.eager_inner_literals.clear();
+        item.job = ExecuteSingleUnoptimizedCompilationJob(
+            parse_info, item.literal, script, allocator,
+            &item.eager_inner_literals, isolate);
+        if (!item.job) return false;
+      }
+      if (!FinalizeExecutedUnoptimizedCompilationJob(
+              isolate, std::move(item.job), item.literal, item.shared_info,
+              outer_shared_info, is_compiled_scope,
+              finalize_unoptimized_compilation_data_list,
+              jobs_to_retry_finalization_on_main_thread)) {
+        return false;
+      }
+      functions_to_compile.insert(functions_to_compile.end(),
+                                  item.eager_inner_literals.begin(),
+                                  item.eager_inner_literals.end());
     }
   }
 
@@ -917,7 +1126,18 @@ class OptimizedCodeCache : public AllStatic {
       DCHECK_EQ(it.current_bytecode(), interpreter::Bytecode::kJumpLoop);
       base::Optional<CodeT> maybe_code =
           feedback_vector.GetOptimizedOsrCode(isolate, it.GetSlotOperand(2));
-      if (maybe_code.has_value()) code = maybe_code.value();
+      if (maybe_code.has_value()) {
+        code = maybe_code.value();
+      } else if (FLAG_osr_code_cache) {
+        code = OSROptimizedCodeCache::cast(
+                   function->native_context().osr_code_cache())
+                   .TryGet(shared, osr_offset, code_kind, isolate);
+        // Install the code in the feedback vector, so that the next JumpLoop
+        // of this closure finds it without calling into the runtime.
+        if (!code.is_null()) {
+          feedback_vector.SetOptimizedOsrCode(it.GetSlotOperand(2), code);
+        }
+      }
     } else {
       feedback_vector.EvictOptimizedCodeMarkedForDeoptimization(
           shared, "OptimizedCodeCache::Get");
@@ -953,11 +1173,20 @@ class OptimizedCodeCache : public AllStatic {
       interpreter::BytecodeArrayIterator it(bytecode, osr_offset.ToInt());
       DCHECK_EQ(it.current_bytecode(), interpreter::Bytecode::kJumpLoop);
       feedback_vector.SetOptimizedOsrCode(it.GetSlotOperand(2), code);
+      if (FLAG_osr_code_cache) {
+        OSROptimizedCodeCache::Insert(
+            isolate, handle(function.native_context(), isolate),
+            handle(shared, isolate), handle(code, isolate), osr_offset);
+      }
       return;
     }
 
     DCHECK(!IsOSR(osr_offset));
 
+    if (FLAG_code_cache_tiering_hints && kind == CodeKind::TURBOFAN) {
+      function.shared().set_turbofan_tier_up_hint(true);
+    }
+
     if (is_function_context_specializing) {
       // Function context specialization folds-in the function context, so no
       // sharing can occur. Make sure the optimized code cache is cleared.
@@ -1138,9 +1367,10 @@ MaybeHandle<CodeT> CompileTurbofan(Isolate* isolate,
 #ifdef V8_ENABLE_MAGLEV
 // TODO(v8:7700): Record maglev compilations better.
 void RecordMaglevFunctionCompilation(Isolate* isolate,
-                                     Handle<JSFunction> function) {
-  Handle<AbstractCode> abstract_code(
-      AbstractCode::cast(FromCodeT(function->code())), isolate);
+                                     Handle<JSFunction> function,
+                                     Handle<CodeT> code) {
+  Handle<AbstractCode> abstract_code(AbstractCode::cast(FromCodeT(*code)),
+                                     isolate);
   Handle<SharedFunctionInfo> shared(function->shared(), isolate);
   Handle<Script> script(Script::cast(shared->script()), isolate);
   Handle<FeedbackVector> feedback_vector(function->feedback_vector(), isolate);
@@ -1162,8 +1392,6 @@ MaybeHandle<CodeT> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
 #ifdef V8_ENABLE_MAGLEV
   DCHECK(FLAG_maglev);
   // TODO(v8:7700): Add missing support.
-  CHECK(!IsOSR(osr_offset));
-  CHECK(osr_frame == nullptr);
   CHECK(result_behavior == CompileResultBehavior::kDefault);
 
   // TODO(v8:7700): Tracing, see CompileTurbofan.
@@ -1178,12 +1406,12 @@ MaybeHandle<CodeT> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
   // ...
 
   // Prepare the job.
-  auto job = maglev::MaglevCompilationJob::New(isolate, function);
+  auto job = maglev::MaglevCompilationJob::New(isolate, function, osr_offset);
   CompilationJob::Status status = job->PrepareJob(isolate);
   CHECK_EQ(status, CompilationJob::SUCCEEDED);  // TODO(v8:7700): Use status.
 
   if (IsSynchronous(mode)) {
-    function->reset_tiering_state();
+    ResetTieringState(*function, osr_offset);
     {
       // Park the main thread Isolate here, to be in the same state as
       // background threads.
@@ -1199,11 +1427,11 @@ MaybeHandle<CodeT> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
       return {};
     }
 
-    RecordMaglevFunctionCompilation(isolate, function);
+    RecordMaglevFunctionCompilation(isolate, function, job->code());
     const bool kIsContextSpecializing = false;
-    OptimizedCodeCache::Insert(isolate, *function, osr_offset, function->code(),
+    OptimizedCodeCache::Insert(isolate, *function, osr_offset, *job->code(),
                                kIsContextSpecializing);
-    return handle(function->code(), isolate);
+    return job->code();
   }
 
   DCHECK(IsConcurrent(mode));
@@ -1277,6 +1505,29 @@ MaybeHandle<CodeT> GetOrCompileOptimized(
   }
 }
 
+// Outermost loops in functions that are still waiting for their Maglev
+// compilation can enter Maglev code early. All other OSR requests target
+// Turbofan.
+CodeKind OsrTargetCodeKind(Isolate* isolate, Handle<JSFunction> function,
+                           BytecodeOffset osr_offset) {
+  if (!FLAG_maglev_osr || function->shared().maglev_compilation_failed()) {
+    return CodeKind::TURBOFAN;
+  }
+  TieringState state = function->tiering_state();
+  if (!IsRequestMaglev_Synchronous(state) &&
+      !IsRequestMaglev_Concurrent(state)) {
+    return CodeKind::TURBOFAN;
+  }
+  Handle<BytecodeArray> bytecode(function->shared().GetBytecodeArray(isolate),
+                                 isolate);
+  interpreter::BytecodeArrayIterator it(bytecode, osr_offset.ToInt());
+  DCHECK_EQ(it.current_bytecode(), interpreter::Bytecode::kJumpLoop);
+  // Maglev does not peel outer loops, see
+  // MaglevGraphBuilder::BuildOsrFrameInitialization.
+  const int loop_depth = it.GetImmediateOperand(1);
+  return loop_depth == 0 ? CodeKind::MAGLEV : CodeKind::TURBOFAN;
+}
+
 // When --stress-concurrent-inlining is enabled, spawn concurrent jobs in
 // addition to non-concurrent compiles to increase coverage in mjsunit tests
 // (where most interesting compiles are non-concurrent). The result of the
@@ -1437,6 +1688,8 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
   TimerEventScope<TimerEventCompileCode> top_level_timer(isolate);
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   DCHECK_EQ(ThreadId::Current(), isolate->thread_id());
+  ContextCpuTimeScope cpu_time_scope(isolate,
+                                     ContextCpuTime::Activity::kCompile);
 
   PostponeInterruptsScope postpone(isolate);
   DCHECK(!isolate->native_context().is_null());
@@ -1719,12 +1972,21 @@ void BackgroundCompileTask::Run(
           input_shared_info_.ToHandleChecked());
     }
 
-    if (IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
-            isolate, shared_info, script_, &info, reusable_state->allocator(),
-            &is_compiled_scope_, &finalize_unoptimized_compilation_data_,
-            &jobs_to_retry_finalization_on_main_thread_)) {
-      maybe_result = shared_info;
+    bool success;
+    if (!isolate->is_main_thread() &&
+        CanExecuteEagerInnerFunctionsInParallel(&info)) {
+      success = ParallelExecuteAndFinalizeUnoptimizedCompilationJobs(
+          isolate_for_local_isolate_, isolate, shared_info, script_, &info,
+          reusable_state->allocator(), stack_size_, &is_compiled_scope_,
+          &finalize_unoptimized_compilation_data_,
+          &jobs_to_retry_finalization_on_main_thread_);
+    } else {
+      success = IterativelyExecuteAndFinalizeUnoptimizedCompilationJobs(
+          isolate, shared_info, script_, &info, reusable_state->allocator(),
+          &is_compiled_scope_, &finalize_unoptimized_compilation_data_,
+          &jobs_to_retry_finalization_on_main_thread_);
     }
+    if (success) maybe_result = shared_info;
   }
 
   if (maybe_result.is_null()) {
@@ -1865,14 +2127,50 @@ void BackgroundDeserializeTask::Run() {
   Handle<SharedFunctionInfo> inner_result;
   off_thread_data_ =
       CodeSerializer::StartDeserializeOffThread(&isolate, &cached_data_);
+  if (background_merge_task_.HasPendingBackgroundWork() &&
+      off_thread_data_.HasResult()) {
+    background_merge_task_.BeginMergeInBackground(
+        &isolate, off_thread_data_.GetOnlyScript());
+  }
+}
+
+void BackgroundDeserializeTask::SourceTextAvailable(
+    Isolate* isolate, Handle<String> source_text,
+    const ScriptDetails& script_details) {
+  DCHECK_EQ(isolate, isolate_for_local_isolate_);
+  if (!FLAG_merge_background_deserialized_script_with_compilation_cache) {
+    return;
+  }
+  LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
+  background_merge_task_.SetUpOnMainThread(isolate, source_text,
+                                           script_details, language_mode);
+}
+
+bool BackgroundDeserializeTask::ShouldMergeWithExistingScript() const {
+  return background_merge_task_.HasPendingBackgroundWork() &&
+         off_thread_data_.HasResult();
+}
+
+void BackgroundDeserializeTask::MergeWithExistingScript() {
+  DCHECK(ShouldMergeWithExistingScript());
+  LocalIsolate isolate(isolate_for_local_isolate_, ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&isolate);
+  LocalHandleScope handle_scope(&isolate);
+  background_merge_task_.BeginMergeInBackground(
+      &isolate, off_thread_data_.GetOnlyScript());
 }
 
 MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
     Isolate* isolate, Handle<String> source,
     ScriptOriginOptions origin_options) {
+  // The background step of the merge never ran. Rather than doing it on the
+  // main thread, publish the deserialized script as a new one.
+  if (background_merge_task_.HasPendingBackgroundWork()) {
+    background_merge_task_.Abandon();
+  }
   return CodeSerializer::FinishOffThreadDeserialize(
       isolate, std::move(off_thread_data_), &cached_data_, source,
-      origin_options);
+      origin_options, &background_merge_task_);
 }
 
 // ----------------------------------------------------------------------------
@@ -1995,12 +2293,29 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   DCHECK(!shared_info->HasBytecodeArray());
 
   VMState<BYTECODE_COMPILER> state(isolate);
+  ContextCpuTimeScope cpu_time_scope(isolate,
+                                     ContextCpuTime::Activity::kCompile);
   PostponeInterruptsScope postpone(isolate);
   TimerEventScope<TimerEventCompileCode> compile_timer(isolate);
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileFunction);
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->bytecode_was_flushed()) {
+    isolate->counters()->bytecode_flush_recompiles()->Increment();
+    shared_info->set_bytecode_was_flushed(false);
+  }
+
+  // Functions whose bytecode was left in a section of the code cache they
+  // were deserialized from don't need to be parsed. Their bytecode may not
+  // have source positions.
+  if (create_source_positions_flag == CreateSourcePositions::kNo &&
+      CodeSerializer::DeserializeLazyFunction(isolate, shared_info)) {
+    *is_compiled_scope = shared_info->is_compiled_scope(isolate);
+    DCHECK(is_compiled_scope->is_compiled());
+    return true;
+  }
+
   Handle<Script> script(Script::cast(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -2960,6 +3275,32 @@ MaybeHandle<SharedFunctionInfo> CompileScriptOnBothBackgroundAndMainThread(
   return maybe_result;
 }
 
+// Deserializes the script from the process-wide script cache if another
+// isolate compiled it before.
+MaybeHandle<SharedFunctionInfo> LookupProcessWideScriptCache(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details, IsCompiledScope* is_compiled_scope) {
+  ProcessWideScriptCache* cache = ProcessWideScriptCache::Get();
+  std::shared_ptr<const ProcessWideScriptCache::Data> data =
+      cache->Lookup(isolate, source, script_details);
+  if (!data) return {};
+
+  NestedTimedHistogramScope timer(isolate->counters()->compile_deserialize());
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+  AlignedCachedData cached_data(data->data(), static_cast<int>(data->size()));
+  Handle<SharedFunctionInfo> result;
+  if (CodeSerializer::Deserialize(isolate, &cached_data, source,
+                                  script_details.origin_options)
+          .ToHandle(&result)) {
+    *is_compiled_scope = result->is_compiled_scope(isolate);
+    if (is_compiled_scope->is_compiled()) return result;
+  }
+  // The data doesn't fit this isolate, e.g. because it was created with
+  // different flags.
+  cache->Remove(data);
+  return {};
+}
+
 MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     Isolate* isolate, Handle<String> source,
     const ScriptDetails& script_details, v8::Extension* extension,
@@ -3010,6 +3351,13 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
   // nor put the compilation result back into the cache.
   const bool use_compilation_cache =
       extension == nullptr && script_details.repl_mode == REPLMode::kNo;
+  // Only scripts that are compiled without embedder-provided cached data and
+  // with the default options are shared with other isolates.
+  const bool use_process_wide_script_cache =
+      FLAG_process_wide_script_cache && use_compilation_cache &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      natives == NOT_NATIVES_CODE &&
+      ProcessWideScriptCache::CanCache(source, script_details);
   MaybeHandle<SharedFunctionInfo> maybe_result;
   IsCompiledScope is_compiled_scope;
   if (use_compilation_cache) {
@@ -3024,6 +3372,12 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         compilation_cache->LookupScript(source, script_details, language_mode);
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
+      if (deserialize_task && deserialize_task->HasPendingForegroundMerge()) {
+        // The code cache may have compiled functions that the cached script
+        // hasn't compiled (yet or anymore); hand them over.
+        USE(deserialize_task->Finish(isolate, source,
+                                     script_details.origin_options));
+      }
     } else if (can_consume_code_cache) {
       compile_timer.set_consuming_code_cache();
       // Then check cached code provided by embedder.
@@ -3055,6 +3409,15 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (use_process_wide_script_cache) {
+      // Then check whether another isolate compiled the script.
+      maybe_result = LookupProcessWideScriptCache(
+          isolate, source, script_details, &is_compiled_scope);
+      Handle<SharedFunctionInfo> result;
+      if (maybe_result.ToHandle(&result)) {
+        // Promote to per-isolate compilation cache.
+        compilation_cache->PutScript(source, language_mode, result);
+      }
     }
   }
 
@@ -3088,6 +3451,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (use_process_wide_script_cache) {
+        ProcessWideScriptCache::Get()->Put(isolate, source, script_details,
+                                           result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -3390,8 +3757,10 @@ MaybeHandle<CodeT> Compiler::CompileOptimizedOSR(Isolate* isolate,
   function->feedback_vector().reset_osr_urgency();
 
   CompilerTracer::TraceOptimizeOSRStarted(isolate, function, osr_offset, mode);
-  MaybeHandle<CodeT> result = GetOrCompileOptimized(
-      isolate, function, mode, CodeKind::TURBOFAN, osr_offset, frame);
+  MaybeHandle<CodeT> result =
+      GetOrCompileOptimized(isolate, function, mode,
+                            OsrTargetCodeKind(isolate, function, osr_offset),
+                            osr_offset, frame);
 
   if (result.is_null()) {
     CompilerTracer::TraceOptimizeOSRUnavailable(isolate, function, osr_offset,
@@ -3414,6 +3783,21 @@ void Compiler::DisposeTurbofanCompilationJob(TurbofanCompilationJob* job,
   }
 }
 
+namespace {
+
+// Returns whether the debugger needs the function compiled by {info}, or any
+// of the functions inlined into it, to run unoptimized.
+bool IsBeingDebugged(Isolate* isolate, OptimizedCompilationInfo* info) {
+  if (isolate->debug()->needs_check_on_function_call()) return true;
+  if (info->shared_info()->HasBreakInfo()) return true;
+  for (const auto& inlined : info->inlined_functions()) {
+    if (inlined.shared_info->HasBreakInfo()) return true;
+  }
+  return false;
+}
+
+}  // namespace
+
 // static
 bool Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
                                               Isolate* isolate) {
@@ -3435,16 +3819,18 @@ bool Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
     ResetProfilerTicks(*function, osr_offset);
   }
 
-  DCHECK(!shared->HasBreakInfo());
-
   // 1) Optimization on the concurrent thread may have failed.
   // 2) The function may have already been optimized by OSR.  Simply continue.
   //    Except when OSR already disabled optimization for some reason.
   // 3) The code may have already been invalidated due to dependency change.
   // 4) Code generation may have failed.
+  // 5) The debugger may have set break points in the function or in one of the
+  //    inlined functions since the job was started.
   if (job->state() == CompilationJob::State::kReadyToFinalize) {
     if (shared->optimization_disabled()) {
       job->RetryOptimization(BailoutReason::kOptimizationDisabled);
+    } else if (IsBeingDebugged(isolate, compilation_info)) {
+      job->RetryOptimization(BailoutReason::kFunctionBeingDebugged);
     } else if (job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
       job->RecordCompilationStats(ConcurrencyMode::kConcurrent, isolate);
       job->RecordFunctionCompilation(LogEventListener::LAZY_COMPILE_TAG,
@@ -3483,10 +3869,25 @@ bool Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
                                             Isolate* isolate) {
 #ifdef V8_ENABLE_MAGLEV
   VMState<COMPILER> state(isolate);
+  Handle<JSFunction> function = job->function();
+  const BytecodeOffset osr_offset = job->osr_offset();
+  // OSR jobs block further OSR attempts for the function until they are done.
+  if (IsOSR(osr_offset)) ResetTieringState(*function, osr_offset);
+  if (job->state() != CompilationJob::State::kSucceeded) {
+    return CompilationJob::FAILED;
+  }
+  // The debugger may have set break points since the job was started.
+  if (isolate->debug()->needs_check_on_function_call() ||
+      function->shared().HasBreakInfo()) {
+    return CompilationJob::FAILED;
+  }
   const bool kIsContextSpecializing = false;
-  OptimizedCodeCache::Insert(isolate, *job->function(), BytecodeOffset::None(),
-                             job->function()->code(), kIsContextSpecializing);
-  RecordMaglevFunctionCompilation(isolate, job->function());
+  OptimizedCodeCache::Insert(isolate, *function, osr_offset, *job->code(),
+                             kIsContextSpecializing);
+  RecordMaglevFunctionCompilation(isolate, function, job->code());
+  if (IsOSR(osr_offset)) {
+    CompilerTracer::TraceOptimizeOSRFinished(isolate, function, osr_offset);
+  }
 #endif
   return CompilationJob::SUCCEEDED;
 }
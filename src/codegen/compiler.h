@@ -11,6 +11,7 @@
 #include "src/ast/ast-value-factory.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/small-vector.h"
+#include "src/codegen/background-merge-task.h"
 #include "src/codegen/bailout-reason.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -125,7 +126,8 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   static bool FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
                                              Isolate* isolate);
 
-  // Finalize and install Maglev code from a previously run job.
+  // Finalize and install Maglev code from a previously run job. Also called
+  // for jobs that failed to finalize, to clear their pending OSR state.
   static bool FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
                                            Isolate* isolate);
 
@@ -336,6 +338,10 @@ class UnoptimizedCompilationJob : public CompilationJob {
 
   uintptr_t stack_limit() const { return stack_limit_; }
 
+  // Overrides the stack limit taken from the ParseInfo, for jobs executed on
+  // another thread than the one that parsed.
+  void set_stack_limit(uintptr_t stack_limit) { stack_limit_ = stack_limit; }
+
   base::TimeDelta time_taken_to_execute() const {
     return time_taken_to_execute_;
   }
@@ -605,6 +611,26 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
 
   void Run();
 
+  // Prepares merging the deserialized script into the script that the
+  // compilation cache has for |source_text|, if any. Must be called on the
+  // main thread, and not while Run is running.
+  void SourceTextAvailable(Isolate* isolate, Handle<String> source_text,
+                           const ScriptDetails& script_details);
+
+  // Whether the background step of the merge is still to be done, because
+  // SourceTextAvailable was called after Run.
+  bool ShouldMergeWithExistingScript() const;
+
+  // Runs the background step of the merge. Must be called on a background
+  // thread.
+  void MergeWithExistingScript();
+
+  // Whether Finish would hand the deserialized functions over to the script
+  // in the compilation cache.
+  bool HasPendingForegroundMerge() const {
+    return background_merge_task_.HasPendingForegroundWork();
+  }
+
   MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
                                          Handle<String> source,
                                          ScriptOriginOptions origin_options);
@@ -615,6 +641,7 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   Isolate* isolate_for_local_isolate_;
   AlignedCachedData cached_data_;
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
+  BackgroundMergeTask background_merge_task_;
 };
 
 }  // namespace internal
@@ -108,6 +108,9 @@ class StatsCounter;
   V(address_of_shared_string_table_flag, "FLAG_shared_string_table")           \
   V(address_of_the_hole_nan, "the_hole_nan")                                   \
   V(address_of_uint32_bias, "uint32_bias")                                     \
+  V(array_indexof_includes_double, "array_indexof_includes_double")            \
+  V(array_indexof_includes_smi_or_object,                                      \
+    "array_indexof_includes_smi_or_object")                                    \
   V(baseline_pc_for_bytecode_offset, "BaselinePCForBytecodeOffset")            \
   V(baseline_pc_for_next_executed_bytecode,                                    \
     "BaselinePCForNextExecutedBytecode")                                       \
@@ -294,6 +297,10 @@ class StatsCounter;
     "RegExpMacroAssembler::CaseInsensitiveCompareNonUnicode()")                \
   V(re_is_character_in_range_array,                                            \
     "RegExpMacroAssembler::IsCharacterInRangeArray()")                         \
+  V(re_find_characters_one_byte,                                               \
+    "RegExpMacroAssembler::FindCharactersOneByte()")                           \
+  V(re_find_characters_two_byte,                                               \
+    "RegExpMacroAssembler::FindCharactersTwoByte()")                           \
   V(re_check_stack_guard_state,                                                \
     "RegExpMacroAssembler*::CheckStackGuardState()")                           \
   V(re_grow_stack, "NativeRegExpMacroAssembler::GrowStack()")                  \
@@ -289,6 +289,14 @@ class MachineType {
         return MachineType::AnyTagged();
       case CTypeInfo::Type::kBool:
         return MachineType::Bool();
+      case CTypeInfo::Type::kInt8:
+        return MachineType::Int8();
+      case CTypeInfo::Type::kUint8:
+        return MachineType::Uint8();
+      case CTypeInfo::Type::kInt16:
+        return MachineType::Int16();
+      case CTypeInfo::Type::kUint16:
+        return MachineType::Uint16();
       case CTypeInfo::Type::kInt32:
         return MachineType::Int32();
       case CTypeInfo::Type::kUint32:
@@ -309,6 +317,9 @@ class MachineType {
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
+        return MachineType::Pointer();
     }
   }
 
@@ -12,6 +12,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/codegen/tick-counter.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/execution/frames.h"
 #include "src/handles/handles.h"
@@ -186,6 +187,11 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
 
   unsigned inlined_bytecode_size() const { return inlined_bytecode_size_; }
 
+  // The profiler ticks of the function when the job was prepared, or -1 if
+  // unknown. Used to estimate how hot the function is.
+  int profiler_ticks() const { return profiler_ticks_; }
+  void set_profiler_ticks(int ticks) { profiler_ticks_ = ticks; }
+
   void set_inlined_bytecode_size(unsigned size) {
     inlined_bytecode_size_ = size;
   }
@@ -207,6 +213,25 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   using InlinedFunctionList = std::vector<InlinedFunctionHolder>;
   InlinedFunctionList& inlined_functions() { return inlined_functions_; }
 
+  // Functions that were inlined into this function in a previous run, taken
+  // from --tiering-profile-input. See TieringProfile.
+  const std::vector<Handle<SharedFunctionInfo>>& profiled_inlinees() const {
+    return profiled_inlinees_;
+  }
+  void set_profiled_inlinees(
+      std::vector<Handle<SharedFunctionInfo>> profiled_inlinees) {
+    profiled_inlinees_ = std::move(profiled_inlinees);
+  }
+
+  // Sites that deoptimized repeatedly for the same reason, taken from the
+  // isolate's DeoptHistory.
+  const std::vector<DeoptLoopSite>& deopt_loop_sites() const {
+    return deopt_loop_sites_;
+  }
+  void set_deopt_loop_sites(std::vector<DeoptLoopSite> deopt_loop_sites) {
+    deopt_loop_sites_ = std::move(deopt_loop_sites);
+  }
+
   // Returns the inlining id for source position tracking.
   int AddInlinedFunction(Handle<SharedFunctionInfo> inlined_function,
                          Handle<BytecodeArray> inlined_bytecode,
@@ -286,10 +311,13 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   BailoutReason bailout_reason_ = BailoutReason::kNoReason;
 
   InlinedFunctionList inlined_functions_;
+  std::vector<Handle<SharedFunctionInfo>> profiled_inlinees_;
+  std::vector<DeoptLoopSite> deopt_loop_sites_;
 
   static constexpr int kNoOptimizationId = -1;
   const int optimization_id_;
   unsigned inlined_bytecode_size_ = 0;
+  int profiler_ticks_ = -1;
 
   base::Vector<const char> debug_name_;
   std::unique_ptr<char[]> trace_turbo_filename_;
@@ -0,0 +1,195 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/process-wide-script-cache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The number of code units at the start and the end of the source that are
+// hashed. The hash only distributes the entries, the sources are compared in
+// full on lookup.
+constexpr int kHashedCodeUnits = 256;
+
+template <typename Char>
+size_t HashSource(base::Vector<const Char> chars) {
+  size_t length = chars.size();
+  size_t hashed = std::min(length, static_cast<size_t>(kHashedCodeUnits));
+  return base::hash_combine(
+      length, base::hash_range(chars.begin(), chars.begin() + hashed),
+      base::hash_range(chars.end() - hashed, chars.end()));
+}
+
+size_t HashSource(const String::FlatContent& content) {
+  return content.IsOneByte() ? HashSource(content.ToOneByteVector())
+                             : HashSource(content.ToUC16Vector());
+}
+
+// The code units of the source as bytes.
+base::Vector<const uint8_t> SourceBytes(const String::FlatContent& content) {
+  if (content.IsOneByte()) return content.ToOneByteVector();
+  return base::Vector<const uint8_t>::cast(content.ToUC16Vector());
+}
+
+bool HasScriptName(const ScriptDetails& script_details) {
+  return !script_details.name_obj.is_null();
+}
+
+std::string ScriptName(const ScriptDetails& script_details) {
+  Handle<Object> name;
+  if (!script_details.name_obj.ToHandle(&name)) return std::string();
+  int length = 0;
+  std::unique_ptr<char[]> chars = String::cast(*name).ToCString(
+      ALLOW_NULLS, ROBUST_STRING_TRAVERSAL, &length);
+  return std::string(chars.get(), length);
+}
+
+}  // namespace
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProcessWideScriptCache,
+                                ProcessWideScriptCache::Get)
+
+// static
+bool ProcessWideScriptCache::CanCache(Handle<String> source,
+                                      const ScriptDetails& script_details) {
+  if (source->length() < kMinSourceLength) return false;
+  // A script name that isn't a string can't be compared across isolates.
+  Handle<Object> name;
+  if (script_details.name_obj.ToHandle(&name) && !name->IsString()) {
+    return false;
+  }
+  // The embedder may pass different values to each isolate.
+  if (!script_details.source_map_url.is_null()) return false;
+  Handle<Object> host_defined_options;
+  if (script_details.host_defined_options.ToHandle(&host_defined_options) &&
+      FixedArray::cast(*host_defined_options).length() > 0) {
+    return false;
+  }
+  return true;
+}
+
+std::list<ProcessWideScriptCache::Entry>::iterator
+ProcessWideScriptCache::Find(Isolate* isolate, Handle<String> source,
+                             const ScriptDetails& script_details) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(source->IsFlat());
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  size_t hash = HashSource(content);
+  bool has_name = HasScriptName(script_details);
+  std::string name = ScriptName(script_details);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->hash != hash || it->is_one_byte != content.IsOneByte()) continue;
+    if (it->has_name != has_name || it->name != name) continue;
+    if (it->line_offset != script_details.line_offset ||
+        it->column_offset != script_details.column_offset ||
+        it->origin_options != script_details.origin_options.Flags()) {
+      continue;
+    }
+    base::Vector<const uint8_t> bytes = SourceBytes(content);
+    if (it->source.size() != bytes.size() ||
+        memcmp(it->source.data(), bytes.begin(), bytes.size()) != 0) {
+      continue;
+    }
+    return it;
+  }
+  return entries_.end();
+}
+
+std::shared_ptr<const ProcessWideScriptCache::Data>
+ProcessWideScriptCache::Lookup(Isolate* isolate, Handle<String> source,
+                               const ScriptDetails& script_details) {
+  DCHECK(CanCache(source, script_details));
+  source = String::Flatten(isolate, source);
+  base::MutexGuard guard(&mutex_);
+  auto it = Find(isolate, source, script_details);
+  if (it == entries_.end()) {
+    isolate->counters()->process_wide_script_cache_misses()->Increment();
+    return nullptr;
+  }
+  isolate->counters()->process_wide_script_cache_hits()->Increment();
+  return it->data;
+}
+
+void ProcessWideScriptCache::Put(Isolate* isolate, Handle<String> source,
+                                 const ScriptDetails& script_details,
+                                 Handle<SharedFunctionInfo> shared) {
+  DCHECK(CanCache(source, script_details));
+  DCHECK(shared->is_toplevel());
+  source = String::Flatten(isolate, source);
+  {
+    base::MutexGuard guard(&mutex_);
+    if (Find(isolate, source, script_details) != entries_.end()) return;
+  }
+
+  // Serialize without holding the lock, another isolate may have added the
+  // script in the meantime.
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(shared));
+  if (!cached_data) return;
+
+  Entry entry;
+  entry.data = std::make_shared<const Data>(
+      cached_data->data, cached_data->data + cached_data->length);
+  entry.has_name = HasScriptName(script_details);
+  entry.name = ScriptName(script_details);
+  entry.line_offset = script_details.line_offset;
+  entry.column_offset = script_details.column_offset;
+  entry.origin_options = script_details.origin_options.Flags();
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    entry.hash = HashSource(content);
+    entry.is_one_byte = content.IsOneByte();
+    base::Vector<const uint8_t> bytes = SourceBytes(content);
+    entry.source.assign(bytes.begin(), bytes.end());
+  }
+
+  base::MutexGuard guard(&mutex_);
+  if (Find(isolate, source, script_details) != entries_.end()) return;
+  size_ += entry.size();
+  entries_.push_back(std::move(entry));
+  EvictIfNeeded();
+}
+
+void ProcessWideScriptCache::Remove(const std::shared_ptr<const Data>& data) {
+  base::MutexGuard guard(&mutex_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->data != data) continue;
+    size_ -= it->size();
+    entries_.erase(it);
+    return;
+  }
+}
+
+void ProcessWideScriptCache::Clear() {
+  base::MutexGuard guard(&mutex_);
+  entries_.clear();
+  size_ = 0;
+}
+
+void ProcessWideScriptCache::EvictIfNeeded() {
+  size_t max_size = FLAG_process_wide_script_cache_size * KB;
+  while (size_ > max_size && !entries_.empty()) {
+    size_ -= entries_.front().size();
+    entries_.pop_front();
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,98 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_PROCESS_WIDE_SCRIPT_CACHE_H_
+#define V8_CODEGEN_PROCESS_WIDE_SCRIPT_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+class String;
+struct ScriptDetails;
+
+// A cache of the code caches of top-level scripts that is shared by all
+// isolates of the process. Isolates that compile a script which another
+// isolate compiled before deserialize its code cache instead of parsing and
+// compiling the script again. Entries are keyed by the source and the origin
+// of the script, and are evicted in insertion order once the cache exceeds
+// --process-wide-script-cache-size.
+class V8_EXPORT_PRIVATE ProcessWideScriptCache final {
+ public:
+  using Data = std::vector<uint8_t>;
+
+  ProcessWideScriptCache() = default;
+  ProcessWideScriptCache(const ProcessWideScriptCache&) = delete;
+  ProcessWideScriptCache& operator=(const ProcessWideScriptCache&) = delete;
+
+  static ProcessWideScriptCache* Get();
+
+  // Whether the script can be cached at all. Scripts with embedder-specific
+  // details that are not part of the key are not.
+  static bool CanCache(Handle<String> source,
+                       const ScriptDetails& script_details);
+
+  // Returns the code cache for the script, or null if there is none.
+  std::shared_ptr<const Data> Lookup(Isolate* isolate, Handle<String> source,
+                                     const ScriptDetails& script_details);
+
+  // Serializes the compiled top-level |shared| of the script and adds it to
+  // the cache, unless the cache already has an entry for the script.
+  void Put(Isolate* isolate, Handle<String> source,
+           const ScriptDetails& script_details,
+           Handle<SharedFunctionInfo> shared);
+
+  // Removes |data| from the cache, e.g. because deserializing it failed.
+  void Remove(const std::shared_ptr<const Data>& data);
+
+  void Clear();
+
+  size_t size_for_testing() const { return size_; }
+
+  // Scripts shorter than this are compiled faster than they are serialized.
+  static constexpr int kMinSourceLength = 1 * KB;
+
+ private:
+  struct Entry {
+    size_t hash;
+    // The code units of the source.
+    bool is_one_byte;
+    std::vector<uint8_t> source;
+    // The origin of the script.
+    bool has_name;
+    std::string name;
+    int line_offset;
+    int column_offset;
+    int origin_options;
+
+    std::shared_ptr<const Data> data;
+
+    size_t size() const { return source.size() + data->size(); }
+  };
+
+  // Returns the entry for the flat |source|, or entries_.end(). Doesn't
+  // allocate.
+  std::list<Entry>::iterator Find(Isolate* isolate, Handle<String> source,
+                                  const ScriptDetails& script_details);
+  void EvictIfNeeded();
+
+  base::Mutex mutex_;
+  // Ordered from the oldest to the most recently added entry.
+  std::list<Entry> entries_;
+  size_t size_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_PROCESS_WIDE_SCRIPT_CACHE_H_
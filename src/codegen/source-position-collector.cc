@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/source-position-collector.h"
+
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles.h"
+#include "src/init/v8.h"
+#include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/tasks/cancelable-task.h"
+#include "src/tracing/trace-event.h"
+
+namespace v8 {
+namespace internal {
+
+class SourcePositionCollector::Task final : public CancelableTask {
+ public:
+  Task(Isolate* isolate, SourcePositionCollector* collector)
+      : CancelableTask(isolate), collector_(collector) {}
+
+  // CancelableTask overrides.
+  void RunInternal() override { collector_->CollectPending(); }
+
+ private:
+  SourcePositionCollector* const collector_;
+};
+
+SourcePositionCollector::~SourcePositionCollector() {
+  for (Handle<SharedFunctionInfo> shared : pending_) {
+    GlobalHandles::Destroy(shared.location());
+  }
+}
+
+void SourcePositionCollector::Schedule(Handle<SharedFunctionInfo> shared) {
+  if (!shared->CanCollectSourcePosition(isolate_)) return;
+  if (!task_pending_) {
+    auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+        reinterpret_cast<v8::Isolate*>(isolate_));
+    if (!taskrunner->NonNestableTasksEnabled()) return;
+    taskrunner->PostNonNestableTask(std::make_unique<Task>(isolate_, this));
+    task_pending_ = true;
+  }
+
+  if (pending_.size() >= kMaxPending) return;
+  for (Handle<SharedFunctionInfo> other : pending_) {
+    if (*other == *shared) return;
+  }
+  pending_.push_back(isolate_->global_handles()->Create(*shared));
+}
+
+void SourcePositionCollector::CollectPending() {
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate_, "v8", "V8.Task");
+  task_pending_ = false;
+  std::vector<Handle<SharedFunctionInfo>> pending;
+  pending.swap(pending_);
+  HandleScope scope(isolate_);
+  for (Handle<SharedFunctionInfo> shared : pending) {
+    // The positions might have been collected since, or the bytecode might
+    // have been flushed.
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(
+        isolate_, handle(*shared, isolate_));
+    GlobalHandles::Destroy(shared.location());
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
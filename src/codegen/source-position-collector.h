@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_SOURCE_POSITION_COLLECTOR_H_
+#define V8_CODEGEN_SOURCE_POSITION_COLLECTOR_H_
+
+#include <vector>
+
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+
+// Collects lazy source positions of functions which will likely need them
+// soon, e.g. because they are on the stack trace of an error, in a foreground
+// task instead of on the first access to Error.prototype.stack. Enabled with
+// --precollect-source-positions.
+class SourcePositionCollector final {
+ public:
+  explicit SourcePositionCollector(Isolate* isolate) : isolate_(isolate) {}
+  ~SourcePositionCollector();
+  SourcePositionCollector(const SourcePositionCollector&) = delete;
+  SourcePositionCollector& operator=(const SourcePositionCollector&) = delete;
+
+  // Schedules the collection of the source positions of {shared}, if they are
+  // not there yet.
+  void Schedule(Handle<SharedFunctionInfo> shared);
+
+ private:
+  class Task;
+
+  // Bounds the work of a single task, and the memory held by pending
+  // functions.
+  static constexpr size_t kMaxPending = 64;
+
+  void CollectPending();
+
+  Isolate* const isolate_;
+  // Global handles to the functions whose source positions are collected by
+  // the next task.
+  std::vector<Handle<SharedFunctionInfo>> pending_;
+  bool task_pending_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_SOURCE_POSITION_COLLECTOR_H_
@@ -968,6 +968,7 @@ enum class PageSize { kRegular, kLarge };
 enum class CodeFlushMode {
   kFlushBytecode,
   kFlushBaselineCode,
+  kFlushFeedbackVectors,
   kStressFlushCode,
 };
 
@@ -979,6 +980,11 @@ bool inline IsByteCodeFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.contains(CodeFlushMode::kFlushBytecode);
 }
 
+bool inline IsFeedbackVectorFlushingEnabled(
+    base::EnumSet<CodeFlushMode> mode) {
+  return mode.contains(CodeFlushMode::kFlushFeedbackVectors);
+}
+
 bool inline IsStressFlushingEnabled(base::EnumSet<CodeFlushMode> mode) {
   return mode.contains(CodeFlushMode::kStressFlushCode);
 }
@@ -1537,6 +1543,10 @@ class CompareOperationFeedback {
     kBigIntFlag = 1 << 7,
     kReceiverFlag = 1 << 8,
     kAnyMask = 0x1FF,
+    // The outcomes seen so far are recorded next to the operand types, so
+    // that the branch consuming the comparison can be laid out accordingly.
+    kTrueOutcomeFlag = 1 << 9,
+    kFalseOutcomeFlag = 1 << 10,
   };
 
  public:
@@ -1563,6 +1573,13 @@ class CompareOperationFeedback {
 
     kAny = kAnyMask,
   };
+
+  enum Outcome {
+    kNoOutcome = 0,
+    kTrueOutcome = kTrueOutcomeFlag,
+    kFalseOutcome = kFalseOutcomeFlag,
+    kAnyOutcome = kTrueOutcome | kFalseOutcome,
+  };
 };
 
 // Type feedback is encoded in such a way that, we can combine the feedback
@@ -413,8 +413,8 @@ void LazyCompileDispatcher::DoBackgroundWork(JobDelegate* delegate) {
       base::MutexGuard lock(&mutex_);
 
       if (pending_background_jobs_.empty()) break;
-      job = pending_background_jobs_.back();
-      pending_background_jobs_.pop_back();
+      job = pending_background_jobs_.front();
+      pending_background_jobs_.pop_front();
       DCHECK_EQ(job->state, Job::State::kPending);
 
       job->state = Job::State::kRunning;
@@ -476,8 +476,8 @@ LazyCompileDispatcher::Job* LazyCompileDispatcher::PopSingleFinalizeJob() {
 
   if (finalizable_jobs_.empty()) return nullptr;
 
-  Job* job = finalizable_jobs_.back();
-  finalizable_jobs_.pop_back();
+  Job* job = finalizable_jobs_.front();
+  finalizable_jobs_.pop_front();
   DCHECK(job->state == Job::State::kReadyToFinalize ||
          job->state == Job::State::kAborted);
   if (job->state == Job::State::kReadyToFinalize) {
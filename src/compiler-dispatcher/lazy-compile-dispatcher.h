@@ -6,6 +6,7 @@
 #define V8_COMPILER_DISPATCHER_LAZY_COMPILE_DISPATCHER_H_
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -62,6 +63,9 @@ class Handle;
 //
 // LazyCompileDispatcher::pending_background_jobs_ contains the set of
 // LazyCompilerDispatcherJobs that can be processed on a background thread.
+// Jobs are enqueued in source order while the script is parsed, and are
+// processed in that order, since functions near the top of a script tend to
+// be called first during startup.
 //
 // LazyCompileDispatcher::running_background_jobs_ contains the set of
 // LazyCompilerDispatcherJobs that are currently being processed on a background
@@ -109,6 +113,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, CompileInEnqueueOrder);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -203,11 +208,11 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // True if an idle task is scheduled to be run.
   bool idle_task_scheduled_;
 
-  // The set of jobs that can be run on a background thread.
-  std::vector<Job*> pending_background_jobs_;
+  // The queue of jobs that can be run on a background thread, oldest first.
+  std::deque<Job*> pending_background_jobs_;
 
-  // The set of jobs that can be finalized on the main thread.
-  std::vector<Job*> finalizable_jobs_;
+  // The queue of jobs that can be finalized on the main thread, oldest first.
+  std::deque<Job*> finalizable_jobs_;
 
   // The total number of jobs ready to execute on background, both those pending
   // and those currently running.
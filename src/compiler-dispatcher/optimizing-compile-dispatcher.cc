@@ -4,6 +4,9 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -54,13 +57,17 @@ class OptimizingCompileDispatcher::CompileTask : public CancelableTask {
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.OptimizeBackground");
 
-      if (dispatcher_->recompilation_delay_ != 0) {
-        base::OS::Sleep(base::TimeDelta::FromMilliseconds(
-            dispatcher_->recompilation_delay_));
+      // Keep compiling queued jobs, so that a limited number of tasks
+      // drains the whole queue.
+      for (;;) {
+        if (dispatcher_->recompilation_delay_ != 0) {
+          base::OS::Sleep(base::TimeDelta::FromMilliseconds(
+              dispatcher_->recompilation_delay_));
+        }
+        TurbofanCompilationJob* job = dispatcher_->NextInput(&local_isolate);
+        if (job == nullptr) break;
+        dispatcher_->CompileNext(job, &local_isolate);
       }
-
-      dispatcher_->CompileNext(dispatcher_->NextInput(&local_isolate),
-                               &local_isolate);
     }
     {
       base::MutexGuard lock_guard(&dispatcher_->ref_count_mutex_);
@@ -84,7 +91,11 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
+  if (input_queue_length_ == 0) {
+    // The calling task exits, so QueueForOptimization needs to post a new one.
+    running_tasks_--;
+    return nullptr;
+  }
   TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
   DCHECK_NOT_NULL(job);
   input_queue_shift_ = InputQueueIndex(1);
@@ -109,7 +120,12 @@ void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
     output_queue_.push(job);
   }
 
-  if (finalize()) isolate_->stack_guard()->RequestInstallCode();
+  if (!finalize()) return;
+  if (install_requested_.exchange(true, std::memory_order_acq_rel)) {
+    isolate_->counters()->install_code_requests_coalesced()->Increment();
+    return;
+  }
+  isolate_->stack_guard()->RequestInstallCode();
 }
 
 void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
@@ -180,6 +196,9 @@ void OptimizingCompileDispatcher::Stop() {
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  // Reset before draining the output queue, so that jobs finishing after the
+  // last pop below request a new interrupt.
+  install_requested_.store(false, std::memory_order_release);
 
   for (;;) {
     std::unique_ptr<TurbofanCompilationJob> job;
@@ -225,10 +244,31 @@ void OptimizingCompileDispatcher::QueueForOptimization(
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
     input_queue_[InputQueueIndex(input_queue_length_)] = job;
     input_queue_length_++;
+    // A running task picks up the job once it is done with its current one.
+    if (max_running_tasks_ > 0 && running_tasks_ >= max_running_tasks_) {
+      return;
+    }
+    running_tasks_++;
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
       std::make_unique<CompileTask>(isolate_, this));
 }
 
+void OptimizingCompileDispatcher::SetLimits(int max_queue_length,
+                                            double max_worker_share) {
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  max_input_queue_length_ =
+      max_queue_length > 0
+          ? std::min(max_queue_length, input_queue_capacity_)
+          : input_queue_capacity_;
+  max_running_tasks_ = 0;
+  if (max_worker_share > 0) {
+    int worker_threads = V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+    max_running_tasks_ = std::max(
+        1, static_cast<int>(std::ceil(std::min(max_worker_share, 1.0) *
+                                      worker_threads)));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
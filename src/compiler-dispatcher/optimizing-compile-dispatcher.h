@@ -28,6 +28,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
+        max_input_queue_length_(input_queue_capacity_),
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
@@ -46,9 +47,14 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return input_queue_length_ < max_input_queue_length_;
   }
 
+  // Limits the number of queued jobs to |max_queue_length| and the number of
+  // jobs compiled at the same time to |max_worker_share| of the platform's
+  // worker threads. Values of 0 remove the limits.
+  void SetLimits(int max_queue_length, double max_worker_share);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -87,16 +93,27 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Circular queue of incoming recompilation tasks (including OSR).
   TurbofanCompilationJob** input_queue_;
   int input_queue_capacity_;
+  int max_input_queue_length_;
   int input_queue_length_;
   int input_queue_shift_;
   base::Mutex input_queue_mutex_;
 
+  // Number of posted compile tasks that have not yet found the input queue
+  // empty, and the limit for it. Both are guarded by {input_queue_mutex_}.
+  int running_tasks_ = 0;
+  int max_running_tasks_ = 0;
+
   // Queue of recompilation tasks ready to be installed (excluding OSR).
   std::queue<TurbofanCompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // Whether an INSTALL_CODE interrupt has been requested and not yet handled.
+  // Jobs that finish while it is set are installed by that interrupt, so
+  // concurrent compilation requests at most one interrupt per batch.
+  std::atomic<bool> install_requested_{false};
+
   std::atomic<int> ref_count_;
   base::Mutex ref_count_mutex_;
   base::ConditionVariable ref_count_zero_;
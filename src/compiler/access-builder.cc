@@ -11,6 +11,7 @@
 #include "src/objects/arguments.h"
 #include "src/objects/cell.h"
 #include "src/objects/contexts.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/heap-number.h"
 #include "src/objects/js-collection.h"
 #include "src/objects/js-generator.h"
@@ -1272,6 +1273,20 @@ FieldAccess AccessBuilder::ForFeedbackVectorClosureFeedbackCellArray() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForCoverageInfoSlotBlockCount(int slot_index) {
+  FieldAccess access = {kTaggedBase,
+                        CoverageInfo::kHeaderSize +
+                            slot_index * CoverageInfo::Slot::kSize +
+                            CoverageInfo::Slot::kBlockCountOffset,
+                        Handle<Name>(),
+                        MaybeHandle<Map>(),
+                        TypeCache::Get()->kInt32,
+                        MachineType::Int32(),
+                        kNoWriteBarrier};
+  return access;
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
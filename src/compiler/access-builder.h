@@ -346,6 +346,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   static FieldAccess ForFeedbackVectorFlags();
   static FieldAccess ForFeedbackVectorClosureFeedbackCellArray();
 
+  // Provides access to the block count of a CoverageInfo slot.
+  static FieldAccess ForCoverageInfoSlotBlockCount(int slot_index);
+
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(AccessBuilder);
 };
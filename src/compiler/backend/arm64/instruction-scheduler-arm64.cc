@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
@@ -368,9 +369,91 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies in cycles of the instructions whose cost varies noticeably
+// between cores. The per-core numbers approximate the vendors' optimization
+// guides; the generic model contains the empirical values that were used
+// before the models were split by core.
+struct LatencyModel {
+  const char* name;
+  int alu_shifted_operand;
+  int load;
+  int int32_multiply;
+  int int64_multiply;
+  int int32_divide;
+  int int64_divide;
+  int float_add;
+  int float_abs_neg_cmp;
+  int float32_divide_sqrt;
+  int float64_divide_sqrt;
+  int float_round;
+  int float_convert;
+};
+
+constexpr LatencyModel kGenericModel = {
+    "generic", 3, 11, 3, 5, 12, 20, 5, 3, 12, 19, 5, 5};
+// In-order cores: Cortex-A53 and Cortex-A55.
+constexpr LatencyModel kCortexA53Model = {
+    "cortex-a53", 2, 3, 3, 4, 12, 20, 4, 3, 12, 22, 4, 4};
+// Out-of-order cores from Cortex-A57 up to Cortex-A75.
+constexpr LatencyModel kCortexA72Model = {
+    "cortex-a72", 2, 4, 3, 3, 12, 20, 4, 3, 11, 18, 3, 3};
+// Wide out-of-order cores: Cortex-A76 and later, Neoverse and Apple cores.
+constexpr LatencyModel kCortexA76Model = {
+    "cortex-a76", 2, 4, 2, 2, 12, 20, 2, 2, 10, 15, 3, 3};
+
+const LatencyModel* SelectLatencyModel() {
+  const LatencyModel* model = &kGenericModel;
+#if V8_HOST_ARCH_ARM64 && !defined(USE_SIMULATOR)
+#if V8_OS_DARWIN
+  model = &kCortexA76Model;
+#else
+  base::CPU cpu;
+  if (cpu.implementer() == base::CPU::kArm) {
+    switch (cpu.part()) {
+      case base::CPU::kArmCortexA53:
+      case base::CPU::kArmCortexA55:
+        model = &kCortexA53Model;
+        break;
+      case base::CPU::kArmCortexA57:
+      case base::CPU::kArmCortexA72:
+      case base::CPU::kArmCortexA73:
+      case base::CPU::kArmCortexA75:
+        model = &kCortexA72Model;
+        break;
+      case base::CPU::kArmCortexA76:
+      case base::CPU::kArmNeoverseN1:
+      case base::CPU::kArmCortexA77:
+      case base::CPU::kArmNeoverseV1:
+      case base::CPU::kArmCortexA78:
+      case base::CPU::kArmCortexX1:
+      case base::CPU::kArmCortexA710:
+      case base::CPU::kArmCortexX2:
+      case base::CPU::kArmNeoverseN2:
+        model = &kCortexA76Model;
+        break;
+      default:
+        break;
+    }
+  }
+#endif  // V8_OS_DARWIN
+#endif  // V8_HOST_ARCH_ARM64 && !defined(USE_SIMULATOR)
+  if (FLAG_trace_turbo_instruction_scheduling) {
+    PrintF("Using the %s instruction latency model\n", model->name);
+  }
+  return model;
+}
+
+const LatencyModel& GetLatencyModel() {
+  static const LatencyModel* const model = SelectLatencyModel();
+  return *model;
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  const LatencyModel& model = GetLatencyModel();
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -397,7 +480,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Tst:
     case kArm64Tst32:
       if (instr->addressing_mode() != kMode_None) {
-        return 3;
+        return model.alu_shifted_operand;
       } else {
         return 1;
       }
@@ -436,7 +519,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Ldrsb:
     case kArm64Ldrsh:
     case kArm64Ldrsw:
-      return 11;
+      return model.load;
 
     case kArm64Str:
     case kArm64StrD:
@@ -450,27 +533,27 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
+      return model.int32_multiply;
 
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+      return model.int64_multiply;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
-      return 12;
+      return model.int32_divide;
 
     case kArm64Idiv:
     case kArm64Udiv:
-      return 20;
+      return model.int64_divide;
 
     case kArm64Float32Add:
     case kArm64Float32Sub:
     case kArm64Float64Add:
     case kArm64Float64Sub:
-      return 5;
+      return model.float_add;
 
     case kArm64Float32Abs:
     case kArm64Float32Cmp:
@@ -478,15 +561,15 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64Abs:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
-      return 3;
+      return model.float_abs_neg_cmp;
 
     case kArm64Float32Div:
     case kArm64Float32Sqrt:
-      return 12;
+      return model.float32_divide_sqrt;
 
     case kArm64Float64Div:
     case kArm64Float64Sqrt:
-      return 19;
+      return model.float64_divide_sqrt;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -497,7 +580,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64RoundTiesEven:
     case kArm64Float64RoundTruncate:
     case kArm64Float64RoundUp:
-      return 5;
+      return model.float_round;
 
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
@@ -513,7 +596,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Uint32ToFloat64:
     case kArm64Uint64ToFloat32:
     case kArm64Uint64ToFloat64:
-      return 5;
+      return model.float_convert;
 
     default:
       return 2;
@@ -15,6 +15,8 @@
 #include "src/compiler/pipeline.h"
 #include "src/diagnostics/eh-frame.h"
 #include "src/execution/frames.h"
+#include "src/execution/local-isolate-inl.h"
+#include "src/heap/local-factory-inl.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/smi.h"
@@ -462,7 +464,22 @@ base::OwnedVector<byte> CodeGenerator::GetProtectedInstructionsData() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
-MaybeHandle<Code> CodeGenerator::FinalizeCode() {
+bool CodeGenerator::CanFinalizeCodeConcurrently() const {
+  if (info()->code_kind() != CodeKind::TURBOFAN) return false;
+  // Profiler data and requested heap objects (e.g. heap numbers embedded by
+  // some architectures) are allocated through the main thread's isolate.
+  if (info()->profiler_data() != nullptr) return false;
+  if (tasm()->has_heap_object_requests()) return false;
+  for (const DeoptimizationLiteral& literal : deoptimization_literals_) {
+    if (literal.kind() == DeoptimizationLiteralKind::kString) return false;
+  }
+  return true;
+}
+
+template <typename IsolateT>
+MaybeHandle<Code> CodeGenerator::BuildCode(IsolateT* isolate) {
+  DCHECK_IMPLIES((std::is_same<IsolateT, LocalIsolate>::value),
+                 CanFinalizeCodeConcurrently());
   if (result_ != kSuccess) {
     tasm()->AbortedCodeGeneration();
     return MaybeHandle<Code>();
@@ -470,14 +487,16 @@ MaybeHandle<Code> CodeGenerator::FinalizeCode() {
 
   // Allocate the source position table.
   Handle<ByteArray> source_positions =
-      source_position_table_builder_.ToSourcePositionTable(isolate());
+      source_position_table_builder_.ToSourcePositionTable(isolate);
 
   // Allocate deoptimization data.
-  Handle<DeoptimizationData> deopt_data = GenerateDeoptimizationData();
+  Handle<DeoptimizationData> deopt_data = GenerateDeoptimizationData(isolate);
 
-  // Allocate and install the code.
+  // Allocate and install the code. Without heap object requests, GetCode
+  // doesn't need an isolate.
   CodeDesc desc;
-  tasm()->GetCode(isolate(), &desc, safepoints(), handler_table_offset_);
+  tasm()->GetCode(tasm()->has_heap_object_requests() ? isolate_ : nullptr,
+                  &desc, safepoints(), handler_table_offset_);
 
 #if defined(V8_OS_WIN64)
   if (Builtins::IsBuiltinId(info_->builtin())) {
@@ -490,7 +509,7 @@ MaybeHandle<Code> CodeGenerator::FinalizeCode() {
   }
 
   MaybeHandle<Code> maybe_code =
-      Factory::CodeBuilder(isolate(), desc, info()->code_kind())
+      Factory::CodeBuilder(isolate, desc, info()->code_kind())
           .set_builtin(info()->builtin())
           .set_inlined_bytecode_size(info()->inlined_bytecode_size())
           .set_source_position_table(source_positions)
@@ -506,11 +525,23 @@ MaybeHandle<Code> CodeGenerator::FinalizeCode() {
     tasm()->AbortedCodeGeneration();
     return MaybeHandle<Code>();
   }
+  return code;
+}
 
+template MaybeHandle<Code> CodeGenerator::BuildCode(Isolate* isolate);
+template MaybeHandle<Code> CodeGenerator::BuildCode(LocalIsolate* isolate);
+
+void CodeGenerator::LogCodeLinePosInfo(Handle<Code> code) {
   LOG_CODE_EVENT(isolate(), CodeLinePosInfoRecordEvent(
                                 code->raw_instruction_start(),
-                                *source_positions, JitCodeEvent::JIT_CODE));
+                                code->source_position_table(),
+                                JitCodeEvent::JIT_CODE));
+}
 
+MaybeHandle<Code> CodeGenerator::FinalizeCode() {
+  Handle<Code> code;
+  if (!BuildCode(isolate()).ToHandle(&code)) return MaybeHandle<Code>();
+  LogCodeLinePosInfo(code);
   return code;
 }
 
@@ -877,8 +908,9 @@ void CodeGenerator::AssembleGaps(Instruction* instr) {
 
 namespace {
 
+template <typename IsolateT>
 Handle<PodArray<InliningPosition>> CreateInliningPositions(
-    OptimizedCompilationInfo* info, Isolate* isolate) {
+    OptimizedCompilationInfo* info, IsolateT* isolate) {
   const OptimizedCompilationInfo::InlinedFunctionList& inlined_functions =
       info->inlined_functions();
   Handle<PodArray<InliningPosition>> inl_positions =
@@ -893,17 +925,19 @@ Handle<PodArray<InliningPosition>> CreateInliningPositions(
 
 }  // namespace
 
-Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
+template <typename IsolateT>
+Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData(
+    IsolateT* isolate) {
   OptimizedCompilationInfo* info = this->info();
   int deopt_count = static_cast<int>(deoptimization_exits_.size());
   if (deopt_count == 0 && !info->is_osr()) {
-    return DeoptimizationData::Empty(isolate());
+    return DeoptimizationData::Empty(isolate);
   }
   Handle<DeoptimizationData> data =
-      DeoptimizationData::New(isolate(), deopt_count, AllocationType::kOld);
+      DeoptimizationData::New(isolate, deopt_count, AllocationType::kOld);
 
   Handle<TranslationArray> translation_array =
-      translations_.ToTranslationArray(isolate()->factory());
+      translations_.ToTranslationArray(isolate);
 
   data->SetTranslationByteArray(*translation_array);
   data->SetInlinedFunctionCount(
@@ -921,17 +955,17 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
   }
 
   Handle<DeoptimizationLiteralArray> literals =
-      isolate()->factory()->NewDeoptimizationLiteralArray(
+      isolate->factory()->NewDeoptimizationLiteralArray(
           static_cast<int>(deoptimization_literals_.size()));
   for (unsigned i = 0; i < deoptimization_literals_.size(); i++) {
-    Handle<Object> object = deoptimization_literals_[i].Reify(isolate());
+    Handle<Object> object = deoptimization_literals_[i].Reify(isolate);
     CHECK(!object.is_null());
     literals->set(i, *object);
   }
   data->SetLiteralArray(*literals);
 
   Handle<PodArray<InliningPosition>> inl_pos =
-      CreateInliningPositions(info, isolate());
+      CreateInliningPositions(info, isolate);
   data->SetInliningPositions(*inl_pos);
 
   if (info->is_osr()) {
@@ -1129,7 +1163,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   frame_state_offset++;
 
   const int update_feedback_count = entry.feedback().IsValid() ? 1 : 0;
-  const int translation_index = translations_.BeginTranslation(
+  int translation_index = translations_.BeginTranslation(
       static_cast<int>(descriptor->GetFrameCount()),
       static_cast<int>(descriptor->GetJSFrameCount()), update_feedback_count);
   if (entry.feedback().IsValid()) {
@@ -1140,6 +1174,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   }
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, state_combine);
+  translation_index = translations_.FinishTranslation(translation_index);
 
   DeoptimizationExit* const exit = zone()->New<DeoptimizationExit>(
       current_source_position_, descriptor->bailout_id(), translation_index,
@@ -1345,6 +1380,23 @@ Handle<Object> DeoptimizationLiteral::Reify(Isolate* isolate) const {
   UNREACHABLE();
 }
 
+Handle<Object> DeoptimizationLiteral::Reify(LocalIsolate* isolate) const {
+  Validate();
+  switch (kind_) {
+    case DeoptimizationLiteralKind::kObject: {
+      return object_;
+    }
+    case DeoptimizationLiteralKind::kNumber: {
+      return isolate->factory()->NewNumber<AllocationType::kOld>(number_);
+    }
+    case DeoptimizationLiteralKind::kString:
+    case DeoptimizationLiteralKind::kInvalid: {
+      UNREACHABLE();
+    }
+  }
+  UNREACHABLE();
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
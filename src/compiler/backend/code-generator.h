@@ -86,6 +86,8 @@ class DeoptimizationLiteral {
   }
 
   Handle<Object> Reify(Isolate* isolate) const;
+  // String literals can only be reified on the main thread.
+  Handle<Object> Reify(LocalIsolate* isolate) const;
 
   void Validate() const {
     CHECK_NE(kind_, DeoptimizationLiteralKind::kInvalid);
@@ -140,6 +142,17 @@ class V8_EXPORT_PRIVATE CodeGenerator final : public GapResolver::Assembler {
   void AssembleCode();  // Does not need to run on main thread.
   MaybeHandle<Code> FinalizeCode();
 
+  // Whether the code object can be built off the main thread, i.e. whether
+  // all heap objects it needs can be allocated through a LocalIsolate.
+  bool CanFinalizeCodeConcurrently() const;
+  // Builds the code object like FinalizeCode does, but without logging it.
+  // With a LocalIsolate this runs on a background thread and requires
+  // CanFinalizeCodeConcurrently; call LogCodeLinePosInfo on the main thread
+  // afterwards.
+  template <typename IsolateT>
+  MaybeHandle<Code> BuildCode(IsolateT* isolate);
+  void LogCodeLinePosInfo(Handle<Code> code);
+
   base::OwnedVector<byte> GetSourcePositionTable();
   base::OwnedVector<byte> GetProtectedInstructionsData();
 
@@ -372,7 +385,8 @@ class V8_EXPORT_PRIVATE CodeGenerator final : public GapResolver::Assembler {
   // ===========================================================================
 
   void RecordCallPosition(Instruction* instr);
-  Handle<DeoptimizationData> GenerateDeoptimizationData();
+  template <typename IsolateT>
+  Handle<DeoptimizationData> GenerateDeoptimizationData(IsolateT* isolate);
   int DefineDeoptimizationLiteral(DeoptimizationLiteral literal);
   DeoptimizationEntry const& GetDeoptimizationEntry(Instruction* instr,
                                                     size_t frame_state_offset);
@@ -215,6 +215,10 @@ void InstructionScheduler::Schedule() {
   // Compute total latencies so that we can schedule the critical path first.
   ComputeTotalLatencies();
 
+  if (FLAG_trace_turbo_instruction_scheduling) {
+    original_cycles_ += EstimateCyclesInOriginalOrder();
+  }
+
   // Add nodes which don't have dependencies to the ready list.
   for (ScheduleGraphNode* node : graph_) {
     if (!node->HasUnscheduledPredecessor()) {
@@ -244,6 +248,8 @@ void InstructionScheduler::Schedule() {
     cycle++;
   }
 
+  if (FLAG_trace_turbo_instruction_scheduling) scheduled_cycles_ += cycle;
+
   // Reset own state.
   graph_.clear();
   operands_map_.clear();
@@ -393,6 +399,23 @@ int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
   UNREACHABLE();
 }
 
+int InstructionScheduler::EstimateCyclesInOriginalOrder() {
+  // Successors always come after their predecessors in {graph_}, so a single
+  // pass computes when each instruction could issue in the original order.
+  int cycle = 0;
+  for (ScheduleGraphNode* node : graph_) {
+    cycle = std::max(cycle, node->start_cycle());
+    for (ScheduleGraphNode* successor : node->successors()) {
+      successor->set_start_cycle(
+          std::max(successor->start_cycle(), cycle + node->latency()));
+    }
+    cycle++;
+  }
+  // The scheduler computes the start cycles again for the new order.
+  for (ScheduleGraphNode* node : graph_) node->set_start_cycle(-1);
+  return cycle;
+}
+
 void InstructionScheduler::ComputeTotalLatencies() {
   for (ScheduleGraphNode* node : base::Reversed(graph_)) {
     int max_latency = 0;
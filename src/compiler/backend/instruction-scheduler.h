@@ -44,6 +44,13 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Estimated cycles of the scheduled blocks in their original and in their
+  // scheduled order, assuming one instruction is issued per cycle once its
+  // operands are available. Only computed with
+  // --trace-turbo-instruction-scheduling.
+  int original_cycles() const { return original_cycles_; }
+  int scheduled_cycles() const { return scheduled_cycles_; }
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
@@ -205,6 +212,7 @@ class InstructionScheduler final : public ZoneObject {
   }
 
   void ComputeTotalLatencies();
+  int EstimateCyclesInOriginalOrder();
 
   static int GetInstructionLatency(const Instruction* instr);
 
@@ -244,6 +252,9 @@ class InstructionScheduler final : public ZoneObject {
   ZoneMap<int32_t, ScheduleGraphNode*> operands_map_;
 
   base::Optional<base::RandomNumberGenerator> random_number_generator_;
+
+  int original_cycles_ = 0;
+  int scheduled_cycles_ = 0;
 };
 
 }  // namespace compiler
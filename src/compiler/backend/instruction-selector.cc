@@ -2373,6 +2373,13 @@ void InstructionSelector::VisitNode(Node* node) {
       return MarkAsSimd128(node), VisitI32x4RelaxedTruncF32x4S(node);
     case IrOpcode::kI32x4RelaxedTruncF32x4U:
       return MarkAsSimd128(node), VisitI32x4RelaxedTruncF32x4U(node);
+#if V8_TARGET_ARCH_X64
+#define VISIT_SIMD256_OP(Name) \
+  case IrOpcode::k##Name:      \
+    return MarkAsSimd256(node), Visit##Name(node);
+      MACHINE_SIMD256_OP_LIST(VISIT_SIMD256_OP)
+#undef VISIT_SIMD256_OP
+#endif  // V8_TARGET_ARCH_X64
     default:
       FATAL("Unexpected operator #%d:%s @ node #%d", node->opcode(),
             node->op()->mnemonic(), node->id());
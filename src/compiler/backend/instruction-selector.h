@@ -476,6 +476,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
     return instr_origins_;
   }
 
+  // The instruction scheduler, or nullptr if scheduling is disabled.
+  const InstructionScheduler* scheduler() const { return scheduler_; }
+
  private:
   friend class OperandGenerator;
 
@@ -528,6 +531,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
   void MarkAsSimd128(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kSimd128, node);
   }
+  void MarkAsSimd256(Node* node) {
+    MarkAsRepresentation(MachineRepresentation::kSimd256, node);
+  }
   void MarkAsTagged(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kTagged, node);
   }
@@ -599,6 +605,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final {
 #define DECLARE_GENERATOR(x) void Visit##x(Node* node);
   MACHINE_OP_LIST(DECLARE_GENERATOR)
   MACHINE_SIMD_OP_LIST(DECLARE_GENERATOR)
+#if V8_TARGET_ARCH_X64
+  MACHINE_SIMD256_OP_LIST(DECLARE_GENERATOR)
+#endif  // V8_TARGET_ARCH_X64
 #undef DECLARE_GENERATOR
 
   // Visit the load node with a value and opcode to replace with.
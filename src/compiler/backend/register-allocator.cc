@@ -1512,6 +1512,10 @@ void TopTierRegisterAllocationData::MarkFixedUse(MachineRepresentation rep,
         }
       }
       break;
+    case MachineRepresentation::kSimd256:
+      // Only x64 has 256-bit registers, which overlap the FP registers.
+      DCHECK_EQ(kFPAliasing, AliasingKind::kOverlap);
+      V8_FALLTHROUGH;
     case MachineRepresentation::kFloat64:
       fixed_fp_register_use_->Add(index);
       break;
@@ -1548,6 +1552,9 @@ bool TopTierRegisterAllocationData::HasFixedUse(MachineRepresentation rep,
         return result;
       }
     }
+    case MachineRepresentation::kSimd256:
+      DCHECK_EQ(kFPAliasing, AliasingKind::kOverlap);
+      V8_FALLTHROUGH;
     case MachineRepresentation::kFloat64:
       return fixed_fp_register_use_->Contains(index);
     default:
@@ -1580,6 +1587,9 @@ void TopTierRegisterAllocationData::MarkAllocated(MachineRepresentation rep,
         }
       }
       break;
+    case MachineRepresentation::kSimd256:
+      DCHECK_EQ(kFPAliasing, AliasingKind::kOverlap);
+      V8_FALLTHROUGH;
     case MachineRepresentation::kFloat64:
       assigned_double_registers_->Add(index);
       break;
@@ -67,6 +67,19 @@ class X64OperandConverter : public InstructionOperandConverter {
     return SlotToOperand(AllocatedOperand::cast(op)->index(), extra);
   }
 
+  YMMRegister ToSimd256Register(InstructionOperand* op) {
+    DCHECK(op->IsSimd256Register());
+    return YMMRegister::from_code(LocationOperand::cast(op)->register_code());
+  }
+
+  YMMRegister InputSimd256Register(size_t index) {
+    return ToSimd256Register(instr_->InputAt(index));
+  }
+
+  YMMRegister OutputSimd256Register() {
+    return ToSimd256Register(instr_->Output());
+  }
+
   Operand SlotToOperand(int slot_index, int extra = 0) {
     FrameOffset offset = frame_access_state()->GetFrameOffset(slot_index);
     return Operand(offset.from_stack_pointer() ? rsp : rbp,
@@ -928,6 +941,16 @@ void EmitOOLTrapIfNeeded(Zone* zone, CodeGenerator* codegen,
     }                                                                    \
   } while (false)
 
+// 256-bit operations are only selected when AVX2 is supported. The lane size
+// distinguishes the instructions which share an opcode.
+#define ASSEMBLE_SIMD256_BINOP(opcode)                                 \
+  do {                                                                 \
+    CpuFeatureScope avx_scope(tasm(), AVX);                            \
+    CpuFeatureScope avx2_scope(tasm(), AVX2);                          \
+    __ v##opcode(i.OutputSimd256Register(), i.InputSimd256Register(0), \
+                 i.InputSimd256Register(1));                           \
+  } while (false)
+
 #define ASSEMBLE_SIMD_INSTR(opcode, dst_operand, index)      \
   do {                                                       \
     if (instr->InputAt(index)->IsSimd128Register()) {        \
@@ -2546,6 +2569,18 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       }
       break;
     }
+    case kX64Movdqu256: {
+      CpuFeatureScope avx_scope(tasm(), AVX);
+      EmitOOLTrapIfNeeded(zone(), this, opcode, instr, __ pc_offset());
+      if (instr->HasOutput()) {
+        __ vmovdqu(i.OutputSimd256Register(), i.MemoryOperand());
+      } else {
+        size_t index = 0;
+        Operand operand = i.MemoryOperand(&index);
+        __ vmovdqu(operand, i.InputSimd256Register(index));
+      }
+      break;
+    }
     case kX64BitcastFI:
       if (instr->InputAt(0)->IsFPStackSlot()) {
         __ movl(i.OutputRegister(), i.InputOperand(0));
@@ -3796,6 +3831,92 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
                     kScratchDoubleReg);
       break;
     }
+    case kX64F256Add: {
+      if (LaneSizeField::decode(opcode) == 64) {
+        ASSEMBLE_SIMD256_BINOP(addpd);
+      } else {
+        DCHECK_EQ(32, LaneSizeField::decode(opcode));
+        ASSEMBLE_SIMD256_BINOP(addps);
+      }
+      break;
+    }
+    case kX64F256Sub: {
+      if (LaneSizeField::decode(opcode) == 64) {
+        ASSEMBLE_SIMD256_BINOP(subpd);
+      } else {
+        DCHECK_EQ(32, LaneSizeField::decode(opcode));
+        ASSEMBLE_SIMD256_BINOP(subps);
+      }
+      break;
+    }
+    case kX64F256Mul: {
+      if (LaneSizeField::decode(opcode) == 64) {
+        ASSEMBLE_SIMD256_BINOP(mulpd);
+      } else {
+        DCHECK_EQ(32, LaneSizeField::decode(opcode));
+        ASSEMBLE_SIMD256_BINOP(mulps);
+      }
+      break;
+    }
+    case kX64I256Add: {
+      switch (LaneSizeField::decode(opcode)) {
+        case 8:
+          ASSEMBLE_SIMD256_BINOP(paddb);
+          break;
+        case 16:
+          ASSEMBLE_SIMD256_BINOP(paddw);
+          break;
+        case 32:
+          ASSEMBLE_SIMD256_BINOP(paddd);
+          break;
+        case 64:
+          ASSEMBLE_SIMD256_BINOP(paddq);
+          break;
+        default:
+          UNREACHABLE();
+      }
+      break;
+    }
+    case kX64I256Sub: {
+      switch (LaneSizeField::decode(opcode)) {
+        case 8:
+          ASSEMBLE_SIMD256_BINOP(psubb);
+          break;
+        case 16:
+          ASSEMBLE_SIMD256_BINOP(psubw);
+          break;
+        case 32:
+          ASSEMBLE_SIMD256_BINOP(psubd);
+          break;
+        case 64:
+          ASSEMBLE_SIMD256_BINOP(psubq);
+          break;
+        default:
+          UNREACHABLE();
+      }
+      break;
+    }
+    case kX64I256Mul: {
+      if (LaneSizeField::decode(opcode) == 32) {
+        ASSEMBLE_SIMD256_BINOP(pmulld);
+      } else {
+        DCHECK_EQ(16, LaneSizeField::decode(opcode));
+        ASSEMBLE_SIMD256_BINOP(pmullw);
+      }
+      break;
+    }
+    case kX64S256And: {
+      ASSEMBLE_SIMD256_BINOP(pand);
+      break;
+    }
+    case kX64S256Or: {
+      ASSEMBLE_SIMD256_BINOP(por);
+      break;
+    }
+    case kX64S256Xor: {
+      ASSEMBLE_SIMD256_BINOP(pxor);
+      break;
+    }
     case kX64S128AndNot: {
       XMMRegister dst = i.OutputSimd128Register();
       DCHECK_EQ(dst, i.InputSimd128Register(0));
@@ -3967,6 +4088,29 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       ASSEMBLE_SIMD_IMM_SHUFFLE(pblendw, i.InputUint8(2));
       break;
     }
+    case kX64S8x16Blend: {
+      XMMRegister dst = i.OutputSimd128Register();
+      XMMRegister src0 = i.InputSimd128Register(0);
+      XMMRegister src1 = i.InputSimd128Register(1);
+      XMMRegister mask = i.TempSimd128Register(0);
+      uint32_t imms[4] = {};
+      for (int j = 0; j < 4; j++) {
+        imms[j] = i.InputUint32(2 + j);
+      }
+      // The mask has all bits set in the bytes taken from src1.
+      SetupSimdImmediateInRegister(tasm(), imms, mask);
+      if (CpuFeatures::IsSupported(AVX)) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        __ vpblendvb(dst, src0, src1, mask);
+      } else {
+        __ Movdqa(kScratchDoubleReg, src1);
+        __ Pand(kScratchDoubleReg, mask);
+        __ Pandn(mask, src0);
+        __ Por(mask, kScratchDoubleReg);
+        __ Movdqa(dst, mask);
+      }
+      break;
+    }
     case kX64S16x8HalfShuffle1: {
       XMMRegister dst = i.OutputSimd128Register();
       uint8_t mask_lo = i.InputUint8(1);
@@ -4400,6 +4544,7 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
 #undef ASSEMBLE_IEEE754_UNOP
 #undef ASSEMBLE_ATOMIC_BINOP
 #undef ASSEMBLE_ATOMIC64_BINOP
+#undef ASSEMBLE_SIMD256_BINOP
 #undef ASSEMBLE_SIMD_INSTR
 #undef ASSEMBLE_SIMD_IMM_INSTR
 #undef ASSEMBLE_SIMD_PUNPCK_SHUFFLE
@@ -4999,6 +5144,10 @@ void CodeGenerator::AssembleMove(InstructionOperand* source,
     case MoveType::kRegisterToRegister:
       if (source->IsRegister()) {
         __ movq(g.ToRegister(destination), g.ToRegister(source));
+      } else if (source->IsSimd256Register()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        __ vmovaps(g.ToSimd256Register(destination),
+                   g.ToSimd256Register(source));
       } else {
         DCHECK(source->IsFPRegister());
         __ Movapd(g.ToDoubleRegister(destination), g.ToDoubleRegister(source));
@@ -5008,6 +5157,9 @@ void CodeGenerator::AssembleMove(InstructionOperand* source,
       Operand dst = g.ToOperand(destination);
       if (source->IsRegister()) {
         __ movq(dst, g.ToRegister(source));
+      } else if (source->IsSimd256Register()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        __ vmovdqu(dst, g.ToSimd256Register(source));
       } else {
         DCHECK(source->IsFPRegister());
         XMMRegister src = g.ToDoubleRegister(source);
@@ -5025,6 +5177,9 @@ void CodeGenerator::AssembleMove(InstructionOperand* source,
       Operand src = g.ToOperand(source);
       if (source->IsStackSlot()) {
         __ movq(g.ToRegister(destination), src);
+      } else if (source->IsSimd256StackSlot()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        __ vmovdqu(g.ToSimd256Register(destination), src);
       } else {
         DCHECK(source->IsFPStackSlot());
         XMMRegister dst = g.ToDoubleRegister(destination);
@@ -5046,6 +5201,11 @@ void CodeGenerator::AssembleMove(InstructionOperand* source,
         // moves.
         __ movq(kScratchRegister, src);
         __ movq(dst, kScratchRegister);
+      } else if (source->IsSimd256StackSlot()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        YMMRegister scratch = YMMRegister::from_code(kScratchDoubleReg.code());
+        __ vmovdqu(scratch, src);
+        __ vmovdqu(dst, scratch);
       } else {
         MachineRepresentation rep =
             LocationOperand::cast(source)->representation();
@@ -5115,6 +5275,14 @@ void CodeGenerator::AssembleSwap(InstructionOperand* source,
         __ movq(kScratchRegister, src);
         __ movq(src, dst);
         __ movq(dst, kScratchRegister);
+      } else if (source->IsSimd256Register()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        YMMRegister scratch = YMMRegister::from_code(kScratchDoubleReg.code());
+        YMMRegister src = g.ToSimd256Register(source);
+        YMMRegister dst = g.ToSimd256Register(destination);
+        __ vmovaps(scratch, src);
+        __ vmovaps(src, dst);
+        __ vmovaps(dst, scratch);
       } else {
         DCHECK(source->IsFPRegister());
         XMMRegister src = g.ToDoubleRegister(source);
@@ -5132,6 +5300,14 @@ void CodeGenerator::AssembleSwap(InstructionOperand* source,
         __ movq(kScratchRegister, src);
         __ movq(src, dst);
         __ movq(dst, kScratchRegister);
+      } else if (source->IsSimd256Register()) {
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        YMMRegister scratch = YMMRegister::from_code(kScratchDoubleReg.code());
+        YMMRegister src = g.ToSimd256Register(source);
+        Operand dst = g.ToOperand(destination);
+        __ vmovdqu(scratch, src);
+        __ vmovdqu(src, dst);
+        __ vmovdqu(dst, scratch);
       } else {
         DCHECK(source->IsFPRegister());
         XMMRegister src = g.ToDoubleRegister(source);
@@ -5155,7 +5331,23 @@ void CodeGenerator::AssembleSwap(InstructionOperand* source,
       Operand dst = g.ToOperand(destination);
       MachineRepresentation rep =
           LocationOperand::cast(source)->representation();
-      if (rep != MachineRepresentation::kSimd128) {
+      if (rep == MachineRepresentation::kSimd256) {
+        // Save dst in the scratch register and copy src to dst through the
+        // stack, one word at a time.
+        CpuFeatureScope avx_scope(tasm(), AVX);
+        YMMRegister scratch = YMMRegister::from_code(kScratchDoubleReg.code());
+        __ vmovdqu(scratch, dst);
+        for (int offset = 0; offset < kSimd256Size;
+             offset += kSystemPointerSize) {
+          __ pushq(g.ToOperand(source, offset));
+          unwinding_info_writer_.MaybeIncreaseBaseOffsetAt(__ pc_offset(),
+                                                           kSystemPointerSize);
+          __ popq(g.ToOperand(destination, offset));
+          unwinding_info_writer_.MaybeIncreaseBaseOffsetAt(__ pc_offset(),
+                                                           -kSystemPointerSize);
+        }
+        __ vmovdqu(src, scratch);
+      } else if (rep != MachineRepresentation::kSimd128) {
         Register tmp = kScratchRegister;
         __ movq(tmp, dst);
         __ pushq(src);  // Then use stack to copy src to destination.
@@ -17,6 +17,7 @@ namespace compiler {
   V(X64F64x2PromoteLowF32x4)                               \
   V(X64Movb)                                               \
   V(X64Movdqu)                                             \
+  V(X64Movdqu256)                                          \
   V(X64Movl)                                               \
   V(X64Movq)                                               \
   V(X64Movsd)                                              \
@@ -369,6 +370,7 @@ namespace compiler {
   V(X64S32x4Swizzle)                                 \
   V(X64S32x4Shuffle)                                 \
   V(X64S16x8Blend)                                   \
+  V(X64S8x16Blend)                                   \
   V(X64S16x8HalfShuffle1)                            \
   V(X64S16x8HalfShuffle2)                            \
   V(X64S8x16Alignr)                                  \
@@ -404,7 +406,16 @@ namespace compiler {
   V(X64Word64AtomicXorUint64)                        \
   V(X64Word64AtomicStoreWord64)                      \
   V(X64Word64AtomicExchangeUint64)                   \
-  V(X64Word64AtomicCompareExchangeUint64)
+  V(X64Word64AtomicCompareExchangeUint64)            \
+  V(X64F256Add)                                      \
+  V(X64F256Sub)                                      \
+  V(X64F256Mul)                                      \
+  V(X64I256Add)                                      \
+  V(X64I256Sub)                                      \
+  V(X64I256Mul)                                      \
+  V(X64S256And)                                      \
+  V(X64S256Or)                                       \
+  V(X64S256Xor)
 
 // Addressing modes represent the "shape" of inputs to an instruction.
 // Many instructions support multiple addressing modes. Addressing modes
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
@@ -312,6 +313,15 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64S128Zero:
     case kX64S128AllOnes:
     case kX64S128AndNot:
+    case kX64F256Add:
+    case kX64F256Sub:
+    case kX64F256Mul:
+    case kX64I256Add:
+    case kX64I256Sub:
+    case kX64I256Mul:
+    case kX64S256And:
+    case kX64S256Or:
+    case kX64S256Xor:
     case kX64I64x2AllTrue:
     case kX64I32x4AllTrue:
     case kX64I16x8AllTrue:
@@ -323,6 +333,7 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64S32x4Swizzle:
     case kX64S32x4Shuffle:
     case kX64S16x8Blend:
+    case kX64S8x16Blend:
     case kX64S16x8HalfShuffle1:
     case kX64S16x8HalfShuffle2:
     case kX64S8x16Alignr:
@@ -400,6 +411,7 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Movsd:
     case kX64Movss:
     case kX64Movdqu:
+    case kX64Movdqu256:
     case kX64S128Load8Splat:
     case kX64S128Load16Splat:
     case kX64S128Load32Splat:
@@ -443,20 +455,90 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies in cycles of the instructions whose cost varies noticeably
+// between microarchitectures. The per-core numbers approximate published
+// measurements; the generic model contains the empirical values that were
+// used before the models were split by core.
+struct LatencyModel {
+  const char* name;
+  int int_multiply;
+  int float_abs_neg;
+  int float_add;  // Also comparisons and min/max.
+  int float32_multiply;
+  int float64_multiply;
+  int float_convert;  // Between float types and to 32 bit integers.
+  int float_round;
+  int float32_divide_sqrt;
+  int float64_divide;
+  int float64_sqrt;
+  int float_to_int64;
+  int int64_divide;
+  int int32_divide;
+  int uint64_divide;
+  int uint32_divide;
+  int float64_mod;
+  int truncate_double_to_int;
+};
+
+constexpr LatencyModel kGenericModel = {
+    "generic", 3, 3, 3, 4, 5, 4, 4, 13, 13, 13, 10, 49, 35, 38, 26, 50, 6};
+// Haswell and Broadwell.
+constexpr LatencyModel kIntelHaswellModel = {
+    "intel-haswell", 3, 1, 3, 5, 5, 4, 6, 13, 20, 16, 6, 42, 22, 35, 22, 50,
+    6};
+// Skylake and the cores derived from it, up to Ice Lake.
+constexpr LatencyModel kIntelSkylakeModel = {
+    "intel-skylake", 3, 1, 4, 4, 4, 5, 8, 12, 14, 18, 6, 42, 26, 35, 26, 50,
+    6};
+// Zen and later, whose dividers are considerably faster.
+constexpr LatencyModel kAmdZenModel = {
+    "amd-zen", 3, 1, 3, 3, 3, 3, 3, 14, 13, 20, 5, 30, 22, 30, 22, 50, 5};
+
+const LatencyModel* SelectLatencyModel() {
+  const LatencyModel* model = &kGenericModel;
+#if V8_HOST_ARCH_X64
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 0x6) {
+    if (cpu.model() >= 0x4e) {
+      model = &kIntelSkylakeModel;
+    } else if (cpu.has_avx2()) {
+      model = &kIntelHaswellModel;
+    }
+  } else if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+             cpu.family() == 0xf && cpu.ext_family() >= 0x8) {
+    model = &kAmdZenModel;
+  }
+#endif  // V8_HOST_ARCH_X64
+  if (FLAG_trace_turbo_instruction_scheduling) {
+    PrintF("Using the %s instruction latency model\n", model->name);
+  }
+  return model;
+}
+
+const LatencyModel& GetLatencyModel() {
+  static const LatencyModel* const model = SelectLatencyModel();
+  return *model;
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  const LatencyModel& model = GetLatencyModel();
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
-      return 5;
+      return model.float64_multiply;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+      return model.int_multiply;
     case kX64Float32Abs:
     case kX64Float32Neg:
     case kX64Float64Abs:
     case kX64Float64Neg:
+      return model.float_abs_neg;
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -465,39 +547,43 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
+      return model.float_add;
     case kSSEFloat32Mul:
+      return model.float32_multiply;
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
-    case kSSEFloat32Round:
-    case kSSEFloat64Round:
     case kSSEFloat32ToInt32:
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return model.float_convert;
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return model.float_round;
     case kX64Idiv:
-      return 49;
+      return model.int64_divide;
     case kX64Idiv32:
-      return 35;
+      return model.int32_divide;
     case kX64Udiv:
-      return 38;
+      return model.uint64_divide;
     case kX64Udiv32:
-      return 26;
+      return model.uint32_divide;
     case kSSEFloat32Div:
-    case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
+      return model.float32_divide_sqrt;
+    case kSSEFloat64Div:
+      return model.float64_divide;
     case kSSEFloat64Sqrt:
-      return 13;
+      return model.float64_sqrt;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
-      return 10;
+      return model.float_to_int64;
     case kSSEFloat64Mod:
-      return 50;
+      return model.float64_mod;
     case kArchTruncateDoubleToI:
-      return 6;
+      return model.truncate_double_to_int;
     default:
       return 1;
   }
@@ -303,8 +303,10 @@ ArchOpcode GetLoadOpcode(LoadRepresentation load_rep) {
     case MachineRepresentation::kSimd128:
       opcode = kX64Movdqu;
       break;
-    case MachineRepresentation::kSimd256:  // Fall through.
-    case MachineRepresentation::kNone:     // Fall through.
+    case MachineRepresentation::kSimd256:
+      opcode = kX64Movdqu256;
+      break;
+    case MachineRepresentation::kNone:  // Fall through.
     case MachineRepresentation::kMapWord:
       UNREACHABLE();
   }
@@ -341,8 +343,9 @@ ArchOpcode GetStoreOpcode(StoreRepresentation store_rep) {
       return kX64MovqEncodeSandboxedPointer;
     case MachineRepresentation::kSimd128:
       return kX64Movdqu;
-    case MachineRepresentation::kSimd256:  // Fall through.
-    case MachineRepresentation::kNone:     // Fall through.
+    case MachineRepresentation::kSimd256:
+      return kX64Movdqu256;
+    case MachineRepresentation::kNone:  // Fall through.
     case MachineRepresentation::kMapWord:
       UNREACHABLE();
   }
@@ -3377,6 +3380,41 @@ SIMD_BINOP_SSE_AVX_LIST(VISIT_SIMD_BINOP)
 #undef VISIT_SIMD_BINOP
 #undef SIMD_BINOP_SSE_AVX_LIST
 
+// 256-bit operations share one opcode per operation, the lane size selects
+// the instruction.
+#define SIMD256_BINOP_LIST(V) \
+  V(F64x4Add, F256Add, 64)    \
+  V(F32x8Add, F256Add, 32)    \
+  V(I64x4Add, I256Add, 64)    \
+  V(I32x8Add, I256Add, 32)    \
+  V(I16x16Add, I256Add, 16)   \
+  V(I8x32Add, I256Add, 8)     \
+  V(F64x4Sub, F256Sub, 64)    \
+  V(F32x8Sub, F256Sub, 32)    \
+  V(I64x4Sub, I256Sub, 64)    \
+  V(I32x8Sub, I256Sub, 32)    \
+  V(I16x16Sub, I256Sub, 16)   \
+  V(I8x32Sub, I256Sub, 8)     \
+  V(F64x4Mul, F256Mul, 64)    \
+  V(F32x8Mul, F256Mul, 32)    \
+  V(I32x8Mul, I256Mul, 32)    \
+  V(I16x16Mul, I256Mul, 16)   \
+  V(S256And, S256And, 0)      \
+  V(S256Or, S256Or, 0)        \
+  V(S256Xor, S256Xor, 0)
+
+#define VISIT_SIMD256_BINOP(Name, Opcode, LaneSize)                 \
+  void InstructionSelector::Visit##Name(Node* node) {               \
+    X64OperandGenerator g(this);                                    \
+    DCHECK(IsSupported(AVX2));                                      \
+    Emit(kX64##Opcode | LaneSizeField::encode(LaneSize),            \
+         g.DefineAsRegister(node), g.UseRegister(node->InputAt(0)), \
+         g.UseRegister(node->InputAt(1)));                          \
+  }
+SIMD256_BINOP_LIST(VISIT_SIMD256_BINOP)
+#undef VISIT_SIMD256_BINOP
+#undef SIMD256_BINOP_LIST
+
 void InstructionSelector::VisitV128AnyTrue(Node* node) {
   X64OperandGenerator g(this);
   Emit(kX64V128AnyTrue, g.DefineAsRegister(node),
@@ -3747,6 +3785,21 @@ void InstructionSelector::VisitI8x16Shuffle(Node* node) {
     src0_needs_reg = true;
     imms[imm_count++] = index;
   }
+  if (opcode == kX64I8x16Shuffle && !is_swizzle &&
+      wasm::SimdShuffle::TryMatchBlend(shuffle)) {
+    // A byte-wise blend needs a single mask instead of the two pshufb masks
+    // of the general shuffle.
+    opcode = kX64S8x16Blend;
+    no_same_as_first = true;
+    for (int i = 0; i < kSimd128Size; i += 4) {
+      uint32_t mask = 0;
+      for (int j = 0; j < 4; j++) {
+        if (shuffle[i + j] >= kSimd128Size) mask |= 0xFFu << (j * 8);
+      }
+      imms[imm_count++] = mask;
+    }
+    temps[temp_count++] = g.TempSimd128Register();
+  }
   if (opcode == kX64I8x16Shuffle) {
     // Use same-as-first for general swizzle, but not shuffle.
     no_same_as_first = !is_swizzle;
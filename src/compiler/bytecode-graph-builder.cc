@@ -311,6 +311,12 @@ class BytecodeGraphBuilder {
   // type feedback. Returns kUnrelated if feedback is insufficient.
   CallFeedbackRelation ComputeCallFeedbackRelation(int slot_id) const;
 
+  // Helper function to derive a branch hint for {condition} from the outcome
+  // feedback of the comparison that produced it. Returns kNone if {condition}
+  // is not the result of the last comparison, or if that has produced both
+  // true and false.
+  BranchHint GetBranchHint(Node* condition) const;
+
   // Helpers for building the implicit FunctionEntry and IterationBody
   // StackChecks.
   void BuildFunctionEntryStackCheck();
@@ -319,8 +325,8 @@ class BytecodeGraphBuilder {
 
   // Control flow plumbing.
   void BuildJump();
-  void BuildJumpIf(Node* condition);
-  void BuildJumpIfNot(Node* condition);
+  void BuildJumpIf(Node* condition, BranchHint hint = BranchHint::kNone);
+  void BuildJumpIfNot(Node* condition, BranchHint hint = BranchHint::kNone);
   void BuildJumpIfEqual(Node* comperand);
   void BuildJumpIfNotEqual(Node* comperand);
   void BuildJumpIfTrue();
@@ -494,6 +500,11 @@ class BytecodeGraphBuilder {
   Node* feedback_vector_node_;
   Node* native_context_node_;
 
+  // The result of the last comparison and the branch hint derived from its
+  // outcome feedback, for the conditional jump that usually follows it.
+  Node* last_compare_node_;
+  BranchHint last_compare_hint_;
+
   // Optimization to only create checkpoints when the current position in the
   // control-flow is not effect-dominated by another checkpoint already. All
   // operations that do not have observable side-effects can be re-evaluated.
@@ -1068,6 +1079,8 @@ BytecodeGraphBuilder::BytecodeGraphBuilder(
       code_kind_(code_kind),
       feedback_vector_node_(nullptr),
       native_context_node_(nullptr),
+      last_compare_node_(nullptr),
+      last_compare_hint_(BranchHint::kNone),
       needs_eager_checkpoint_(true),
       exit_controls_(local_zone),
       state_values_cache_(jsgraph),
@@ -2958,6 +2971,11 @@ CallFeedbackRelation BytecodeGraphBuilder::ComputeCallFeedbackRelation(
              : CallFeedbackRelation::kReceiver;
 }
 
+BranchHint BytecodeGraphBuilder::GetBranchHint(Node* condition) const {
+  if (condition != last_compare_node_) return BranchHint::kNone;
+  return last_compare_hint_;
+}
+
 void BytecodeGraphBuilder::VisitBitwiseNot() {
   FeedbackSource feedback = CreateFeedbackSource(
       bytecode_iterator().GetSlotOperand(kUnaryOperationHintIndex));
@@ -3075,6 +3093,23 @@ void BytecodeGraphBuilder::BuildBinaryOpWithImmediate(const Operator* op) {
     node = NewNode(op, left, right, feedback_vector_node());
   }
   environment()->BindAccumulator(node, Environment::kAttachFrameState);
+
+  if (FLAG_turbo_compare_outcome_hints) {
+    last_compare_node_ = node;
+    switch (broker()->GetFeedbackForCompareOperationOutcome(
+        CreateFeedbackSource(slot))) {
+      case CompareOperationOutcomeHint::kAlwaysTrue:
+        last_compare_hint_ = BranchHint::kTrue;
+        break;
+      case CompareOperationOutcomeHint::kAlwaysFalse:
+        last_compare_hint_ = BranchHint::kFalse;
+        break;
+      case CompareOperationOutcomeHint::kNone:
+      case CompareOperationOutcomeHint::kAny:
+        last_compare_hint_ = BranchHint::kNone;
+        break;
+    }
+  }
 }
 
 void BytecodeGraphBuilder::VisitAddSmi() {
@@ -3548,9 +3583,24 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 
 void BytecodeGraphBuilder::VisitIncBlockCounter() {
+  int slot = bytecode_iterator().GetIndexOperand(0);
+  base::Optional<CoverageInfoRef> coverage_info =
+      shared_info().coverage_info();
+  if (coverage_info.has_value()) {
+    // Count the block with a plain memory increment, rather than calling the
+    // builtin, which looks up the coverage info on every execution. If the
+    // coverage info is removed later on, this keeps counting into the
+    // detached one, which is harmless.
+    FieldAccess access = AccessBuilder::ForCoverageInfoSlotBlockCount(slot);
+    Node* info = jsgraph()->Constant(*coverage_info);
+    Node* count = NewNode(simplified()->LoadField(access), info);
+    count = NewNode(simplified()->NumberAdd(), count, jsgraph()->OneConstant());
+    NewNode(simplified()->StoreField(access), info, count);
+    return;
+  }
+
   Node* closure = GetFunctionClosure();
-  Node* coverage_array_slot =
-      jsgraph()->Constant(bytecode_iterator().GetIndexOperand(0));
+  Node* coverage_array_slot = jsgraph()->Constant(slot);
 
   // Lowered by js-intrinsic-lowering to call Builtin::kIncBlockCounter.
   const Operator* op =
@@ -3942,8 +3992,8 @@ void BytecodeGraphBuilder::BuildJump() {
   MergeIntoSuccessorEnvironment(bytecode_iterator().GetJumpTargetOffset());
 }
 
-void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+void BytecodeGraphBuilder::BuildJumpIf(Node* condition, BranchHint hint) {
+  NewBranch(condition, hint);
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
@@ -3952,8 +4002,8 @@ void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
   NewIfFalse();
 }
 
-void BytecodeGraphBuilder::BuildJumpIfNot(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+void BytecodeGraphBuilder::BuildJumpIfNot(Node* condition, BranchHint hint) {
+  NewBranch(condition, hint);
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -3977,7 +4027,8 @@ void BytecodeGraphBuilder::BuildJumpIfNotEqual(Node* comperand) {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfFalse() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  Node* accumulator = environment()->LookupAccumulator();
+  NewBranch(accumulator, GetBranchHint(accumulator));
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -3989,7 +4040,8 @@ void BytecodeGraphBuilder::BuildJumpIfFalse() {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfTrue() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  Node* accumulator = environment()->LookupAccumulator();
+  NewBranch(accumulator, GetBranchHint(accumulator));
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
@@ -4003,13 +4055,13 @@ void BytecodeGraphBuilder::BuildJumpIfTrue() {
 void BytecodeGraphBuilder::BuildJumpIfToBooleanTrue() {
   Node* accumulator = environment()->LookupAccumulator();
   Node* condition = NewNode(simplified()->ToBoolean(), accumulator);
-  BuildJumpIf(condition);
+  BuildJumpIf(condition, GetBranchHint(accumulator));
 }
 
 void BytecodeGraphBuilder::BuildJumpIfToBooleanFalse() {
   Node* accumulator = environment()->LookupAccumulator();
   Node* condition = NewNode(simplified()->ToBoolean(), accumulator);
-  BuildJumpIfNot(condition);
+  BuildJumpIfNot(condition, GetBranchHint(accumulator));
 }
 
 void BytecodeGraphBuilder::BuildJumpIfNotHole() {
@@ -193,9 +193,14 @@ class EffectControlLinearizer {
   void LowerTransitionElementsKind(Node* node);
   Node* LowerLoadFieldByIndex(Node* node);
   Node* LowerLoadMessage(Node* node);
+  Node* BuildFastApiTypedArrayStackSlot(Node* length, Node* data_ptr);
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
+  Node* AdaptFastCallJSArrayArgument(Node* node, CTypeInfo::Type element_type,
+                                     GraphAssemblerLabel<0>* bailout);
+  Node* AdaptFastCallStringArgument(Node* node, CTypeInfo::Type type,
+                                    GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallArgument(Node* node, CTypeInfo arg_type,
                               GraphAssemblerLabel<0>* if_error);
 
@@ -4915,6 +4920,113 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
   Node* length_in_bytes =
       __ LoadField(AccessBuilder::ForJSTypedArrayLength(), node);
 
+  return BuildFastApiTypedArrayStackSlot(length_in_bytes, data_ptr);
+}
+
+Node* EffectControlLinearizer::AdaptFastCallJSArrayArgument(
+    Node* node, CTypeInfo::Type element_type,
+    GraphAssemblerLabel<0>* bailout) {
+  // Check that the value is a JSArray.
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* value_is_js_array =
+      __ Word32Equal(value_instance_type, __ Int32Constant(JS_ARRAY_TYPE));
+  __ GotoIfNot(value_is_js_array, bailout);
+
+  if (element_type == CTypeInfo::Type::kVoid) {
+    // The array itself is passed as a v8::Local<v8::Array>.
+    int kAlign = alignof(uintptr_t);
+    int kSize = sizeof(uintptr_t);
+    Node* stack_slot = __ StackSlot(kSize, kAlign);
+    __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                                 kNoWriteBarrier),
+             stack_slot, 0, node);
+    return stack_slot;
+  }
+
+  // Only packed double arrays have unboxed elements without holes, which can
+  // be passed as a FastApiArray<double>. The elements don't move during the
+  // call, since fast calls must not allocate on the JS heap.
+  CHECK_EQ(element_type, CTypeInfo::Type::kFloat64);
+  Node* bit_field2 = __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+  Node* mask = __ Int32Constant(Map::Bits2::ElementsKindBits::kMask);
+  Node* andit = __ Word32And(bit_field2, mask);
+  Node* shift = __ Int32Constant(Map::Bits2::ElementsKindBits::kShift);
+  Node* kind = __ Word32Shr(andit, shift);
+  Node* value_is_packed_double_array =
+      __ Word32Equal(kind, __ Int32Constant(PACKED_DOUBLE_ELEMENTS));
+  __ GotoIfNot(value_is_packed_double_array, bailout);
+
+  Node* elements = __ LoadField(AccessBuilder::ForJSObjectElements(), node);
+  Node* data_ptr =
+      __ IntAdd(__ BitcastTaggedToWord(elements),
+                __ IntPtrConstant(FixedDoubleArray::kHeaderSize -
+                                  kHeapObjectTag));
+  Node* length = ChangeSmiToIntPtr(__ LoadField(
+      AccessBuilder::ForJSArrayLength(PACKED_DOUBLE_ELEMENTS), node));
+
+  return BuildFastApiTypedArrayStackSlot(length, data_ptr);
+}
+
+Node* EffectControlLinearizer::AdaptFastCallStringArgument(
+    Node* node, CTypeInfo::Type type, GraphAssemblerLabel<0>* bailout) {
+  DCHECK(type == CTypeInfo::Type::kSeqOneByteString ||
+         type == CTypeInfo::Type::kSeqTwoByteString);
+  bool is_one_byte = type == CTypeInfo::Type::kSeqOneByteString;
+
+  // Check that the value is a sequential string with the expected encoding.
+  // Other representations don't store their characters inline, so they go
+  // to the slow path.
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* representation_and_encoding = __ Word32And(
+      value_instance_type,
+      __ Int32Constant(static_cast<int32_t>(
+          kIsNotStringMask | kStringRepresentationAndEncodingMask)));
+  Node* value_is_expected_string = __ Word32Equal(
+      representation_and_encoding,
+      __ Int32Constant(is_one_byte ? kSeqOneByteStringTag
+                                   : kSeqTwoByteStringTag));
+  __ GotoIfNot(value_is_expected_string, bailout);
+
+  int header_size = is_one_byte ? SeqOneByteString::kHeaderSize
+                                : SeqTwoByteString::kHeaderSize;
+  Node* data_ptr = __ IntAdd(__ BitcastTaggedToWord(node),
+                             __ IntPtrConstant(header_size - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+
+  // We hard-code FastOneByteString here, because FastTwoByteString has the
+  // same layout.
+  constexpr int kAlign = alignof(FastOneByteString);
+  constexpr int kSize = sizeof(FastOneByteString);
+  static_assert(kAlign == alignof(FastTwoByteString),
+                "Alignment mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  static_assert(kSize == sizeof(FastTwoByteString),
+                "Size mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  static_assert(offsetof(FastOneByteString, length) ==
+                    offsetof(FastTwoByteString, length),
+                "Layout mismatch between FastOneByteString and "
+                "FastTwoByteString");
+  Node* stack_slot = __ StackSlot(kSize, kAlign);
+
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, data)),
+           data_ptr);
+  __ Store(
+      StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+      stack_slot, static_cast<int>(offsetof(FastOneByteString, length)),
+      length);
+
+  return stack_slot;
+}
+
+Node* EffectControlLinearizer::BuildFastApiTypedArrayStackSlot(
+    Node* length, Node* data_ptr) {
   // We hard-code int32_t here, because all specializations of
   // FastApiTypedArray have the same size.
   constexpr int kAlign = alignof(FastApiTypedArray<int32_t>);
@@ -4925,6 +5037,8 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
   static_assert(kSize == sizeof(FastApiTypedArray<double>),
                 "Size mismatch between different specializations of "
                 "FastApiTypedArray");
+  static_assert(kSize == sizeof(FastApiArray<double>),
+                "Size mismatch between FastApiTypedArray and FastApiArray");
   static_assert(
       kSize == sizeof(uintptr_t) + sizeof(size_t),
       "The size of "
@@ -4933,7 +5047,7 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
 
   __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
                                kNoWriteBarrier),
-           stack_slot, 0, length_in_bytes);
+           stack_slot, 0, length);
   __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
                                kNoWriteBarrier),
            stack_slot, sizeof(size_t), data_ptr);
@@ -4962,32 +5076,26 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
         case CTypeInfo::Type::kFloat32: {
           return __ TruncateFloat64ToFloat32(node);
         }
+        case CTypeInfo::Type::kSeqOneByteString:
+        case CTypeInfo::Type::kSeqTwoByteString: {
+          // Check that the value is a HeapObject.
+          Node* value_is_smi = ObjectIsSmi(node);
+          __ GotoIf(value_is_smi, if_error);
+
+          return AdaptFastCallStringArgument(node, arg_type.GetType(),
+                                             if_error);
+        }
         default: {
           return node;
         }
       }
     }
     case CTypeInfo::SequenceType::kIsSequence: {
-      CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kVoid);
-
       // Check that the value is a HeapObject.
       Node* value_is_smi = ObjectIsSmi(node);
       __ GotoIf(value_is_smi, if_error);
 
-      Node* stack_slot = __ StackSlot(kSize, kAlign);
-      __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
-                                   kNoWriteBarrier),
-               stack_slot, 0, node);
-
-      // Check that the value is a JSArray.
-      Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
-      Node* value_instance_type =
-          __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
-      Node* value_is_js_array =
-          __ Word32Equal(value_instance_type, __ Int32Constant(JS_ARRAY_TYPE));
-      __ GotoIfNot(value_is_js_array, if_error);
-
-      return stack_slot;
+      return AdaptFastCallJSArrayArgument(node, arg_type.GetType(), if_error);
     }
     case CTypeInfo::SequenceType::kIsTypedArray: {
       // Check that the value is a HeapObject.
@@ -5029,24 +5137,10 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
 
     switch (arg_type.GetSequenceType()) {
       case CTypeInfo::SequenceType::kIsSequence: {
-        CHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kVoid);
-
-        // Check that the value is a JSArray.
-        Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
-        Node* value_instance_type =
-            __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
-        Node* value_is_js_array = __ Word32Equal(
-            value_instance_type, __ Int32Constant(JS_ARRAY_TYPE));
-        __ GotoIfNot(value_is_js_array, &next);
-
-        int kAlign = alignof(uintptr_t);
-        int kSize = sizeof(uintptr_t);
-        Node* stack_slot = __ StackSlot(kSize, kAlign);
-
-        __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
-                                     kNoWriteBarrier),
-                 stack_slot, 0, node);
-
+        // Check that the value is a JSArray, of doubles if the c-function
+        // expects a span.
+        Node* stack_slot =
+            AdaptFastCallJSArrayArgument(node, arg_type.GetType(), &next);
         Node* target_address = __ ExternalConstant(ExternalReference::Create(
             c_functions[func_index].address, ref_type));
         __ Goto(&merge, target_address, stack_slot);
@@ -5333,7 +5427,13 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       fast_call_result = ChangeFloat64ToTagged(
           c_call_result, CheckForMinusZeroMode::kCheckForMinusZero);
       break;
+    case CTypeInfo::Type::kInt8:
+    case CTypeInfo::Type::kUint8:
+    case CTypeInfo::Type::kInt16:
+    case CTypeInfo::Type::kUint16:
     case CTypeInfo::Type::kV8Value:
+    case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
     case CTypeInfo::Type::kApiObject:
       UNREACHABLE();
     case CTypeInfo::Type::kAny:
@@ -6601,13 +6701,19 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
 
     __ Bind(&if_notmatch);
     {
-      Node* next_entry = ChangeSmiToIntPtr(__ Load(
+      // The chain value holds the next entry plus one below the hash tag,
+      // see OrderedHashTable::ChainValue.
+      Node* chain = ChangeSmiToIntPtr(__ Load(
           MachineType::TaggedSigned(), table,
           __ IntAdd(
               __ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
               __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() +
                                 OrderedHashMap::kChainOffset * kTaggedSize -
                                 kHeapObjectTag))));
+      Node* next_entry = __ IntSub(
+          __ WordAnd(chain,
+                     __ IntPtrConstant(OrderedHashMap::kChainEntryMask)),
+          __ IntPtrConstant(1));
       __ Goto(&loop, next_entry);
     }
   }
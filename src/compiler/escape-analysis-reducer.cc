@@ -34,6 +34,7 @@ EscapeAnalysisReducer::EscapeAnalysisReducer(
       object_id_cache_(zone),
       node_cache_(jsgraph->graph(), zone),
       arguments_elements_(zone),
+      materializations_(zone),
       zone_(zone) {}
 
 Reduction EscapeAnalysisReducer::ReplaceNode(Node* original,
@@ -115,6 +116,7 @@ Reduction EscapeAnalysisReducer::Reduce(Node* node) {
       // it is working. For now we use EffectInputCount > 0 to determine
       // whether a node might have a frame state input.
       if (node->op()->EffectInputCount() > 0) {
+        ReduceMaterializedInputs(node);
         ReduceFrameStateInputs(node);
       }
       return NoChange();
@@ -154,6 +156,57 @@ void EscapeAnalysisReducer::ReduceFrameStateInputs(Node* node) {
   }
 }
 
+void EscapeAnalysisReducer::ReduceMaterializedInputs(Node* node) {
+  for (Edge edge : node->input_edges()) {
+    if (!NodeProperties::IsValueEdge(edge) &&
+        !NodeProperties::IsContextEdge(edge)) {
+      continue;
+    }
+    const VirtualObject* vobject =
+        analysis_result().GetVirtualObject(edge.to());
+    if (!vobject || vobject->HasEscaped()) continue;
+    if (Node* sink = analysis_result().GetMaterializationPoint(vobject, node)) {
+      edge.UpdateTo(MaterializeAt(vobject, sink));
+    }
+  }
+}
+
+// Allocates and initializes a sunk object right before the node {sink}.
+Node* EscapeAnalysisReducer::MaterializeAt(const VirtualObject* vobject,
+                                           Node* sink) {
+  auto key = std::make_pair(sink->id(), vobject->id());
+  auto it = materializations_.find(key);
+  if (it != materializations_.end()) return it->second;
+
+  TRACE("Materializing virtual object %d at %s#%d\n", vobject->id(),
+        sink->op()->mnemonic(), sink->id());
+  Graph* graph = jsgraph()->graph();
+  Node* allocation = vobject->allocation();
+  Type type = NodeProperties::GetType(allocation);
+  Node* effect = NodeProperties::GetEffectInput(sink);
+  Node* control = NodeProperties::GetControlInput(sink);
+  effect = graph->NewNode(
+      jsgraph()->common()->BeginRegion(RegionObservability::kNotObservable),
+      effect);
+  Node* object = graph->NewNode(allocation->op(), allocation->InputAt(0),
+                                effect, control);
+  NodeProperties::SetType(object, type);
+  effect = object;
+  for (int offset = 0; offset < vobject->size(); offset += kTaggedSize) {
+    // The fields don't change at the sink, so they can be read after it.
+    Node* value =
+        analysis_result().GetVirtualObjectField(vobject, offset, sink);
+    effect = graph->NewNode(vobject->FieldStoreAt(offset), object, value,
+                            effect, control);
+  }
+  object =
+      graph->NewNode(jsgraph()->common()->FinishRegion(), object, effect);
+  NodeProperties::SetType(object, type);
+  NodeProperties::ReplaceEffectInput(sink, object);
+  materializations_[key] = object;
+  return object;
+}
+
 Node* EscapeAnalysisReducer::ReduceDeoptState(Node* node, Node* effect,
                                               Deduplicator* deduplicator) {
   if (node->opcode() == IrOpcode::kFrameState) {
@@ -183,6 +236,10 @@ Node* EscapeAnalysisReducer::ReduceDeoptState(Node* node, Node* effect,
   } else if (const VirtualObject* vobject = analysis_result().GetVirtualObject(
                  SkipValueIdentities(node))) {
     if (vobject->HasEscaped()) return node;
+    if (Node* sink =
+            analysis_result().GetMaterializationPoint(vobject, effect)) {
+      return MaterializeAt(vobject, sink);
+    }
     if (deduplicator->SeenBefore(vobject)) {
       return ObjectIdNode(vobject);
     } else {
@@ -98,7 +98,9 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
 
  private:
   void ReduceFrameStateInputs(Node* node);
+  void ReduceMaterializedInputs(Node* node);
   Node* ReduceDeoptState(Node* node, Node* effect, Deduplicator* deduplicator);
+  Node* MaterializeAt(const VirtualObject* vobject, Node* sink);
   Node* ObjectIdNode(const VirtualObject* vobject);
   Reduction ReplaceNode(Node* original, Node* replacement);
 
@@ -113,6 +115,8 @@ class V8_EXPORT_PRIVATE EscapeAnalysisReducer final
   ZoneVector<Node*> object_id_cache_;
   NodeHashCache node_cache_;
   ZoneSet<Node*> arguments_elements_;
+  // The materializations of sunk objects, keyed by the node they are sunk to.
+  ZoneMap<std::pair<NodeId, VirtualObject::Id>, Node*> materializations_;
   Zone* const zone_;
 };
 
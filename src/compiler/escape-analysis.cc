@@ -144,6 +144,8 @@ class VariableTracker {
       }
       return Just(node);
     }
+    // Like {Get}, but also returns the {Dead} sentinel.
+    Node* GetUnchecked(Variable var) { return current_state_.Get(var); }
     void Set(Variable var, Node* node) { current_state_.Set(var, node); }
 
    private:
@@ -162,6 +164,28 @@ class VariableTracker {
   TickCounter* const tick_counter_;
 };
 
+namespace {
+
+// Whether {effect} is inside an allocation region, where no other allocation
+// can be placed.
+bool IsInsideRegion(Node* effect) {
+  while (true) {
+    switch (effect->opcode()) {
+      case IrOpcode::kBeginRegion:
+        return true;
+      case IrOpcode::kAllocate:
+      case IrOpcode::kStoreField:
+      case IrOpcode::kStoreElement:
+        effect = NodeProperties::GetEffectInput(effect);
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+}  // namespace
+
 // Encapsulates the current state of the escape analysis reducer to preserve
 // invariants regarding changes and re-visitation.
 class EscapeAnalysisTracker : public ZoneObject {
@@ -195,7 +219,7 @@ class EscapeAnalysisTracker : public ZoneObject {
       if (vobject) {
         CHECK(vobject->size() == size);
       } else {
-        vobject = tracker_->NewVirtualObject(size);
+        vobject = tracker_->NewVirtualObject(size, current_node());
       }
       if (vobject) vobject->AddDependency(current_node());
       vobject_ = vobject;
@@ -216,6 +240,99 @@ class EscapeAnalysisTracker : public ZoneObject {
         object->RevisitDependants(reducer_);
       }
     }
+
+    // Where a virtual object is sunk, it is materialized on the current effect
+    // path; where it is unknown, it is materialized on some paths only.
+    enum class Materialization { kVirtual, kMaterialized, kUnknown };
+    Materialization GetMaterialization(const VirtualObject* vobject) {
+      if (!vobject->IsSunk()) return Materialization::kVirtual;
+      Node* state = GetUnchecked(vobject->materialization());
+      if (state == nullptr || state->opcode() == IrOpcode::kPhi) {
+        return Materialization::kUnknown;
+      }
+      if (state->opcode() == IrOpcode::kDead) {
+        return Materialization::kVirtual;
+      }
+      return Materialization::kMaterialized;
+    }
+    // Whether {vobject} can be replaced by its fields at the current node.
+    bool IsVirtual(const VirtualObject* vobject) {
+      return vobject && !vobject->HasEscaped() &&
+             GetMaterialization(vobject) == Materialization::kVirtual;
+    }
+    // Marks the object {node} as escaping, unless the current node can use its
+    // materialization.
+    void EscapeUnlessMaterialized(Node* node) {
+      VirtualObject* vobject = tracker_->virtual_objects_.Get(node);
+      if (vobject && !vobject->HasEscaped()) {
+        vobject->AddDependency(current_node());
+        if (GetMaterialization(vobject) == Materialization::kMaterialized) {
+          return;
+        }
+      }
+      SetEscaped(node);
+    }
+    // Marks the object {node} as escaping, unless the current node can use its
+    // materialization or the object can be sunk to the current node.
+    void EscapeOrSink(Node* node) {
+      VirtualObject* vobject = tracker_->virtual_objects_.Get(node);
+      if (vobject && !vobject->HasEscaped()) {
+        vobject->AddDependency(current_node());
+        switch (GetMaterialization(vobject)) {
+          case Materialization::kMaterialized:
+            return;
+          case Materialization::kVirtual:
+            if (CanSink(vobject)) {
+              Sink(vobject);
+              return;
+            }
+            break;
+          case Materialization::kUnknown:
+            break;
+        }
+      }
+      SetEscaped(node);
+    }
+    // Marks the sunk objects in the frame state {node} as escaping if they are
+    // materialized on some paths to the current node only. Elsewhere, the
+    // deoptimizer either materializes them from an ObjectState or uses their
+    // materialization.
+    void EscapeUndescribableObjects(Node* node) {
+      switch (node->opcode()) {
+        case IrOpcode::kFrameState:
+        case IrOpcode::kStateValues:
+        case IrOpcode::kTypedStateValues:
+          for (Node* input : node->inputs()) {
+            EscapeUndescribableObjects(input);
+          }
+          return;
+        default:
+          break;
+      }
+      Node* object = SkipValueIdentities(tracker_->ResolveReplacement(node));
+      VirtualObject* vobject = tracker_->virtual_objects_.Get(object);
+      if (vobject && vobject->IsSunk() && !vobject->HasEscaped()) {
+        vobject->AddDependency(current_node());
+        if (GetMaterialization(vobject) == Materialization::kUnknown) {
+          SetEscaped(object);
+        }
+      }
+    }
+    // Records the operator of a store to the virtual object {object}, which is
+    // needed to materialize the object.
+    void RecordFieldStore(Node* object, int offset, const Operator* op) {
+      VirtualObject* vobject = tracker_->virtual_objects_.Get(object);
+      if (!vobject->IsSinkable()) return;
+      vobject->RecordFieldStore(offset, op);
+      if (!vobject->IsSinkable()) vobject->RevisitDependants(reducer_);
+    }
+    void SetNotSinkable(Node* object) {
+      VirtualObject* vobject = tracker_->virtual_objects_.Get(object);
+      if (!vobject->IsSinkable()) return;
+      vobject->SetNotSinkable();
+      vobject->RevisitDependants(reducer_);
+    }
+
     // The inputs of the current node have to be accessed through the scope to
     // ensure that they respect the node replacements.
     Node* ValueInput(int i) {
@@ -256,6 +373,45 @@ class EscapeAnalysisTracker : public ZoneObject {
     }
 
    private:
+    bool CanSink(const VirtualObject* vobject) {
+      if (!FLAG_turbo_allocation_sinking || !vobject->IsSinkable()) {
+        return false;
+      }
+      const Operator* op = current_node()->op();
+      if (op->EffectInputCount() != 1 || op->ControlInputCount() == 0) {
+        return false;
+      }
+      if (IsInsideRegion(NodeProperties::GetEffectInput(current_node()))) {
+        return false;
+      }
+      Node* state = GetUnchecked(vobject->materialization());
+      if (state == nullptr || state->opcode() != IrOpcode::kDead) return false;
+      for (int offset = 0; offset < vobject->size(); offset += kTaggedSize) {
+        if (vobject->FieldStoreAt(offset) == nullptr) return false;
+        Node* value = GetUnchecked(vobject->FieldAt(offset).FromJust());
+        if (value == nullptr || value->opcode() == IrOpcode::kDead) {
+          return false;
+        }
+        // Virtual objects in fields would have to be materialized as well.
+        VirtualObject* field_object = tracker_->virtual_objects_.Get(value);
+        if (field_object && !field_object->HasEscaped()) return false;
+      }
+      return true;
+    }
+    void Sink(VirtualObject* vobject) {
+      TRACE("Sinking virtual object %d to %s#%d\n", vobject->id(),
+            current_node()->op()->mnemonic(), current_node()->id());
+      Set(vobject->materialization(), current_node());
+      tracker_->has_sunk_objects_ = true;
+      if (!vobject->IsSunk()) {
+        // Nodes that saw the object before now have to check on which paths
+        // it is materialized.
+        vobject->SetSunk();
+        vobject->RevisitDependants(reducer_);
+        vobject->AddDependency(current_node());
+      }
+    }
+
     EscapeAnalysisTracker* tracker_;
     EffectGraphReducer* reducer_;
     VirtualObject* vobject_ = nullptr;
@@ -269,21 +425,23 @@ class EscapeAnalysisTracker : public ZoneObject {
     }
     return node;
   }
+  bool HasSunkObjects() const { return has_sunk_objects_; }
 
  private:
   friend class EscapeAnalysisResult;
   static const size_t kMaxTrackedObjects = 100;
 
-  VirtualObject* NewVirtualObject(int size) {
+  VirtualObject* NewVirtualObject(int size, Node* allocation) {
     if (next_object_id_ >= kMaxTrackedObjects) return nullptr;
     return zone_->New<VirtualObject>(&variable_states_, next_object_id_++,
-                                     size);
+                                     size, allocation);
   }
 
   SparseSidetable<VirtualObject*> virtual_objects_;
   Sidetable<Node*> replacements_;
   VariableTracker variable_states_;
   VirtualObject::Id next_object_id_ = 0;
+  bool has_sunk_objects_ = false;
   JSGraph* const jsgraph_;
   Zone* const zone_;
 };
@@ -578,6 +736,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         for (Variable field : *vobject) {
           current->Set(field, jsgraph->Dead());
         }
+        current->Set(vobject->materialization(), jsgraph->Dead());
       }
       break;
     }
@@ -589,13 +748,14 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       Node* value = current->ValueInput(1);
       const VirtualObject* vobject = current->GetVirtualObject(object);
       Variable var;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           vobject->FieldAt(OffsetOfFieldAccess(op)).To(&var)) {
         current->Set(var, value);
+        current->RecordFieldStore(object, OffsetOfFieldAccess(op), op);
         current->MarkForDeletion();
       } else {
-        current->SetEscaped(object);
-        current->SetEscaped(value);
+        current->EscapeUnlessMaterialized(object);
+        current->EscapeOrSink(value);
       }
       break;
     }
@@ -606,14 +766,17 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       const VirtualObject* vobject = current->GetVirtualObject(object);
       int offset;
       Variable var;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           OffsetOfElementsAccess(op, index).To(&offset) &&
           vobject->FieldAt(offset).To(&var)) {
         current->Set(var, value);
+        // TODO(turbofan): Support materializing elements, which would need the
+        // index of the store as well.
+        current->SetNotSinkable(object);
         current->MarkForDeletion();
       } else {
-        current->SetEscaped(value);
-        current->SetEscaped(object);
+        current->EscapeOrSink(value);
+        current->EscapeUnlessMaterialized(object);
       }
       break;
     }
@@ -622,12 +785,12 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       const VirtualObject* vobject = current->GetVirtualObject(object);
       Variable var;
       Node* value;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           vobject->FieldAt(OffsetOfFieldAccess(op)).To(&var) &&
           current->Get(var).To(&value)) {
         current->SetReplacement(value);
       } else {
-        current->SetEscaped(object);
+        current->EscapeUnlessMaterialized(object);
       }
       break;
     }
@@ -638,12 +801,12 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       int offset;
       Variable var;
       Node* value;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           OffsetOfElementsAccess(op, index).To(&offset) &&
           vobject->FieldAt(offset).To(&var) && current->Get(var).To(&value)) {
         current->SetReplacement(value);
         break;
-      } else if (vobject && !vobject->HasEscaped()) {
+      } else if (current->IsVirtual(vobject)) {
         // Compute the known length (aka the number of elements) of {object}
         // based on the virtual object information.
         ElementAccess const& access = ElementAccessOf(op);
@@ -698,7 +861,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           }
         }
       }
-      current->SetEscaped(object);
+      current->EscapeUnlessMaterialized(object);
       break;
     }
     case IrOpcode::kTypeGuard: {
@@ -742,7 +905,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       const VirtualObject* vobject = current->GetVirtualObject(checked);
       Variable map_field;
       Node* map;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           vobject->FieldAt(HeapObject::kMapOffset).To(&map_field) &&
           current->Get(map_field).To(&map)) {
         if (map) {
@@ -759,7 +922,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           break;
         }
       }
-      current->SetEscaped(checked);
+      current->EscapeUnlessMaterialized(checked);
       break;
     }
     case IrOpcode::kCompareMaps: {
@@ -767,7 +930,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       const VirtualObject* vobject = current->GetVirtualObject(object);
       Variable map_field;
       Node* object_map;
-      if (vobject && !vobject->HasEscaped() &&
+      if (current->IsVirtual(vobject) &&
           vobject->FieldAt(HeapObject::kMapOffset).To(&map_field) &&
           current->Get(map_field).To(&object_map)) {
         if (object_map) {
@@ -780,7 +943,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           break;
         }
       }
-      current->SetEscaped(object);
+      current->EscapeUnlessMaterialized(object);
       break;
     }
     case IrOpcode::kCheckHeapObject: {
@@ -800,7 +963,7 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
     case IrOpcode::kMapGuard: {
       Node* object = current->ValueInput(0);
       const VirtualObject* vobject = current->GetVirtualObject(object);
-      if (vobject && !vobject->HasEscaped()) {
+      if (current->IsVirtual(vobject)) {
         current->MarkForDeletion();
       }
       break;
@@ -831,14 +994,15 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       break;
     }
     default: {
-      // For unknown nodes, treat all value inputs as escaping.
+      // For unknown nodes, treat all value inputs as escaping, unless their
+      // allocation can be sunk to the current node.
       int value_input_count = op->ValueInputCount();
       for (int i = 0; i < value_input_count; ++i) {
         Node* input = current->ValueInput(i);
-        current->SetEscaped(input);
+        current->EscapeOrSink(input);
       }
       if (OperatorProperties::HasContextInput(op)) {
-        current->SetEscaped(current->ContextInput());
+        current->EscapeOrSink(current->ContextInput());
       }
       break;
     }
@@ -853,6 +1017,13 @@ void EscapeAnalysis::Reduce(Node* node, Reduction* reduction) {
 
   EscapeAnalysisTracker::Scope current(this, tracker_, node, reduction);
   ReduceNode(op, &current, jsgraph());
+  if (tracker_->HasSunkObjects() && op->EffectInputCount() > 0) {
+    for (Node* input : node->inputs()) {
+      if (input->opcode() == IrOpcode::kFrameState) {
+        current.EscapeUndescribableObjects(input);
+      }
+    }
+  }
 }
 
 EscapeAnalysis::EscapeAnalysis(JSGraph* jsgraph, TickCounter* tick_counter,
@@ -883,9 +1054,25 @@ const VirtualObject* EscapeAnalysisResult::GetVirtualObject(Node* node) {
   return tracker_->virtual_objects_.Get(node);
 }
 
+Node* EscapeAnalysisResult::GetMaterializationPoint(
+    const VirtualObject* vobject, Node* effect) {
+  if (!vobject->IsSunk()) return nullptr;
+  Node* state =
+      tracker_->variable_states_.Get(vobject->materialization(), effect);
+  if (state == nullptr || state->opcode() == IrOpcode::kDead ||
+      state->opcode() == IrOpcode::kPhi) {
+    return nullptr;
+  }
+  return state;
+}
+
 VirtualObject::VirtualObject(VariableTracker* var_states, VirtualObject::Id id,
-                             int size)
-    : Dependable(var_states->zone()), id_(id), fields_(var_states->zone()) {
+                             int size, Node* allocation)
+    : Dependable(var_states->zone()),
+      id_(id),
+      fields_(var_states->zone()),
+      field_stores_(var_states->zone()),
+      allocation_(allocation) {
   DCHECK(IsAligned(size, kTaggedSize));
   TRACE("Creating VirtualObject id:%d size:%d\n", id, size);
   int num_fields = size / kTaggedSize;
@@ -893,6 +1080,18 @@ VirtualObject::VirtualObject(VariableTracker* var_states, VirtualObject::Id id,
   for (int i = 0; i < num_fields; ++i) {
     fields_.push_back(var_states->NewVariable());
   }
+  field_stores_.resize(num_fields, nullptr);
+  materialization_ = var_states->NewVariable();
+}
+
+void VirtualObject::RecordFieldStore(int offset, const Operator* op) {
+  DCHECK(IsAligned(offset, kTaggedSize));
+  const Operator*& field_store = field_stores_.at(offset / kTaggedSize);
+  if (field_store == nullptr) {
+    field_store = op;
+  } else if (!field_store->Equals(op)) {
+    sinkable_ = false;
+  }
 }
 
 #undef TRACE
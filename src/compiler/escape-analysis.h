@@ -122,11 +122,17 @@ class Dependable : public ZoneObject {
 
 // A virtual object represents an allocation site and tracks the Variables
 // associated with its fields as well as its global escape status.
+//
+// With allocation sinking, an object that escapes only on some paths is not
+// marked as escaped globally. Instead, it is materialized right before the
+// escaping use and the {materialization} variable records on which effect
+// paths the materialized object has to be used instead of the virtual one.
 class VirtualObject : public Dependable {
  public:
   using Id = uint32_t;
   using const_iterator = ZoneVector<Variable>::const_iterator;
-  VirtualObject(VariableTracker* var_states, Id id, int size);
+  VirtualObject(VariableTracker* var_states, Id id, int size,
+                Node* allocation);
   Maybe<Variable> FieldAt(int offset) const {
     CHECK(IsAligned(offset, kTaggedSize));
     CHECK(!HasEscaped());
@@ -153,10 +159,36 @@ class VirtualObject : public Dependable {
   const_iterator begin() const { return fields_.begin(); }
   const_iterator end() const { return fields_.end(); }
 
+  // The Allocate node of the object.
+  Node* allocation() const { return allocation_; }
+  // The variable holding the Dead node on effect paths where the object is
+  // still virtual, and the node the object is sunk to on paths where it is
+  // materialized.
+  Variable materialization() const { return materialization_; }
+  // Whether the object was sunk to at least one escaping use.
+  void SetSunk() { sunk_ = true; }
+  bool IsSunk() const { return sunk_; }
+  // The store operator that initializes the field at {offset} when the object
+  // is materialized, or nullptr if there is none.
+  const Operator* FieldStoreAt(int offset) const {
+    DCHECK(IsAligned(offset, kTaggedSize));
+    return field_stores_.at(offset / kTaggedSize);
+  }
+  // An object is not sinkable if its fields can't be initialized with one
+  // store operator each.
+  void RecordFieldStore(int offset, const Operator* op);
+  void SetNotSinkable() { sinkable_ = false; }
+  bool IsSinkable() const { return sinkable_; }
+
  private:
   bool escaped_ = false;
+  bool sunk_ = false;
+  bool sinkable_ = true;
   Id id_;
   ZoneVector<Variable> fields_;
+  ZoneVector<const Operator*> field_stores_;
+  Variable materialization_;
+  Node* const allocation_;
 };
 
 class EscapeAnalysisResult {
@@ -168,6 +200,9 @@ class EscapeAnalysisResult {
   Node* GetVirtualObjectField(const VirtualObject* vobject, int field,
                               Node* effect);
   Node* GetReplacementOf(Node* node);
+  // Returns the node {vobject} is sunk to if it is materialized at {effect},
+  // or nullptr if it is virtual there.
+  Node* GetMaterializationPoint(const VirtualObject* vobject, Node* effect);
 
  private:
   EscapeAnalysisTracker* tracker_;
@@ -15,14 +15,17 @@
 #include "src/codegen/code-factory.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/per-isolate-compiler-cache.h"
 #include "src/execution/protectors-inl.h"
 #include "src/objects/allocation-site-inl.h"
+#include "src/objects/debug-objects-inl.h"
 #include "src/objects/descriptor-array.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/property-cell.h"
 #include "src/objects/template-objects-inl.h"
+#include "src/roots/roots-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -949,14 +952,43 @@ void JSHeapBroker::InitializeAndStartSerializing() {
   // Throw away the dummy data that we created while disabled.
   feedback_.clear();
   refs_->Clear();
-  refs_ =
-      zone()->New<RefsMap>(kInitialRefsBucketCount, AddressMatcher(), zone());
+  InitializeRefsMap();
 
   CollectArrayAndObjectPrototypes();
 
   SetTargetNativeContextRef(target_native_context().object());
 }
 
+void JSHeapBroker::InitializeRefsMap() {
+  TraceScope tracer(this, "JSHeapBroker::InitializeRefsMap");
+
+  PerIsolateCompilerCache::Setup(isolate());
+  PerIsolateCompilerCache* compiler_cache = isolate()->compiler_cache();
+
+  if (!compiler_cache->HasSnapshot()) {
+    // The data of read-only heap objects never changes and doesn't need
+    // dependencies, so it is created once in the compiler zone of the isolate
+    // and shared by all subsequent compilation jobs. The keys are the root
+    // table slots, which is what CanonicalPersistentHandle returns for roots.
+    TRACE(this, "Creating the RefsMap snapshot");
+    Zone* cache_zone = compiler_cache->zone();
+    RefsMap* snapshot = cache_zone->New<RefsMap>(
+        kInitialRefsBucketCount, AddressMatcher(), cache_zone);
+    for (RootIndex root_index = RootIndex::kFirstReadOnlyRoot;
+         root_index <= RootIndex::kLastReadOnlyRoot; ++root_index) {
+      Handle<Object> object = isolate()->root_handle(root_index);
+      RefsMap::Entry* entry = snapshot->LookupOrInsert(object.address());
+      if (entry->value != nullptr) continue;
+      cache_zone->New<ObjectData>(this, &entry->value, object,
+                                  kUnserializedReadOnlyHeapObject);
+    }
+    compiler_cache->SetSnapshot(snapshot);
+  }
+
+  TRACE(this, "Importing the RefsMap snapshot");
+  refs_ = zone()->New<RefsMap>(compiler_cache->GetSnapshot(), zone());
+}
+
 namespace {
 
 constexpr ObjectDataKind ObjectDataKindFor(RefSerializationKind kind) {
@@ -1566,6 +1598,17 @@ BytecodeArrayRef SharedFunctionInfoRef::GetBytecodeArray() const {
   return MakeRefAssumeMemoryFence(broker(), bytecode_array);
 }
 
+base::Optional<CoverageInfoRef> SharedFunctionInfoRef::coverage_info() const {
+  // The coverage info may be removed concurrently, so only read the debug
+  // info once.
+  HeapObject script_or_debug_info =
+      object()->script_or_debug_info(kAcquireLoad);
+  if (!script_or_debug_info.IsDebugInfo()) return {};
+  Object coverage_info = DebugInfo::cast(script_or_debug_info).coverage_info();
+  if (!coverage_info.IsCoverageInfo()) return {};
+  return TryMakeRef(broker(), CoverageInfo::cast(coverage_info));
+}
+
 #define DEF_SFI_ACCESSOR(type, name) \
   HEAP_ACCESSOR_C(SharedFunctionInfo, type, name)
 BROKER_SFI_FIELDS(DEF_SFI_ACCESSOR)
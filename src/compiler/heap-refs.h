@@ -112,6 +112,7 @@ enum class RefSerializationKind {
   NEVER_SERIALIZED(Cell)                                                      \
   NEVER_SERIALIZED(Code)                                                      \
   NEVER_SERIALIZED(CodeDataContainer)                                         \
+  NEVER_SERIALIZED(CoverageInfo)                                              \
   NEVER_SERIALIZED(Context)                                                   \
   NEVER_SERIALIZED(DescriptorArray)                                           \
   NEVER_SERIALIZED(FeedbackCell)                                              \
@@ -895,6 +896,7 @@ class V8_EXPORT_PRIVATE SharedFunctionInfoRef : public HeapObjectRef {
   BytecodeArrayRef GetBytecodeArray() const;
   SharedFunctionInfo::Inlineability GetInlineability() const;
   base::Optional<FunctionTemplateInfoRef> function_template_info() const;
+  base::Optional<CoverageInfoRef> coverage_info() const;
   ScopeInfoRef scope_info() const;
 
 #define DECL_ACCESSOR(type, name) type name() const;
@@ -977,6 +979,13 @@ class CellRef : public HeapObjectRef {
   Handle<Cell> object() const;
 };
 
+class CoverageInfoRef : public HeapObjectRef {
+ public:
+  DEFINE_REF_CONSTRUCTOR(CoverageInfo, HeapObjectRef)
+
+  Handle<CoverageInfo> object() const;
+};
+
 class JSGlobalObjectRef : public JSObjectRef {
  public:
   DEFINE_REF_CONSTRUCTOR(JSGlobalObject, JSObjectRef)
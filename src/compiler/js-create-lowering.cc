@@ -932,16 +932,34 @@ Reduction JSCreateLowering::ReduceJSCreateClosure(Node* node) {
   Node* context = n.context();
 
   // Use inline allocation of closures only for instantiation sites that have
-  // seen more than one instantiation, this simplifies the generated code and
+  // seen at least one instantiation, this simplifies the generated code and
   // also serves as a heuristic of which allocation sites benefit from it.
-  if (!feedback_cell.map().equals(
-          MakeRef(broker(), factory()->many_closures_cell_map()))) {
-    return NoChange();
+  // Inline allocation also lets escape analysis remove closures which are
+  // only called, e.g. callbacks of inlined array builtins.
+  MapRef many_closures_cell_map =
+      MakeRef(broker(), factory()->many_closures_cell_map());
+  bool needs_closure_count_bump = false;
+  if (!feedback_cell.map().equals(many_closures_cell_map)) {
+    if (!feedback_cell.map().equals(
+            MakeRef(broker(), factory()->one_closure_cell_map()))) {
+      return NoChange();
+    }
+    needs_closure_count_bump = true;
   }
 
   // Don't inline anything for class constructors.
   if (IsClassConstructor(shared.kind())) return NoChange();
 
+  if (needs_closure_count_bump) {
+    // Bump the closure count encoded in the {feedback_cell}s map, like
+    // FastNewClosure does. The count only ever grows, so the cell has one or
+    // more closures by now and will have many after this one.
+    effect = graph()->NewNode(
+        simplified()->StoreField(AccessBuilder::ForMap(kNoWriteBarrier)),
+        jsgraph()->Constant(feedback_cell),
+        jsgraph()->Constant(many_closures_cell_map), effect, control);
+  }
+
   MapRef function_map =
       native_context().GetFunctionMapFromIndex(shared.function_map_index());
   DCHECK(!function_map.IsInobjectSlackTrackingInProgress());
@@ -702,6 +702,13 @@ CompareOperationHint JSHeapBroker::GetFeedbackForCompareOperation(
                                    : feedback.AsCompareOperation().value();
 }
 
+CompareOperationOutcomeHint JSHeapBroker::GetFeedbackForCompareOperationOutcome(
+    FeedbackSource const& source) const {
+  FeedbackNexus nexus(source.vector, source.slot, feedback_nexus_config());
+  if (nexus.IsUninitialized()) return CompareOperationOutcomeHint::kNone;
+  return nexus.GetCompareOperationOutcomeFeedback();
+}
+
 ForInHint JSHeapBroker::GetFeedbackForForIn(FeedbackSource const& source) {
   ProcessedFeedback const& feedback = ProcessFeedbackForForIn(source);
   return feedback.IsInsufficient() ? ForInHint::kNone
@@ -203,6 +203,9 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   CompareOperationHint GetFeedbackForCompareOperation(
       FeedbackSource const& source);
   ForInHint GetFeedbackForForIn(FeedbackSource const& source);
+  // Whether the comparison has produced true, false, or both so far.
+  CompareOperationOutcomeHint GetFeedbackForCompareOperationOutcome(
+      FeedbackSource const& source) const;
 
   ProcessedFeedback const& GetFeedbackForCall(FeedbackSource const& source);
   ProcessedFeedback const& GetFeedbackForGlobalAccess(
@@ -399,6 +402,9 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   ProcessedFeedback const& ReadFeedbackForTemplateObject(
       FeedbackSource const& source);
 
+  // Seeds {refs_} with the data shared by all compilation jobs of the
+  // isolate, see PerIsolateCompilerCache.
+  void InitializeRefsMap();
   void CollectArrayAndObjectPrototypes();
 
   void set_persistent_handles(
@@ -151,6 +151,14 @@ JSInliningHeuristic::Candidate JSInliningHeuristic::CollectFunctions(
   return out;
 }
 
+bool JSInliningHeuristic::IsProfiledInlinee(
+    Handle<SharedFunctionInfo> shared) const {
+  for (Handle<SharedFunctionInfo> inlinee : info_->profiled_inlinees()) {
+    if (inlinee.equals(shared)) return true;
+  }
+  return false;
+}
+
 Reduction JSInliningHeuristic::Reduce(Node* node) {
 #if V8_ENABLE_WEBASSEMBLY
   if (mode() == kWasmOnly) {
@@ -183,6 +191,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   }
 
   bool can_inline_candidate = false, candidate_is_small = true;
+  bool candidate_is_profiled = true;
   candidate.total_size = 0;
   FrameState frame_state{NodeProperties::GetFrameStateInput(node)};
   FrameStateInfo const& frame_info = frame_state.frame_state_info();
@@ -233,6 +242,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       }
       candidate_is_small = candidate_is_small &&
                            IsSmall(bytecode.length() + inlined_bytecode_size);
+      candidate_is_profiled =
+          candidate_is_profiled && IsProfiledInlinee(shared.object());
     }
   }
   if (!can_inline_candidate) return NoChange();
@@ -251,7 +262,13 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // invocations of the caller.
   if (candidate.frequency.IsKnown() &&
       candidate.frequency.value() < FLAG_min_inlining_frequency) {
-    return NoChange();
+    // Call sites that were inlined in a previous run are considered anyway,
+    // since their frequency may just not have caught up yet.
+    if (!candidate_is_profiled) return NoChange();
+    TRACE("Considering call site #" << node->id() << ":"
+                                    << node->op()->mnemonic()
+                                    << " despite its low frequency, because "
+                                       "it was inlined in the profile");
   }
 
   // Found a candidate. Insert it into the set of seen nodes s.t. we don't
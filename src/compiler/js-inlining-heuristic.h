@@ -21,6 +21,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
                       SourcePositionTable* source_positions, Mode mode)
       : AdvancedReducer(editor),
         inliner_(editor, local_zone, info, jsgraph, broker, source_positions),
+        info_(info),
         candidates_(local_zone),
         seen_(local_zone),
         source_positions_(source_positions),
@@ -90,6 +91,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Node* DuplicateStateValuesAndRename(Node* state_values, Node* from, Node* to,
                                       StateCloneMode mode);
   Candidate CollectFunctions(Node* node, int functions_size);
+  // Whether {shared} was inlined into the function being compiled in a
+  // previous run, according to --tiering-profile-input.
+  bool IsProfiledInlinee(Handle<SharedFunctionInfo> shared) const;
 
   CommonOperatorBuilder* common() const;
   Graph* graph() const;
@@ -102,6 +106,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
   Mode mode() const { return mode_; }
 
   JSInliner inliner_;
+  OptimizedCompilationInfo* const info_;
   Candidates candidates_;
   ZoneSet<NodeId> seen_;
   SourcePositionTable* source_positions_;
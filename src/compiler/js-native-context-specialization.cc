@@ -19,6 +19,7 @@
 #include "src/compiler/linkage.h"
 #include "src/compiler/map-inference.h"
 #include "src/compiler/node-matchers.h"
+#include "src/compiler/operator-properties.h"
 #include "src/compiler/property-access-builder.h"
 #include "src/compiler/type-cache.h"
 #include "src/execution/isolate-inl.h"
@@ -53,7 +54,8 @@ bool HasOnlyJSArrayMaps(JSHeapBroker* broker, ZoneVector<MapRef> const& maps) {
 
 JSNativeContextSpecialization::JSNativeContextSpecialization(
     Editor* editor, JSGraph* jsgraph, JSHeapBroker* broker, Flags flags,
-    CompilationDependencies* dependencies, Zone* zone, Zone* shared_zone)
+    CompilationDependencies* dependencies, Zone* zone, Zone* shared_zone,
+    const std::vector<DeoptLoopSite>& deopt_loop_sites)
     : AdvancedReducer(editor),
       jsgraph_(jsgraph),
       broker_(broker),
@@ -64,7 +66,8 @@ JSNativeContextSpecialization::JSNativeContextSpecialization(
       dependencies_(dependencies),
       zone_(zone),
       shared_zone_(shared_zone),
-      type_cache_(TypeCache::Get()) {}
+      type_cache_(TypeCache::Get()),
+      deopt_loop_sites_(deopt_loop_sites) {}
 
 Reduction JSNativeContextSpecialization::Reduce(Node* node) {
   switch (node->opcode()) {
@@ -208,6 +211,18 @@ bool IsStringConstant(JSHeapBroker* broker, Node* node) {
   HeapObjectMatcher matcher(node);
   return matcher.HasResolvedValue() && matcher.Ref(broker).IsString();
 }
+
+// Returns true if {node} is a constant which can be stored into a shared
+// struct without going through the shared value barrier, i.e. a Smi or a
+// read-only Oddball. This mirrors the fast paths of Object::Share.
+bool IsTriviallySharedConstant(JSHeapBroker* broker, Node* node) {
+  NumberMatcher number_matcher(node);
+  if (number_matcher.HasResolvedValue()) {
+    return IsSmiDouble(number_matcher.ResolvedValue());
+  }
+  HeapObjectMatcher matcher(node);
+  return matcher.HasResolvedValue() && matcher.Ref(broker).IsOddball();
+}
 }  // namespace
 
 Reduction JSNativeContextSpecialization::ReduceJSAsyncFunctionEnter(
@@ -1114,10 +1129,12 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     for (const MapRef& map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to shared structs, which needs a write
-      // barrier that calls Object::Share to ensure the RHS is shared.
+      // TODO(v8:12547): Support writing arbitrary values to shared structs,
+      // which needs a write barrier that calls Object::Share to ensure the RHS
+      // is shared. Constants which are trivially shared need no barrier.
       if (InstanceTypeChecker::IsJSSharedStruct(map.instance_type()) &&
-          access_mode == AccessMode::kStore) {
+          access_mode == AccessMode::kStore &&
+          !IsTriviallySharedConstant(broker(), value)) {
         return NoChange();
       }
 
@@ -2037,6 +2054,8 @@ Reduction JSNativeContextSpecialization::ReducePropertyAccess(
          node->opcode() == IrOpcode::kJSDefineKeyedOwnProperty);
   DCHECK_GE(node->op()->ControlOutputCount(), 1);
 
+  if (IsDeoptLoopSite(node)) return NoChange();
+
   ProcessedFeedback const& feedback =
       broker()->GetFeedbackForPropertyAccess(source, access_mode, static_name);
   switch (feedback.kind()) {
@@ -2057,6 +2076,24 @@ Reduction JSNativeContextSpecialization::ReducePropertyAccess(
   }
 }
 
+bool JSNativeContextSpecialization::IsDeoptLoopSite(Node* node) const {
+  if (deopt_loop_sites_.empty() ||
+      !OperatorProperties::HasFrameStateInput(node->op())) {
+    return false;
+  }
+  FrameState frame_state{NodeProperties::GetFrameStateInput(node)};
+  FrameStateInfo const& info = frame_state.frame_state_info();
+  Handle<SharedFunctionInfo> shared;
+  if (!info.shared_info().ToHandle(&shared)) return false;
+  for (const DeoptLoopSite& site : deopt_loop_sites_) {
+    if (site.bytecode_offset == info.bytecode_offset() &&
+        site.shared.equals(shared)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 Reduction JSNativeContextSpecialization::ReduceEagerDeoptimize(
     Node* node, DeoptimizeReason reason) {
   if (!(flags() & kBailoutOnUninitialized)) return NoChange();
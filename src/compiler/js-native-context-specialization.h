@@ -9,6 +9,7 @@
 #include "src/base/optional.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimize-reason.h"
 #include "src/objects/map.h"
 
@@ -50,10 +51,10 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   };
   using Flags = base::Flags<Flag>;
 
-  JSNativeContextSpecialization(Editor* editor, JSGraph* jsgraph,
-                                JSHeapBroker* broker, Flags flags,
-                                CompilationDependencies* dependencies,
-                                Zone* zone, Zone* shared_zone);
+  JSNativeContextSpecialization(
+      Editor* editor, JSGraph* jsgraph, JSHeapBroker* broker, Flags flags,
+      CompilationDependencies* dependencies, Zone* zone, Zone* shared_zone,
+      const std::vector<DeoptLoopSite>& deopt_loop_sites);
   JSNativeContextSpecialization(const JSNativeContextSpecialization&) = delete;
   JSNativeContextSpecialization& operator=(
       const JSNativeContextSpecialization&) = delete;
@@ -236,6 +237,10 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
 
   Node* BuildLoadPrototypeFromObject(Node* object, Node* effect, Node* control);
 
+  // Whether the property access {node} repeatedly deoptimized in earlier
+  // optimized code, in which case it is left to generic lowering.
+  bool IsDeoptLoopSite(Node* node) const;
+
   Graph* graph() const;
   JSGraph* jsgraph() const { return jsgraph_; }
 
@@ -264,6 +269,7 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   Zone* const zone_;
   Zone* const shared_zone_;
   TypeCache const* type_cache_;
+  const std::vector<DeoptLoopSite>& deopt_loop_sites_;
 };
 
 DEFINE_OPERATORS_FOR_FLAGS(JSNativeContextSpecialization::Flags)
@@ -303,6 +303,29 @@ std::ostream& operator<<(std::ostream& os, TruncateKind kind) {
   V(Uint64LessThan, Operator::kNoProperties, 2, 0, 1)                    \
   V(Uint64LessThanOrEqual, Operator::kNoProperties, 2, 0, 1)
 
+// The format is:
+// V(Name, properties, value_input_count, control_input_count, output_count)
+#define MACHINE_SIMD256_PURE_OP_LIST(V)                                \
+  V(F64x4Add, Operator::kCommutative, 2, 0, 1)                         \
+  V(F32x8Add, Operator::kCommutative, 2, 0, 1)                         \
+  V(I64x4Add, Operator::kCommutative, 2, 0, 1)                         \
+  V(I32x8Add, Operator::kCommutative, 2, 0, 1)                         \
+  V(I16x16Add, Operator::kCommutative, 2, 0, 1)                        \
+  V(I8x32Add, Operator::kCommutative, 2, 0, 1)                         \
+  V(F64x4Sub, Operator::kNoProperties, 2, 0, 1)                        \
+  V(F32x8Sub, Operator::kNoProperties, 2, 0, 1)                        \
+  V(I64x4Sub, Operator::kNoProperties, 2, 0, 1)                        \
+  V(I32x8Sub, Operator::kNoProperties, 2, 0, 1)                        \
+  V(I16x16Sub, Operator::kNoProperties, 2, 0, 1)                       \
+  V(I8x32Sub, Operator::kNoProperties, 2, 0, 1)                        \
+  V(F64x4Mul, Operator::kCommutative, 2, 0, 1)                         \
+  V(F32x8Mul, Operator::kCommutative, 2, 0, 1)                         \
+  V(I32x8Mul, Operator::kCommutative, 2, 0, 1)                         \
+  V(I16x16Mul, Operator::kCommutative, 2, 0, 1)                        \
+  V(S256And, Operator::kAssociative | Operator::kCommutative, 2, 0, 1) \
+  V(S256Or, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)  \
+  V(S256Xor, Operator::kAssociative | Operator::kCommutative, 2, 0, 1)
+
 // The format is:
 // V(Name, properties, value_input_count, control_input_count, output_count)
 #define MACHINE_PURE_OP_LIST(V)                                            \
@@ -607,7 +630,8 @@ std::ostream& operator<<(std::ostream& os, TruncateKind kind) {
   V(I32x4RelaxedTruncF32x4S, Operator::kNoProperties, 1, 0, 1)             \
   V(I32x4RelaxedTruncF32x4U, Operator::kNoProperties, 1, 0, 1)             \
   V(I32x4RelaxedTruncF64x2SZero, Operator::kNoProperties, 1, 0, 1)         \
-  V(I32x4RelaxedTruncF64x2UZero, Operator::kNoProperties, 1, 0, 1)
+  V(I32x4RelaxedTruncF64x2UZero, Operator::kNoProperties, 1, 0, 1)         \
+  MACHINE_SIMD256_PURE_OP_LIST(V)
 
 // The format is:
 // V(Name, properties, value_input_count, control_input_count, output_count)
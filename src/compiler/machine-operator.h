@@ -926,6 +926,27 @@ class V8_EXPORT_PRIVATE MachineOperatorBuilder final
   const Operator* I32x4RelaxedTruncF64x2SZero();
   const Operator* I32x4RelaxedTruncF64x2UZero();
 
+  // 256-bit SIMD operators, created by the revectorizer on x64 only.
+  const Operator* F64x4Add();
+  const Operator* F32x8Add();
+  const Operator* I64x4Add();
+  const Operator* I32x8Add();
+  const Operator* I16x16Add();
+  const Operator* I8x32Add();
+  const Operator* F64x4Sub();
+  const Operator* F32x8Sub();
+  const Operator* I64x4Sub();
+  const Operator* I32x8Sub();
+  const Operator* I16x16Sub();
+  const Operator* I8x32Sub();
+  const Operator* F64x4Mul();
+  const Operator* F32x8Mul();
+  const Operator* I32x8Mul();
+  const Operator* I16x16Mul();
+  const Operator* S256And();
+  const Operator* S256Or();
+  const Operator* S256Xor();
+
   // load [base + index]
   const Operator* Load(LoadRepresentation rep);
   const Operator* LoadImmutable(LoadRepresentation rep);
@@ -1002,11 +1002,35 @@
   V(LoadLane)                    \
   V(StoreLane)
 
-#define VALUE_OP_LIST(V)  \
-  COMMON_OP_LIST(V)       \
-  SIMPLIFIED_OP_LIST(V)   \
-  MACHINE_OP_LIST(V)      \
-  MACHINE_SIMD_OP_LIST(V) \
+// 256-bit SIMD operations. They are not part of Wasm and are only created by
+// the revectorizer on x64.
+#define MACHINE_SIMD256_OP_LIST(V) \
+  V(F64x4Add)                      \
+  V(F32x8Add)                      \
+  V(I64x4Add)                      \
+  V(I32x8Add)                      \
+  V(I16x16Add)                     \
+  V(I8x32Add)                      \
+  V(F64x4Sub)                      \
+  V(F32x8Sub)                      \
+  V(I64x4Sub)                      \
+  V(I32x8Sub)                      \
+  V(I16x16Sub)                     \
+  V(I8x32Sub)                      \
+  V(F64x4Mul)                      \
+  V(F32x8Mul)                      \
+  V(I32x8Mul)                      \
+  V(I16x16Mul)                     \
+  V(S256And)                       \
+  V(S256Or)                        \
+  V(S256Xor)
+
+#define VALUE_OP_LIST(V)     \
+  COMMON_OP_LIST(V)          \
+  SIMPLIFIED_OP_LIST(V)      \
+  MACHINE_OP_LIST(V)         \
+  MACHINE_SIMD_OP_LIST(V)    \
+  MACHINE_SIMD256_OP_LIST(V) \
   JS_OP_LIST(V)
 
 // The combination of all operators at all levels and the common operators.
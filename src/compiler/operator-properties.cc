@@ -126,6 +126,7 @@ bool OperatorProperties::NeedsExactContext(const Operator* op) {
       CONTROL_OP_LIST(CASE)
       MACHINE_OP_LIST(CASE)
       MACHINE_SIMD_OP_LIST(CASE)
+      MACHINE_SIMD256_OP_LIST(CASE)
       SIMPLIFIED_OP_LIST(CASE)
       break;
 #undef CASE
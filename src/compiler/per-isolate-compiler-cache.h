@@ -20,10 +20,11 @@ namespace compiler {
 class ObjectData;
 
 // This class serves as a container of data that should persist across all
-// (optimizing) compiler runs in an isolate. For now it stores serialized data
-// for various common objects such as builtins, so that these objects don't have
-// to be serialized in each compilation job. See JSHeapBroker::InitializeRefsMap
-// for details.
+// (optimizing) compiler runs in an isolate. For now it stores the broker data
+// of read-only heap objects, which is immutable and thus can be shared by
+// concurrent jobs without dependencies, so that these objects don't have to be
+// serialized in each compilation job. See JSHeapBroker::InitializeRefsMap for
+// details.
 class PerIsolateCompilerCache : public ZoneObject {
  public:
   explicit PerIsolateCompilerCache(Zone* zone)
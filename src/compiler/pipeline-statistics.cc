@@ -89,6 +89,25 @@ void PipelineStatistics::EndPhaseKind() {
                    TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
+void PipelineStatistics::RecordRegisterAllocator(const char* allocator,
+                                                 const char* reason) {
+  compilation_stats_->RecordRegisterAllocator(allocator, reason);
+  TRACE_EVENT_INSTANT2(kTraceCategory, "RegisterAllocator",
+                       TRACE_EVENT_SCOPE_THREAD, "allocator", allocator,
+                       "reason", reason);
+}
+
+void PipelineStatistics::RecordSkippedPhase(const char* phase_name) {
+  compilation_stats_->RecordSkippedPhase(phase_name);
+  TRACE_EVENT_INSTANT1(kTraceCategory, "SkippedPhase",
+                       TRACE_EVENT_SCOPE_THREAD, "phase", phase_name);
+}
+
+void PipelineStatistics::RecordGraphSize(size_t node_count,
+                                         size_t graph_zone_bytes) {
+  compilation_stats_->RecordGraphSize(node_count, graph_zone_bytes);
+}
+
 void PipelineStatistics::BeginPhase(const char* phase_name) {
   TRACE_EVENT_BEGIN1(kTraceCategory, phase_name, "kind",
                      CodeKindToString(code_kind_));
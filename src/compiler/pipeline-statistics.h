@@ -31,6 +31,14 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  // Records which register allocator was chosen for the function, and why.
+  void RecordRegisterAllocator(const char* allocator, const char* reason);
+  // Records that the phase {phase_name} was skipped to stay within the compile
+  // budget.
+  void RecordSkippedPhase(const char* phase_name);
+  // Records the size of the graph before it is scheduled.
+  void RecordGraphSize(size_t node_count, size_t graph_zone_bytes);
+
   // We log detailed phase information about the pipeline
   // in both the v8.turbofan and the v8.wasm.turbofan categories.
   static constexpr char kTraceCategory[] =
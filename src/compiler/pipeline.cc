@@ -74,20 +74,27 @@
 #include "src/compiler/simplified-lowering.h"
 #include "src/compiler/simplified-operator-reducer.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/compiler/slp-vectorizer.h"
 #include "src/compiler/store-store-elimination.h"
 #include "src/compiler/turboshaft/assembler.h"
 #include "src/compiler/turboshaft/graph-builder.h"
 #include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/load-elimination-reducer.h"
+#include "src/compiler/turboshaft/optimization-phase.h"
 #include "src/compiler/turboshaft/recreate-schedule.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
 #include "src/compiler/type-narrowing-reducer.h"
 #include "src/compiler/typed-optimization.h"
 #include "src/compiler/typer.h"
 #include "src/compiler/value-numbering-reducer.h"
 #include "src/compiler/verifier.h"
 #include "src/compiler/zone-stats.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/diagnostics/disassembler.h"
 #include "src/execution/isolate-inl.h"
+#include "src/execution/tiering-profile.h"
+#include "src/handles/local-handles-inl.h"
 #include "src/heap/local-heap.h"
 #include "src/init/bootstrapper.h"
 #include "src/logging/code-events.h"
@@ -105,6 +112,7 @@
 #include "src/compiler/wasm-escape-analysis.h"
 #include "src/compiler/wasm-inlining.h"
 #include "src/compiler/wasm-loop-peeling.h"
+#include "src/compiler/wasm-revectorizer.h"
 #include "src/wasm/function-body-decoder.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/wasm-engine.h"
@@ -608,6 +616,12 @@ class PipelineData {
     has_js_wasm_calls_ = has_js_wasm_calls;
   }
 
+  // Measures the time spent executing the job, against which the compile
+  // budget is checked. Not started for jobs that have no budget.
+  base::ElapsedTimer* compile_budget_timer() { return &compile_budget_timer_; }
+  bool is_degraded_compile() const { return is_degraded_compile_; }
+  void set_degraded_compile() { is_degraded_compile_ = true; }
+
  private:
   Isolate* const isolate_;
 #if V8_ENABLE_WEBASSEMBLY
@@ -622,6 +636,8 @@ class PipelineData {
   PipelineStatistics* pipeline_statistics_ = nullptr;
   bool compilation_failed_ = false;
   bool verify_graph_ = false;
+  base::ElapsedTimer compile_budget_timer_;
+  bool is_degraded_compile_ = false;
   int start_source_position_ = kNoSourcePosition;
   base::Optional<OsrHelper> osr_helper_;
   MaybeHandle<Code> code_;
@@ -714,14 +730,23 @@ class PipelineImpl final {
   // Step C. Run the code assembly pass.
   void AssembleCode(Linkage* linkage);
 
-  // Step D. Run the code finalization pass.
+  // Step D. Run the code finalization pass. If the code was already built by
+  // BuildCodeOnBackground, this only does the main-thread bookkeeping.
   MaybeHandle<Code> FinalizeCode(bool retire_broker = true);
 
+  // Optional step C.1. Builds the code object on the background thread of
+  // {local_isolate}, if the generated code allows it. Returns false if the
+  // allocation failed.
+  bool BuildCodeOnBackground(LocalIsolate* local_isolate);
+
   // Step E. Install any code dependencies.
   bool CommitDependencies(Handle<Code> code);
 
   void VerifyGeneratedCodeIsIdempotent();
   void RunPrintAndVerify(const char* phase, bool untyped = false);
+  // Whether the optional phase {phase_name} fits into the compile budget. If
+  // not, records that the phase is skipped.
+  bool CanAffordOptionalPhase(const char* phase_name);
   bool SelectInstructionsAndAssemble(CallDescriptor* call_descriptor);
   MaybeHandle<Code> GenerateCode(CallDescriptor* call_descriptor);
   void AllocateRegistersForTopTier(const RegisterConfiguration* config,
@@ -1177,10 +1202,24 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   }
   if (FLAG_turbo_inlining) {
     compilation_info()->set_inlining();
+    // Resolve the profiled inlinees here, since it requires iterating the
+    // scripts of the isolate.
+    if (const TieringProfile* profile = TieringProfile::Input()) {
+      compilation_info()->set_profiled_inlinees(profile->FindInlinedFunctions(
+          isolate, *compilation_info()->shared_info()));
+    }
   }
   if (FLAG_turbo_allocation_folding) {
     compilation_info()->set_allocation_folding();
   }
+  if (isolate->deopt_history()->HasDeoptLoopSites()) {
+    compilation_info()->set_deopt_loop_sites(
+        isolate->deopt_history()->FindDeoptLoopSites(isolate));
+  }
+  if (compilation_info()->closure()->has_feedback_vector()) {
+    compilation_info()->set_profiler_ticks(
+        compilation_info()->closure()->feedback_vector().profiler_ticks());
+  }
 
   // Determine whether to specialize the code for the function's context.
   // We can't do this in the case of OSR, because we want to cache the
@@ -1226,6 +1265,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
   PipelineJobScope scope(&data_, stats);
   LocalIsolateScope local_isolate_scope(data_.broker(), data_.info(),
                                         local_isolate);
+  if (FLAG_turbo_compile_budget_ms > 0) data_.compile_budget_timer()->Start();
 
   if (!pipeline_.CreateGraph()) {
     return AbortOptimization(BailoutReason::kGraphBuildingFailed);
@@ -1236,6 +1276,12 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
 
   pipeline_.AssembleCode(linkage_);
 
+  if (FLAG_concurrent_turbofan_finalization &&
+      !local_isolate->is_main_thread() &&
+      !pipeline_.BuildCodeOnBackground(local_isolate)) {
+    return AbortOptimization(BailoutReason::kCodeGenerationFailed);
+  }
+
   return SUCCEEDED;
 }
 
@@ -1266,6 +1312,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
     context->AddOptimizedCode(ToCodeT(*code));
   }
   RegisterWeakObjectsInOptimizedCode(isolate, context, code);
+  TieringProfile::RecordOptimizedCode(compilation_info());
   return SUCCEEDED;
 }
 
@@ -1386,7 +1433,8 @@ struct InliningPhase {
     // that need to live until code generation.
     JSNativeContextSpecialization native_context_specialization(
         &graph_reducer, data->jsgraph(), data->broker(), flags,
-        data->dependencies(), temp_zone, info->zone());
+        data->dependencies(), temp_zone, info->zone(),
+        data->info()->deopt_loop_sites());
     JSInliningHeuristic inlining(
         &graph_reducer, temp_zone, data->info(), data->jsgraph(),
         data->broker(), data->source_positions(), JSInliningHeuristic::kJSOnly);
@@ -1988,6 +2036,15 @@ struct WasmBaseOptimizationPhase {
   }
 };
 
+struct SLPVectorizationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(SLPVectorization)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    SLPVectorizer vectorizer(temp_zone, data->graph(), data->machine());
+    vectorizer.Reduce();
+  }
+};
+
 struct DecompressionOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(DecompressionOptimization)
 
@@ -2020,6 +2077,17 @@ struct BuildTurboshaftPhase {
   }
 };
 
+struct OptimizeTurboshaftPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(OptimizeTurboshaft)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    turboshaft::OptimizationPhase<turboshaft::ReducingAssembler<
+        turboshaft::ValueNumberingReducer,
+        turboshaft::LoadEliminationReducer>>::Run(&data->turboshaft_graph(),
+                                                  temp_zone);
+  }
+};
+
 struct TurboshaftRecreateSchedulePhase {
   DECL_PIPELINE_PHASE_CONSTANTS(TurboshaftRecreateSchedule)
 
@@ -2091,6 +2159,16 @@ struct WasmOptimizationPhase {
     }
   }
 };
+
+struct WasmRevectorizePhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(WasmRevectorize)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    WasmRevectorizer revectorizer(temp_zone, data->mcgraph(),
+                                  data->source_positions());
+    revectorizer.Run();
+  }
+};
 #endif  // V8_ENABLE_WEBASSEMBLY
 
 struct CsaEarlyOptimizationPhase {
@@ -2221,7 +2299,8 @@ std::ostream& operator<<(std::ostream& out, const InstructionRangesAsJSON& s) {
 struct InstructionSelectionPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(SelectInstructions)
 
-  void Run(PipelineData* data, Zone* temp_zone, Linkage* linkage) {
+  void Run(PipelineData* data, Zone* temp_zone, Linkage* linkage,
+           bool enable_scheduling) {
     InstructionSelector selector(
         temp_zone, data->graph()->NodeCount(), linkage, data->sequence(),
         data->schedule(), data->source_positions(), data->frame(),
@@ -2235,9 +2314,8 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
-            ? InstructionSelector::kEnableScheduling
-            : InstructionSelector::kDisableScheduling,
+        enable_scheduling ? InstructionSelector::kEnableScheduling
+                          : InstructionSelector::kDisableScheduling,
         data->assembler_options().enable_root_relative_access
             ? InstructionSelector::kEnableRootsRelativeAddressing
             : InstructionSelector::kDisableRootsRelativeAddressing,
@@ -2247,6 +2325,15 @@ struct InstructionSelectionPhase {
     if (!selector.SelectInstructions()) {
       data->set_compilation_failed();
     }
+    if (FLAG_trace_turbo_instruction_scheduling &&
+        selector.scheduler() != nullptr) {
+      const InstructionScheduler* scheduler = selector.scheduler();
+      CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+      tracing_scope.stream()
+          << "Instruction scheduling of " << data->info()->GetDebugName().get()
+          << ": " << scheduler->original_cycles() << " -> "
+          << scheduler->scheduled_cycles() << " estimated cycles" << std::endl;
+    }
     if (data->info()->trace_turbo_json()) {
       TurboJsonFile json_of(data->info(), std::ios_base::app);
       json_of << "{\"name\":\"" << phase_name()
@@ -2457,6 +2544,20 @@ struct AssembleCodePhase {
   }
 };
 
+struct BackgroundFinalizeCodePhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(BackgroundFinalizeCode)
+
+  void Run(PipelineData* data, Zone* temp_zone, LocalIsolate* local_isolate) {
+    Handle<Code> code;
+    if (!data->code_generator()->BuildCode(local_isolate).ToHandle(&code)) {
+      return;
+    }
+    // Keep the code alive beyond the local handle scope until the job is
+    // finalized on the main thread.
+    data->set_code(data->broker()->CanonicalPersistentHandle(code));
+  }
+};
+
 struct FinalizeCodePhase {
   DECL_MAIN_THREAD_PIPELINE_PHASE_CONSTANTS(FinalizeCode)
 
@@ -2667,6 +2768,33 @@ void PipelineImpl::RunPrintAndVerify(const char* phase, bool untyped) {
   }
 }
 
+bool PipelineImpl::CanAffordOptionalPhase(const char* phase_name) {
+  PipelineData* data = this->data_;
+  base::ElapsedTimer* timer = data->compile_budget_timer();
+  if (!timer->IsStarted()) return true;
+  base::TimeDelta elapsed = timer->Elapsed();
+  if (elapsed.InMilliseconds() < FLAG_turbo_compile_budget_ms) return true;
+
+  Counters* counters = data->isolate()->counters();
+  if (!data->is_degraded_compile()) {
+    data->set_degraded_compile();
+    counters->turbofan_degraded_compiles()->Increment();
+  }
+  counters->turbofan_budget_skipped_phases()->Increment();
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordSkippedPhase(phase_name);
+  }
+  if (FLAG_trace_turbo_compile_budget) {
+    CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+    tracing_scope.stream() << "Skipping " << phase_name << " for "
+                           << info()->GetDebugName().get() << " after "
+                           << elapsed.InMillisecondsF() << " ms (budget "
+                           << FLAG_turbo_compile_budget_ms << " ms)"
+                           << std::endl;
+  }
+  return false;
+}
+
 void PipelineImpl::InitializeHeapBroker() {
   PipelineData* data = data_;
 
@@ -2745,7 +2873,8 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
-  if (data->info()->loop_peeling()) {
+  if (data->info()->loop_peeling() &&
+      CanAffordOptionalPhase(LoopPeelingPhase::phase_name())) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
   } else {
@@ -2816,7 +2945,8 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<EffectControlLinearizationPhase>();
   RunPrintAndVerify(EffectControlLinearizationPhase::phase_name(), true);
 
-  if (FLAG_turbo_store_elimination) {
+  if (FLAG_turbo_store_elimination &&
+      CanAffordOptionalPhase(StoreStoreEliminationPhase::phase_name())) {
     Run<StoreStoreEliminationPhase>();
     RunPrintAndVerify(StoreStoreEliminationPhase::phase_name(), true);
   }
@@ -2840,6 +2970,13 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<MachineOperatorOptimizationPhase>();
   RunPrintAndVerify(MachineOperatorOptimizationPhase::phase_name(), true);
 
+#if V8_TARGET_ARCH_X64
+  if (FLAG_turbo_slp_vectorize) {
+    Run<SLPVectorizationPhase>();
+    RunPrintAndVerify(SLPVectorizationPhase::phase_name(), true);
+  }
+#endif  // V8_TARGET_ARCH_X64
+
   Run<DecompressionOptimizationPhase>();
   RunPrintAndVerify(DecompressionOptimizationPhase::phase_name(), true);
 
@@ -2864,6 +3001,16 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
           << data->turboshaft_graph();
     }
 
+    Run<OptimizeTurboshaftPhase>();
+    if (data->info()->trace_turbo_graph()) {
+      UnparkedScopeIfNeeded scope(data->broker());
+      AllowHandleDereference allow_deref;
+      CodeTracer::StreamScope tracing_scope(data->GetCodeTracer());
+      tracing_scope.stream()
+          << "\n-- Optimized TurboShaft Graph ------------------\n"
+          << data->turboshaft_graph();
+    }
+
     Run<TurboshaftRecreateSchedulePhase>(linkage);
     if (data->info()->trace_turbo_graph() || FLAG_trace_turbo_scheduler) {
       UnparkedScopeIfNeeded scope(data->broker());
@@ -3234,6 +3381,14 @@ void Pipeline::GenerateCodeForWasmFunction(
     pipeline.RunPrintAndVerify(WasmBaseOptimizationPhase::phase_name(), true);
   }
 
+#if V8_TARGET_ARCH_X64
+  // The 256-bit operations are only supported by the x64 backend with AVX2.
+  if (FLAG_wasm_revectorize && CpuFeatures::IsSupported(AVX2)) {
+    pipeline.Run<WasmRevectorizePhase>();
+    pipeline.RunPrintAndVerify(WasmRevectorizePhase::phase_name(), true);
+  }
+#endif  // V8_TARGET_ARCH_X64
+
   pipeline.Run<MemoryOptimizationPhase>();
   pipeline.RunPrintAndVerify(MemoryOptimizationPhase::phase_name(), true);
 
@@ -3444,10 +3599,55 @@ void PipelineImpl::ComputeScheduledGraph() {
   // We should only schedule the graph if it is not scheduled yet.
   DCHECK_NULL(data->schedule());
 
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordGraphSize(
+        data->graph()->NodeCount(), data->graph_zone()->allocation_size());
+  }
   Run<ComputeSchedulePhase>();
   TraceScheduleAndVerify(data->info(), data, data->schedule(), "schedule");
 }
 
+namespace {
+
+// Returns why the mid-tier register allocator should be used for the code in
+// {data}, or nullptr if the top-tier register allocator should be used.
+const char* MidTierRegisterAllocatorReason(PipelineData* data) {
+  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
+  // WebAssembly programs, and chosing the limit such that functions that take
+  // >100ms in register allocation are switched to mid-tier.
+  static const int kTopTierVirtualRegistersLimit = 8192;
+
+  OptimizedCompilationInfo* info = data->info();
+  if (CodeKindIsStaticallyCompiled(info->code_kind())) return nullptr;
+  if (FLAG_turbo_force_mid_tier_regalloc) return "forced";
+  if (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
+      data->sequence()->VirtualRegisterCount() >
+          kTopTierVirtualRegistersLimit) {
+    return "virtual registers";
+  }
+  if (info->code_kind() != CodeKind::TURBOFAN) return nullptr;
+  // Large JS functions spend a disproportionate share of their compile time
+  // in the top-tier allocator, which scales worse than linearly with the
+  // number of instructions.
+  if (FLAG_turbo_mid_tier_regalloc_instruction_threshold > 0 &&
+      data->sequence()->instructions().size() >
+          static_cast<size_t>(
+              FLAG_turbo_mid_tier_regalloc_instruction_threshold)) {
+    return "instructions";
+  }
+  // Functions that were optimized after few profiler ticks are not known to
+  // be hot, so better code is less likely to pay for the slower allocator.
+  // OSR code is only requested for long-running loops, so it is never cold.
+  if (FLAG_turbo_mid_tier_regalloc_cold_ticks > 0 && !info->is_osr() &&
+      info->profiler_ticks() >= 0 &&
+      info->profiler_ticks() < FLAG_turbo_mid_tier_regalloc_cold_ticks) {
+    return "cold";
+  }
+  return nullptr;
+}
+
+}  // namespace
+
 bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   auto call_descriptor = linkage->GetIncomingDescriptor();
   PipelineData* data = this->data_;
@@ -3509,7 +3709,10 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     data->InitializeFrameData(call_descriptor);
   }
   // Select and schedule instructions covering the scheduled graph.
-  Run<InstructionSelectionPhase>(linkage);
+  bool enable_scheduling =
+      FLAG_turbo_instruction_scheduling &&
+      CanAffordOptionalPhase("V8.TFInstructionScheduling");
+  Run<InstructionSelectionPhase>(linkage, enable_scheduling);
   if (data->compilation_failed()) {
     info()->AbortOptimization(BailoutReason::kCodeGenerationFailed);
     data->EndPhaseKind();
@@ -3545,19 +3748,10 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   // Allocate registers.
 
-  // This limit is chosen somewhat arbitrarily, by looking at a few bigger
-  // WebAssembly programs, and chosing the limit such that functions that take
-  // >100ms in register allocation are switched to mid-tier.
-  static int kTopTierVirtualRegistersLimit = 8192;
-
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
-  bool use_mid_tier_register_allocator =
-      !CodeKindIsStaticallyCompiled(data->info()->code_kind()) &&
-      (FLAG_turbo_force_mid_tier_regalloc ||
-       (FLAG_turbo_use_mid_tier_regalloc_for_huge_functions &&
-        data->sequence()->VirtualRegisterCount() >
-            kTopTierVirtualRegistersLimit));
+  const char* mid_tier_reason = MidTierRegisterAllocatorReason(data);
+  bool use_mid_tier_register_allocator = mid_tier_reason != nullptr;
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
@@ -3567,6 +3761,11 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     config = restricted_config.get();
     use_mid_tier_register_allocator = false;
   }
+  if (data->pipeline_statistics() != nullptr) {
+    data->pipeline_statistics()->RecordRegisterAllocator(
+        use_mid_tier_register_allocator ? "mid-tier" : "top-tier",
+        use_mid_tier_register_allocator ? mid_tier_reason : "default");
+  }
   if (use_mid_tier_register_allocator) {
     AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
   } else {
@@ -3682,18 +3881,29 @@ void PipelineImpl::AssembleCode(Linkage* linkage) {
   data->EndPhaseKind();
 }
 
+bool PipelineImpl::BuildCodeOnBackground(LocalIsolate* local_isolate) {
+  PipelineData* data = this->data_;
+  if (!data->code_generator()->CanFinalizeCodeConcurrently()) return true;
+
+  UnparkedScopeIfNeeded unparked_scope(data->broker());
+  LocalHandleScope handle_scope(local_isolate);
+  Run<BackgroundFinalizeCodePhase>(local_isolate);
+  return !data->code().is_null();
+}
+
 MaybeHandle<Code> PipelineImpl::FinalizeCode(bool retire_broker) {
   PipelineData* data = this->data_;
   data->BeginPhaseKind("V8.TFFinalizeCode");
   if (data->broker() && retire_broker) {
     data->broker()->Retire();
   }
-  Run<FinalizeCodePhase>();
-
-  MaybeHandle<Code> maybe_code = data->code();
   Handle<Code> code;
-  if (!maybe_code.ToHandle(&code)) {
-    return maybe_code;
+  if (data->code().ToHandle(&code)) {
+    // Built by BuildCodeOnBackground; only the logging is left to do.
+    data->code_generator()->LogCodeLinePosInfo(code);
+  } else {
+    Run<FinalizeCodePhase>();
+    if (!data->code().ToHandle(&code)) return MaybeHandle<Code>();
   }
 
   info()->SetCode(code);
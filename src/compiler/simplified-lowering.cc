@@ -1884,6 +1884,10 @@ class RepresentationSelector {
       case CTypeInfo::SequenceType::kScalar: {
         switch (type.GetType()) {
           case CTypeInfo::Type::kVoid:
+          case CTypeInfo::Type::kInt8:
+          case CTypeInfo::Type::kUint8:
+          case CTypeInfo::Type::kInt16:
+          case CTypeInfo::Type::kUint16:
             UNREACHABLE();
           case CTypeInfo::Type::kBool:
             return UseInfo::Bool();
@@ -1901,12 +1905,15 @@ class RepresentationSelector {
           case CTypeInfo::Type::kFloat64:
             return UseInfo::CheckedNumberAsFloat64(kDistinguishZeros, feedback);
           case CTypeInfo::Type::kV8Value:
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
       }
       case CTypeInfo::SequenceType::kIsSequence: {
-        CHECK_EQ(type.GetType(), CTypeInfo::Type::kVoid);
+        CHECK(type.GetType() == CTypeInfo::Type::kVoid ||
+              type.GetType() == CTypeInfo::Type::kFloat64);
         return UseInfo::AnyTagged();
       }
       case CTypeInfo::SequenceType::kIsTypedArray: {
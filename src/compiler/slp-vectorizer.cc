@@ -0,0 +1,231 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/slp-vectorizer.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/opcodes.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+constexpr int64_t kLaneSize = kDoubleSize;
+
+bool IsFloat64Load(Node* node) {
+  return node->opcode() == IrOpcode::kLoad &&
+         LoadRepresentationOf(node->op()) == MachineType::Float64();
+}
+
+bool IsFloat64Store(Node* node) {
+  if (node->opcode() != IrOpcode::kStore) return false;
+  StoreRepresentation rep = StoreRepresentationOf(node->op());
+  return rep.representation() == MachineRepresentation::kFloat64 &&
+         rep.write_barrier_kind() == kNoWriteBarrier;
+}
+
+const Operator* VectorOperatorFor(MachineOperatorBuilder* machine,
+                                  IrOpcode::Value opcode) {
+  switch (opcode) {
+    case IrOpcode::kFloat64Add:
+      return machine->F64x2Add();
+    case IrOpcode::kFloat64Sub:
+      return machine->F64x2Sub();
+    case IrOpcode::kFloat64Mul:
+      return machine->F64x2Mul();
+    case IrOpcode::kFloat64Div:
+      return machine->F64x2Div();
+    default:
+      return nullptr;
+  }
+}
+
+// Splits the index of a Load or Store into a root node and a constant offset,
+// where a constant index has no root node. The pass only runs on 64-bit
+// targets.
+void DecomposeIndex(Node* index, Node** root, int64_t* offset) {
+  Int64Matcher constant(index);
+  if (constant.HasResolvedValue()) {
+    *root = nullptr;
+    *offset = constant.ResolvedValue();
+    return;
+  }
+  if (index->opcode() == IrOpcode::kInt64Add) {
+    Int64BinopMatcher m(index);
+    if (m.right().HasResolvedValue()) {
+      *root = m.left().node();
+      *offset = m.right().ResolvedValue();
+      return;
+    }
+  }
+  *root = index;
+  *offset = 0;
+}
+
+// Whether {hi} accesses the memory right after the memory accessed by {lo}.
+bool AreConsecutive(Node* lo, Node* hi) {
+  if (lo->InputAt(0) != hi->InputAt(0)) return false;
+  Node* lo_root;
+  Node* hi_root;
+  int64_t lo_offset, hi_offset;
+  DecomposeIndex(lo->InputAt(1), &lo_root, &lo_offset);
+  DecomposeIndex(hi->InputAt(1), &hi_root, &hi_offset);
+  return lo_root == hi_root && hi_offset - lo_offset == kLaneSize;
+}
+
+// Returns the only effect use of {node} if it has the same control input,
+// or nullptr otherwise.
+Node* NextEffect(Node* node) {
+  Node* next = nullptr;
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsEffectEdge(edge)) continue;
+    if (next != nullptr) return nullptr;
+    next = edge.from();
+  }
+  if (next == nullptr || next->op()->ControlInputCount() == 0 ||
+      NodeProperties::GetControlInput(next) !=
+          NodeProperties::GetControlInput(node)) {
+    return nullptr;
+  }
+  return next;
+}
+
+// Whether {second} directly follows {first} on the effect chain.
+bool IsNextEffect(Node* first, Node* second) {
+  return NextEffect(first) == second;
+}
+
+// Whether {user} is the only value use of {node}.
+bool HasOnlyValueUse(Node* node, Node* user) {
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsValueEdge(edge) && edge.from() != user) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+SLPVectorizer::SLPVectorizer(Zone* zone, Graph* graph,
+                             MachineOperatorBuilder* machine)
+    : zone_(zone),
+      graph_(graph),
+      machine_(machine),
+      candidate_loads_(zone),
+      replaced_nodes_(zone) {}
+
+void SLPVectorizer::Reduce() {
+  AllNodes all(zone_, graph());
+  ZoneVector<Node*> chain_starts(zone_);
+  for (Node* node : all.reachable) {
+    if (!IsFloat64Store(node)) continue;
+    Node* previous = NodeProperties::GetEffectInput(node);
+    if (IsFloat64Store(previous) && IsNextEffect(previous, node)) continue;
+    chain_starts.push_back(node);
+  }
+
+  // Pair up the stores of each chain of adjacent Float64 stores greedily, in
+  // effect order.
+  for (Node* current : chain_starts) {
+    while (current != nullptr && IsFloat64Store(current)) {
+      Node* next = NextEffect(current);
+      if (next == nullptr || !IsFloat64Store(next)) break;
+      Node* packed = TryPackStores(current, next);
+      current = packed != nullptr ? NextEffect(packed) : next;
+    }
+  }
+}
+
+Node* SLPVectorizer::TryPackStores(Node* first, Node* second) {
+  Node* lo;
+  Node* hi;
+  if (AreConsecutive(first, second)) {
+    lo = first;
+    hi = second;
+  } else if (AreConsecutive(second, first)) {
+    lo = second;
+    hi = first;
+  } else {
+    return nullptr;
+  }
+
+  candidate_loads_.clear();
+  if (!CanPack(lo->InputAt(2), hi->InputAt(2), lo, hi, 0)) return nullptr;
+
+  replaced_nodes_.clear();
+  replaced_nodes_.push_back(second);
+  replaced_nodes_.push_back(first);
+  Node* value = Pack(lo->InputAt(2), hi->InputAt(2));
+  Node* store = graph()->NewNode(
+      machine()->Store(StoreRepresentation(MachineRepresentation::kSimd128,
+                                           kNoWriteBarrier)),
+      lo->InputAt(0), lo->InputAt(1), value,
+      NodeProperties::GetEffectInput(first),
+      NodeProperties::GetControlInput(first));
+  ReplaceEffectUses(second, store);
+  // Detach the scalar nodes right away, so that they don't count as uses in
+  // later candidates.
+  for (Node* node : replaced_nodes_) node->NullAllInputs();
+  return store;
+}
+
+bool SLPVectorizer::CanPack(Node* lo, Node* hi, Node* lo_user, Node* hi_user,
+                            int depth) {
+  // The same scalar in both lanes is splatted.
+  if (lo == hi) return true;
+  if (IsFloat64Load(lo) && IsFloat64Load(hi)) {
+    if (!AreConsecutive(lo, hi)) return false;
+    if (!IsNextEffect(lo, hi) && !IsNextEffect(hi, lo)) return false;
+    if (!HasOnlyValueUse(lo, lo_user) || !HasOnlyValueUse(hi, hi_user)) {
+      return false;
+    }
+    return candidate_loads_.insert(lo).second &&
+           candidate_loads_.insert(hi).second;
+  }
+  if (depth == kMaxDepth || lo->opcode() != hi->opcode() ||
+      VectorOperatorFor(machine(), lo->opcode()) == nullptr) {
+    return false;
+  }
+  if (!HasOnlyValueUse(lo, lo_user) || !HasOnlyValueUse(hi, hi_user)) {
+    return false;
+  }
+  return CanPack(lo->InputAt(0), hi->InputAt(0), lo, hi, depth + 1) &&
+         CanPack(lo->InputAt(1), hi->InputAt(1), lo, hi, depth + 1);
+}
+
+Node* SLPVectorizer::Pack(Node* lo, Node* hi) {
+  if (lo == hi) return graph()->NewNode(machine()->F64x2Splat(), lo);
+  if (IsFloat64Load(lo)) {
+    Node* first = IsNextEffect(lo, hi) ? lo : hi;
+    Node* second = first == lo ? hi : lo;
+    Node* load = graph()->NewNode(machine()->Load(MachineType::Simd128()),
+                                  lo->InputAt(0), lo->InputAt(1),
+                                  NodeProperties::GetEffectInput(first),
+                                  NodeProperties::GetControlInput(first));
+    ReplaceEffectUses(second, load);
+    replaced_nodes_.push_back(second);
+    replaced_nodes_.push_back(first);
+    return load;
+  }
+  replaced_nodes_.push_back(lo);
+  replaced_nodes_.push_back(hi);
+  Node* left = Pack(lo->InputAt(0), hi->InputAt(0));
+  Node* right = Pack(lo->InputAt(1), hi->InputAt(1));
+  return graph()->NewNode(VectorOperatorFor(machine(), lo->opcode()), left,
+                          right);
+}
+
+void SLPVectorizer::ReplaceEffectUses(Node* node, Node* replacement) {
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(replacement);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
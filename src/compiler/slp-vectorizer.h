@@ -0,0 +1,70 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_SLP_VECTORIZER_H_
+#define V8_COMPILER_SLP_VECTORIZER_H_
+
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declare.
+class Graph;
+
+// Superword level parallelism: Packs pairs of isomorphic Float64 computations
+// on consecutive memory locations into Simd128 operations. For example, the
+// body of a kernel over Float64Arrays like
+//
+//     c[0] = a[0] * b[0];
+//     c[1] = a[1] * b[1];
+//
+// becomes one F64x2Mul whose inputs are loaded with one Simd128 load each and
+// whose result is written with one Simd128 store.
+//
+// The pass runs on the machine graph after memory optimization, so that
+// element accesses are plain Loads and Stores. Two accesses are only packed
+// if they are direct neighbours on the effect chain. Thus no deoptimization
+// point, call or other memory access is ever moved across, and bounds checks
+// and frame states stay exactly where they are: The packed load reads both
+// lanes where the first scalar load used to be, and the packed store writes
+// both lanes where the first scalar store used to be. Scalar values that are
+// used outside of the packed tree, e.g. by a frame state, block packing.
+class V8_EXPORT_PRIVATE SLPVectorizer final {
+ public:
+  SLPVectorizer(Zone* zone, Graph* graph, MachineOperatorBuilder* machine);
+  ~SLPVectorizer() = default;
+
+  void Reduce();
+
+ private:
+  // The maximum depth of the packed arithmetic trees below a pair of stores.
+  static constexpr int kMaxDepth = 4;
+
+  // Returns the packed store, or nullptr if the stores can't be packed.
+  Node* TryPackStores(Node* first, Node* second);
+  bool CanPack(Node* lo, Node* hi, Node* lo_user, Node* hi_user, int depth);
+  Node* Pack(Node* lo, Node* hi);
+  void ReplaceEffectUses(Node* node, Node* replacement);
+
+  Graph* graph() const { return graph_; }
+  MachineOperatorBuilder* machine() const { return machine_; }
+
+  Zone* const zone_;
+  Graph* const graph_;
+  MachineOperatorBuilder* const machine_;
+  // The loads of the candidate tree, to make sure every load is packed once.
+  ZoneSet<Node*> candidate_loads_;
+  // The scalar nodes that are replaced by the current packed tree.
+  ZoneVector<Node*> replaced_nodes_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_SLP_VECTORIZER_H_
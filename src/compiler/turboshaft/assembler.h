@@ -128,9 +128,16 @@ class AssemblerBase {
 #undef EMIT_OP
 };
 
-class Assembler
-    : public AssemblerInterface<Assembler, AssemblerBase<Assembler>> {
+// The assembler emitting operations into a graph. `Subclass` is the
+// most-derived class: reducers (see `ReducingAssembler`) derive from
+// `AssemblerT` and shadow `Emit` and `Bind`, so that every emitted operation
+// passes through all of them without virtual dispatch.
+template <class Subclass>
+class AssemblerT
+    : public AssemblerInterface<Subclass, AssemblerBase<Subclass>> {
  public:
+  using Base = AssemblerBase<Subclass>;
+
   Block* NewBlock(Block::Kind kind) { return graph_.NewBlock(kind); }
 
   V8_INLINE bool Bind(Block* block) {
@@ -172,7 +179,7 @@ class Assembler
     return Base::Switch(input, cases, default_case);
   }
 
-  explicit Assembler(Graph* graph, Zone* phase_zone)
+  explicit AssemblerT(Graph* graph, Zone* phase_zone)
       : graph_(*graph), phase_zone_(phase_zone) {
     graph_.Reset();
   }
@@ -182,28 +189,63 @@ class Assembler
   Graph& graph() { return graph_; }
   Zone* phase_zone() { return phase_zone_; }
 
- private:
-  friend class AssemblerBase<Assembler>;
-  void FinalizeBlock() {
-    graph().Finalize(current_block_);
-    current_block_ = nullptr;
-  }
-
+ protected:
   template <class Op, class... Args>
   OpIndex Emit(Args... args) {
     STATIC_ASSERT((std::is_base_of<Operation, Op>::value));
     STATIC_ASSERT(!(std::is_same<Op, Operation>::value));
     DCHECK_NOT_NULL(current_block_);
-    OpIndex result = graph().Add<Op>(args...);
+    OpIndex result = graph().template Add<Op>(args...);
     if (Op::properties.is_block_terminator) FinalizeBlock();
     return result;
   }
 
+ private:
+  friend class AssemblerBase<Subclass>;
+  void FinalizeBlock() {
+    graph().Finalize(current_block_);
+    current_block_ = nullptr;
+  }
+
   Block* current_block_ = nullptr;
   Graph& graph_;
   Zone* const phase_zone_;
 };
 
+class Assembler : public AssemblerT<Assembler> {
+ public:
+  using AssemblerT::AssemblerT;
+};
+
+template <class Subclass, template <class> class... Reducers>
+struct ReducerStack {
+  using type = AssemblerT<Subclass>;
+};
+template <class Subclass, template <class> class FirstReducer,
+          template <class> class... Reducers>
+struct ReducerStack<Subclass, FirstReducer, Reducers...> {
+  using type =
+      FirstReducer<typename ReducerStack<Subclass, Reducers...>::type>;
+};
+
+// An assembler that passes every operation through `Reducers`, from first to
+// last, before emitting it. A reducer is a class template `R<Next>` deriving
+// from `Next` that may shadow
+//   template <class Op, class... Args> OpIndex Emit(Args... args);
+//   bool Bind(Block* block);
+// and has to forward to `Next::Emit` and `Next::Bind`. It can return a
+// previously emitted operation instead of a new one; in that case it has to
+// remove the operation it got from `Next::Emit` with `Graph::RemoveLast`.
+template <template <class> class... Reducers>
+class ReducingAssembler
+    : public ReducerStack<ReducingAssembler<Reducers...>, Reducers...>::type {
+  using Stack =
+      typename ReducerStack<ReducingAssembler<Reducers...>, Reducers...>::type;
+
+ public:
+  using Stack::Stack;
+};
+
 }  // namespace v8::internal::compiler::turboshaft
 
 #endif  // V8_COMPILER_TURBOSHAFT_ASSEMBLER_H_
@@ -222,6 +222,29 @@ class Block {
 
   bool HasPredecessors() const { return last_predecessor_ != nullptr; }
 
+  // The immediate dominator, which is computed when the block is bound. This
+  // does not depend on loop backedges, since they cannot change the dominator
+  // of a loop header.
+  Block* GetDominator() const { return dominator_; }
+  // The depth of this block in the dominator tree.
+  uint32_t Depth() const { return depth_; }
+
+  bool Dominates(const Block* other) const {
+    DCHECK(IsBound() && other->IsBound());
+    while (other->Depth() > Depth()) other = other->GetDominator();
+    return other == this;
+  }
+
+  static Block* GetCommonDominator(Block* a, Block* b) {
+    while (a->Depth() > b->Depth()) a = a->GetDominator();
+    while (b->Depth() > a->Depth()) b = b->GetDominator();
+    while (a != b) {
+      a = a->GetDominator();
+      b = b->GetDominator();
+    }
+    return a;
+  }
+
   OpIndex begin() const {
     DCHECK(begin_.valid());
     return begin_;
@@ -243,6 +266,8 @@ class Block {
   BlockIndex index_ = BlockIndex::Invalid();
   Block* last_predecessor_ = nullptr;
   Block* neighboring_predecessor_ = nullptr;
+  Block* dominator_ = nullptr;
+  uint32_t depth_ = 0;
 #ifdef DEBUG
   Graph* graph_ = nullptr;
 #endif
@@ -346,14 +371,17 @@ class Graph {
     DCHECK_EQ(block->graph_, this);
     if (!bound_blocks_.empty() && !block->HasPredecessors()) return false;
     bool deferred = true;
+    Block* dominator = nullptr;
     for (Block* pred = block->last_predecessor_; pred != nullptr;
          pred = pred->neighboring_predecessor_) {
-      if (!pred->IsDeferred()) {
-        deferred = false;
-        break;
-      }
+      if (!pred->IsDeferred()) deferred = false;
+      DCHECK(pred->IsBound());
+      dominator =
+          dominator ? Block::GetCommonDominator(dominator, pred) : pred;
     }
     block->SetDeferred(deferred);
+    block->dominator_ = dominator;
+    block->depth_ = dominator ? dominator->depth_ + 1 : 0;
     DCHECK(!block->begin_.valid());
     block->begin_ = next_operation_index();
     DCHECK_EQ(block->index_, BlockIndex::Invalid());
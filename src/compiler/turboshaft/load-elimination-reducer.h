@@ -0,0 +1,173 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
+
+#include <algorithm>
+#include <type_traits>
+
+#include "src/base/logging.h"
+#include "src/codegen/machine-type.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// Replaces a `LoadOp` by the result of an identical earlier load or by the
+// value of an earlier store to the same location, if no operation in between
+// may have overwritten it. This corresponds to the field part of
+// `compiler::LoadElimination`, but uses the linear block order of the graph:
+// The known memory contents are a small list that is carried through a block
+// and handed on to successors that have no other predecessor. Merges and loop
+// headers start without any knowledge, which avoids a fixpoint iteration.
+//
+// Heap bases are object starts and on-heap objects do not overlap, so an
+// on-heap store can only affect fields of other objects at an overlapping
+// offset. Raw stores and all other writing operations can alias anything.
+template <class Next>
+class LoadEliminationReducer : public Next {
+ public:
+  using Next::Next;
+
+  template <class Op, class... Args>
+  OpIndex Emit(Args... args) {
+    if constexpr (std::is_same_v<Op, LoadOp>) {
+      return ReduceLoad(args...);
+    } else if constexpr (std::is_same_v<Op, StoreOp>) {
+      return ReduceStore(args...);
+    } else {
+      if constexpr (Op::properties.can_write) {
+        known_memory_.clear();
+      }
+      if constexpr (Op::properties.is_block_terminator) {
+        SaveKnownMemory();
+      }
+      return Next::template Emit<Op>(args...);
+    }
+  }
+
+  bool Bind(Block* block) {
+    if (!Next::Bind(block)) return false;
+    known_memory_.clear();
+    // A loop header gets its backedge only later, so only its forward edge is
+    // known at this point.
+    if (block->IsLoop()) return true;
+    Block* predecessor = block->GetDominator();
+    if (predecessor == nullptr || block->Predecessors().size() != 1) {
+      return true;
+    }
+    size_t id = predecessor->index().id();
+    if (id >= saved_ranges_.size()) return true;
+    SavedRange range = saved_ranges_[id];
+    known_memory_.insert(known_memory_.end(),
+                         saved_memory_.begin() + range.begin,
+                         saved_memory_.begin() + range.end);
+    return true;
+  }
+
+ private:
+  struct MemoryEntry {
+    OpIndex base;
+    int32_t offset;
+    LoadOp::Kind kind;
+    // The loaded type for loads. For stores, only the representation is used.
+    MachineType type;
+    bool is_store;
+    OpIndex value;
+
+    int32_t size() const { return ElementSizeInBytes(type.representation()); }
+  };
+
+  struct SavedRange {
+    size_t begin;
+    size_t end;
+  };
+
+  OpIndex ReduceLoad(OpIndex base, LoadOp::Kind kind, MachineType loaded_rep,
+                     int32_t offset) {
+    for (const MemoryEntry& entry : known_memory_) {
+      if (entry.base != base || entry.offset != offset || entry.kind != kind) {
+        continue;
+      }
+      if (entry.is_store ? CanForwardStore(entry.type.representation(),
+                                           loaded_rep)
+                         : entry.type == loaded_rep) {
+        return entry.value;
+      }
+    }
+    OpIndex result =
+        Next::template Emit<LoadOp>(base, kind, loaded_rep, offset);
+    Record(MemoryEntry{base, offset, kind, loaded_rep, false, result});
+    return result;
+  }
+
+  OpIndex ReduceStore(OpIndex base, OpIndex value, StoreOp::Kind kind,
+                      MachineRepresentation stored_rep,
+                      WriteBarrierKind write_barrier, int32_t offset) {
+    if (kind == StoreOp::Kind::kRaw) {
+      known_memory_.clear();
+    } else {
+      int32_t size = ElementSizeInBytes(stored_rep);
+      known_memory_.erase(
+          std::remove_if(known_memory_.begin(), known_memory_.end(),
+                         [&](const MemoryEntry& entry) {
+                           return entry.kind == LoadOp::Kind::kRaw ||
+                                  (entry.offset < offset + size &&
+                                   offset < entry.offset + entry.size());
+                         }),
+          known_memory_.end());
+    }
+    OpIndex result = Next::template Emit<StoreOp>(
+        base, value, kind, stored_rep, write_barrier, offset);
+    LoadOp::Kind load_kind = kind == StoreOp::Kind::kRaw
+                                 ? LoadOp::Kind::kRaw
+                                 : LoadOp::Kind::kOnHeap;
+    Record(MemoryEntry{base, offset, load_kind,
+                       MachineType::TypeForRepresentation(stored_rep), true,
+                       value});
+    return result;
+  }
+
+  // Loads of narrow integers are extended to Word32, so they can observe a
+  // different value than the one stored. Map words might be encoded in memory.
+  static bool CanForwardStore(MachineRepresentation stored_rep,
+                              MachineType loaded_rep) {
+    return stored_rep == loaded_rep.representation() &&
+           stored_rep != MachineRepresentation::kMapWord &&
+           stored_rep != MachineRepresentation::kBit &&
+           stored_rep != MachineRepresentation::kWord8 &&
+           stored_rep != MachineRepresentation::kWord16;
+  }
+
+  void Record(const MemoryEntry& entry) {
+    if (known_memory_.size() == kMaxKnownMemoryEntries) {
+      known_memory_.erase(known_memory_.begin());
+    }
+    known_memory_.push_back(entry);
+  }
+
+  void SaveKnownMemory() {
+    size_t id = this->current_block()->index().id();
+    if (saved_ranges_.size() <= id) saved_ranges_.resize(id + 1, {0, 0});
+    size_t begin = saved_memory_.size();
+    saved_memory_.insert(saved_memory_.end(), known_memory_.begin(),
+                         known_memory_.end());
+    saved_ranges_[id] = {begin, saved_memory_.size()};
+  }
+
+  // Bounds the cost of a lookup, which is linear in the number of entries.
+  static constexpr size_t kMaxKnownMemoryEntries = 32;
+
+  ZoneVector<MemoryEntry> known_memory_{this->phase_zone()};
+  // The known memory contents at the end of each finished block, indexed by
+  // block id.
+  ZoneVector<MemoryEntry> saved_memory_{this->phase_zone()};
+  ZoneVector<SavedRange> saved_ranges_{this->phase_zone()};
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
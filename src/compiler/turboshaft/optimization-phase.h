@@ -0,0 +1,242 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_OPTIMIZATION_PHASE_H_
+#define V8_COMPILER_TURBOSHAFT_OPTIMIZATION_PHASE_H_
+
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/base/vector.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// An optimization phase copies the input graph into its companion graph by
+// emitting every operation through `Assembler`, typically a
+// `ReducingAssembler`. Blocks are visited in their linear order, so dominators
+// come first and every input is emitted before its uses, except for loop phi
+// backedges, which are patched when the backedge is emitted. Afterwards, the
+// input graph is swapped with the result.
+template <class Assembler>
+class OptimizationPhase {
+ public:
+  static void Run(Graph* input, Zone* phase_zone) {
+    Impl phase{*input, phase_zone};
+    phase.Run();
+  }
+
+ private:
+  struct Impl {
+    Graph& input_graph;
+    Zone* phase_zone;
+
+    Assembler assembler{&input_graph.GetOrCreateCompanion(), phase_zone};
+    ZoneVector<Block*> block_mapping{input_graph.block_count(), nullptr,
+                                     phase_zone};
+    ZoneVector<OpIndex> op_mapping{input_graph.op_id_count(),
+                                   OpIndex::Invalid(), phase_zone};
+
+    void Run() {
+      for (const Block& input_block : input_graph.blocks()) {
+        block_mapping[input_block.index().id()] =
+            assembler.NewBlock(input_block.kind());
+      }
+      for (const Block& input_block : input_graph.blocks()) {
+        Block* new_block = MapToNewGraph(input_block.index());
+        if (!assembler.Bind(new_block)) continue;
+        new_block->SetDeferred(input_block.IsDeferred());
+        for (const Operation& op : input_graph.operations(input_block)) {
+          OpIndex new_index;
+          switch (op.opcode) {
+#define EMIT_INSTR_CASE(Name)                             \
+  case Opcode::k##Name:                                   \
+    new_index = this->Reduce##Name(op.Cast<Name##Op>()); \
+    break;
+            TURBOSHAFT_OPERATION_LIST(EMIT_INSTR_CASE)
+#undef EMIT_INSTR_CASE
+          }
+          op_mapping[input_graph.Index(op).id()] = new_index;
+        }
+        DCHECK_NULL(assembler.current_block());
+      }
+      input_graph.SwapWithCompanion();
+    }
+
+    OpIndex ReduceBinop(const BinopOp& op) {
+      return assembler.Binop(MapToNewGraph(op.left()),
+                             MapToNewGraph(op.right()), op.kind, op.rep);
+    }
+    OpIndex ReduceOverflowCheckedBinop(const OverflowCheckedBinopOp& op) {
+      return assembler.OverflowCheckedBinop(MapToNewGraph(op.left()),
+                                            MapToNewGraph(op.right()),
+                                            op.kind, op.rep);
+    }
+    OpIndex ReduceFloatUnary(const FloatUnaryOp& op) {
+      return assembler.FloatUnary(MapToNewGraph(op.input()), op.kind, op.rep);
+    }
+    OpIndex ReduceShift(const ShiftOp& op) {
+      return assembler.Shift(MapToNewGraph(op.left()),
+                             MapToNewGraph(op.right()), op.kind, op.rep);
+    }
+    OpIndex ReduceEqual(const EqualOp& op) {
+      return assembler.Equal(MapToNewGraph(op.left()),
+                             MapToNewGraph(op.right()), op.rep);
+    }
+    OpIndex ReduceComparison(const ComparisonOp& op) {
+      return assembler.Comparison(MapToNewGraph(op.left()),
+                                  MapToNewGraph(op.right()), op.kind, op.rep);
+    }
+    OpIndex ReduceChange(const ChangeOp& op) {
+      return assembler.Change(MapToNewGraph(op.input()), op.kind, op.from,
+                              op.to);
+    }
+    OpIndex ReduceTaggedBitcast(const TaggedBitcastOp& op) {
+      return assembler.TaggedBitcast(MapToNewGraph(op.input()), op.from,
+                                     op.to);
+    }
+    OpIndex ReducePendingLoopPhi(const PendingLoopPhiOp& op) { UNREACHABLE(); }
+    OpIndex ReduceConstant(const ConstantOp& op) {
+      return assembler.Constant(op.kind, op.storage);
+    }
+    OpIndex ReduceLoad(const LoadOp& op) {
+      return assembler.Load(MapToNewGraph(op.base()), op.kind, op.loaded_rep,
+                            op.offset);
+    }
+    OpIndex ReduceIndexedLoad(const IndexedLoadOp& op) {
+      return assembler.IndexedLoad(
+          MapToNewGraph(op.base()), MapToNewGraph(op.index()), op.kind,
+          op.loaded_rep, op.offset, op.element_size_log2);
+    }
+    OpIndex ReduceStore(const StoreOp& op) {
+      return assembler.Store(MapToNewGraph(op.base()),
+                             MapToNewGraph(op.value()), op.kind, op.stored_rep,
+                             op.write_barrier, op.offset);
+    }
+    OpIndex ReduceIndexedStore(const IndexedStoreOp& op) {
+      return assembler.IndexedStore(
+          MapToNewGraph(op.base()), MapToNewGraph(op.index()),
+          MapToNewGraph(op.value()), op.kind, op.stored_rep, op.write_barrier,
+          op.offset, op.element_size_log2);
+    }
+    OpIndex ReduceParameter(const ParameterOp& op) {
+      return assembler.Parameter(op.parameter_index, op.debug_name);
+    }
+    OpIndex ReduceGoto(const GotoOp& op) {
+      Block* destination = MapToNewGraph(op.destination->index());
+      OpIndex result = assembler.Goto(destination);
+      if (destination->IsBound()) {
+        DCHECK(destination->IsLoop());
+        FixLoopPhis(destination);
+      }
+      return result;
+    }
+    OpIndex ReduceStackPointerGreaterThan(const StackPointerGreaterThanOp& op) {
+      return assembler.StackPointerGreaterThan(MapToNewGraph(op.stack_limit()),
+                                               op.kind);
+    }
+    OpIndex ReduceLoadStackCheckOffset(const LoadStackCheckOffsetOp& op) {
+      return assembler.LoadStackCheckOffset();
+    }
+    OpIndex ReduceCheckLazyDeopt(const CheckLazyDeoptOp& op) {
+      return assembler.CheckLazyDeopt(MapToNewGraph(op.call()),
+                                      MapToNewGraph(op.frame_state()));
+    }
+    OpIndex ReduceDeoptimize(const DeoptimizeOp& op) {
+      return assembler.Deoptimize(MapToNewGraph(op.frame_state()),
+                                  op.parameters);
+    }
+    OpIndex ReduceDeoptimizeIf(const DeoptimizeIfOp& op) {
+      return assembler.DeoptimizeIf(MapToNewGraph(op.condition()),
+                                    MapToNewGraph(op.frame_state()),
+                                    op.negated, op.parameters);
+    }
+    OpIndex ReducePhi(const PhiOp& op) {
+      base::Vector<const OpIndex> old_inputs = op.inputs();
+      if (assembler.current_block()->IsLoop()) {
+        DCHECK_EQ(old_inputs.size(), 2);
+        return assembler.PendingLoopPhi(MapToNewGraph(old_inputs[0]), op.rep,
+                                        old_inputs[1]);
+      }
+      base::SmallVector<OpIndex, 8> new_inputs = MapToNewGraph<8>(old_inputs);
+      return assembler.Phi(base::VectorOf(new_inputs), op.rep);
+    }
+    OpIndex ReduceFrameState(const FrameStateOp& op) {
+      base::SmallVector<OpIndex, 32> inputs = MapToNewGraph<32>(op.inputs());
+      return assembler.FrameState(base::VectorOf(inputs), op.inlined, op.data);
+    }
+    OpIndex ReduceCall(const CallOp& op) {
+      base::SmallVector<OpIndex, 16> arguments =
+          MapToNewGraph<16>(op.arguments());
+      return assembler.Call(MapToNewGraph(op.callee()),
+                            base::VectorOf(arguments), op.descriptor);
+    }
+    OpIndex ReduceUnreachable(const UnreachableOp& op) {
+      return assembler.Unreachable();
+    }
+    OpIndex ReduceReturn(const ReturnOp& op) {
+      base::SmallVector<OpIndex, 4> return_values =
+          MapToNewGraph<4>(op.return_values());
+      return assembler.Return(base::VectorOf(return_values), op.pop_count);
+    }
+    OpIndex ReduceBranch(const BranchOp& op) {
+      return assembler.Branch(MapToNewGraph(op.condition()),
+                              MapToNewGraph(op.if_true->index()),
+                              MapToNewGraph(op.if_false->index()));
+    }
+    OpIndex ReduceSwitch(const SwitchOp& op) {
+      base::SmallVector<SwitchOp::Case, 16> cases;
+      for (SwitchOp::Case c : op.cases) {
+        cases.emplace_back(c.value, MapToNewGraph(c.destination->index()));
+      }
+      return assembler.Switch(
+          MapToNewGraph(op.input()),
+          assembler.graph_zone()->CloneVector(base::VectorOf(cases)),
+          MapToNewGraph(op.default_case->index()));
+    }
+    OpIndex ReduceProjection(const ProjectionOp& op) {
+      return assembler.Projection(MapToNewGraph(op.input()), op.kind);
+    }
+
+    OpIndex MapToNewGraph(OpIndex old_index) {
+      OpIndex result = op_mapping[old_index.id()];
+      DCHECK(result.valid());
+      return result;
+    }
+
+    template <size_t expected_size>
+    base::SmallVector<OpIndex, expected_size> MapToNewGraph(
+        base::Vector<const OpIndex> inputs) {
+      base::SmallVector<OpIndex, expected_size> result;
+      for (OpIndex input : inputs) {
+        result.push_back(MapToNewGraph(input));
+      }
+      return result;
+    }
+
+    Block* MapToNewGraph(BlockIndex old_index) {
+      Block* result = block_mapping[old_index.id()];
+      DCHECK_NOT_NULL(result);
+      return result;
+    }
+
+    void FixLoopPhis(Block* loop) {
+      DCHECK(loop->IsLoop());
+      for (Operation& op : assembler.graph().operations(*loop)) {
+        if (!op.Is<PendingLoopPhiOp>()) continue;
+        auto& pending_phi = op.Cast<PendingLoopPhiOp>();
+        assembler.graph().template Replace<PhiOp>(
+            assembler.graph().Index(pending_phi),
+            base::VectorOf({pending_phi.first(),
+                            MapToNewGraph(pending_phi.old_backedge_index)}),
+            pending_phi.rep);
+      }
+    }
+  };
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_OPTIMIZATION_PHASE_H_
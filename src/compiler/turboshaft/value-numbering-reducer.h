@@ -0,0 +1,158 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_VALUE_NUMBERING_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_VALUE_NUMBERING_REDUCER_H_
+
+#include <algorithm>
+#include <type_traits>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/vector.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// Global value numbering: A pure operation is replaced by an identical
+// operation (same opcode, inputs and options) that was emitted before in a
+// dominating block.
+//
+// The table is an open-addressing hash table with linear probing, indexed by
+// the hash of the new operation. Since blocks are bound in an order where
+// dominators come first, the entries form a stack: When a block is bound, the
+// entries of all blocks on the stack that do not dominate it are removed,
+// newest first. Removing the most recently inserted entries never breaks a
+// probing sequence of an older entry, so no tombstones are needed, and
+// lookups never have to check dominance.
+template <class Next>
+class ValueNumberingReducer : public Next {
+ public:
+  using Next::Next;
+
+  template <class Op, class... Args>
+  OpIndex Emit(Args... args) {
+    if constexpr (!CanBeValueNumbered<Op>()) {
+      return Next::template Emit<Op>(args...);
+    } else {
+      OpIndex next_index = this->graph().next_operation_index();
+      USE(next_index);
+      OpIndex result = Next::template Emit<Op>(args...);
+      // `AddOrFind` might remove the new operation again.
+      DCHECK_EQ(result, next_index);
+      return AddOrFind<Op>(result);
+    }
+  }
+
+  bool Bind(Block* block) {
+    if (!Next::Bind(block)) return false;
+    while (!dominator_path_.empty() &&
+           !dominator_path_.back()->Dominates(block)) {
+      ClearEntriesOf(dominator_path_.size() - 1);
+      dominator_path_.pop_back();
+      depths_heads_.pop_back();
+    }
+    dominator_path_.push_back(block);
+    depths_heads_.push_back(nullptr);
+    return true;
+  }
+
+ private:
+  struct Entry {
+    OpIndex value;
+    // 0 marks an empty slot.
+    size_t hash = 0;
+    // The previously added entry of the same block.
+    Entry* depth_neighboring_entry = nullptr;
+  };
+
+  template <class Op>
+  static constexpr bool CanBeValueNumbered() {
+    // Phis depend on the block they are in. Pending loop phis are only
+    // placeholders without a complete set of inputs.
+    return Op::properties.is_pure && !std::is_same_v<Op, PhiOp> &&
+           !std::is_same_v<Op, PendingLoopPhiOp>;
+  }
+
+  template <class Op>
+  OpIndex AddOrFind(OpIndex op_idx) {
+    const Op& op = this->graph().Get(op_idx).template Cast<Op>();
+    RehashIfNeeded();
+    size_t hash = ComputeHash(op);
+    for (size_t i = hash & mask_;; i = NextEntryIndex(i)) {
+      Entry& entry = table_[i];
+      if (entry.hash == 0) {
+        entry = Entry{op_idx, hash, depths_heads_.back()};
+        depths_heads_.back() = &entry;
+        ++entry_count_;
+        return op_idx;
+      }
+      if (entry.hash == hash) {
+        const Operation& entry_op = this->graph().Get(entry.value);
+        if (entry_op.Is<Op>() && entry_op.Cast<Op>() == op) {
+          this->graph().RemoveLast();
+          return entry.value;
+        }
+      }
+    }
+  }
+
+  template <class Op>
+  static size_t ComputeHash(const Op& op) {
+    size_t hash = op.hash_value();
+    return hash == 0 ? 1 : hash;
+  }
+
+  size_t NextEntryIndex(size_t index) const { return (index + 1) & mask_; }
+
+  void ClearEntriesOf(size_t depth) {
+    for (Entry* entry = depths_heads_[depth]; entry != nullptr;) {
+      Entry* next = entry->depth_neighboring_entry;
+      *entry = Entry();
+      --entry_count_;
+      entry = next;
+    }
+  }
+
+  void RehashIfNeeded() {
+    if (V8_LIKELY(table_.size() - (table_.size() / 4) > entry_count_)) return;
+    ZoneVector<Entry> old_table = std::move(table_);
+    table_ = ZoneVector<Entry>(
+        std::max<size_t>(kInitialCapacity, old_table.size() * 2),
+        this->phase_zone());
+    mask_ = table_.size() - 1;
+    DCHECK(base::bits::IsPowerOfTwo(table_.size()));
+    // Re-insert the entries block by block, oldest block first, so that the
+    // stack discipline of the table is preserved.
+    for (size_t depth = 0; depth < depths_heads_.size(); ++depth) {
+      Entry* entry = depths_heads_[depth];
+      depths_heads_[depth] = nullptr;
+      while (entry != nullptr) {
+        Entry* next = entry->depth_neighboring_entry;
+        for (size_t i = entry->hash & mask_;; i = NextEntryIndex(i)) {
+          if (table_[i].hash == 0) {
+            table_[i] = Entry{entry->value, entry->hash, depths_heads_[depth]};
+            depths_heads_[depth] = &table_[i];
+            break;
+          }
+        }
+        entry = next;
+      }
+    }
+  }
+
+  static constexpr size_t kInitialCapacity = 128;
+
+  ZoneVector<Entry> table_{this->phase_zone()};
+  size_t mask_ = 0;
+  size_t entry_count_ = 0;
+  ZoneVector<Block*> dominator_path_{this->phase_zone()};
+  ZoneVector<Entry*> depths_heads_{this->phase_zone()};
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_VALUE_NUMBERING_REDUCER_H_
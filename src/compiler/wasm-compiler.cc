@@ -3800,6 +3800,49 @@ Node* WasmGraphBuilder::CheckBoundsAndAlignment(
   return index;
 }
 
+namespace {
+// Returns an upper bound for the value of the 32-bit memory index {index}, as
+// far as it can be derived from the operation which computes it.
+uint32_t MaxMemory32Index(Node* index) {
+  Uint32Matcher match(index);
+  if (match.HasResolvedValue()) return match.ResolvedValue();
+  switch (index->opcode()) {
+    case IrOpcode::kWord32And: {
+      // Constants are moved to the right of commutative operations.
+      Uint32BinopMatcher binop(index);
+      if (binop.right().HasResolvedValue()) {
+        return binop.right().ResolvedValue();
+      }
+      break;
+    }
+    case IrOpcode::kWord32Shr: {
+      Uint32BinopMatcher binop(index);
+      if (binop.right().HasResolvedValue()) {
+        return std::numeric_limits<uint32_t>::max() >>
+               (binop.right().ResolvedValue() & 0x1f);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return std::numeric_limits<uint32_t>::max();
+}
+
+// Returns whether {dominator} is on every control path to {control}. Only
+// walks up chains of nodes with a single control input, for a bounded number
+// of steps.
+bool ControlDominates(Node* dominator, Node* control) {
+  constexpr int kMaxSteps = 32;
+  for (int i = 0; i < kMaxSteps; ++i) {
+    if (control == dominator) return true;
+    if (control->op()->ControlInputCount() != 1) return false;
+    control = NodeProperties::GetControlInput(control);
+  }
+  return false;
+}
+}  // namespace
+
 // Insert code to bounds check a memory access if necessary. Return the
 // bounds-checked index, which is guaranteed to have (the equivalent of)
 // {uintptr_t} representation.
@@ -3820,8 +3863,14 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     return {gasm_->UintPtrConstant(0), kOutOfBounds};
   }
 
+  // Upper bound of the index, and the index as given by the wasm code; index
+  // conversions below create new nodes.
+  uint64_t max_index = std::numeric_limits<uint64_t>::max();
+  Node* wasm_index = index;
+
   // Convert the index to uintptr.
   if (!env_->module->is_memory64) {
+    max_index = MaxMemory32Index(index);
     index = BuildChangeUint32ToUintPtr(index);
   } else if (kSystemPointerSize == kInt32Size) {
     // In memory64 mode on 32-bit systems, the upper 32 bits need to be zero to
@@ -3852,18 +3901,40 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   uintptr_t end_offset = offset + access_size - 1u;
 
   UintPtrMatcher match(index);
-  if (match.HasResolvedValue() && end_offset <= env_->min_memory_size &&
-      match.ResolvedValue() < env_->min_memory_size - end_offset) {
-    // The input index is a constant and everything is statically within
-    // bounds of the smallest possible memory.
+  if (match.HasResolvedValue()) {
+    max_index = std::min<uint64_t>(max_index, match.ResolvedValue());
+  }
+  if (end_offset <= env_->min_memory_size &&
+      max_index < env_->min_memory_size - end_offset) {
+    // The input index is a constant or bounded by its computation, and
+    // everything is statically within bounds of the smallest possible memory.
     return {index, kInBounds};
   }
 
   if (env_->bounds_checks == wasm::kTrapHandler &&
       enforce_check == kCanOmitBoundsCheck) {
+    if (env_->module->is_memory64) {
+      // The guard regions only cover 32-bit indexes, so the upper half of a
+      // 64-bit index must be zero.
+      DCHECK_EQ(kSystemPointerSize, kInt64Size);
+      Node* high_word = gasm_->TruncateInt64ToInt32(
+          gasm_->Word64Shr(index, Int32Constant(32)));
+      TrapIfTrue(wasm::kTrapMemOutOfBounds, high_word, position);
+    }
     return {index, kTrapHandler};
   }
 
+  // Memories never shrink, so a dynamic check of the same index with at least
+  // the same end offset on every path to this access makes this check
+  // redundant. This merges checks of accesses at adjacent constant offsets
+  // if the access with the largest offset comes first.
+  for (const BoundsCheck& check : bounds_checks_) {
+    if (check.index == wasm_index && check.end_offset >= end_offset &&
+        ControlDominates(check.trap, control())) {
+      return {index, kDynamicallyChecked};
+    }
+  }
+
   Node* mem_size = instance_cache_->mem_size;
   Node* end_offset_node = mcgraph_->UintPtrConstant(end_offset);
   if (end_offset > env_->min_memory_size) {
@@ -3879,6 +3950,8 @@ WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   // Introduce the actual bounds check.
   Node* cond = gasm_->UintLessThan(index, effective_size);
   TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  bounds_checks_[next_bounds_check_] = {wasm_index, end_offset, control()};
+  next_bounds_check_ = (next_bounds_check_ + 1) % bounds_checks_.size();
   return {index, kDynamicallyChecked};
 }
 
@@ -7785,6 +7858,12 @@ static bool IsSupportedWasmFastApiFunction(
     // Arg 0 is the receiver, skip over it since wasm doesn't
     // have a concept of receivers.
     CTypeInfo arg = info->ArgumentInfo(i + 1);
+    // Wasm has no string values to pass as string views.
+    if (arg.GetType() == CTypeInfo::Type::kSeqOneByteString ||
+        arg.GetType() == CTypeInfo::Type::kSeqTwoByteString) {
+      log_imported_function_mismatch();
+      return false;
+    }
     if (NormalizeFastApiRepresentation(arg) !=
         expected_sig->GetParam(i).machine_type().representation()) {
       log_imported_function_mismatch();
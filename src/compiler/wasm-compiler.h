@@ -9,6 +9,7 @@
 #ifndef V8_COMPILER_WASM_COMPILER_H_
 #define V8_COMPILER_WASM_COMPILER_H_
 
+#include <array>
 #include <memory>
 #include <utility>
 
@@ -814,6 +815,16 @@ class WasmGraphBuilder {
 
   WasmInstanceCacheNodes* instance_cache_ = nullptr;
 
+  // The most recent dynamic bounds checks, used to omit checks which are
+  // implied by a dominating check.
+  struct BoundsCheck {
+    Node* index = nullptr;
+    uintptr_t end_offset = 0;
+    Node* trap = nullptr;
+  };
+  std::array<BoundsCheck, 16> bounds_checks_;
+  size_t next_bounds_check_ = 0;
+
   SetOncePointer<Node> stack_check_code_node_;
   SetOncePointer<const Operator> stack_check_call_operator_;
 
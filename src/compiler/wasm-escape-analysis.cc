@@ -4,8 +4,10 @@
 
 #include "src/compiler/wasm-escape-analysis.h"
 
+#include "src/base/optional.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 
 namespace v8 {
 namespace internal {
@@ -20,31 +22,135 @@ Reduction WasmEscapeAnalysis::Reduce(Node* node) {
   }
 }
 
+namespace {
+
+bool IsStore(Node* node) {
+  return node->opcode() == IrOpcode::kStoreToObject ||
+         node->opcode() == IrOpcode::kInitializeImmutableInObject;
+}
+
+bool IsLoad(Node* node) {
+  return node->opcode() == IrOpcode::kLoadFromObject ||
+         node->opcode() == IrOpcode::kLoadImmutableFromObject;
+}
+
+bool IsEqualityCheck(Node* node) {
+  return node->opcode() == IrOpcode::kWord32Equal ||
+         node->opcode() == IrOpcode::kWord64Equal;
+}
+
+// Nodes which exist before any allocation in the function, and can therefore
+// never be equal to a fresh allocation.
+bool IsPreexistingObject(Node* node) {
+  return node->opcode() == IrOpcode::kParameter ||
+         node->opcode() == IrOpcode::kLoadImmutable ||
+         NodeProperties::IsConstant(node);
+}
+
+base::Optional<int64_t> ConstantOffset(Node* node) {
+  Node* offset = NodeProperties::GetValueInput(node, 1);
+  if (offset->opcode() == IrOpcode::kInt64Constant) {
+    return OpParameter<int64_t>(offset->op());
+  }
+  if (offset->opcode() == IrOpcode::kInt32Constant) {
+    return OpParameter<int32_t>(offset->op());
+  }
+  return {};
+}
+
+// Packed fields are zero- or sign-extended on load, so the stored value cannot
+// replace the load directly.
+bool CanForward(MachineRepresentation store, MachineRepresentation load) {
+  return store == load && store != MachineRepresentation::kWord8 &&
+         store != MachineRepresentation::kWord16;
+}
+
+}  // namespace
+
+Node* WasmEscapeAnalysis::FindStoredValue(Node* allocation, Node* load) {
+  base::Optional<int64_t> offset = ConstantOffset(load);
+  if (!offset.has_value()) return nullptr;
+  MachineRepresentation representation =
+      ObjectAccessOf(load->op()).machine_type.representation();
+  // The allocation does not escape, so only stores to the allocation itself
+  // can change its fields. Walk up the effect chain to the closest one.
+  constexpr int kMaxEffectChainLength = 256;
+  Node* effect = NodeProperties::GetEffectInput(load);
+  for (int i = 0; i < kMaxEffectChainLength; ++i) {
+    if (effect == allocation) return nullptr;
+    if (IsStore(effect) &&
+        NodeProperties::GetValueInput(effect, 0) == allocation) {
+      base::Optional<int64_t> store_offset = ConstantOffset(effect);
+      if (!store_offset.has_value()) return nullptr;
+      if (*store_offset == *offset) {
+        MachineRepresentation stored_representation =
+            ObjectAccessOf(effect->op()).machine_type.representation();
+        if (!CanForward(stored_representation, representation)) return nullptr;
+        return NodeProperties::GetValueInput(effect, 2);
+      }
+    }
+    // Give up on merges and on nodes without an effect input.
+    if (effect->op()->EffectInputCount() != 1) return nullptr;
+    effect = NodeProperties::GetEffectInput(effect);
+  }
+  return nullptr;
+}
+
 Reduction WasmEscapeAnalysis::ReduceAllocateRaw(Node* node) {
   DCHECK_EQ(node->opcode(), IrOpcode::kAllocateRaw);
   // TODO(manoskouk): Account for phis.
 
-  // Collect all value edges of {node} in this vector.
+  // The allocation does not escape if it is only used as the object of stores
+  // and loads, and in comparisons against objects which existed before it.
   std::vector<Edge> value_edges;
+  std::vector<Node*> loads;
+  std::vector<Node*> equality_checks;
   for (Edge edge : node->use_edges()) {
-    if (NodeProperties::IsValueEdge(edge)) {
-      if (edge.index() != 0 ||
-          (edge.from()->opcode() != IrOpcode::kStoreToObject &&
-           edge.from()->opcode() != IrOpcode::kInitializeImmutableInObject)) {
-        return NoChange();
-      }
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* use = edge.from();
+    if (edge.index() == 0 && IsStore(use)) {
       value_edges.push_back(edge);
+    } else if (edge.index() == 0 && IsLoad(use)) {
+      loads.push_back(use);
+    } else if (IsEqualityCheck(use) &&
+               IsPreexistingObject(NodeProperties::GetValueInput(
+                   use, 1 - edge.index()))) {
+      equality_checks.push_back(use);
+    } else {
+      return NoChange();
     }
   }
 
+  // Replace loads by the stored values. Once all loads are gone, the stores
+  // can be removed as well.
+  bool changed = false;
+  for (Node* load : loads) {
+    if (load->IsDead()) continue;
+    Node* value = FindStoredValue(node, load);
+    if (value == nullptr) continue;
+    ReplaceWithValue(load, value, NodeProperties::GetEffectInput(load));
+    load->Kill();
+    // The forwarded value might be an allocation which can now be removed.
+    Revisit(value);
+    changed = true;
+  }
+  for (Node* check : equality_checks) {
+    if (check->IsDead()) continue;
+    ReplaceWithValue(check, mcgraph_->Int32Constant(0));
+    check->Kill();
+    changed = true;
+  }
+  for (Node* load : loads) {
+    if (!load->IsDead()) return changed ? Changed(node) : NoChange();
+  }
+
   // Remove all discovered stores from the effect chain.
   for (Edge edge : value_edges) {
     DCHECK(NodeProperties::IsValueEdge(edge));
     DCHECK_EQ(edge.index(), 0);
     Node* use = edge.from();
     DCHECK(!use->IsDead());
-    DCHECK(use->opcode() == IrOpcode::kStoreToObject ||
-           use->opcode() == IrOpcode::kInitializeImmutableInObject);
+    DCHECK(IsStore(use));
     // The value stored by this StoreToObject node might be another allocation
     // which has no more uses. Therefore we have to revisit it. Note that this
     // will not happen automatically: ReplaceWithValue does not trigger revisits
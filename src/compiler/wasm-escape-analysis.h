@@ -31,6 +31,9 @@ class WasmEscapeAnalysis final : public AdvancedReducer {
 
  private:
   Reduction ReduceAllocateRaw(Node* call);
+  // Returns the value last stored to the field of the non-escaping
+  // {allocation} which {load} reads, or nullptr if it is unknown.
+  Node* FindStoredValue(Node* allocation, Node* load);
   MachineGraph* const mcgraph_;
 };
 
@@ -0,0 +1,383 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/wasm-revectorizer.h"
+
+#include "src/compiler/all-nodes.h"
+#include "src/compiler/compiler-source-position-table.h"
+#include "src/compiler/machine-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                        \
+  do {                                                    \
+    if (FLAG_trace_wasm_revectorize) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+// Upper bounds for the effect chain between combined accesses and for the
+// size of the combined trees, to keep compile time linear.
+constexpr size_t kMaxChainLength = 64;
+constexpr size_t kMaxPackCount = 32;
+
+#define SIMD128_BINOP_LIST(V) \
+  V(F64x2Add, F64x4Add)       \
+  V(F32x4Add, F32x8Add)       \
+  V(I64x2Add, I64x4Add)       \
+  V(I32x4Add, I32x8Add)       \
+  V(I16x8Add, I16x16Add)      \
+  V(I8x16Add, I8x32Add)       \
+  V(F64x2Sub, F64x4Sub)       \
+  V(F32x4Sub, F32x8Sub)       \
+  V(I64x2Sub, I64x4Sub)       \
+  V(I32x4Sub, I32x8Sub)       \
+  V(I16x8Sub, I16x16Sub)      \
+  V(I8x16Sub, I8x32Sub)       \
+  V(F64x2Mul, F64x4Mul)       \
+  V(F32x4Mul, F32x8Mul)       \
+  V(I32x4Mul, I32x8Mul)       \
+  V(I16x8Mul, I16x16Mul)      \
+  V(S128And, S256And)         \
+  V(S128Or, S256Or)           \
+  V(S128Xor, S256Xor)
+
+// Returns the 256-bit counterpart of the 128-bit binary operation {node}, or
+// nullptr if there is none.
+const Operator* Simd256Operator(MachineOperatorBuilder* machine, Node* node) {
+  switch (node->opcode()) {
+#define CASE(Name, Simd256Name) \
+  case IrOpcode::k##Name:        \
+    return machine->Simd256Name();
+    SIMD128_BINOP_LIST(CASE)
+#undef CASE
+    default:
+      return nullptr;
+  }
+}
+
+#undef SIMD128_BINOP_LIST
+
+bool IsMemoryAccess(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kLoad:
+    case IrOpcode::kProtectedLoad:
+    case IrOpcode::kStore:
+    case IrOpcode::kProtectedStore:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsStore(Node* node) {
+  return node->opcode() == IrOpcode::kStore ||
+         node->opcode() == IrOpcode::kProtectedStore;
+}
+
+MachineRepresentation AccessRepresentation(Node* node) {
+  DCHECK(IsMemoryAccess(node));
+  return IsStore(node) ? StoreRepresentationOf(node->op()).representation()
+                       : LoadRepresentationOf(node->op()).representation();
+}
+
+bool IsSimd128Access(Node* node) {
+  return IsMemoryAccess(node) &&
+         AccessRepresentation(node) == MachineRepresentation::kSimd128;
+}
+
+// The address of a memory access, split into the roots of its base and index
+// inputs and the constants added to them.
+struct MemoryAddress {
+  Node* base;
+  Node* index;
+  int64_t index_offset;
+  // The sum of the constants added to the base and to the index.
+  int64_t offset;
+};
+
+MemoryAddress DecomposeAddress(Node* access) {
+  MemoryAddress address{access->InputAt(0), access->InputAt(1), 0, 0};
+  Int64BinopMatcher base(address.base);
+  if (base.opcode() == IrOpcode::kInt64Add && base.right().HasResolvedValue()) {
+    address.base = base.left().node();
+    address.offset = base.right().ResolvedValue();
+  }
+  // A 32-bit index is converted to pointer size after adding the constant.
+  if (address.index->opcode() == IrOpcode::kChangeUint32ToUint64) {
+    Int32BinopMatcher index(address.index->InputAt(0));
+    address.index = index.node();
+    if (index.opcode() == IrOpcode::kInt32Add &&
+        index.right().HasResolvedValue() &&
+        index.right().ResolvedValue() >= 0) {
+      address.index = index.left().node();
+      address.index_offset = index.right().ResolvedValue();
+    }
+  } else {
+    Int64BinopMatcher index(address.index);
+    if (index.opcode() == IrOpcode::kInt64Add &&
+        index.right().HasResolvedValue() &&
+        index.right().ResolvedValue() >= 0) {
+      address.index = index.left().node();
+      address.index_offset = index.right().ResolvedValue();
+    }
+  }
+  address.offset += address.index_offset;
+  return address;
+}
+
+// Returns true if {low} and {high} are equivalent Simd128 accesses, and
+// {high} accesses the 16 bytes right after the ones accessed by {low}.
+bool AreAdjacent(Node* low, Node* high) {
+  if (low->op() != high->op() || !IsSimd128Access(low) ||
+      NodeProperties::GetControlInput(low) !=
+          NodeProperties::GetControlInput(high)) {
+    return false;
+  }
+  MemoryAddress low_address = DecomposeAddress(low);
+  MemoryAddress high_address = DecomposeAddress(high);
+  // The combined access uses the address inputs of {low}. If the index of
+  // {high} wraps around in 32 bits, {low} and the combined access are out of
+  // bounds, but not if only the index of {low} does.
+  return low_address.base == high_address.base &&
+         low_address.index == high_address.index &&
+         low_address.index_offset <= high_address.index_offset &&
+         high_address.offset - low_address.offset == kSimd128Size;
+}
+
+// Returns false only if {a} and {b} are guaranteed to access disjoint memory.
+bool MayAlias(Node* a, Node* b) {
+  // Accesses with different index nodes might alias through any wrap-around.
+  if (a->InputAt(1) != b->InputAt(1)) return true;
+  MemoryAddress a_address = DecomposeAddress(a);
+  MemoryAddress b_address = DecomposeAddress(b);
+  if (a_address.base != b_address.base) return true;
+  return a_address.offset <
+             b_address.offset + ElementSizeInBytes(AccessRepresentation(b)) &&
+         b_address.offset <
+             a_address.offset + ElementSizeInBytes(AccessRepresentation(a));
+}
+
+bool HasSingleValueUse(Node* node) {
+  int count = 0;
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsValueEdge(edge)) ++count;
+  }
+  return count == 1;
+}
+
+bool HasSingleEffectUse(Node* node) {
+  int count = 0;
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) ++count;
+  }
+  return count == 1;
+}
+
+}  // namespace
+
+int WasmRevectorizer::Run() {
+  AllNodes all(zone_, mcgraph_->graph());
+  ZoneVector<Node*> stores(zone_);
+  for (Node* node : all.reachable) {
+    if (IsStore(node) && IsSimd128Access(node)) stores.push_back(node);
+  }
+  int count = 0;
+  for (Node* store : stores) {
+    // The earlier store of a combined pair is dead.
+    if (store->IsDead()) continue;
+    if (TryRevectorizeStore(store)) ++count;
+  }
+  return count;
+}
+
+bool WasmRevectorizer::TryRevectorizeStore(Node* store) {
+  Node* other = NodeProperties::GetEffectInput(store);
+  for (size_t i = 0; i < kMaxChainLength && IsMemoryAccess(other);
+       ++i, other = NodeProperties::GetEffectInput(other)) {
+    if (!IsStore(other)) continue;
+    Node* low = other;
+    Node* high = store;
+    if (!AreAdjacent(low, high)) {
+      std::swap(low, high);
+      if (!AreAdjacent(low, high)) continue;
+    }
+    ZoneVector<Pack> packs(zone_);
+    ZoneVector<Node*> chain(zone_);
+    if (!CollectPacks(low->InputAt(2), high->InputAt(2), &packs)) {
+      return false;
+    }
+    packs.push_back({low, high});
+    if (!CanReorderAccesses(store, packs, &chain)) return false;
+    TRACE("[revectorizing stores #%d and #%d (%zu packs)]\n", low->id(),
+          high->id(), packs.size());
+    Combine(packs, chain);
+    return true;
+  }
+  return false;
+}
+
+bool WasmRevectorizer::CollectPacks(Node* low, Node* high,
+                                    ZoneVector<Pack>* packs) {
+  if (low == high || low->opcode() != high->opcode() ||
+      packs->size() >= kMaxPackCount || !HasSingleValueUse(low) ||
+      !HasSingleValueUse(high)) {
+    return false;
+  }
+  if (IsMemoryAccess(low)) {
+    if (IsStore(low) || !AreAdjacent(low, high)) return false;
+  } else {
+    if (Simd256Operator(mcgraph_->machine(), low) == nullptr) return false;
+    for (int i = 0; i < 2; ++i) {
+      if (!CollectPacks(low->InputAt(i), high->InputAt(i), packs)) {
+        return false;
+      }
+    }
+  }
+  packs->push_back({low, high});
+  return true;
+}
+
+bool WasmRevectorizer::CanReorderAccesses(Node* last,
+                                          const ZoneVector<Pack>& packs,
+                                          ZoneVector<Node*>* chain) {
+  ZoneUnorderedSet<Node*> accesses(zone_);
+  for (const Pack& pack : packs) {
+    if (!IsMemoryAccess(pack.low)) continue;
+    accesses.insert(pack.low);
+    accesses.insert(pack.high);
+  }
+  // Walk up the effect chain until all combined accesses are found.
+  Node* control = NodeProperties::GetControlInput(last);
+  size_t remaining = accesses.size();
+  for (Node* node = last;; node = NodeProperties::GetEffectInput(node)) {
+    if (chain->size() >= kMaxChainLength || !IsMemoryAccess(node) ||
+        NodeProperties::GetControlInput(node) != control ||
+        (node != last && !HasSingleEffectUse(node))) {
+      return false;
+    }
+    chain->push_back(node);
+    if (accesses.count(node) && --remaining == 0) break;
+  }
+  // Combined loads move up to the earlier load, combined stores move down to
+  // the later store. Compute the new position of every access on the chain,
+  // where a higher position is earlier in program order.
+  ZoneUnorderedMap<Node*, size_t> positions(zone_);
+  for (size_t i = 0; i < chain->size(); ++i) positions[chain->at(i)] = i;
+  ZoneVector<size_t> new_positions(chain->size(), zone_);
+  for (size_t i = 0; i < chain->size(); ++i) new_positions[i] = i;
+  for (const Pack& pack : packs) {
+    if (!IsMemoryAccess(pack.low)) continue;
+    size_t low = positions[pack.low];
+    size_t high = positions[pack.high];
+    size_t position = IsStore(pack.low) ? std::min(low, high)
+                                        : std::max(low, high);
+    new_positions[low] = new_positions[high] = position;
+  }
+  for (size_t i = 0; i < chain->size(); ++i) {
+    for (size_t j = i + 1; j < chain->size(); ++j) {
+      if (new_positions[i] <= new_positions[j]) continue;
+      Node* a = chain->at(i);
+      Node* b = chain->at(j);
+      if ((IsStore(a) || IsStore(b)) && MayAlias(a, b)) {
+        TRACE("[cannot reorder #%d and #%d]\n", a->id(), b->id());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void WasmRevectorizer::Combine(const ZoneVector<Pack>& packs,
+                               const ZoneVector<Node*>& chain) {
+  MachineOperatorBuilder* machine = mcgraph_->machine();
+  Graph* graph = mcgraph_->graph();
+  ZoneUnorderedMap<Node*, size_t> positions(zone_);
+  for (size_t i = 0; i < chain.size(); ++i) positions[chain[i]] = i;
+
+  // Build the combined nodes. Accesses on the effect chain are mapped to
+  // their combined node if they are replaced by it, or to nullptr if they are
+  // removed.
+  ZoneUnorderedMap<Node*, Node*> combined(zone_);
+  ZoneUnorderedMap<Node*, Node*> replacements(zone_);
+  Node* dummy_effect = graph->start();
+  for (const Pack& pack : packs) {
+    Node* low = pack.low;
+    Node* node;
+    if (IsMemoryAccess(low)) {
+      const bool is_protected = low->opcode() == IrOpcode::kProtectedLoad ||
+                                low->opcode() == IrOpcode::kProtectedStore;
+      Node* control = NodeProperties::GetControlInput(low);
+      if (IsStore(low)) {
+        const Operator* op =
+            is_protected
+                ? machine->ProtectedStore(MachineRepresentation::kSimd256)
+                : machine->Store(StoreRepresentation(
+                      MachineRepresentation::kSimd256, kNoWriteBarrier));
+        node = graph->NewNode(op, low->InputAt(0), low->InputAt(1),
+                              combined[low->InputAt(2)], dummy_effect,
+                              control);
+      } else {
+        const Operator* op =
+            is_protected ? machine->ProtectedLoad(MachineType::Simd256())
+                         : machine->Load(MachineType::Simd256());
+        node = graph->NewNode(op, low->InputAt(0), low->InputAt(1),
+                              dummy_effect, control);
+      }
+      Node* earlier = positions[low] > positions[pack.high] ? low : pack.high;
+      Node* later = earlier == low ? pack.high : low;
+      if (IsStore(low)) {
+        replacements[earlier] = nullptr;
+        replacements[later] = node;
+      } else {
+        replacements[earlier] = node;
+        replacements[later] = nullptr;
+      }
+      // A trap of the combined access is attributed to the access which came
+      // first.
+      if (source_positions_) {
+        source_positions_->SetSourcePosition(
+            node, source_positions_->GetSourcePosition(earlier));
+      }
+    } else {
+      node = graph->NewNode(Simd256Operator(machine, low),
+                            combined[low->InputAt(0)],
+                            combined[low->InputAt(1)]);
+    }
+    combined[low] = node;
+  }
+
+  // Rebuild the effect chain in program order.
+  Node* effect = NodeProperties::GetEffectInput(chain.back());
+  for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+    Node* node = *it;
+    auto replacement = replacements.find(node);
+    if (replacement != replacements.end()) {
+      if (replacement->second == nullptr) continue;
+      node = replacement->second;
+    }
+    NodeProperties::ReplaceEffectInput(node, effect);
+    effect = node;
+  }
+  for (Edge edge : chain.front()->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect);
+  }
+
+  // The replaced nodes are only used by each other now.
+  for (const Pack& pack : packs) {
+    pack.low->NullAllInputs();
+    pack.high->NullAllInputs();
+  }
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
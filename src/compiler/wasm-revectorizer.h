@@ -0,0 +1,68 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_WASM_REVECTORIZER_H_
+#define V8_COMPILER_WASM_REVECTORIZER_H_
+
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class MachineGraph;
+class Node;
+class SourcePositionTable;
+
+// Combines two Simd128 stores to adjacent memory, together with the isomorphic
+// trees of binary operations and adjacent loads computing their values, into
+// one 256-bit store, operation tree and loads. This is only profitable on
+// targets with 256-bit vector registers (x64 with AVX2).
+// Current restrictions: All combined nodes need to have the same control, all
+// memory accesses between the combined ones need to be on a linear effect
+// chain, and none of them may alias an access which gets reordered.
+class WasmRevectorizer {
+ public:
+  WasmRevectorizer(Zone* zone, MachineGraph* mcgraph,
+                   SourcePositionTable* source_positions)
+      : zone_(zone), mcgraph_(mcgraph), source_positions_(source_positions) {}
+
+  // Returns the number of combined store pairs.
+  int Run();
+
+ private:
+  // Two isomorphic nodes, of which {low} computes or accesses the lower
+  // 128 bits of the combined value.
+  struct Pack {
+    Node* low;
+    Node* high;
+  };
+
+  // Tries to find a store which can be combined with {store}, and to combine
+  // both.
+  bool TryRevectorizeStore(Node* store);
+  // Collects the packs of the value trees of {low} and {high} into {packs}, in
+  // post-order. Returns false if the trees cannot be combined.
+  bool CollectPacks(Node* low, Node* high, ZoneVector<Pack>* packs);
+  // Returns true if combining {packs} only reorders memory accesses on the
+  // effect chain which cannot alias. Stores the accesses from {last} up to
+  // the first combined one into {chain}, in reverse program order.
+  bool CanReorderAccesses(Node* last, const ZoneVector<Pack>& packs,
+                          ZoneVector<Node*>* chain);
+  void Combine(const ZoneVector<Pack>& packs, const ZoneVector<Node*>& chain);
+
+  Zone* const zone_;
+  MachineGraph* const mcgraph_;
+  SourcePositionTable* const source_positions_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_WASM_REVECTORIZER_H_
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "src/common/globals.h"
+#include "src/zone/accounting-allocator.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -82,6 +83,12 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
 
+  // Statistics of the segment pool of the allocator, which is shared with
+  // other compilation jobs.
+  AccountingAllocator::SegmentPoolStats GetSegmentPoolStats() const {
+    return allocator_->GetSegmentPoolStats();
+  }
+
  private:
   Zone* NewEmptyZone(const char* zone_name, bool support_zone_compression);
   void ReturnZone(Zone* zone);
@@ -276,6 +276,25 @@ class FastCApiObject {
   template <typename T>
   static const FastApiTypedArray<T>* AnyCTypeToTypedArray(AnyCType arg);
 
+  template <>
+  const FastApiTypedArray<int8_t>* AnyCTypeToTypedArray<int8_t>(AnyCType arg) {
+    return arg.int8_ta_value;
+  }
+  template <>
+  const FastApiTypedArray<uint8_t>* AnyCTypeToTypedArray<uint8_t>(
+      AnyCType arg) {
+    return arg.uint8_ta_value;
+  }
+  template <>
+  const FastApiTypedArray<int16_t>* AnyCTypeToTypedArray<int16_t>(
+      AnyCType arg) {
+    return arg.int16_ta_value;
+  }
+  template <>
+  const FastApiTypedArray<uint16_t>* AnyCTypeToTypedArray<uint16_t>(
+      AnyCType arg) {
+    return arg.uint16_ta_value;
+  }
   template <>
   const FastApiTypedArray<int32_t>* AnyCTypeToTypedArray<int32_t>(
       AnyCType arg) {
@@ -367,12 +386,22 @@ class FastCApiObject {
     size_t length = typed_array_arg->Length();
 
     void* data = typed_array_arg->Buffer()->GetBackingStore()->Data();
-    if (typed_array_arg->IsInt32Array() || typed_array_arg->IsUint32Array() ||
+    if (typed_array_arg->IsInt8Array() || typed_array_arg->IsUint8Array() ||
+        typed_array_arg->IsInt16Array() || typed_array_arg->IsUint16Array() ||
+        typed_array_arg->IsInt32Array() || typed_array_arg->IsUint32Array() ||
         typed_array_arg->IsBigInt64Array() ||
         typed_array_arg->IsBigUint64Array()) {
       int64_t sum = 0;
       for (unsigned i = 0; i < length; ++i) {
-        if (typed_array_arg->IsInt32Array()) {
+        if (typed_array_arg->IsInt8Array()) {
+          sum += static_cast<int8_t*>(data)[i];
+        } else if (typed_array_arg->IsUint8Array()) {
+          sum += static_cast<uint8_t*>(data)[i];
+        } else if (typed_array_arg->IsInt16Array()) {
+          sum += static_cast<int16_t*>(data)[i];
+        } else if (typed_array_arg->IsUint16Array()) {
+          sum += static_cast<uint16_t*>(data)[i];
+        } else if (typed_array_arg->IsInt32Array()) {
           sum += static_cast<int32_t*>(data)[i];
         } else if (typed_array_arg->IsUint32Array()) {
           sum += static_cast<uint32_t*>(data)[i];
@@ -400,6 +429,160 @@ class FastCApiObject {
     }
   }
 
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType AddAllDoubleArrayFastCallbackPatch(AnyCType receiver,
+                                                     AnyCType should_fallback,
+                                                     AnyCType array_arg,
+                                                     AnyCType options) {
+    AnyCType ret;
+#ifdef V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
+    ret.double_value = AddAllDoubleArrayFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *array_arg.double_array_value, *options.options_value);
+#else
+    ret.int32_value = AddAllDoubleArrayFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *array_arg.double_array_value, *options.options_value);
+#endif  // V8_ENABLE_FP_PARAMS_IN_C_LINKAGE
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static Type AddAllDoubleArrayFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastApiArray<double>& array_arg, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return 0;
+    }
+
+    double sum = 0;
+    for (size_t i = 0; i < array_arg.length(); ++i) {
+      sum += array_arg.get(i);
+    }
+    return static_cast<Type>(sum);
+  }
+  static void AddAllDoubleArraySlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 2) {
+      isolate->ThrowError("This method expects at least 2 arguments.");
+      return;
+    }
+    if (!args[1]->IsArray()) {
+      isolate->ThrowError("This method expects an array as a second argument.");
+      return;
+    }
+
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Array> array_arg = args[1].As<Array>();
+    double sum = 0;
+    for (uint32_t i = 0; i < array_arg->Length(); ++i) {
+      Local<Value> element = array_arg->Get(context, i).ToLocalChecked();
+      if (element->IsNumber()) {
+        sum += element.As<Number>()->Value();
+      } else if (!element->IsUndefined()) {
+        // Holes are ignored, like in add_all_sequence.
+        isolate->ThrowError("unexpected element type in JSArray");
+        return;
+      }
+    }
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType AddAllOneByteCharCodesFastCallbackPatch(
+      AnyCType receiver, AnyCType should_fallback, AnyCType string_arg,
+      AnyCType options) {
+    AnyCType ret;
+    ret.int32_value = AddAllOneByteCharCodesFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *string_arg.one_byte_string_value, *options.options_value);
+    return ret;
+  }
+  static AnyCType AddAllTwoByteCharCodesFastCallbackPatch(
+      AnyCType receiver, AnyCType should_fallback, AnyCType string_arg,
+      AnyCType options) {
+    AnyCType ret;
+    ret.int32_value = AddAllTwoByteCharCodesFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *string_arg.two_byte_string_value, *options.options_value);
+    return ret;
+  }
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static int32_t AddAllOneByteCharCodesFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastOneByteString& string_arg, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return 0;
+    }
+
+    int32_t sum = 0;
+    for (uint32_t i = 0; i < string_arg.length; ++i) {
+      sum += static_cast<uint8_t>(string_arg.data[i]);
+    }
+    return sum;
+  }
+  static int32_t AddAllTwoByteCharCodesFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastTwoByteString& string_arg, FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    CHECK_SELF_OR_FALLBACK(0);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+      return 0;
+    }
+
+    int32_t sum = 0;
+    for (uint32_t i = 0; i < string_arg.length; ++i) {
+      sum += string_arg.data[i];
+    }
+    return sum;
+  }
+  static void AddAllCharCodesSlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+
+    if (args.Length() < 2) {
+      isolate->ThrowError("This method expects at least 2 arguments.");
+      return;
+    }
+    if (!args[1]->IsString()) {
+      isolate->ThrowError("This method expects a string as a second argument.");
+      return;
+    }
+
+    String::Value string_arg(isolate, args[1]);
+    int32_t sum = 0;
+    for (int i = 0; i < string_arg.length(); ++i) {
+      sum += (*string_arg)[i];
+    }
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
   static int32_t AddAllIntInvalidCallback(Local<Object> receiver,
                                           bool should_fallback, int32_t arg_i32,
                                           FastApiCallbackOptions& options) {
@@ -781,6 +964,83 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             SideEffectType::kHasSideEffect,
             &add_all_float64_typed_array_c_func));
 
+    CFunction add_all_int8_typed_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllTypedArrayFastCallback<int8_t>
+            V8_IF_USE_SIMULATOR(
+                FastCApiObject::AddAllTypedArrayFastCallbackPatch<int8_t>));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_int8_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_int8_typed_array_c_func));
+
+    CFunction add_all_uint8_typed_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllTypedArrayFastCallback<uint8_t>
+            V8_IF_USE_SIMULATOR(
+                FastCApiObject::AddAllTypedArrayFastCallbackPatch<uint8_t>));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_uint8_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_uint8_typed_array_c_func));
+
+    CFunction add_all_int16_typed_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllTypedArrayFastCallback<int16_t>
+            V8_IF_USE_SIMULATOR(
+                FastCApiObject::AddAllTypedArrayFastCallbackPatch<int16_t>));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_int16_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_int16_typed_array_c_func));
+
+    CFunction add_all_uint16_typed_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllTypedArrayFastCallback<uint16_t>
+            V8_IF_USE_SIMULATOR(
+                FastCApiObject::AddAllTypedArrayFastCallbackPatch<uint16_t>));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_uint16_typed_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllTypedArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect,
+            &add_all_uint16_typed_array_c_func));
+
+    CFunction add_all_double_array_c_func = CFunction::Make(
+        FastCApiObject::AddAllDoubleArrayFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddAllDoubleArrayFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_double_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllDoubleArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_double_array_c_func));
+
+    CFunction add_all_one_byte_char_codes_c_func = CFunction::Make(
+        FastCApiObject::AddAllOneByteCharCodesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddAllOneByteCharCodesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_one_byte_char_codes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllCharCodesSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect,
+            &add_all_one_byte_char_codes_c_func));
+
+    CFunction add_all_two_byte_char_codes_c_func = CFunction::Make(
+        FastCApiObject::AddAllTwoByteCharCodesFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::AddAllTwoByteCharCodesFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_two_byte_char_codes",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllCharCodesSlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect,
+            &add_all_two_byte_char_codes_c_func));
+
     const CFunction add_all_overloads[] = {
         add_all_uint32_typed_array_c_func,
         add_all_seq_c_func,
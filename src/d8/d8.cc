@@ -34,6 +34,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/cpu.h"
 #include "src/base/logging.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
@@ -625,6 +626,17 @@ template <class T>
 MaybeLocal<T> Shell::CompileString(Isolate* isolate, Local<Context> context,
                                    Local<String> source,
                                    const ScriptOrigin& origin) {
+  base::ElapsedTimer timer;
+  timer.Start();
+  MaybeLocal<T> result = CompileStringImpl<T>(isolate, context, source, origin);
+  PerIsolateData::Get(isolate)->AddCompileTime(timer.Elapsed());
+  return result;
+}
+
+template <class T>
+MaybeLocal<T> Shell::CompileStringImpl(Isolate* isolate, Local<Context> context,
+                                       Local<String> source,
+                                       const ScriptOrigin& origin) {
   if (options.streaming_compile) {
     v8::ScriptCompiler::StreamedSource streamed_source(
         std::make_unique<DummySourceStream>(source),
@@ -4652,6 +4664,22 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--numa-affinity") == 0) {
+      // Bind worker threads and the heap to the NUMA node of the main thread.
+      options.numa_affinity = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--numa-node=", 12) == 0) {
+      // Bind worker threads and the heap to the given NUMA node.
+      options.numa_affinity = true;
+      options.numa_node = atoi(argv[i] + 12);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--serializer-out-of-band-threshold=", 35) ==
+               0) {
+      // Pass ArrayBuffer and string contents of at least this many bytes to
+      // workers without copying them into the message.
+      options.serializer_out_of_band_threshold =
+          static_cast<size_t>(strtoull(argv[i] + 35, nullptr, 10));
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -4681,6 +4709,15 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--repeat-compile=", 17) == 0) {
       options.repeat_compile = atoi(argv[i] + 17);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-isolates=", 17) == 0) {
+      options.bench_isolates = atoi(argv[i] + 17);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-iterations=", 19) == 0) {
+      options.bench_iterations = atoi(argv[i] + 19);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-warmup=", 15) == 0) {
+      options.bench_warmup = atoi(argv[i] + 15);
+      argv[i] = nullptr;
 #ifdef V8_FUZZILLI
     } else if (strcmp(argv[i], "--no-fuzzilli-enable-builtins-coverage") == 0) {
       options.fuzzilli_enable_builtins_coverage = false;
@@ -4875,6 +4912,162 @@ void Shell::SetWaitUntilDone(Isolate* isolate, bool value) {
   isolate_status_[isolate] = value;
 }
 
+namespace {
+
+// Runs the first source group in a fresh context of its own isolate, once per
+// warmup and measured iteration, and records the statistics of the measured
+// ones.
+class BenchmarkThread : public base::Thread {
+ public:
+  struct Sample {
+    base::TimeDelta latency;
+    base::TimeDelta gc_time;
+    base::TimeDelta compile_time;
+  };
+
+  // The thread sets up its isolate, then waits for {start} to be signaled.
+  explicit BenchmarkThread(base::Semaphore* start)
+      : base::Thread(GetThreadOptions("BenchmarkThread")), start_(start) {}
+
+  void Run() override;
+
+  const std::vector<Sample>& samples() const { return samples_; }
+  bool success() const { return success_; }
+
+ private:
+  static void GCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    static_cast<BenchmarkThread*>(data)->gc_timer_.Start();
+  }
+  static void GCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    BenchmarkThread* thread = static_cast<BenchmarkThread*>(data);
+    if (!thread->gc_timer_.IsStarted()) return;
+    thread->gc_time_ += thread->gc_timer_.Elapsed();
+    thread->gc_timer_.Stop();
+  }
+
+  base::Semaphore* const start_;
+  std::vector<Sample> samples_;
+  bool success_ = true;
+  base::ElapsedTimer gc_timer_;
+  base::TimeDelta gc_time_;
+};
+
+void BenchmarkThread::Run() {
+  Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+  create_params.experimental_attach_to_shared_isolate = Shell::shared_isolate;
+  Isolate* isolate = Isolate::New(create_params);
+  Shell::SetWaitUntilDone(isolate, false);
+  D8Console console(isolate);
+  Shell::Initialize(isolate, &console, false);
+  isolate->AddGCPrologueCallback(GCPrologue, this);
+  isolate->AddGCEpilogueCallback(GCEpilogue, this);
+
+  {
+    i::ParkedScope parked_scope(
+        reinterpret_cast<i::Isolate*>(isolate)->main_thread_local_isolate());
+    start_->Wait();
+  }
+  const int warmup = Shell::options.bench_warmup;
+  const int iterations = Shell::options.bench_iterations;
+  for (int i = 0; i < warmup + iterations && success_; ++i) {
+    Isolate::Scope iscope(isolate);
+    PerIsolateData data(isolate);
+    gc_time_ = base::TimeDelta();
+    base::ElapsedTimer timer;
+    timer.Start();
+    {
+      HandleScope scope(isolate);
+      Local<Context> context = Shell::CreateEvaluationContext(isolate);
+      Context::Scope cscope(context);
+      PerIsolateData::RealmScope realm_scope(&data);
+      if (!Shell::options.isolate_sources[0].Execute(isolate)) success_ = false;
+      if (!Shell::CompleteMessageLoop(isolate)) success_ = false;
+    }
+    base::TimeDelta latency = timer.Elapsed();
+    if (i < warmup) continue;
+    samples_.push_back({latency, gc_time_, data.compile_time()});
+  }
+
+  isolate->RemoveGCPrologueCallback(GCPrologue, this);
+  isolate->RemoveGCEpilogueCallback(GCEpilogue, this);
+  isolate->Dispose();
+}
+
+void PrintBenchmarkDistribution(const char* name,
+                                std::vector<base::TimeDelta> values) {
+  if (values.empty()) return;
+  std::sort(values.begin(), values.end());
+  auto percentile = [&values](size_t p) {
+    return values[std::min(values.size() - 1, values.size() * p / 100)]
+        .InMillisecondsF();
+  };
+  base::TimeDelta sum;
+  for (base::TimeDelta value : values) sum += value;
+  printf("%-8s (ms): min %.3f, median %.3f, p90 %.3f, p99 %.3f, max %.3f, "
+         "mean %.3f\n",
+         name, values.front().InMillisecondsF(), percentile(50),
+         percentile(90), percentile(99), values.back().InMillisecondsF(),
+         sum.InMillisecondsF() / values.size());
+}
+
+}  // namespace
+
+int Shell::RunBenchmark(Isolate* isolate) {
+  const int num_isolates = options.bench_isolates;
+  if (options.bench_iterations < 1 || options.bench_warmup < 0) {
+    printf("--bench-iterations must be positive and --bench-warmup must not "
+           "be negative\n");
+    return 1;
+  }
+  base::Semaphore start(0);
+  std::vector<std::unique_ptr<BenchmarkThread>> threads;
+  for (int i = 0; i < num_isolates; ++i) {
+    threads.push_back(std::make_unique<BenchmarkThread>(&start));
+    CHECK(threads.back()->Start());
+  }
+
+  base::ElapsedTimer timer;
+  {
+    // Park the main thread while waiting, in case the isolates perform a
+    // shared GC.
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    i::ParkedScope parked(i_isolate->main_thread_local_isolate());
+    timer.Start();
+    for (int i = 0; i < num_isolates; ++i) start.Signal();
+    for (auto& thread : threads) thread->Join();
+  }
+  base::TimeDelta wall_time = timer.Elapsed();
+
+  bool success = true;
+  std::vector<base::TimeDelta> latencies;
+  std::vector<base::TimeDelta> gc_times;
+  std::vector<base::TimeDelta> compile_times;
+  for (auto& thread : threads) {
+    if (!thread->success()) success = false;
+    for (const BenchmarkThread::Sample& sample : thread->samples()) {
+      latencies.push_back(sample.latency);
+      gc_times.push_back(sample.gc_time);
+      compile_times.push_back(sample.compile_time);
+    }
+  }
+  printf("Benchmark: %d isolate(s) x %d iteration(s), %d warmup\n",
+         num_isolates, options.bench_iterations.get(),
+         options.bench_warmup.get());
+  PrintBenchmarkDistribution("latency", latencies);
+  PrintBenchmarkDistribution("gc", gc_times);
+  PrintBenchmarkDistribution("compile", compile_times);
+  printf("Wall time (ms): %.3f, throughput: %.2f iterations/s\n",
+         wall_time.InMillisecondsF(),
+         latencies.size() / wall_time.InSecondsF());
+
+  WaitForRunningWorkers();
+  if (Shell::options.no_fail) return 0;
+  return (success == Shell::options.expected_to_throw ? 1 : 0);
+}
+
 void Shell::NotifyStartStreamingTask(Isolate* isolate) {
   DCHECK(options.streaming_compile);
   base::MutexGuard guard(isolate_status_lock_.Pointer());
@@ -4996,7 +5189,12 @@ class Serializer : public ValueSerializer::Delegate {
   explicit Serializer(Isolate* isolate)
       : isolate_(isolate),
         serializer_(isolate, this),
-        current_memory_usage_(0) {}
+        current_memory_usage_(0) {
+    if (Shell::options.serializer_out_of_band_threshold > 0) {
+      serializer_.SetOutOfBandThreshold(
+          Shell::options.serializer_out_of_band_threshold);
+    }
+  }
 
   Serializer(const Serializer&) = delete;
   Serializer& operator=(const Serializer&) = delete;
@@ -5071,6 +5269,14 @@ class Serializer : public ValueSerializer::Delegate {
     return Just<uint32_t>(static_cast<uint32_t>(index));
   }
 
+  Maybe<uint32_t> GetOutOfBandBackingStoreId(
+      Isolate* isolate, std::shared_ptr<BackingStore> backing_store) override {
+    DCHECK_NOT_NULL(data_);
+    size_t index = data_->out_of_band_backing_stores_.size();
+    data_->out_of_band_backing_stores_.push_back(std::move(backing_store));
+    return Just<uint32_t>(static_cast<uint32_t>(index));
+  }
+
   void* ReallocateBufferMemory(void* old_buffer, size_t size,
                                size_t* actual_size) override {
     // Not accurate, because we don't take into account reallocated buffers,
@@ -5245,6 +5451,13 @@ class Deserializer : public ValueDeserializer::Delegate {
     return MaybeLocal<Value>();
   }
 
+  std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+      Isolate* isolate, uint32_t id) override {
+    DCHECK_NOT_NULL(data_);
+    if (id >= data_->out_of_band_backing_stores().size()) return nullptr;
+    return data_->out_of_band_backing_stores().at(id);
+  }
+
  private:
   Isolate* isolate_;
   ValueDeserializer deserializer_;
@@ -5422,9 +5635,17 @@ int Shell::Main(int argc, char* argv[]) {
   }
 
   platform::tracing::TracingController* tracing_controller = tracing.get();
+  v8::platform::NumaAffinity numa_affinity =
+      v8::platform::NumaAffinity::kDisabled;
+  if (options.numa_affinity) {
+    numa_affinity = options.numa_node >= 0
+                        ? v8::platform::NumaAffinity::kFixedNode
+                        : v8::platform::NumaAffinity::kCurrentNode;
+  }
   g_platform = v8::platform::NewDefaultPlatform(
       options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
-      in_process_stack_dumping, std::move(tracing));
+      in_process_stack_dumping, std::move(tracing), numa_affinity,
+      options.numa_node);
   g_default_platform = g_platform.get();
   if (i::FLAG_predictable) {
     g_platform = MakePredictablePlatform(std::move(g_platform));
@@ -5626,6 +5847,8 @@ int Shell::Main(int argc, char* argv[]) {
         result = RunMain(isolate, true);
         options.compile_options.Overwrite(
             v8::ScriptCompiler::kNoCompileOptions);
+      } else if (options.bench_isolates > 0) {
+        result = RunBenchmark(isolate);
       } else {
         bool last_run = true;
         result = RunMain(isolate, last_run);
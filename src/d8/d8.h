@@ -148,6 +148,10 @@ class SerializationData {
   const std::vector<std::shared_ptr<v8::BackingStore>>& sab_backing_stores() {
     return sab_backing_stores_;
   }
+  const std::vector<std::shared_ptr<v8::BackingStore>>&
+  out_of_band_backing_stores() {
+    return out_of_band_backing_stores_;
+  }
   const std::vector<CompiledWasmModule>& compiled_wasm_modules() {
     return compiled_wasm_modules_;
   }
@@ -166,6 +170,7 @@ class SerializationData {
   size_t size_ = 0;
   std::vector<std::shared_ptr<v8::BackingStore>> backing_stores_;
   std::vector<std::shared_ptr<v8::BackingStore>> sab_backing_stores_;
+  std::vector<std::shared_ptr<v8::BackingStore>> out_of_band_backing_stores_;
   std::vector<CompiledWasmModule> compiled_wasm_modules_;
   std::vector<v8::Global<v8::Value>> shared_values_;
 
@@ -324,6 +329,10 @@ class PerIsolateData {
   Local<FunctionTemplate> GetSnapshotObjectCtor() const;
   void SetSnapshotObjectCtor(Local<FunctionTemplate> ctor);
 
+  // Time spent compiling scripts and modules in Shell::CompileString.
+  base::TimeDelta compile_time() const { return compile_time_; }
+  void AddCompileTime(base::TimeDelta delta) { compile_time_ += delta; }
+
  private:
   friend class Shell;
   friend class RealmScope;
@@ -338,6 +347,7 @@ class PerIsolateData {
   bool ignore_unhandled_promises_;
   std::vector<std::tuple<Global<Promise>, Global<Message>, Global<Value>>>
       unhandled_promises_;
+  base::TimeDelta compile_time_;
   AsyncHooks* async_hooks_wrapper_;
 #if defined(LEAK_SANITIZER)
   std::unordered_set<DynamicImportData*> import_data_;
@@ -452,6 +462,10 @@ class ShellOptions {
   DisallowReassignment<bool> enable_os_system = {"enable-os-system", false};
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<bool> numa_affinity = {"numa-affinity", false};
+  DisallowReassignment<int> numa_node = {"numa-node", -1};
+  DisallowReassignment<size_t> serializer_out_of_band_threshold = {
+      "serializer-out-of-band-threshold", 0};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
@@ -471,6 +485,9 @@ class ShellOptions {
   DisallowReassignment<bool> stress_deserialize = {"stress-deserialize", false};
   DisallowReassignment<bool> compile_only = {"compile-only", false};
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
+  DisallowReassignment<int> bench_isolates = {"bench-isolates", 0};
+  DisallowReassignment<int> bench_iterations = {"bench-iterations", 1};
+  DisallowReassignment<int> bench_warmup = {"bench-warmup", 0};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -507,6 +524,9 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  // Runs the first source group --bench-iterations times in each of
+  // --bench-isolates isolates on their own threads, and prints statistics.
+  static int RunBenchmark(Isolate* isolate);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
@@ -771,6 +791,11 @@ class Shell : public i::AllStatic {
   static MaybeLocal<T> CompileString(Isolate* isolate, Local<Context> context,
                                      Local<String> source,
                                      const ScriptOrigin& origin);
+  template <class T>
+  static MaybeLocal<T> CompileStringImpl(Isolate* isolate,
+                                         Local<Context> context,
+                                         Local<String> source,
+                                         const ScriptOrigin& origin);
 
   static ScriptCompiler::CachedData* LookupCodeCache(Isolate* isolate,
                                                      Local<Value> name);
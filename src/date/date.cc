@@ -4,6 +4,8 @@
 
 #include "src/date/date.h"
 
+#include <algorithm>
+
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -58,6 +60,10 @@ void DateCache::ResetDateCache(
     local_offset_ms_ = kInvalidLocalOffsetInMs;
 #ifdef V8_INTL_SUPPORT
   }
+#endif
+#ifdef V8_INTL_SUPPORT
+  transition_year_start_ms_.clear();
+  transition_years_.clear();
 #endif
   tz_cache_->Clear(time_zone_detection);
   tz_name_ = nullptr;
@@ -216,7 +222,13 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   double offset;
 #ifdef V8_INTL_SUPPORT
   if (FLAG_icu_timezone_data) {
-    offset = tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), is_utc);
+    int table_offset;
+    if (LookUpTransitionTable(time_ms, is_utc, &table_offset)) {
+      offset = table_offset;
+    } else {
+      offset =
+          tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), is_utc);
+    }
   } else {
 #endif
     // When ICU timezone data is not used, we need to compute the timezone
@@ -275,6 +287,92 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
+#ifdef V8_INTL_SUPPORT
+bool DateCache::LookUpTransitionTable(int64_t time_ms, bool is_utc,
+                                      int* offset_ms) {
+  if (transition_year_start_ms_.empty()) {
+    if (FLAG_date_cache_max_year < FLAG_date_cache_min_year) return false;
+    for (int year = FLAG_date_cache_min_year;
+         year <= FLAG_date_cache_max_year + 1; ++year) {
+      transition_year_start_ms_.push_back(DaysFromYearMonth(year, 0) *
+                                          kMsPerDay);
+    }
+    transition_years_.resize(transition_year_start_ms_.size() - 1);
+  }
+  if (time_ms < transition_year_start_ms_.front() ||
+      time_ms >= transition_year_start_ms_.back()) {
+    return false;
+  }
+  size_t year_index = std::upper_bound(transition_year_start_ms_.begin(),
+                                       transition_year_start_ms_.end(),
+                                       time_ms) -
+                      transition_year_start_ms_.begin() - 1;
+  // Local times within a day of the start or end of a year may belong to a
+  // UTC time in the neighbouring year, whose transitions are not looked at
+  // below.
+  if (!is_utc &&
+      (time_ms < transition_year_start_ms_[year_index] + kMsPerDay ||
+       time_ms >= transition_year_start_ms_[year_index + 1] - kMsPerDay)) {
+    return false;
+  }
+  TransitionYear& year = transition_years_[year_index];
+  if (!year.filled) FillTransitionYear(year_index);
+  auto it =
+      is_utc ? std::upper_bound(year.transitions.begin(),
+                                year.transitions.end(), time_ms,
+                                [](int64_t time_ms, const Transition& t) {
+                                  return time_ms < t.utc_ms;
+                                })
+             : std::upper_bound(year.transitions.begin(),
+                                year.transitions.end(), time_ms,
+                                [](int64_t time_ms, const Transition& t) {
+                                  return time_ms < t.local_ms;
+                                });
+  *offset_ms = it == year.transitions.begin() ? year.start_offset_ms
+                                              : (it - 1)->offset_ms;
+  return true;
+}
+
+void DateCache::FillTransitionYear(size_t year_index) {
+  TransitionYear& year = transition_years_[year_index];
+  DCHECK(!year.filled);
+  const int64_t kStrideMs = static_cast<int64_t>(kDefaultDSTDeltaInSec) * 1000;
+  int64_t start_ms = transition_year_start_ms_[year_index];
+  int64_t last_ms = transition_year_start_ms_[year_index + 1] - 1;
+  int offset_ms = GetUTCOffsetFromICU(start_ms);
+  year.start_offset_ms = offset_ms;
+  int64_t time_ms = start_ms;
+  while (time_ms < last_ms) {
+    int64_t next_ms = std::min(time_ms + kStrideMs, last_ms);
+    int next_offset_ms = GetUTCOffsetFromICU(next_ms);
+    // Find each change of the offset between time_ms and next_ms. This relies
+    // on the offset not changing back and forth within the stride.
+    while (next_offset_ms != offset_ms) {
+      int64_t low_ms = time_ms;
+      int64_t high_ms = next_ms;
+      int high_offset_ms = next_offset_ms;
+      while (high_ms - low_ms > 1) {
+        int64_t middle_ms = low_ms + (high_ms - low_ms) / 2;
+        int middle_offset_ms = GetUTCOffsetFromICU(middle_ms);
+        if (middle_offset_ms == offset_ms) {
+          low_ms = middle_ms;
+        } else {
+          high_ms = middle_ms;
+          high_offset_ms = middle_offset_ms;
+        }
+      }
+      year.transitions.push_back(
+          {high_ms, high_ms + std::max(offset_ms, high_offset_ms),
+           high_offset_ms});
+      time_ms = high_ms;
+      offset_ms = high_offset_ms;
+    }
+    time_ms = next_ms;
+  }
+  year.filled = true;
+}
+#endif  // V8_INTL_SUPPORT
+
 void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
   if (after_->offset_ms == offset_ms &&
       after_->start_sec - kDefaultDSTDeltaInSec <= time_sec &&
@@ -5,6 +5,8 @@
 #ifndef V8_DATE_DATE_H_
 #define V8_DATE_DATE_H_
 
+#include <vector>
+
 #include "src/base/small-vector.h"
 #include "src/base/timezone-cache.h"
 #include "src/common/globals.h"
@@ -213,6 +215,40 @@ class V8_EXPORT_PRIVATE DateCache {
     return segment->start_sec > segment->end_sec;
   }
 
+#ifdef V8_INTL_SUPPORT
+  // A change of the local offset at UTC time utc_ms. Local times from
+  // local_ms on map to offset_ms, earlier ones in the same year map to the
+  // offset of the previous transition. This matches the way ICU resolves
+  // skipped and repeated local times.
+  struct Transition {
+    int64_t utc_ms;
+    int64_t local_ms;
+    int offset_ms;
+  };
+
+  // The transitions of one year of the transition table, which are computed
+  // on the first lookup of a time in that year.
+  struct TransitionYear {
+    bool filled = false;
+    // The offset at the start of the year.
+    int start_offset_ms = 0;
+    std::vector<Transition> transitions;
+  };
+
+  // Looks up the offset of the given UTC or local time in the transition
+  // table. Returns false if the table does not cover the time.
+  bool LookUpTransitionTable(int64_t time_ms, bool is_utc, int* offset_ms);
+
+  // Computes the transitions of the given year of the transition table by
+  // sampling the offset every kDefaultDSTDeltaInSec and bisecting changes.
+  void FillTransitionYear(size_t year_index);
+
+  int GetUTCOffsetFromICU(int64_t time_ms) {
+    return static_cast<int>(
+        tz_cache_->LocalTimeOffset(static_cast<double>(time_ms), true));
+  }
+#endif  // V8_INTL_SUPPORT
+
   Smi stamp_;
 
   // Daylight Saving Time cache.
@@ -234,6 +270,14 @@ class V8_EXPORT_PRIVATE DateCache {
   const char* tz_name_;
   const char* dst_tz_name_;
 
+#ifdef V8_INTL_SUPPORT
+  // Transition table for the years given by --date-cache-min-year and
+  // --date-cache-max-year. transition_year_start_ms_ holds the start of each
+  // year, followed by the end of the last one.
+  std::vector<int64_t> transition_year_start_ms_;
+  std::vector<TransitionYear> transition_years_;
+#endif  // V8_INTL_SUPPORT
+
   base::TimezoneCache* tz_cache_;
 };
 
@@ -545,7 +545,7 @@ void CollectAndMaybeResetCounts(Isolate* isolate,
           count =
               static_cast<uint32_t>(func.feedback_vector().invocation_count());
         } else if (func.raw_feedback_cell().interrupt_budget() <
-                   FLAG_interrupt_budget_for_feedback_allocation) {
+                   TieringManager::InitialInterruptBudget(isolate)) {
           // TODO(jgruber): The condition above is no longer precise since we
           // may use either the fixed interrupt_budget or
           // FLAG_interrupt_budget_factor_for_feedback_allocation. If the
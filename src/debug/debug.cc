@@ -1500,8 +1500,9 @@ void Debug::DiscardAllBaselineCode() {
 void Debug::DeoptimizeFunction(Handle<SharedFunctionInfo> shared) {
   RCS_SCOPE(isolate_, RuntimeCallCounterId::kDebugger);
   // Deoptimize all code compiled from this shared function info including
-  // inlining.
-  isolate_->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  // inlining. Concurrent compile jobs are left running: jobs which optimize
+  // or inline the function are discarded when they are finalized, see
+  // Compiler::FinalizeTurbofanCompilationJob.
 
   if (shared->HasBaselineCode()) {
     DiscardBaselineCode(*shared);
@@ -1042,6 +1042,10 @@ void LiveEdit::PatchScript(Isolate* isolate, Handle<Script> script,
   // breaks the invariant that any JSFunction active on the stack is compiled.
   isolate->set_disable_bytecode_flushing(true);
 
+  // Patching moves functions between scripts and changes their positions,
+  // which compile jobs for them must not observe.
+  isolate->AbortConcurrentOptimization(BlockingBehavior::kBlock);
+
   std::map<int, int> start_position_to_unchanged_id;
   for (const auto& mapping : unchanged) {
     FunctionData* data = nullptr;
@@ -0,0 +1,112 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-history.h"
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+void DeoptHistory::RecordDeopt(SharedFunctionInfo function,
+                               SharedFunctionInfo shared,
+                               BytecodeOffset bytecode_offset,
+                               DeoptimizeReason reason) {
+  base::Optional<FunctionId> function_id = GetFunctionId(function);
+  if (function_id.has_value()) deopt_counts_[function_id.value()]++;
+
+  if (FLAG_deopt_loop_threshold <= 0 || bytecode_offset.IsNone()) return;
+  base::Optional<FunctionId> shared_id = GetFunctionId(shared);
+  if (!shared_id.has_value()) return;
+  SiteId site{shared_id.value(), bytecode_offset.ToInt()};
+  auto it = sites_.find(site);
+  if (it == sites_.end()) {
+    if (sites_.size() >= kMaxSites) return;
+    it = sites_.emplace(site, SiteEntry{reason, 0}).first;
+  }
+  SiteEntry& entry = it->second;
+  bool was_deopt_loop_site = IsDeoptLoopSite(entry);
+  if (entry.reason == reason) {
+    entry.count++;
+  } else {
+    // The speculation at this site failed in a different way, so start over.
+    entry.reason = reason;
+    entry.count = 1;
+  }
+  if (IsDeoptLoopSite(entry) != was_deopt_loop_site) {
+    deopt_loop_site_count_ += was_deopt_loop_site ? -1 : 1;
+  }
+}
+
+int DeoptHistory::DeoptCount(SharedFunctionInfo shared) const {
+  base::Optional<FunctionId> id = GetFunctionId(shared);
+  if (!id.has_value()) return 0;
+  auto it = deopt_counts_.find(id.value());
+  return it == deopt_counts_.end() ? 0 : it->second;
+}
+
+bool DeoptHistory::ReachedDeoptLimit(SharedFunctionInfo shared) const {
+  return FLAG_max_deopts_per_function > 0 &&
+         DeoptCount(shared) >= FLAG_max_deopts_per_function;
+}
+
+std::vector<DeoptLoopSite> DeoptHistory::FindDeoptLoopSites(
+    Isolate* isolate) const {
+  std::vector<DeoptLoopSite> result;
+  if (!HasDeoptLoopSites()) return result;
+
+  DisallowGarbageCollection no_gc;
+  std::map<int, Script> scripts;
+  for (const auto& site : sites_) {
+    if (IsDeoptLoopSite(site.second)) {
+      scripts.emplace(site.first.function.script_id, Script());
+    }
+  }
+  Script::Iterator iterator(isolate);
+  for (Script script = iterator.Next(); !script.is_null();
+       script = iterator.Next()) {
+    auto entry = scripts.find(script.id());
+    if (entry != scripts.end()) entry->second = script;
+  }
+  for (const auto& site : sites_) {
+    if (!IsDeoptLoopSite(site.second)) continue;
+    const FunctionId& function = site.first.function;
+    Script script = scripts[function.script_id];
+    if (script.is_null() ||
+        function.function_literal_id >= script.shared_function_info_count()) {
+      continue;
+    }
+    MaybeObject maybe_shared =
+        script.shared_function_infos().Get(function.function_literal_id);
+    HeapObject heap_object;
+    if (!maybe_shared->GetHeapObject(&heap_object) ||
+        !heap_object.IsSharedFunctionInfo()) {
+      continue;
+    }
+    result.push_back(
+        {handle(SharedFunctionInfo::cast(heap_object), isolate),
+         BytecodeOffset(site.first.bytecode_offset)});
+  }
+  return result;
+}
+
+// static
+base::Optional<DeoptHistory::FunctionId> DeoptHistory::GetFunctionId(
+    SharedFunctionInfo shared) {
+  if (!shared.script().IsScript()) return {};
+  int function_literal_id = shared.function_literal_id();
+  if (function_literal_id == kFunctionLiteralIdInvalid) return {};
+  return FunctionId{Script::cast(shared.script()).id(), function_literal_id};
+}
+
+bool DeoptHistory::IsDeoptLoopSite(const SiteEntry& entry) const {
+  return FLAG_deopt_loop_threshold > 0 &&
+         entry.count >= FLAG_deopt_loop_threshold;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+#define V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+
+#include <map>
+#include <vector>
+
+#include "src/base/optional.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/handles/handles.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+
+// A bytecode offset at which optimized code of a function repeatedly
+// deoptimized for the same reason.
+struct DeoptLoopSite {
+  Handle<SharedFunctionInfo> shared;
+  BytecodeOffset bytecode_offset;
+};
+
+// The deoptimizations of an isolate, so that later compilations can avoid the
+// speculation that failed before:
+//  - A bytecode offset that deoptimized --deopt-loop-threshold times in a row
+//    for the same reason is a deopt loop site. Turbofan doesn't specialize
+//    property accesses at such sites (see JSNativeContextSpecialization).
+//  - A function whose optimized code deoptimized --max-deopts-per-function
+//    times is no longer optimized by Turbofan (see TieringManager).
+//
+// Functions are identified by their script id and function literal id, so
+// that no heap objects need to be kept alive. Only used on the main thread.
+class V8_EXPORT_PRIVATE DeoptHistory final {
+ public:
+  DeoptHistory() = default;
+  DeoptHistory(const DeoptHistory&) = delete;
+  DeoptHistory& operator=(const DeoptHistory&) = delete;
+
+  // Records a deoptimization of the optimized code of {function} in its
+  // (possibly inlined) callee {shared} at {bytecode_offset}. Called by the
+  // Deoptimizer, so it doesn't allocate on the heap.
+  void RecordDeopt(SharedFunctionInfo function, SharedFunctionInfo shared,
+                   BytecodeOffset bytecode_offset, DeoptimizeReason reason);
+
+  // The number of times the optimized code of {shared} deoptimized.
+  int DeoptCount(SharedFunctionInfo shared) const;
+
+  // Whether {shared} reached --max-deopts-per-function.
+  bool ReachedDeoptLimit(SharedFunctionInfo shared) const;
+
+  bool HasDeoptLoopSites() const { return deopt_loop_site_count_ > 0; }
+
+  // Returns the deopt loop sites of functions that belong to currently loaded
+  // scripts.
+  std::vector<DeoptLoopSite> FindDeoptLoopSites(Isolate* isolate) const;
+
+ private:
+  struct FunctionId {
+    int script_id;
+    int function_literal_id;
+
+    bool operator<(const FunctionId& other) const {
+      if (script_id != other.script_id) return script_id < other.script_id;
+      return function_literal_id < other.function_literal_id;
+    }
+  };
+
+  struct SiteId {
+    FunctionId function;
+    int bytecode_offset;
+
+    bool operator<(const SiteId& other) const {
+      if (bytecode_offset != other.bytecode_offset) {
+        return bytecode_offset < other.bytecode_offset;
+      }
+      return function < other.function;
+    }
+  };
+
+  struct SiteEntry {
+    DeoptimizeReason reason;
+    int count;
+  };
+
+  // Bounds the memory used for sites, since every deopt point of every
+  // function could end up in the history.
+  static constexpr size_t kMaxSites = 1024;
+
+  // Returns nothing for functions without a script, e.g. API functions.
+  static base::Optional<FunctionId> GetFunctionId(SharedFunctionInfo shared);
+
+  bool IsDeoptLoopSite(const SiteEntry& entry) const;
+
+  std::map<FunctionId, int> deopt_counts_;
+  std::map<SiteId, SiteEntry> sites_;
+  int deopt_loop_site_count_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_HISTORY_H_
@@ -8,6 +8,7 @@
 #include "src/codegen/interface-descriptors.h"
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimized-frame-info.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/execution/frames-inl.h"
@@ -21,6 +22,7 @@
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-function-inl.h"
 #include "src/objects/oddball.h"
+#include "src/objects/osr-optimized-code-cache-inl.h"
 #include "src/snapshot/embedded/embedded-data.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -364,6 +366,10 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(NativeContext native_context) {
     element = next;
   }
 
+  // The OSR code cache must not hand out the marked code anymore.
+  OSROptimizedCodeCache::cast(native_context.osr_code_cache())
+      .EvictDeoptimizedCode(isolate);
+
   ActivationsFinder visitor(&codes, topmost_optimized_code,
                             safe_to_deopt_topmost_optimized_code);
   // Iterate over the stack of this thread.
@@ -758,6 +764,27 @@ void Deoptimizer::TraceDeoptMarked(Isolate* isolate) {
 
 // We rely on this function not causing a GC.  It is called from generated code
 // without having a real stack frame in place.
+void Deoptimizer::RecordDeoptHistory() {
+  SharedFunctionInfo shared = function_.shared();
+  BytecodeOffset bytecode_offset = BytecodeOffset::None();
+  DeoptimizeReason reason = DeoptimizeReason::kUnknown;
+  // Only eager deopts are attributed to a site, lazy deopts are caused by
+  // changes outside of the optimized code.
+  if (deopt_kind_ == DeoptimizeKind::kEager && FLAG_deopt_loop_threshold > 0) {
+    // The innermost unoptimized frame contains the failed check.
+    for (auto it = translated_state_.frames().rbegin();
+         it != translated_state_.frames().rend(); ++it) {
+      if (it->kind() != TranslatedFrame::kUnoptimizedFunction) continue;
+      shared = it->raw_shared_info();
+      bytecode_offset = it->bytecode_offset();
+      break;
+    }
+    reason = GetDeoptInfo(compiled_code_, from_).deopt_reason;
+  }
+  isolate()->deopt_history()->RecordDeopt(function_.shared(), shared,
+                                          bytecode_offset, reason);
+}
+
 void Deoptimizer::DoComputeOutputFrames() {
   // When we call this function, the return address of the previous frame has
   // been removed from the stack by the DeoptimizationEntry builtin, so the
@@ -824,6 +851,8 @@ void Deoptimizer::DoComputeOutputFrames() {
   bytecode_offset_in_outermost_frame_ =
       translated_state_.frames()[0].bytecode_offset();
 
+  if (function_.IsJSFunction()) RecordDeoptHistory();
+
   // Do the input frame to output frame(s) translation.
   size_t count = translated_state_.frames().size();
   // If we are supposed to go to the catch handler, find the catching frame
@@ -4,8 +4,12 @@
 
 #include "src/deoptimizer/translation-array.h"
 
+#include "src/base/functional.h"
 #include "src/base/vlq.h"
 #include "src/deoptimizer/translated-state.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate-inl.h"
+#include "src/heap/local-factory-inl.h"
 #include "src/objects/fixed-array-inl.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
 
@@ -64,6 +68,33 @@ bool TranslationArrayIterator::HasNext() const {
   }
 }
 
+int TranslationArrayBuilder::FinishTranslation(int start_index) {
+  if (!FLAG_turbo_share_translations) return start_index;
+  const int length = Size() - start_index;
+  DCHECK_LT(0, length);
+  auto finish = [&](auto& contents) {
+    auto begin = contents.begin() + start_index;
+    size_t hash = base::hash_range(begin, contents.end());
+    auto it = translations_by_hash_.find(hash);
+    if (it == translations_by_hash_.end()) {
+      translations_by_hash_.emplace(hash,
+                                    TranslationRange{start_index, length});
+      return start_index;
+    }
+    const TranslationRange& existing = it->second;
+    if (existing.length != length ||
+        !std::equal(begin, contents.end(),
+                    contents.begin() + existing.start)) {
+      return start_index;
+    }
+    contents.resize(start_index);
+    return existing.start;
+  };
+  return V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)
+             ? finish(contents_for_compression_)
+             : finish(contents_);
+}
+
 void TranslationArrayBuilder::Add(int32_t value) {
   if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
     contents_for_compression_.push_back(value);
@@ -72,8 +103,9 @@ void TranslationArrayBuilder::Add(int32_t value) {
   }
 }
 
+template <typename IsolateT>
 Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
-    Factory* factory) {
+    IsolateT* isolate) {
   if (V8_UNLIKELY(FLAG_turbo_compress_translation_arrays)) {
     const int input_size = SizeInBytes();
     uLongf compressed_data_size = compressBound(input_size);
@@ -89,8 +121,8 @@ Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
 
     const int translation_array_size =
         static_cast<int>(compressed_data_size) + kUncompressedSizeSize;
-    Handle<TranslationArray> result =
-        factory->NewByteArray(translation_array_size, AllocationType::kOld);
+    Handle<TranslationArray> result = isolate->factory()->NewByteArray(
+        translation_array_size, AllocationType::kOld);
 
     result->set_int(kUncompressedSizeOffset, Size());
     std::memcpy(result->GetDataStartAddress() + kCompressedDataOffset,
@@ -98,14 +130,19 @@ Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
 
     return result;
   } else {
-    Handle<TranslationArray> result =
-        factory->NewByteArray(SizeInBytes(), AllocationType::kOld);
+    Handle<TranslationArray> result = isolate->factory()->NewByteArray(
+        SizeInBytes(), AllocationType::kOld);
     memcpy(result->GetDataStartAddress(), contents_.data(),
            contents_.size() * sizeof(uint8_t));
     return result;
   }
 }
 
+template Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
+    Isolate* isolate);
+template Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
+    LocalIsolate* isolate);
+
 void TranslationArrayBuilder::BeginBuiltinContinuationFrame(
     BytecodeOffset bytecode_offset, int literal_id, unsigned height) {
   auto opcode = TranslationOpcode::BUILTIN_CONTINUATION_FRAME;
@@ -47,9 +47,13 @@ class TranslationArrayIterator {
 class TranslationArrayBuilder {
  public:
   explicit TranslationArrayBuilder(Zone* zone)
-      : contents_(zone), contents_for_compression_(zone), zone_(zone) {}
+      : contents_(zone),
+        contents_for_compression_(zone),
+        translations_by_hash_(zone),
+        zone_(zone) {}
 
-  Handle<TranslationArray> ToTranslationArray(Factory* factory);
+  template <typename IsolateT>
+  Handle<TranslationArray> ToTranslationArray(IsolateT* isolate);
 
   int BeginTranslation(int frame_count, int jsframe_count,
                        int update_feedback_count) {
@@ -63,6 +67,12 @@ class TranslationArrayBuilder {
     return start_index;
   }
 
+  // Ends the translation which started at {start_index}. If an identical
+  // translation was added before, the new one is dropped and the index of the
+  // existing one is returned, so that deopt exits with the same frame state
+  // and operand locations share their translation.
+  int FinishTranslation(int start_index);
+
   void BeginInterpretedFrame(BytecodeOffset bytecode_offset, int literal_id,
                              unsigned height, int return_value_offset,
                              int return_value_count);
@@ -119,8 +129,15 @@ class TranslationArrayBuilder {
 
   Zone* zone() const { return zone_; }
 
+  struct TranslationRange {
+    int start;
+    int length;
+  };
+
   ZoneVector<uint8_t> contents_;
   ZoneVector<int32_t> contents_for_compression_;
+  // Finished translations by the hash of their contents.
+  ZoneUnorderedMap<size_t, TranslationRange> translations_by_hash_;
   Zone* const zone_;
 };
 
@@ -46,6 +46,25 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.Accumulate(stats);
 }
 
+void CompilationStatistics::RecordRegisterAllocator(const char* allocator,
+                                                    const char* reason) {
+  base::MutexGuard guard(&record_mutex_);
+  register_allocator_map_[std::string(allocator) + " (" + reason + ")"]++;
+}
+
+void CompilationStatistics::RecordSkippedPhase(const char* phase_name) {
+  base::MutexGuard guard(&record_mutex_);
+  skipped_phase_map_[phase_name]++;
+}
+
+void CompilationStatistics::RecordGraphSize(size_t node_count,
+                                            size_t graph_zone_bytes) {
+  base::MutexGuard guard(&record_mutex_);
+  graph_count_++;
+  graph_node_count_ += node_count;
+  graph_zone_bytes_ += graph_zone_bytes;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -110,6 +129,21 @@ static void WriteLine(std::ostream& os, bool machine_format, const char* name,
   }
 }
 
+static void WriteCountLine(std::ostream& os, bool machine_format,
+                           const char* prefix, const char* name,
+                           size_t count) {
+  const size_t kBufferSize = 128;
+  char buffer[kBufferSize];
+  if (machine_format) {
+    base::OS::SNPrintF(buffer, kBufferSize, "\n\"%s %s\"=%zu", prefix, name,
+                       count);
+    os << buffer;
+  } else {
+    base::OS::SNPrintF(buffer, kBufferSize, "%34s %20zu", name, count);
+    os << buffer << std::endl;
+  }
+}
+
 static void WriteFullLine(std::ostream& os) {
   os << "-----------------------------------------------------------"
         "-----------------------------------------------------------\n";
@@ -171,6 +205,51 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  if (!s.register_allocator_map_.empty()) {
+    if (!ps.machine_output) {
+      os << std::endl;
+      WriteFullLine(os);
+      os << "                Register allocator            Functions\n";
+      WriteFullLine(os);
+    }
+    for (const auto& it : s.register_allocator_map_) {
+      WriteCountLine(os, ps.machine_output, "regalloc", it.first.c_str(),
+                     it.second);
+    }
+  }
+
+  if (!s.skipped_phase_map_.empty()) {
+    if (!ps.machine_output) {
+      os << std::endl;
+      WriteFullLine(os);
+      os << "                Skipped phase (over budget)   Functions\n";
+      WriteFullLine(os);
+    }
+    for (const auto& it : s.skipped_phase_map_) {
+      WriteCountLine(os, ps.machine_output, "skipped", it.first.c_str(),
+                     it.second);
+    }
+  }
+
+  if (s.graph_count_ > 0) {
+    if (!ps.machine_output) {
+      os << std::endl;
+      WriteFullLine(os);
+      os << "                Scheduled graphs                 Total
+";
+      WriteFullLine(os);
+    }
+    WriteCountLine(os, ps.machine_output, "graph", "graphs", s.graph_count_);
+    WriteCountLine(os, ps.machine_output, "graph", "nodes",
+                   s.graph_node_count_);
+    WriteCountLine(os, ps.machine_output, "graph", "graph zone bytes",
+                   s.graph_zone_bytes_);
+    if (s.graph_node_count_ > 0) {
+      WriteCountLine(os, ps.machine_output, "graph", "bytes per node",
+                     s.graph_zone_bytes_ / s.graph_node_count_);
+    }
+  }
+
   return os;
 }
 
@@ -54,6 +54,16 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Counts the functions for which the register allocator {allocator} was
+  // chosen for the reason {reason}.
+  void RecordRegisterAllocator(const char* allocator, const char* reason);
+  // Counts the functions for which the phase {phase_name} was skipped because
+  // the compile budget was exhausted.
+  void RecordSkippedPhase(const char* phase_name);
+  // Adds the number of nodes and the size of the graph zone of a scheduled
+  // graph, to relate the graph memory to the number of nodes.
+  void RecordGraphSize(size_t node_count, size_t graph_zone_bytes);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -84,6 +94,11 @@ class CompilationStatistics final : public Malloced {
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  std::map<std::string, size_t> register_allocator_map_;
+  std::map<std::string, size_t> skipped_phase_map_;
+  size_t graph_count_ = 0;
+  size_t graph_node_count_ = 0;
+  size_t graph_zone_bytes_ = 0;
   base::Mutex record_mutex_;
 };
 
@@ -36,9 +36,19 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <deque>
 #include <memory>
-
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/platform/wrappers.h"
+#include "src/baseline/bytecode-offset-iterator.h"
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
@@ -119,14 +129,210 @@ const int LinuxPerfJitLogger::kFilenameBufferPadding = 16;
 static const char kStringTerminator[] = {'\0'};
 static const char kRepeatedNameMarker[] = {'\xff', '\0'};
 
+namespace {
+
+uint64_t GetTimestamp() {
+  struct timespec ts;
+  int result = clock_gettime(CLOCK_MONOTONIC, &ts);
+  DCHECK_EQ(0, result);
+  USE(result);
+  static const uint64_t kNsecPerSec = 1000000000;
+  return (ts.tv_sec * kNsecPerSec) + ts.tv_nsec;
+}
+
+}  // namespace
+
+// The name and line ends of a script, copied once per script so that the
+// writer thread can compute lines and columns without touching the heap.
+struct LinuxPerfJitLogger::ScriptInfo {
+  std::string name;
+  int line_offset;
+  int column_offset;
+  std::vector<int> line_ends;
+
+  // Like Script::GetPositionInfo with Script::WITH_OFFSET.
+  bool GetPositionInfo(int position, int* line, int* column) const {
+    if (line_ends.empty()) return false;
+    if (position < 0) {
+      position = 0;
+    } else if (position > line_ends.back()) {
+      return false;
+    }
+    auto it = std::lower_bound(line_ends.begin(), line_ends.end(), position);
+    *line = static_cast<int>(it - line_ends.begin());
+    *column = *line == 0 ? position : position - (*(it - 1) + 1);
+    if (*line == 0) *column += column_offset;
+    *line += line_offset;
+    return true;
+  }
+};
+
+// The jitdump records of one code object, prepared by the thread logging the
+// code. The source positions of JavaScript code are only turned into a debug
+// info record on the writer thread.
+struct LinuxPerfJitLogger::Records {
+  struct DebugEntry {
+    uint64_t address;
+    int script_offset;
+    const ScriptInfo* script;
+  };
+
+  void Append(const void* data, size_t size) {
+    const char* begin = reinterpret_cast<const char*>(data);
+    bytes.insert(bytes.end(), begin, begin + size);
+  }
+
+  size_t size() const {
+    return bytes.size() + debug_entries.size() * sizeof(DebugEntry);
+  }
+
+  uint64_t debug_address = 0;
+  std::vector<DebugEntry> debug_entries;
+  // Keeps the scripts of {debug_entries} alive.
+  std::vector<std::shared_ptr<const ScriptInfo>> scripts;
+  // Complete records, but without time stamps and code ids. These are set
+  // when the records are written, to keep them in order.
+  std::vector<char> bytes;
+};
+
+class LinuxPerfJitLogger::Writer final : public base::Thread {
+ public:
+  explicit Writer(FILE* output_handle)
+      : base::Thread(base::Thread::Options("V8 PerfJitWriter")),
+        output_handle_(output_handle) {}
+
+  // Blocks while too many records wait to be written.
+  void Enqueue(std::unique_ptr<Records> records) {
+    base::MutexGuard guard(&mutex_);
+    while (queued_bytes_ > kMaxQueuedBytes) space_available_.Wait(&mutex_);
+    queued_bytes_ += records->size();
+    queue_.push_back({std::move(records), GetTimestamp()});
+    records_available_.NotifyOne();
+  }
+
+  // Writes all queued records and joins the thread.
+  void Stop() {
+    {
+      base::MutexGuard guard(&mutex_);
+      stopped_ = true;
+      records_available_.NotifyOne();
+    }
+    Join();
+  }
+
+  void Run() override {
+    for (;;) {
+      QueuedRecords queued;
+      {
+        base::MutexGuard guard(&mutex_);
+        while (queue_.empty() && !stopped_) records_available_.Wait(&mutex_);
+        if (queue_.empty()) return;
+        queued = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      Write(queued.records.get(), queued.time_stamp);
+      base::MutexGuard guard(&mutex_);
+      queued_bytes_ -= queued.records->size();
+      space_available_.NotifyAll();
+    }
+  }
+
+ private:
+  struct QueuedRecords {
+    std::unique_ptr<Records> records;
+    uint64_t time_stamp;
+  };
+
+  void Write(Records* records, uint64_t time_stamp) {
+    if (!records->debug_entries.empty()) {
+      WriteDebugInfo(*records, time_stamp);
+    }
+    // Fill in the time stamps and code ids.
+    char* bytes = records->bytes.data();
+    size_t offset = 0;
+    while (offset < records->bytes.size()) {
+      PerfJitBase* base = reinterpret_cast<PerfJitBase*>(bytes + offset);
+      base->time_stamp_ = time_stamp;
+      if (base->event_ == PerfJitBase::kLoad) {
+        reinterpret_cast<PerfJitCodeLoad*>(base)->code_id_ = code_index_++;
+      }
+      offset += base->size_;
+    }
+    DCHECK_EQ(offset, records->bytes.size());
+    WriteBytes(bytes, records->bytes.size());
+  }
+
+  void WriteDebugInfo(const Records& records, uint64_t time_stamp) {
+    uint32_t size = sizeof(PerfJitCodeDebugInfo);
+    const ScriptInfo* last_script = nullptr;
+    for (const Records::DebugEntry& entry : records.debug_entries) {
+      if (entry.script != last_script) {
+        size += entry.script->name.size() + sizeof(kStringTerminator);
+        last_script = entry.script;
+      } else {
+        size += sizeof(kRepeatedNameMarker);
+      }
+    }
+    size += records.debug_entries.size() * sizeof(PerfJitDebugEntry);
+    int padding = ((size + 7) & (~7)) - size;
+
+    PerfJitCodeDebugInfo debug_info;
+    debug_info.event_ = PerfJitCodeLoad::kDebugInfo;
+    debug_info.size_ = size + padding;
+    debug_info.time_stamp_ = time_stamp;
+    debug_info.address_ = records.debug_address;
+    debug_info.entry_count_ = records.debug_entries.size();
+    WriteBytes(&debug_info, sizeof(debug_info));
+
+    last_script = nullptr;
+    for (const Records::DebugEntry& entry : records.debug_entries) {
+      int line = -1;
+      int column = -1;
+      entry.script->GetPositionInfo(entry.script_offset, &line, &column);
+      PerfJitDebugEntry debug_entry;
+      debug_entry.address_ = entry.address;
+      debug_entry.line_number_ = line + 1;
+      debug_entry.column_ = column + 1;
+      WriteBytes(&debug_entry, sizeof(debug_entry));
+      if (entry.script != last_script) {
+        WriteBytes(entry.script->name.data(), entry.script->name.size());
+        WriteBytes(kStringTerminator, sizeof(kStringTerminator));
+        last_script = entry.script;
+      } else {
+        // Use the much shorter kRepeatedNameMarker for repeated names.
+        WriteBytes(kRepeatedNameMarker, sizeof(kRepeatedNameMarker));
+      }
+    }
+    char padding_bytes[8] = {0};
+    WriteBytes(padding_bytes, padding);
+  }
+
+  void WriteBytes(const void* bytes, size_t size) {
+    size_t rv = fwrite(bytes, 1, size, output_handle_);
+    DCHECK_EQ(size, rv);
+    USE(rv);
+  }
+
+  FILE* const output_handle_;
+  // Only used on the writer thread.
+  uint64_t code_index_ = 0;
+
+  base::Mutex mutex_;
+  base::ConditionVariable records_available_;
+  base::ConditionVariable space_available_;
+  std::deque<QueuedRecords> queue_;
+  size_t queued_bytes_ = 0;
+  bool stopped_ = false;
+};
+
 base::LazyRecursiveMutex LinuxPerfJitLogger::file_mutex_;
 // The following static variables are protected by
 // LinuxPerfJitLogger::file_mutex_.
 int LinuxPerfJitLogger::process_id_ = 0;
 uint64_t LinuxPerfJitLogger::reference_count_ = 0;
 void* LinuxPerfJitLogger::marker_address_ = nullptr;
-uint64_t LinuxPerfJitLogger::code_index_ = 0;
 FILE* LinuxPerfJitLogger::perf_output_handle_ = nullptr;
+LinuxPerfJitLogger::Writer* LinuxPerfJitLogger::writer_ = nullptr;
 
 void LinuxPerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -155,6 +361,11 @@ void LinuxPerfJitLogger::OpenJitDumpFile() {
 }
 
 void LinuxPerfJitLogger::CloseJitDumpFile() {
+  if (writer_ != nullptr) {
+    writer_->Stop();
+    delete writer_;
+    writer_ = nullptr;
+  }
   if (perf_output_handle_ == nullptr) return;
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
@@ -190,6 +401,8 @@ LinuxPerfJitLogger::LinuxPerfJitLogger(Isolate* isolate)
     OpenJitDumpFile();
     if (perf_output_handle_ == nullptr) return;
     LogWriteHeader();
+    writer_ = new Writer(perf_output_handle_);
+    CHECK(writer_->Start());
   }
 }
 
@@ -203,15 +416,6 @@ LinuxPerfJitLogger::~LinuxPerfJitLogger() {
   }
 }
 
-uint64_t LinuxPerfJitLogger::GetTimestamp() {
-  struct timespec ts;
-  int result = clock_gettime(CLOCK_MONOTONIC, &ts);
-  DCHECK_EQ(0, result);
-  USE(result);
-  static const uint64_t kNsecPerSec = 1000000000;
-  return (ts.tv_sec * kNsecPerSec) + ts.tv_nsec;
-}
-
 void LinuxPerfJitLogger::LogRecordedBuffer(
     Handle<AbstractCode> abstract_code,
     MaybeHandle<SharedFunctionInfo> maybe_shared, const char* name,
@@ -226,20 +430,22 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
 
   base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
 
-  if (perf_output_handle_ == nullptr) return;
+  if (writer_ == nullptr) return;
 
   // We only support non-interpreted functions.
   if (!abstract_code->IsCode()) return;
   Handle<Code> code = Handle<Code>::cast(abstract_code);
   DCHECK(code->raw_instruction_start() == code->address() + Code::kHeaderSize);
 
+  auto records = std::make_unique<Records>();
+
   // Debug info has to be emitted first.
   Handle<SharedFunctionInfo> shared;
   if (FLAG_perf_prof && maybe_shared.ToHandle(&shared)) {
     // TODO(herhut): This currently breaks for js2wasm/wasm2js functions.
     if (code->kind() != CodeKind::JS_TO_WASM_FUNCTION &&
         code->kind() != CodeKind::WASM_TO_JS_FUNCTION) {
-      LogWriteDebugInfo(code, shared);
+      CollectDebugInfo(records.get(), code, shared);
     }
   }
 
@@ -247,10 +453,13 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
   uint8_t* code_pointer = reinterpret_cast<uint8_t*>(code->InstructionStart());
 
   // Unwinding info comes right after debug info.
-  if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(*code);
+  if (FLAG_perf_prof_unwinding_info) {
+    LogWriteUnwindingInfo(records.get(), *code);
+  }
 
-  WriteJitCodeLoadEntry(code_pointer, code->InstructionSize(), code_name,
-                        length);
+  WriteJitCodeLoadEntry(records.get(), code_pointer, code->InstructionSize(),
+                        code_name, length);
+  writer_->Enqueue(std::move(records));
 }
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -258,36 +467,40 @@ void LinuxPerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
                                            const char* name, int length) {
   base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
 
-  if (perf_output_handle_ == nullptr) return;
+  if (writer_ == nullptr) return;
 
-  if (FLAG_perf_prof_annotate_wasm) LogWriteDebugInfo(code);
+  auto records = std::make_unique<Records>();
+  // Liftoff and TurboFan code both come with source positions.
+  if (FLAG_perf_prof_annotate_wasm) LogWriteDebugInfo(records.get(), code);
 
-  WriteJitCodeLoadEntry(code->instructions().begin(),
+  WriteJitCodeLoadEntry(records.get(), code->instructions().begin(),
                         code->instructions().length(), name, length);
+  writer_->Enqueue(std::move(records));
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
+void LinuxPerfJitLogger::WriteJitCodeLoadEntry(Records* records,
+                                               const uint8_t* code_pointer,
                                                uint32_t code_size,
                                                const char* name,
                                                int name_length) {
   PerfJitCodeLoad code_load;
   code_load.event_ = PerfJitCodeLoad::kLoad;
   code_load.size_ = sizeof(code_load) + name_length + 1 + code_size;
-  code_load.time_stamp_ = GetTimestamp();
+  // The time stamp and the code id are set by the writer.
+  code_load.time_stamp_ = 0;
   code_load.process_id_ = static_cast<uint32_t>(process_id_);
   code_load.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
   code_load.vma_ = reinterpret_cast<uint64_t>(code_pointer);
   code_load.code_address_ = reinterpret_cast<uint64_t>(code_pointer);
   code_load.code_size_ = code_size;
-  code_load.code_id_ = code_index_;
+  code_load.code_id_ = 0;
 
-  code_index_++;
-
-  LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
-  LogWriteBytes(name, name_length);
-  LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
-  LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
+  records->Append(&code_load, sizeof(code_load));
+  records->Append(name, name_length);
+  records->Append(kStringTerminator, sizeof(kStringTerminator));
+  // The code is copied, as it might be gone by the time the writer gets to it.
+  records->Append(code_pointer, code_size);
 }
 
 namespace {
@@ -296,7 +509,6 @@ constexpr char kUnknownScriptNameString[] = "<unknown>";
 constexpr size_t kUnknownScriptNameStringLen =
     arraysize(kUnknownScriptNameString) - 1;
 
-namespace {
 base::Vector<const char> GetScriptName(Object maybeScript,
                                        std::unique_ptr<char[]>* storage,
                                        const DisallowGarbageCollection& no_gc) {
@@ -316,104 +528,99 @@ base::Vector<const char> GetScriptName(Object maybeScript,
   return {kUnknownScriptNameString, kUnknownScriptNameStringLen};
 }
 
+// Returns the function {pos} belongs to, which differs from {shared} for
+// positions inlined by TurboFan.
+SharedFunctionInfo GetSourcePositionFunction(Code code,
+                                             SharedFunctionInfo shared,
+                                             SourcePosition pos) {
+  if (!code.is_turbofanned() || !pos.isInlined()) return shared;
+  DeoptimizationData deopt_data =
+      DeoptimizationData::cast(code.deoptimization_data());
+  InliningPosition inl = deopt_data.InliningPositions().get(pos.InliningId());
+  return deopt_data.GetInlinedFunction(inl.inlined_function_id);
+}
+
 }  // namespace
 
-SourcePositionInfo GetSourcePositionInfo(Handle<Code> code,
-                                         Handle<SharedFunctionInfo> function,
-                                         SourcePosition pos) {
-  DisallowGarbageCollection disallow;
-  if (code->is_turbofanned()) {
-    return pos.FirstInfo(code);
-  } else {
-    return SourcePositionInfo(pos, function);
+std::shared_ptr<const LinuxPerfJitLogger::ScriptInfo>
+LinuxPerfJitLogger::GetScriptInfo(Script script,
+                                  const DisallowGarbageCollection& no_gc) {
+  auto it = scripts_.find(script.id());
+  if (it != scripts_.end()) return it->second;
+
+  auto info = std::make_shared<ScriptInfo>();
+  std::unique_ptr<char[]> name_storage;
+  base::Vector<const char> name = GetScriptName(script, &name_storage, no_gc);
+  info->name.assign(name.begin(), name.size());
+  info->line_offset = script.line_offset();
+  info->column_offset = script.column_offset();
+  // Scripts which were only inlined might lack line ends, see
+  // CollectDebugInfo. Their positions are written without a line.
+  if (script.line_ends().IsFixedArray()) {
+    FixedArray line_ends = FixedArray::cast(script.line_ends());
+    info->line_ends.reserve(line_ends.length());
+    for (int i = 0; i < line_ends.length(); i++) {
+      info->line_ends.push_back(Smi::ToInt(line_ends.get(i)));
+    }
   }
+  scripts_.emplace(script.id(), info);
+  return info;
 }
 
-}  // namespace
-
-void LinuxPerfJitLogger::LogWriteDebugInfo(Handle<Code> code,
-                                           Handle<SharedFunctionInfo> shared) {
-  // Line ends of all scripts have been initialized prior to this.
-  DisallowGarbageCollection no_gc;
+void LinuxPerfJitLogger::CollectDebugInfo(Records* records, Handle<Code> code,
+                                          Handle<SharedFunctionInfo> shared) {
   // The WasmToJS wrapper stubs have source position entries.
   if (!shared->HasSourceCode()) return;
+  if (shared->script().IsScript() &&
+      scripts_.find(Script::cast(shared->script()).id()) == scripts_.end()) {
+    Script::InitLineEnds(isolate_,
+                         handle(Script::cast(shared->script()), isolate_));
+  }
 
-  PerfJitCodeDebugInfo debug_info;
-  uint32_t size = sizeof(debug_info);
-
+  DisallowGarbageCollection no_gc;
   ByteArray source_position_table = code->SourcePositionTable(*shared);
-  // Compute the entry count and get the names of all scripts.
-  // Avoid additional work if the script name is repeated. Multiple script
-  // names only occur for cross-script inlining.
-  uint32_t entry_count = 0;
-  Object last_script = Smi::zero();
-  std::vector<base::Vector<const char>> script_names;
-  for (SourcePositionTableIterator iterator(source_position_table);
-       !iterator.done(); iterator.Advance()) {
-    SourcePositionInfo info(
-        GetSourcePositionInfo(code, shared, iterator.source_position()));
-    Object current_script = *info.script;
-    if (current_script != last_script) {
-      std::unique_ptr<char[]> name_storage;
-      auto name = GetScriptName(shared->script(), &name_storage, no_gc);
-      script_names.push_back(name);
-      // Add the size of the name after each entry.
-      size += name.size() + sizeof(kStringTerminator);
-      last_script = current_script;
-    } else {
-      size += sizeof(kRepeatedNameMarker);
-    }
-    entry_count++;
+  // Baseline code uses the source positions of the bytecode, whose offsets
+  // need to be mapped to pcs.
+  base::Optional<baseline::BytecodeOffsetIterator> baseline_iterator;
+  if (code->kind() == CodeKind::BASELINE) {
+    baseline_iterator.emplace(ByteArray::cast(code->bytecode_offset_table()),
+                              shared->GetBytecodeArray(isolate_));
   }
-  if (entry_count == 0) return;
-
-  debug_info.event_ = PerfJitCodeLoad::kDebugInfo;
-  debug_info.time_stamp_ = GetTimestamp();
-  debug_info.address_ = code->InstructionStart();
-  debug_info.entry_count_ = entry_count;
-
-  // Add the sizes of fixed parts of entries.
-  size += entry_count * sizeof(PerfJitDebugEntry);
-
-  int padding = ((size + 7) & (~7)) - size;
-  debug_info.size_ = size + padding;
-  LogWriteBytes(reinterpret_cast<const char*>(&debug_info), sizeof(debug_info));
 
   Address code_start = code->InstructionStart();
-
-  last_script = Smi::zero();
-  int script_names_index = 0;
+  Object last_script = Smi::zero();
+  const ScriptInfo* last_script_info = nullptr;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
-    SourcePositionInfo info(
-        GetSourcePositionInfo(code, shared, iterator.source_position()));
-    PerfJitDebugEntry entry;
+    int code_offset = iterator.code_offset();
+    if (baseline_iterator) {
+      baseline_iterator->AdvanceToBytecodeOffset(code_offset);
+      code_offset =
+          static_cast<int>(baseline_iterator->current_pc_start_offset());
+    }
+    SourcePosition pos = iterator.source_position();
+    Object script = GetSourcePositionFunction(*code, *shared, pos).script();
+    if (!script.IsScript()) continue;
+    if (script != last_script) {
+      records->scripts.push_back(GetScriptInfo(Script::cast(script), no_gc));
+      last_script = script;
+      last_script_info = records->scripts.back().get();
+    }
+    Records::DebugEntry entry;
     // The entry point of the function will be placed straight after the ELF
     // header when processed by "perf inject". Adjust the position addresses
     // accordingly.
-    entry.address_ = code_start + iterator.code_offset() + kElfHeaderSize;
-    entry.line_number_ = info.line + 1;
-    entry.column_ = info.column + 1;
-    LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
-    Object current_script = *info.script;
-    if (current_script != last_script) {
-      auto name_string = script_names[script_names_index];
-      LogWriteBytes(name_string.begin(),
-                    static_cast<uint32_t>(name_string.size()));
-      LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
-      script_names_index++;
-      last_script = current_script;
-    } else {
-      // Use the much shorter kRepeatedNameMarker for repeated names.
-      LogWriteBytes(kRepeatedNameMarker, sizeof(kRepeatedNameMarker));
-    }
+    entry.address = code_start + code_offset + kElfHeaderSize;
+    entry.script_offset = pos.ScriptOffset();
+    entry.script = last_script_info;
+    records->debug_entries.push_back(entry);
   }
-  char padding_bytes[8] = {0};
-  LogWriteBytes(padding_bytes, padding);
+  records->debug_address = code_start;
 }
 
 #if V8_ENABLE_WEBASSEMBLY
-void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
+void LinuxPerfJitLogger::LogWriteDebugInfo(Records* records,
+                                           const wasm::WasmCode* code) {
   wasm::WasmModuleSourceMap* source_map =
       code->native_module()->GetWasmSourceMap();
   wasm::WireBytesRef code_ref =
@@ -442,7 +649,8 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
   PerfJitCodeDebugInfo debug_info;
 
   debug_info.event_ = PerfJitCodeLoad::kDebugInfo;
-  debug_info.time_stamp_ = GetTimestamp();
+  // The time stamp is set by the writer.
+  debug_info.time_stamp_ = 0;
   debug_info.address_ =
       reinterpret_cast<uintptr_t>(code->instructions().begin());
   debug_info.entry_count_ = entry_count;
@@ -453,7 +661,7 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
 
   int padding = ((size + 7) & (~7)) - size;
   debug_info.size_ = size + padding;
-  LogWriteBytes(reinterpret_cast<const char*>(&debug_info), sizeof(debug_info));
+  records->Append(&debug_info, sizeof(debug_info));
 
   uintptr_t code_begin =
       reinterpret_cast<uintptr_t>(code->instructions().begin());
@@ -470,21 +678,21 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
     entry.line_number_ =
         static_cast<int>(source_map->GetSourceLine(offset)) + 1;
     entry.column_ = 1;
-    LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    records->Append(&entry, sizeof(entry));
     std::string name_string = source_map->GetFilename(offset);
-    LogWriteBytes(name_string.c_str(), static_cast<int>(name_string.size()));
-    LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
+    records->Append(name_string.c_str(), name_string.size());
+    records->Append(kStringTerminator, sizeof(kStringTerminator));
   }
 
   char padding_bytes[8] = {0};
-  LogWriteBytes(padding_bytes, padding);
+  records->Append(padding_bytes, padding);
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-void LinuxPerfJitLogger::LogWriteUnwindingInfo(Code code) {
+void LinuxPerfJitLogger::LogWriteUnwindingInfo(Records* records, Code code) {
   PerfJitCodeUnwindingInfo unwinding_info_header;
   unwinding_info_header.event_ = PerfJitCodeLoad::kUnwindingInfo;
-  unwinding_info_header.time_stamp_ = GetTimestamp();
+  unwinding_info_header.time_stamp_ = 0;
   unwinding_info_header.eh_frame_hdr_size_ = EhFrameConstants::kEhFrameHdrSize;
 
   if (code.has_unwinding_info()) {
@@ -500,20 +708,21 @@ void LinuxPerfJitLogger::LogWriteUnwindingInfo(Code code) {
   int padding_size = RoundUp(content_size, 8) - content_size;
   unwinding_info_header.size_ = content_size + padding_size;
 
-  LogWriteBytes(reinterpret_cast<const char*>(&unwinding_info_header),
-                sizeof(unwinding_info_header));
+  records->Append(&unwinding_info_header, sizeof(unwinding_info_header));
 
   if (code.has_unwinding_info()) {
-    LogWriteBytes(reinterpret_cast<const char*>(code.unwinding_info_start()),
-                  code.unwinding_info_size());
+    records->Append(reinterpret_cast<const char*>(code.unwinding_info_start()),
+                    code.unwinding_info_size());
   } else {
-    OFStream perf_output_stream(perf_output_handle_);
-    EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
+    std::ostringstream eh_frame;
+    EhFrameWriter::WriteEmptyEhFrame(eh_frame);
+    std::string empty_eh_frame = eh_frame.str();
+    records->Append(empty_eh_frame.data(), empty_eh_frame.size());
   }
 
   char padding_bytes[] = "\0\0\0\0\0\0\0\0";
   DCHECK_LT(padding_size, static_cast<int>(sizeof(padding_bytes)));
-  LogWriteBytes(padding_bytes, static_cast<int>(padding_size));
+  records->Append(padding_bytes, padding_size);
 }
 
 void LinuxPerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
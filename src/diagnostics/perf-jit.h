@@ -33,6 +33,9 @@
 // {LinuxPerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <memory>
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -49,12 +52,15 @@ class LinuxPerfJitLogger : public CodeEventLogger {
                            Handle<SharedFunctionInfo> shared) override {}
 
  private:
+  struct Records;
+  struct ScriptInfo;
+  class Writer;
+
   void OpenJitDumpFile();
   void CloseJitDumpFile();
   void* OpenMarkerFile(int fd);
   void CloseMarkerFile(void* marker_address);
 
-  uint64_t GetTimestamp();
   void LogRecordedBuffer(Handle<AbstractCode> code,
                          MaybeHandle<SharedFunctionInfo> maybe_shared,
                          const char* name, int length) override;
@@ -71,16 +77,26 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   // minimize the associated overhead.
   static const int kLogBufferSize = 2 * MB;
 
-  void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
-                             const char* name, int name_length);
+  // Threads logging code wait while more than this many bytes of records are
+  // queued for the writer thread.
+  static const size_t kMaxQueuedBytes = 64 * MB;
+
+  void WriteJitCodeLoadEntry(Records* records, const uint8_t* code_pointer,
+                             uint32_t code_size, const char* name,
+                             int name_length);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
-  void LogWriteDebugInfo(Handle<Code> code, Handle<SharedFunctionInfo> shared);
+  // Collects the source positions of {code}. The writer thread turns them
+  // into lines and columns.
+  void CollectDebugInfo(Records* records, Handle<Code> code,
+                        Handle<SharedFunctionInfo> shared);
+  std::shared_ptr<const ScriptInfo> GetScriptInfo(
+      Script script, const DisallowGarbageCollection& no_gc);
 #if V8_ENABLE_WEBASSEMBLY
-  void LogWriteDebugInfo(const wasm::WasmCode* code);
+  void LogWriteDebugInfo(Records* records, const wasm::WasmCode* code);
 #endif  // V8_ENABLE_WEBASSEMBLY
-  void LogWriteUnwindingInfo(Code code);
+  void LogWriteUnwindingInfo(Records* records, Code code);
 
   static const uint32_t kElfMachIA32 = 3;
   static const uint32_t kElfMachX64 = 62;
@@ -128,13 +144,17 @@ class LinuxPerfJitLogger : public CodeEventLogger {
 #error Unknown target architecture pointer size
 #endif
 
+  // Script names and line ends by script id, guarded by file_mutex_.
+  std::unordered_map<int, std::shared_ptr<const ScriptInfo>> scripts_;
+
   // Per-process singleton file. We assume that there is one main isolate;
   // to determine when it goes away, we keep reference count.
   static base::LazyRecursiveMutex file_mutex_;
   static FILE* perf_output_handle_;
+  // Writes the queued records to perf_output_handle_ on a background thread.
+  static Writer* writer_;
   static uint64_t reference_count_;
   static void* marker_address_;
-  static uint64_t code_index_;
   static int process_id_;
 };
 
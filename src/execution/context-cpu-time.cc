@@ -0,0 +1,66 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/context-cpu-time.h"
+
+#include "src/base/memory.h"
+#include "src/heap/factory.h"
+#include "src/init/bootstrapper.h"
+#include "src/objects/contexts-inl.h"
+#include "src/objects/fixed-array-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+Address SlotFor(ByteArray storage, ContextCpuTime::Activity activity) {
+  return storage.GetDataStartAddress() +
+         static_cast<int>(activity) * kInt64Size;
+}
+
+}  // namespace
+
+void ContextCpuTime::Sample() {
+  base::ThreadTicks now = base::ThreadTicks::Now();
+  ThreadId thread = ThreadId::Current();
+  base::TimeDelta delta = now - last_sample_;
+  bool same_thread = thread == last_sample_thread_;
+  last_sample_ = now;
+  last_sample_thread_ = thread;
+  if (!same_thread || delta <= base::TimeDelta()) return;
+
+  // Contexts which are still being set up have no storage yet.
+  if (isolate_->bootstrapper()->IsActive()) return;
+  Context context = isolate_->context();
+  if (context.is_null()) return;
+  Object storage = context.native_context().cpu_time();
+  if (!storage.IsByteArray()) return;
+  Address slot = SlotFor(ByteArray::cast(storage), activity_);
+  base::WriteUnalignedValue<int64_t>(
+      slot, base::ReadUnalignedValue<int64_t>(slot) + delta.InMicroseconds());
+}
+
+// static
+void ContextCpuTime::AllocateStorage(Isolate* isolate,
+                                     Handle<NativeContext> context) {
+  Handle<ByteArray> storage = isolate->factory()->NewByteArray(
+      kActivityCount * kInt64Size, AllocationType::kOld);
+  for (int i = 0; i < kActivityCount; ++i) {
+    base::WriteUnalignedValue<int64_t>(
+        SlotFor(*storage, static_cast<Activity>(i)), 0);
+  }
+  context->set_cpu_time(*storage);
+}
+
+// static
+int64_t ContextCpuTime::Get(NativeContext context, Activity activity) {
+  Object storage = context.cpu_time();
+  if (!storage.IsByteArray()) return 0;
+  return base::ReadUnalignedValue<int64_t>(
+      SlotFor(ByteArray::cast(storage), activity));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,71 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_CONTEXT_CPU_TIME_H_
+#define V8_EXECUTION_CONTEXT_CPU_TIME_H_
+
+#include "src/base/platform/time.h"
+#include "src/execution/isolate.h"
+#include "src/execution/thread-id.h"
+
+namespace v8 {
+namespace internal {
+
+// Attributes the thread CPU time of the isolate to native contexts, split by
+// activity. Whenever the entered context changes or an activity starts or
+// ends, the time since the previous sample is charged to the current activity
+// of the isolate's current context. Enabled with --context-cpu-time.
+class V8_EXPORT_PRIVATE ContextCpuTime {
+ public:
+  enum class Activity { kScript, kMicrotasks, kCompile, kGC };
+  static constexpr int kActivityCount = 4;
+
+  explicit ContextCpuTime(Isolate* isolate) : isolate_(isolate) {}
+  ContextCpuTime(const ContextCpuTime&) = delete;
+  ContextCpuTime& operator=(const ContextCpuTime&) = delete;
+
+  void Sample();
+
+  Activity activity() const { return activity_; }
+  void set_activity(Activity activity) { activity_ = activity; }
+
+  // Installs the storage for the time charged to |context|.
+  static void AllocateStorage(Isolate* isolate, Handle<NativeContext> context);
+  // Returns the time charged to |activity| of |context|, in microseconds.
+  static int64_t Get(NativeContext context, Activity activity);
+
+ private:
+  Isolate* const isolate_;
+  // The isolate may move between threads, whose CPU clocks are unrelated.
+  ThreadId last_sample_thread_ = ThreadId::Invalid();
+  base::ThreadTicks last_sample_;
+  Activity activity_ = Activity::kScript;
+};
+
+// Charges the time spent in its scope to |activity|.
+class V8_NODISCARD ContextCpuTimeScope {
+ public:
+  ContextCpuTimeScope(Isolate* isolate, ContextCpuTime::Activity activity)
+      : cpu_time_(isolate->context_cpu_time()) {
+    if (V8_LIKELY(cpu_time_ == nullptr)) return;
+    cpu_time_->Sample();
+    previous_activity_ = cpu_time_->activity();
+    cpu_time_->set_activity(activity);
+  }
+
+  ~ContextCpuTimeScope() {
+    if (V8_LIKELY(cpu_time_ == nullptr)) return;
+    cpu_time_->Sample();
+    cpu_time_->set_activity(previous_activity_);
+  }
+
+ private:
+  ContextCpuTime* const cpu_time_;
+  ContextCpuTime::Activity previous_activity_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_CONTEXT_CPU_TIME_H_
@@ -17,6 +17,7 @@
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/vm-state-inl.h"
+#include "src/heap/heap-inl.h"
 #include "src/ic/ic-stats.h"
 #include "src/logging/counters.h"
 #include "src/objects/code.h"
@@ -630,21 +631,46 @@ StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
       }
     }
   } else {
+    // Frames with these markers are only set up by builtins, for which the
+    // code lookup below would fall back to the marker anyway.
+    if (StackFrame::IsTypeMarker(marker)) {
+      switch (StackFrame::MarkerToType(marker)) {
+        case ENTRY:
+        case CONSTRUCT_ENTRY:
+        case EXIT:
+        case BUILTIN_CONTINUATION:
+        case JAVA_SCRIPT_BUILTIN_CONTINUATION:
+        case JAVA_SCRIPT_BUILTIN_CONTINUATION_WITH_CATCH:
+        case BUILTIN_EXIT:
+        case INTERNAL:
+        case CONSTRUCT:
+          return StackFrame::MarkerToType(marker);
+        default:
+          break;
+      }
+    }
+
 #if V8_ENABLE_WEBASSEMBLY
     // If the {pc} does not point into WebAssembly code we can rely on the
     // returned {wasm_code} to be null and fall back to {GetContainingCode}.
-    wasm::WasmCodeRefScope code_ref_scope;
-    if (wasm::WasmCode* wasm_code =
-            wasm::GetWasmCodeManager()->LookupCode(pc)) {
-      switch (wasm_code->kind()) {
-        case wasm::WasmCode::kWasmFunction:
-          return WASM;
-        case wasm::WasmCode::kWasmToCapiWrapper:
-          return WASM_EXIT;
-        case wasm::WasmCode::kWasmToJsWrapper:
-          return WASM_TO_JS;
-        default:
-          UNREACHABLE();
+    // Embedded builtins and code in the isolate's code range are never
+    // WebAssembly code, which saves the locked lookup for most JavaScript
+    // frames.
+    if (!OffHeapInstructionStream::PcIsOffHeap(iterator->isolate(), pc) &&
+        !iterator->isolate()->heap()->code_region().contains(pc)) {
+      wasm::WasmCodeRefScope code_ref_scope;
+      if (wasm::WasmCode* wasm_code =
+              wasm::GetWasmCodeManager()->LookupCode(pc)) {
+        switch (wasm_code->kind()) {
+          case wasm::WasmCode::kWasmFunction:
+            return WASM;
+          case wasm::WasmCode::kWasmToCapiWrapper:
+            return WASM_EXIT;
+          case wasm::WasmCode::kWasmToJsWrapper:
+            return WASM_TO_JS;
+          default:
+            UNREACHABLE();
+        }
       }
     }
 #endif  // V8_ENABLE_WEBASSEMBLY
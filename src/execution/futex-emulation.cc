@@ -4,9 +4,13 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <atomic>
 #include <limits>
+#include <map>
 
 #include "src/api/api-inl.h"
+#include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/execution/isolate.h"
@@ -26,10 +30,40 @@ using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
 class FutexWaitList {
  public:
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  // The waiters are spread over buckets by the location they wait on, so
+  // that waiting on and waking unrelated locations doesn't contend on a
+  // single lock. A bucket's `mutex` protects the composition of its
+  // `location_lists` (i.e. no elements may be added or removed without
+  // holding this mutex), as well as the `waiting_` field of each node that is
+  // currently part of the lists. For sync waiters, it must be the mutex used
+  // together with their `cond_` condition variable.
+  struct Bucket {
+    base::Mutex mutex;
+
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    std::map<int8_t*, HeadAndTail> location_lists;
+
+    // The number of Nodes on `location_lists`, plus the number of waiters
+    // which are comparing the value at their location. Only increased while
+    // holding `mutex`, but Wake reads it without taking `mutex` to return
+    // early if there are no waiters.
+    std::atomic<size_t> num_waiters{0};
+  };
+
   FutexWaitList() = default;
   FutexWaitList(const FutexWaitList&) = delete;
   FutexWaitList& operator=(const FutexWaitList&) = delete;
 
+  Bucket* BucketFor(int8_t* wait_location) {
+    return &buckets_[base::hash_value(wait_location) & (kNumBuckets - 1)];
+  }
+
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
@@ -52,16 +86,20 @@ class FutexWaitList {
     return next;
   }
 
-  static void DeleteNodesForIsolate(Isolate* isolate, FutexWaitListNode** head,
-                                    FutexWaitListNode** tail) {
+  // Returns the number of deleted nodes.
+  static size_t DeleteNodesForIsolate(Isolate* isolate,
+                                      FutexWaitListNode** head,
+                                      FutexWaitListNode** tail) {
     // For updating head & tail once we've iterated all nodes.
     FutexWaitListNode* new_head = nullptr;
     FutexWaitListNode* new_tail = nullptr;
+    size_t deleted = 0;
     auto node = *head;
     while (node != nullptr) {
       if (node->isolate_for_async_waiters_ == isolate) {
         node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
         node = DeleteAsyncWaiterNode(node);
+        ++deleted;
       } else {
         if (new_head == nullptr) {
           new_head = node;
@@ -72,10 +110,13 @@ class FutexWaitList {
     }
     *head = new_head;
     *tail = new_tail;
+    return deleted;
   }
 
-  // For checking the internal consistency of the FutexWaitList.
-  void Verify();
+  // For checking the internal consistency of the lists of |bucket|.
+  void Verify(Bucket* bucket);
+  // For checking the internal consistency of isolate_promises_to_resolve_.
+  void VerifyIsolatePromises();
   // Verifies the local consistency of |node|. If it's the first node of its
   // list, it must be |head|, and if it's the last node, it must be |tail|.
   void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
@@ -86,13 +127,13 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  static constexpr size_t kNumBuckets = 64;
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(kNumBuckets));
+  Bucket buckets_[kNumBuckets];
+
+  // Protects isolate_promises_to_resolve_. When both are held, it is acquired
+  // after the mutex of a bucket.
+  base::Mutex isolate_promises_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
@@ -100,12 +141,6 @@ class FutexWaitList {
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
 }  // namespace
 
@@ -125,16 +160,21 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
-  // if not waiting, this will not have any effect.
-  cond_.NotifyOne();
-  interrupted_ = true;
+  // Set the interrupted_ flag, which a future wait will test after
+  // publishing the mutex it waits with.
+  interrupted_.store(true);
+
+  // If the node is waiting, lock the mutex of its bucket before notifying. We
+  // know that the mutex will have been unlocked if we are currently waiting
+  // on the condition variable. If the node stopped waiting or moved to
+  // another bucket before we got the mutex, try again.
+  while (base::Mutex* mutex = wait_mutex_.load()) {
+    NoGarbageCollectionMutexGuard lock_guard(mutex);
+    if (wait_mutex_.load() != mutex) continue;
+    interrupted_.store(true);
+    cond_.NotifyOne();
+    break;
+  }
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -168,18 +208,21 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // This function can run in any thread.
 
-  g_mutex.Pointer()->AssertHeld();
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  wait_list->BucketFor(node->wait_location_)->mutex.AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  NoGarbageCollectionMutexGuard lock_guard(
+      &wait_list->isolate_promises_mutex_);
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -199,22 +242,29 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  auto it = location_lists_.find(node->wait_location_);
-  if (it == location_lists_.end()) {
-    location_lists_.insert(
+  Bucket* bucket = BucketFor(node->wait_location_);
+  bucket->mutex.AssertHeld();
+  auto& location_lists = bucket->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  if (it == location_lists.end()) {
+    location_lists.insert(
         std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
     it->second.tail->next_ = node;
     node->prev_ = it->second.tail;
     it->second.tail = node;
   }
+  bucket->num_waiters.fetch_add(1);
 
-  Verify();
+  Verify(bucket);
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  auto it = location_lists_.find(node->wait_location_);
-  DCHECK_NE(location_lists_.end(), it);
+  Bucket* bucket = BucketFor(node->wait_location_);
+  bucket->mutex.AssertHeld();
+  auto& location_lists = bucket->location_lists;
+  auto it = location_lists.find(node->wait_location_);
+  DCHECK_NE(location_lists.end(), it);
   DCHECK(NodeIsOnList(node, it->second.head));
 
   if (node->prev_) {
@@ -233,23 +283,21 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 
   // If the node was the last one on its list, delete the whole list.
   if (node->prev_ == nullptr && node->next_ == nullptr) {
-    location_lists_.erase(it);
+    location_lists.erase(it);
   }
 
   node->prev_ = node->next_ = nullptr;
+  bucket->num_waiters.fetch_sub(1);
 
-  Verify();
+  Verify(bucket);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
-  // Adding a separate `NotifyWake()` variant that doesn't acquire the lock
-  // itself would likely just add unnecessary complexity..
-  // The split lock by itself isn’t an issue, as long as the caller properly
-  // synchronizes this with the closing `AtomicsWaitCallback`.
-  {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-    stopped_ = true;
-  }
+  // The waiter tests stopped_ after being woken up by NotifyWake, while
+  // holding the mutex NotifyWake notifies with. This by itself isn’t an
+  // issue, as long as the caller properly synchronizes this with the closing
+  // `AtomicsWaitCallback`.
+  stopped_.store(true);
   isolate_->futex_wait_list_node()->NotifyWake();
 }
 
@@ -257,6 +305,25 @@ enum WaitReturnValue : int { kOk = 0, kNotEqual = 1, kTimedOut = 2 };
 
 namespace {
 
+// Counts a waiter in |bucket| while it holds the bucket's mutex, from before
+// it loads the value at its location, so that a concurrent Wake either sees a
+// waiter in the bucket or has stored the value the waiter loads, see
+// FutexEmulation::Wake. Once the waiter is on the bucket's lists, it is
+// counted as a node as well.
+class V8_NODISCARD CountWaiterScope {
+ public:
+  explicit CountWaiterScope(FutexWaitList::Bucket* bucket) : bucket_(bucket) {
+    bucket_->mutex.AssertHeld();
+    bucket_->num_waiters.fetch_add(1);
+  }
+  ~CountWaiterScope() { bucket_->num_waiters.fetch_sub(1); }
+  CountWaiterScope(const CountWaiterScope&) = delete;
+  CountWaiterScope& operator=(const CountWaiterScope&) = delete;
+
+ private:
+  FutexWaitList::Bucket* bucket_;
+};
+
 Object WaitJsTranslateReturn(Isolate* isolate, Object res) {
   if (res.IsSmi()) {
     int val = Smi::ToInt(res);
@@ -381,18 +448,22 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList::Bucket* bucket =
+        g_wait_list.Pointer()->BucketFor(wait_location);
+    NoGarbageCollectionMutexGuard lock_guard(&bucket->mutex);
+    CountWaiterScope count_waiter(bucket);
+
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
-    auto wait_location =
-        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->wait_location_ = wait_location;
     node->waiting_ = true;
+    node->wait_mutex_.store(&bucket->mutex);
 
     // Reset node->waiting_ = false when leaving this scope (but while
     // still holding the lock).
@@ -424,8 +495,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
     g_wait_list.Pointer()->AddNode(node);
 
     while (true) {
-      bool interrupted = node->interrupted_;
-      node->interrupted_ = false;
+      bool interrupted = node->interrupted_.exchange(false);
 
       // Unlock the mutex here to prevent deadlock from lock ordering between
       // mutex and mutexes locked by HandleInterrupts.
@@ -455,7 +525,7 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
 
       lock_guard.Lock();
 
-      if (node->interrupted_) {
+      if (node->interrupted_.load()) {
         // An interrupt occurred while the mutex was unlocked. Don't wait yet.
         continue;
       }
@@ -482,10 +552,10 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
         base::TimeDelta time_until_timeout = timeout_time - current_time;
         DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
         bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
+            node->cond_.WaitFor(&bucket->mutex, time_until_timeout);
         USE(wait_for_result);
       } else {
-        node->cond_.Wait(g_mutex.Pointer());
+        node->cond_.Wait(&bucket->mutex);
       }
 
       // Spurious wakeup, interrupt or timeout.
@@ -543,15 +613,19 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
   enum class ResultKind { kNotEqual, kTimedOut, kAsync };
   ResultKind result_kind;
   {
-    // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+    FutexWaitList::Bucket* bucket =
+        g_wait_list.Pointer()->BucketFor(wait_location);
+
+    // 16. Perform EnterCriticalSection(WL).
+    NoGarbageCollectionMutexGuard lock_guard(&bucket->mutex);
+    CountWaiterScope count_waiter(bucket);
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
     // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
@@ -658,10 +732,21 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   int waiters_woken = 0;
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+  FutexWaitList::Bucket* bucket =
+      g_wait_list.Pointer()->BucketFor(wait_location);
+
+  // Return early if there are no waiters in the bucket, without taking its
+  // mutex. Waiters count themselves before comparing the value at their
+  // location, so with the fence, either a waiter's count is visible here or
+  // the value stored before this call is visible to the waiter.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (bucket->num_waiters.load(std::memory_order_relaxed) == 0) {
+    return Smi::zero();
+  }
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  NoGarbageCollectionMutexGuard lock_guard(&bucket->mutex);
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  auto& location_lists = bucket->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -744,7 +829,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of
+  // the FutexWaitList mutexes.
 
   DCHECK(node->IsAsync());
 
@@ -820,9 +906,11 @@ void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
 
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoGarbageCollectionMutexGuard lock_guard(
+        &wait_list->isolate_promises_mutex_);
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -853,7 +941,9 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    FutexWaitList* wait_list = g_wait_list.Pointer();
+    NoGarbageCollectionMutexGuard lock_guard(
+        &wait_list->BucketFor(node->wait_location_)->mutex);
 
     node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -874,19 +964,21 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  for (FutexWaitList::Bucket& bucket : wait_list->buckets_) {
+    NoGarbageCollectionMutexGuard lock_guard(&bucket.mutex);
+    auto& location_lists = bucket.location_lists;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
       FutexWaitListNode*& tail = it->second.tail;
-      FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
+      bucket.num_waiters.fetch_sub(
+          FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail));
       // head and tail are either both nullptr or both non-nullptr.
       DCHECK_EQ(head == nullptr, tail == nullptr);
       if (head == nullptr) {
@@ -895,10 +987,13 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
         ++it;
       }
     }
+    wait_list->Verify(&bucket);
   }
 
   {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    NoGarbageCollectionMutexGuard lock_guard(
+        &wait_list->isolate_promises_mutex_);
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       auto node = it->second.head;
@@ -909,9 +1004,8 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    wait_list->VerifyIsolatePromises();
   }
-
-  g_wait_list.Pointer()->Verify();
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -919,10 +1013,12 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
+  FutexWaitList::Bucket* bucket =
+      g_wait_list.Pointer()->BucketFor(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&bucket->mutex);
+
+  auto& location_lists = bucket->location_lists;
   auto it = location_lists.find(wait_location);
   if (it == location_lists.end()) {
     return Smi::zero();
@@ -943,16 +1039,17 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  for (FutexWaitList::Bucket& bucket : g_wait_list.Pointer()->buckets_) {
+    NoGarbageCollectionMutexGuard lock_guard(&bucket.mutex);
+    for (const auto& it : bucket.location_lists) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -964,10 +1061,12 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  FutexWaitList* wait_list = g_wait_list.Pointer();
+  NoGarbageCollectionMutexGuard lock_guard(
+      &wait_list->isolate_promises_mutex_);
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -1009,16 +1108,26 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 #endif  // DEBUG
 }
 
-void FutexWaitList::Verify() {
+void FutexWaitList::Verify(Bucket* bucket) {
 #ifdef DEBUG
-  for (const auto& it : location_lists_) {
+  bucket->mutex.AssertHeld();
+  size_t num_nodes = 0;
+  for (const auto& it : bucket->location_lists) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
       VerifyNode(node, it.second.head, it.second.tail);
+      DCHECK_EQ(bucket, BucketFor(node->wait_location_));
       node = node->next_;
+      ++num_nodes;
     }
   }
+  DCHECK_LE(num_nodes, bucket->num_waiters.load());
+#endif  // DEBUG
+}
 
+void FutexWaitList::VerifyIsolatePromises() {
+#ifdef DEBUG
+  isolate_promises_mutex_.AssertHeld();
   for (const auto& it : isolate_promises_to_resolve_) {
     auto node = it.second.head;
     while (node != nullptr) {
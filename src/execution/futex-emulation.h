@@ -7,6 +7,8 @@
 
 #include <stdint.h>
 
+#include <atomic>
+
 #include "include/v8-persistent-handle.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
@@ -48,11 +50,11 @@ class AtomicsWaitWakeHandle {
   explicit AtomicsWaitWakeHandle(Isolate* isolate) : isolate_(isolate) {}
 
   void Wake();
-  inline bool has_stopped() const { return stopped_; }
+  inline bool has_stopped() const { return stopped_.load(); }
 
  private:
   Isolate* isolate_;
-  bool stopped_ = false;
+  std::atomic<bool> stopped_{false};
 };
 
 class FutexWaitListNode {
@@ -78,7 +80,10 @@ class FutexWaitListNode {
   class V8_NODISCARD ResetWaitingOnScopeExit {
    public:
     explicit ResetWaitingOnScopeExit(FutexWaitListNode* node) : node_(node) {}
-    ~ResetWaitingOnScopeExit() { node_->waiting_ = false; }
+    ~ResetWaitingOnScopeExit() {
+      node_->waiting_ = false;
+      node_->wait_mutex_.store(nullptr);
+    }
     ResetWaitingOnScopeExit(const ResetWaitingOnScopeExit&) = delete;
     ResetWaitingOnScopeExit& operator=(const ResetWaitingOnScopeExit&) = delete;
 
@@ -96,7 +101,9 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by the mutex of the FutexWaitList bucket
+  // for wait_location_ while the node is waiting, and by the mutex of the
+  // list of Promises to resolve after that.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -113,11 +120,18 @@ class FutexWaitListNode {
   // update the head and tail of the list).
   int8_t* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // waiting_ is protected by the mutex of the FutexWaitList bucket for
+  // wait_location_ if this node is currently contained in the bucket or an
+  // AtomicsWaitWakeHandle has access to it.
   bool waiting_ = false;
-  bool interrupted_ = false;
+
+  // Only for sync FutexWaitListNodes. The mutex of the bucket the node is
+  // waiting in, which cond_ is used with, or nullptr if the node is not
+  // waiting. Only changes while holding the mutex it changes from or to, so
+  // that NotifyWake can find the mutex to notify cond_ with. interrupted_ is
+  // set before looking at wait_mutex_, and read after setting it.
+  std::atomic<base::Mutex*> wait_mutex_{nullptr};
+  std::atomic<bool> interrupted_{false};
 
   // Only for async FutexWaitListNodes. Weak Global handle. Must not be
   // synchronously resolved by a non-owner Isolate.
@@ -0,0 +1,103 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/isolate-pool.h"
+
+#include "include/v8-platform.h"
+#include "src/execution/isolate.h"
+#include "src/execution/stack-guard.h"
+#include "src/init/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class IsolatePool::CreateIsolateTask final : public v8::Task {
+ public:
+  explicit CreateIsolateTask(IsolatePool* pool) : pool_(pool) {}
+
+  void Run() override { pool_->CreateIsolateInBackground(); }
+
+ private:
+  IsolatePool* const pool_;
+};
+
+IsolatePool::IsolatePool(const v8::Isolate::CreateParams& params,
+                         size_t capacity)
+    : params_(params),
+      stack_limit_(params.constraints.stack_limit()),
+      capacity_(capacity) {
+  params_.constraints.set_stack_limit(nullptr);
+  base::MutexGuard guard(&mutex_);
+  Refill();
+}
+
+IsolatePool::~IsolatePool() {
+  base::MutexGuard guard(&mutex_);
+  tearing_down_ = true;
+  while (pending_tasks_ > 0) pending_tasks_done_.Wait(&mutex_);
+  for (v8::Isolate* isolate : ready_isolates_) isolate->Dispose();
+  ready_isolates_.clear();
+}
+
+v8::Isolate* IsolatePool::Acquire() {
+  v8::Isolate* v8_isolate = nullptr;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (!ready_isolates_.empty()) {
+      v8_isolate = ready_isolates_.front();
+      ready_isolates_.pop_front();
+    }
+    Refill();
+  }
+
+  if (v8_isolate == nullptr) {
+    v8_isolate = v8::Isolate::New(params_);
+  } else {
+    // The stack limits were computed for the worker thread that created the
+    // isolate.
+    Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+    ExecutionAccess access(isolate);
+    isolate->stack_guard()->InitThread(access);
+  }
+  if (stack_limit_ != nullptr) {
+    v8_isolate->SetStackLimit(reinterpret_cast<uintptr_t>(stack_limit_));
+  }
+  return v8_isolate;
+}
+
+void IsolatePool::Refill() {
+  mutex_.AssertHeld();
+  while (ready_isolates_.size() + pending_tasks_ < capacity_) {
+    pending_tasks_++;
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<CreateIsolateTask>(this));
+  }
+}
+
+void IsolatePool::CreateIsolateInBackground() {
+  {
+    base::MutexGuard guard(&mutex_);
+    if (tearing_down_) {
+      pending_tasks_--;
+      pending_tasks_done_.NotifyAll();
+      return;
+    }
+  }
+
+  v8::Isolate* v8_isolate = v8::Isolate::New(params_);
+  // The worker thread does not use the isolate again.
+  v8_isolate->DiscardThreadSpecificMetadata();
+
+  base::MutexGuard guard(&mutex_);
+  pending_tasks_--;
+  if (tearing_down_) {
+    v8_isolate->Dispose();
+    pending_tasks_done_.NotifyAll();
+    return;
+  }
+  ready_isolates_.push_back(v8_isolate);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,55 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_ISOLATE_POOL_H_
+#define V8_EXECUTION_ISOLATE_POOL_H_
+
+#include <deque>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// Implementation of v8::IsolatePool. Keeps up to |capacity| isolates that
+// were created and deserialized from the snapshot on worker threads, and
+// hands them out to the threads that need a new isolate.
+class IsolatePool final {
+ public:
+  IsolatePool(const v8::Isolate::CreateParams& params, size_t capacity);
+  ~IsolatePool();
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  // Returns an isolate that is ready to be used on the calling thread, and
+  // creates another one in the background in its place. Creates the isolate
+  // on the calling thread if none is ready.
+  v8::Isolate* Acquire();
+
+ private:
+  class CreateIsolateTask;
+
+  // Posts tasks to create the missing isolates. Requires |mutex_|.
+  void Refill();
+  void CreateIsolateInBackground();
+
+  // The parameters of the isolates, without the stack limit, which only
+  // applies to the threads that acquire them.
+  v8::Isolate::CreateParams params_;
+  uint32_t* const stack_limit_;
+  const size_t capacity_;
+
+  base::Mutex mutex_;
+  base::ConditionVariable pending_tasks_done_;
+  std::deque<v8::Isolate*> ready_isolates_;
+  size_t pending_tasks_ = 0;
+  bool tearing_down_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_ISOLATE_POOL_H_
@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
 #include "src/ast/ast-value-factory.h"
@@ -33,6 +34,7 @@
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/flush-instruction-cache.h"
+#include "src/codegen/source-position-collector.h"
 #include "src/common/assert-scope.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
@@ -43,10 +45,12 @@
 #include "src/debug/debug-wasm-objects.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/compilation-statistics.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate-inl.h"
@@ -56,6 +60,7 @@
 #include "src/execution/protectors-inl.h"
 #include "src/execution/simulator.h"
 #include "src/execution/tiering-manager.h"
+#include "src/execution/tiering-profile.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles-inl.h"
@@ -97,6 +102,7 @@
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
 #include "src/regexp/regexp-stack.h"
+#include "src/snapshot/context-snapshot-cache.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/embedded/embedded-file-writer-interface.h"
 #include "src/snapshot/read-only-deserializer.h"
@@ -694,18 +700,21 @@ namespace {
 class CallSiteBuilder {
  public:
   CallSiteBuilder(Isolate* isolate, FrameSkipMode mode, int limit,
-                  Handle<Object> caller)
+                  Handle<Object> caller, bool raw_frames = false)
       : isolate_(isolate),
         mode_(mode),
         limit_(limit),
         caller_(caller),
-        skip_next_frame_(mode != SKIP_NONE) {
+        skip_next_frame_(mode != SKIP_NONE),
+        raw_frames_(raw_frames) {
     DCHECK_IMPLIES(mode_ == SKIP_UNTIL_SEEN, caller_->IsJSFunction());
     // Modern web applications are usually built with multiple layers of
     // framework and library code, and stack depth tends to be more than
     // a dozen frames, so we over-allocate a bit here to avoid growing
     // the elements array in the common case.
-    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
+    int capacity = std::min(64, limit);
+    if (raw_frames_) capacity = RawCallSiteFrames::LengthFor(capacity);
+    elements_ = isolate->factory()->NewFixedArray(capacity);
   }
 
   bool Visit(FrameSummary const& summary) {
@@ -774,6 +783,10 @@ class CallSiteBuilder {
 
     int flags = 0;
     Handle<JSFunction> function = summary.function();
+    if (V8_UNLIKELY(isolate_->source_position_collector() != nullptr)) {
+      isolate_->source_position_collector()->Schedule(
+          handle(function->shared(), isolate_));
+    }
     if (IsStrictFrame(function)) flags |= CallSiteInfo::kIsStrict;
     if (summary.is_constructor()) flags |= CallSiteInfo::kIsConstructor;
 
@@ -806,6 +819,12 @@ class CallSiteBuilder {
   bool Full() { return index_ >= limit_; }
 
   Handle<FixedArray> Build() {
+    if (raw_frames_) {
+      if (index_ == 0) return isolate_->factory()->empty_fixed_array();
+      elements_->set(RawCallSiteFrames::kFrameCountIndex, Smi::FromInt(index_));
+      return FixedArray::ShrinkOrEmpty(isolate_, elements_,
+                                       RawCallSiteFrames::LengthFor(index_));
+    }
     return FixedArray::ShrinkOrEmpty(isolate_, elements_, index_);
   }
 
@@ -876,11 +895,30 @@ class CallSiteBuilder {
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
+    if (raw_frames_) {
+      // Store the fields inline and leave the CallSiteInfo allocation to
+      // RawCallSiteFrames::ToCallSiteInfos() once the stack is accessed.
+      int base = RawCallSiteFrames::LengthFor(index_++);
+      AppendRawField(base + RawCallSiteFrames::kReceiverOrInstanceOffset,
+                     receiver_or_instance);
+      AppendRawField(base + RawCallSiteFrames::kFunctionOffset, function);
+      AppendRawField(base + RawCallSiteFrames::kCodeObjectOffset, code);
+      AppendRawField(base + RawCallSiteFrames::kCodeOffsetOffset,
+                     handle(Smi::FromInt(offset), isolate_));
+      AppendRawField(base + RawCallSiteFrames::kFlagsOffset,
+                     handle(Smi::FromInt(flags), isolate_));
+      AppendRawField(base + RawCallSiteFrames::kParametersOffset, parameters);
+      return;
+    }
     auto info = isolate_->factory()->NewCallSiteInfo(
         receiver_or_instance, function, code, offset, flags, parameters);
     elements_ = FixedArray::SetAndGrow(isolate_, elements_, index_++, info);
   }
 
+  void AppendRawField(int index, Handle<Object> value) {
+    elements_ = FixedArray::SetAndGrow(isolate_, elements_, index, value);
+  }
+
   Isolate* isolate_;
   const FrameSkipMode mode_;
   int index_ = 0;
@@ -888,6 +926,7 @@ class CallSiteBuilder {
   const Handle<Object> caller_;
   bool skip_next_frame_;
   bool encountered_strict_function_ = false;
+  const bool raw_frames_;
   Handle<FixedArray> elements_;
 };
 
@@ -1146,9 +1185,12 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
   }
 }
 
+// With |raw_frames|, the result is in the RawCallSiteFrames form rather than
+// an array of CallSiteInfo objects.
 Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
                                            FrameSkipMode mode,
-                                           Handle<Object> caller) {
+                                           Handle<Object> caller,
+                                           bool raw_frames = false) {
   TRACE_EVENT_BEGIN1(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"), __func__,
                      "maxFrameCount", limit);
 
@@ -1156,7 +1198,7 @@ Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
   wasm::WasmCodeRefScope code_ref_scope;
 #endif  // V8_ENABLE_WEBASSEMBLY
 
-  CallSiteBuilder builder(isolate, mode, limit, caller);
+  CallSiteBuilder builder(isolate, mode, limit, caller, raw_frames);
   VisitStack(isolate, &builder);
 
   // If --async-stack-traces are enabled and the "current microtask" is a
@@ -1200,7 +1242,16 @@ MaybeHandle<JSObject> Isolate::CaptureAndSetErrorStack(
         limit = stack_trace_for_uncaught_exceptions_frame_limit_;
       }
     }
-    error_stack = CaptureSimpleStackTrace(this, limit, mode, caller);
+    // The ErrorStackData for the inspector below needs the CallSiteInfo
+    // objects anyway, so only defer their creation without it.
+    if (FLAG_lazy_call_site_infos &&
+        !capture_stack_trace_for_uncaught_exceptions_) {
+      Handle<FixedArray> frames =
+          CaptureSimpleStackTrace(this, limit, mode, caller, true);
+      error_stack = DeduplicateRawCallSiteFrames(frames);
+    } else {
+      error_stack = CaptureSimpleStackTrace(this, limit, mode, caller);
+    }
   }
 
   // Next is the inspector part: Depending on whether we got a "simple
@@ -1238,6 +1289,27 @@ MaybeHandle<JSObject> Isolate::CaptureAndSetErrorStack(
   return error_object;
 }
 
+Handle<FixedArray> Isolate::DeduplicateRawCallSiteFrames(
+    Handle<FixedArray> frames) {
+  if (FLAG_error_stack_dedup_window <= 0 || !RawCallSiteFrames::Is(*frames)) {
+    return frames;
+  }
+  // Errors created over and over from the same place, e.g. by validation
+  // code, share one copy of their raw frames. The frames are never mutated,
+  // as the CallSiteInfo objects are created in a separate array.
+  double now = heap()->MonotonicallyIncreasingTimeInMs();
+  Object cached = heap()->error_stack_frames_cache();
+  if (cached.IsFixedArray() &&
+      now - error_stack_frames_cache_time_ms_ <=
+          FLAG_error_stack_dedup_window &&
+      RawCallSiteFrames::Equals(FixedArray::cast(cached), *frames)) {
+    return handle(FixedArray::cast(cached), this);
+  }
+  heap()->set_error_stack_frames_cache(*frames);
+  error_stack_frames_cache_time_ms_ = now;
+  return frames;
+}
+
 Handle<FixedArray> Isolate::GetDetailedStackTrace(
     Handle<JSReceiver> error_object) {
   Handle<Object> error_stack = JSReceiver::GetDataProperty(
@@ -1260,7 +1332,15 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
   Handle<Object> error_stack = JSReceiver::GetDataProperty(
       this, error_object, factory()->error_stack_symbol());
   if (error_stack->IsFixedArray()) {
-    return Handle<FixedArray>::cast(error_stack);
+    Handle<FixedArray> frames = Handle<FixedArray>::cast(error_stack);
+    if (RawCallSiteFrames::Is(*frames)) {
+      frames = RawCallSiteFrames::ToCallSiteInfos(this, frames);
+      Object::SetProperty(this, error_object, factory()->error_stack_symbol(),
+                          frames, StoreOrigin::kMaybeKeyed,
+                          Just(ShouldThrow::kThrowOnError))
+          .Check();
+    }
+    return frames;
   }
   if (!error_stack->IsErrorStackData()) {
     return factory()->empty_fixed_array();
@@ -3125,24 +3205,35 @@ std::atomic<size_t> Isolate::non_disposed_isolates_;
 #endif  // DEBUG
 
 // static
-Isolate* Isolate::New() { return Isolate::Allocate(false); }
+Isolate* Isolate::New() { return Isolate::New(IsolateGroup::GetDefault()); }
+
+// static
+Isolate* Isolate::New(IsolateGroup* group) {
+  return Isolate::Allocate(group, false);
+}
 
 // static
 Isolate* Isolate::NewShared(const v8::Isolate::CreateParams& params) {
+  return Isolate::NewShared(params, IsolateGroup::GetDefault());
+}
+
+// static
+Isolate* Isolate::NewShared(const v8::Isolate::CreateParams& params,
+                            IsolateGroup* group) {
   DCHECK(ReadOnlyHeap::IsReadOnlySpaceShared());
-  Isolate* isolate = Isolate::Allocate(true);
+  Isolate* isolate = Isolate::Allocate(group, true);
   v8::Isolate::Initialize(reinterpret_cast<v8::Isolate*>(isolate), params);
   return isolate;
 }
 
 // static
-Isolate* Isolate::Allocate(bool is_shared) {
+Isolate* Isolate::Allocate(IsolateGroup* group, bool is_shared) {
   // v8::V8::Initialize() must be called before creating any isolates.
   DCHECK_NOT_NULL(V8::GetCurrentPlatform());
   // IsolateAllocator allocates the memory for the Isolate object according to
   // the given allocation mode.
   std::unique_ptr<IsolateAllocator> isolate_allocator =
-      std::make_unique<IsolateAllocator>();
+      std::make_unique<IsolateAllocator>(group);
   // Construct Isolate object in the allocated memory.
   void* isolate_ptr = isolate_allocator->isolate_memory();
   Isolate* isolate =
@@ -3332,6 +3423,7 @@ void Isolate::Deinit() {
   DisallowHeapAllocation no_allocation;
 
   tracing_cpu_profiler_.reset();
+  context_snapshot_cache_.reset();
   if (FLAG_stress_sampling_allocation_profiler > 0) {
     heap_profiler()->StopSamplingHeapProfiler();
   }
@@ -3406,6 +3498,9 @@ void Isolate::Deinit() {
     lazy_compile_dispatcher_.reset();
   }
 
+  // Its task was cancelled above.
+  source_position_collector_.reset();
+
   // At this point there are no more background threads left in this isolate.
   heap_.safepoint()->AssertMainThreadIsOnlyThread();
 
@@ -3440,6 +3535,9 @@ void Isolate::Deinit() {
   // updated anymore.
   DumpAndResetStats();
 
+  // All optimizing compile jobs have been finalized or discarded by now.
+  if (FLAG_tiering_profile_output) TieringProfile::WriteOutput();
+
   heap_.TearDown();
 
   main_thread_local_isolate_.reset();
@@ -3515,6 +3613,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
 
+  delete deopt_history_;
+  deopt_history_ = nullptr;
+
   delete v8_file_logger_;
   v8_file_logger_ = nullptr;
 
@@ -3858,12 +3959,53 @@ class BigIntPlatform : public bigint::Platform {
   ~BigIntPlatform() override = default;
 
   bool InterruptRequested() override {
+    // The stack limit only says something about the isolate's thread.
+    if (isolate_->thread_id() != ThreadId::Current()) {
+      return isolate_->stack_guard()->HasTerminationRequest();
+    }
     StackLimitCheck interrupt_check(isolate_);
     return (interrupt_check.InterruptRequested() &&
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int MaxParallelism() override {
+    if (!FLAG_parallel_bigint_arithmetic) return 1;
+    return 1 + V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  }
+
+  void RunInParallel(ParallelTask* task, int count) override {
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<ParallelJob>(task, count))
+        ->Join();
+  }
+
  private:
+  class ParallelJob : public JobTask {
+   public:
+    ParallelJob(ParallelTask* task, int count) : task_(task), count_(count) {}
+
+    void Run(JobDelegate* delegate) override {
+      // Parts are claimed one at a time; once claimed, a part is finished
+      // even if the delegate asks to yield.
+      while (!delegate->ShouldYield()) {
+        int index = next_index_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count_) return;
+        task_->Run(index);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      int remaining = count_ - next_index_.load(std::memory_order_relaxed);
+      return worker_count + std::max(remaining, 0);
+    }
+
+   private:
+    ParallelTask* const task_;
+    const int count_;
+    std::atomic<int> next_index_{0};
+  };
+
   Isolate* isolate_;
 };
 }  // namespace
@@ -3888,6 +4030,13 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   stress_deopt_count_ = FLAG_deopt_every_n_times;
   force_slow_path_ = FLAG_force_slow_path;
+  if (FLAG_context_cpu_time && base::ThreadTicks::IsSupported()) {
+    context_cpu_time_ = std::make_unique<ContextCpuTime>(this);
+  }
+  if (FLAG_precollect_source_positions) {
+    source_position_collector_ =
+        std::make_unique<SourcePositionCollector>(this);
+  }
 
   has_fatal_error_ = false;
 
@@ -3914,6 +4063,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   load_stub_cache_ = new StubCache(this);
   store_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deopt_history_ = new DeoptHistory();
   regexp_stack_ = new RegExpStack();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
@@ -3995,15 +4145,16 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     is_short_builtin_calls_enabled_ = (heap_.MaxOldGenerationSize() >=
                                        kShortBuiltinCallsOldSpaceSizeThreshold);
 #endif  // defined(V8_OS_ANDROID)
-    // Additionally, enable if there is already a process-wide CodeRange that
-    // has re-embedded builtins.
-    if (COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) {
-      std::shared_ptr<CodeRange> code_range =
-          CodeRange::GetProcessWideCodeRange();
+    // Additionally, enable if there is already a CodeRange shared by the
+    // isolate group that has re-embedded builtins.
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+    {
+      std::shared_ptr<CodeRange> code_range = isolate_group()->GetCodeRange();
       if (code_range && code_range->embedded_blob_code_copy() != nullptr) {
         is_short_builtin_calls_enabled_ = true;
       }
     }
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
     if (V8_ENABLE_NEAR_CODE_RANGE_BOOL) {
       // The short builtin calls could still be enabled if allocated code range
       // is close enough to embedded builtins so that the latter could be
@@ -4288,6 +4439,11 @@ std::unique_ptr<PersistentHandles> Isolate::NewPersistentHandles() {
   return std::make_unique<PersistentHandles>(this);
 }
 
+void Isolate::set_context_snapshot_cache(
+    std::unique_ptr<ContextSnapshotCache> cache) {
+  context_snapshot_cache_ = std::move(cache);
+}
+
 void Isolate::DumpAndResetStats() {
   if (FLAG_trace_turbo_stack_accesses) {
     StdoutStream os;
@@ -5369,29 +5525,59 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
-      icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (auto it = icu_object_cache_.begin(); it != icu_object_cache_.end();
+       ++it) {
+    if (it->type == cache_type && StringEqualsLocales(this, it->key, locales)) {
+      icu_object_cache_.splice(icu_object_cache_.begin(), icu_object_cache_,
+                               it);
+      return it->obj.get();
+    }
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  set_icu_object_in_cache(cache_type, GetStringFromLocales(this, locales),
+                          std::move(obj));
+}
+
+std::shared_ptr<icu::UMemory> Isolate::get_cached_icu_object(
+    ICUObjectCacheType cache_type, const std::string& key) {
+  for (auto it = icu_object_cache_.begin(); it != icu_object_cache_.end();
+       ++it) {
+    if (it->type == cache_type && it->key == key) {
+      icu_object_cache_.splice(icu_object_cache_.begin(), icu_object_cache_,
+                               it);
+      return it->obj;
+    }
+  }
+  return nullptr;
 }
 
-void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                                      std::string key,
+                                      std::shared_ptr<icu::UMemory> obj) {
+  if (FLAG_intl_object_cache_size <= 0) return;
+  icu_object_cache_.remove_if([&](const ICUObjectCacheEntry& entry) {
+    return entry.type == cache_type && entry.key == key;
+  });
+  while (icu_object_cache_.size() >=
+         static_cast<size_t>(FLAG_intl_object_cache_size)) {
+    icu_object_cache_.pop_back();
+  }
+  icu_object_cache_.emplace_front(cache_type, std::move(key), std::move(obj));
 }
 
-void Isolate::clear_cached_icu_objects() {
-  for (int i = 0; i < kICUObjectCacheTypeCount; i++) {
-    clear_cached_icu_object(static_cast<ICUObjectCacheType>(i));
-  }
+void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
+  icu_object_cache_.remove_if([=](const ICUObjectCacheEntry& entry) {
+    return entry.type == cache_type;
+  });
 }
 
+void Isolate::clear_cached_icu_objects() { icu_object_cache_.clear(); }
+
 #endif  // V8_INTL_SUPPORT
 
 bool StackLimitCheck::JsHasOverflowed(uintptr_t gap) const {
@@ -8,6 +8,7 @@
 #include <atomic>
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <memory>
 #include <queue>
 #include <unordered_map>
@@ -105,8 +106,11 @@ class CodeTracer;
 class CommonFrame;
 class CompilationCache;
 class CompilationStatistics;
+class ContextCpuTime;
+class ContextSnapshotCache;
 class Counters;
 class Debug;
+class DeoptHistory;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
@@ -139,6 +143,7 @@ class ThreadManager;
 class ThreadState;
 class ThreadVisitor;  // Defined in v8threads.h
 class TieringManager;
+class SourcePositionCollector;
 class TracingCpuProfilerImpl;
 class UnicodeCache;
 struct ManagedPtrDestructor;
@@ -601,9 +606,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Creates Isolate object. Must be used instead of constructing Isolate with
   // new operator.
   static Isolate* New();
+  // Creates Isolate object in the given |group|.
+  static Isolate* New(IsolateGroup* group);
 
-  // Creates a new shared Isolate object.
+  // Creates a new shared Isolate object, which can only have clients in the
+  // same isolate group.
   static Isolate* NewShared(const v8::Isolate::CreateParams& params);
+  static Isolate* NewShared(const v8::Isolate::CreateParams& params,
+                            IsolateGroup* group);
 
   // Deletes Isolate object. Must be used instead of delete operator.
   // Destroys the non-default isolates.
@@ -1164,6 +1174,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #endif  // V8_EXTERNAL_CODE_SPACE
   }
 
+  IsolateGroup* isolate_group() const {
+    return isolate_allocator_->isolate_group();
+  }
+
   // When pointer compression is on, the PtrComprCage used by this
   // Isolate. Otherwise nullptr.
   VirtualMemoryCage* GetPtrComprCage() {
@@ -1261,6 +1275,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return materialized_object_store_;
   }
 
+  DeoptHistory* deopt_history() const { return deopt_history_; }
+
   DescriptorLookupCache* descriptor_lookup_cache() const {
     return descriptor_lookup_cache_;
   }
@@ -1443,16 +1459,26 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     default_locale_ = locale;
   }
 
+  // The kDefault* types cache the objects used by String.prototype.
+  // localeCompare and the toLocale*String methods when no options are
+  // passed, keyed by the locales argument. The other types cache the objects
+  // created by the Intl constructors, keyed by the resolved locale and the
+  // canonicalized options.
   enum class ICUObjectCacheType{
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
-      kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
-  static constexpr int kICUObjectCacheTypeCount = 5;
+      kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate,
+      kCollator, kNumberFormat, kNumberRangeFormat, kSimpleDateFormat};
+  static constexpr int kICUObjectCacheTypeCount = 9;
 
   icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type,
                                       Handle<Object> locales);
   void set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                Handle<Object> locales,
                                std::shared_ptr<icu::UMemory> obj);
+  std::shared_ptr<icu::UMemory> get_cached_icu_object(
+      ICUObjectCacheType cache_type, const std::string& key);
+  void set_icu_object_in_cache(ICUObjectCacheType cache_type, std::string key,
+                               std::shared_ptr<icu::UMemory> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void clear_cached_icu_objects();
 
@@ -1486,6 +1512,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return persistent_handles_list_.get();
   }
 
+  // The decompressed context snapshots, if the snapshot is compressed and
+  // --background-context-snapshot-decompression is on.
+  ContextSnapshotCache* context_snapshot_cache() const {
+    return context_snapshot_cache_.get();
+  }
+  void set_context_snapshot_cache(std::unique_ptr<ContextSnapshotCache> cache);
+
+  // The CPU time accounting per native context, if --context-cpu-time is on.
+  ContextCpuTime* context_cpu_time() const { return context_cpu_time_.get(); }
+
+  // Collects source positions ahead of time, if --precollect-source-positions
+  // is on.
+  SourcePositionCollector* source_position_collector() const {
+    return source_position_collector_.get();
+  }
+
 #ifdef DEBUG
   bool IsDeferredHandle(Address* location);
 #endif  // DEBUG
@@ -1539,6 +1581,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool jitless() const { return jitless_; }
 
+  // The last non-flat ConsString that a rope-aware operation read in place,
+  // and how many times in a row it did so. See String::ShouldFlattenOnAccess.
+  Address last_rope_accessed() const { return last_rope_accessed_; }
+  int last_rope_access_count() const { return last_rope_access_count_; }
+  void set_last_rope_accessed(Address rope, int count) {
+    last_rope_accessed_ = rope;
+    last_rope_access_count_ = count;
+  }
+
   DebugInfo::ExecutionMode* debug_execution_mode_address() {
     return &debug_execution_mode_;
   }
@@ -1977,12 +2028,16 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   // Common method to create an Isolate used by Isolate::New() and
   // Isolate::NewShared().
-  static Isolate* Allocate(bool is_shared);
+  static Isolate* Allocate(IsolateGroup* group, bool is_shared);
 
   static void RemoveContextIdCallback(const v8::WeakCallbackInfo<void>& data);
 
   void FireCallCompletedCallbackInternal(MicrotaskQueue* microtask_queue);
 
+  // Returns the raw frames of the last Error.stack if they are identical to
+  // |frames| and were captured within --error-stack-dedup-window.
+  Handle<FixedArray> DeduplicateRawCallSiteFrames(Handle<FixedArray> frames);
+
   class ThreadDataTable {
    public:
     ThreadDataTable() = default;
@@ -2121,10 +2176,14 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
+  DeoptHistory* deopt_history_ = nullptr;
   bool capture_stack_trace_for_uncaught_exceptions_ = false;
   int stack_trace_for_uncaught_exceptions_frame_limit_ = 0;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
+  // When --error-stack-dedup-window is set, the time at which the raw frames
+  // in the error_stack_frames_cache root were captured.
+  double error_stack_frames_cache_time_ms_ = 0;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
@@ -2184,18 +2243,19 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores up to --intl-object-cache-size {type,key,obj} entries,
+  // the most recently used one first.
   struct ICUObjectCacheEntry {
-    std::string locales;
+    ICUObjectCacheType type;
+    std::string key;
     std::shared_ptr<icu::UMemory> obj;
 
-    ICUObjectCacheEntry() = default;
-    ICUObjectCacheEntry(std::string locales, std::shared_ptr<icu::UMemory> obj)
-        : locales(locales), obj(std::move(obj)) {}
+    ICUObjectCacheEntry(ICUObjectCacheType type, std::string key,
+                        std::shared_ptr<icu::UMemory> obj)
+        : type(type), key(std::move(key)), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  std::list<ICUObjectCacheEntry> icu_object_cache_;
 #endif  // V8_INTL_SUPPORT
 
   // true if being profiled. Causes collection of extra compile info.
@@ -2288,6 +2348,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool force_slow_path_ = false;
 
+  // Only compared by address. A stale value after a GC at worst makes a rope
+  // get flattened one access early or late.
+  Address last_rope_accessed_ = kNullAddress;
+  int last_rope_access_count_ = 0;
+
   bool initialized_ = false;
   bool jitless_ = false;
 
@@ -2371,6 +2436,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
 
+  std::unique_ptr<ContextSnapshotCache> context_snapshot_cache_;
+
+  std::unique_ptr<ContextCpuTime> context_cpu_time_;
+
+  std::unique_ptr<SourcePositionCollector> source_position_collector_;
+
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
   // The top entry of the v8::Context::BackupIncumbentScope stack.
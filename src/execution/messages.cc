@@ -1017,12 +1017,15 @@ MaybeHandle<Object> ErrorUtils::GetFormattedStack(
   }
 
   if (error_stack->IsFixedArray()) {
+    Handle<FixedArray> call_site_infos = Handle<FixedArray>::cast(error_stack);
+    if (RawCallSiteFrames::Is(*call_site_infos)) {
+      call_site_infos =
+          RawCallSiteFrames::ToCallSiteInfos(isolate, call_site_infos);
+    }
     Handle<Object> formatted_stack;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, formatted_stack,
-        FormatStackTrace(isolate, error_object,
-                         Handle<FixedArray>::cast(error_stack)),
-        Object);
+        FormatStackTrace(isolate, error_object, call_site_infos), Object);
     RETURN_ON_EXCEPTION(
         isolate,
         JSObject::SetProperty(isolate, error_object,
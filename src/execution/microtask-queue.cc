@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/microtask-inl.h"
@@ -65,6 +66,12 @@ MicrotaskQueue::~MicrotaskQueue() {
     prev_->next_ = next_;
   }
   delete[] ring_buffer_;
+  CrossThreadMicrotask* microtask = cross_thread_microtasks_.load();
+  while (microtask != nullptr) {
+    CrossThreadMicrotask* next = microtask->next;
+    delete microtask;
+    microtask = next;
+  }
 }
 
 // static
@@ -97,6 +104,85 @@ void MicrotaskQueue::EnqueueMicrotask(v8::Isolate* v8_isolate,
   EnqueueMicrotask(*microtask);
 }
 
+void MicrotaskQueue::EnqueueMicrotasks(
+    v8::Isolate* v8_isolate, MemorySpan<const v8::Local<Function>> functions) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  HandleScope scope(isolate);
+  // Allocate all the Microtasks before reserving, as a GC in between may
+  // shrink the ring buffer again.
+  std::vector<Handle<Microtask>> microtasks;
+  microtasks.reserve(functions.size());
+  for (size_t i = 0; i < functions.size(); ++i) {
+    microtasks.push_back(isolate->factory()->NewCallableTask(
+        Utils::OpenHandle(*functions.data()[i]), isolate->native_context()));
+  }
+  EnqueueMicrotasks(microtasks);
+}
+
+void MicrotaskQueue::EnqueueMicrotasks(v8::Isolate* v8_isolate,
+                                       v8::MicrotaskCallback callback,
+                                       MemorySpan<void* const> data) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  HandleScope scope(isolate);
+  Handle<Foreign> callback_foreign =
+      isolate->factory()->NewForeign(reinterpret_cast<Address>(callback));
+  std::vector<Handle<Microtask>> microtasks;
+  microtasks.reserve(data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    microtasks.push_back(isolate->factory()->NewCallbackTask(
+        callback_foreign, isolate->factory()->NewForeign(
+                              reinterpret_cast<Address>(data.data()[i]))));
+  }
+  EnqueueMicrotasks(microtasks);
+}
+
+void MicrotaskQueue::EnqueueMicrotasks(
+    const std::vector<Handle<Microtask>>& microtasks) {
+  ReserveCapacity(static_cast<intptr_t>(microtasks.size()));
+  for (Handle<Microtask> microtask : microtasks) EnqueueMicrotask(*microtask);
+}
+
+void MicrotaskQueue::EnqueueMicrotaskFromAnyThread(
+    v8::MicrotaskCallback callback, void* data) {
+  CrossThreadMicrotask* microtask = new CrossThreadMicrotask{
+      callback, data, cross_thread_microtasks_.load(std::memory_order_relaxed)};
+  while (!cross_thread_microtasks_.compare_exchange_weak(
+      microtask->next, microtask, std::memory_order_release,
+      std::memory_order_relaxed)) {
+  }
+}
+
+void MicrotaskQueue::TakeCrossThreadMicrotasks(Isolate* isolate) {
+  CrossThreadMicrotask* top =
+      cross_thread_microtasks_.exchange(nullptr, std::memory_order_acquire);
+  if (top == nullptr) return;
+
+  // Reverse the stack to get the callbacks in the order of enqueueing.
+  CrossThreadMicrotask* first = nullptr;
+  size_t count = 0;
+  while (top != nullptr) {
+    CrossThreadMicrotask* next = top->next;
+    top->next = first;
+    first = top;
+    top = next;
+    ++count;
+  }
+
+  HandleScope scope(isolate);
+  std::vector<Handle<Microtask>> microtasks;
+  microtasks.reserve(count);
+  Factory* factory = isolate->factory();
+  while (first != nullptr) {
+    microtasks.push_back(factory->NewCallbackTask(
+        factory->NewForeign(reinterpret_cast<Address>(first->callback)),
+        factory->NewForeign(reinterpret_cast<Address>(first->data))));
+    CrossThreadMicrotask* next = first->next;
+    delete first;
+    first = next;
+  }
+  EnqueueMicrotasks(microtasks);
+}
+
 void MicrotaskQueue::EnqueueMicrotask(Microtask microtask) {
   if (size_ == capacity_) {
     // Keep the capacity of |ring_buffer_| power of 2, so that the JIT
@@ -148,6 +234,7 @@ class SetIsRunningMicrotasks {
 }  // namespace
 
 int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
+  TakeCrossThreadMicrotasks(isolate);
   if (!size()) {
     OnCompleted(isolate);
     return 0;
@@ -155,6 +242,8 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
 
   intptr_t base_count = finished_microtask_count_;
 
+  ContextCpuTimeScope cpu_time_scope(isolate,
+                                     ContextCpuTime::Activity::kMicrotasks);
   HandleScope handle_scope(isolate);
   MaybeHandle<Object> maybe_exception;
 
@@ -272,5 +361,13 @@ void MicrotaskQueue::ResizeBuffer(intptr_t new_capacity) {
   start_ = 0;
 }
 
+void MicrotaskQueue::ReserveCapacity(intptr_t count) {
+  if (size_ + count <= capacity_) return;
+  // Keep the capacity a power of 2, see EnqueueMicrotask.
+  intptr_t new_capacity = std::max(kMinimumCapacity, capacity_);
+  while (new_capacity < size_ + count) new_capacity <<= 1;
+  ResizeBuffer(new_capacity);
+}
+
 }  // namespace internal
 }  // namespace v8
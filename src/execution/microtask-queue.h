@@ -7,12 +7,14 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
 #include "include/v8-internal.h"  // For Address.
 #include "include/v8-microtask-queue.h"
 #include "src/base/macros.h"
+#include "src/handles/handles.h"
 
 namespace v8 {
 namespace internal {
@@ -41,6 +43,13 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
                         v8::Local<Function> microtask) override;
   void EnqueueMicrotask(v8::Isolate* isolate, v8::MicrotaskCallback callback,
                         void* data) override;
+  void EnqueueMicrotasks(
+      v8::Isolate* isolate,
+      MemorySpan<const v8::Local<Function>> microtasks) override;
+  void EnqueueMicrotasks(v8::Isolate* isolate, v8::MicrotaskCallback callback,
+                         MemorySpan<void* const> data) override;
+  void EnqueueMicrotaskFromAnyThread(v8::MicrotaskCallback callback,
+                                     void* data) override;
   void PerformCheckpoint(v8::Isolate* isolate) override {
     if (!ShouldPerfomCheckpoint()) return;
     PerformCheckpointInternal(isolate);
@@ -120,6 +129,14 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
 
   MicrotaskQueue();
   void ResizeBuffer(intptr_t new_capacity);
+  // Enqueues the allocated Microtasks, resizing |ring_buffer_| at most once.
+  void EnqueueMicrotasks(const std::vector<Handle<Microtask>>& microtasks);
+  // Grows |ring_buffer_| so that |count| more Microtasks fit without resizing.
+  void ReserveCapacity(intptr_t count);
+
+  // Moves the callbacks enqueued by EnqueueMicrotaskFromAnyThread to the ring
+  // buffer, in the order of enqueueing.
+  void TakeCrossThreadMicrotasks(Isolate* isolate);
 
   // A ring buffer to hold Microtask instances.
   // ring_buffer_[(start_ + i) % capacity_] contains |i|th Microtask for each
@@ -149,6 +166,15 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   using CallbackWithData =
       std::pair<MicrotasksCompletedCallbackWithData, void*>;
   std::vector<CallbackWithData> microtasks_completed_callbacks_;
+
+  // The callbacks enqueued from any thread, as a lock-free stack that the
+  // isolate's thread takes as a whole. The most recent one is at the top.
+  struct CrossThreadMicrotask {
+    v8::MicrotaskCallback callback;
+    void* data;
+    CrossThreadMicrotask* next;
+  };
+  std::atomic<CrossThreadMicrotask*> cross_thread_microtasks_{nullptr};
 };
 
 }  // namespace internal
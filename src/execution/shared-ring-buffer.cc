@@ -0,0 +1,95 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/shared-ring-buffer.h"
+
+#include <algorithm>
+
+#include "src/base/atomicops.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+volatile base::Atomic32* IndexAt(uint8_t* buffer, size_t offset) {
+  return reinterpret_cast<volatile base::Atomic32*>(buffer + offset);
+}
+
+// Loads an index written by the other side, and checks it against the
+// capacity since the other side might be untrusted JavaScript.
+size_t LoadIndex(uint8_t* buffer, size_t offset, size_t capacity) {
+  size_t index = static_cast<uint32_t>(
+      base::Acquire_Load(IndexAt(buffer, offset)));
+  CHECK_LT(index, capacity);
+  return index;
+}
+
+size_t LoadOwnIndex(uint8_t* buffer, size_t offset, size_t capacity) {
+  size_t index = static_cast<uint32_t>(
+      base::Relaxed_Load(IndexAt(buffer, offset)));
+  CHECK_LT(index, capacity);
+  return index;
+}
+
+void StoreIndex(uint8_t* buffer, size_t offset, size_t index) {
+  base::Release_Store(IndexAt(buffer, offset),
+                      static_cast<base::Atomic32>(index));
+}
+
+}  // namespace
+
+// static
+size_t SharedRingBuffer::Push(uint8_t* buffer, size_t byte_length,
+                              const uint8_t* data, size_t length) {
+  DCHECK(IsValidLength(byte_length));
+  const size_t capacity = byte_length - kHeaderSize;
+  const size_t head = LoadIndex(buffer, kHeadOffset, capacity);
+  const size_t tail = LoadOwnIndex(buffer, kTailOffset, capacity);
+  const size_t available = (head + capacity - tail - 1) % capacity;
+  const size_t count = std::min(length, available);
+  if (count == 0) return 0;
+
+  // Copy in at most two chunks, the second one wrapping around.
+  uint8_t* ring = buffer + kHeaderSize;
+  const size_t first = std::min(count, capacity - tail);
+  base::Relaxed_Memcpy(reinterpret_cast<volatile base::Atomic8*>(ring + tail),
+                       reinterpret_cast<const volatile base::Atomic8*>(data),
+                       first);
+  base::Relaxed_Memcpy(
+      reinterpret_cast<volatile base::Atomic8*>(ring),
+      reinterpret_cast<const volatile base::Atomic8*>(data + first),
+      count - first);
+  // Publish the data to the consumer.
+  StoreIndex(buffer, kTailOffset, (tail + count) % capacity);
+  return count;
+}
+
+// static
+size_t SharedRingBuffer::Pop(uint8_t* buffer, size_t byte_length,
+                             uint8_t* data, size_t length) {
+  DCHECK(IsValidLength(byte_length));
+  const size_t capacity = byte_length - kHeaderSize;
+  const size_t head = LoadOwnIndex(buffer, kHeadOffset, capacity);
+  const size_t tail = LoadIndex(buffer, kTailOffset, capacity);
+  const size_t used = (tail + capacity - head) % capacity;
+  const size_t count = std::min(length, used);
+  if (count == 0) return 0;
+
+  const uint8_t* ring = buffer + kHeaderSize;
+  const size_t first = std::min(count, capacity - head);
+  base::Relaxed_Memcpy(
+      reinterpret_cast<volatile base::Atomic8*>(data),
+      reinterpret_cast<const volatile base::Atomic8*>(ring + head), first);
+  base::Relaxed_Memcpy(reinterpret_cast<volatile base::Atomic8*>(data + first),
+                       reinterpret_cast<const volatile base::Atomic8*>(ring),
+                       count - first);
+  // Hand the space back to the producer.
+  StoreIndex(buffer, kHeadOffset, (head + count) % capacity);
+  return count;
+}
+
+}  // namespace internal
+}  // namespace v8
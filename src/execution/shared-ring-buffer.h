@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_SHARED_RING_BUFFER_H_
+#define V8_EXECUTION_SHARED_RING_BUFFER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// A bounded single-producer single-consumer byte ring in the memory of a
+// SharedArrayBuffer. The buffer starts with two 32-bit words, the
+// {head} (the offset of the next byte to pop, owned by the consumer) and the
+// {tail} (the offset of the next byte to push, owned by the producer), both
+// relative to the data following the header. The ring is empty if both are
+// equal, so one byte of the data is never used.
+//
+// The layout is simple enough that JavaScript can implement either side on an
+// Int32Array and a Uint8Array view with Atomics.load and Atomics.store, and
+// wait for the other side with Atomics.wait on the respective word.
+class SharedRingBuffer : public AllStatic {
+ public:
+  static constexpr size_t kHeadOffset = 0;
+  static constexpr size_t kTailOffset = kHeadOffset + kInt32Size;
+  static constexpr size_t kHeaderSize = kTailOffset + kInt32Size;
+
+  // Returns whether a buffer of {byte_length} bytes can hold a ring.
+  static bool IsValidLength(size_t byte_length) {
+    return byte_length > kHeaderSize && byte_length - kHeaderSize <= kMaxInt;
+  }
+
+  // Copies up to {length} bytes from {data} into the ring in {buffer} and
+  // returns the number of bytes copied, which is smaller than {length} if the
+  // ring is full. Must only be called by the producer.
+  V8_EXPORT_PRIVATE static size_t Push(uint8_t* buffer, size_t byte_length,
+                                       const uint8_t* data, size_t length);
+
+  // Copies up to {length} bytes from the ring in {buffer} into {data} and
+  // returns the number of bytes copied, which is smaller than {length} if the
+  // ring runs empty. Must only be called by the consumer.
+  V8_EXPORT_PRIVATE static size_t Pop(uint8_t* buffer, size_t byte_length,
+                                      uint8_t* data, size_t length);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_SHARED_RING_BUFFER_H_
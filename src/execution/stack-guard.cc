@@ -10,6 +10,7 @@
 #include "src/execution/isolate.h"
 #include "src/execution/simulator.h"
 #include "src/logging/counters.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/backing-store.h"
 #include "src/roots/roots-inl.h"
 #include "src/tracing/trace-event.h"
@@ -266,6 +267,7 @@ class V8_NODISCARD ShouldBeZeroOnReturnScope final {
 
 Object StackGuard::HandleInterrupts() {
   TRACE_EVENT0("v8.execute", "V8.HandleInterrupts");
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kHandleInterrupts);
 
 #if DEBUG
   isolate_->heap()->VerifyNewSpaceTop();
@@ -316,10 +318,18 @@ Object StackGuard::HandleInterrupts() {
     isolate_->heap()->DeoptMarkedAllocationSites();
   }
 
+  if (TestAndClear(&interrupt_flags, MIGRATE_DEPRECATED_INSTANCES)) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "V8.GCMigrateDeprecatedInstances");
+    isolate_->heap()->MigrateDeprecatedInstances();
+  }
+
   if (TestAndClear(&interrupt_flags, INSTALL_CODE)) {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.InstallOptimizedFunctions");
+    RCS_SCOPE(isolate_, RuntimeCallCounterId::kInstallOptimizedFunctions);
     DCHECK(isolate_->concurrent_recompilation_enabled());
+    isolate_->counters()->install_code_interrupts()->Increment();
     isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
   }
 
@@ -55,7 +55,8 @@ class V8_EXPORT_PRIVATE V8_NODISCARD StackGuard final {
   V(GROW_SHARED_MEMORY, GrowSharedMemory, 6)                      \
   V(LOG_WASM_CODE, LogWasmCode, 7)                                \
   V(WASM_CODE_GC, WasmCodeGC, 8)                                  \
-  V(INSTALL_MAGLEV_CODE, InstallMaglevCode, 9)
+  V(INSTALL_MAGLEV_CODE, InstallMaglevCode, 9)                    \
+  V(MIGRATE_DEPRECATED_INSTANCES, MigrateDeprecatedInstances, 10)
 
 #define V(NAME, Name, id)                                    \
   inline bool Check##Name() { return CheckInterrupt(NAME); } \
@@ -11,14 +11,18 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/tiering-profile.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
 #include "src/objects/code.h"
 #include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
 
 namespace v8 {
 namespace internal {
@@ -30,6 +34,8 @@ static const int kOSRBytecodeSizeAllowancePerTick = 44;
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
+  V(ProfiledHot, "hot in profile")    \
+  V(CachedHint, "code cache hint")    \
   V(SmallFunction, "small function")
 
 enum class OptimizationReason : uint8_t {
@@ -66,6 +72,14 @@ class OptimizationDecision {
     return {OptimizationReason::kHotAndStable, CodeKind::TURBOFAN,
             ConcurrencyMode::kConcurrent};
   }
+  static constexpr OptimizationDecision TurbofanProfiledHot() {
+    return {OptimizationReason::kProfiledHot, CodeKind::TURBOFAN,
+            ConcurrencyMode::kConcurrent};
+  }
+  static constexpr OptimizationDecision TurbofanCachedHint() {
+    return {OptimizationReason::kCachedHint, CodeKind::TURBOFAN,
+            ConcurrencyMode::kConcurrent};
+  }
   static constexpr OptimizationDecision TurbofanSmallFunction() {
     return {OptimizationReason::kSmallFunction, CodeKind::TURBOFAN,
             ConcurrencyMode::kConcurrent};
@@ -114,8 +128,27 @@ void TraceHeuristicOptimizationDisallowed(JSFunction function) {
   }
 }
 
+// Reports the decision to compile |function| with |code_kind| to the
+// v8.tiering trace category.
+void TraceTieringDecision(JSFunction function, CodeKind code_kind,
+                          const char* reason) {
+  bool enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.tiering"),
+                                     &enabled);
+  if (!enabled) return;
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("function", function.DebugNameCStr().get());
+  value->SetString("target", CodeKindToString(code_kind));
+  value->SetString("reason", reason);
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.tiering"),
+                       "V8.TieringDecision", TRACE_EVENT_SCOPE_THREAD, "data",
+                       std::move(value));
+}
+
 void TraceRecompile(Isolate* isolate, JSFunction function,
                     OptimizationDecision d) {
+  TraceTieringDecision(function, d.code_kind,
+                       OptimizationReasonToString(d.optimization_reason));
   if (FLAG_trace_opt) {
     CodeTracer::Scope scope(isolate->GetCodeTracer());
     PrintF(scope.file(), "[marking ");
@@ -158,25 +191,61 @@ bool TiersUpToMaglev(base::Optional<CodeKind> code_kind) {
 
 }  // namespace
 
+void TieringManager::SetPolicy(const v8::TieringPolicy& policy) {
+  policy_ = policy;
+  if (isolate_->concurrent_recompilation_enabled()) {
+    isolate_->optimizing_compile_dispatcher()->SetLimits(
+        policy.max_compile_queue_length, policy.max_concurrent_compile_share);
+  }
+}
+
+int TieringManager::SparkplugInterruptBudget() const {
+  return policy_.sparkplug_interrupt_budget > 0
+             ? policy_.sparkplug_interrupt_budget
+             : FLAG_interrupt_budget_for_feedback_allocation;
+}
+
+int TieringManager::MaglevInterruptBudget() const {
+  return policy_.maglev_interrupt_budget > 0 ? policy_.maglev_interrupt_budget
+                                             : FLAG_interrupt_budget_for_maglev;
+}
+
+int TieringManager::TurbofanInterruptBudget() const {
+  return policy_.turbofan_interrupt_budget > 0
+             ? policy_.turbofan_interrupt_budget
+             : FLAG_interrupt_budget;
+}
+
 // static
 int TieringManager::InterruptBudgetFor(Isolate* isolate, JSFunction function) {
+  const TieringManager* manager = isolate->tiering_manager();
   if (function.has_feedback_vector()) {
     return TiersUpToMaglev(function.GetActiveTier())
-               ? FLAG_interrupt_budget_for_maglev
-               : FLAG_interrupt_budget;
+               ? manager->MaglevInterruptBudget()
+               : manager->TurbofanInterruptBudget();
   }
 
   DCHECK(!function.has_feedback_vector());
   DCHECK(function.shared().is_compiled());
+  if (manager->policy_.sparkplug_interrupt_budget > 0) {
+    return manager->policy_.sparkplug_interrupt_budget;
+  }
   return function.shared().GetBytecodeArray(isolate).length() *
          FLAG_interrupt_budget_factor_for_feedback_allocation;
 }
 
 // static
-int TieringManager::InitialInterruptBudget() {
+int TieringManager::InitialInterruptBudget(Isolate* isolate) {
+  // The tiering manager does not exist yet while the heap is set up.
+  const TieringManager* manager = isolate->tiering_manager();
+  if (manager == nullptr) {
+    return V8_LIKELY(FLAG_lazy_feedback_allocation)
+               ? FLAG_interrupt_budget_for_feedback_allocation
+               : FLAG_interrupt_budget;
+  }
   return V8_LIKELY(FLAG_lazy_feedback_allocation)
-             ? FLAG_interrupt_budget_for_feedback_allocation
-             : FLAG_interrupt_budget;
+             ? manager->SparkplugInterruptBudget()
+             : manager->TurbofanInterruptBudget();
 }
 
 namespace {
@@ -266,7 +335,9 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
       (static_cast<uint32_t>(tiering_state) & kNoneOrInProgressMask) != 0;
   if (is_marked_for_any_optimization || function.HasAvailableOptimizedCode()) {
     // OSR kicks in only once we've previously decided to tier up, but we are
-    // still in the unoptimized frame (this implies a long-running loop).
+    // still in the unoptimized frame (this implies a long-running loop). With
+    // --maglev-osr, a pending Maglev request makes Maglev the OSR target, see
+    // Compiler::CompileOptimizedOSR.
     if (SmallEnoughForOSR(isolate_, function)) {
       TryIncrementOsrUrgency(isolate_, function);
     }
@@ -295,6 +366,32 @@ OptimizationDecision TieringManager::ShouldOptimize(JSFunction function,
     return OptimizationDecision::DoNotOptimize();
   }
 
+  // Functions that keep deoptimizing stay in the lower tiers.
+  if (V8_UNLIKELY(isolate_->deopt_history()->ReachedDeoptLimit(
+          function.shared()))) {
+    if (FLAG_trace_opt_verbose) {
+      PrintF("[not optimizing %s, too many deopts: %d]\n",
+             function.DebugNameCStr().get(),
+             isolate_->deopt_history()->DeoptCount(function.shared()));
+    }
+    return OptimizationDecision::DoNotOptimize();
+  }
+
+  // Functions that were optimized in a previous run are optimized on their
+  // first tick, which still leaves one budget interrupt worth of time to
+  // collect feedback.
+  const TieringProfile* profile = TieringProfile::Input();
+  if (profile != nullptr && profile->IsHot(function.shared())) {
+    return OptimizationDecision::TurbofanProfiledHot();
+  }
+  // Likewise for functions that had stable Turbofan code when their code
+  // cache was produced. Their dependencies are re-established by compiling
+  // them again.
+  if (FLAG_code_cache_tiering_hints &&
+      function.shared().turbofan_tier_up_hint()) {
+    return OptimizationDecision::TurbofanCachedHint();
+  }
+
   BytecodeArray bytecode = function.shared().GetBytecodeArray(isolate_);
   const int ticks = function.feedback_vector().profiler_ticks();
   const int ticks_for_optimization =
@@ -370,6 +467,7 @@ void TieringManager::OnInterruptTick(Handle<JSFunction> function) {
   // tiering.
   if (CanCompileWithBaseline(isolate_, function->shared()) &&
       !function->ActiveTierIsBaseline()) {
+    TraceTieringDecision(*function, CodeKind::BASELINE, "first tick");
     if (FLAG_baseline_batch_compilation) {
       isolate_->baseline_batch_compiler()->EnqueueFunction(function);
     } else {
@@ -5,6 +5,7 @@
 #ifndef V8_EXECUTION_TIERING_MANAGER_H_
 #define V8_EXECUTION_TIERING_MANAGER_H_
 
+#include "include/v8-isolate.h"
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/utils/allocation.h"
@@ -35,10 +36,13 @@ class TieringManager {
   // After this request, the next JumpLoop will perform OSR.
   void RequestOsrAtNextOpportunity(JSFunction function);
 
+  // Replaces the embedder's tiering policy, see v8::TieringPolicy.
+  void SetPolicy(const v8::TieringPolicy& policy);
+
   // For use when a JSFunction is available.
   static int InterruptBudgetFor(Isolate* isolate, JSFunction function);
   // For use when no JSFunction is available.
-  static int InitialInterruptBudget();
+  static int InitialInterruptBudget(Isolate* isolate);
 
  private:
   // Make the decision whether to optimize the given function, and mark it for
@@ -62,8 +66,14 @@ class TieringManager {
     DisallowGarbageCollection no_gc;
   };
 
+  // The budgets of the policy, or the flags if the policy leaves them at 0.
+  int SparkplugInterruptBudget() const;
+  int MaglevInterruptBudget() const;
+  int TurbofanInterruptBudget() const;
+
   Isolate* const isolate_;
   bool any_ic_changed_ = false;
+  v8::TieringPolicy policy_;
 };
 
 }  // namespace internal
@@ -0,0 +1,206 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/codegen/optimized-compilation-info.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The profile is a text file with one record per line. Scripts are declared
+// before they are referenced by their index:
+//   script,<script index>,<script name>
+//   function,<script index>,<function literal id>
+//   inlinee,<script index>,<function literal id>,<inlinee script index>,
+//       <inlinee function literal id>
+// The script name comes last, so that it may contain commas.
+constexpr char kScriptMarker[] = "script";
+constexpr char kFunctionMarker[] = "function";
+constexpr char kInlineeMarker[] = "inlinee";
+
+int ReadInt(std::istringstream& line_stream) {
+  std::string token;
+  CHECK(std::getline(line_stream, token, ','));
+  char* end = nullptr;
+  errno = 0;
+  int value = static_cast<int>(strtol(token.c_str(), &end, 10));
+  CHECK(errno == 0 && end != token.c_str());
+  return value;
+}
+
+base::LazyMutex output_mutex = LAZY_MUTEX_INITIALIZER;
+
+// Guarded by {output_mutex}.
+TieringProfile* GetOutputProfile() {
+  static base::LeakyObject<TieringProfile> profile;
+  return profile.get();
+}
+
+}  // namespace
+
+// static
+const TieringProfile* TieringProfile::Input() {
+  static const TieringProfile* input = []() -> const TieringProfile* {
+    const char* filename = FLAG_tiering_profile_input;
+    if (filename == nullptr) return nullptr;
+    std::ifstream file(filename);
+    CHECK_WITH_MSG(file.good(), "Can't read tiering profile");
+    static base::LeakyObject<TieringProfile> profile;
+    profile.get()->Read(file);
+    return profile.get();
+  }();
+  return input;
+}
+
+// static
+void TieringProfile::RecordOptimizedCode(OptimizedCompilationInfo* info) {
+  if (FLAG_tiering_profile_output == nullptr) return;
+  base::Optional<FunctionId> id = GetFunctionId(*info->shared_info());
+  if (!id.has_value()) return;
+  base::MutexGuard guard(output_mutex.Pointer());
+  std::set<FunctionId>& inlinees =
+      GetOutputProfile()->functions_[id.value()];
+  for (const auto& inlined : info->inlined_functions()) {
+    base::Optional<FunctionId> inlinee_id = GetFunctionId(*inlined.shared_info);
+    if (inlinee_id.has_value()) inlinees.insert(inlinee_id.value());
+  }
+}
+
+// static
+void TieringProfile::WriteOutput() {
+  const char* filename = FLAG_tiering_profile_output;
+  if (filename == nullptr) return;
+  base::MutexGuard guard(output_mutex.Pointer());
+  std::ofstream file(filename, std::ios::out | std::ios::trunc);
+  CHECK_WITH_MSG(file.good(), "Can't write tiering profile");
+  GetOutputProfile()->Write(file);
+}
+
+bool TieringProfile::IsHot(SharedFunctionInfo shared) const {
+  base::Optional<FunctionId> id = GetFunctionId(shared);
+  return id.has_value() && functions_.count(id.value()) != 0;
+}
+
+std::vector<Handle<SharedFunctionInfo>> TieringProfile::FindInlinedFunctions(
+    Isolate* isolate, SharedFunctionInfo shared) const {
+  std::vector<Handle<SharedFunctionInfo>> result;
+  base::Optional<FunctionId> id = GetFunctionId(shared);
+  if (!id.has_value()) return result;
+  auto it = functions_.find(id.value());
+  if (it == functions_.end() || it->second.empty()) return result;
+
+  // Look up the scripts by name. Scripts that aren't loaded (yet) don't
+  // contribute any functions.
+  std::map<std::string, Script> scripts;
+  for (const FunctionId& inlinee : it->second) {
+    scripts.emplace(inlinee.script_name, Script());
+  }
+  {
+    DisallowGarbageCollection no_gc;
+    Script::Iterator iterator(isolate);
+    for (Script script = iterator.Next(); !script.is_null();
+         script = iterator.Next()) {
+      if (!script.name().IsString()) continue;
+      auto entry = scripts.find(String::cast(script.name()).ToCString().get());
+      if (entry != scripts.end() && entry->second.is_null()) {
+        entry->second = script;
+      }
+    }
+    for (const FunctionId& inlinee : it->second) {
+      Script script = scripts[inlinee.script_name];
+      if (script.is_null() || inlinee.function_literal_id >=
+                                  script.shared_function_info_count()) {
+        continue;
+      }
+      MaybeObject maybe_shared =
+          script.shared_function_infos().Get(inlinee.function_literal_id);
+      HeapObject heap_object;
+      if (!maybe_shared->GetHeapObject(&heap_object) ||
+          !heap_object.IsSharedFunctionInfo()) {
+        continue;
+      }
+      result.push_back(
+          handle(SharedFunctionInfo::cast(heap_object), isolate));
+    }
+  }
+  return result;
+}
+
+// static
+base::Optional<TieringProfile::FunctionId> TieringProfile::GetFunctionId(
+    SharedFunctionInfo shared) {
+  if (!shared.script().IsScript()) return {};
+  Object name = Script::cast(shared.script()).name();
+  if (!name.IsString() || String::cast(name).length() == 0) return {};
+  int function_literal_id = shared.function_literal_id();
+  if (function_literal_id == kFunctionLiteralIdInvalid) return {};
+  return FunctionId{String::cast(name).ToCString().get(), function_literal_id};
+}
+
+void TieringProfile::Read(std::istream& stream) {
+  std::vector<std::string> script_names;
+  auto read_function_id = [&](std::istringstream& line_stream) {
+    int script_index = ReadInt(line_stream);
+    CHECK_LT(static_cast<size_t>(script_index), script_names.size());
+    return FunctionId{script_names[script_index], ReadInt(line_stream)};
+  };
+  for (std::string line; std::getline(stream, line);) {
+    std::string token;
+    std::istringstream line_stream(line);
+    if (!std::getline(line_stream, token, ',')) continue;
+    if (token == kScriptMarker) {
+      CHECK_EQ(ReadInt(line_stream), static_cast<int>(script_names.size()));
+      std::string script_name;
+      CHECK(std::getline(line_stream, script_name));
+      script_names.push_back(script_name);
+    } else if (token == kFunctionMarker) {
+      functions_[read_function_id(line_stream)];
+    } else if (token == kInlineeMarker) {
+      FunctionId function = read_function_id(line_stream);
+      functions_[function].insert(read_function_id(line_stream));
+    }
+  }
+}
+
+void TieringProfile::Write(std::ostream& stream) const {
+  std::map<std::string, int> script_indices;
+  auto script_index = [&](const std::string& script_name) {
+    auto result = script_indices.emplace(
+        script_name, static_cast<int>(script_indices.size()));
+    if (result.second) {
+      stream << kScriptMarker << "," << result.first->second << ","
+             << script_name << "\n";
+    }
+    return result.first->second;
+  };
+  for (const auto& function : functions_) {
+    const FunctionId& id = function.first;
+    int index = script_index(id.script_name);
+    stream << kFunctionMarker << "," << index << "," << id.function_literal_id
+           << "\n";
+    for (const FunctionId& inlinee : function.second) {
+      int inlinee_index = script_index(inlinee.script_name);
+      stream << kInlineeMarker << "," << index << "," << id.function_literal_id
+             << "," << inlinee_index << "," << inlinee.function_literal_id
+             << "\n";
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "src/base/optional.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class OptimizedCompilationInfo;
+class SharedFunctionInfo;
+
+// A profile of the functions that were optimized by Turbofan, together with
+// the call targets that were inlined into them. The profile is recorded by one
+// process (--tiering-profile-output) and consumed by later processes running
+// the same scripts (--tiering-profile-input): Functions of the profile are
+// optimized as soon as they get their first interrupt tick (see
+// TieringManager), and their previously inlined call targets are inlined
+// regardless of the current call frequency (see JSInliningHeuristic).
+//
+// Functions are identified by the name of their script and their function
+// literal id, both of which are stable as long as the script source doesn't
+// change. A stale profile only leads to worse tiering decisions, never to
+// incorrect behavior.
+class V8_EXPORT_PRIVATE TieringProfile final {
+ public:
+  // The profile read from --tiering-profile-input, or nullptr if there is
+  // none. Immutable, so it can be used from any thread.
+  static const TieringProfile* Input();
+
+  // Adds the function of a successful Turbofan compilation and everything
+  // that was inlined into it to the profile for --tiering-profile-output.
+  // Called on the main thread.
+  static void RecordOptimizedCode(OptimizedCompilationInfo* info);
+
+  // Writes everything recorded by all isolates of the process so far to
+  // --tiering-profile-output.
+  static void WriteOutput();
+
+  bool IsHot(SharedFunctionInfo shared) const;
+
+  // Returns the functions that were inlined into {shared} and that belong to
+  // currently loaded scripts. Called on the main thread.
+  std::vector<Handle<SharedFunctionInfo>> FindInlinedFunctions(
+      Isolate* isolate, SharedFunctionInfo shared) const;
+
+ private:
+  struct FunctionId {
+    std::string script_name;
+    int function_literal_id;
+
+    bool operator<(const FunctionId& other) const {
+      if (function_literal_id != other.function_literal_id) {
+        return function_literal_id < other.function_literal_id;
+      }
+      return script_name < other.script_name;
+    }
+  };
+
+  // Returns nothing for functions without a named script, e.g. eval code.
+  static base::Optional<FunctionId> GetFunctionId(SharedFunctionInfo shared);
+
+  void Read(std::istream& stream);
+  void Write(std::ostream& stream) const;
+
+  // Maps each hot function to the functions that were inlined into it.
+  std::map<FunctionId, std::set<FunctionId>> functions_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
@@ -375,6 +375,14 @@ DEFINE_BOOL(enable_sharedarraybuffer_per_context, false,
 
 #ifdef V8_INTL_SUPPORT
 DEFINE_BOOL(icu_timezone_data, true, "get information about timezones from ICU")
+DEFINE_INT(date_cache_min_year, 1970,
+           "first year covered by the timezone transition table of the date "
+           "cache")
+DEFINE_INT(date_cache_max_year, 2050,
+           "last year covered by the timezone transition table of the date "
+           "cache (disabled if smaller than --date-cache-min-year)")
+DEFINE_INT(intl_object_cache_size, 32,
+           "maximum number of ICU objects cached per isolate for Intl")
 #endif
 
 #ifdef V8_ENABLE_DOUBLE_CONST_STORE_CHECK
@@ -428,6 +436,7 @@ DEFINE_IMPLICATION(lite_mode, optimize_for_size)
 
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, inline_new)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, allocation_site_pretenuring)
+DEFINE_NEG_IMPLICATION(enable_third_party_heap, allocation_sampling_pretenuring)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, turbo_allocation_folding)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(enable_third_party_heap, script_streaming)
@@ -509,9 +518,22 @@ DEFINE_BOOL(future, FUTURE_BOOL,
 DEFINE_BOOL(maglev, false, "enable the maglev optimizing compiler")
 DEFINE_BOOL(maglev_inlining, false,
             "enable inlining in the maglev optimizing compiler")
+DEFINE_INT(max_maglev_inlined_bytecode_size, 460,
+           "maximum size of bytecode for a single inlining in maglev")
+DEFINE_INT(max_maglev_inlined_bytecode_size_cumulative, 920,
+           "maximum cumulative size of bytecode considered for inlining in "
+           "maglev")
+DEFINE_INT(max_maglev_inline_depth, 1,
+           "maximum depth of nested inlining in maglev")
+DEFINE_BOOL(maglev_osr, false,
+            "use maglev as the target tier of on-stack replacement while a "
+            "function is waiting to be compiled with maglev")
+DEFINE_IMPLICATION(maglev_osr, maglev)
 #else
 #define V8_ENABLE_MAGLEV_BOOL false
 DEFINE_BOOL_READONLY(maglev, false, "enable the maglev optimizing compiler")
+DEFINE_BOOL_READONLY(maglev_osr, false,
+                     "use maglev as the target tier of on-stack replacement")
 #endif  // V8_ENABLE_MAGLEV
 
 DEFINE_STRING(maglev_filter, "*", "optimization filter for the maglev compiler")
@@ -519,6 +541,7 @@ DEFINE_BOOL(maglev_break_on_entry, false, "insert an int3 on maglev entries")
 DEFINE_BOOL(print_maglev_graph, false, "print maglev graph")
 DEFINE_BOOL(print_maglev_code, false, "print maglev code")
 DEFINE_BOOL(trace_maglev_regalloc, false, "trace maglev register allocation")
+DEFINE_BOOL(trace_maglev_inlining, false, "trace maglev inlining")
 
 #if ENABLE_SPARKPLUG
 DEFINE_WEAK_IMPLICATION(future, sparkplug)
@@ -599,6 +622,14 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_sampling_pretenuring, false,
+            "pretenure allocations of runtime sources without allocation "
+            "sites based on sampled survival rates")
+DEFINE_INT(allocation_sampling_pretenuring_interval, 64 * KB,
+           "number of bytes allocated in the new space between two samples")
+DEFINE_INT(allocation_sampling_pretenuring_ratio, 85,
+           "min percentage of sampled objects of a source that have to "
+           "survive a scavenge to pretenure the source")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -657,6 +688,8 @@ DEFINE_INT(
 // Flags for inline caching and feedback vectors.
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
+DEFINE_BOOL(stub_cache_resizing, true,
+            "grow the megamorphic stub caches when they miss often")
 
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
@@ -667,11 +700,24 @@ DEFINE_BOOL(ignition_filter_expression_positions, true,
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_trim_generator_registers, true,
+            "only save and restore the registers up to the last one live "
+            "across a generator suspend point")
+DEFINE_BOOL(ignition_inline_class_fields, true,
+            "initialize class fields with literal values directly in base "
+            "class constructors compiled together with their class")
+DEFINE_BOOL(ignition_share_constant_pools, false,
+            "share constant pools with identical contents between bytecode "
+            "arrays")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
             "skip generating source positions during initial compile but "
             "regenerate when actually required")
+DEFINE_BOOL(precollect_source_positions, false,
+            "collect lazy source positions of functions on the stack traces "
+            "of new errors in a foreground task, before they are accessed")
+DEFINE_IMPLICATION(precollect_source_positions, enable_lazy_source_positions)
 DEFINE_BOOL(stress_lazy_source_positions, false,
             "collect lazy source positions immediately after lazy compile")
 DEFINE_STRING(print_bytecode_filter, "*",
@@ -701,6 +747,9 @@ DEFINE_STRING(
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
 DEFINE_BOOL(trace_migration, false, "trace object migration")
+DEFINE_BOOL(eager_instance_migration, false,
+            "migrate all instances of deprecated maps in one batch after the "
+            "next full GC instead of lazily on access")
 DEFINE_BOOL(trace_generalization, false, "trace map generalization")
 
 // Flags for Sparkplug
@@ -772,6 +821,10 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_turbofan_finalization, false,
+            "allocate the code of concurrent TurboFan jobs on the background "
+            "thread, leaving only installation to the main thread")
+DEFINE_NEG_IMPLICATION(predictable, concurrent_turbofan_finalization)
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -895,6 +948,9 @@ DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
 DEFINE_WEAK_IMPLICATION(future, concurrent_osr)
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(osr_code_cache, true,
+            "cache OSR code in the native context, so that it can be shared "
+            "by all feedback vectors of a function")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -907,6 +963,12 @@ DEFINE_BOOL(turbo_profiling_verbose, false,
             "enable basic block profiling in TurboFan, and include each "
             "function's schedule and disassembly in the output")
 DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
+DEFINE_STRING(tiering_profile_input, nullptr,
+              "read hot functions and their inlined call targets from the "
+              "given file and optimize them eagerly")
+DEFINE_STRING(tiering_profile_output, nullptr,
+              "write the functions optimized by TurboFan and their inlined "
+              "call targets to the given file on isolate teardown")
 DEFINE_BOOL(turbo_profiling_log_builtins, false,
             "emit data about basic block usage in builtins to v8.log (requires "
             "that V8 was built with v8_enable_builtins_profiling=true)")
@@ -914,21 +976,41 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
+DEFINE_BOOL(turbo_compare_outcome_hints, true,
+            "move branches that a comparison has never taken out of line in "
+            "TurboFan, based on the outcome feedback of the comparison")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
+DEFINE_BOOL(turbo_allocation_sinking, false,
+            "sink allocations that escape on some paths only to their "
+            "escaping uses in escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
+DEFINE_INT(turbo_compile_budget_ms, 0,
+           "skip optional TurboFan phases once a concurrent job has run "
+           "for this many milliseconds (0 means no budget)")
+DEFINE_BOOL(trace_turbo_compile_budget, false,
+            "trace TurboFan phases skipped due to the compile budget")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_WEAK_IMPLICATION(future, turbo_instruction_scheduling)
+DEFINE_BOOL(trace_turbo_instruction_scheduling, false,
+            "report the estimated cycles of each function before and after "
+            "instruction scheduling, and the latency model in use")
+DEFINE_IMPLICATION(trace_turbo_instruction_scheduling,
+                   turbo_instruction_scheduling)
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
+DEFINE_BOOL(turbo_slp_vectorize, false,
+            "pack adjacent Float64 memory operations into Simd128 operations "
+            "in TurboFan (x64 only)")
 DEFINE_BOOL(turbo_rewrite_far_jumps, true,
             "rewrite far to near jumps (ia32,x64)")
 DEFINE_BOOL(
@@ -937,12 +1019,21 @@ DEFINE_BOOL(
 DEFINE_BOOL(turbo_fast_api_calls, false, "enable fast API calls from TurboFan")
 DEFINE_BOOL(turbo_compress_translation_arrays, false,
             "compress translation arrays (experimental)")
+DEFINE_BOOL(turbo_share_translations, true,
+            "share identical translations between deopt exits of a code "
+            "object")
 DEFINE_WEAK_IMPLICATION(future, turbo_inline_js_wasm_calls)
 DEFINE_BOOL(turbo_inline_js_wasm_calls, false, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
 DEFINE_BOOL(turbo_force_mid_tier_regalloc, false,
             "always use the mid-tier register allocator (for testing)")
+DEFINE_INT(turbo_mid_tier_regalloc_instruction_threshold, 0,
+           "use the mid-tier register allocator for JS functions with more "
+           "instructions than this (0 means never)")
+DEFINE_INT(turbo_mid_tier_regalloc_cold_ticks, 0,
+           "use the mid-tier register allocator for JS functions that got "
+           "fewer profiler ticks than this before optimization")
 
 DEFINE_BOOL(turbo_optimize_apply, true, "optimize Function.prototype.apply")
 
@@ -1006,6 +1097,12 @@ DEFINE_INT(wasm_tiering_budget, 1800000,
 DEFINE_INT(
     wasm_caching_threshold, 1000000,
     "the amount of wasm top tier code that triggers the next caching event")
+DEFINE_BOOL(experimental_wasm_pgo_to_file, false,
+            "experimental: dump the dynamic tiering profile of wasm modules to "
+            "the current working directory when they die")
+DEFINE_BOOL(experimental_wasm_pgo_from_file, false,
+            "experimental: load dynamic tiering profiles of wasm modules from "
+            "the current working directory and tier up hot functions early")
 DEFINE_BOOL(trace_wasm_compilation_times, false,
             "print how long it took to compile each wasm function")
 DEFINE_INT(wasm_tier_up_filter, -1, "only tier-up function with this index")
@@ -1093,6 +1190,12 @@ DEFINE_BOOL(
     "enforce explicit bounds check even if the trap handler is available")
 // "no bounds checks" implies "no enforced bounds checks".
 DEFINE_NEG_NEG_IMPLICATION(wasm_bounds_checks, wasm_enforce_bounds_checks)
+DEFINE_UINT(wasm_guard_region_pool_size, 0,
+            "maximum number of released wasm memory guard region reservations "
+            "kept for reuse by new memories")
+DEFINE_BOOL(wasm_memory64_trap_handling, true,
+            "use the trap handler for memory64 accesses on 64-bit hosts; only "
+            "the upper half of the index is checked explicitly")
 DEFINE_BOOL(wasm_math_intrinsics, true,
             "intrinsify some Math imports into wasm")
 
@@ -1124,6 +1227,10 @@ DEFINE_NEG_IMPLICATION(liftoff_only, wasm_speculative_inlining)
 DEFINE_BOOL(wasm_loop_unrolling, true,
             "enable loop unrolling for wasm functions")
 DEFINE_BOOL(wasm_loop_peeling, false, "enable loop peeling for wasm functions")
+DEFINE_BOOL(wasm_revectorize, false,
+            "combine adjacent 128-bit SIMD operations into 256-bit operations "
+            "on x64 with AVX2 (experimental)")
+DEFINE_BOOL(trace_wasm_revectorize, false, "trace wasm revectorization")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
             "generate a test case when running a wasm fuzzer")
 DEFINE_IMPLICATION(wasm_fuzzer_gen_test, single_threaded)
@@ -1145,10 +1252,16 @@ DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
+DEFINE_BOOL(wasm_shared_import_wrappers, true,
+            "share compiled wasm import wrappers across modules and isolates")
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_flush_code_on_memory_pressure, false,
+            "drop TurboFan code of wasm functions on critical memory pressure "
+            "and recompile it lazily")
+DEFINE_IMPLICATION(wasm_flush_code_on_memory_pressure, wasm_code_gc)
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 
@@ -1190,6 +1303,9 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_FLOAT(scavenge_pause_target_ms, 0.0,
+             "only grow the new space while scavenges are estimated to take "
+             "at most this many ms, and shrink it otherwise (0 disables)")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1210,6 +1326,13 @@ DEFINE_INT(random_gc_interval, 0,
            "Collect garbage after random(0, X) allocations. It overrides "
            "gc_interval.")
 DEFINE_INT(gc_interval, -1, "garbage collect after <n> allocations")
+DEFINE_INT(gc_freelist_strategy, 3,
+           "Freelist strategy to use: "
+           "0:FreeListMany. "
+           "1:FreeListManyCached. "
+           "2:FreeListManyCachedFastPath. "
+           "3:FreeListManyCachedOrigin. "
+           "4:FreeListManyBitmap. ")
 DEFINE_INT(retain_maps_for_n_gc, 2,
            "keeps maps alive for <n> old space garbage collections")
 DEFINE_BOOL(trace_gc, false,
@@ -1217,6 +1340,9 @@ DEFINE_BOOL(trace_gc, false,
 DEFINE_BOOL(trace_gc_nvp, false,
             "print one detailed trace line in name=value format "
             "after each garbage collection")
+DEFINE_INT(gc_phase_histogram_interval_ms, 0,
+           "report per-phase GC pause histograms to the embedder's metrics "
+           "recorder at most every <n> ms (0 disables)")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
 DEFINE_BOOL(trace_idle_notification, false,
@@ -1265,6 +1391,9 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_BOOL(incremental_marking_adaptive_schedule, false,
+            "schedule incremental marking steps based on concurrent marking "
+            "throughput, allocation rate and the remaining heap headroom")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1272,6 +1401,9 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "threshold for starting incremental marking immediately in percent "
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_BOOL(huge_page_pool, false,
+            "carve regular heap pages out of 2MB regions backed by "
+            "transparent huge pages")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
 DEFINE_INT(scavenge_task_trigger, 80,
@@ -1279,6 +1411,9 @@ DEFINE_INT(scavenge_task_trigger, 80,
 DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
+DEFINE_BOOL(scavenger_split_large_arrays, true,
+            "split surviving large FixedArrays into chunks that several "
+            "scavenger tasks can visit in parallel")
 DEFINE_BOOL(cppgc_young_generation, false,
             "run young generation garbage collections in Oilpan")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
@@ -1298,11 +1433,17 @@ DEFINE_BOOL(parallel_marking, V8_CONCURRENT_MARKING_BOOL,
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
+DEFINE_INT(finalization_registry_cleanup_task_budget_ms, 1,
+           "time in ms a FinalizationRegistry cleanup task may spend on "
+           "further dirty FinalizationRegistries after the first one")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_INT(safepoint_spin_iterations, 0,
+           "number of iterations the thread requesting a safepoint spins "
+           "before blocking until all running threads reached it")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1313,6 +1454,10 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_INT(gc_object_stats_sampling_rate, 0,
+           "track object counts and memory usage of live objects by "
+           "inspecting one in N pages on full GCs and scaling the results "
+           "(0 disables sampling)")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1321,6 +1466,11 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 8 * MB,
+              "maximum size of returned zone segments kept for reuse by each "
+              "zone allocator (0 disables the pool)")
+DEFINE_INT(zone_segment_pool_decay_ms, 1000,
+           "free pooled zone segments which were not needed for this long")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1339,6 +1489,10 @@ DEFINE_GENERIC_IMPLICATION(
     trace_gc_object_stats,
     TracingFlags::gc_stats.store(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
+DEFINE_GENERIC_IMPLICATION(
+    gc_object_stats_sampling_rate,
+    TracingFlags::gc_stats.store(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_NEG_IMPLICATION(trace_gc_object_stats, incremental_marking)
 DEFINE_NEG_IMPLICATION(track_retaining_path, parallel_marking)
 DEFINE_NEG_IMPLICATION(track_retaining_path, concurrent_marking)
@@ -1358,12 +1512,18 @@ DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_FLOAT(gc_time_fraction_goal, 0.0,
+             "grow the heap so that at most this fraction of the time is "
+             "spent in GC (0 uses the default heap growing strategy)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
 DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
+DEFINE_SIZE_T(max_code_space_compaction_kb, 0,
+              "Upper bound on the live code (in KBytes) evacuated from code "
+              "space in a single full GC; 0 means no extra bound")
 DEFINE_BOOL(compact_maps, false,
             "Perform compaction on maps on full collections.")
 DEFINE_BOOL(use_map_space, true, "Use separate space for maps.")
@@ -1371,6 +1531,12 @@ DEFINE_BOOL(use_map_space, true, "Use separate space for maps.")
 DEFINE_NEG_VALUE_IMPLICATION(use_map_space, compact_maps, true)
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_BOOL(compact_external_pointer_table, true,
+            "Compact the external pointer table on full collections when it "
+            "is sufficiently sparse (only with sandboxed external pointers)")
+DEFINE_BOOL(mergeable_read_only_space, false,
+            "allow the OS to share read-only space pages with identical pages "
+            "of other processes (Linux only)")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -1384,8 +1550,21 @@ DEFINE_BOOL(stress_compaction_random, false,
             "evacuation candidates. Overrides stress_compaction.")
 DEFINE_BOOL(flush_baseline_code, false,
             "flush of baseline code when it has not been executed recently")
+DEFINE_INT(flush_baseline_code_age, 2,
+           "number of full GCs without running after which baseline code is "
+           "flushed, at most the age from which bytecode is flushed")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_SIZE_T(bytecode_flushing_budget, 0,
+              "soft limit in KB on the bytecode kept by full GCs, met by "
+              "flushing the least recently run bytecode first (0 to flush "
+              "at a fixed age)")
+DEFINE_BOOL(flush_feedback_vectors, false,
+            "flush feedback vectors of functions which were never optimized "
+            "when they have not been executed recently")
+DEFINE_INT(flush_feedback_vector_age, 2,
+           "number of full GCs without running after which feedback vectors "
+           "are flushed")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -1393,6 +1572,8 @@ DEFINE_BOOL(use_marking_progress_bar, true,
             "incremental marking is active.")
 DEFINE_BOOL(stress_per_context_marking_worklist, false,
             "Use per-context worklist for marking")
+DEFINE_BOOL(continuous_memory_measurement, false,
+            "attribute the marked bytes to native contexts in every full GC")
 DEFINE_BOOL(force_marking_deque_overflows, false,
             "force overflows of marking deque by reducing it's size "
             "to 64 words")
@@ -1511,6 +1692,20 @@ DEFINE_BOOL(stress_background_compile, false,
             "stress test parsing on background")
 DEFINE_BOOL(concurrent_cache_deserialization, true,
             "enable deserializing code caches on background")
+DEFINE_BOOL(merge_background_deserialized_script_with_compilation_cache, true,
+            "merge code caches deserialized on background into the matching "
+            "script in the compilation cache")
+DEFINE_BOOL(code_cache_tiering_hints, false,
+            "record functions with stable TurboFan code in code caches, and "
+            "optimize them early after deserialization")
+DEFINE_BOOL(lazy_code_cache_deserialization, false,
+            "serialize the bytecode of leaf functions into separate sections "
+            "of code caches, which are deserialized on the first call")
+DEFINE_BOOL(code_cache_precompile_leaf_functions, false,
+            "compile uncalled leaf functions before serializing code caches, "
+            "so that their first call after deserialization skips parsing")
+DEFINE_IMPLICATION(code_cache_precompile_leaf_functions,
+                   lazy_code_cache_deserialization)
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -1583,6 +1778,13 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_INT(deopt_loop_threshold, 0,
+           "number of deopts for the same reason at the same bytecode offset "
+           "after which Turbofan emits a generic property access there "
+           "(0 = never)")
+DEFINE_INT(max_deopts_per_function, 0,
+           "number of deopts after which a function is no longer optimized "
+           "by Turbofan (0 = no limit)")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -1598,6 +1800,20 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_SIZE_T(compilation_cache_script_size, 0,
+              "max size of the script compilation cache, evicting the least "
+              "recently used scripts (in KB, 0 for no limit)")
+DEFINE_SIZE_T(compilation_cache_eval_size, 0,
+              "max size of each eval compilation cache, evicting the least "
+              "recently used evals (in KB, 0 for no limit)")
+DEFINE_SIZE_T(compilation_cache_regexp_size, 0,
+              "max size of the regexp compilation cache, evicting the least "
+              "recently used regexps (in KB, 0 for no limit)")
+DEFINE_BOOL(process_wide_script_cache, false,
+            "share the code caches of compiled scripts between the isolates "
+            "of the process")
+DEFINE_SIZE_T(process_wide_script_cache_size, 64 * KB,
+              "max size of the process-wide script cache (in KB)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1615,6 +1831,12 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_eager_inner_compile, false,
+            "generate bytecode for the eager inner functions of a script "
+            "compiled in the background on several threads")
+DEFINE_UINT(parallel_eager_inner_compile_max_threads, 0,
+            "max threads for parallel eager inner function compilation (0 for "
+            "unbounded)")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -1662,6 +1884,9 @@ DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
 DEFINE_BOOL(heap_profiler_show_hidden_objects, false,
             "use 'native' rather than 'hidden' node type in snapshot")
+DEFINE_BOOL(heap_snapshot_parallel_serialization, true,
+            "format the nodes and edges of heap snapshots on background "
+            "threads")
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
 DEFINE_BOOL(heap_snapshot_verify, false,
             "verify that heap snapshot matches marking visitor behavior")
@@ -1745,6 +1970,15 @@ DEFINE_BOOL(sim_abort_on_bad_auth, true,
 // isolate.cc
 DEFINE_BOOL(async_stack_traces, true,
             "include async stack traces in Error.stack")
+DEFINE_BOOL(lazy_call_site_infos, false,
+            "capture the raw frames for Error.stack and create the "
+            "CallSiteInfo objects only when the stack is accessed")
+DEFINE_INT(error_stack_dedup_window, 100,
+           "share the raw frames of identical Error.stack traces captured "
+           "within this many milliseconds of each other (0 disables)")
+DEFINE_BOOL(parallel_bigint_arithmetic, true,
+            "use background threads for multiplying and dividing very large "
+            "BigInts")
 DEFINE_BOOL(stack_trace_on_illegal, false,
             "print stack trace when an illegal exception is thrown")
 DEFINE_BOOL(abort_on_uncaught_exception, false,
@@ -1795,11 +2029,22 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "count the runtime call stats counter active on every CPU profiler "
+            "tick instead of timing every counter")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
 
+DEFINE_BOOL(context_cpu_time, false,
+            "attribute thread CPU time to the native context it is spent "
+            "in, see v8::Context::GetCpuTime")
+
 // snapshot-common.cc
 DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
@@ -1809,6 +2054,16 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+
+// snapshot-compression.cc
+DEFINE_BOOL(concurrent_snapshot_decompression, true,
+            "Decompress the chunks of compressed snapshots in parallel.")
+
+// snapshot.cc
+DEFINE_BOOL(background_context_snapshot_decompression, true,
+            "Decompress the context snapshots on a background thread when "
+            "setting up an isolate, and keep them for later contexts.")
+
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -1833,6 +2088,9 @@ DEFINE_BOOL(trace_regexp_assembler, false,
             "trace regexp macro assembler calls.")
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
+DEFINE_BOOL(regexp_bytecode_cache, false,
+            "share regexp bytecode between isolates and keep it when regexp "
+            "data is flushed")
 DEFINE_BOOL(trace_regexp_graph, false, "trace the regexp graph")
 
 DEFINE_BOOL(enable_experimental_regexp_engine, false,
@@ -1843,6 +2101,12 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "let the experimental regexp engine check for a match with a "
+            "lazily built DFA before running its NFA")
+DEFINE_INT(experimental_regexp_engine_dfa_max_states, 1000,
+           "maximum number of states of the experimental regexp engine's "
+           "lazily built DFA")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -1905,6 +2169,13 @@ DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
 DEFINE_BOOL(minor_mc_sweeping, false,
             "perform sweeping in young generation mark compact GCs")
+DEFINE_BOOL(concurrent_minor_mc_marking, false,
+            "perform young generation marking concurrently ahead of the "
+            "minor mark compact pause")
+DEFINE_IMPLICATION(concurrent_minor_mc_marking, minor_mc)
+DEFINE_INT(minor_mc_concurrent_marking_trigger, 50,
+           "start concurrent young generation marking when the new space is "
+           "filled up to this percentage of its capacity")
 
 //
 // Dev shell flags
@@ -2022,6 +2293,9 @@ DEFINE_STRING(logfile, "v8.log",
               "Specify the name of the log file, use '-' for console, '+' for "
               "a temporary file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(log_binary, false,
+            "Write the log file in a compact binary format, which the tick "
+            "processor reads as well.")
 
 DEFINE_BOOL(log, false,
             "Minimal logging (no API, code, GC, suspect, or handles samples).")
@@ -2225,6 +2499,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, heap_snapshot_parallel_serialization)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint_arithmetic)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
@@ -2237,6 +2513,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_minor_mc_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 
 // Web snapshots: 1) expose WebSnapshot.* API 2) interpret scripts as web
@@ -2244,6 +2521,9 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 // TODO(v8:11525): Remove this flag once proper embedder integration is done.
 DEFINE_BOOL(experimental_web_snapshots, false, "enable Web Snapshots")
 DEFINE_NEG_IMPLICATION(experimental_web_snapshots, script_streaming)
+DEFINE_BOOL(web_snapshot_concurrent_string_decoding, true,
+            "decode the string table of large web snapshots on worker "
+            "threads")
 
 #undef FLAG
 
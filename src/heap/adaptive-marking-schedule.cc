@@ -0,0 +1,79 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/adaptive-marking-schedule.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace v8 {
+namespace internal {
+
+void AdaptiveMarkingSchedule::Start(double now_ms, size_t estimated_live_bytes,
+                                    size_t allocation_counter_bytes) {
+  start_time_ms_ = now_ms;
+  last_update_time_ms_ = now_ms;
+  estimated_live_bytes_ = estimated_live_bytes;
+  last_allocation_counter_bytes_ = allocation_counter_bytes;
+  allocation_rate_in_bytes_per_ms_ = 0.0;
+  concurrent_marking_speed_in_bytes_per_ms_ = 0.0;
+  target_finish_time_ms_ = now_ms + kTargetMarkingWallTimeInMs;
+}
+
+size_t AdaptiveMarkingSchedule::BytesToMarkOnMainThread(
+    double now_ms, size_t marked_bytes, size_t concurrently_marked_bytes,
+    size_t allocation_counter_bytes, size_t headroom_bytes) {
+  const double interval_ms = now_ms - last_update_time_ms_;
+  if (interval_ms <= 0) return 0;
+  last_update_time_ms_ = now_ms;
+
+  // The allocation counter is monotonic within a cycle; smooth the rate so
+  // that a single burst moves the deadline but does not dominate it.
+  const size_t allocated_bytes =
+      allocation_counter_bytes >= last_allocation_counter_bytes_
+          ? allocation_counter_bytes - last_allocation_counter_bytes_
+          : 0;
+  last_allocation_counter_bytes_ = allocation_counter_bytes;
+  const double interval_rate = allocated_bytes / interval_ms;
+  allocation_rate_in_bytes_per_ms_ =
+      allocation_rate_in_bytes_per_ms_ == 0.0
+          ? interval_rate
+          : kAllocationRateSmoothing * interval_rate +
+                (1 - kAllocationRateSmoothing) *
+                    allocation_rate_in_bytes_per_ms_;
+
+  const double elapsed_ms = now_ms - start_time_ms_;
+  if (elapsed_ms > 0) {
+    concurrent_marking_speed_in_bytes_per_ms_ =
+        concurrently_marked_bytes / elapsed_ms;
+  }
+
+  // Finish before the mutator runs out of headroom, and never later than the
+  // wall time budget of a cycle.
+  double deadline_ms = start_time_ms_ + kTargetMarkingWallTimeInMs;
+  if (allocation_rate_in_bytes_per_ms_ > 0) {
+    deadline_ms =
+        std::min(deadline_ms,
+                 now_ms + headroom_bytes / allocation_rate_in_bytes_per_ms_);
+  }
+  target_finish_time_ms_ = deadline_ms;
+  const double remaining_ms =
+      std::max(deadline_ms - now_ms, kMinRemainingTimeInMs);
+
+  if (marked_bytes >= estimated_live_bytes_) return 0;
+  const double remaining_bytes =
+      static_cast<double>(estimated_live_bytes_ - marked_bytes);
+  const double concurrent_bytes =
+      concurrent_marking_speed_in_bytes_per_ms_ * remaining_ms;
+  if (concurrent_bytes >= remaining_bytes) return 0;
+
+  // Spread the work that is left for the main thread evenly over the
+  // remaining time; this step covers the time since the previous one.
+  const double main_thread_bytes = remaining_bytes - concurrent_bytes;
+  return static_cast<size_t>(
+      std::ceil(main_thread_bytes * std::min(1.0, interval_ms / remaining_ms)));
+}
+
+}  // namespace internal
+}  // namespace v8
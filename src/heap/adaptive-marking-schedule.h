@@ -0,0 +1,70 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ADAPTIVE_MARKING_SCHEDULE_H_
+#define V8_HEAP_ADAPTIVE_MARKING_SCHEDULE_H_
+
+#include <cstddef>
+
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Feedback schedule for incremental marking of the V8 heap, modelled after
+// cppgc::internal::IncrementalMarkingSchedule. Instead of a fixed time budget
+// it derives a target finish time from the mutator allocation rate and the
+// remaining headroom below the old generation allocation limit, and only
+// asks the main thread to mark what concurrent marking is not expected to
+// cover by then.
+//
+// The schedule is a pure computation on the values passed in, so it can be
+// tested without a heap. All times are in milliseconds.
+class V8_EXPORT_PRIVATE AdaptiveMarkingSchedule final {
+ public:
+  // Upper bound on the marking wall time when there is no allocation
+  // pressure. Matches the time based schedule of IncrementalMarking.
+  static constexpr double kTargetMarkingWallTimeInMs = 500;
+  // Lower bound on the remaining time used for planning, so that a cycle
+  // that is already late catches up over a few steps rather than in one.
+  static constexpr double kMinRemainingTimeInMs = 5;
+  // Weight of the most recent interval in the smoothed allocation rate.
+  static constexpr double kAllocationRateSmoothing = 0.5;
+
+  void Start(double now_ms, size_t estimated_live_bytes,
+             size_t allocation_counter_bytes);
+
+  // Returns the number of bytes the main thread should mark right now, on top
+  // of everything marked so far. |marked_bytes| includes
+  // |concurrently_marked_bytes|. |headroom_bytes| is the number of bytes that
+  // can still be allocated before the heap limit forces finalization.
+  size_t BytesToMarkOnMainThread(double now_ms, size_t marked_bytes,
+                                 size_t concurrently_marked_bytes,
+                                 size_t allocation_counter_bytes,
+                                 size_t headroom_bytes);
+
+  // Absolute time at which marking is planned to finish, as of the last call
+  // to BytesToMarkOnMainThread().
+  double target_finish_time_ms() const { return target_finish_time_ms_; }
+  double allocation_rate_in_bytes_per_ms() const {
+    return allocation_rate_in_bytes_per_ms_;
+  }
+  double concurrent_marking_speed_in_bytes_per_ms() const {
+    return concurrent_marking_speed_in_bytes_per_ms_;
+  }
+
+ private:
+  double start_time_ms_ = 0.0;
+  double last_update_time_ms_ = 0.0;
+  size_t estimated_live_bytes_ = 0;
+  size_t last_allocation_counter_bytes_ = 0;
+  double allocation_rate_in_bytes_per_ms_ = 0.0;
+  double concurrent_marking_speed_in_bytes_per_ms_ = 0.0;
+  double target_finish_time_ms_ = 0.0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ADAPTIVE_MARKING_SCHEDULE_H_
@@ -4,16 +4,18 @@
 
 #include "src/heap/array-buffer-sweeper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 
+#include "include/v8-array-buffer.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
-#include "src/tasks/cancelable-task.h"
-#include "src/tasks/task-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -75,29 +77,147 @@ bool ArrayBufferList::IsEmpty() const {
   return head_ == nullptr;
 }
 
+namespace {
+
+// Collects the memory of dead backing stores and hands it to the embedder's
+// allocator in batches instead of freeing every backing store on its own.
+class BackingStoreFreeBatch final {
+ public:
+  static constexpr size_t kBatchSize = 64;
+
+  explicit BackingStoreFreeBatch(v8::ArrayBuffer::Allocator* allocator)
+      : allocator_(allocator) {}
+  ~BackingStoreFreeBatch() { Flush(); }
+
+  BackingStoreFreeBatch(const BackingStoreFreeBatch&) = delete;
+  BackingStoreFreeBatch& operator=(const BackingStoreFreeBatch&) = delete;
+
+  // Deletes the extension and queues the memory of its backing store for
+  // freeing if the extension held the last reference to it.
+  void Delete(ArrayBufferExtension* extension) {
+    std::shared_ptr<BackingStore> backing_store =
+        extension->RemoveBackingStore();
+    delete extension;
+    if (!allocator_ || !backing_store || backing_store.use_count() != 1) {
+      return;
+    }
+    void* buffer_start;
+    size_t byte_length;
+    if (backing_store->ReleaseAllocationForBatchedFree(
+            allocator_, &buffer_start, &byte_length)) {
+      buffer_starts_[count_] = buffer_start;
+      byte_lengths_[count_] = byte_length;
+      if (++count_ == kBatchSize) Flush();
+    }
+    // Otherwise, the memory is freed when the last reference to the backing
+    // store is dropped.
+  }
+
+  void Flush() {
+    if (count_ == 0) return;
+    allocator_->FreeBatch(buffer_starts_, byte_lengths_, count_);
+    count_ = 0;
+  }
+
+ private:
+  v8::ArrayBuffer::Allocator* const allocator_;
+  void* buffer_starts_[kBatchSize];
+  size_t byte_lengths_[kBatchSize];
+  size_t count_ = 0;
+};
+
+}  // namespace
+
 struct ArrayBufferSweeper::SweepingJob final {
-  SweepingJob(ArrayBufferList young, ArrayBufferList old, SweepingType type)
+  // Number of extensions that are swept as one unit of work.
+  static constexpr size_t kChunkSize = 1024;
+
+  SweepingJob(ArrayBufferList young, ArrayBufferList old, SweepingType type,
+              v8::ArrayBuffer::Allocator* allocator)
       : state_(SweepingState::kInProgress),
-        young_(std::move(young)),
-        old_(std::move(old)),
-        type_(type) {}
+        unswept_young_(young.head_),
+        unswept_old_(old.head_),
+        type_(type),
+        allocator_(allocator) {
+    if (!unswept_young_ && !unswept_old_) {
+      has_unclaimed_chunks_ = false;
+      state_ = SweepingState::kDone;
+    }
+  }
+
+  // Sweeps chunks until all of them are claimed or the delegate asks to
+  // yield. The delegate may be nullptr when sweeping on the main thread.
+  void Sweep(JobDelegate* delegate);
 
-  void Sweep();
-  void SweepYoung();
-  void SweepFull();
-  ArrayBufferList SweepListFull(ArrayBufferList* list);
+  bool HasUnclaimedChunks() const {
+    return has_unclaimed_chunks_.load(std::memory_order_relaxed);
+  }
 
  private:
-  CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
+  struct Chunk {
+    ArrayBufferExtension* head = nullptr;
+    size_t length = 0;
+    bool is_young = false;
+  };
+
+  bool ClaimChunk(Chunk* chunk);
+  void SweepChunk(const Chunk& chunk);
+
   std::atomic<SweepingState> state_;
+  std::atomic<bool> has_unclaimed_chunks_{true};
+  base::Mutex mutex_;
+  // Extensions that are not yet claimed by any chunk. Guarded by mutex_.
+  ArrayBufferExtension* unswept_young_;
+  ArrayBufferExtension* unswept_old_;
+  // Chunks that are claimed but not yet merged. Guarded by mutex_.
+  size_t chunks_in_progress_ = 0;
+  // Swept lists. Guarded by mutex_ until the job is done.
   ArrayBufferList young_;
   ArrayBufferList old_;
   const SweepingType type_;
+  v8::ArrayBuffer::Allocator* const allocator_;
   std::atomic<size_t> freed_bytes_{0};
 
   friend class ArrayBufferSweeper;
 };
 
+class ArrayBufferSweeper::SweepingTask final : public JobTask {
+ public:
+  // Upper bound on the number of threads that sweep at the same time.
+  static constexpr size_t kMaxTasks = 4;
+
+  SweepingTask(Heap* heap, SweepingJob* job, SweepingType type)
+      : tracer_(heap->tracer()), job_(job), type_(type) {}
+
+  ~SweepingTask() override = default;
+  SweepingTask(const SweepingTask&) = delete;
+  SweepingTask& operator=(const SweepingTask&) = delete;
+
+  void Run(JobDelegate* delegate) final {
+    if (delegate->IsJoiningThread()) {
+      // The main thread is accounted for in EnsureFinished().
+      job_->Sweep(delegate);
+    } else {
+      GCTracer::Scope::ScopeId scope_id =
+          type_ == SweepingType::kYoung
+              ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
+              : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
+      TRACE_GC_EPOCH(tracer_, scope_id, ThreadKind::kBackground);
+      job_->Sweep(delegate);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return std::min<size_t>(
+        kMaxTasks, worker_count + (job_->HasUnclaimedChunks() ? 1 : 0));
+  }
+
+ private:
+  GCTracer* const tracer_;
+  SweepingJob* const job_;
+  const SweepingType type_;
+};
+
 ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
@@ -110,27 +230,11 @@ void ArrayBufferSweeper::EnsureFinished() {
   if (!sweeping_in_progress()) return;
 
   TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_COMPLETE_SWEEP_ARRAY_BUFFERS);
-  TryAbortResult abort_result =
-      heap_->isolate()->cancelable_task_manager()->TryAbort(job_->id_);
-
-  switch (abort_result) {
-    case TryAbortResult::kTaskAborted:
-      // Task has not run, so we need to run it synchronously here.
-      job_->Sweep();
-      break;
-    case TryAbortResult::kTaskRemoved:
-      // Task was removed, but did actually run, just ensure we are in the right
-      // state.
-      CHECK_EQ(SweepingState::kDone, job_->state_);
-      break;
-    case TryAbortResult::kTaskRunning: {
-      // Task is running. Wait until task is finished with its work.
-      base::MutexGuard guard(&sweeping_mutex_);
-      while (job_->state_ != SweepingState::kDone) {
-        job_finished_.Wait(&sweeping_mutex_);
-      }
-      break;
-    }
+  if (job_handle_ && job_handle_->IsValid()) {
+    // Contribute to sweeping and wait for the background threads to finish.
+    job_handle_->Join();
+  } else {
+    job_->Sweep(nullptr);
   }
 
   Finalize();
@@ -142,6 +246,9 @@ void ArrayBufferSweeper::FinishIfDone() {
   if (sweeping_in_progress()) {
     DCHECK(job_);
     if (job_->state_ == SweepingState::kDone) {
+      // Workers may still be about to return from the job, so wait for them
+      // before the job is destroyed.
+      if (job_handle_ && job_handle_->IsValid()) job_handle_->Join();
       Finalize();
     }
   }
@@ -156,20 +263,11 @@ void ArrayBufferSweeper::RequestSweep(SweepingType type) {
   Prepare(type);
   if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
       FLAG_concurrent_array_buffer_sweeping) {
-    auto task = MakeCancelableTask(heap_->isolate(), [this, type] {
-      GCTracer::Scope::ScopeId scope_id =
-          type == SweepingType::kYoung
-              ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
-              : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
-      TRACE_GC_EPOCH(heap_->tracer(), scope_id, ThreadKind::kBackground);
-      base::MutexGuard guard(&sweeping_mutex_);
-      job_->Sweep();
-      job_finished_.NotifyAll();
-    });
-    job_->id_ = task->id();
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<SweepingTask>(heap_, job_.get(), type));
   } else {
-    job_->Sweep();
+    job_->Sweep(nullptr);
     Finalize();
   }
 }
@@ -178,13 +276,15 @@ void ArrayBufferSweeper::Prepare(SweepingType type) {
   DCHECK(!sweeping_in_progress());
   switch (type) {
     case SweepingType::kYoung: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), ArrayBufferList(),
-                                           type);
+      job_ = std::make_unique<SweepingJob>(
+          std::move(young_), ArrayBufferList(), type,
+          heap_->isolate()->array_buffer_allocator());
       young_ = ArrayBufferList();
     } break;
     case SweepingType::kFull: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), std::move(old_),
-                                           type);
+      job_ = std::make_unique<SweepingJob>(
+          std::move(young_), std::move(old_), type,
+          heap_->isolate()->array_buffer_allocator());
       young_ = ArrayBufferList();
       old_ = ArrayBufferList();
     } break;
@@ -200,6 +300,7 @@ void ArrayBufferSweeper::Finalize() {
   const size_t freed_bytes =
       job_->freed_bytes_.exchange(0, std::memory_order_relaxed);
   DecrementExternalMemoryCounters(freed_bytes);
+  job_handle_.reset();
   job_.reset();
   DCHECK(!sweeping_in_progress());
 }
@@ -271,79 +372,83 @@ void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
   heap_->update_external_memory(-static_cast<int64_t>(bytes));
 }
 
-void ArrayBufferSweeper::SweepingJob::Sweep() {
-  CHECK_EQ(state_, SweepingState::kInProgress);
-  switch (type_) {
-    case SweepingType::kYoung:
-      SweepYoung();
-      break;
-    case SweepingType::kFull:
-      SweepFull();
-      break;
+void ArrayBufferSweeper::SweepingJob::Sweep(JobDelegate* delegate) {
+  Chunk chunk;
+  while ((!delegate || !delegate->ShouldYield()) && ClaimChunk(&chunk)) {
+    SweepChunk(chunk);
   }
-  state_ = SweepingState::kDone;
 }
 
-void ArrayBufferSweeper::SweepingJob::SweepFull() {
-  DCHECK_EQ(SweepingType::kFull, type_);
-  ArrayBufferList promoted = SweepListFull(&young_);
-  ArrayBufferList survived = SweepListFull(&old_);
-
-  old_ = std::move(promoted);
-  old_.Append(&survived);
-}
-
-ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
-    ArrayBufferList* list) {
-  ArrayBufferExtension* current = list->head_;
-  ArrayBufferList survivor_list;
-
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-
-    if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
-    } else {
-      current->Unmark();
-      survivor_list.Append(current);
-    }
-
-    current = next;
+bool ArrayBufferSweeper::SweepingJob::ClaimChunk(Chunk* chunk) {
+  base::MutexGuard guard(&mutex_);
+  ArrayBufferExtension** unswept =
+      unswept_young_ ? &unswept_young_ : &unswept_old_;
+  if (!*unswept) return false;
+  chunk->head = *unswept;
+  chunk->length = 0;
+  chunk->is_young = unswept == &unswept_young_;
+  ArrayBufferExtension* current = *unswept;
+  while (current && chunk->length < kChunkSize) {
+    current = current->next();
+    chunk->length++;
   }
-
-  *list = ArrayBufferList();
-  return survivor_list;
+  *unswept = current;
+  chunks_in_progress_++;
+  if (!unswept_young_ && !unswept_old_) {
+    has_unclaimed_chunks_.store(false, std::memory_order_relaxed);
+  }
+  return true;
 }
 
-void ArrayBufferSweeper::SweepingJob::SweepYoung() {
-  DCHECK_EQ(SweepingType::kYoung, type_);
-  ArrayBufferExtension* current = young_.head_;
-
+void ArrayBufferSweeper::SweepingJob::SweepChunk(const Chunk& chunk) {
+  BackingStoreFreeBatch free_batch(allocator_);
   ArrayBufferList new_young;
   ArrayBufferList new_old;
+  size_t freed_bytes = 0;
 
-  while (current) {
+  ArrayBufferExtension* current = chunk.head;
+  for (size_t i = 0; i < chunk.length; i++) {
+    DCHECK_NOT_NULL(current);
     ArrayBufferExtension* next = current->next();
 
-    if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
-    } else if (current->IsYoungPromoted()) {
-      current->YoungUnmark();
-      new_old.Append(current);
+    if (type_ == SweepingType::kYoung) {
+      DCHECK(chunk.is_young);
+      if (!current->IsYoungMarked()) {
+        freed_bytes += current->accounting_length();
+        free_batch.Delete(current);
+      } else if (current->IsYoungPromoted()) {
+        current->YoungUnmark();
+        new_old.Append(current);
+      } else {
+        current->YoungUnmark();
+        new_young.Append(current);
+      }
     } else {
-      current->YoungUnmark();
-      new_young.Append(current);
+      DCHECK_EQ(SweepingType::kFull, type_);
+      // Surviving young extensions are promoted to the old list.
+      if (!current->IsMarked()) {
+        freed_bytes += current->accounting_length();
+        free_batch.Delete(current);
+      } else {
+        current->Unmark();
+        new_old.Append(current);
+      }
     }
 
     current = next;
   }
+  free_batch.Flush();
+  if (freed_bytes) {
+    freed_bytes_.fetch_add(freed_bytes, std::memory_order_relaxed);
+  }
 
-  old_ = new_old;
-  young_ = new_young;
+  base::MutexGuard guard(&mutex_);
+  young_.Append(&new_young);
+  old_.Append(&new_old);
+  DCHECK_LT(0, chunks_in_progress_);
+  if (--chunks_in_progress_ == 0 && !unswept_young_ && !unswept_old_) {
+    state_ = SweepingState::kDone;
+  }
 }
 
 }  // namespace internal
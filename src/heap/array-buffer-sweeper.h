@@ -7,8 +7,8 @@
 
 #include <memory>
 
+#include "include/v8-platform.h"
 #include "src/base/logging.h"
-#include "src/base/platform/mutex.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
 
@@ -42,7 +42,8 @@ struct ArrayBufferList final {
 };
 
 // The ArrayBufferSweeper iterates and deletes ArrayBufferExtensions
-// concurrently to the application.
+// concurrently to the application. The lists are split into chunks that are
+// swept in parallel by a job.
 class ArrayBufferSweeper final {
  public:
   enum class SweepingType { kYoung, kFull };
@@ -69,6 +70,7 @@ class ArrayBufferSweeper final {
 
  private:
   struct SweepingJob;
+  class SweepingTask;
 
   enum class SweepingState { kInProgress, kDone };
 
@@ -89,8 +91,7 @@ class ArrayBufferSweeper final {
 
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
-  base::Mutex sweeping_mutex_;
-  base::ConditionVariable job_finished_;
+  std::unique_ptr<JobHandle> job_handle_;
   ArrayBufferList young_;
   ArrayBufferList old_;
 };
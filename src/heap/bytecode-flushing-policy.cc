@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/bytecode-flushing-policy.h"
+
+#include <algorithm>
+
+#include "src/flags/flags.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+BytecodeFlushingPolicy::BytecodeFlushingPolicy()
+    : flush_age_(BytecodeArray::kIsOldBytecodeAge) {
+  for (auto& bytes : retained_bytes_) bytes.store(0);
+  set_budget(FLAG_bytecode_flushing_budget * KB);
+}
+
+void BytecodeFlushingPolicy::set_budget(size_t budget_in_bytes) {
+  budget_.store(budget_in_bytes, std::memory_order_relaxed);
+  if (budget_in_bytes == 0) {
+    flush_age_.store(BytecodeArray::kIsOldBytecodeAge,
+                     std::memory_order_relaxed);
+  }
+}
+
+int BytecodeFlushingPolicy::baseline_flush_age() const {
+  // Bytecode of age 0 ran since the last GC, and so did its baseline code.
+  int age = std::max(BytecodeArray::kFirstBytecodeAge + 1,
+                     FLAG_flush_baseline_code_age);
+  return std::min(age, flush_age());
+}
+
+int BytecodeFlushingPolicy::feedback_vector_flush_age() const {
+  // Bytecode of age 0 ran since the last GC, and its feedback is still used.
+  return std::min(std::max(BytecodeArray::kFirstBytecodeAge + 1,
+                           FLAG_flush_feedback_vector_age),
+                  static_cast<int>(BytecodeArray::kLastBytecodeAge));
+}
+
+void BytecodeFlushingPolicy::UpdateFlushAge() {
+  size_t retained[BytecodeArray::kLastBytecodeAge + 1];
+  size_t total = 0;
+  for (int age = 0; age <= BytecodeArray::kLastBytecodeAge; age++) {
+    retained[age] = retained_bytes_[age].exchange(0, std::memory_order_relaxed);
+    total += retained[age];
+  }
+  size_t budget = this->budget();
+  if (budget == 0) return;
+
+  // Bytecode of age 0 ran since the last GC and is never flushed, so the
+  // lowest flush age is 1 even if that does not meet the budget.
+  int new_age = BytecodeArray::kFirstBytecodeAge + 1;
+  size_t kept = retained[BytecodeArray::kFirstBytecodeAge];
+  for (int age = new_age + 1; age <= BytecodeArray::kLastBytecodeAge; age++) {
+    kept += retained[age - 1];
+    if (kept > budget) break;
+    new_age = age;
+  }
+
+  if (FLAG_trace_flush_bytecode) {
+    PrintF("[bytecode flushing] retained %zu KB of %zu KB budget, "
+           "flushing from age %d (was %d)\n",
+           total / KB, budget / KB, new_age, flush_age());
+  }
+  flush_age_.store(new_age, std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace v8
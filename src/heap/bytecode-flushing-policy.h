@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+#define V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
+
+#include <atomic>
+
+#include "src/objects/code.h"
+
+namespace v8 {
+namespace internal {
+
+// Decides from which age full GCs flush bytecode. Without a budget this is
+// always BytecodeArray::kIsOldBytecodeAge. With a budget, marking records the
+// bytecode it retains by age, and the next GC flushes from the highest age
+// that would have kept the retained bytecode within the budget. The bytecode
+// that has gone the most GCs without running is thus flushed first, and
+// bytecode in use is kept for longer while there is room for it.
+class BytecodeFlushingPolicy final {
+ public:
+  BytecodeFlushingPolicy();
+  BytecodeFlushingPolicy(const BytecodeFlushingPolicy&) = delete;
+  BytecodeFlushingPolicy& operator=(const BytecodeFlushingPolicy&) = delete;
+
+  // A budget of 0 disables the adaptive policy. Takes effect with the next
+  // full GC.
+  void set_budget(size_t budget_in_bytes);
+  size_t budget() const { return budget_.load(std::memory_order_relaxed); }
+
+  // Whether marking should call RecordRetainedBytecode.
+  bool records_retained_bytecode() const { return budget() > 0; }
+
+  // Bytecode of this age or older may be flushed. Only changes between GCs.
+  int flush_age() const { return flush_age_.load(std::memory_order_relaxed); }
+
+  // Baseline code of this age or older may be flushed. Baseline code is much
+  // larger than bytecode, so it is flushed from a lower age, given by
+  // --flush-baseline-code-age, but never later than bytecode.
+  int baseline_flush_age() const;
+
+  // Feedback vectors of functions which never tiered up are flushed once
+  // their bytecode reaches this age, given by --flush-feedback-vector-age.
+  // Unlike the other ages it does not change between GCs.
+  int feedback_vector_flush_age() const;
+
+  // Records that marking retained |size| bytes of bytecode of |age|. Called
+  // concurrently by the marking visitors.
+  void RecordRetainedBytecode(int age, size_t size) {
+    DCHECK_GE(age, BytecodeArray::kFirstBytecodeAge);
+    DCHECK_LE(age, BytecodeArray::kLastBytecodeAge);
+    retained_bytes_[age].fetch_add(size, std::memory_order_relaxed);
+  }
+
+  // Picks the flush age of the next full GC from the bytecode retained by the
+  // current one. Called on the main thread once marking has finished.
+  void UpdateFlushAge();
+
+ private:
+  std::atomic<size_t> budget_{0};
+  std::atomic<int> flush_age_;
+  std::atomic<size_t> retained_bytes_[BytecodeArray::kLastBytecodeAge + 1];
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_BYTECODE_FLUSHING_POLICY_H_
@@ -16,19 +16,36 @@ namespace internal {
 
 namespace {
 
-// Mutex for creating process_wide_code_range_.
-base::LazyMutex process_wide_code_range_creation_mutex_ =
-    LAZY_MUTEX_INITIALIZER;
-
-// Weak pointer holding the process-wide CodeRange, if one has been created. All
-// Heaps hold a std::shared_ptr to this, so this is destroyed when no Heaps
-// remain.
-base::LazyInstance<std::weak_ptr<CodeRange>>::type process_wide_code_range_ =
-    LAZY_INSTANCE_INITIALIZER;
-
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
 void FunctionInStaticBinaryForAddressHint() {}
+
+// A copy of the binary-embedded builtins in shared memory, for code ranges
+// which cannot remap the builtins from the binary. It is created once and
+// lives as long as the process, like the blob it copies.
+base::LazyMutex shared_embedded_blob_code_mutex = LAZY_MUTEX_INITIALIZER;
+v8::PageAllocator::SharedMemory* shared_embedded_blob_code = nullptr;
+
+v8::PageAllocator::SharedMemory* GetSharedEmbeddedBlobCode(
+    const uint8_t* embedded_blob_code, size_t size) {
+  base::MutexGuard guard(shared_embedded_blob_code_mutex.Pointer());
+  if (shared_embedded_blob_code == nullptr) {
+    v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+    std::unique_ptr<v8::PageAllocator::SharedMemory> shared_memory =
+        page_allocator->AllocateSharedPages(size, embedded_blob_code);
+    if (!shared_memory) return nullptr;
+    // The original mapping must not stay a writable alias of the executable
+    // mappings in the code ranges.
+    if (!page_allocator->SetPermissions(shared_memory->GetMemory(), size,
+                                        PageAllocator::kRead)) {
+      return nullptr;
+    }
+    shared_embedded_blob_code = shared_memory.release();
+  }
+  DCHECK_IMPLIES(shared_embedded_blob_code,
+                 shared_embedded_blob_code->GetSize() == size);
+  return shared_embedded_blob_code;
+}
 }  // anonymous namespace
 
 Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size,
@@ -171,6 +188,7 @@ void CodeRange::Free() {
   if (IsReserved()) {
     GetCodeRangeAddressHint()->NotifyFreedCodeRange(
         reservation()->region().begin(), reservation()->region().size());
+    embedded_blob_code_mapping_.reset();
     VirtualMemoryCage::Free();
   }
 }
@@ -242,6 +260,45 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
     }
   }
 
+  if (!V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT &&
+      Isolate::CurrentEmbeddedBlobIsBinaryEmbedded() &&
+      embedded_blob_code == Isolate::CurrentEmbeddedBlobCode() &&
+      GetPlatformPageAllocator()->CanAllocateSharedPages()) {
+    // Remapping from the binary failed, e.g. because the binary isn't backed
+    // by a file. Rather than giving every code range its own private copy,
+    // map a single shared copy into all of them, so that e.g. the code ranges
+    // of several isolate groups share the physical pages.
+    //
+    // Copying the shared memory reads up to the end of the last page of the
+    // blob, which is only safe if the blob starts at a page boundary.
+    const size_t kSharedPageSize =
+        GetPlatformPageAllocator()->AllocatePageSize();
+    size_t shared_size = RoundUp(embedded_blob_code_size, kSharedPageSize);
+    if (shared_size <= allocate_code_size &&
+        IsAligned(reinterpret_cast<uintptr_t>(embedded_blob_code),
+                  kSharedPageSize)) {
+      v8::PageAllocator::SharedMemory* shared_memory =
+          GetSharedEmbeddedBlobCode(embedded_blob_code, shared_size);
+      if (shared_memory) {
+        embedded_blob_code_mapping_ =
+            shared_memory->RemapTo(embedded_blob_code_copy);
+      }
+      if (embedded_blob_code_mapping_) {
+        DCHECK_EQ(embedded_blob_code_mapping_->GetMemory(),
+                  embedded_blob_code_copy);
+        if (!page_allocator()->SetPermissions(embedded_blob_code_copy,
+                                              shared_size,
+                                              PageAllocator::kReadExecute)) {
+          V8::FatalProcessOutOfMemory(isolate,
+                                      "Re-embedded builtins: set permissions");
+        }
+        embedded_blob_code_copy_.store(embedded_blob_code_copy,
+                                       std::memory_order_release);
+        return embedded_blob_code_copy;
+      }
+    }
+  }
+
   if (V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT) {
     if (!page_allocator()->RecommitPages(embedded_blob_code_copy, code_size,
                                          PageAllocator::kReadWriteExecute)) {
@@ -272,26 +329,5 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
   return embedded_blob_code_copy;
 }
 
-// static
-std::shared_ptr<CodeRange> CodeRange::EnsureProcessWideCodeRange(
-    v8::PageAllocator* page_allocator, size_t requested_size) {
-  base::MutexGuard guard(process_wide_code_range_creation_mutex_.Pointer());
-  std::shared_ptr<CodeRange> code_range = process_wide_code_range_.Get().lock();
-  if (!code_range) {
-    code_range = std::make_shared<CodeRange>();
-    if (!code_range->InitReservation(page_allocator, requested_size)) {
-      V8::FatalProcessOutOfMemory(
-          nullptr, "Failed to reserve virtual memory for CodeRange");
-    }
-    *process_wide_code_range_.Pointer() = code_range;
-  }
-  return code_range;
-}
-
-// static
-std::shared_ptr<CodeRange> CodeRange::GetProcessWideCodeRange() {
-  return process_wide_code_range_.Get().lock();
-}
-
 }  // namespace internal
 }  // namespace v8
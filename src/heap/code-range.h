@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_CODE_RANGE_H_
 #define V8_HEAP_CODE_RANGE_H_
 
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -129,18 +130,16 @@ class CodeRange final : public VirtualMemoryCage {
                                  const uint8_t* embedded_blob_code,
                                  size_t embedded_blob_code_size);
 
-  static std::shared_ptr<CodeRange> EnsureProcessWideCodeRange(
-      v8::PageAllocator* page_allocator, size_t requested_size);
-
-  // If InitializeProcessWideCodeRangeOnce has been called, returns the
-  // initialized CodeRange. Otherwise returns an empty std::shared_ptr.
-  V8_EXPORT_PRIVATE static std::shared_ptr<CodeRange> GetProcessWideCodeRange();
-
  private:
   // Used when short builtin calls are enabled, where embedded builtins are
   // copied into the CodeRange so calls can be nearer.
   std::atomic<uint8_t*> embedded_blob_code_copy_{nullptr};
 
+  // Set if embedded_blob_code_copy_ maps the process-wide shared copy of the
+  // embedded builtins, see RemapEmbeddedBuiltins.
+  std::unique_ptr<v8::PageAllocator::SharedMemoryMapping>
+      embedded_blob_code_mapping_;
+
   // When sharing a CodeRange among Isolates, calls to RemapEmbeddedBuiltins may
   // race during Isolate::Init.
   base::Mutex remap_embedded_builtins_mutex_;
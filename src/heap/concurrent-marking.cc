@@ -10,6 +10,7 @@
 #include "include/v8config.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
+#include "src/heap/ephemeron-index.h"
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
@@ -480,6 +481,8 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
                                 task_id);
   }
   bool another_ephemeron_iteration = false;
+  const EphemeronIndex* ephemeron_index =
+      ephemeron_index_.load(std::memory_order_acquire);
 
   {
     TimedScope scope(&time_ms);
@@ -541,6 +544,11 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
                 local_marking_worklists.Context(), map, object, visited_size);
           }
           current_marked_bytes += visited_size;
+          if (ephemeron_index) {
+            ephemeron_index->ForEachValue(object, [&](HeapObject value) {
+              visitor.ProcessEphemeron(object, value);
+            });
+          }
         }
       }
       if (objects_processed > 0) another_ephemeron_iteration = true;
@@ -554,7 +562,7 @@ void ConcurrentMarking::Run(JobDelegate* delegate,
       }
     }
 
-    if (done) {
+    if (done && !ephemeron_index) {
       Ephemeron ephemeron;
       while (local_weak_objects.discovered_ephemerons_local.Pop(&ephemeron)) {
         if (visitor.ProcessEphemeron(ephemeron.key, ephemeron.value)) {
@@ -24,6 +24,7 @@
 namespace v8 {
 namespace internal {
 
+class EphemeronIndex;
 class Heap;
 class Isolate;
 class MajorNonAtomicMarkingState;
@@ -97,6 +98,14 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     return another_ephemeron_iteration_.load();
   }
 
+  // Lets jobs scheduled afterwards mark the values |index| maps each visited
+  // object to. The index must not change while jobs are running. Ephemerons
+  // discovered by these jobs are left for the main thread.
+  void set_ephemeron_index(const EphemeronIndex* index) {
+    DCHECK(IsStopped());
+    ephemeron_index_.store(index, std::memory_order_release);
+  }
+
  private:
   struct TaskState {
     size_t marked_bytes = 0;
@@ -117,6 +126,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
   TaskState task_state_[kMaxTasks + 1];
   std::atomic<size_t> total_marked_bytes_{0};
   std::atomic<bool> another_ephemeron_iteration_{false};
+  std::atomic<const EphemeronIndex*> ephemeron_index_{nullptr};
 };
 
 }  // namespace internal
@@ -6,6 +6,7 @@
 
 #include "src/execution/isolate-utils-inl.h"
 #include "src/heap/large-spaces.h"
+#include "src/heap/mark-compact.h"
 #include "src/heap/paged-spaces-inl.h"
 
 namespace v8 {
@@ -19,7 +20,7 @@ void ConservativeStackVisitor::VisitPointer(const void* pointer) {
   VisitConservativelyIfPointer(pointer);
 }
 
-bool ConservativeStackVisitor::CheckPage(Address address, MemoryChunk* page) {
+bool ConservativeStackVisitor::CheckPage(Address address, Page* page) {
   if (address < page->area_start() || address >= page->area_end()) return false;
 
   auto base_ptr = page->object_start_bitmap()->FindBasePtr(address);
@@ -37,6 +38,13 @@ bool ConservativeStackVisitor::CheckPage(Address address, MemoryChunk* page) {
     return false;
   }
 
+  // The object may be referenced through a raw pointer that cannot be
+  // updated. Keep it in place by excluding its page from compaction.
+  Heap* heap = isolate_->heap();
+  if (page->IsEvacuationCandidate() && heap->gc_state() == Heap::MARK_COMPACT) {
+    heap->mark_compact_collector()->PinEvacuationCandidate(page);
+  }
+
   Object root = obj;
   delegate_->VisitRootPointer(Root::kHandleScope, nullptr,
                               FullObjectSlot(&root));
@@ -45,6 +53,29 @@ bool ConservativeStackVisitor::CheckPage(Address address, MemoryChunk* page) {
   return true;
 }
 
+bool ConservativeStackVisitor::CheckPagedSpace(Address address,
+                                               PagedSpace* space) {
+  if (!space) return false;
+  for (Page* page : *space) {
+    if (CheckPage(address, page)) return true;
+  }
+  return false;
+}
+
+bool ConservativeStackVisitor::CheckLargeObjectSpace(Address address,
+                                                     LargeObjectSpace* space) {
+  for (LargePage* page : *space) {
+    if (address >= page->area_start() && address < page->area_end()) {
+      Object ptr = page->GetObject();
+      FullObjectSlot root = FullObjectSlot(&ptr);
+      delegate_->VisitRootPointer(Root::kHandleScope, nullptr, root);
+      DCHECK(root == FullObjectSlot(&ptr));
+      return true;
+    }
+  }
+  return false;
+}
+
 void ConservativeStackVisitor::VisitConservativelyIfPointer(
     const void* pointer) {
   auto address = reinterpret_cast<Address>(pointer);
@@ -58,21 +89,12 @@ void ConservativeStackVisitor::VisitConservativelyIfPointer(
   }
 #endif
 
-  for (Page* page : *isolate_->heap()->old_space()) {
-    if (CheckPage(address, page)) {
-      return;
-    }
-  }
-
-  for (LargePage* page : *isolate_->heap()->lo_space()) {
-    if (address >= page->area_start() && address < page->area_end()) {
-      Object ptr = page->GetObject();
-      FullObjectSlot root = FullObjectSlot(&ptr);
-      delegate_->VisitRootPointer(Root::kHandleScope, nullptr, root);
-      DCHECK(root == FullObjectSlot(&ptr));
-      return;
-    }
-  }
+  Heap* heap = isolate_->heap();
+  if (CheckPagedSpace(address, heap->old_space())) return;
+  if (CheckPagedSpace(address, heap->code_space())) return;
+  if (CheckPagedSpace(address, heap->map_space())) return;
+  if (CheckLargeObjectSpace(address, heap->lo_space())) return;
+  CheckLargeObjectSpace(address, heap->code_lo_space());
 }
 
 }  // namespace internal
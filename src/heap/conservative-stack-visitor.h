@@ -11,6 +11,10 @@
 namespace v8 {
 namespace internal {
 
+class LargeObjectSpace;
+class Page;
+class PagedSpace;
+
 class ConservativeStackVisitor : public ::heap::base::StackVisitor {
  public:
   ConservativeStackVisitor(Isolate* isolate, RootVisitor* delegate);
@@ -18,7 +22,9 @@ class ConservativeStackVisitor : public ::heap::base::StackVisitor {
   void VisitPointer(const void* pointer) final;
 
  private:
-  bool CheckPage(Address address, MemoryChunk* page);
+  bool CheckPage(Address address, Page* page);
+  bool CheckPagedSpace(Address address, PagedSpace* space);
+  bool CheckLargeObjectSpace(Address address, LargeObjectSpace* space);
 
   void VisitConservativelyIfPointer(const void* pointer);
 
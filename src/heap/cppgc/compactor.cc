@@ -5,7 +5,6 @@
 #include "src/heap/cppgc/compactor.h"
 
 #include <map>
-#include <numeric>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -28,6 +27,12 @@ namespace {
 // should be considered.
 static constexpr size_t kFreeListSizeThreshold = 512 * kKB;
 
+// Compaction is also considered for smaller freelists if they make up a large
+// part of the payload of compactable spaces, i.e., if the spaces are heavily
+// fragmented.
+static constexpr size_t kMinFreeListSizeForFragmentation = 128 * kKB;
+static constexpr double kFragmentationRatioThreshold = 0.5;
+
 // The real worker behind heap compaction, recording references to movable
 // objects ("slots".) When the objects end up being compacted and moved,
 // relocate() will adjust the slots to point to the new location of the
@@ -433,13 +438,20 @@ void CompactSpace(NormalPageSpace* space, MovableReferences& movable_references,
   // Sweeping will verify object start bitmap of compacted space.
 }
 
-size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
-  return std::accumulate(spaces.cbegin(), spaces.cend(), 0u,
-                         [](size_t acc, const NormalPageSpace* space) {
-                           DCHECK(space->is_compactable());
-                           if (!space->size()) return acc;
-                           return acc + space->free_list().Size();
-                         });
+struct HeapResidency {
+  size_t free_list_size = 0;
+  size_t payload_size = 0;
+};
+
+HeapResidency UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
+  HeapResidency residency;
+  for (const NormalPageSpace* space : spaces) {
+    DCHECK(space->is_compactable());
+    if (!space->size()) continue;
+    residency.free_list_size += space->free_list().Size();
+    residency.payload_size += space->size() * NormalPage::PayloadSize();
+  }
+  return residency;
 }
 
 }  // namespace
@@ -469,9 +481,12 @@ bool Compactor::ShouldCompact(
     return true;
   }
 
-  size_t free_list_size = UpdateHeapResidency(compactable_spaces_);
+  const HeapResidency residency = UpdateHeapResidency(compactable_spaces_);
+  if (residency.free_list_size > kFreeListSizeThreshold) return true;
 
-  return free_list_size > kFreeListSizeThreshold;
+  return residency.free_list_size > kMinFreeListSizeForFragmentation &&
+         static_cast<double>(residency.free_list_size) >=
+             kFragmentationRatioThreshold * residency.payload_size;
 }
 
 void Compactor::InitializeIfShouldCompact(
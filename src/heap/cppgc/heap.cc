@@ -52,6 +52,20 @@ void Heap::ForceGarbageCollectionSlow(const char* source, const char* reason,
        internal::GarbageCollector::Config::IsForcedGC::kForced});
 }
 
+void Heap::ForceMinorGarbageCollectionSlow(const char* source,
+                                           const char* reason) {
+  internal::Heap* heap = internal::Heap::From(this);
+  const auto collection_type =
+      heap->generational_gc_supported() && !heap->IsMarking()
+          ? internal::GarbageCollector::Config::CollectionType::kMinor
+          : internal::GarbageCollector::Config::CollectionType::kMajor;
+  heap->CollectGarbage(
+      {collection_type, Heap::StackState::kNoHeapPointers,
+       MarkingType::kAtomic, SweepingType::kAtomic,
+       internal::GarbageCollector::Config::FreeMemoryHandling::kDoNotDiscard,
+       internal::GarbageCollector::Config::IsForcedGC::kForced});
+}
+
 AllocationHandle& Heap::GetAllocationHandle() {
   return internal::Heap::From(this)->object_allocator();
 }
@@ -88,6 +102,9 @@ Heap::Heap(std::shared_ptr<cppgc::Platform> platform,
                 platform_->GetForegroundTaskRunner());
   CHECK_IMPLIES(options.sweeping_support != HeapBase::SweepingType::kAtomic,
                 platform_->GetForegroundTaskRunner());
+  // Generational GC becomes active with the first garbage collection, see
+  // FinalizeGarbageCollection().
+  if (options.enable_generational_gc) EnableGenerationalGC();
 }
 
 Heap::~Heap() {
@@ -35,6 +35,13 @@ namespace internal {
 class StatsCollector;
 class PageBackend;
 
+// Allocates objects on the regular and custom spaces of a heap. Each
+// NormalPageSpace owns a single linear allocation buffer (LAB) which is
+// accessed without synchronization. This relies on the heap being used by a
+// single mutator thread at a time: the sweeper, the marker (through the
+// object start bitmap), and prefinalizers all assume that no other thread
+// bumps a LAB while they are running. Threads that need to allocate
+// concurrently should use separate cppgc::Heap instances.
 class V8_EXPORT_PRIVATE ObjectAllocator final : public cppgc::AllocationHandle {
  public:
   static constexpr size_t kSmallestSpaceSize = 32;
@@ -5,6 +5,7 @@
 #include "src/heap/cppgc/sweeper.h"
 
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -403,7 +404,12 @@ class SweepFinalizer final {
     size_t page_count = 1;
 
     while (auto page_state = space_state->swept_unfinalized_pages.Pop()) {
-      FinalizePage(&*page_state);
+      if (!FinalizePageWithDeadline(&*page_state, deadline_in_seconds)) {
+        // Put the partially finalized page back so that the next slice (or
+        // the final atomic pause) picks up where this one stopped.
+        space_state->swept_unfinalized_pages.Push(std::move(*page_state));
+        return false;
+      }
 
       if (page_count % kDeadlineCheckInterval == 0 &&
           deadline_in_seconds <= platform_->MonotonicallyIncreasingTime()) {
@@ -417,37 +423,28 @@ class SweepFinalizer final {
   }
 
   void FinalizePage(SpaceState::SweptPageState* page_state) {
+    const bool finalized = FinalizePageWithDeadline(page_state, kNoDeadline);
+    DCHECK(finalized);
+    USE(finalized);
+  }
+
+  // Finalizes the page described by |page_state|. Returns false if
+  // |deadline_in_seconds| was reached before all finalizers on the page were
+  // invoked. In this case |page_state| only retains the objects that still
+  // need to be finalized and the page is not yet returned to its space.
+  bool FinalizePageWithDeadline(SpaceState::SweptPageState* page_state,
+                                double deadline_in_seconds) {
     DCHECK(page_state);
     DCHECK(page_state->page);
     BasePage* page = page_state->page;
 
     // Call finalizers.
-    const auto finalize_header = [](HeapObjectHeader* header) {
-      const size_t size = header->AllocatedSize();
-      header->Finalize();
-      SetMemoryInaccessible(header, size);
-    };
-#if defined(CPPGC_CAGED_HEAP)
-    const uint64_t cage_base =
-        reinterpret_cast<uint64_t>(page->heap().caged_heap().base());
-    HeapObjectHeader* next_unfinalized = nullptr;
-
-    for (auto* unfinalized_header = page_state->unfinalized_objects_head;
-         unfinalized_header; unfinalized_header = next_unfinalized) {
-      next_unfinalized = unfinalized_header->GetNextUnfinalized(cage_base);
-      finalize_header(unfinalized_header);
-    }
-#else   // !defined(CPPGC_CAGED_HEAP)
-    for (HeapObjectHeader* unfinalized_header :
-         page_state->unfinalized_objects) {
-      finalize_header(unfinalized_header);
-    }
-#endif  // !defined(CPPGC_CAGED_HEAP)
+    if (!InvokeFinalizers(page_state, deadline_in_seconds)) return false;
 
     // Unmap page if empty.
     if (page_state->is_empty) {
       BasePage::Destroy(page);
-      return;
+      return true;
     }
 
     DCHECK(!page->is_large());
@@ -474,6 +471,7 @@ class SweepFinalizer final {
 
     // Add the page to the space.
     page->space().AddPage(page);
+    return true;
   }
 
   size_t largest_new_free_list_entry() const {
@@ -481,6 +479,56 @@ class SweepFinalizer final {
   }
 
  private:
+  static constexpr double kNoDeadline =
+      std::numeric_limits<double>::infinity();
+  // Number of finalizers invoked between two deadline checks. Avoids reading
+  // the clock after every single finalizer.
+  static constexpr size_t kFinalizerDeadlineCheckInterval = 64;
+
+  bool InvokeFinalizers(SpaceState::SweptPageState* page_state,
+                        double deadline_in_seconds) {
+    const auto finalize_header = [](HeapObjectHeader* header) {
+      const size_t size = header->AllocatedSize();
+      header->Finalize();
+      SetMemoryInaccessible(header, size);
+    };
+    size_t finalized_objects = 0;
+    const auto deadline_reached = [this, &finalized_objects,
+                                   deadline_in_seconds]() {
+      return deadline_in_seconds != kNoDeadline &&
+             ++finalized_objects % kFinalizerDeadlineCheckInterval == 0 &&
+             deadline_in_seconds <= platform_->MonotonicallyIncreasingTime();
+    };
+#if defined(CPPGC_CAGED_HEAP)
+    const uint64_t cage_base = reinterpret_cast<uint64_t>(
+        page_state->page->heap().caged_heap().base());
+    HeapObjectHeader* next_unfinalized = nullptr;
+
+    for (auto* unfinalized_header = page_state->unfinalized_objects_head;
+         unfinalized_header; unfinalized_header = next_unfinalized) {
+      next_unfinalized = unfinalized_header->GetNextUnfinalized(cage_base);
+      finalize_header(unfinalized_header);
+      if (next_unfinalized && deadline_reached()) {
+        page_state->unfinalized_objects_head = next_unfinalized;
+        return false;
+      }
+    }
+    page_state->unfinalized_objects_head = nullptr;
+#else   // !defined(CPPGC_CAGED_HEAP)
+    auto& unfinalized_objects = page_state->unfinalized_objects;
+    for (size_t i = 0; i < unfinalized_objects.size(); ++i) {
+      finalize_header(unfinalized_objects[i]);
+      if (i + 1 < unfinalized_objects.size() && deadline_reached()) {
+        unfinalized_objects.erase(unfinalized_objects.begin(),
+                                  unfinalized_objects.begin() + i + 1);
+        return false;
+      }
+    }
+    unfinalized_objects.clear();
+#endif  // !defined(CPPGC_CAGED_HEAP)
+    return true;
+  }
+
   cppgc::Platform* platform_;
   size_t largest_new_free_list_entry_ = 0;
   const FreeMemoryHandling free_memory_handling_;
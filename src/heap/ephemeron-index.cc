@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/ephemeron-index.h"
+
+#include <algorithm>
+
+#include "src/base/bits.h"
+
+namespace v8 {
+namespace internal {
+
+void EphemeronIndex::Add(Ephemeron ephemeron) {
+  CHECK_LT(entries_.size(), kNoEntry);
+  // Keep the load factor at or below one.
+  if (entries_.size() >= buckets_.size()) {
+    Rehash(std::max(kInitialBuckets, 2 * buckets_.size()));
+  }
+  uint32_t index = static_cast<uint32_t>(entries_.size());
+  uint32_t& bucket = buckets_[BucketFor(ephemeron.key)];
+  entries_.push_back(Entry{ephemeron, bucket});
+  bucket = index;
+}
+
+void EphemeronIndex::Clear() {
+  std::vector<Entry>().swap(entries_);
+  std::vector<uint32_t>().swap(buckets_);
+}
+
+void EphemeronIndex::Rehash(size_t buckets) {
+  DCHECK(base::bits::IsPowerOfTwo(buckets));
+  buckets_.assign(buckets, kNoEntry);
+  for (uint32_t index = 0; index < entries_.size(); ++index) {
+    uint32_t& bucket = buckets_[BucketFor(entries_[index].ephemeron.key)];
+    entries_[index].next = bucket;
+    bucket = index;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
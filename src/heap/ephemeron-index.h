@@ -0,0 +1,72 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_EPHEMERON_INDEX_H_
+#define V8_HEAP_EPHEMERON_INDEX_H_
+
+#include <vector>
+
+#include "src/common/globals.h"
+#include "src/heap/weak-object-worklists.h"
+#include "src/objects/heap-object.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// Maps the keys of ephemerons with unreachable values to these values. Used by
+// the linear ephemeron algorithm: Whenever the marker visits an object, it
+// looks up the values the object keeps alive, instead of iterating over all
+// remaining ephemerons.
+//
+// The index is a chained hash table. It is only modified on the main thread
+// while no marking tasks run, and can be looked up concurrently otherwise.
+class V8_EXPORT_PRIVATE EphemeronIndex final {
+ public:
+  EphemeronIndex() = default;
+  EphemeronIndex(const EphemeronIndex&) = delete;
+  EphemeronIndex& operator=(const EphemeronIndex&) = delete;
+
+  void Add(Ephemeron ephemeron);
+  // Removes all entries and releases the memory.
+  void Clear();
+
+  bool IsEmpty() const { return entries_.empty(); }
+  size_t Size() const { return entries_.size(); }
+
+  // Calls |callback| with the value of each entry with the given key.
+  template <typename Callback>
+  void ForEachValue(HeapObject key, Callback callback) const {
+    if (entries_.empty()) return;
+    for (uint32_t index = buckets_[BucketFor(key)]; index != kNoEntry;
+         index = entries_[index].next) {
+      const Entry& entry = entries_[index];
+      if (entry.ephemeron.key == key) callback(entry.ephemeron.value);
+    }
+  }
+
+ private:
+  static constexpr uint32_t kNoEntry = static_cast<uint32_t>(-1);
+  static constexpr size_t kInitialBuckets = 64;
+
+  struct Entry {
+    Ephemeron ephemeron;
+    uint32_t next;
+  };
+
+  size_t BucketFor(HeapObject key) const {
+    return ComputeAddressHash(key.ptr()) & (buckets_.size() - 1);
+  }
+  void Rehash(size_t buckets);
+
+  std::vector<Entry> entries_;
+  // Index of the last entry added to each bucket. The number of buckets is a
+  // power of two.
+  std::vector<uint32_t> buckets_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_EPHEMERON_INDEX_H_
@@ -16,6 +16,7 @@
 #include "src/heap/read-only-heap.h"
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
+#include "src/objects/code.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/module-inl.h"
@@ -876,6 +877,13 @@ Handle<DescriptorArray> FactoryBase<Impl>::NewDescriptorArray(
   return handle(array, isolate());
 }
 
+template <typename Impl>
+Handle<DeoptimizationLiteralArray>
+FactoryBase<Impl>::NewDeoptimizationLiteralArray(int length) {
+  return Handle<DeoptimizationLiteralArray>::cast(
+      NewWeakFixedArray(length, AllocationType::kOld));
+}
+
 template <typename Impl>
 Handle<ClassPositions> FactoryBase<Impl>::NewClassPositions(int start,
                                                             int end) {
@@ -35,6 +35,7 @@ class UncompiledDataWithPreparseData;
 class BytecodeArray;
 class CoverageInfo;
 class ClassPositions;
+class DeoptimizationLiteralArray;
 struct SourceRange;
 enum class Builtin : int32_t;
 template <typename T>
@@ -257,6 +258,8 @@ class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) FactoryBase
 
   Handle<ClassPositions> NewClassPositions(int start, int end);
 
+  Handle<DeoptimizationLiteralArray> NewDeoptimizationLiteralArray(int length);
+
   Handle<SwissNameDictionary> NewSwissNameDictionary(
       int at_least_space_for = kSwissNameDictionaryInitialCapacity,
       AllocationType allocation = AllocationType::kYoung);
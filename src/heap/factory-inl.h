@@ -30,9 +30,11 @@ namespace internal {
 ROOT_LIST(ROOT_ACCESSOR)
 #undef ROOT_ACCESSOR
 
-bool Factory::CodeBuilder::CompiledWithConcurrentBaseline() const {
-  return FLAG_concurrent_sparkplug && kind_ == CodeKind::BASELINE &&
-         !local_isolate_->is_main_thread();
+bool Factory::CodeBuilder::CompiledConcurrently() const {
+  if (local_isolate_->is_main_thread()) return false;
+  return (FLAG_concurrent_sparkplug && kind_ == CodeKind::BASELINE) ||
+         (FLAG_concurrent_turbofan_finalization &&
+          kind_ == CodeKind::TURBOFAN);
 }
 
 Handle<String> Factory::InternalizeString(Handle<String> string) {
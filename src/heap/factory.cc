@@ -99,7 +99,7 @@ MaybeHandle<Code> Factory::CodeBuilder::BuildInternal(
   const auto factory = isolate_->factory();
   // Allocate objects needed for code initialization.
   Handle<ByteArray> reloc_info =
-      CompiledWithConcurrentBaseline()
+      CompiledConcurrently()
           ? local_isolate_->factory()->NewByteArray(code_desc_.reloc_size,
                                                     AllocationType::kOld)
           : factory->NewByteArray(code_desc_.reloc_size, AllocationType::kOld);
@@ -120,7 +120,7 @@ MaybeHandle<Code> Factory::CodeBuilder::BuildInternal(
               kind_specific_flags_);
     data_container = canonical_code_data_container;
   } else {
-    if (CompiledWithConcurrentBaseline()) {
+    if (CompiledConcurrently()) {
       data_container = local_isolate_->factory()->NewCodeDataContainer(
           0, AllocationType::kOld);
     } else {
@@ -156,9 +156,8 @@ MaybeHandle<Code> Factory::CodeBuilder::BuildInternal(
   CodePageCollectionMemoryModificationScope code_allocation(heap);
 
   Handle<Code> code;
-  if (CompiledWithConcurrentBaseline()) {
-    if (!AllocateConcurrentSparkplugCode(retry_allocation_or_fail)
-             .ToHandle(&code)) {
+  if (CompiledConcurrently()) {
+    if (!AllocateCodeConcurrently(retry_allocation_or_fail).ToHandle(&code)) {
       return MaybeHandle<Code>();
     }
   } else if (!AllocateCode(retry_allocation_or_fail).ToHandle(&code)) {
@@ -300,7 +299,7 @@ MaybeHandle<Code> Factory::CodeBuilder::AllocateCode(
   return code;
 }
 
-MaybeHandle<Code> Factory::CodeBuilder::AllocateConcurrentSparkplugCode(
+MaybeHandle<Code> Factory::CodeBuilder::AllocateCodeConcurrently(
     bool retry_allocation_or_fail) {
   LocalHeap* heap = local_isolate_->heap();
   AllocationType allocation_type = V8_EXTERNAL_CODE_SPACE_BOOL || is_executable_
@@ -987,7 +986,28 @@ Handle<String> Factory::NewProperSubString(Handle<String> str, int begin,
 #endif
   DCHECK(begin > 0 || end < str->length());
 
-  str = String::Flatten(isolate(), str);
+  // Descend into the part of a rope that holds the whole range, so that
+  // slicing off one end of a concatenation does not flatten all of it.
+  while (str->IsConsString() && !ConsString::cast(*str).IsFlat()) {
+    ConsString cons = ConsString::cast(*str);
+    int first_length = cons.first().length();
+    if (end <= first_length) {
+      str = handle(cons.first(), isolate());
+    } else if (begin >= first_length) {
+      str = handle(cons.second(), isolate());
+      begin -= first_length;
+      end -= first_length;
+    } else {
+      break;
+    }
+  }
+  if (begin == 0 && end == str->length()) return str;
+
+  // Ropes that are not read repeatedly are copied from in place.
+  bool copy_from_rope = str->IsConsString() &&
+                        !ConsString::cast(*str).IsFlat() &&
+                        !String::ShouldFlattenOnAccess(isolate(), str);
+  if (!copy_from_rope) str = String::Flatten(isolate(), str);
 
   int length = end - begin;
   if (length <= 0) return empty_string();
@@ -1003,7 +1023,8 @@ Handle<String> Factory::NewProperSubString(Handle<String> str, int begin,
     return MakeOrFindTwoCharacterString(c1, c2);
   }
 
-  if (!FLAG_string_slices || length < SlicedString::kMinLength) {
+  if (copy_from_rope || !FLAG_string_slices ||
+      length < SlicedString::kMinLength) {
     if (str->IsOneByteRepresentation()) {
       Handle<SeqOneByteString> result =
           NewRawOneByteString(length).ToHandleChecked();
@@ -1184,10 +1205,12 @@ Handle<NativeContext> Factory::NewNativeContext() {
   context.set_previous(Context());
   context.set_extension(*undefined_value());
   context.set_errors_thrown(Smi::zero());
+  context.set_measured_memory_kb(Smi::zero());
   context.set_math_random_index(Smi::zero());
   context.set_serialized_objects(*empty_fixed_array());
   context.set_microtask_queue(isolate(), nullptr);
   context.set_retained_maps(*empty_weak_array_list());
+  context.set_osr_code_cache(*empty_weak_fixed_array());
   return handle(context, isolate());
 }
 
@@ -2178,6 +2201,47 @@ Handle<FixedDoubleArray> Factory::CopyFixedDoubleArray(
   return result;
 }
 
+void Factory::CopyAndBoxDoubleElements(Handle<FixedDoubleArray> from,
+                                       int from_start, Handle<FixedArray> to,
+                                       int to_start, int length) {
+  DCHECK(!USE_ALLOCATION_ALIGNMENT_BOOL);
+  DCHECK_LE(from_start + length, from->length());
+  DCHECK_LE(to_start + length, to->length());
+  // Keeps each batch allocation well below kMaxRegularHeapObjectSize.
+  static constexpr int kBatchLength = 1024;
+  STATIC_ASSERT(kBatchLength * HeapNumber::kSize <= kMaxRegularHeapObjectSize);
+  Map map = read_only_roots().heap_number_map();
+  for (int batch_start = 0; batch_start < length;
+       batch_start += kBatchLength) {
+    int batch_end = std::min(length, batch_start + kBatchLength);
+    int numbers = 0;
+    for (int i = batch_start; i < batch_end; ++i) {
+      numbers += from->get_representation(from_start + i) != kHoleNanInt64;
+    }
+    Address next = kNullAddress;
+    if (numbers > 0) {
+      next = AllocateRaw(numbers * HeapNumber::kSize, AllocationType::kYoung)
+                 .address();
+    }
+    DisallowGarbageCollection no_gc;
+    FixedDoubleArray raw_from = *from;
+    FixedArray raw_to = *to;
+    WriteBarrierMode mode = raw_to.GetWriteBarrierMode(no_gc);
+    for (int i = batch_start; i < batch_end; ++i) {
+      uint64_t bits = raw_from.get_representation(from_start + i);
+      if (bits == kHoleNanInt64) {
+        raw_to.set_the_hole(isolate(), to_start + i);
+        continue;
+      }
+      HeapObject number = HeapObject::FromAddress(next);
+      number.set_map_after_allocation(map, SKIP_WRITE_BARRIER);
+      HeapNumber::cast(number).set_value_as_bits(bits, kRelaxedStore);
+      raw_to.set(to_start + i, number, mode);
+      next += HeapNumber::kSize;
+    }
+  }
+}
+
 Handle<HeapNumber> Factory::NewHeapNumberForCodeAssembler(double value) {
   return CanAllocateInReadOnlySpace()
              ? NewHeapNumber<AllocationType::kReadOnly>(value)
@@ -2281,12 +2345,6 @@ Handle<JSObject> Factory::NewExternal(void* value) {
   return external;
 }
 
-Handle<DeoptimizationLiteralArray> Factory::NewDeoptimizationLiteralArray(
-    int length) {
-  return Handle<DeoptimizationLiteralArray>::cast(
-      NewWeakFixedArray(length, AllocationType::kOld));
-}
-
 Handle<Code> Factory::NewOffHeapTrampolineFor(Handle<Code> code,
                                               Address off_heap_entry) {
   CHECK_NOT_NULL(isolate()->embedded_blob_code());
@@ -2761,8 +2819,10 @@ Handle<SourceTextModule> Factory::NewSourceTextModule(
     Handle<SharedFunctionInfo> sfi) {
   Handle<SourceTextModuleInfo> module_info(
       sfi->scope_info().ModuleDescriptorInfo(), isolate());
+  // Presize the export table for all names added before linking, so that
+  // setting up many indirect exports does not grow it repeatedly.
   Handle<ObjectHashTable> exports =
-      ObjectHashTable::New(isolate(), module_info->RegularExportCount());
+      ObjectHashTable::New(isolate(), module_info->ExportNameCount());
   Handle<FixedArray> regular_exports =
       NewFixedArray(module_info->RegularExportCount());
   Handle<FixedArray> regular_imports =
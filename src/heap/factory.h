@@ -498,6 +498,14 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
 
   Handle<FixedDoubleArray> CopyFixedDoubleArray(Handle<FixedDoubleArray> array);
 
+  // Copies |length| elements of |from| from |from_start| on to |to| from
+  // |to_start| on, boxing the doubles into HeapNumbers and keeping holes. The
+  // HeapNumbers of a batch of elements are carved out of one allocation. Only
+  // for configurations without allocation alignment.
+  void CopyAndBoxDoubleElements(Handle<FixedDoubleArray> from, int from_start,
+                                Handle<FixedArray> to, int to_start,
+                                int length);
+
   // Creates a new HeapNumber in read-only space if possible otherwise old
   // space.
   Handle<HeapNumber> NewHeapNumberForCodeAssembler(double value);
@@ -696,8 +704,6 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
   // Create an External object for V8's external API.
   Handle<JSObject> NewExternal(void* value);
 
-  Handle<DeoptimizationLiteralArray> NewDeoptimizationLiteralArray(int length);
-
   // Allocates a new code object and initializes it as the trampoline to the
   // given off-heap entry point.
   Handle<Code> NewOffHeapTrampolineFor(Handle<Code> code,
@@ -983,12 +989,12 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
       return *this;
     }
 
-    inline bool CompiledWithConcurrentBaseline() const;
+    inline bool CompiledConcurrently() const;
 
    private:
     MaybeHandle<Code> BuildInternal(bool retry_allocation_or_fail);
     MaybeHandle<Code> AllocateCode(bool retry_allocation_or_fail);
-    MaybeHandle<Code> AllocateConcurrentSparkplugCode(
+    MaybeHandle<Code> AllocateCodeConcurrently(
         bool retry_allocation_or_fail);
 
     Isolate* const isolate_;
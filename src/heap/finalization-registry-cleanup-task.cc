@@ -35,22 +35,9 @@ void FinalizationRegistryCleanupTask::SlowAssertNoActiveJavaScript() {
 #endif  // ENABLE_SLOW_DCHECKS
 }
 
-void FinalizationRegistryCleanupTask::RunInternal() {
+bool FinalizationRegistryCleanupTask::Cleanup(
+    Handle<JSFinalizationRegistry> finalization_registry) {
   Isolate* isolate = heap_->isolate();
-  SlowAssertNoActiveJavaScript();
-
-  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
-                                "V8.FinalizationRegistryCleanupTask");
-
-  HandleScope handle_scope(isolate);
-  Handle<JSFinalizationRegistry> finalization_registry;
-  // There could be no dirty FinalizationRegistries. When a context is disposed
-  // by the embedder, its FinalizationRegistries are removed from the dirty
-  // list.
-  if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
-          &finalization_registry)) {
-    return;
-  }
   finalization_registry->set_scheduled_for_cleanup(false);
 
   // Since FinalizationRegistry cleanup callbacks are scheduled by V8, enter the
@@ -78,13 +65,8 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // Exceptions are reported via the message handler. This is ensured by the
   // verbose TryCatch.
   //
-  // Cleanup is interrupted if there is an exception. The HTML spec calls for a
-  // microtask checkpoint after each cleanup task, so the task should return
-  // after an exception so the host can perform a microtask checkpoint. In case
-  // of exception, check if the FinalizationRegistry still needs cleanup
-  // and should be requeued.
-  //
-  // TODO(syg): Implement better scheduling for finalizers.
+  // In case of exception, check if the FinalizationRegistry still needs
+  // cleanup and should be requeued.
   InvokeFinalizationRegistryCleanupFromTask(context, finalization_registry,
                                             callback);
   if (finalization_registry->NeedsCleanup() &&
@@ -92,6 +74,38 @@ void FinalizationRegistryCleanupTask::RunInternal() {
     auto nop = [](HeapObject, ObjectSlot, Object) {};
     heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
   }
+  return !catcher.HasCaught();
+}
+
+void FinalizationRegistryCleanupTask::RunInternal() {
+  Isolate* isolate = heap_->isolate();
+  SlowAssertNoActiveJavaScript();
+
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
+                                "V8.FinalizationRegistryCleanupTask");
+
+  // Clean up dirty FinalizationRegistries until the time budget of the task is
+  // used up. At least one FinalizationRegistry is cleaned up per task.
+  //
+  // Cleanup is interrupted if there is an exception. The HTML spec calls for a
+  // microtask checkpoint after each cleanup task, so the task should return
+  // after an exception so the host can perform a microtask checkpoint.
+  const double deadline_ms =
+      heap_->MonotonicallyIncreasingTimeInMs() +
+      FLAG_finalization_registry_cleanup_task_budget_ms;
+  do {
+    HandleScope handle_scope(isolate);
+    Handle<JSFinalizationRegistry> finalization_registry;
+    // There could be no dirty FinalizationRegistries. When a context is
+    // disposed by the embedder, its FinalizationRegistries are removed from
+    // the dirty list.
+    if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
+            &finalization_registry)) {
+      break;
+    }
+    if (!Cleanup(finalization_registry)) break;
+  } while (!isolate->is_execution_terminating() &&
+           heap_->MonotonicallyIncreasingTimeInMs() < deadline_ms);
 
   // Repost if there are remaining dirty FinalizationRegistries.
   heap_->set_is_finalization_registry_cleanup_task_posted(false);
@@ -12,8 +12,9 @@ namespace v8 {
 namespace internal {
 
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
-// non-empty. The task processes a single FinalizationRegistry and posts another
-// cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// non-empty. The task processes dirty FinalizationRegistries for up to
+// --finalization-registry-cleanup-task-budget-ms and posts another cleanup
+// task if there are remaining dirty FinalizationRegistries on the list.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
@@ -24,6 +25,9 @@ class FinalizationRegistryCleanupTask : public CancelableTask {
 
  private:
   void RunInternal() override;
+  // Runs the cleanup callback of |finalization_registry|. Returns false if the
+  // callback threw.
+  bool Cleanup(Handle<JSFinalizationRegistry> finalization_registry);
   void SlowAssertNoActiveJavaScript();
 
   Heap* heap_;
@@ -4,8 +4,10 @@
 
 #include "src/heap/free-list.h"
 
+#include "src/base/bits.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/heap/free-list-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/memory-chunk-inl.h"
@@ -109,7 +111,22 @@ void FreeListCategory::Relink(FreeList* owner) {
 // ------------------------------------------------
 // Generic FreeList methods (alloc/free related)
 
-FreeList* FreeList::CreateFreeList() { return new FreeListManyCachedOrigin(); }
+FreeList* FreeList::CreateFreeList() {
+  switch (FLAG_gc_freelist_strategy) {
+    case 0:
+      return new FreeListMany();
+    case 1:
+      return new FreeListManyCached();
+    case 2:
+      return new FreeListManyCachedFastPath();
+    case 3:
+      return new FreeListManyCachedOrigin();
+    case 4:
+      return new FreeListManyBitmap();
+    default:
+      FATAL("Invalid FreeList strategy");
+  }
+}
 
 FreeSpace FreeList::TryFindNodeIn(FreeListCategoryType type,
                                   size_t minimum_size, size_t* node_size) {
@@ -550,5 +567,90 @@ size_t FreeList::SumFreeLists() {
 }
 #endif
 
+// ------------------------------------------------
+// FreeListManyBitmap implementation
+
+void FreeListManyBitmap::Reset() {
+  nonempty_categories_ = 0;
+  FreeListMany::Reset();
+}
+
+bool FreeListManyBitmap::AddCategory(FreeListCategory* category) {
+  bool was_added = FreeList::AddCategory(category);
+
+  if (was_added) {
+    nonempty_categories_ |= uint32_t{1} << category->type_;
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+
+  return was_added;
+}
+
+void FreeListManyBitmap::RemoveCategory(FreeListCategory* category) {
+  FreeList::RemoveCategory(category);
+
+  int type = category->type_;
+  if (categories_[type] == nullptr) {
+    nonempty_categories_ &= ~(uint32_t{1} << type);
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+}
+
+Page* FreeListManyBitmap::GetPageForSize(size_t size_in_bytes) {
+  FreeListCategoryType minimum_category =
+      SelectFreeListCategoryType(size_in_bytes);
+  uint32_t candidates = minimum_category < last_category_
+                            ? NonEmptyCategoriesFrom(minimum_category + 1)
+                            : 0;
+  if (candidates != 0) {
+    return GetPageForCategoryType(static_cast<FreeListCategoryType>(
+        base::bits::CountTrailingZeros(candidates)));
+  }
+  // Might return a page in which |size_in_bytes| will not fit.
+  return GetPageForCategoryType(minimum_category);
+}
+
+FreeSpace FreeListManyBitmap::Allocate(size_t size_in_bytes, size_t* node_size,
+                                       AllocationOrigin origin) {
+  USE(origin);
+  DCHECK_GE(kMaxBlockSize, size_in_bytes);
+
+  FreeSpace node;
+  // Only the first node of each category is considered, so a category can be
+  // non-empty and still fail; the remaining bits are tried in increasing
+  // order. The last category is searched exhaustively below.
+  uint32_t candidates =
+      NonEmptyCategoriesFrom(SelectFreeListCategoryType(size_in_bytes)) &
+      ~(uint32_t{1} << last_category_);
+  while (candidates != 0 && node.is_null()) {
+    FreeListCategoryType type = static_cast<FreeListCategoryType>(
+        base::bits::CountTrailingZeros(candidates));
+    candidates &= candidates - 1;
+    node = TryFindNodeIn(type, size_in_bytes, node_size);
+  }
+
+  if (node.is_null()) {
+    // Searching each element of the last category.
+    node = SearchForNodeInList(last_category_, size_in_bytes, node_size);
+  }
+
+#ifdef DEBUG
+  CheckBitmapIntegrity();
+#endif
+
+  if (!node.is_null()) {
+    Page::FromHeapObject(node)->IncreaseAllocatedBytes(*node_size);
+  }
+
+  DCHECK(IsVeryLong() || Available() == SumFreeLists());
+  return node;
+}
+
 }  // namespace internal
 }  // namespace v8
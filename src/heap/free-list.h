@@ -107,6 +107,7 @@ class FreeListCategory {
   FreeListCategory* next_ = nullptr;
 
   friend class FreeList;
+  friend class FreeListManyBitmap;
   friend class FreeListManyCached;
   friend class PagedSpace;
   friend class MapSpace;
@@ -488,6 +489,46 @@ class V8_EXPORT_PRIVATE FreeListManyCachedOrigin
                                            AllocationOrigin origin) override;
 };
 
+// Same as FreeListMany but keeps a bitmap of the non-empty categories
+// (|nonempty_categories_|), where bit c is set iff categories_[c] != nullptr.
+// Finding the first non-empty category that may hold an object of a given size
+// is then a mask and a count-trailing-zeros rather than a walk over the
+// categories. Allocation uses the same best-fit strategy as FreeListMany.
+class V8_EXPORT_PRIVATE FreeListManyBitmap : public FreeListMany {
+ public:
+  V8_WARN_UNUSED_RESULT FreeSpace Allocate(size_t size_in_bytes,
+                                           size_t* node_size,
+                                           AllocationOrigin origin) override;
+
+  Page* GetPageForSize(size_t size_in_bytes) override;
+
+  void Reset() override;
+
+  bool AddCategory(FreeListCategory* category) override;
+  void RemoveCategory(FreeListCategory* category) override;
+
+ protected:
+  STATIC_ASSERT(kNumberOfCategories <= 32);
+
+  // Returns the bits of all non-empty categories greater or equal to |cat|.
+  uint32_t NonEmptyCategoriesFrom(FreeListCategoryType cat) const {
+    return nonempty_categories_ & (~uint32_t{0} << cat);
+  }
+
+#ifdef DEBUG
+  void CheckBitmapIntegrity() {
+    for (int i = 0; i <= last_category_; i++) {
+      DCHECK_EQ((nonempty_categories_ >> i) & 1u,
+                categories_[i] != nullptr ? 1u : 0u);
+    }
+  }
+#endif
+
+  uint32_t nonempty_categories_ = 0;
+
+  FRIEND_TEST(SpacesTest, FreeListManyBitmapNonEmptyCategoriesFrom);
+};
+
 }  // namespace internal
 }  // namespace v8
 
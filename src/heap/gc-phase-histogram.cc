@@ -0,0 +1,92 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-phase-histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+int GCPhaseHistogram::BucketIndex(int64_t value_in_us) {
+  if (value_in_us < kSubBucketCount) {
+    return static_cast<int>(std::max(value_in_us, int64_t{0}));
+  }
+  if (value_in_us >= (int64_t{1} << kMaxExponent)) return kBucketCount - 1;
+  const uint64_t value = static_cast<uint64_t>(value_in_us);
+  const int exponent = 63 - base::bits::CountLeadingZeros(value);
+  const int shift = exponent - kSubBucketBits;
+  const int sub_bucket = static_cast<int>(value >> shift) - kSubBucketCount;
+  return (shift + 1) * kSubBucketCount + sub_bucket;
+}
+
+// static
+int64_t GCPhaseHistogram::BucketLowerBound(int index) {
+  DCHECK_GE(index, 0);
+  DCHECK_LE(index, kBucketCount);
+  if (index < kSubBucketCount) return index;
+  const int shift = index / kSubBucketCount - 1;
+  const int sub_bucket = index % kSubBucketCount;
+  return int64_t{kSubBucketCount + sub_bucket} << shift;
+}
+
+void GCPhaseHistogram::Record(int64_t value_in_us) {
+  value_in_us = std::max(value_in_us, int64_t{0});
+  uint32_t& bucket = buckets_[BucketIndex(value_in_us)];
+  // Saturate instead of wrapping around; the reporting interval is expected
+  // to be short enough for this never to happen in practice.
+  if (bucket != UINT32_MAX) bucket++;
+  if (count_ == 0 || value_in_us < min_) min_ = value_in_us;
+  if (count_ == 0 || value_in_us > max_) max_ = value_in_us;
+  count_++;
+  sum_ += value_in_us;
+}
+
+void GCPhaseHistogram::Reset() { *this = GCPhaseHistogram(); }
+
+int64_t GCPhaseHistogram::ValueAtPercentile(double percentile) const {
+  if (count_ == 0) return -1;
+  DCHECK_GE(percentile, 0.0);
+  DCHECK_LE(percentile, 100.0);
+  // Rank of the requested sample, 1-based.
+  const int64_t rank = std::max(
+      int64_t{1},
+      static_cast<int64_t>(std::ceil(percentile / 100.0 * count_)));
+  int64_t seen = 0;
+  for (int i = 0; i < kBucketCount; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      return std::min(std::max(BucketLowerBound(i), min_), max_);
+    }
+  }
+  return max_;
+}
+
+void GCPhaseHistogram::FillEvent(
+    v8::metrics::GarbageCollectionPhaseHistogram* event) const {
+  event->sample_count = count_;
+  event->min_in_us = IsEmpty() ? -1 : min_;
+  event->max_in_us = IsEmpty() ? -1 : max_;
+  event->sum_in_us = IsEmpty() ? -1 : sum_;
+  event->p50_in_us = ValueAtPercentile(50);
+  event->p99_in_us = ValueAtPercentile(99);
+  event->p999_in_us = ValueAtPercentile(99.9);
+  event->bucket_lower_bounds_in_us.clear();
+  event->bucket_upper_bounds_in_us.clear();
+  event->bucket_counts.clear();
+  for (int i = 0; i < kBucketCount; i++) {
+    if (buckets_[i] == 0) continue;
+    event->bucket_lower_bounds_in_us.push_back(BucketLowerBound(i));
+    event->bucket_upper_bounds_in_us.push_back(BucketUpperBound(i));
+    event->bucket_counts.push_back(buckets_[i]);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
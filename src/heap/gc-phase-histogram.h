@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_GC_PHASE_HISTOGRAM_H_
+#define V8_HEAP_GC_PHASE_HISTOGRAM_H_
+
+#include <array>
+#include <cstdint>
+
+#include "include/v8-metrics.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Log-linear histogram of durations in microseconds, in the spirit of HDR
+// histograms. Values below kSubBucketCount are recorded exactly. Above that,
+// every power-of-two range [2^e, 2^(e+1)) is split into kSubBucketCount
+// equally sized buckets, which bounds the relative error of a recorded value
+// by 1/kSubBucketCount. Recording is a handful of arithmetic operations and
+// the storage is fixed, so the histogram can stay enabled in production.
+class V8_EXPORT_PRIVATE GCPhaseHistogram final {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+  // Values of 2^kMaxExponent us (~71 minutes) and above share the last
+  // bucket.
+  static constexpr int kMaxExponent = 32;
+  static constexpr int kBucketCount =
+      (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+  static int BucketIndex(int64_t value_in_us);
+  static int64_t BucketLowerBound(int index);
+  static int64_t BucketUpperBound(int index) {
+    return BucketLowerBound(index + 1);
+  }
+
+  void Record(int64_t value_in_us);
+  void Reset();
+
+  // Returns the lower bound of the bucket holding the sample at
+  // |percentile| (in [0, 100]), clamped to the observed minimum and maximum,
+  // or -1 if the histogram is empty.
+  int64_t ValueAtPercentile(double percentile) const;
+
+  // Converts the histogram into the event type reported to the embedder.
+  void FillEvent(v8::metrics::GarbageCollectionPhaseHistogram* event) const;
+
+  bool IsEmpty() const { return count_ == 0; }
+  int64_t count() const { return count_; }
+  int64_t min() const { return min_; }
+  int64_t max() const { return max_; }
+  int64_t sum() const { return sum_; }
+
+ private:
+  std::array<uint32_t, kBucketCount> buckets_{};
+  int64_t count_ = 0;
+  int64_t min_ = 0;
+  int64_t max_ = 0;
+  int64_t sum_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_GC_PHASE_HISTOGRAM_H_
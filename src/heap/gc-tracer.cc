@@ -172,6 +172,7 @@ GCTracer::GCTracer(Heap* heap)
   // map it to RuntimeCallStats.
   STATIC_ASSERT(0 == Scope::MC_INCREMENTAL);
   current_.end_time = MonotonicallyIncreasingTimeInMs();
+  last_phase_histogram_report_ms_ = current_.end_time;
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     background_counter_[i].total_duration_ms = 0;
   }
@@ -465,6 +466,11 @@ void GCTracer::StopCycle(GarbageCollector collector) {
   DCHECK(IsConsistentWithCollector(collector));
   FinalizeCurrentEvent();
 
+  if (ShouldRecordPhaseHistograms()) {
+    RecordPhaseHistograms(collector);
+    ReportPhaseHistogramsToRecorderIfNeeded();
+  }
+
   if (Heap::IsYoungGenerationCollector(collector)) {
     ReportYoungCycleToRecorder();
 
@@ -641,10 +647,20 @@ void GCTracer::AddIncrementalMarkingStep(double duration, size_t bytes) {
     incremental_marking_duration_ += duration;
   }
   ReportIncrementalMarkingStepToRecorder(duration);
+  if (ShouldRecordPhaseHistograms()) {
+    RecordPhaseSample(
+        v8::metrics::GarbageCollectionPhase::kIncrementalMarkingStep,
+        duration);
+  }
 }
 
 void GCTracer::AddIncrementalSweepingStep(double duration) {
   ReportIncrementalSweepingStepToRecorder(duration);
+  if (ShouldRecordPhaseHistograms()) {
+    RecordPhaseSample(
+        v8::metrics::GarbageCollectionPhase::kIncrementalSweepingStep,
+        duration);
+  }
 }
 
 void GCTracer::Output(const char* format, ...) const {
@@ -1734,5 +1750,66 @@ void GCTracer::ReportYoungCycleToRecorder() {
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
+bool GCTracer::ShouldRecordPhaseHistograms() const {
+  if (FLAG_gc_phase_histogram_interval_ms <= 0) return false;
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  return recorder && recorder->HasEmbedderRecorder();
+}
+
+void GCTracer::RecordPhaseSample(v8::metrics::GarbageCollectionPhase phase,
+                                 double duration_ms) {
+  phase_histograms_[static_cast<size_t>(phase)].Record(static_cast<int64_t>(
+      duration_ms * base::Time::kMicrosecondsPerMillisecond));
+}
+
+void GCTracer::RecordPhaseHistograms(GarbageCollector collector) {
+  using Phase = v8::metrics::GarbageCollectionPhase;
+  switch (collector) {
+    case GarbageCollector::SCAVENGER:
+      RecordPhaseSample(Phase::kScavenge, current_.scopes[Scope::SCAVENGER]);
+      RecordPhaseSample(Phase::kScavengeParallel,
+                        current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL]);
+      break;
+    case GarbageCollector::MINOR_MARK_COMPACTOR:
+      RecordPhaseSample(Phase::kMinorMarkCompact,
+                        current_.scopes[Scope::MINOR_MARK_COMPACTOR]);
+      break;
+    case GarbageCollector::MARK_COMPACTOR:
+      RecordPhaseSample(Phase::kMarkCompactAtomicPause,
+                        current_.scopes[Scope::MARK_COMPACTOR]);
+      RecordPhaseSample(Phase::kMarkCompactMark,
+                        current_.scopes[Scope::MC_MARK]);
+      RecordPhaseSample(Phase::kMarkCompactClear,
+                        current_.scopes[Scope::MC_CLEAR]);
+      RecordPhaseSample(Phase::kMarkCompactEvacuate,
+                        current_.scopes[Scope::MC_EVACUATE]);
+      RecordPhaseSample(Phase::kMarkCompactSweep,
+                        current_.scopes[Scope::MC_SWEEP]);
+      break;
+  }
+}
+
+void GCTracer::ReportPhaseHistogramsToRecorderIfNeeded() {
+  const double now = MonotonicallyIncreasingTimeInMs();
+  if (now - last_phase_histogram_report_ms_ <
+      FLAG_gc_phase_histogram_interval_ms) {
+    return;
+  }
+  last_phase_histogram_report_ms_ = now;
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  for (size_t i = 0; i < kNumberOfHistogramPhases; i++) {
+    GCPhaseHistogram& histogram = phase_histograms_[i];
+    if (histogram.IsEmpty()) continue;
+    v8::metrics::GarbageCollectionPhaseHistogram event;
+    event.phase = static_cast<v8::metrics::GarbageCollectionPhase>(i);
+    histogram.FillEvent(&event);
+    histogram.Reset();
+    recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -11,6 +11,7 @@
 #include "src/base/optional.h"
 #include "src/base/ring-buffer.h"
 #include "src/common/globals.h"
+#include "src/heap/gc-phase-histogram.h"
 #include "src/heap/heap.h"
 #include "src/init/heap-symbols.h"
 #include "src/logging/counters.h"
@@ -483,6 +484,14 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
   void ReportYoungCycleToRecorder();
 
+  // Per-phase pause histograms, enabled with --gc-phase-histogram-interval-ms.
+  // Samples are only collected when the embedder installed a recorder.
+  bool ShouldRecordPhaseHistograms() const;
+  void RecordPhaseSample(v8::metrics::GarbageCollectionPhase phase,
+                         double duration_ms);
+  void RecordPhaseHistograms(GarbageCollector collector);
+  void ReportPhaseHistogramsToRecorderIfNeeded();
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -576,6 +585,13 @@ class V8_EXPORT_PRIVATE GCTracer {
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalSweep
       incremental_sweep_batched_events_;
 
+  static constexpr size_t kNumberOfHistogramPhases =
+      static_cast<size_t>(
+          v8::metrics::GarbageCollectionPhase::kIncrementalSweepingStep) +
+      1;
+  std::array<GCPhaseHistogram, kNumberOfHistogramPhases> phase_histograms_;
+  double last_phase_histogram_report_ms_ = 0.0;
+
   mutable base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[Scope::NUMBER_OF_SCOPES];
 };
@@ -12,6 +12,7 @@
 #include "src/heap/large-spaces.h"
 #include "src/heap/new-spaces.h"
 #include "src/heap/paged-spaces.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/read-only-spaces.h"
 #include "src/heap/third-party/heap-api.h"
 
@@ -63,6 +64,14 @@ V8_WARN_UNUSED_RESULT V8_INLINE AllocationResult HeapAllocator::AllocateRaw(
     return AllocateRaw(size_in_bytes, AllocationType::kOld, origin, alignment);
   }
 
+  // Generated code relies on young allocations ending up in the young
+  // generation, so only runtime allocations are pretenured.
+  if (type == AllocationType::kYoung && origin == AllocationOrigin::kRuntime &&
+      V8_UNLIKELY(pretenuring_sampler_ &&
+                  pretenuring_sampler_->ShouldPretenureCurrentSource())) {
+    return AllocateRaw(size_in_bytes, AllocationType::kOld, origin, alignment);
+  }
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   if (FLAG_random_gc_interval > 0 || FLAG_gc_interval >= 0) {
     if (!heap_->always_allocate() && allocation_timeout_-- <= 0) {
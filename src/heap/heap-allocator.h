@@ -20,6 +20,7 @@ class NewSpace;
 class NewLargeObjectSpace;
 class OldLargeObjectSpace;
 class PagedSpace;
+class PretenuringSampler;
 class ReadOnlySpace;
 class Space;
 
@@ -106,6 +107,8 @@ class V8_EXPORT_PRIVATE HeapAllocator final {
   ConcurrentAllocator* shared_old_allocator_;
   ConcurrentAllocator* shared_map_allocator_;
 
+  PretenuringSampler* pretenuring_sampler_ = nullptr;
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   // If the --gc-interval flag is set to a positive value, this variable
   // holds the value indicating the number of allocations remain until the
@@ -14,19 +14,46 @@ template <typename Trait>
 double MemoryController<Trait>::GrowingFactor(Heap* heap, size_t max_heap_size,
                                               double gc_speed,
                                               double mutator_speed) {
-  const double max_factor = MaxGrowingFactor(max_heap_size);
-  const double factor =
-      DynamicGrowingFactor(gc_speed, mutator_speed, max_factor);
+  double max_factor = MaxGrowingFactor(max_heap_size);
+  double target_mutator_utilization = Trait::kTargetMutatorUtilization;
+  if (heap->gc_time_fraction_goal() > 0) {
+    // The embedder trades memory for throughput, so only the maximum heap
+    // size limits the growth.
+    max_factor = Trait::kMaxGrowingFactor;
+    target_mutator_utilization = GoalMutatorUtilization(
+        heap->gc_time_fraction_goal(),
+        heap->tracer()->AverageMarkCompactMutatorUtilization());
+  }
+  const double factor = DynamicGrowingFactor(
+      gc_speed, mutator_speed, max_factor, target_mutator_utilization);
   if (FLAG_trace_gc_verbose) {
     Isolate::FromHeap(heap)->PrintWithTimestamp(
         "[%s] factor %.1f based on mu=%.3f, speed_ratio=%.f "
         "(gc=%.f, mutator=%.f)\n",
-        Trait::kName, factor, Trait::kTargetMutatorUtilization,
+        Trait::kName, factor, target_mutator_utilization,
         gc_speed / mutator_speed, gc_speed, mutator_speed);
   }
   return factor;
 }
 
+// The growing factor only accounts for the time to mark and compact the live
+// objects at the speed measured so far. The actual time spent in GC also
+// includes scavenges, incremental steps and sweeping, so the target is raised
+// by the amount the measured mutator utilization falls short of the goal, and
+// lowered when the GC takes less time than the goal allows.
+template <typename Trait>
+double MemoryController<Trait>::GoalMutatorUtilization(
+    double gc_time_fraction_goal, double measured_mutator_utilization) {
+  DCHECK_LT(0, gc_time_fraction_goal);
+  DCHECK_GT(1, gc_time_fraction_goal);
+  const double goal = 1 - gc_time_fraction_goal;
+  // The tracer reports a utilization of 1 until it measured a full GC cycle.
+  if (measured_mutator_utilization >= 1) return goal;
+  const double corrected = 2 * goal - measured_mutator_utilization;
+  return std::min(std::max(corrected, 1 - 2 * gc_time_fraction_goal),
+                  1 - gc_time_fraction_goal / 2);
+}
+
 template <typename Trait>
 double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
   constexpr double kMinSmallFactor = 1.3;
@@ -55,14 +82,14 @@ double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
 
 // Given GC speed in bytes per ms, the allocation throughput in bytes per ms
 // (mutator speed), this function returns the heap growing factor that will
-// achieve the target_mutator_utilization_ if the GC speed and the mutator speed
+// achieve the target_mutator_utilization if the GC speed and the mutator speed
 // remain the same until the next GC.
 //
 // For a fixed time-frame T = TM + TG, the mutator utilization is the ratio
 // TM / (TM + TG), where TM is the time spent in the mutator and TG is the
 // time spent in the garbage collector.
 //
-// Let MU be target_mutator_utilization_, the desired mutator utilization for
+// Let MU be target_mutator_utilization, the desired mutator utilization for
 // the time-frame from the end of the current GC to the end of the next GC.
 // Based on the MU we can compute the heap growing factor F as
 //
@@ -93,18 +120,20 @@ double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
 //   F * (R * (1 - MU) - MU) / (R * (1 - MU)) = 1
 //   F = R * (1 - MU) / (R * (1 - MU) - MU)
 template <typename Trait>
-double MemoryController<Trait>::DynamicGrowingFactor(double gc_speed,
-                                                     double mutator_speed,
-                                                     double max_factor) {
+double MemoryController<Trait>::DynamicGrowingFactor(
+    double gc_speed, double mutator_speed, double max_factor,
+    double target_mutator_utilization) {
   DCHECK_LE(Trait::kMinGrowingFactor, max_factor);
   DCHECK_GE(Trait::kMaxGrowingFactor, max_factor);
+  DCHECK_LT(0, target_mutator_utilization);
+  DCHECK_GT(1, target_mutator_utilization);
   if (gc_speed == 0 || mutator_speed == 0) return max_factor;
 
   const double speed_ratio = gc_speed / mutator_speed;
+  const double mu = target_mutator_utilization;
 
-  const double a = speed_ratio * (1 - Trait::kTargetMutatorUtilization);
-  const double b = speed_ratio * (1 - Trait::kTargetMutatorUtilization) -
-                   Trait::kTargetMutatorUtilization;
+  const double a = speed_ratio * (1 - mu);
+  const double b = speed_ratio * (1 - mu) - mu;
 
   // The factor is a / b, but we need to check for small b first.
   double factor = (a < b * max_factor) ? a / b : max_factor;
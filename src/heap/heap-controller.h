@@ -49,10 +49,17 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
 
  private:
   static double MaxGrowingFactor(size_t max_heap_size);
-  static double DynamicGrowingFactor(double gc_speed, double mutator_speed,
-                                     double max_factor);
+  static double DynamicGrowingFactor(
+      double gc_speed, double mutator_speed, double max_factor,
+      double target_mutator_utilization = Trait::kTargetMutatorUtilization);
+  // Returns the mutator utilization to target for the given GC time fraction
+  // goal, corrected by how far the measured utilization missed it.
+  static double GoalMutatorUtilization(double gc_time_fraction_goal,
+                                       double measured_mutator_utilization);
 
+  FRIEND_TEST(MemoryControllerTest, GoalMutatorUtilization);
   FRIEND_TEST(MemoryControllerTest, HeapGrowingFactor);
+  FRIEND_TEST(MemoryControllerTest, HeapGrowingFactorWithGoal);
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
@@ -84,11 +84,16 @@ base::EnumSet<CodeFlushMode> Heap::GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kFlushBaselineCode);
   }
 
+  if (FLAG_flush_feedback_vectors) {
+    code_flush_mode.Add(CodeFlushMode::kFlushFeedbackVectors);
+  }
+
   if (FLAG_stress_flush_code) {
     // This is to check tests accidentally don't miss out on adding either flush
     // bytecode or flush code along with stress flush code. stress_flush_code
     // doesn't do anything if either one of them isn't enabled.
-    DCHECK(FLAG_fuzzing || FLAG_flush_baseline_code || FLAG_flush_bytecode);
+    DCHECK(FLAG_fuzzing || FLAG_flush_baseline_code || FLAG_flush_bytecode ||
+           FLAG_flush_feedback_vectors);
     code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
   }
 
@@ -152,6 +157,12 @@ void Heap::SetPendingOptimizeForTestBytecode(Object hash_table) {
   roots_table()[RootIndex::kPendingOptimizeForTestBytecode] = hash_table.ptr();
 }
 
+void Heap::SetLazyCodeCacheFunctions(Object hash_table) {
+  DCHECK(hash_table.IsEphemeronHashTable() ||
+         hash_table.IsUndefined(isolate()));
+  roots_table()[RootIndex::kLazyCodeCacheFunctions] = hash_table.ptr();
+}
+
 PagedSpace* Heap::paged_space(int idx) {
   DCHECK(idx == OLD_SPACE || idx == CODE_SPACE || idx == MAP_SPACE);
   return static_cast<PagedSpace*>(space_[idx]);
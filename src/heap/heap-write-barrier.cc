@@ -6,6 +6,7 @@
 
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier.h"
 #include "src/objects/code-inl.h"
 #include "src/objects/descriptor-array.h"
@@ -18,6 +19,16 @@ namespace internal {
 
 namespace {
 thread_local MarkingBarrier* current_marking_barrier = nullptr;
+
+// Young generation marking only needs to know about values stored into young
+// hosts. Returns true if the write was handled.
+V8_INLINE bool MinorMarkingSlow(Heap* heap, HeapObject value) {
+  if (V8_LIKELY(!FLAG_concurrent_minor_mc_marking)) return false;
+  MinorMarkCompactCollector* collector = heap->minor_mark_compact_collector();
+  if (!collector->IsConcurrentMarkingActive()) return false;
+  collector->MarkValueFromBarrier(value);
+  return true;
+}
 }  // namespace
 
 MarkingBarrier* WriteBarrier::CurrentMarkingBarrier(Heap* heap) {
@@ -37,6 +48,7 @@ void WriteBarrier::ClearForThread(MarkingBarrier* marking_barrier) {
 
 void WriteBarrier::MarkingSlow(Heap* heap, HeapObject host, HeapObjectSlot slot,
                                HeapObject value) {
+  if (MinorMarkingSlow(heap, value)) return;
   MarkingBarrier* marking_barrier = current_marking_barrier
                                         ? current_marking_barrier
                                         : heap->marking_barrier();
@@ -45,6 +57,7 @@ void WriteBarrier::MarkingSlow(Heap* heap, HeapObject host, HeapObjectSlot slot,
 
 // static
 void WriteBarrier::MarkingSlowFromGlobalHandle(Heap* heap, HeapObject value) {
+  if (MinorMarkingSlow(heap, value)) return;
   heap->marking_barrier()->WriteWithoutHost(value);
 }
 
@@ -58,6 +71,7 @@ void WriteBarrier::MarkingSlowFromInternalFields(Heap* heap, JSObject host) {
 
 void WriteBarrier::MarkingSlow(Heap* heap, Code host, RelocInfo* reloc_info,
                                HeapObject value) {
+  if (MinorMarkingSlow(heap, value)) return;
   MarkingBarrier* marking_barrier = current_marking_barrier
                                         ? current_marking_barrier
                                         : heap->marking_barrier();
@@ -66,6 +80,12 @@ void WriteBarrier::MarkingSlow(Heap* heap, Code host, RelocInfo* reloc_info,
 
 void WriteBarrier::MarkingSlow(Heap* heap, JSArrayBuffer host,
                                ArrayBufferExtension* extension) {
+  if (V8_UNLIKELY(FLAG_concurrent_minor_mc_marking) &&
+      heap->minor_mark_compact_collector()->IsConcurrentMarkingActive()) {
+    // The host may have been visited before the extension was attached.
+    extension->YoungMark();
+    return;
+  }
   MarkingBarrier* marking_barrier = current_marking_barrier
                                         ? current_marking_barrier
                                         : heap->marking_barrier();
@@ -74,6 +94,7 @@ void WriteBarrier::MarkingSlow(Heap* heap, JSArrayBuffer host,
 
 void WriteBarrier::MarkingSlow(Heap* heap, DescriptorArray descriptor_array,
                                int number_of_own_descriptors) {
+  if (MinorMarkingSlow(heap, descriptor_array)) return;
   MarkingBarrier* marking_barrier = current_marking_barrier
                                         ? current_marking_barrier
                                         : heap->marking_barrier();
@@ -28,6 +28,7 @@
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/isolate-utils-inl.h"
 #include "src/execution/microtask-queue.h"
@@ -36,6 +37,7 @@
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/basic-memory-chunk.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/code-object-registry.h"
 #include "src/heap/code-range.h"
 #include "src/heap/code-stats.h"
@@ -55,6 +57,7 @@
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/large-spaces.h"
+#include "src/heap/load-schedule.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
@@ -68,6 +71,7 @@
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/paged-spaces-inl.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/parked-scope.h"
 #include "src/heap/read-only-heap.h"
 #include "src/heap/remembered-set.h"
@@ -102,6 +106,16 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
+
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-engine.h"
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+#ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+#include "src/heap/conservative-stack-visitor.h"
+#endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
 
@@ -200,6 +214,7 @@ Heap::Heap()
     : isolate_(isolate()),
       heap_allocator_(this),
       memory_pressure_level_(MemoryPressureLevel::kNone),
+      load_schedule_(std::make_unique<LoadSchedule>()),
       global_pretenuring_feedback_(kInitialFeedbackCapacity),
       safepoint_(std::make_unique<IsolateSafepoint>(this)),
       external_string_table_(this),
@@ -362,7 +377,8 @@ size_t Heap::CommittedOldGenerationMemory() {
 size_t Heap::CommittedMemoryOfUnmapper() {
   if (!HasBeenSetUp()) return 0;
 
-  return memory_allocator()->unmapper()->CommittedBufferedMemory();
+  return memory_allocator()->unmapper()->CommittedBufferedMemory() +
+         memory_allocator()->huge_page_pool()->CommittedFreeMemory();
 }
 
 size_t Heap::CommittedMemory() {
@@ -1355,6 +1371,25 @@ void Heap::InvalidateCodeDeoptimizationData(Code code) {
   code.set_deoptimization_data(ReadOnlyRoots(this).empty_fixed_array());
 }
 
+void Heap::MigrateDeprecatedInstances() {
+  if (!has_deprecated_maps_) return;
+  has_deprecated_maps_ = false;
+  HandleScope scope(isolate());
+  std::vector<Handle<JSObject>> instances;
+  {
+    HeapObjectIterator iterator(this);
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.map().is_deprecated() || !obj.IsJSObject()) continue;
+      instances.push_back(handle(JSObject::cast(obj), isolate()));
+    }
+  }
+  for (Handle<JSObject> object : instances) {
+    JSObject::MigrateInstance(isolate(), object);
+    isolate()->counters()->eager_instance_migrations()->Increment();
+  }
+}
+
 void Heap::DeoptMarkedAllocationSites() {
   // TODO(hpayer): If iterating over the allocation sites list becomes a
   // performance issue, use a cache data structure in heap instead.
@@ -1771,6 +1806,7 @@ bool Heap::CollectGarbage(AllocationSpace space,
   // garbage collection since they may allocate.
 
   DCHECK(AllowGarbageCollection::IsAllowed());
+  ContextCpuTimeScope cpu_time_scope(isolate(), ContextCpuTime::Activity::kGC);
 
   // Ensure that all pending phantom callbacks are invoked.
   isolate()->global_handles()->InvokeSecondPassPhantomCallbacks();
@@ -1986,6 +2022,9 @@ void Heap::StartIncrementalMarking(int gc_flags,
                                    GCCallbackFlags gc_callback_flags) {
   DCHECK(incremental_marking()->IsStopped());
 
+  // Full marking takes over the marking barrier.
+  minor_mark_compact_collector()->AbortConcurrentMarking();
+
   // Sweeping needs to be completed such that markbits are all cleared before
   // starting marking again.
   CompleteSweepingFull();
@@ -2035,6 +2074,11 @@ void Heap::StartIncrementalMarkingIfAllocationLimitIsReached(
             gc_callback_flags);
         break;
       case IncrementalMarkingLimit::kSoftLimit:
+        // Defer the start of incremental marking while the embedder expects
+        // high load. The hard limit still starts marking right away.
+        if (load_schedule_->InLoadWindow(MonotonicallyIncreasingTimeInMs())) {
+          break;
+        }
         incremental_marking()->incremental_marking_job()->ScheduleTask(this);
         break;
       case IncrementalMarkingLimit::kFallbackForEmbedderLimit:
@@ -2586,6 +2630,13 @@ void Heap::MarkCompact() {
   UpdateOldGenerationAllocationCounter();
   uint64_t size_of_objects_before_gc = SizeOfObjects();
 
+  if (pretenuring_sampler_) {
+    // Samples are only evaluated by the scavenger, which leaves all live
+    // objects forwarded on from pages.
+    pretenuring_sampler_->ResetSamples();
+    if (ShouldReduceMemory()) pretenuring_sampler_->ResetDecisions();
+  }
+
   mark_compact_collector()->Prepare();
 
   ms_count_++;
@@ -2622,6 +2673,8 @@ void Heap::MinorMarkCompact() {
   PauseAllocationObserversScope pause_observers(this);
   SetGCState(MINOR_MARK_COMPACT);
 
+  if (pretenuring_sampler_) pretenuring_sampler_->ResetSamples();
+
   TRACE_GC(tracer(), GCTracer::Scope::MINOR_MC);
   AlwaysAllocateScope always_allocate(this);
   // Disable soft allocation limits in the shared heap, if one exists, as
@@ -2653,6 +2706,12 @@ void Heap::MarkCompactEpilogue() {
 
   incremental_marking()->Epilogue();
 
+  // Marking may not allocate, so the migration only runs on the next stack
+  // check, batched for all maps deprecated since the last one.
+  if (FLAG_eager_instance_migration && has_deprecated_maps_) {
+    isolate_->stack_guard()->RequestMigrateDeprecatedInstances();
+  }
+
   DCHECK(incremental_marking()->IsStopped());
 }
 
@@ -2665,19 +2724,66 @@ void Heap::MarkCompactPrologue() {
   isolate_->compilation_cache()->MarkCompactPrologue();
 
   FlushNumberStringCache();
+  set_error_stack_frames_cache(ReadOnlyRoots(this).undefined_value());
 }
 
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
+  const size_t capacity = new_space_->TotalCapacity();
+  const bool exceeds_pause_target =
+      scavenge_pause_target_ms_ > 0 &&
+      EstimatedScavengePauseMs(std::min(
+          new_space_->MaximumCapacity(),
+          static_cast<size_t>(FLAG_semi_space_growth_factor) * capacity)) >
+          scavenge_pause_target_ms_;
+  if (capacity < new_space_->MaximumCapacity() && !exceeds_pause_target &&
+      (survived_since_last_expansion_ > capacity ||
+       ScavengeTimeFractionExceedsGoal())) {
     // Grow the size of new space if there is room to grow, and enough data
-    // has survived scavenge since the last expansion.
+    // has survived scavenge since the last expansion or scavenges take too
+    // much time.
     new_space_->Grow();
     survived_since_last_expansion_ = 0;
   }
   new_lo_space()->SetCapacity(new_space()->Capacity());
 }
 
+double Heap::EstimatedScavengePauseMs(size_t new_space_capacity) {
+  const double scavenge_speed =
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects);
+  if (scavenge_speed == 0) return 0;
+  const double survived = new_space_capacity *
+                          tracer()->AverageSurvivalRatio() / 100;
+  return survived / scavenge_speed;
+}
+
+void Heap::SetMaxYoungGenerationSize(size_t max_young_generation_size) {
+  requested_max_semi_space_size_ = std::max(
+      SemiSpaceSizeFromYoungGenerationSize(max_young_generation_size),
+      initial_semispace_size_);
+}
+
+void Heap::ApplyRequestedMaxSemiSpaceSize() {
+  if (requested_max_semi_space_size_ == 0) return;
+  max_semi_space_size_ =
+      new_space_->SetMaximumCapacity(requested_max_semi_space_size_);
+  new_lo_space_->SetCapacity(new_space_->Capacity());
+  requested_max_semi_space_size_ = 0;
+}
+
+bool Heap::ScavengeTimeFractionExceedsGoal() {
+  if (gc_time_fraction_goal_ == 0) return false;
+  const double scavenge_speed =
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects);
+  const double allocation_throughput =
+      tracer()->NewSpaceAllocationThroughputInBytesPerMillisecond();
+  if (scavenge_speed == 0 || allocation_throughput == 0) return false;
+  // Compare the time to scavenge the survivors with the time it takes the
+  // mutator to fill the new space again.
+  const double scavenge_ms = SurvivedYoungObjectSize() / scavenge_speed;
+  const double mutator_ms = new_space_->TotalCapacity() / allocation_throughput;
+  return scavenge_ms > gc_time_fraction_goal_ * (scavenge_ms + mutator_ms);
+}
+
 void Heap::EvacuateYoungGeneration() {
   TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_FAST_PROMOTE);
   base::MutexGuard guard(relocation_mutex());
@@ -3391,6 +3497,11 @@ bool Heap::CanMoveObjectStart(HeapObject object) {
 
   if (IsLargeObject(object)) return false;
 
+  // Concurrent young generation markers may have references to the object.
+  if (minor_mark_compact_collector()->IsConcurrentMarkingActive()) {
+    return false;
+  }
+
   // Compilation jobs may have references to the object.
   if (isolate()->concurrent_recompilation_enabled() &&
       isolate()->optimizing_compile_dispatcher()->HasJobs()) {
@@ -3855,11 +3966,16 @@ void Heap::ReduceNewSpaceSize() {
   const double allocation_throughput =
       tracer()->CurrentAllocationThroughputInBytesPerMillisecond();
 
+  ApplyRequestedMaxSemiSpaceSize();
+
   if (FLAG_predictable) return;
 
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
-       (allocation_throughput < kLowAllocationThroughput))) {
+       (allocation_throughput < kLowAllocationThroughput)) ||
+      (scavenge_pause_target_ms_ > 0 &&
+       EstimatedScavengePauseMs(new_space_->TotalCapacity()) >
+           scavenge_pause_target_ms_)) {
     new_space_->Shrink();
     new_lo_space_->SetCapacity(new_space_->Capacity());
     UncommitFromSpace();
@@ -3945,6 +4061,10 @@ void Heap::FinalizeIncrementalMarkingIncrementally(
 void Heap::NotifyObjectLayoutChange(
     HeapObject object, const DisallowGarbageCollection&,
     InvalidateRecordedSlots invalidate_recorded_slots) {
+  if (V8_UNLIKELY(FLAG_concurrent_minor_mc_marking) &&
+      minor_mark_compact_collector()->IsConcurrentMarkingActive()) {
+    minor_mark_compact_collector()->NotifyObjectLayoutChange(object);
+  }
   if (incremental_marking()->IsMarking()) {
     incremental_marking()->MarkBlackAndVisitObjectDueToLayoutChange(object);
     if (incremental_marking()->IsCompacting() &&
@@ -4194,6 +4314,10 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
       isolate_->counters()->gc_idle_notification());
   TRACE_EVENT0("v8", "V8.GCIdleNotification");
   double start_ms = MonotonicallyIncreasingTimeInMs();
+  // Do not let idle time work spill into an expected load window.
+  deadline_in_ms = std::min(
+      deadline_in_ms,
+      start_ms + load_schedule_->TimeUntilNextLoadWindow(start_ms));
   double idle_time_in_ms = deadline_in_ms - start_ms;
 
   tracer()->SampleAllocation(start_ms, NewSpaceAllocationCounter(),
@@ -4231,6 +4355,23 @@ class MemoryPressureInterruptTask : public CancelableTask {
   Heap* heap_;
 };
 
+void Heap::ExpectedLoadNotification(double start_in_seconds,
+                                    double end_in_seconds) {
+  const double kMillisecondsPerSecond =
+      static_cast<double>(base::Time::kMillisecondsPerSecond);
+  load_schedule_->AddWindow(start_in_seconds * kMillisecondsPerSecond,
+                            end_in_seconds * kMillisecondsPerSecond);
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "Expected load in %.f ms for %.f ms\n",
+        start_in_seconds * kMillisecondsPerSecond -
+            MonotonicallyIncreasingTimeInMs(),
+        (end_in_seconds - start_in_seconds) * kMillisecondsPerSecond);
+  }
+}
+
+void Heap::ClearExpectedLoadNotifications() { load_schedule_->Clear(); }
+
 void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
@@ -4241,6 +4382,13 @@ void Heap::CheckMemoryPressure() {
   // the finalizers.
   MemoryPressureLevel memory_pressure_level = memory_pressure_level_.exchange(
       MemoryPressureLevel::kNone, std::memory_order_relaxed);
+#if V8_ENABLE_WEBASSEMBLY
+  if (memory_pressure_level != MemoryPressureLevel::kNone) {
+    // Release wasm code which is not needed any more.
+    wasm::GetWasmEngine()->MemoryPressureNotification(isolate(),
+                                                      memory_pressure_level);
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
     CollectGarbageOnMemoryPressure();
@@ -4295,6 +4443,11 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous =
       memory_pressure_level_.exchange(level, std::memory_order_relaxed);
+  if (level != MemoryPressureLevel::kNone) {
+    // Pooled zone segments are cheap to give back right away, also off the
+    // isolate's thread.
+    isolate()->allocator()->ReleasePooledSegments();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -5160,6 +5313,15 @@ void Heap::IterateBuiltins(RootVisitor* v) {
 void Heap::IterateStackRoots(RootVisitor* v) {
   isolate_->Iterate(v);
   isolate_->global_handles()->IterateStrongStackRoots(v);
+#ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+  // Scavenges move all surviving young objects and cannot pin them, so only
+  // old-generation objects are kept alive from raw stack slots.
+  if (gc_state() != SCAVENGE) {
+    ConservativeStackVisitor stack_visitor(isolate_, v);
+    ::heap::base::Stack stack(v8::base::Stack::GetStackStart());
+    stack.IteratePointers(&stack_visitor);
+  }
+#endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 }
 
 namespace {
@@ -5239,6 +5401,19 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
   CHECK_IMPLIES(FLAG_max_heap_size > 0,
                 FLAG_max_semi_space_size == 0 || FLAG_max_old_space_size == 0);
 
+  scavenge_pause_target_ms_ = FLAG_scavenge_pause_target_ms;
+
+  // Initialize gc_time_fraction_goal_.
+  {
+    double goal = constraints.gc_time_fraction_goal();
+    if (FLAG_gc_time_fraction_goal > 0) goal = FLAG_gc_time_fraction_goal;
+    if (goal > 0) {
+      gc_time_fraction_goal_ =
+          std::min(std::max(goal, kMinGCTimeFractionGoal),
+                   kMaxGCTimeFractionGoal);
+    }
+  }
+
   // Initialize initial_semispace_size_.
   {
     initial_semispace_size_ = kMinSemiSpaceSize;
@@ -5717,20 +5892,18 @@ void Heap::SetUp(LocalHeap* main_thread_local_heap) {
     // When a target requires the code range feature, we put all code objects in
     // a contiguous range of virtual address space, so that they can call each
     // other with near calls.
-    if (COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL) {
-      // When sharing a pointer cage among Isolates, also share the
-      // CodeRange. isolate_->page_allocator() is the process-wide pointer
-      // compression cage's PageAllocator.
-      code_range_ = CodeRange::EnsureProcessWideCodeRange(
-          isolate_->page_allocator(), requested_size);
-    } else {
-      code_range_ = std::make_shared<CodeRange>();
-      if (!code_range_->InitReservation(isolate_->page_allocator(),
-                                        requested_size)) {
-        V8::FatalProcessOutOfMemory(
-            isolate_, "Failed to reserve virtual memory for CodeRange");
-      }
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+    // When sharing a pointer cage among the Isolates of a group, also share
+    // the CodeRange.
+    code_range_ = isolate_->isolate_group()->EnsureCodeRange(requested_size);
+#else
+    code_range_ = std::make_shared<CodeRange>();
+    if (!code_range_->InitReservation(isolate_->page_allocator(),
+                                      requested_size)) {
+      V8::FatalProcessOutOfMemory(
+          isolate_, "Failed to reserve virtual memory for CodeRange");
     }
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 
     LOG(isolate_,
         NewEvent("CodeRange",
@@ -5854,6 +6027,7 @@ void Heap::SetUpSpaces(LinearAllocationArea* new_allocation_info,
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
+  bytecode_flushing_policy_.reset(new BytecodeFlushingPolicy());
   if (V8_UNLIKELY(TracingFlags::is_gc_stats_enabled())) {
     live_object_stats_.reset(new ObjectStats(this));
     dead_object_stats_.reset(new ObjectStats(this));
@@ -5879,6 +6053,10 @@ void Heap::SetUpSpaces(LinearAllocationArea* new_allocation_info,
     scavenge_task_observer_.reset(new ScavengeTaskObserver(
         this, ScavengeJob::YoungGenerationTaskTriggerSize(this)));
     new_space()->AddAllocationObserver(scavenge_task_observer_.get());
+    if (FLAG_allocation_sampling_pretenuring) {
+      pretenuring_sampler_.reset(new PretenuringSampler(this));
+      new_space()->AddAllocationObserver(pretenuring_sampler_.get());
+    }
   }
 
   SetGetExternallyAllocatedMemoryInBytesCallback(
@@ -6122,9 +6300,13 @@ void Heap::TearDown() {
 
   if (new_space()) {
     new_space()->RemoveAllocationObserver(scavenge_task_observer_.get());
+    if (pretenuring_sampler_) {
+      new_space()->RemoveAllocationObserver(pretenuring_sampler_.get());
+    }
   }
 
   scavenge_task_observer_.reset();
+  pretenuring_sampler_.reset();
   scavenge_job_.reset();
 
   if (need_to_remove_stress_concurrent_allocation_observer_) {
@@ -6169,6 +6351,7 @@ void Heap::TearDown() {
     memory_reducer_->TearDown();
     memory_reducer_.reset();
   }
+  bytecode_flushing_policy_.reset();
 
   live_object_stats_.reset();
   dead_object_stats_.reset();
@@ -7271,7 +7454,7 @@ Code Heap::GcSafeFindCodeForInnerPointer(Address inner_pointer) {
     }
   }
   // TODO(1241665): Remove once the issue is solved.
-  std::shared_ptr<CodeRange> code_range = CodeRange::GetProcessWideCodeRange();
+  CodeRange* code_range = code_range_.get();
   void* code_range_embedded_blob_code_copy =
       code_range ? code_range->embedded_blob_code_copy() : nullptr;
   Address flags = (isolate()->is_short_builtin_calls_enabled() ? 1 : 0) |
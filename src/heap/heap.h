@@ -78,6 +78,7 @@ using v8::MemoryPressureLevel;
 class ArrayBufferCollector;
 class ArrayBufferSweeper;
 class BasicMemoryChunk;
+class BytecodeFlushingPolicy;
 class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
@@ -96,6 +97,7 @@ class HeapStats;
 class Isolate;
 class JSFinalizationRegistry;
 class LinearAllocationArea;
+class LoadSchedule;
 class LocalEmbedderHeapTracer;
 class LocalHeap;
 class MarkingBarrier;
@@ -109,6 +111,7 @@ class ObjectIterator;
 class ObjectStats;
 class Page;
 class PagedSpace;
+class PretenuringSampler;
 class ReadOnlyHeap;
 class RootVisitor;
 class RwxMemoryWriteScope;
@@ -376,6 +379,10 @@ class Heap {
   STATIC_ASSERT(kMinSemiSpaceSize % (1 << kPageSizeBits) == 0);
   STATIC_ASSERT(kMaxSemiSpaceSize % (1 << kPageSizeBits) == 0);
 
+  // Bounds for the GC time fraction goal configured by the embedder.
+  static constexpr double kMinGCTimeFractionGoal = 0.001;
+  static constexpr double kMaxGCTimeFractionGoal = 0.5;
+
   static const int kTraceRingBufferSize = 512;
   static const int kStacktraceBufferSize = 512;
 
@@ -703,6 +710,12 @@ class Heap {
                                                     bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Records a window of expected mutator load reported by the embedder. Both
+  // times are based on the platform's MonotonicallyIncreasingTime().
+  V8_EXPORT_PRIVATE void ExpectedLoadNotification(double start_in_seconds,
+                                                  double end_in_seconds);
+  V8_EXPORT_PRIVATE void ClearExpectedLoadNotifications();
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -710,6 +723,17 @@ class Heap {
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
 
+  // Limits the young generation to |max_young_generation_size| bytes. The new
+  // limit takes effect after the next GC.
+  V8_EXPORT_PRIVATE void SetMaxYoungGenerationSize(
+      size_t max_young_generation_size);
+  // Lets the semispaces only grow while scavenges are estimated to take less
+  // than |scavenge_pause_target_ms|, and shrink them otherwise. 0 disables
+  // the target.
+  void SetScavengePauseTargetMs(double scavenge_pause_target_ms) {
+    scavenge_pause_target_ms_ = scavenge_pause_target_ms;
+  }
+
   void AppendArrayBufferExtension(JSArrayBuffer object,
                                   ArrayBufferExtension* extension);
   void DetachArrayBufferExtension(JSArrayBuffer object,
@@ -734,6 +758,14 @@ class Heap {
 
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
+  // Returns true if scavenges take a larger fraction of the time than the GC
+  // time fraction goal allows.
+  bool ScavengeTimeFractionExceedsGoal();
+  // Returns the estimated duration of a scavenge of a new space with the given
+  // capacity, based on the survival rate and scavenge speed measured so far.
+  double EstimatedScavengePauseMs(size_t new_space_capacity);
+  // Applies the limit requested through SetMaxYoungGenerationSize.
+  void ApplyRequestedMaxSemiSpaceSize();
 
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
@@ -934,6 +966,7 @@ class Heap {
   V8_INLINE void SetRootNoScriptSharedFunctionInfos(Object value);
   V8_INLINE void SetMessageListeners(TemplateList value);
   V8_INLINE void SetPendingOptimizeForTestBytecode(Object bytecode);
+  V8_INLINE void SetLazyCodeCacheFunctions(Object hash_table);
 
   StrongRootsEntry* RegisterStrongRoots(const char* label, FullObjectSlot start,
                                         FullObjectSlot end);
@@ -1170,6 +1203,14 @@ class Heap {
 
   void DeoptMarkedAllocationSites();
 
+  // Called when a map got deprecated. With --eager-instance-migration, the
+  // next full GC schedules the migration of all instances of deprecated maps.
+  void NotifyMapDeprecated() { has_deprecated_maps_ = true; }
+
+  // Migrates all instances of deprecated maps in one heap walk, so that they
+  // do not have to be migrated one at a time on their next access.
+  void MigrateDeprecatedInstances();
+
   bool DeoptMaybeTenuredAllocationSites();
 
   // ===========================================================================
@@ -1313,6 +1354,9 @@ class Heap {
   size_t MaxSemiSpaceSize() { return max_semi_space_size_; }
   size_t InitialSemiSpaceSize() { return initial_semispace_size_; }
   size_t MaxOldGenerationSize() { return max_old_generation_size(); }
+  // The fraction of time the embedder wants to spend at most in GC, or 0 if
+  // the heap grows based on the default mutator utilization.
+  double gc_time_fraction_goal() const { return gc_time_fraction_goal_; }
 
   // Limit on the max old generation size imposed by the underlying allocator.
   V8_EXPORT_PRIVATE static size_t AllocatorLimitOnMaxOldGenerationSize();
@@ -1995,6 +2039,16 @@ class Heap {
 
   MemoryReducer* memory_reducer() { return memory_reducer_.get(); }
 
+  BytecodeFlushingPolicy* bytecode_flushing_policy() {
+    return bytecode_flushing_policy_.get();
+  }
+
+  LoadSchedule* load_schedule() { return load_schedule_.get(); }
+
+  PretenuringSampler* pretenuring_sampler() {
+    return pretenuring_sampler_.get();
+  }
+
   // For some webpages RAIL mode does not switch from PERFORMANCE_LOAD.
   // This constant limits the effect of load RAIL mode on GC.
   // The value is arbitrary and chosen as the largest load time observed in
@@ -2170,6 +2224,11 @@ class Heap {
   size_t min_global_memory_size_ = 0;
   size_t max_global_memory_size_ = 0;
 
+  double gc_time_fraction_goal_ = 0;
+  double scavenge_pause_target_ms_ = 0;
+  // The semispace size requested through SetMaxYoungGenerationSize, or 0.
+  size_t requested_max_semi_space_size_ = 0;
+
   size_t initial_max_old_generation_size_ = 0;
   size_t initial_max_old_generation_size_threshold_ = 0;
   size_t initial_old_generation_size_ = 0;
@@ -2338,10 +2397,13 @@ class Heap {
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+  std::unique_ptr<BytecodeFlushingPolicy> bytecode_flushing_policy_;
+  std::unique_ptr<LoadSchedule> load_schedule_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<ScavengeJob> scavenge_job_;
   std::unique_ptr<AllocationObserver> scavenge_task_observer_;
+  std::unique_ptr<PretenuringSampler> pretenuring_sampler_;
   std::unique_ptr<AllocationObserver> stress_concurrent_allocation_observer_;
   std::unique_ptr<LocalEmbedderHeapTracer> local_embedder_heap_tracer_;
   std::unique_ptr<MarkingBarrier> marking_barrier_;
@@ -2461,6 +2523,9 @@ class Heap {
 
   bool is_finalization_registry_cleanup_task_posted_ = false;
 
+  // Whether maps got deprecated since the last MigrateDeprecatedInstances.
+  bool has_deprecated_maps_ = false;
+
   std::unique_ptr<third_party_heap::Heap> tp_heap_;
 
   // Classes in "heap" can be friends.
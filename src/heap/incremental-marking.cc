@@ -173,6 +173,8 @@ void IncrementalMarking::Start(GarbageCollectionReason gc_reason) {
   scheduled_bytes_to_mark_ = 0;
   schedule_update_time_ms_ = start_time_ms_;
   bytes_marked_concurrently_ = 0;
+  adaptive_schedule_.Start(start_time_ms_, initial_old_generation_size_,
+                           old_generation_allocation_counter_);
   was_activated_ = true;
 
   StartMarking();
@@ -782,7 +784,11 @@ StepResult IncrementalMarking::AdvanceWithDeadline(
                  ThreadKind::kMain);
   DCHECK(!IsStopped());
 
-  ScheduleBytesToMarkBasedOnTime(heap()->MonotonicallyIncreasingTimeInMs());
+  if (FLAG_incremental_marking_adaptive_schedule) {
+    ScheduleBytesToMarkAdaptively(heap()->MonotonicallyIncreasingTimeInMs());
+  } else {
+    ScheduleBytesToMarkBasedOnTime(heap()->MonotonicallyIncreasingTimeInMs());
+  }
   FastForwardScheduleIfCloseToFinalization();
   return Step(kStepSizeInMs, completion_action, step_origin);
 }
@@ -833,6 +839,33 @@ void IncrementalMarking::ScheduleBytesToMarkBasedOnAllocation() {
   }
 }
 
+void IncrementalMarking::ScheduleBytesToMarkAdaptively(double time_ms) {
+  FetchBytesMarkedConcurrently();
+  size_t bytes_to_mark = adaptive_schedule_.BytesToMarkOnMainThread(
+      time_ms, bytes_marked_, bytes_marked_concurrently_,
+      heap_->OldGenerationAllocationCounter(),
+      heap_->OldGenerationSpaceAvailable());
+  // The schedule is relative to what has been marked so far, including
+  // concurrent marking, so it replaces rather than adds to the old target.
+  if (bytes_marked_ + bytes_to_mark < bytes_marked_) {
+    // The overflow case.
+    scheduled_bytes_to_mark_ = std::numeric_limits<std::size_t>::max();
+  } else {
+    scheduled_bytes_to_mark_ =
+        std::max(scheduled_bytes_to_mark_, bytes_marked_ + bytes_to_mark);
+  }
+
+  if (FLAG_trace_incremental_marking) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[IncrementalMarking] Scheduled %zuKB to mark adaptively "
+        "(finish in %.1fms, allocation=%.fKB/ms, concurrent=%.fKB/ms)\n",
+        bytes_to_mark / KB,
+        adaptive_schedule_.target_finish_time_ms() - time_ms,
+        adaptive_schedule_.allocation_rate_in_bytes_per_ms() / KB,
+        adaptive_schedule_.concurrent_marking_speed_in_bytes_per_ms() / KB);
+  }
+}
+
 void IncrementalMarking::FetchBytesMarkedConcurrently() {
   if (FLAG_concurrent_marking) {
     size_t current_bytes_marked_concurrently =
@@ -866,8 +899,13 @@ size_t IncrementalMarking::ComputeStepSizeInBytes(StepOrigin step_origin) {
     }
   }
   // Allow steps on allocation to get behind the schedule by small ammount.
-  // This gives higher priority to steps in tasks.
-  size_t kScheduleMarginInBytes = step_origin == StepOrigin::kV8 ? 1 * MB : 0;
+  // This gives higher priority to steps in tasks. The adaptive schedule already
+  // accounts for allocation bursts, so steps on allocation follow it exactly.
+  size_t kScheduleMarginInBytes =
+      step_origin == StepOrigin::kV8 &&
+              !FLAG_incremental_marking_adaptive_schedule
+          ? 1 * MB
+          : 0;
   if (bytes_marked_ + kScheduleMarginInBytes > scheduled_bytes_to_mark_)
     return 0;
   return scheduled_bytes_to_mark_ - bytes_marked_ - kScheduleMarginInBytes;
@@ -885,7 +923,11 @@ void IncrementalMarking::AdvanceOnAllocation() {
   TRACE_EVENT0("v8", "V8.GCIncrementalMarking");
   TRACE_GC_EPOCH(heap_->tracer(), GCTracer::Scope::MC_INCREMENTAL,
                  ThreadKind::kMain);
-  ScheduleBytesToMarkBasedOnAllocation();
+  if (FLAG_incremental_marking_adaptive_schedule) {
+    ScheduleBytesToMarkAdaptively(heap()->MonotonicallyIncreasingTimeInMs());
+  } else {
+    ScheduleBytesToMarkBasedOnAllocation();
+  }
   Step(kMaxStepSizeInMs, GC_VIA_STACK_GUARD, StepOrigin::kV8);
 }
 
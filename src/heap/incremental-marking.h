@@ -6,6 +6,7 @@
 #define V8_HEAP_INCREMENTAL_MARKING_H_
 
 #include "src/base/platform/mutex.h"
+#include "src/heap/adaptive-marking-schedule.h"
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-job.h"
 #include "src/heap/mark-compact.h"
@@ -252,6 +253,9 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   size_t StepSizeToKeepUpWithAllocations();
   size_t StepSizeToMakeProgress();
   void AddScheduledBytesToMark(size_t bytes_to_mark);
+  // Updates scheduled_bytes_to_mark_ based on adaptive_schedule_. Used instead
+  // of the two functions above with --incremental-marking-adaptive-schedule.
+  void ScheduleBytesToMarkAdaptively(double time_ms);
 
   // Schedules more bytes to mark so that the marker is no longer ahead
   // of schedule.
@@ -289,6 +293,7 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   // incremental marking step. It is used for updating
   // bytes_marked_ahead_of_schedule_ with contribution of concurrent marking.
   size_t bytes_marked_concurrently_ = 0;
+  AdaptiveMarkingSchedule adaptive_schedule_;
 
   // Must use SetState() above to update state_
   // Atomic since main thread can complete marking (= changing state), while a
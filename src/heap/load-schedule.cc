@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/load-schedule.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace v8 {
+namespace internal {
+
+void LoadSchedule::AddWindow(double start_ms, double end_ms) {
+  if (end_ms <= start_ms) return;
+  base::MutexGuard guard(&mutex_);
+  auto it = std::lower_bound(
+      windows_.begin(), windows_.end(), start_ms,
+      [](const Window& window, double start) { return window.end_ms < start; });
+  // All windows in [it, last) overlap or touch the new window.
+  auto last = it;
+  while (last != windows_.end() && last->start_ms <= end_ms) {
+    start_ms = std::min(start_ms, last->start_ms);
+    end_ms = std::max(end_ms, last->end_ms);
+    ++last;
+  }
+  it = windows_.erase(it, last);
+  windows_.insert(it, {start_ms, end_ms});
+  if (windows_.size() > kMaxWindows) windows_.resize(kMaxWindows);
+}
+
+void LoadSchedule::Clear() {
+  base::MutexGuard guard(&mutex_);
+  windows_.clear();
+}
+
+bool LoadSchedule::InLoadWindow(double now_ms) {
+  return TimeUntilNextLoadWindow(now_ms) == 0;
+}
+
+double LoadSchedule::TimeUntilNextLoadWindow(double now_ms) {
+  base::MutexGuard guard(&mutex_);
+  RemoveExpiredWindows(now_ms);
+  if (windows_.empty()) return std::numeric_limits<double>::infinity();
+  return std::max(0.0, windows_.front().start_ms - now_ms);
+}
+
+double LoadSchedule::OverlappingWindowEnd(double now_ms, double duration_ms) {
+  base::MutexGuard guard(&mutex_);
+  RemoveExpiredWindows(now_ms);
+  if (windows_.empty()) return 0;
+  const Window& next = windows_.front();
+  if (next.start_ms >= now_ms + duration_ms) return 0;
+  return next.end_ms;
+}
+
+bool LoadSchedule::IsEmpty() {
+  base::MutexGuard guard(&mutex_);
+  return windows_.empty();
+}
+
+void LoadSchedule::RemoveExpiredWindows(double now_ms) {
+  auto it = std::find_if(
+      windows_.begin(), windows_.end(),
+      [now_ms](const Window& window) { return window.end_ms > now_ms; });
+  windows_.erase(windows_.begin(), it);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_LOAD_SCHEDULE_H_
+#define V8_HEAP_LOAD_SCHEDULE_H_
+
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Keeps track of the windows of high mutator load that the embedder expects,
+// as reported via v8::Isolate::ExpectedLoadNotification(). The GC heuristics
+// use the schedule to move expensive work out of these windows and into the
+// gaps between them.
+//
+// All times are in milliseconds and are based on the same timebase as
+// Heap::MonotonicallyIncreasingTimeInMs(). Windows may be added from any
+// thread.
+class V8_EXPORT_PRIVATE LoadSchedule final {
+ public:
+  // Upper bound on the number of windows that are tracked at the same time.
+  // When the limit is exceeded, the windows furthest in the future are
+  // dropped.
+  static const size_t kMaxWindows = 16;
+
+  LoadSchedule() = default;
+  LoadSchedule(const LoadSchedule&) = delete;
+  LoadSchedule& operator=(const LoadSchedule&) = delete;
+
+  // Registers a window of expected load. Overlapping windows are merged.
+  void AddWindow(double start_ms, double end_ms);
+  void Clear();
+
+  bool InLoadWindow(double now_ms);
+
+  // Returns the time from |now_ms| until the next load window starts. Returns
+  // 0 if |now_ms| is inside a load window and infinity if no load is expected.
+  double TimeUntilNextLoadWindow(double now_ms);
+
+  // Returns the end of the first load window that overlaps with work of
+  // |duration_ms| started at |now_ms|, or 0 if the work fits into the current
+  // gap.
+  double OverlappingWindowEnd(double now_ms, double duration_ms);
+
+  bool IsEmpty();
+
+ private:
+  struct Window {
+    double start_ms;
+    double end_ms;
+  };
+
+  // Drops windows that ended before |now_ms|.
+  void RemoveExpiredWindows(double now_ms);
+
+  base::Mutex mutex_;
+  // Sorted by start time, non-overlapping.
+  std::vector<Window> windows_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_LOAD_SCHEDULE_H_
@@ -587,7 +587,8 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
 void MarkCompactCollector::StartMarking() {
   std::vector<Address> contexts =
       heap()->memory_measurement()->StartProcessing();
-  if (FLAG_stress_per_context_marking_worklist) {
+  if (FLAG_stress_per_context_marking_worklist ||
+      FLAG_continuous_memory_measurement) {
     contexts.clear();
     HandleScope handle_scope(heap()->isolate());
     for (auto context : heap()->FindAllNativeContexts()) {
@@ -595,6 +596,10 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   code_flush_mode_ = Heap::GetCodeFlushMode(isolate());
+#ifdef V8_SANDBOXED_EXTERNAL_POINTERS
+  // The evacuation area has to be known before the first entry is marked.
+  isolate()->external_pointer_table().StartCompactingIfNeeded();
+#endif  // V8_SANDBOXED_EXTERNAL_POINTERS
   marking_worklists()->CreateContextWorklists(contexts);
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap());
   local_marking_worklists_ = std::make_unique<MarkingWorklists::Local>(
@@ -624,6 +629,9 @@ void MarkCompactCollector::CollectGarbage() {
   ClearNonLiveReferences();
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
+  if (FLAG_continuous_memory_measurement) {
+    heap()->memory_measurement()->RecordContextSizes(native_context_stats_);
+  }
   RecordObjectStats();
 
   Sweep();
@@ -823,6 +831,15 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    if (space->identity() == CODE_SPACE &&
+        FLAG_max_code_space_compaction_kb > 0) {
+      // Evacuating code is paid for entirely in the atomic pause, including
+      // updating every relocation entry that targets a moved code object.
+      // Bounding the bytes per cycle spreads code space defragmentation over
+      // several full GCs; later cycles pick up the remaining fragmented pages.
+      max_evacuated_bytes =
+          std::min(max_evacuated_bytes, FLAG_max_code_space_compaction_kb * KB);
+    }
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
@@ -981,6 +998,9 @@ void MarkCompactCollector::Prepare() {
 
   DCHECK(!sweeping_in_progress());
 
+  // Young generation markbits are not used by the full collector.
+  heap()->minor_mark_compact_collector()->AbortConcurrentMarking();
+
   if (!heap()->incremental_marking()->IsMarking()) {
     const auto embedder_flags = heap_->flags_for_embedder_tracer();
     {
@@ -1732,6 +1752,13 @@ class EvacuateVisitorBase : public HeapObjectVisitor {
       if (mode != MigrationMode::kFast)
         base->ExecuteMigrationObservers(dest, src, dst, size);
     }
+#ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+    if (dest != NEW_SPACE) {
+      // Migrated objects bypass the allocator that maintains object starts.
+      MemoryChunk::FromHeapObject(dst)->object_start_bitmap()->SetBit(
+          dst_addr);
+    }
+#endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
     src.set_map_word(MapWord::FromForwardingAddress(dst), kRelaxedStore);
   }
 
@@ -2193,7 +2220,7 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
   TRACE_GC(heap()->tracer(),
            GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_LINEAR);
   CHECK(heap()->concurrent_marking()->IsStopped());
-  std::unordered_multimap<HeapObject, HeapObject, Object::Hasher> key_to_values;
+  DCHECK(ephemeron_index_.IsEmpty());
   Ephemeron ephemeron;
 
   DCHECK(
@@ -2203,60 +2230,33 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
     ProcessEphemeron(ephemeron.key, ephemeron.value);
 
     if (non_atomic_marking_state()->IsWhite(ephemeron.value)) {
-      key_to_values.insert(std::make_pair(ephemeron.key, ephemeron.value));
+      ephemeron_index_.Add(ephemeron);
     }
   }
 
-  ephemeron_marking_.newly_discovered_limit = key_to_values.size();
   bool work_to_do = true;
 
   while (work_to_do) {
     PerformWrapperTracing();
 
-    ResetNewlyDiscovered();
-    ephemeron_marking_.newly_discovered_limit = key_to_values.size();
-
     {
       TRACE_GC(heap()->tracer(),
                GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_MARKING);
-      // Drain marking worklist and push all discovered objects into
-      // newly_discovered.
+      // Drain marking worklist, marking the values of all visited keys through
+      // the index. The index stays unchanged until the tasks are joined.
+      if (FLAG_parallel_marking) {
+        heap()->concurrent_marking()->set_ephemeron_index(&ephemeron_index_);
+        heap()->concurrent_marking()->RescheduleJobIfNeeded(
+            TaskPriority::kUserBlocking);
+      }
       ProcessMarkingWorklist<
           MarkCompactCollector::MarkingWorklistProcessingMode::
-              kTrackNewlyDiscoveredObjects>(0);
-    }
-
-    while (local_weak_objects()->discovered_ephemerons_local.Pop(&ephemeron)) {
-      ProcessEphemeron(ephemeron.key, ephemeron.value);
-
-      if (non_atomic_marking_state()->IsWhite(ephemeron.value)) {
-        key_to_values.insert(std::make_pair(ephemeron.key, ephemeron.value));
-      }
+              kLookupEphemeronIndex>(0);
+      FinishConcurrentMarking();
+      heap()->concurrent_marking()->set_ephemeron_index(nullptr);
     }
 
-    if (ephemeron_marking_.newly_discovered_overflowed) {
-      // If newly_discovered was overflowed just visit all ephemerons in
-      // next_ephemerons.
-      local_weak_objects()->next_ephemerons_local.Publish();
-      weak_objects_.next_ephemerons.Iterate([&](Ephemeron ephemeron) {
-        if (non_atomic_marking_state()->IsBlackOrGrey(ephemeron.key) &&
-            non_atomic_marking_state()->WhiteToGrey(ephemeron.value)) {
-          local_marking_worklists()->Push(ephemeron.value);
-        }
-      });
-
-    } else {
-      // This is the good case: newly_discovered stores all discovered
-      // objects. Now use key_to_values to see if discovered objects keep more
-      // objects alive due to ephemeron semantics.
-      for (HeapObject object : ephemeron_marking_.newly_discovered) {
-        auto range = key_to_values.equal_range(object);
-        for (auto it = range.first; it != range.second; ++it) {
-          HeapObject value = it->second;
-          MarkObject(object, value);
-        }
-      }
-    }
+    IndexDiscoveredEphemerons();
 
     // Do NOT drain marking worklist here, otherwise the current checks
     // for work_to_do are not sufficient for determining if another iteration
@@ -2269,8 +2269,7 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
               ->discovered_ephemerons_local.IsLocalAndGlobalEmpty());
   }
 
-  ResetNewlyDiscovered();
-  ephemeron_marking_.newly_discovered.shrink_to_fit();
+  ephemeron_index_.Clear();
 
   CHECK(local_marking_worklists()->IsEmpty());
   CHECK(weak_objects_.current_ephemerons.IsEmpty());
@@ -2281,6 +2280,20 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
   local_weak_objects()->next_ephemerons_local.Publish();
 }
 
+void MarkCompactCollector::IndexDiscoveredEphemerons() {
+  // The keys of these ephemerons may have been visited before the ephemerons
+  // were discovered, so their values are marked here if necessary. Keys which
+  // are still white get visited, and looked up, in a later round.
+  Ephemeron ephemeron;
+  while (local_weak_objects()->discovered_ephemerons_local.Pop(&ephemeron)) {
+    ProcessEphemeron(ephemeron.key, ephemeron.value);
+
+    if (non_atomic_marking_state()->IsWhite(ephemeron.value)) {
+      ephemeron_index_.Add(ephemeron);
+    }
+  }
+}
+
 void MarkCompactCollector::PerformWrapperTracing() {
   if (heap_->local_embedder_heap_tracer()->InUse()) {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK_EMBEDDER_TRACING);
@@ -2333,10 +2346,6 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
     DCHECK(object.IsHeapObject());
     DCHECK(heap()->Contains(object));
     DCHECK(!(marking_state()->IsWhite(object)));
-    if (mode == MarkCompactCollector::MarkingWorklistProcessingMode::
-                    kTrackNewlyDiscoveredObjects) {
-      AddNewlyDiscovered(object);
-    }
     Map map = object.map(cage_base);
     if (is_per_context_mode) {
       Address context;
@@ -2349,6 +2358,11 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       native_context_stats_.IncrementSize(local_marking_worklists()->Context(),
                                           map, object, visited_size);
     }
+    if (mode == MarkCompactCollector::MarkingWorklistProcessingMode::
+                    kLookupEphemeronIndex) {
+      ephemeron_index_.ForEachValue(
+          object, [&](HeapObject value) { MarkObject(object, value); });
+    }
     bytes_processed += visited_size;
     objects_processed++;
     if (bytes_to_process && bytes_processed >= bytes_to_process) {
@@ -2364,7 +2378,7 @@ template std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist<
     size_t bytes_to_process);
 template std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist<
     MarkCompactCollector::MarkingWorklistProcessingMode::
-        kTrackNewlyDiscoveredObjects>(size_t bytes_to_process);
+        kLookupEphemeronIndex>(size_t bytes_to_process);
 
 bool MarkCompactCollector::ProcessEphemeron(HeapObject key, HeapObject value) {
   if (marking_state()->IsBlackOrGrey(key)) {
@@ -2432,7 +2446,11 @@ void MarkCompactCollector::RecordObjectStats() {
   heap()->CreateObjectStats();
   ObjectStatsCollector collector(heap(), heap()->live_object_stats_.get(),
                                  heap()->dead_object_stats_.get());
-  collector.Collect();
+  if (FLAG_gc_object_stats_sampling_rate > 0 && !FLAG_track_gc_object_stats) {
+    collector.CollectSampled(FLAG_gc_object_stats_sampling_rate);
+  } else {
+    collector.Collect();
+  }
   if (V8_UNLIKELY(TracingFlags::gc_stats.load(std::memory_order_relaxed) &
                   v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     std::stringstream live, dead;
@@ -2658,6 +2676,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // the JSFunction after flushing.
     ProcessOldCodeCandidates();
     ProcessFlushedBaselineCandidates();
+    heap()->bytecode_flushing_policy()->UpdateFlushAge();
   }
 
   {
@@ -2822,6 +2841,8 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // performing the unusual task of decompiling.
   shared_info.set_function_data(uncompiled_data, kReleaseStore);
   DCHECK(!shared_info.is_compiled());
+  shared_info.set_bytecode_was_flushed(true);
+  isolate()->counters()->bytecode_flushed_functions()->Increment();
 }
 
 void MarkCompactCollector::ProcessOldCodeCandidates() {
@@ -2855,6 +2876,7 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
         // the function_data field to the BytecodeArray/InterpreterData.
         flushing_candidate.set_function_data(
             baseline_code.bytecode_or_interpreter_data(), kReleaseStore);
+        flushing_candidate.set_baseline_code_was_flushed(true);
       }
     }
 
@@ -2877,7 +2899,10 @@ void MarkCompactCollector::ProcessOldCodeCandidates() {
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
-  DCHECK(FLAG_flush_bytecode || weak_objects_.flushed_js_functions.IsEmpty());
+  DCHECK(FLAG_flush_bytecode || FLAG_flush_feedback_vectors ||
+         weak_objects_.flushed_js_functions.IsEmpty());
+  const int old_feedback_vector_age =
+      heap()->bytecode_flushing_policy()->feedback_vector_flush_age();
   JSFunction flushed_js_function;
   while (local_weak_objects()->flushed_js_functions_local.Pop(
       &flushed_js_function)) {
@@ -2886,6 +2911,9 @@ void MarkCompactCollector::ClearFlushedJsFunctions() {
       RecordSlot(object, slot, HeapObject::cast(target));
     };
     flushed_js_function.ResetIfCodeFlushed(gc_notify_updated_slot);
+    // The function may have run or tiered up since it was marked.
+    flushed_js_function.FlushFeedbackVectorIfOld(
+        code_flush_mode(), old_feedback_vector_age, gc_notify_updated_slot);
   }
 }
 
@@ -4078,6 +4106,8 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   if (!heap()->IsGCWithoutStack()) {
     if (!FLAG_compact_with_stack || !FLAG_compact_code_space_with_stack) {
       for (Page* page : old_space_evacuation_pages_) {
+        // Pages pinned by conservative stack scanning are already aborted.
+        if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) continue;
         if (!FLAG_compact_with_stack || page->owner_identity() == CODE_SPACE) {
           ReportAbortedEvacuationCandidateDueToFlags(page->area_start(), page);
           // Set this flag early on in this case to allow filtering such pages
@@ -4443,6 +4473,16 @@ class ToSpaceUpdatingItem : public UpdatingItem {
   MarkingState* marking_state_;
 };
 
+// State shared by the items updating the untyped slots of one chunk in
+// separate bucket ranges. The last item to finish releases the slot sets of
+// the chunk and updates its typed slots.
+struct RememberedSetRanges {
+  explicit RememberedSetRanges(size_t ranges) : remaining_ranges(ranges) {}
+
+  std::atomic<size_t> remaining_ranges;
+  std::atomic<size_t> old_to_new_slots{0};
+};
+
 template <typename MarkingState, GarbageCollector collector>
 class RememberedSetUpdatingItem : public UpdatingItem {
  public:
@@ -4452,15 +4492,47 @@ class RememberedSetUpdatingItem : public UpdatingItem {
       : heap_(heap),
         marking_state_(marking_state),
         chunk_(chunk),
-        updating_mode_(updating_mode) {}
+        updating_mode_(updating_mode),
+        start_bucket_(0),
+        end_bucket_(chunk->buckets()) {}
+  // Only updates the untyped slots in the buckets [start_bucket, end_bucket).
+  RememberedSetUpdatingItem(Heap* heap, MarkingState* marking_state,
+                            MemoryChunk* chunk,
+                            RememberedSetUpdatingMode updating_mode,
+                            size_t start_bucket, size_t end_bucket,
+                            std::shared_ptr<RememberedSetRanges> ranges)
+      : heap_(heap),
+        marking_state_(marking_state),
+        chunk_(chunk),
+        updating_mode_(updating_mode),
+        start_bucket_(start_bucket),
+        end_bucket_(end_bucket),
+        ranges_(std::move(ranges)) {
+    DCHECK(!chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE));
+  }
   ~RememberedSetUpdatingItem() override = default;
 
   void Process() override {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                  "RememberedSetUpdatingItem::Process");
+    if (ranges_) {
+      // Ranges of the same chunk are processed in parallel. They access
+      // disjoint buckets, so only releasing the slot sets needs the lock.
+      ranges_->old_to_new_slots.fetch_add(UpdateUntypedPointers(),
+                                          std::memory_order_relaxed);
+      if (ranges_->remaining_ranges.fetch_sub(1, std::memory_order_acq_rel) >
+          1) {
+        return;
+      }
+      base::MutexGuard guard(chunk_->mutex());
+      ReleaseUntypedSlots(
+          ranges_->old_to_new_slots.load(std::memory_order_relaxed));
+      UpdateTypedPointers();
+      return;
+    }
     base::MutexGuard guard(chunk_->mutex());
     CodePageMemoryModificationScope memory_modification_scope(chunk_);
-    UpdateUntypedPointers();
+    ReleaseUntypedSlots(UpdateUntypedPointers());
     UpdateTypedPointers();
   }
 
@@ -4516,36 +4588,35 @@ class RememberedSetUpdatingItem : public UpdatingItem {
     return REMOVE_SLOT;
   }
 
-  void UpdateUntypedPointers() {
-    if (chunk_->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() != nullptr) {
+  // Updates the untyped slots in the buckets of this item. Returns the number
+  // of remaining old-to-new slots.
+  size_t UpdateUntypedPointers() {
+    size_t old_to_new_slots = 0;
+    if (SlotSet* slot_set =
+            chunk_->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>()) {
       InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(chunk_);
-      int slots = RememberedSet<OLD_TO_NEW>::Iterate(
-          chunk_,
+      old_to_new_slots = slot_set->Iterate(
+          chunk_->address(), start_bucket_, end_bucket_,
           [this, &filter](MaybeObjectSlot slot) {
             if (!filter.IsValid(slot.address())) return REMOVE_SLOT;
             return CheckAndUpdateOldToNewSlot(slot);
           },
           SlotSet::FREE_EMPTY_BUCKETS);
 
-      DCHECK_IMPLIES(collector == GarbageCollector::MARK_COMPACTOR, slots == 0);
-
-      if (slots == 0) {
-        chunk_->ReleaseSlotSet<OLD_TO_NEW>();
-      }
+      DCHECK_IMPLIES(collector == GarbageCollector::MARK_COMPACTOR,
+                     old_to_new_slots == 0);
     }
 
-    if (chunk_->invalidated_slots<OLD_TO_NEW>() != nullptr) {
-      // The invalidated slots are not needed after old-to-new slots were
-      // processed.
-      chunk_->ReleaseInvalidatedSlots<OLD_TO_NEW>();
+    if (updating_mode_ != RememberedSetUpdatingMode::ALL) {
+      return old_to_new_slots;
     }
 
-    if ((updating_mode_ == RememberedSetUpdatingMode::ALL) &&
-        (chunk_->slot_set<OLD_TO_OLD, AccessMode::NON_ATOMIC>() != nullptr)) {
+    if (SlotSet* slot_set =
+            chunk_->slot_set<OLD_TO_OLD, AccessMode::NON_ATOMIC>()) {
       InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToOld(chunk_);
       PtrComprCageBase cage_base = heap_->isolate();
-      RememberedSet<OLD_TO_OLD>::Iterate(
-          chunk_,
+      slot_set->Iterate(
+          chunk_->address(), start_bucket_, end_bucket_,
           [&filter, cage_base](MaybeObjectSlot slot) {
             if (filter.IsValid(slot.address())) {
               UpdateSlot<AccessMode::NON_ATOMIC>(cage_base, slot);
@@ -4555,26 +4626,18 @@ class RememberedSetUpdatingItem : public UpdatingItem {
             return KEEP_SLOT;
           },
           SlotSet::KEEP_EMPTY_BUCKETS);
-      chunk_->ReleaseSlotSet<OLD_TO_OLD>();
-    }
-    if ((updating_mode_ == RememberedSetUpdatingMode::ALL) &&
-        chunk_->invalidated_slots<OLD_TO_OLD>() != nullptr) {
-      // The invalidated slots are not needed after old-to-old slots were
-      // processsed.
-      chunk_->ReleaseInvalidatedSlots<OLD_TO_OLD>();
     }
     if (V8_EXTERNAL_CODE_SPACE_BOOL) {
-      if ((updating_mode_ == RememberedSetUpdatingMode::ALL) &&
-          (chunk_->slot_set<OLD_TO_CODE, AccessMode::NON_ATOMIC>() !=
-           nullptr)) {
+      if (SlotSet* slot_set =
+              chunk_->slot_set<OLD_TO_CODE, AccessMode::NON_ATOMIC>()) {
         PtrComprCageBase cage_base = heap_->isolate();
 #ifdef V8_EXTERNAL_CODE_SPACE
         PtrComprCageBase code_cage_base(heap_->isolate()->code_cage_base());
 #else
         PtrComprCageBase code_cage_base = cage_base;
 #endif
-        RememberedSet<OLD_TO_CODE>::Iterate(
-            chunk_,
+        slot_set->Iterate(
+            chunk_->address(), start_bucket_, end_bucket_,
             [=](MaybeObjectSlot slot) {
               HeapObject host = HeapObject::FromAddress(
                   slot.address() - CodeDataContainer::kCodeOffset);
@@ -4584,27 +4647,56 @@ class RememberedSetUpdatingItem : public UpdatingItem {
                   CodeObjectSlot(slot.address()));
             },
             SlotSet::FREE_EMPTY_BUCKETS);
-        chunk_->ReleaseSlotSet<OLD_TO_CODE>();
-      }
-      // The invalidated slots are not needed after old-to-code slots were
-      // processsed, but since there are no invalidated OLD_TO_CODE slots,
-      // there's nothing to clear.
-    }
-    if (updating_mode_ == RememberedSetUpdatingMode::ALL) {
-      if (chunk_->slot_set<OLD_TO_SHARED, AccessMode::NON_ATOMIC>()) {
-        // Client GCs need to remove invalidated OLD_TO_SHARED slots.
-        DCHECK(!heap_->IsShared());
-        InvalidatedSlotsFilter filter =
-            InvalidatedSlotsFilter::OldToShared(chunk_);
-        RememberedSet<OLD_TO_SHARED>::Iterate(
-            chunk_,
-            [&filter](MaybeObjectSlot slot) {
-              return filter.IsValid(slot.address()) ? KEEP_SLOT : REMOVE_SLOT;
-            },
-            SlotSet::FREE_EMPTY_BUCKETS);
       }
-      chunk_->ReleaseInvalidatedSlots<OLD_TO_SHARED>();
     }
+    if (SlotSet* slot_set =
+            chunk_->slot_set<OLD_TO_SHARED, AccessMode::NON_ATOMIC>()) {
+      // Client GCs need to remove invalidated OLD_TO_SHARED slots.
+      DCHECK(!heap_->IsShared());
+      InvalidatedSlotsFilter filter =
+          InvalidatedSlotsFilter::OldToShared(chunk_);
+      slot_set->Iterate(
+          chunk_->address(), start_bucket_, end_bucket_,
+          [&filter](MaybeObjectSlot slot) {
+            return filter.IsValid(slot.address()) ? KEEP_SLOT : REMOVE_SLOT;
+          },
+          SlotSet::FREE_EMPTY_BUCKETS);
+    }
+    return old_to_new_slots;
+  }
+
+  // Releases the slot sets and invalidated slots which are not needed anymore
+  // after all untyped slots of the chunk were updated.
+  void ReleaseUntypedSlots(size_t old_to_new_slots) {
+    if (chunk_->slot_set<OLD_TO_NEW, AccessMode::NON_ATOMIC>() != nullptr &&
+        old_to_new_slots == 0) {
+      chunk_->ReleaseSlotSet<OLD_TO_NEW>();
+    }
+
+    if (chunk_->invalidated_slots<OLD_TO_NEW>() != nullptr) {
+      // The invalidated slots are not needed after old-to-new slots were
+      // processed.
+      chunk_->ReleaseInvalidatedSlots<OLD_TO_NEW>();
+    }
+
+    if (updating_mode_ != RememberedSetUpdatingMode::ALL) return;
+
+    if (chunk_->slot_set<OLD_TO_OLD, AccessMode::NON_ATOMIC>() != nullptr) {
+      chunk_->ReleaseSlotSet<OLD_TO_OLD>();
+    }
+    if (chunk_->invalidated_slots<OLD_TO_OLD>() != nullptr) {
+      // The invalidated slots are not needed after old-to-old slots were
+      // processsed.
+      chunk_->ReleaseInvalidatedSlots<OLD_TO_OLD>();
+    }
+    if (V8_EXTERNAL_CODE_SPACE_BOOL &&
+        chunk_->slot_set<OLD_TO_CODE, AccessMode::NON_ATOMIC>() != nullptr) {
+      chunk_->ReleaseSlotSet<OLD_TO_CODE>();
+    }
+    // The invalidated slots are not needed after old-to-code slots were
+    // processsed, but since there are no invalidated OLD_TO_CODE slots,
+    // there's nothing to clear.
+    chunk_->ReleaseInvalidatedSlots<OLD_TO_SHARED>();
   }
 
   void UpdateTypedPointers() {
@@ -4645,14 +4737,34 @@ class RememberedSetUpdatingItem : public UpdatingItem {
   MarkingState* marking_state_;
   MemoryChunk* chunk_;
   RememberedSetUpdatingMode updating_mode_;
+  const size_t start_bucket_;
+  const size_t end_bucket_;
+  std::shared_ptr<RememberedSetRanges> ranges_;
 };
 
-std::unique_ptr<UpdatingItem>
-MarkCompactCollector::CreateRememberedSetUpdatingItem(
-    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) {
-  return std::make_unique<RememberedSetUpdatingItem<
-      NonAtomicMarkingState, GarbageCollector::MARK_COMPACTOR>>(
-      heap(), non_atomic_marking_state(), chunk, updating_mode);
+void MarkCompactCollector::CreateRememberedSetUpdatingItems(
+    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
+  using Item = RememberedSetUpdatingItem<NonAtomicMarkingState,
+                                         GarbageCollector::MARK_COMPACTOR>;
+  // Split large chunks into ranges of the size of a regular page, so that
+  // their slots are updated in parallel. Code pages are not split, as their
+  // memory protection is changed per item.
+  const size_t buckets = chunk->buckets();
+  const size_t kBucketsPerRange = SlotSet::kBucketsRegularPage;
+  if (!FLAG_parallel_pointer_update || buckets <= kBucketsPerRange ||
+      chunk->IsFlagSet(MemoryChunk::IS_EXECUTABLE)) {
+    items->emplace_back(std::make_unique<Item>(
+        heap(), non_atomic_marking_state(), chunk, updating_mode));
+    return;
+  }
+  auto ranges = std::make_shared<RememberedSetRanges>(
+      (buckets + kBucketsPerRange - 1) / kBucketsPerRange);
+  for (size_t start = 0; start < buckets; start += kBucketsPerRange) {
+    items->emplace_back(std::make_unique<Item>(
+        heap(), non_atomic_marking_state(), chunk, updating_mode, start,
+        std::min(buckets, start + kBucketsPerRange), ranges));
+  }
 }
 
 namespace {
@@ -4689,8 +4801,7 @@ int CollectRememberedSetUpdatingItems(
     if (mode == RememberedSetUpdatingMode::ALL || contains_old_to_new_slots ||
         contains_old_to_old_invalidated_slots ||
         contains_old_to_new_invalidated_slots) {
-      items->emplace_back(
-          collector->CreateRememberedSetUpdatingItem(chunk, mode));
+      collector->CreateRememberedSetUpdatingItems(chunk, mode, items);
       pages++;
     }
   }
@@ -4887,6 +4998,18 @@ void MarkCompactCollector::ReportAbortedEvacuationCandidateDueToFlags(
       std::make_pair(failed_start, page));
 }
 
+void MarkCompactCollector::PinEvacuationCandidate(Page* page) {
+  DCHECK(page->IsEvacuationCandidate());
+  if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) return;
+#ifdef DEBUG
+  DCHECK_EQ(MARK_LIVE_OBJECTS, state_);
+#endif  // DEBUG
+  // The whole page is kept in place. Its slots are re-recorded when post
+  // processing evacuation candidates, as for pages aborted due to flags.
+  ReportAbortedEvacuationCandidateDueToFlags(page->area_start(), page);
+  page->SetFlag(Page::COMPACTION_WAS_ABORTED);
+}
+
 namespace {
 
 void ReRecordPage(
@@ -5310,9 +5433,66 @@ class YoungGenerationMarkingVisitor final
   MinorMarkCompactCollector::MarkingState* marking_state_;
 };
 
-void MinorMarkCompactCollector::SetUp() {}
+// Observes new space allocation to start concurrent marking once the trigger
+// is reached and to resume the concurrent job after it had to be stopped.
+class MinorMarkCompactCollector::ConcurrentMarkingObserver final
+    : public AllocationObserver {
+ public:
+  ConcurrentMarkingObserver(MinorMarkCompactCollector* collector,
+                            intptr_t step_size)
+      : AllocationObserver(step_size), collector_(collector) {}
+
+  void Step(int bytes_allocated, Address, size_t) override {
+    if (collector_->IsConcurrentMarkingActive()) {
+      collector_->ScheduleConcurrentMarkingJob();
+    } else if (ConcurrentMarkingTriggerReached(collector_->heap())) {
+      collector_->ScheduleConcurrentMarkingStartTask();
+    }
+  }
+
+ private:
+  MinorMarkCompactCollector* const collector_;
+};
+
+class MinorMarkCompactCollector::ConcurrentMarkingStartTask final
+    : public CancelableTask {
+ public:
+  ConcurrentMarkingStartTask(Isolate* isolate,
+                             MinorMarkCompactCollector* collector)
+      : CancelableTask(isolate), isolate_(isolate), collector_(collector) {}
+
+ private:
+  void RunInternal() override {
+    VMState<GC> state(isolate_);
+    TRACE_EVENT_CALL_STATS_SCOPED(isolate_, "v8", "V8.Task");
+    collector_->concurrent_marking_start_task_pending_ = false;
+    if (ConcurrentMarkingTriggerReached(collector_->heap())) {
+      collector_->StartConcurrentMarking();
+    }
+  }
+
+  Isolate* const isolate_;
+  MinorMarkCompactCollector* const collector_;
+};
+
+void MinorMarkCompactCollector::SetUp() {
+  if (!FLAG_concurrent_minor_mc_marking || !heap()->new_space()) return;
+  // Check for the trigger a few times per page worth of allocation.
+  static constexpr intptr_t kObserverStepSize = Page::kPageSize / 4;
+  concurrent_marking_observer_ =
+      std::make_unique<ConcurrentMarkingObserver>(this, kObserverStepSize);
+  heap()->new_space()->AddAllocationObserver(
+      concurrent_marking_observer_.get());
+}
 
-void MinorMarkCompactCollector::TearDown() {}
+void MinorMarkCompactCollector::TearDown() {
+  if (concurrent_marking_observer_) {
+    AbortConcurrentMarking();
+    heap()->new_space()->RemoveAllocationObserver(
+        concurrent_marking_observer_.get());
+    concurrent_marking_observer_.reset();
+  }
+}
 
 // static
 constexpr size_t MinorMarkCompactCollector::kMaxParallelTasks;
@@ -5321,6 +5501,7 @@ MinorMarkCompactCollector::MinorMarkCompactCollector(Heap* heap)
     : heap_(heap),
       worklist_(new MinorMarkCompactCollector::MarkingWorklist()),
       main_thread_worklist_local_(worklist_),
+      background_barrier_worklist_local_(worklist_),
       marking_state_(heap->isolate()),
       non_atomic_marking_state_(heap->isolate()),
       main_marking_visitor_(new YoungGenerationMarkingVisitor(
@@ -5743,12 +5924,13 @@ MinorMarkCompactCollector::CreateToSpaceUpdatingItem(MemoryChunk* chunk,
       heap(), chunk, start, end, non_atomic_marking_state());
 }
 
-std::unique_ptr<UpdatingItem>
-MinorMarkCompactCollector::CreateRememberedSetUpdatingItem(
-    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode) {
-  return std::make_unique<RememberedSetUpdatingItem<
-      NonAtomicMarkingState, GarbageCollector::MINOR_MARK_COMPACTOR>>(
-      heap(), non_atomic_marking_state(), chunk, updating_mode);
+void MinorMarkCompactCollector::CreateRememberedSetUpdatingItems(
+    MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+    std::vector<std::unique_ptr<UpdatingItem>>* items) {
+  items->emplace_back(std::make_unique<RememberedSetUpdatingItem<
+                          NonAtomicMarkingState,
+                          GarbageCollector::MINOR_MARK_COMPACTOR>>(
+      heap(), non_atomic_marking_state(), chunk, updating_mode));
 }
 
 class PageMarkingItem;
@@ -5784,6 +5966,23 @@ class YoungGenerationMarkingTask {
     }
   }
 
+  // Like EmptyMarkingWorklist() but yields to the platform when requested.
+  // Left over work is published so that it can be picked up again later.
+  void EmptyMarkingWorklistUntilYield(JobDelegate* delegate) {
+    static constexpr int kObjectsUntilYieldCheck = 64;
+    int objects_processed = 0;
+    HeapObject object;
+    while (marking_worklist_local_.Pop(&object)) {
+      const int size = visitor_.Visit(object);
+      IncrementLiveBytes(object, size);
+      if (++objects_processed >= kObjectsUntilYieldCheck) {
+        if (delegate->ShouldYield()) break;
+        objects_processed = 0;
+      }
+    }
+    marking_worklist_local_.Publish();
+  }
+
   void IncrementLiveBytes(HeapObject object, intptr_t bytes) {
     local_live_bytes_[Page::FromHeapObject(object)] += bytes;
   }
@@ -5989,11 +6188,220 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
   }
 }
 
+// Computes the transitive closure of the young generation concurrently to the
+// mutator. The job is stopped whenever an object changes its layout; see
+// MinorMarkCompactCollector::NotifyObjectLayoutChange().
+class YoungGenerationConcurrentMarkingJob : public v8::JobTask {
+ public:
+  YoungGenerationConcurrentMarkingJob(
+      Isolate* isolate, MinorMarkCompactCollector* collector,
+      MinorMarkCompactCollector::MarkingWorklist* global_worklist)
+      : isolate_(isolate),
+        collector_(collector),
+        global_worklist_(global_worklist) {}
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "MinorMC.ConcurrentMarking");
+    double marking_time = 0.0;
+    {
+      TimedScope scope(&marking_time);
+      YoungGenerationMarkingTask task(isolate_, collector_, global_worklist_);
+      task.EmptyMarkingWorklistUntilYield(delegate);
+      task.FlushLiveBytes();
+    }
+    if (FLAG_trace_minor_mc_parallel_marking) {
+      PrintIsolate(isolate_, "concurrent marking[%p]: time=%f\n",
+                   static_cast<void*>(this), marking_time);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t num_tasks = worker_count + global_worklist_->Size();
+    if (!FLAG_parallel_marking) {
+      num_tasks = std::min<size_t>(1, num_tasks);
+    }
+    return std::min<size_t>(num_tasks,
+                            MinorMarkCompactCollector::kMaxParallelTasks);
+  }
+
+ private:
+  Isolate* const isolate_;
+  MinorMarkCompactCollector* const collector_;
+  MinorMarkCompactCollector::MarkingWorklist* const global_worklist_;
+};
+
+// static
+bool MinorMarkCompactCollector::ConcurrentMarkingTriggerReached(Heap* heap) {
+  NewSpace* new_space = heap->new_space();
+  return new_space->Size() >= new_space->Capacity() *
+                                  FLAG_minor_mc_concurrent_marking_trigger /
+                                  100;
+}
+
+void MinorMarkCompactCollector::ScheduleConcurrentMarkingStartTask() {
+  if (concurrent_marking_start_task_pending_ || heap()->IsTearingDown()) {
+    return;
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate());
+  auto taskrunner =
+      V8::GetCurrentPlatform()->GetForegroundTaskRunner(v8_isolate);
+  if (taskrunner->NonNestableTasksEnabled()) {
+    taskrunner->PostNonNestableTask(
+        std::make_unique<ConcurrentMarkingStartTask>(isolate(), this));
+    concurrent_marking_start_task_pending_ = true;
+  }
+}
+
+void MinorMarkCompactCollector::StartConcurrentMarking() {
+  DCHECK(FLAG_concurrent_minor_mc_marking);
+  // Full marking also marks the young generation and takes over the marking
+  // barrier. Both can't be active at the same time.
+  if (concurrent_marking_active_ ||
+      !heap()->incremental_marking()->IsStopped() ||
+      heap()->gc_state() != Heap::NOT_IN_GC ||
+      !heap()->deserialization_complete() || heap()->IsTearingDown()) {
+    return;
+  }
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"), "MinorMC.StartMarking");
+  // Extensions are marked by the visitor and must not be swept concurrently.
+  heap()->array_buffer_sweeper()->EnsureFinished();
+  DCHECK(worklist()->IsEmpty());
+
+  SafepointScope safepoint(heap());
+  concurrent_marking_active_ = true;
+  SetMarkingBarrierPageFlags(true);
+  heap()->SetIsMarkingFlag(true);
+  SeedConcurrentMarking();
+  ScheduleConcurrentMarkingJob();
+  if (FLAG_trace_minor_mc_parallel_marking) {
+    PrintIsolate(isolate(), "concurrent marking started: new space %zuKB\n",
+                 heap()->new_space()->Size() / KB);
+  }
+}
+
+void MinorMarkCompactCollector::SeedConcurrentMarking() {
+  RootMarkingVisitor root_visitor(this);
+  // Global handles are processed in the atomic pause as their weakness can
+  // only be computed there.
+  heap()->IterateRoots(
+      &root_visitor, base::EnumSet<SkipRoot>{SkipRoot::kExternalStringTable,
+                                              SkipRoot::kGlobalHandles,
+                                              SkipRoot::kOldGeneration});
+  // Only the targets of the OLD_TO_NEW slots are marked here. The slot sets
+  // themselves are filtered when they are revisited in the atomic pause.
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      heap(), [this](MemoryChunk* chunk) {
+        base::MutexGuard guard(chunk->mutex());
+        InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToNew(chunk);
+        RememberedSet<OLD_TO_NEW>::Iterate(
+            chunk,
+            [this, &filter](MaybeObjectSlot slot) {
+              if (!filter.IsValid(slot.address())) return KEEP_SLOT;
+              HeapObject heap_object;
+              if ((*slot).GetHeapObject(&heap_object)) {
+                MarkRootObject(heap_object);
+              }
+              return KEEP_SLOT;
+            },
+            SlotSet::KEEP_EMPTY_BUCKETS);
+      });
+  main_thread_worklist_local_.Publish();
+}
+
+void MinorMarkCompactCollector::ScheduleConcurrentMarkingJob() {
+  DCHECK(concurrent_marking_active_);
+  main_thread_worklist_local_.Publish();
+  if (concurrent_marking_job_handle_ &&
+      concurrent_marking_job_handle_->IsValid()) {
+    concurrent_marking_job_handle_->NotifyConcurrencyIncrease();
+    return;
+  }
+  concurrent_marking_job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      v8::TaskPriority::kUserVisible,
+      std::make_unique<YoungGenerationConcurrentMarkingJob>(isolate(), this,
+                                                            worklist()));
+}
+
+void MinorMarkCompactCollector::StopConcurrentMarkingJob() {
+  if (concurrent_marking_job_handle_ &&
+      concurrent_marking_job_handle_->IsValid()) {
+    concurrent_marking_job_handle_->Cancel();
+  }
+  concurrent_marking_job_handle_.reset();
+}
+
+void MinorMarkCompactCollector::SetMarkingBarrierPageFlags(bool is_marking) {
+  for (Page* p : *heap()->new_space()) {
+    p->SetYoungGenerationPageFlags(is_marking);
+  }
+  for (LargePage* p : *heap()->new_lo_space()) {
+    p->SetYoungGenerationPageFlags(is_marking);
+  }
+}
+
+void MinorMarkCompactCollector::MarkValueFromBarrier(HeapObject value) {
+  DCHECK(concurrent_marking_active_);
+  if (!Heap::InYoungGeneration(value)) return;
+  if (!marking_state()->WhiteToGrey(value)) return;
+  if (ThreadId::Current() == isolate()->thread_id()) {
+    main_thread_worklist_local_.Push(value);
+  } else {
+    base::MutexGuard guard(&background_barrier_mutex_);
+    background_barrier_worklist_local_.Push(value);
+  }
+}
+
+void MinorMarkCompactCollector::NotifyObjectLayoutChange(HeapObject object) {
+  DCHECK(concurrent_marking_active_);
+  if (!Heap::InYoungGeneration(object)) return;
+  // Wait for concurrent visitors to finish. The job is rescheduled on the next
+  // allocation step.
+  StopConcurrentMarkingJob();
+  // White objects are found through the roots or the marking barrier. Objects
+  // that may have been visited already are visited again in the pause.
+  if (!marking_state()->IsWhite(object)) {
+    main_thread_worklist_local_.Push(object);
+  }
+}
+
+void MinorMarkCompactCollector::FinishConcurrentMarking() {
+  DCHECK(concurrent_marking_active_);
+  StopConcurrentMarkingJob();
+  SetMarkingBarrierPageFlags(false);
+  if (heap()->incremental_marking()->IsStopped()) {
+    heap()->SetIsMarkingFlag(false);
+  }
+  {
+    base::MutexGuard guard(&background_barrier_mutex_);
+    background_barrier_worklist_local_.Publish();
+  }
+  concurrent_marking_active_ = false;
+}
+
+void MinorMarkCompactCollector::AbortConcurrentMarking() {
+  if (!concurrent_marking_active_) return;
+  FinishConcurrentMarking();
+  main_thread_worklist_local_.Publish();
+  worklist()->Clear();
+  for (Page* p : *heap()->new_space()) {
+    non_atomic_marking_state()->ClearLiveness(p);
+  }
+  for (LargePage* p : *heap()->new_lo_space()) {
+    non_atomic_marking_state()->ClearLiveness(p);
+  }
+}
+
 void MinorMarkCompactCollector::MarkLiveObjects() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK);
 
   PostponeInterruptsScope postpone(isolate());
 
+  // Grey objects left by concurrent marking are picked up by the parallel
+  // marking job below. The roots and remembered set are revisited to find
+  // objects that became reachable after marking was seeded.
+  if (concurrent_marking_active_) FinishConcurrentMarking();
+
   RootMarkingVisitor root_visitor(this);
 
   MarkRootSetInParallel(&root_visitor);
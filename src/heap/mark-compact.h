@@ -11,6 +11,7 @@
 #include "include/v8-internal.h"
 #include "src/heap/base/worklist.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/ephemeron-index.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/marking.h"
@@ -411,7 +412,7 @@ class MarkCompactCollector final {
 
   enum class MarkingWorklistProcessingMode {
     kDefault,
-    kTrackNewlyDiscoveredObjects
+    kLookupEphemeronIndex
   };
 
   enum class StartCompactionMode {
@@ -516,22 +517,6 @@ class MarkCompactCollector final {
 
   inline void AddTransitionArray(TransitionArray array);
 
-  void AddNewlyDiscovered(HeapObject object) {
-    if (ephemeron_marking_.newly_discovered_overflowed) return;
-
-    if (ephemeron_marking_.newly_discovered.size() <
-        ephemeron_marking_.newly_discovered_limit) {
-      ephemeron_marking_.newly_discovered.push_back(object);
-    } else {
-      ephemeron_marking_.newly_discovered_overflowed = true;
-    }
-  }
-
-  void ResetNewlyDiscovered() {
-    ephemeron_marking_.newly_discovered_overflowed = false;
-    ephemeron_marking_.newly_discovered.clear();
-  }
-
   Sweeper* sweeper() { return sweeper_; }
 
 #ifdef DEBUG
@@ -572,8 +557,15 @@ class MarkCompactCollector final {
                 MarkingWorklistProcessingMode::kDefault>
   std::pair<size_t, size_t> ProcessMarkingWorklist(size_t bytes_to_process);
 
-  std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
-      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode);
+  // Adds the items updating the remembered sets of |chunk| to |items|. Large
+  // chunks are split into several items.
+  void CreateRememberedSetUpdatingItems(
+      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
+
+  // Excludes |page| from evacuation in the current GC because an object on it
+  // is referenced from the native stack. Must be called before evacuation.
+  void PinEvacuationCandidate(Page* page);
 
  private:
   void ComputeEvacuationHeuristics(size_t area_size,
@@ -640,7 +632,12 @@ class MarkCompactCollector final {
 
   // Mark ephemerons and drain marking worklist with a linear algorithm.
   // Only used if fixpoint iteration doesn't finish within a few iterations.
+  // Values are marked through |ephemeron_index_| whenever their key is
+  // visited, by both the main thread and the parallel marking tasks.
   void ProcessEphemeronsLinear();
+  // Processes the ephemerons discovered during the last marking round and
+  // adds those with white keys and values to |ephemeron_index_|.
+  void IndexDiscoveredEphemerons();
 
   // Perform Wrapper Tracing if in use.
   void PerformWrapperTracing();
@@ -751,7 +748,7 @@ class MarkCompactCollector final {
   MarkingWorklists marking_worklists_;
 
   WeakObjects weak_objects_;
-  EphemeronMarking ephemeron_marking_;
+  EphemeronIndex ephemeron_index_;
 
   std::unique_ptr<MarkingVisitor> marking_visitor_;
   std::unique_ptr<MarkingWorklists::Local> local_marking_worklists_;
@@ -832,12 +829,31 @@ class MinorMarkCompactCollector final {
   void MakeIterable(Page* page, FreeSpaceTreatmentMode free_space_mode);
   void CleanupPromotedPages();
 
-  std::unique_ptr<UpdatingItem> CreateRememberedSetUpdatingItem(
-      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode);
+  void CreateRememberedSetUpdatingItems(
+      MemoryChunk* chunk, RememberedSetUpdatingMode updating_mode,
+      std::vector<std::unique_ptr<UpdatingItem>>* items);
+
+  // Concurrent marking (--concurrent-minor-mc-marking). Marking is seeded on
+  // the main thread from the roots and the OLD_TO_NEW remembered set and the
+  // transitive closure is computed by a background job. The atomic pause then
+  // only revisits the roots and drains whatever is left on the worklists.
+  void StartConcurrentMarking();
+  void AbortConcurrentMarking();
+  bool IsConcurrentMarkingActive() const { return concurrent_marking_active_; }
+
+  // Write barrier slow path used while concurrent marking is active.
+  void MarkValueFromBarrier(HeapObject value);
+  // Background visitors must not observe an object while its layout changes.
+  // The concurrent job is stopped and the object is revisited in the pause.
+  void NotifyObjectLayoutChange(HeapObject object);
+
+  static bool ConcurrentMarkingTriggerReached(Heap* heap);
 
  private:
   using MarkingWorklist =
       ::heap::base::Worklist<HeapObject, 64 /* segment size */>;
+  class ConcurrentMarkingObserver;
+  class ConcurrentMarkingStartTask;
   class RootMarkingVisitor;
 
   static const int kNumMarkers = 8;
@@ -871,10 +887,20 @@ class MinorMarkCompactCollector final {
 
   void SweepArrayBufferExtensions();
 
+  void SeedConcurrentMarking();
+  void ScheduleConcurrentMarkingJob();
+  void StopConcurrentMarkingJob();
+  void FinishConcurrentMarking();
+  void SetMarkingBarrierPageFlags(bool is_marking);
+  void ScheduleConcurrentMarkingStartTask();
+
   Heap* heap_;
 
   MarkingWorklist* worklist_;
   MarkingWorklist::Local main_thread_worklist_local_;
+  // Marking barrier hits from threads other than the main thread.
+  MarkingWorklist::Local background_barrier_worklist_local_;
+  base::Mutex background_barrier_mutex_;
 
   MarkingState marking_state_;
   NonAtomicMarkingState non_atomic_marking_state_;
@@ -885,6 +911,12 @@ class MinorMarkCompactCollector final {
   std::vector<Page*> promoted_pages_;
   std::vector<LargePage*> promoted_large_pages_;
 
+  std::unique_ptr<ConcurrentMarkingObserver> concurrent_marking_observer_;
+  std::unique_ptr<JobHandle> concurrent_marking_job_handle_;
+  bool concurrent_marking_active_ = false;
+  bool concurrent_marking_start_task_pending_ = false;
+
+  friend class YoungGenerationConcurrentMarkingJob;
   friend class YoungGenerationMarkingTask;
   friend class YoungGenerationMarkingJob;
   friend class YoungGenerationMarkingVisitor;
@@ -151,6 +151,10 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitBytecodeArray(
   int size = BytecodeArray::BodyDescriptor::SizeOf(map, object);
   this->VisitMapPointer(object);
   BytecodeArray::BodyDescriptor::IterateBody(map, object, size, this);
+  if (bytecode_flushing_policy_) {
+    bytecode_flushing_policy_->RecordRetainedBytecode(object.bytecode_age(),
+                                                      size);
+  }
   if (!should_keep_ages_unchanged_) {
     object.MakeOlder();
   }
@@ -161,7 +165,8 @@ template <typename ConcreteVisitor, typename MarkingState>
 int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
     Map map, JSFunction js_function) {
   int size = concrete_visitor()->VisitJSObjectSubclass(map, js_function);
-  if (js_function.ShouldFlushBaselineCode(code_flush_mode_)) {
+  if (js_function.ShouldFlushBaselineCode(code_flush_mode_, old_bytecode_age_,
+                                          old_baseline_code_age_)) {
     DCHECK(IsBaselineCodeFlushingEnabled(code_flush_mode_));
     local_weak_objects_->baseline_flushing_candidates_local.Push(js_function);
   } else {
@@ -172,6 +177,9 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
     if (IsByteCodeFlushingEnabled(code_flush_mode_) &&
         js_function.NeedsResetDueToFlushedBytecode()) {
       local_weak_objects_->flushed_js_functions_local.Push(js_function);
+    } else if (js_function.ShouldFlushFeedbackVector(
+                   code_flush_mode_, old_feedback_vector_age_)) {
+      local_weak_objects_->flushed_js_functions_local.Push(js_function);
     }
   }
   return size;
@@ -186,14 +194,16 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitSharedFunctionInfo(
   this->VisitMapPointer(shared_info);
   SharedFunctionInfo::BodyDescriptor::IterateBody(map, shared_info, size, this);
 
-  if (!shared_info.ShouldFlushCode(code_flush_mode_)) {
+  if (!shared_info.ShouldFlushCode(code_flush_mode_, old_bytecode_age_,
+                                   old_baseline_code_age_)) {
     // If the SharedFunctionInfo doesn't have old bytecode visit the function
     // data strongly.
     VisitPointer(shared_info,
                  shared_info.RawField(SharedFunctionInfo::kFunctionDataOffset));
-  } else if (!IsByteCodeFlushingEnabled(code_flush_mode_)) {
-    // If bytecode flushing is disabled but baseline code flushing is enabled
-    // then we have to visit the bytecode but not the baseline code.
+  } else if (shared_info.ShouldKeepBytecodeOfFlushedBaselineCode(
+                 code_flush_mode_, old_bytecode_age_)) {
+    // If bytecode flushing is disabled or only the baseline code is old, then
+    // we have to visit the bytecode but not the baseline code.
     DCHECK(IsBaselineCodeFlushingEnabled(code_flush_mode_));
     CodeT baseline_codet = CodeT::cast(shared_info.function_data(kAcquireLoad));
     // Safe to do a relaxed load here since the CodeT was acquire-loaded.
@@ -6,6 +6,7 @@
 #define V8_HEAP_MARKING_VISITOR_H_
 
 #include "src/common/globals.h"
+#include "src/heap/bytecode-flushing-policy.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/marking.h"
 #include "src/heap/memory-chunk.h"
@@ -16,12 +17,6 @@
 namespace v8 {
 namespace internal {
 
-struct EphemeronMarking {
-  std::vector<HeapObject> newly_discovered;
-  bool newly_discovered_overflowed;
-  size_t newly_discovered_limit;
-};
-
 template <typename ConcreteState, AccessMode access_mode>
 class MarkingStateBase {
  public:
@@ -152,6 +147,15 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
         heap_(heap),
         mark_compact_epoch_(mark_compact_epoch),
         code_flush_mode_(code_flush_mode),
+        old_bytecode_age_(heap->bytecode_flushing_policy()->flush_age()),
+        old_baseline_code_age_(
+            heap->bytecode_flushing_policy()->baseline_flush_age()),
+        old_feedback_vector_age_(
+            heap->bytecode_flushing_policy()->feedback_vector_flush_age()),
+        bytecode_flushing_policy_(
+            heap->bytecode_flushing_policy()->records_retained_bytecode()
+                ? heap->bytecode_flushing_policy()
+                : nullptr),
         is_embedder_tracing_enabled_(is_embedder_tracing_enabled),
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         is_shared_heap_(heap->IsShared())
@@ -210,10 +214,14 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   }
 
   V8_INLINE void VisitExternalPointer(HeapObject host,
-                                      ExternalPointer_t ptr) final {
+                                      ExternalPointerSlot slot) final {
 #ifdef V8_SANDBOXED_EXTERNAL_POINTERS
-    uint32_t index = ptr >> kExternalPointerIndexShift;
-    external_pointer_table_->Mark(index);
+    uint32_t index = slot.load() >> kExternalPointerIndexShift;
+    // Scavenges may move young objects before the table is swept, so only
+    // handles in old objects can be updated when compacting the table.
+    Address handle_location =
+        Heap::InYoungGeneration(host) ? kNullAddress : slot.address();
+    external_pointer_table_->Mark(index, handle_location);
 #endif  // V8_SANDBOXED_EXTERNAL_POINTERS
   }
 
@@ -281,6 +289,15 @@ class MarkingVisitorBase : public HeapVisitor<int, ConcreteVisitor> {
   Heap* const heap_;
   const unsigned mark_compact_epoch_;
   const base::EnumSet<CodeFlushMode> code_flush_mode_;
+  // Bytecode of this age or older is flushed if flushing is enabled.
+  const int old_bytecode_age_;
+  // Baseline code of this age or older is flushed if flushing is enabled.
+  const int old_baseline_code_age_;
+  // Feedback vectors of functions with bytecode of this age or older are
+  // flushed if feedback vector flushing is enabled.
+  const int old_feedback_vector_age_;
+  // Set if the retained bytecode is to be recorded by age.
+  BytecodeFlushingPolicy* const bytecode_flushing_policy_;
   const bool is_embedder_tracing_enabled_;
   const bool should_keep_ages_unchanged_;
   const bool is_shared_heap_;
@@ -4,9 +4,11 @@
 
 #include "src/heap/memory-allocator.h"
 
+#include <algorithm>
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -41,12 +43,14 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
       size_executable_(0),
       lowest_ever_allocated_(static_cast<Address>(-1ll)),
       highest_ever_allocated_(kNullAddress),
-      unmapper_(isolate->heap(), this) {
+      unmapper_(isolate->heap(), this),
+      huge_page_pool_(this) {
   DCHECK_NOT_NULL(code_page_allocator);
 }
 
 void MemoryAllocator::TearDown() {
   unmapper()->TearDown();
+  huge_page_pool()->TearDown();
 
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK_EQ(size_, 0u);
@@ -215,6 +219,106 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   return sum;
 }
 
+bool MemoryAllocator::HugePagePool::AllocateRegion() {
+  v8::PageAllocator* page_allocator = allocator_->data_page_allocator();
+#ifdef V8_COMPRESS_POINTERS
+  void* address_hint = nullptr;
+#else
+  void* address_hint =
+      AlignedAddress(allocator_->isolate_->heap()->GetRandomMmapAddr(),
+                     kRegionSize);
+#endif
+  VirtualMemory reservation(page_allocator, kRegionSize, address_hint,
+                            kRegionSize);
+  if (!reservation.IsReserved()) return false;
+  // Reservations are rounded up to the allocate page size and may thus be
+  // larger than requested. The region itself starts at the aligned address.
+  const Address start = RoundUp(reservation.address(), kRegionSize);
+  DCHECK_LE(start + kRegionSize, reservation.end());
+  if (!reservation.SetPermissions(start, kRegionSize,
+                                  PageAllocator::kReadWrite)) {
+    return false;
+  }
+  allocator_->UpdateAllocatedSpaceLimits(start, start + kRegionSize);
+  const bool huge_pages =
+      base::OS::AdviseHugePages(reinterpret_cast<void*>(start), kRegionSize);
+  if (FLAG_trace_unmapper) {
+    PrintIsolate(allocator_->isolate_,
+                 "HugePagePool: new region %p (huge pages: %d)\n",
+                 reinterpret_cast<void*>(start), huge_pages);
+  }
+  for (size_t i = kPagesPerRegion; i > 0; i--) {
+    free_pages_.push_back(start + (i - 1) * MemoryChunk::kPageSize);
+  }
+  regions_.emplace(start, Region{std::move(reservation), 0});
+  return true;
+}
+
+Address MemoryAllocator::HugePagePool::Allocate() {
+  base::MutexGuard guard(&mutex_);
+  if (free_pages_.empty() && !AllocateRegion()) return kNullAddress;
+  const Address page = free_pages_.back();
+  free_pages_.pop_back();
+  regions_.at(RoundDown(page, kRegionSize)).used_pages++;
+  return page;
+}
+
+void MemoryAllocator::HugePagePool::Free(Address page) {
+  base::MutexGuard guard(&mutex_);
+  Region& region = regions_.at(RoundDown(page, kRegionSize));
+  DCHECK_LT(0, region.used_pages);
+  region.used_pages--;
+  free_pages_.push_back(page);
+}
+
+bool MemoryAllocator::HugePagePool::Contains(Address page) {
+  base::MutexGuard guard(&mutex_);
+  return regions_.find(RoundDown(page, kRegionSize)) != regions_.end();
+}
+
+size_t MemoryAllocator::HugePagePool::ReleaseFreeRegions() {
+  base::MutexGuard guard(&mutex_);
+  size_t released = 0;
+  for (auto it = regions_.begin(); it != regions_.end();) {
+    if (it->second.used_pages > 0) {
+      ++it;
+      continue;
+    }
+    const Address start = it->first;
+    free_pages_.erase(std::remove_if(free_pages_.begin(), free_pages_.end(),
+                                     [start](Address page) {
+                                       return RoundDown(page, kRegionSize) ==
+                                              start;
+                                     }),
+                      free_pages_.end());
+    it->second.reservation.Free();
+    released += kRegionSize;
+    it = regions_.erase(it);
+  }
+  if (FLAG_trace_unmapper && released > 0) {
+    PrintIsolate(allocator_->isolate_,
+                 "HugePagePool: released %zu KB, %zu regions left\n",
+                 released / KB, regions_.size());
+  }
+  return released;
+}
+
+void MemoryAllocator::HugePagePool::TearDown() {
+  ReleaseFreeRegions();
+  DCHECK(regions_.empty());
+  DCHECK(free_pages_.empty());
+}
+
+size_t MemoryAllocator::HugePagePool::CommittedFreeMemory() {
+  base::MutexGuard guard(&mutex_);
+  return free_pages_.size() * MemoryChunk::kPageSize;
+}
+
+size_t MemoryAllocator::HugePagePool::NumberOfRegions() {
+  base::MutexGuard guard(&mutex_);
+  return regions_.size();
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation) {
   Address base = reservation->address();
   size_t size = reservation->size();
@@ -502,7 +606,10 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   chunk->ReleaseAllAllocatedMemory();
 
   VirtualMemory* reservation = chunk->reserved_memory();
-  if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
+  if (IsFromHugePagePool(chunk)) {
+    // The page stays committed and is handed back to its region.
+    huge_page_pool()->Free(chunk->address());
+  } else if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
     UncommitMemory(reservation);
   } else {
     DCHECK(reservation->IsReserved());
@@ -511,6 +618,13 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
 }
 
 void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
+  if (IsFromHugePagePool(chunk)) {
+    // Nothing is unmapped for these pages, so there is no benefit in freeing
+    // them on a background thread.
+    PreFreeMemory(chunk);
+    PerformFreeMemory(chunk);
+    return;
+  }
   switch (mode) {
     case FreeMode::kImmediately:
       PreFreeMemory(chunk);
@@ -541,7 +655,11 @@ Page* MemoryAllocator::AllocatePage(MemoryAllocator::AllocationMode alloc_mode,
   size_t size =
       MemoryChunkLayout::AllocatableMemoryInMemoryChunk(space->identity());
   base::Optional<MemoryChunkAllocationResult> chunk_info;
-  if (alloc_mode == AllocationMode::kUsePool) {
+  if (FLAG_huge_page_pool && executable == NOT_EXECUTABLE &&
+      space->identity() != CODE_SPACE) {
+    chunk_info = AllocateUninitializedPageFromHugePagePool(space);
+  }
+  if (!chunk_info && alloc_mode == AllocationMode::kUsePool) {
     DCHECK_EQ(size, static_cast<size_t>(
                         MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
                             space->identity())));
@@ -630,6 +748,34 @@ MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   };
 }
 
+base::Optional<MemoryAllocator::MemoryChunkAllocationResult>
+MemoryAllocator::AllocateUninitializedPageFromHugePagePool(Space* space) {
+  const Address start = huge_page_pool()->Allocate();
+  if (start == kNullAddress) return {};
+  const size_t size = MemoryChunk::kPageSize;
+  const Address area_start =
+      start +
+      MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(space->identity());
+  const Address area_end = start + size;
+  if (Heap::ShouldZapGarbage()) {
+    ZapBlock(start, size, kZapValue);
+  }
+
+  size_ += size;
+  LOG(isolate_,
+      NewEvent("MemoryChunk", reinterpret_cast<void*>(start), size));
+  // The page does not own its memory; the region is owned by the pool.
+  return MemoryChunkAllocationResult{
+      reinterpret_cast<void*>(start), size, area_start, area_end,
+      VirtualMemory(),
+  };
+}
+
+bool MemoryAllocator::IsFromHugePagePool(MemoryChunk* chunk) {
+  return FLAG_huge_page_pool && !chunk->reserved_memory()->IsReserved() &&
+         huge_page_pool()->Contains(chunk->address());
+}
+
 void MemoryAllocator::ZapBlock(Address start, size_t size,
                                uintptr_t zap_value) {
   DCHECK(IsAligned(start, kTaggedSize));
@@ -134,6 +134,47 @@ class MemoryAllocator {
     friend class MemoryAllocator;
   };
 
+  // HugePagePool reserves kRegionSize aligned regions, backs them with
+  // transparent huge pages where the OS supports it and carves regular pages
+  // out of them (--huge-page-pool). Freed pages stay committed in the pool;
+  // regions are only returned to the OS as a whole by ReleaseFreeRegions().
+  class HugePagePool {
+   public:
+    static constexpr size_t kRegionSize = 2 * MB;
+    static constexpr size_t kPagesPerRegion =
+        kRegionSize / MemoryChunk::kPageSize;
+    STATIC_ASSERT(kRegionSize % MemoryChunk::kPageSize == 0);
+
+    explicit HugePagePool(MemoryAllocator* allocator) : allocator_(allocator) {}
+
+    // Returns the start of a committed page or kNullAddress on failure.
+    Address Allocate();
+    void Free(Address page);
+    bool Contains(Address page);
+
+    // Releases all regions that do not contain any live pages. Returns the
+    // number of released bytes.
+    V8_EXPORT_PRIVATE size_t ReleaseFreeRegions();
+    void TearDown();
+
+    V8_EXPORT_PRIVATE size_t CommittedFreeMemory();
+    V8_EXPORT_PRIVATE size_t NumberOfRegions();
+
+   private:
+    struct Region {
+      VirtualMemory reservation;
+      size_t used_pages = 0;
+    };
+
+    bool AllocateRegion();
+
+    MemoryAllocator* const allocator_;
+    base::Mutex mutex_;
+    // Regions keyed by their start address.
+    std::unordered_map<Address, Region> regions_;
+    std::vector<Address> free_pages_;
+  };
+
   enum class AllocationMode {
     // Regular allocation path. Does not use pool.
     kRegular,
@@ -256,6 +297,8 @@ class MemoryAllocator {
 
   Unmapper* unmapper() { return &unmapper_; }
 
+  HugePagePool* huge_page_pool() { return &huge_page_pool_; }
+
   void UnregisterReadOnlyPage(ReadOnlyPage* page);
 
   Address HandleAllocationFailure();
@@ -319,9 +362,16 @@ class MemoryAllocator {
   base::Optional<MemoryChunkAllocationResult> AllocateUninitializedPageFromPool(
       Space* space);
 
+  // Allocates a page out of a huge page backed region. Such pages do not own
+  // a reservation and are always handed back to the HugePagePool.
+  base::Optional<MemoryChunkAllocationResult>
+  AllocateUninitializedPageFromHugePagePool(Space* space);
+
   // Frees a pooled page. Only used on tear-down and last-resort GCs.
   void FreePooledChunk(MemoryChunk* chunk);
 
+  bool IsFromHugePagePool(MemoryChunk* chunk);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -400,6 +450,7 @@ class MemoryAllocator {
 
   base::Optional<VirtualMemory> reserved_chunk_at_virtual_memory_limit_;
   Unmapper unmapper_;
+  HugePagePool huge_page_pool_;
 
 #ifdef DEBUG
   // Data structure to remember allocated executable memory chunks.
@@ -230,6 +230,19 @@ void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
   ScheduleReportingTask();
 }
 
+void MemoryMeasurement::RecordContextSizes(const NativeContextStats& stats) {
+  Object context = isolate_->heap()->native_contexts_list();
+  while (!context.IsUndefined(isolate_)) {
+    NativeContext native_context = NativeContext::cast(context);
+    size_t size_in_kb = stats.Get(native_context.ptr()) / KB;
+    native_context.set_measured_memory_kb(
+        Smi::FromInt(static_cast<int>(
+            std::min<size_t>(size_in_kb, Smi::kMaxValue))));
+    context = native_context.next_context_link();
+  }
+  last_shared_size_ = stats.Get(MarkingWorklists::kSharedContext);
+}
+
 void MemoryMeasurement::ScheduleReportingTask() {
   if (reporting_task_pending_) return;
   reporting_task_pending_ = true;
@@ -31,6 +31,11 @@ class MemoryMeasurement {
                       const std::vector<Handle<NativeContext>> contexts);
   std::vector<Address> StartProcessing();
   void FinishProcessing(const NativeContextStats& stats);
+  // Stores the size of every native context in the context itself, so that
+  // it can be read without a measurement request. The size of objects shared
+  // between contexts is available as last_shared_size().
+  void RecordContextSizes(const NativeContextStats& stats);
+  size_t last_shared_size() const { return last_shared_size_; }
 
   static std::unique_ptr<v8::MeasureMemoryDelegate> DefaultDelegate(
       Isolate* isolate, Handle<NativeContext> context,
@@ -60,6 +65,7 @@ class MemoryMeasurement {
   bool reporting_task_pending_ = false;
   bool delayed_gc_task_pending_ = false;
   bool eager_gc_task_pending_ = false;
+  size_t last_shared_size_ = 0;
   base::RandomNumberGenerator random_number_generator_;
 };
 
@@ -5,9 +5,12 @@
 #include "src/heap/memory-reducer.h"
 
 #include "src/flags/flags.h"
+#include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/load-schedule.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 
@@ -60,9 +63,26 @@ void MemoryReducer::TimerTask::RunInternal() {
       heap->incremental_marking()->IsStopped() &&
       (heap->incremental_marking()->CanBeActivated() || optimize_for_memory);
   event.committed_memory = heap->CommittedOldGenerationMemory();
+  // Avoid starting a GC that would overlap with load predicted by the
+  // embedder.
+  event.load_window_end_ms =
+      heap->load_schedule()->IsEmpty()
+          ? 0
+          : heap->load_schedule()->OverlappingWindowEnd(
+                time_ms, memory_reducer_->EstimateGCDurationInMs());
   memory_reducer_->NotifyTimer(event);
 }
 
+double MemoryReducer::EstimateGCDurationInMs() {
+  double speed_in_bytes_per_ms =
+      heap()->tracer()->CombinedMarkCompactSpeedInBytesPerMillisecond();
+  if (speed_in_bytes_per_ms == 0) {
+    speed_in_bytes_per_ms = static_cast<double>(
+        GCIdleTimeHandler::kInitialConservativeMarkingSpeed);
+  }
+  return static_cast<double>(heap()->SizeOfObjects()) / speed_in_bytes_per_ms;
+}
+
 
 void MemoryReducer::NotifyTimer(const Event& event) {
   DCHECK_EQ(kTimer, event.type);
@@ -113,6 +133,11 @@ void MemoryReducer::NotifyMarkCompact(const Event& event) {
     ScheduleTimer(state_.next_gc_start_ms - event.time_ms);
   }
   if (old_action == kRun) {
+    if (FLAG_huge_page_pool) {
+      // Huge page backed regions are only given back to the OS when the
+      // memory reducer decides to shrink the heap.
+      heap()->memory_allocator()->huge_page_pool()->ReleaseFreeRegions();
+    }
     if (FLAG_trace_gc_verbose) {
       heap()->isolate()->PrintWithTimestamp(
           "Memory reducer: finished GC #%d (%s)\n", state_.started_gcs,
@@ -180,6 +205,13 @@ MemoryReducer::State MemoryReducer::Step(const State& state,
                      (event.should_start_incremental_gc ||
                       WatchdogGC(state, event))) {
             if (state.next_gc_start_ms <= event.time_ms) {
+              if (event.load_window_end_ms > event.time_ms &&
+                  !WatchdogGC(state, event)) {
+                // Postpone the GC until the expected load is over.
+                return State(kWait, state.started_gcs,
+                             event.load_window_end_ms, state.last_gc_time_ms,
+                             0);
+              }
               return State(kRun, state.started_gcs + 1, 0.0,
                            state.last_gc_time_ms, 0);
             } else {
@@ -56,6 +56,11 @@ class Heap;
 //     - in the timer callback if the mutator allocation rate is high or
 //       incremental GC is in progress or (now_ms - t < watchdog_delay_ms)
 //
+// WAIT n x t -> WAIT n e t happens:
+//     - in the timer callback if the transition to RUN would be taken but the
+//       GC is expected to overlap with a load window reported by the embedder
+//       that ends at e, unless (now_ms - t > watchdog_delay_ms).
+//
 // WAIT n x t -> WAIT (n+1) t happens:
 //     - on background idle notification, which signals that we can start
 //       incremental marking even if the allocation rate is high.
@@ -112,6 +117,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     bool next_gc_likely_to_collect_more;
     bool should_start_incremental_gc;
     bool can_start_incremental_gc;
+    // End of the expected load window that a GC started at time_ms would run
+    // into, or 0 if no such window is known. Only used for timer events.
+    double load_window_end_ms;
   };
 
   explicit MemoryReducer(Heap* heap);
@@ -159,6 +167,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
 
   void NotifyTimer(const Event& event);
 
+  // Conservative estimate of the time it takes to finish a memory reducing GC.
+  double EstimateGCDurationInMs();
+
   static bool WatchdogGC(const State& state, const Event& event);
 
   Heap* heap_;
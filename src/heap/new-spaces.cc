@@ -557,6 +557,26 @@ void NewSpace::Shrink() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
+size_t NewSpace::SetMaximumCapacity(size_t maximum_capacity) {
+  maximum_capacity = std::max(InitialTotalCapacity(),
+                              ::RoundUp(maximum_capacity, Page::kPageSize));
+  if (maximum_capacity < TotalCapacity()) {
+    size_t new_capacity =
+        std::max(maximum_capacity, ::RoundUp(2 * Size(), Page::kPageSize));
+    if (new_capacity < TotalCapacity()) {
+      // Shrinking returns the pages to the pool, which uncommits them.
+      to_space_.ShrinkTo(new_capacity);
+      if (from_space_.IsCommitted()) from_space_.Reset();
+      from_space_.ShrinkTo(new_capacity);
+    }
+    maximum_capacity = std::max(maximum_capacity, TotalCapacity());
+  }
+  to_space_.set_maximum_capacity(maximum_capacity);
+  from_space_.set_maximum_capacity(maximum_capacity);
+  DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
+  return maximum_capacity;
+}
+
 size_t NewSpace::CommittedPhysicalMemory() const {
   if (!base::OS::HasLazyCommits()) return CommittedMemory();
   BasicMemoryChunk::UpdateHighWaterMark(allocation_info_->top());
@@ -120,6 +120,11 @@ class SemiSpace : public Space {
 
   // Returns the maximum capacity of the semispace.
   size_t maximum_capacity() const { return maximum_capacity_; }
+  void set_maximum_capacity(size_t maximum_capacity) {
+    DCHECK_GE(maximum_capacity, target_capacity_);
+    DCHECK_GE(maximum_capacity, minimum_capacity_);
+    maximum_capacity_ = maximum_capacity;
+  }
 
   // Returns the initial capacity of the semispace.
   size_t minimum_capacity() const { return minimum_capacity_; }
@@ -324,6 +329,12 @@ class V8_EXPORT_PRIVATE NewSpace final : public NewSpaceBase {
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Sets the maximum capacity of the semispaces to |maximum_capacity|, but not
+  // below their initial capacity, and shrinks them if they are larger. The
+  // maximum stays above the space needed for the objects allocated so far.
+  // Returns the new maximum capacity.
+  size_t SetMaximumCapacity(size_t maximum_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() const final {
     DCHECK_GE(top(), to_space_.page_low());
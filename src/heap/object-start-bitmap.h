@@ -11,6 +11,7 @@
 #include <array>
 
 #include "include/v8-internal.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/bits.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
@@ -29,8 +30,9 @@ static const int kPageSize = 1 << kPageSizeBits;
 // - kPageSize
 // - kAllocationGranularity
 //
-// ObjectStartBitmap does not support concurrent access and is used only by the
-// main thread.
+// Bits are set and cleared atomically as objects are migrated into old
+// generation pages by parallel evacuation and scavenging tasks. Lookups are
+// only performed on the main thread during the atomic pause.
 class V8_EXPORT_PRIVATE ObjectStartBitmap {
  public:
   // Granularity of addresses added to the bitmap.
@@ -65,7 +67,6 @@ class V8_EXPORT_PRIVATE ObjectStartBitmap {
   inline void Clear();
 
  private:
-  inline void store(size_t cell_index, uint32_t value);
   inline uint32_t load(size_t cell_index) const;
 
   inline Address offset() const;
@@ -118,14 +119,15 @@ Address ObjectStartBitmap::FindBasePtr(Address maybe_inner_ptr) const {
 void ObjectStartBitmap::SetBit(Address base_ptr) {
   size_t cell_index, object_bit;
   ObjectStartIndexAndBit(base_ptr, &cell_index, &object_bit);
-  store(cell_index, load(cell_index) | static_cast<uint32_t>(1 << object_bit));
+  const uint32_t mask = static_cast<uint32_t>(1u << object_bit);
+  base::AsAtomic32::SetBits(&object_start_bit_map_[cell_index], mask, mask);
 }
 
 void ObjectStartBitmap::ClearBit(Address base_ptr) {
   size_t cell_index, object_bit;
   ObjectStartIndexAndBit(base_ptr, &cell_index, &object_bit);
-  store(cell_index,
-        load(cell_index) & static_cast<uint32_t>(~(1 << object_bit)));
+  const uint32_t mask = static_cast<uint32_t>(1u << object_bit);
+  base::AsAtomic32::SetBits(&object_start_bit_map_[cell_index], 0u, mask);
 }
 
 bool ObjectStartBitmap::CheckBit(Address base_ptr) const {
@@ -134,12 +136,8 @@ bool ObjectStartBitmap::CheckBit(Address base_ptr) const {
   return (load(cell_index) & static_cast<uint32_t>(1 << object_bit)) != 0;
 }
 
-void ObjectStartBitmap::store(size_t cell_index, uint32_t value) {
-  object_start_bit_map_[cell_index] = value;
-}
-
 uint32_t ObjectStartBitmap::load(size_t cell_index) const {
-  return object_start_bit_map_[cell_index];
+  return base::AsAtomic32::Relaxed_Load(&object_start_bit_map_[cell_index]);
 }
 
 Address ObjectStartBitmap::offset() const { return offset_; }
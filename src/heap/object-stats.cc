@@ -6,14 +6,17 @@
 #include "src/heap/object-stats.h"
 
 #include <unordered_set>
+#include <vector>
 
 #include "src/base/bits.h"
+#include "src/base/utils/random-number-generator.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/logging/counters.h"
 #include "src/objects/compilation-cache-table-inl.h"
@@ -347,22 +350,25 @@ int ObjectStats::HistogramIndexFromSize(size_t size) {
 void ObjectStats::RecordObjectStats(InstanceType type, size_t size,
                                     size_t over_allocated) {
   DCHECK_LE(type, LAST_TYPE);
-  object_counts_[type]++;
-  object_sizes_[type] += size;
-  size_histogram_[type][HistogramIndexFromSize(size)]++;
-  over_allocated_[type] += over_allocated;
-  over_allocated_histogram_[type][HistogramIndexFromSize(size)]++;
+  object_counts_[type] += sampling_weight_;
+  object_sizes_[type] += size * sampling_weight_;
+  size_histogram_[type][HistogramIndexFromSize(size)] += sampling_weight_;
+  over_allocated_[type] += over_allocated * sampling_weight_;
+  over_allocated_histogram_[type][HistogramIndexFromSize(size)] +=
+      sampling_weight_;
 }
 
 void ObjectStats::RecordVirtualObjectStats(VirtualInstanceType type,
                                            size_t size, size_t over_allocated) {
   DCHECK_LE(type, LAST_VIRTUAL_TYPE);
-  object_counts_[FIRST_VIRTUAL_TYPE + type]++;
-  object_sizes_[FIRST_VIRTUAL_TYPE + type] += size;
-  size_histogram_[FIRST_VIRTUAL_TYPE + type][HistogramIndexFromSize(size)]++;
-  over_allocated_[FIRST_VIRTUAL_TYPE + type] += over_allocated;
+  object_counts_[FIRST_VIRTUAL_TYPE + type] += sampling_weight_;
+  object_sizes_[FIRST_VIRTUAL_TYPE + type] += size * sampling_weight_;
+  size_histogram_[FIRST_VIRTUAL_TYPE + type][HistogramIndexFromSize(size)] +=
+      sampling_weight_;
+  over_allocated_[FIRST_VIRTUAL_TYPE + type] +=
+      over_allocated * sampling_weight_;
   over_allocated_histogram_[FIRST_VIRTUAL_TYPE + type]
-                           [HistogramIndexFromSize(size)]++;
+                           [HistogramIndexFromSize(size)] += sampling_weight_;
 }
 
 Isolate* ObjectStats::isolate() { return heap()->isolate(); }
@@ -1109,6 +1115,19 @@ class ObjectStatsVisitor {
 
 namespace {
 
+void IterateLiveObjects(MemoryChunk* chunk,
+                        ObjectStatsCollectorImpl* live_collector,
+                        ObjectStatsCollectorImpl::Phase phase) {
+  MarkCompactCollector::NonAtomicMarkingState* marking_state =
+      chunk->heap()->mark_compact_collector()->non_atomic_marking_state();
+  for (auto object_and_size :
+       LiveObjectRange<kBlackObjects>(chunk, marking_state->bitmap(chunk))) {
+    live_collector->CollectStatistics(
+        object_and_size.first, phase,
+        ObjectStatsCollectorImpl::CollectFieldStats::kNo);
+  }
+}
+
 void IterateHeap(Heap* heap, ObjectStatsVisitor* visitor) {
   // We don't perform a GC while collecting object stats but need this scope for
   // the nested SafepointScope inside CombinedHeapObjectIterator.
@@ -1133,5 +1152,46 @@ void ObjectStatsCollector::Collect() {
   }
 }
 
+void ObjectStatsCollector::CollectSampled(int sampling_rate) {
+  DCHECK_GE(sampling_rate, 1);
+  // Pages are selected up front so that all phases see the same set.
+  base::RandomNumberGenerator* rng =
+      heap_->isolate()->random_number_generator();
+  std::vector<MemoryChunk*> sampled_pages;
+  std::vector<MemoryChunk*> large_pages;
+  size_t regular_pages = 0;
+  MemoryChunkIterator chunk_iterator(heap_);
+  while (chunk_iterator.HasNext()) {
+    MemoryChunk* chunk = chunk_iterator.Next();
+    if (chunk->IsLargePage()) {
+      large_pages.push_back(chunk);
+      continue;
+    }
+    regular_pages++;
+    if (rng->NextInt(sampling_rate) == 0) sampled_pages.push_back(chunk);
+  }
+  // Scale by the ratio that was actually sampled rather than by
+  // |sampling_rate| to avoid skewing the results on small heaps.
+  const size_t weight =
+      sampled_pages.empty()
+          ? 0
+          : (regular_pages + sampled_pages.size() / 2) / sampled_pages.size();
+
+  ObjectStatsCollectorImpl live_collector(heap_, live_);
+  live_->set_sampling_weight(1);
+  live_collector.CollectGlobalStatistics();
+  for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+    const auto phase = static_cast<ObjectStatsCollectorImpl::Phase>(i);
+    live_->set_sampling_weight(weight);
+    for (MemoryChunk* chunk : sampled_pages) {
+      IterateLiveObjects(chunk, &live_collector, phase);
+    }
+    live_->set_sampling_weight(1);
+    for (MemoryChunk* chunk : large_pages) {
+      IterateLiveObjects(chunk, &live_collector, phase);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -130,6 +130,10 @@ class ObjectStats {
     return object_sizes_last_time_[index];
   }
 
+  // Every subsequently recorded object is accounted as |weight| objects. Used
+  // to scale up the results when only a fraction of the heap is inspected.
+  void set_sampling_weight(size_t weight) { sampling_weight_ = weight; }
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
@@ -152,6 +156,7 @@ class ObjectStats {
   int HistogramIndexFromSize(size_t size);
 
   Heap* heap_;
+  size_t sampling_weight_ = 1;
   // Object counts and used memory by InstanceType.
   size_t object_counts_[OBJECT_STATS_COUNT];
   size_t object_counts_last_time_[OBJECT_STATS_COUNT];
@@ -186,6 +191,12 @@ class ObjectStatsCollector {
   // be present.
   void Collect();
 
+  // Collects type information of live objects on a random subset of roughly
+  // one in |sampling_rate| regular pages and scales the results accordingly.
+  // Large pages are always inspected. Dead objects and field statistics are
+  // not recorded. Requires mark bits to be present.
+  void CollectSampled(int sampling_rate);
+
  private:
   Heap* const heap_;
   ObjectStats* const live_;
@@ -0,0 +1,110 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-sampler.h"
+
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/heap-object-inl.h"
+
+namespace v8 {
+namespace internal {
+
+const char* AllocationSourceToString(AllocationSource source) {
+  switch (source) {
+    case AllocationSource::kNone:
+      return "none";
+    case AllocationSource::kJsonParse:
+      return "JSON.parse";
+    case AllocationSource::kValueDeserializer:
+      return "ValueDeserializer";
+  }
+  UNREACHABLE();
+}
+
+PretenuringSampler::PretenuringSampler(Heap* heap)
+    : AllocationObserver(FLAG_allocation_sampling_pretenuring_interval),
+      heap_(heap) {
+  samples_.reserve(kMaxSamples);
+}
+
+void PretenuringSampler::Step(int bytes_allocated, Address soon_object,
+                              size_t size) {
+  if (current_source_ == AllocationSource::kNone) return;
+  if (soon_object == kNullAddress || samples_.size() >= kMaxSamples) return;
+  DCHECK(Heap::InYoungGeneration(HeapObject::FromAddress(soon_object)));
+  samples_.push_back({soon_object, current_source_});
+  sampled_[static_cast<int>(current_source_)]++;
+}
+
+void PretenuringSampler::UpdateAfterScavenge() {
+  for (const Sample& sample : samples_) {
+    HeapObject object = HeapObject::FromAddress(sample.address);
+    // Sampled objects are either still alive in the from space and have been
+    // forwarded by the scavenger, or they are dead.
+    if (!Heap::InFromPage(object)) continue;
+    if (object.map_word(kRelaxedLoad).IsForwardingAddress()) {
+      survived_[static_cast<int>(sample.source)]++;
+    }
+  }
+  samples_.clear();
+  for (int i = 0; i < kNumberOfAllocationSources; i++) {
+    MakeDecision(static_cast<AllocationSource>(i));
+  }
+}
+
+void PretenuringSampler::MakeDecision(AllocationSource source) {
+  const int index = static_cast<int>(source);
+  if (sampled_[index] < kMinSamplesForDecision) return;
+  const double ratio = static_cast<double>(survived_[index]) / sampled_[index];
+  const bool pretenure =
+      ratio * 100 >= FLAG_allocation_sampling_pretenuring_ratio;
+  if (FLAG_trace_pretenuring_statistics) {
+    heap_->isolate()->PrintWithTimestamp(
+        "pretenuring sampler: %s sampled=%zu survived=%zu ratio=%.2f%s\n",
+        AllocationSourceToString(source), sampled_[index], survived_[index],
+        ratio, pretenure ? " => tenured" : "");
+  }
+  if (pretenure && !pretenured_[index] && FLAG_trace_pretenuring) {
+    PrintF("[PretenuringSampler: %s: (ratio=%.2f) => tenured]\n",
+           AllocationSourceToString(source), ratio);
+  }
+  pretenured_[index] = pretenure;
+  sampled_[index] = 0;
+  survived_[index] = 0;
+  SetCurrentSource(current_source_);
+}
+
+void PretenuringSampler::ResetSamples() {
+  samples_.clear();
+  sampled_.fill(0);
+  survived_.fill(0);
+}
+
+void PretenuringSampler::ResetDecisions() {
+  pretenured_.fill(false);
+  SetCurrentSource(current_source_);
+}
+
+void PretenuringSampler::SetCurrentSource(AllocationSource source) {
+  current_source_ = source;
+  pretenure_current_source_ = IsPretenured(source);
+}
+
+AllocationSourceScope::AllocationSourceScope(Heap* heap,
+                                             AllocationSource source)
+    : sampler_(heap->pretenuring_sampler()) {
+  if (!sampler_) return;
+  previous_source_ = sampler_->current_source();
+  sampler_->SetCurrentSource(source);
+}
+
+AllocationSourceScope::~AllocationSourceScope() {
+  if (!sampler_) return;
+  sampler_->SetCurrentSource(previous_source_);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,113 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PRETENURING_SAMPLER_H_
+#define V8_HEAP_PRETENURING_SAMPLER_H_
+
+#include <array>
+#include <vector>
+
+#include "src/common/globals.h"
+#include "src/heap/allocation-observer.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Runtime allocation sources that do not carry AllocationSites. Objects
+// allocated on behalf of these sources are not covered by memento based
+// pretenuring.
+enum class AllocationSource : uint8_t {
+  kNone,
+  kJsonParse,
+  kValueDeserializer,
+};
+
+static constexpr int kNumberOfAllocationSources =
+    static_cast<int>(AllocationSource::kValueDeserializer) + 1;
+
+const char* AllocationSourceToString(AllocationSource source);
+
+// Pretenures the allocations of runtime allocation sources based on sampling.
+// An allocation observer on the new space records a sample of the objects
+// that are allocated while a source is active, see AllocationSourceScope.
+// After a scavenge the samples yield the survival rate per source. Once the
+// survival rate of a source crosses --allocation-sampling-pretenuring-ratio,
+// HeapAllocator allocates its young objects directly in old space.
+class V8_EXPORT_PRIVATE PretenuringSampler final : public AllocationObserver {
+ public:
+  // Upper bound on the number of samples recorded between two scavenges.
+  static constexpr size_t kMaxSamples = 1024;
+  // Minimum number of samples of a source required for a decision.
+  static constexpr size_t kMinSamplesForDecision = 16;
+
+  explicit PretenuringSampler(Heap* heap);
+  PretenuringSampler(const PretenuringSampler&) = delete;
+  PretenuringSampler& operator=(const PretenuringSampler&) = delete;
+
+  void Step(int bytes_allocated, Address soon_object, size_t size) override;
+
+  AllocationSource current_source() const { return current_source_; }
+
+  // Returns true if young allocations of the current source should be
+  // allocated in old space instead.
+  bool ShouldPretenureCurrentSource() const {
+    return pretenure_current_source_;
+  }
+
+  bool IsPretenured(AllocationSource source) const {
+    return pretenured_[static_cast<int>(source)];
+  }
+
+  // Evaluates the samples and updates the pretenuring decisions. Must be
+  // called after scavenging while the from space is still intact.
+  void UpdateAfterScavenge();
+
+  // Drops all samples. Used for garbage collections that do not leave
+  // forwarding addresses in the from space.
+  void ResetSamples();
+
+  // Forgets all pretenuring decisions.
+  void ResetDecisions();
+
+ private:
+  struct Sample {
+    Address address;
+    AllocationSource source;
+  };
+
+  void SetCurrentSource(AllocationSource source);
+  void MakeDecision(AllocationSource source);
+
+  Heap* const heap_;
+  AllocationSource current_source_ = AllocationSource::kNone;
+  bool pretenure_current_source_ = false;
+  std::vector<Sample> samples_;
+  std::array<size_t, kNumberOfAllocationSources> sampled_ = {};
+  std::array<size_t, kNumberOfAllocationSources> survived_ = {};
+  std::array<bool, kNumberOfAllocationSources> pretenured_ = {};
+
+  friend class AllocationSourceScope;
+};
+
+// Attributes the main thread allocations in its scope to the given source.
+// Scopes nest and are no-ops if allocation sampling pretenuring is disabled.
+class V8_NODISCARD AllocationSourceScope final {
+ public:
+  AllocationSourceScope(Heap* heap, AllocationSource source);
+  ~AllocationSourceScope();
+
+  AllocationSourceScope(const AllocationSourceScope&) = delete;
+  AllocationSourceScope& operator=(const AllocationSourceScope&) = delete;
+
+ private:
+  PretenuringSampler* const sampler_;
+  AllocationSource previous_source_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PRETENURING_SAMPLER_H_
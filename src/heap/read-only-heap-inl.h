@@ -19,9 +19,22 @@ ReadOnlyRoots ReadOnlyHeap::GetReadOnlyRoots(HeapObject object) {
       Isolate::FromRootAddress(GetIsolateRootAddress(object.ptr())));
 #else
 #ifdef V8_SHARED_RO_HEAP
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // Objects in the external code space are outside of the cage of their
+  // isolate group, but they are always writable.
+  if (V8_EXTERNAL_CODE_SPACE_BOOL && IsCodeSpaceObject(object)) {
+    return ReadOnlyRoots(GetHeapFromWritableObject(object));
+  }
+  // This fails if we are creating heap objects and the roots haven't yet been
+  // copied into the read-only heap.
+  auto* shared_ro_heap =
+      IsolateGroup::FromCageBase(GetPtrComprCageBaseAddress(object.ptr()))
+          ->shared_read_only_heap();
+#else
   // This fails if we are creating heap objects and the roots haven't yet been
   // copied into the read-only heap.
   auto* shared_ro_heap = SoleReadOnlyHeap::shared_ro_heap_;
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
   if (shared_ro_heap != nullptr && shared_ro_heap->init_complete_) {
     return ReadOnlyRoots(shared_ro_heap->read_only_roots_);
   }
@@ -28,21 +28,34 @@ namespace {
 // Mutex used to ensure that ReadOnlyArtifacts creation is only done once.
 base::LazyMutex read_only_heap_creation_mutex_ = LAZY_MUTEX_INITIALIZER;
 
+#ifndef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 // Weak pointer holding ReadOnlyArtifacts. ReadOnlyHeap::SetUp creates a
 // std::shared_ptr from this when it attempts to reuse it. Since all Isolates
 // hold a std::shared_ptr to this, the object is destroyed when no Isolates
 // remain.
 base::LazyInstance<std::weak_ptr<ReadOnlyArtifacts>>::type
     read_only_artifacts_ = LAZY_INSTANCE_INITIALIZER;
+#endif
 
-std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts() {
+// When sharing a pointer compression cage among the Isolates of a group, the
+// read-only heap is in the cage, so there are ReadOnlyArtifacts per group.
+std::weak_ptr<ReadOnlyArtifacts>* GetReadOnlyArtifacts(IsolateGroup* group) {
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  return group->read_only_artifacts();
+#else
+  return read_only_artifacts_.Pointer();
+#endif
+}
+
+std::shared_ptr<ReadOnlyArtifacts> InitializeSharedReadOnlyArtifacts(
+    Isolate* isolate) {
   std::shared_ptr<ReadOnlyArtifacts> artifacts;
   if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL) {
     artifacts = std::make_shared<PointerCompressedReadOnlyArtifacts>();
   } else {
     artifacts = std::make_shared<SingleCopyReadOnlyArtifacts>();
   }
-  *read_only_artifacts_.Pointer() = artifacts;
+  *GetReadOnlyArtifacts(isolate->isolate_group()) = artifacts;
   return artifacts;
 }
 }  // namespace
@@ -71,9 +84,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
       bool read_only_heap_created = false;
       base::MutexGuard guard(read_only_heap_creation_mutex_.Pointer());
       std::shared_ptr<ReadOnlyArtifacts> artifacts =
-          read_only_artifacts_.Get().lock();
+          GetReadOnlyArtifacts(isolate->isolate_group())->lock();
       if (!artifacts) {
-        artifacts = InitializeSharedReadOnlyArtifacts();
+        artifacts = InitializeSharedReadOnlyArtifacts(isolate);
         artifacts->InitializeChecksum(read_only_snapshot_data);
         ro_heap = CreateInitalHeapForBootstrapping(isolate, artifacts);
         ro_heap->DeseralizeIntoIsolate(isolate, read_only_snapshot_data,
@@ -93,9 +106,9 @@ void ReadOnlyHeap::SetUp(Isolate* isolate,
       // before tearing down the Isolate that holds this ReadOnlyArtifacts and
       // is not thread-safe.
       std::shared_ptr<ReadOnlyArtifacts> artifacts =
-          read_only_artifacts_.Get().lock();
+          GetReadOnlyArtifacts(isolate->isolate_group())->lock();
       CHECK(!artifacts);
-      artifacts = InitializeSharedReadOnlyArtifacts();
+      artifacts = InitializeSharedReadOnlyArtifacts(isolate);
 
       ro_heap = CreateInitalHeapForBootstrapping(isolate, artifacts);
       artifacts->VerifyChecksum(read_only_snapshot_data, true);
@@ -144,8 +157,13 @@ ReadOnlyHeap* ReadOnlyHeap::CreateInitalHeapForBootstrapping(
   } else {
     std::unique_ptr<SoleReadOnlyHeap> sole_ro_heap(
         new SoleReadOnlyHeap(ro_space));
-    // The global shared ReadOnlyHeap is only used without pointer compression.
+    // The ReadOnlyHeap is shared by all Isolates without pointer compression,
+    // and by the Isolates of a group with a shared cage.
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+    isolate->isolate_group()->set_shared_read_only_heap(sole_ro_heap.get());
+#else
     SoleReadOnlyHeap::shared_ro_heap_ = sole_ro_heap.get();
+#endif
     ro_heap = std::move(sole_ro_heap);
   }
   artifacts->set_read_only_heap(std::move(ro_heap));
@@ -173,7 +191,7 @@ void ReadOnlyHeap::InitFromIsolate(Isolate* isolate) {
   if (IsReadOnlySpaceShared()) {
     InitializeFromIsolateRoots(isolate);
     std::shared_ptr<ReadOnlyArtifacts> artifacts(
-        *read_only_artifacts_.Pointer());
+        *GetReadOnlyArtifacts(isolate->isolate_group()));
 
     read_only_space()->DetachPagesAndAddToArtifacts(artifacts);
     artifacts->ReinstallReadOnlySpace(isolate);
@@ -205,8 +223,9 @@ void ReadOnlyHeap::PopulateReadOnlySpaceStatistics(
   statistics->read_only_space_used_size_ = 0;
   statistics->read_only_space_physical_size_ = 0;
   if (IsReadOnlySpaceShared()) {
+    // Only the read-only heap of the default isolate group is accounted.
     std::shared_ptr<ReadOnlyArtifacts> artifacts =
-        read_only_artifacts_.Get().lock();
+        GetReadOnlyArtifacts(IsolateGroup::GetDefault())->lock();
     if (artifacts) {
       auto* ro_space = artifacts->shared_read_only_space();
       statistics->read_only_space_size_ = ro_space->CommittedMemory();
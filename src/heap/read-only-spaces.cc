@@ -9,6 +9,7 @@
 #include "include/v8-internal.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
@@ -418,6 +419,18 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if constexpr (base::OS::IsMergeablePagesSupported()) {
+    if (FLAG_mergeable_read_only_space) {
+      // This is only a hint. Pages can only be merged if their contents do
+      // not depend on the process, e.g. pointers are compressed and no
+      // random hash seed is used for rehashing.
+      for (BasicMemoryChunk* chunk : pages_) {
+        USE(base::OS::MarkPagesMergeable(
+            reinterpret_cast<void*>(chunk->address()), chunk->size()));
+      }
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
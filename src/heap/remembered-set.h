@@ -273,6 +273,16 @@ class RememberedSet : public AllStatic {
     }
   }
 
+  // Compacts the typed slot set of the given memory chunk and releases it if
+  // it became empty. This must not run concurrently with any other access to
+  // the typed slot set.
+  static void CompactTyped(MemoryChunk* chunk) {
+    TypedSlotSet* slot_set = chunk->typed_slot_set<type>();
+    if (slot_set != nullptr && slot_set->Compact() == 0) {
+      chunk->ReleaseTypedSlotSet<type>();
+    }
+  }
+
   // Clear all old to old slots from the remembered set.
   static void ClearAll(Heap* heap) {
     STATIC_ASSERT(type == OLD_TO_OLD || type == OLD_TO_CODE);
@@ -9,6 +9,7 @@
 #include "src/base/logging.h"
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles.h"
@@ -213,39 +214,52 @@ void IsolateSafepoint::Barrier::Arm() {
   base::MutexGuard guard(&mutex_);
   DCHECK(!IsArmed());
   armed_ = true;
-  stopped_ = 0;
+  stopped_.store(0, std::memory_order_relaxed);
 }
 
 void IsolateSafepoint::Barrier::Disarm() {
   base::MutexGuard guard(&mutex_);
   DCHECK(IsArmed());
   armed_ = false;
-  stopped_ = 0;
+  stopped_.store(0, std::memory_order_relaxed);
   cv_resume_.NotifyAll();
 }
 
 void IsolateSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(
     size_t running) {
+  if (running == 0) return;
+  // Threads usually reach the safepoint quickly, so spinning for a while
+  // avoids having to be woken up by the last of them.
+  for (int i = 0; i < FLAG_safepoint_spin_iterations; ++i) {
+    if (stopped_.load(std::memory_order_acquire) >= running) {
+      DCHECK_EQ(stopped_.load(std::memory_order_relaxed), running);
+      return;
+    }
+    YIELD_PROCESSOR;
+  }
   base::MutexGuard guard(&mutex_);
   DCHECK(IsArmed());
-  while (stopped_ < running) {
+  while (stopped_.load(std::memory_order_relaxed) < running) {
     cv_stopped_.Wait(&mutex_);
   }
-  DCHECK_EQ(stopped_, running);
+  DCHECK_EQ(stopped_.load(std::memory_order_relaxed), running);
+}
+
+void IsolateSafepoint::Barrier::NotifyStopped() {
+  stopped_.fetch_add(1, std::memory_order_release);
+  cv_stopped_.NotifyOne();
 }
 
 void IsolateSafepoint::Barrier::NotifyPark() {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
-  stopped_++;
-  cv_stopped_.NotifyOne();
+  NotifyStopped();
 }
 
 void IsolateSafepoint::Barrier::WaitInSafepoint() {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
-  stopped_++;
-  cv_stopped_.NotifyOne();
+  NotifyStopped();
 
   while (IsArmed()) {
     cv_resume_.Wait(&mutex_);
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_SAFEPOINT_H_
 #define V8_HEAP_SAFEPOINT_H_
 
+#include <atomic>
+
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
@@ -50,12 +52,15 @@ class IsolateSafepoint final {
     base::ConditionVariable cv_stopped_;
     bool armed_;
 
-    size_t stopped_ = 0;
+    // Only modified while holding |mutex_|, but may be read without it.
+    std::atomic<size_t> stopped_{0};
 
     bool IsArmed() { return armed_; }
+    // Increments |stopped_| and wakes up the thread requesting the safepoint.
+    void NotifyStopped();
 
    public:
-    Barrier() : armed_(false), stopped_(0) {}
+    Barrier() : armed_(false) {}
 
     void Arm();
     void Disarm();
@@ -31,12 +31,21 @@ size_t Scavenger::PromotionList::Local::LocalPushSegmentSize() const {
          large_object_promotion_list_local_.PushSegmentSize();
 }
 
+void Scavenger::PromotionList::Local::PushLargeObjectChunk(HeapObject object,
+                                                           Map map, int size,
+                                                           int chunk_start,
+                                                           int chunk_end) {
+  large_object_promotion_list_local_.Push(
+      {object, map, size, chunk_start, chunk_end});
+}
+
 bool Scavenger::PromotionList::Local::Pop(struct PromotionListEntry* entry) {
   ObjectAndSize regular_object;
   if (regular_object_promotion_list_local_.Pop(&regular_object)) {
     entry->heap_object = regular_object.first;
     entry->size = regular_object.second;
     entry->map = entry->heap_object.map();
+    entry->chunk_start = entry->chunk_end = 0;
     return true;
   }
   return large_object_promotion_list_local_.Pop(entry);
@@ -101,6 +110,14 @@ bool Scavenger::MigrateObject(Map map, HeapObject source, HeapObject target,
     heap()->OnMoveEvent(target, source, size);
   }
 
+#ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+  if (!Heap::InYoungGeneration(target)) {
+    // Promoted objects bypass the allocator that maintains object starts.
+    MemoryChunk::FromHeapObject(target)->object_start_bitmap()->SetBit(
+        target.address());
+  }
+#endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+
   if (is_incremental_marking_ &&
       promotion_heap_choice != kPromoteIntoSharedHeap) {
     heap()->incremental_marking()->TransferColor(source, target);
@@ -206,6 +223,18 @@ SlotCallbackResult Scavenger::RememberedSetEntryNeeded(
                                                                   : REMOVE_SLOT;
 }
 
+void Scavenger::PushLargeFixedArrayChunks(HeapObject object, Map map,
+                                          int object_size) {
+  for (int start = FixedArray::kHeaderSize; start < object_size;
+       start += kLargeFixedArrayChunkSize) {
+    const int end = std::min(object_size, start + kLargeFixedArrayChunkSize);
+    promotion_list_local_.PushLargeObjectChunk(object, map, object_size, start,
+                                               end);
+  }
+  // Make the chunks available to other tasks right away.
+  promotion_list_local_.Publish();
+}
+
 bool Scavenger::HandleLargeObject(Map map, HeapObject object, int object_size,
                                   ObjectFields object_fields) {
   // TODO(hpayer): Make this check size based, i.e.
@@ -219,7 +248,13 @@ bool Scavenger::HandleLargeObject(Map map, HeapObject object, int object_size,
       surviving_new_large_objects_.insert({object, map});
       promoted_size_ += object_size;
       if (object_fields == ObjectFields::kMaybePointers) {
-        promotion_list_local_.PushLargeObject(object, map, object_size);
+        if (FLAG_scavenger_split_large_arrays &&
+            map.instance_type() == FIXED_ARRAY_TYPE &&
+            object_size >= 2 * kLargeFixedArrayChunkSize) {
+          PushLargeFixedArrayChunks(object, map, object_size);
+        } else {
+          promotion_list_local_.PushLargeObject(object, map, object_size);
+        }
       }
     }
     return true;
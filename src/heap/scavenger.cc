@@ -18,6 +18,7 @@
 #include "src/heap/memory-chunk-inl.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/remembered-set-inl.h"
 #include "src/heap/scavenger-inl.h"
 #include "src/heap/sweeper.h"
@@ -402,6 +403,10 @@ void ScavengerCollector::CollectGarbage() {
     if (V8_UNLIKELY(FLAG_always_use_string_forwarding_table)) {
       isolate_->string_forwarding_table()->UpdateAfterScavenge();
     }
+
+    if (heap_->pretenuring_sampler()) {
+      heap_->pretenuring_sampler()->UpdateAfterScavenge();
+    }
   }
 
   if (FLAG_concurrent_marking) {
@@ -437,6 +442,15 @@ void ScavengerCollector::CollectGarbage() {
       }
     }
 
+    // Scavenging only clears typed slots in place. Compact them on pages on
+    // which the sweeper can't clear invalid slots concurrently.
+    RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+        heap_, [](MemoryChunk* chunk) {
+          if (chunk->SweepingDone()) {
+            RememberedSet<OLD_TO_NEW>::CompactTyped(chunk);
+          }
+        });
+
 #ifdef DEBUG
     RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
         heap_, [](MemoryChunk* chunk) {
@@ -675,7 +689,13 @@ void Scavenger::Process(JobDelegate* delegate) {
     struct PromotionListEntry entry;
     while (promotion_list_local_.Pop(&entry)) {
       HeapObject target = entry.heap_object;
-      IterateAndScavengePromotedObject(target, entry.map, entry.size);
+      if (entry.chunk_end != 0) {
+        IterateAndScavengePromotedObjectChunk(target, entry.map,
+                                              entry.chunk_start,
+                                              entry.chunk_end);
+      } else {
+        IterateAndScavengePromotedObject(target, entry.map, entry.size);
+      }
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
         if (!promotion_list_local_.IsGlobalPoolEmpty()) {
@@ -686,6 +706,28 @@ void Scavenger::Process(JobDelegate* delegate) {
   } while (!done);
 }
 
+void Scavenger::IterateAndScavengePromotedObjectChunk(HeapObject target,
+                                                      Map map, int chunk_start,
+                                                      int chunk_end) {
+  DCHECK(BasicMemoryChunk::FromHeapObject(target)->IsLargePage());
+  DCHECK_EQ(FIXED_ARRAY_TYPE, map.instance_type());
+  DCHECK_LE(FixedArray::kHeaderSize, chunk_start);
+  DCHECK_LT(chunk_start, chunk_end);
+  // See IterateAndScavengePromotedObject() for why slots are only recorded
+  // for black objects.
+  const bool record_slots =
+      is_compacting_ &&
+      heap()->incremental_marking()->atomic_marking_state()->IsBlack(target);
+
+  IterateAndScavengePromotedObjectsVisitor visitor(this, record_slots);
+
+  // The header needs no visiting: the length is a Smi and the map word of a
+  // surviving new large object holds a forwarding pointer to itself, which
+  // VisitMapPointer() skips anyway.
+  visitor.VisitPointers(target, target.RawField(chunk_start),
+                        target.RawField(chunk_end));
+}
+
 void ScavengerCollector::ProcessWeakReferences(
     EphemeronTableList* ephemeron_table_list) {
   ScavengeWeakObjectRetainer weak_object_retainer;
@@ -42,6 +42,11 @@ class Scavenger {
     HeapObject heap_object;
     Map map;
     int size;
+    // For chunks of large arrays, the range [chunk_start, chunk_end) of the
+    // body that should be visited. Both are 0 if the whole object should be
+    // visited.
+    int chunk_start = 0;
+    int chunk_end = 0;
   };
 
   class PromotionList {
@@ -62,6 +67,8 @@ class Scavenger {
 
       inline void PushRegularObject(HeapObject object, int size);
       inline void PushLargeObject(HeapObject object, Map map, int size);
+      inline void PushLargeObjectChunk(HeapObject object, Map map, int size,
+                                       int chunk_start, int chunk_end);
       inline size_t LocalPushSegmentSize() const;
       inline bool Pop(struct PromotionListEntry* entry);
       inline bool IsGlobalPoolEmpty() const;
@@ -116,6 +123,8 @@ class Scavenger {
   // up other tasks.
   static const int kInterruptThreshold = 128;
   static const int kInitialLocalPretenuringFeedbackCapacity = 256;
+  // Size of the slot ranges surviving large FixedArrays are split into.
+  static const int kLargeFixedArrayChunkSize = kMaxRegularHeapObjectSize;
 
   inline Heap* heap() { return heap_; }
 
@@ -185,6 +194,12 @@ class Scavenger {
       ObjectFields object_fields);
 
   void IterateAndScavengePromotedObject(HeapObject target, Map map, int size);
+  void IterateAndScavengePromotedObjectChunk(HeapObject target, Map map,
+                                             int chunk_start, int chunk_end);
+  // Splits the body of a surviving large FixedArray into chunks that can be
+  // visited by several scavenger tasks in parallel.
+  inline void PushLargeFixedArrayChunks(HeapObject object, Map map,
+                                        int object_size);
   void RememberPromotedEphemeron(EphemeronHashTable table, int index);
 
   ScavengerCollector* const collector_;
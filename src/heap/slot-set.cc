@@ -4,6 +4,8 @@
 
 #include "src/heap/slot-set.h"
 
+#include <algorithm>
+
 #include "src/base/logging.h"
 #include "src/heap/memory-chunk-layout.h"
 
@@ -74,6 +76,62 @@ void TypedSlotSet::AssertNoInvalidSlots(const FreeRangesMap& invalid_ranges) {
       invalid_ranges);
 }
 
+size_t TypedSlotSet::Compact() {
+  size_t total = 0;
+  size_t live = 0;
+  for (Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) {
+    total += chunk->buffer.size();
+    for (TypedSlot slot : chunk->buffer) {
+      if (TypeField::decode(slot.type_and_offset) != SlotType::kCleared) live++;
+    }
+  }
+  if ((total - live) * kMinCompactionWasteFactor < total) return live;
+
+  std::vector<TypedSlot> slots;
+  slots.reserve(live);
+  Chunk* chunk = head_;
+  while (chunk != nullptr) {
+    for (TypedSlot slot : chunk->buffer) {
+      if (TypeField::decode(slot.type_and_offset) != SlotType::kCleared) {
+        slots.push_back(slot);
+      }
+    }
+    Chunk* next = chunk->next;
+    delete chunk;
+    chunk = next;
+  }
+  head_ = nullptr;
+  tail_ = nullptr;
+
+  // Sorting by offset makes subsequent iterations walk the page in address
+  // order.
+  std::sort(slots.begin(), slots.end(), [](TypedSlot a, TypedSlot b) {
+    uint32_t a_offset = OffsetField::decode(a.type_and_offset);
+    uint32_t b_offset = OffsetField::decode(b.type_and_offset);
+    if (a_offset != b_offset) return a_offset < b_offset;
+    return a.type_and_offset < b.type_and_offset;
+  });
+  slots.erase(std::unique(slots.begin(), slots.end(),
+                          [](TypedSlot a, TypedSlot b) {
+                            return a.type_and_offset == b.type_and_offset;
+                          }),
+              slots.end());
+
+  // Chunks are iterated starting from the head, so build the list back to
+  // front.
+  size_t end = slots.size();
+  while (end > 0) {
+    size_t begin = end > kMaxBufferSize ? end - kMaxBufferSize : 0;
+    size_t capacity = end - begin;
+    if (capacity < kInitialBufferSize) capacity = kInitialBufferSize;
+    head_ = NewChunk(head_, capacity);
+    head_->buffer.assign(slots.begin() + begin, slots.begin() + end);
+    if (tail_ == nullptr) tail_ = head_;
+    end = begin;
+  }
+  return slots.size();
+}
+
 template <typename Callback>
 void TypedSlotSet::IterateSlotsInRanges(Callback callback,
                                         const FreeRangesMap& ranges) {
@@ -646,8 +646,9 @@ enum class SlotType : uint8_t {
 // the maximum possible offset is limited by the LargePage::kMaxCodePageSize.
 // The implementation is a chain of chunks, where each chunk is an array of
 // encoded (slot type, slot offset) pairs.
-// There is no duplicate detection and we do not expect many duplicates because
-// typed slots contain V8 internal pointers that are not directly exposed to JS.
+// There is no duplicate detection on insertion and we do not expect many
+// duplicates because typed slots contain V8 internal pointers that are not
+// directly exposed to JS. Duplicates are dropped when the set is compacted.
 class V8_EXPORT_PRIVATE TypedSlots {
  public:
   static const int kMaxOffset = 1 << 29;
@@ -747,7 +748,19 @@ class V8_EXPORT_PRIVATE TypedSlotSet : public TypedSlots {
   // Frees empty chunks accumulated by PREFREE_EMPTY_CHUNKS.
   void FreeToBeFreedChunks();
 
+  // Drops cleared and duplicate slots and sorts the remaining ones by offset,
+  // if a sufficiently large fraction of the set consists of cleared slots.
+  // Iterating with KEEP_EMPTY_CHUNKS only clears removed slots in place, so
+  // they accumulate over several GCs otherwise.
+  // Returns the new number of slots. The set must not be accessed
+  // concurrently.
+  size_t Compact();
+
  private:
+  // Compact() only rebuilds the set if at least 1/kMinCompactionWasteFactor of
+  // its slots are cleared.
+  static const size_t kMinCompactionWasteFactor = 4;
+
   template <typename Callback>
   void IterateSlotsInRanges(Callback callback,
                             const FreeRangesMap& invalid_ranges);
@@ -1002,6 +1002,27 @@ void KeyedStoreGenericAssembler::EmitGenericPropertyStore(
       exit_point->Return(p->value());
 
       BIND(&add_dictionary_property_slow);
+      Label add_dictionary_property_runtime(this);
+      if (!V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+        // Grow the dictionary, or get rid of its deleted entries, without
+        // a runtime call. The empty dictionary stands in for the properties
+        // of objects that keep their identity hash in the properties field,
+        // so leave those to the runtime.
+        GotoIf(IsEmptyPropertyDictionary(properties),
+               &add_dictionary_property_runtime);
+        TNode<PropertyDictionary> new_properties =
+            RehashForAdd<PropertyDictionary>(properties,
+                                             &add_dictionary_property_runtime);
+        StoreObjectField(receiver, JSReceiver::kPropertiesOrHashOffset,
+                         new_properties);
+        Add<PropertyDictionary>(new_properties, name, p->value(),
+                                &add_dictionary_property_runtime);
+        exit_point->Return(p->value());
+      } else {
+        Goto(&add_dictionary_property_runtime);
+      }
+
+      BIND(&add_dictionary_property_runtime);
       exit_point->ReturnCallRuntime(Runtime::kAddDictionaryProperty,
                                     p->context(), p->receiver(), name,
                                     p->value());
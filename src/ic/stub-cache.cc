@@ -6,10 +6,12 @@
 
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
 #include "src/objects/tagged-value-inl.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
@@ -18,6 +20,12 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
+  AllocateTables(kPrimaryTableBits, kSecondaryTableBits);
+}
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
 }
 
 void StubCache::Initialize() {
@@ -26,6 +34,35 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_table_bits,
+                               int secondary_table_bits) {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+  primary_table_bits_ = primary_table_bits;
+  secondary_table_bits_ = secondary_table_bits;
+  primary_ = NewArray<Entry>(primary_table_size());
+  secondary_ = NewArray<Entry>(secondary_table_size());
+  primary_mask_ = (primary_table_size() - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size() - 1) << kCacheIndexShift;
+}
+
+void StubCache::ResizeIfNeeded() {
+  if (!FLAG_stub_cache_resizing) return;
+  int growth_bits = primary_table_bits_ - kPrimaryTableBits;
+  if (updates_since_clear_ > primary_table_size() &&
+      growth_bits < kMaxTableGrowthBits) {
+    growth_bits++;
+  } else if (updates_since_clear_ < primary_table_size() / 8 &&
+             growth_bits > 0) {
+    growth_bits--;
+  } else {
+    return;
+  }
+  AllocateTables(kPrimaryTableBits + growth_bits,
+                 kSecondaryTableBits + growth_bits);
+  isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
@@ -40,7 +77,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -52,7 +89,7 @@ int StubCache::SecondaryOffset(Name name, Map old_map) {
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryKeyShift);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -106,6 +143,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  updates_since_clear_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
@@ -125,15 +163,17 @@ MaybeObject StubCache::Get(Name name, Map map) {
 }
 
 void StubCache::Clear() {
+  ResizeIfNeeded();
+  updates_since_clear_ = 0;
   MaybeObject empty =
       MaybeObject::FromObject(isolate_->builtins()->code(Builtin::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
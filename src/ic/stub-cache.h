@@ -46,24 +46,33 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
   MaybeObject Get(Name name, Map map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). If the cache was
+  // updated often since the last Clear(), the tables are grown first, see
+  // ResizeIfNeeded().
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // The tables can be reallocated when they are resized, so generated code
+  // loads the current table and its offset mask through these references.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -76,6 +85,9 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int primary_table_size() const { return 1 << primary_table_bits_; }
+  int secondary_table_size() const { return 1 << secondary_table_bits_; }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,21 +97,25 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The initial sizes of the tables. With --stub-cache-resizing, both tables
+  // can grow by up to kMaxTableGrowthBits when the cache keeps missing.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kMaxTableGrowthBits = 3;
 
   // Used to introduce more entropy from the higher bits of the Map address.
   // This should fill in the masked out kCacheIndexShift-bits.
   static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
   static const int kSecondaryKeyShift = kSecondaryTableBits + kCacheIndexShift;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, Map map);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, Map map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -114,12 +130,19 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, Map map);
+  int SecondaryOffset(Name name, Map map);
+
+  // Grows the tables if there were more updates since the last Clear() than
+  // the primary table has entries, which means that the working set of the
+  // megamorphic sites does not fit, and shrinks them back again if the cache
+  // is hardly used any more.
+  void ResizeIfNeeded();
+  void AllocateTables(int primary_table_bits, int secondary_table_bits);
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +159,15 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_ = nullptr;
+  Entry* secondary_ = nullptr;
+  // The offset masks of the tables, i.e. (size - 1) << kCacheIndexShift.
+  uint32_t primary_mask_ = 0;
+  uint32_t secondary_mask_ = 0;
+  int primary_table_bits_ = 0;
+  int secondary_table_bits_ = 0;
+  // The number of Set() calls since the last Clear().
+  int updates_since_clear_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -12,6 +12,7 @@
 #include "src/codegen/compiler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
+#include "src/execution/context-cpu-time.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/microtask-queue.h"
 #include "src/execution/protectors.h"
@@ -6372,6 +6373,9 @@ Genesis::Genesis(
   native_context()->set_microtask_queue(
       isolate, microtask_queue ? static_cast<MicrotaskQueue*>(microtask_queue)
                                : isolate->default_microtask_queue());
+  if (isolate->context_cpu_time() && !isolate->serializer_enabled()) {
+    ContextCpuTime::AllocateStorage(isolate, native_context());
+  }
 
   // Install experimental natives. Do not include them into the
   // snapshot as we should be able to turn them off at runtime. Re-installing
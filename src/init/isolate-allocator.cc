@@ -56,23 +56,61 @@ struct PtrComprCageReservationParams
 };
 #endif  // V8_COMPRESS_POINTERS
 
+// static
+IsolateGroup* IsolateGroup::default_group_ = nullptr;
+
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
-namespace {
-DEFINE_LAZY_LEAKY_OBJECT_GETTER(VirtualMemoryCage, GetProcessWidePtrComprCage)
-}  // anonymous namespace
+bool IsolateGroup::InitReservation(
+    const VirtualMemoryCage::ReservationParams& params,
+    base::AddressRegion existing_reservation) {
+  if (!reservation_.InitReservation(params, existing_reservation)) {
+    return false;
+  }
+  // Reserve the first page of the cage, so that FromCageBase can find the
+  // group.
+  Address cage_base = reservation_.base();
+  base::BoundedPageAllocator* page_allocator = reservation_.page_allocator();
+  if (!page_allocator->AllocatePagesAt(cage_base,
+                                       page_allocator->AllocatePageSize(),
+                                       PageAllocator::kReadWrite)) {
+    reservation_.Free();
+    return false;
+  }
+  *reinterpret_cast<IsolateGroup**>(cage_base) = this;
+  return true;
+}
+
+std::shared_ptr<CodeRange> IsolateGroup::EnsureCodeRange(
+    size_t requested_size) {
+  base::MutexGuard guard(&code_range_mutex_);
+  std::shared_ptr<CodeRange> code_range = code_range_.lock();
+  if (!code_range) {
+    code_range = std::make_shared<CodeRange>();
+    if (!code_range->InitReservation(reservation_.page_allocator(),
+                                     requested_size)) {
+      V8::FatalProcessOutOfMemory(
+          nullptr, "Failed to reserve virtual memory for CodeRange");
+    }
+    code_range_ = code_range;
+  }
+  return code_range;
+}
 
 // static
-void IsolateAllocator::FreeProcessWidePtrComprCageForTesting() {
+void IsolateGroup::FreeDefaultPtrComprCageForTesting() {
   if (std::shared_ptr<CodeRange> code_range =
-          CodeRange::GetProcessWideCodeRange()) {
+          default_group_->GetCodeRange()) {
     code_range->Free();
   }
-  GetProcessWidePtrComprCage()->Free();
+  default_group_->reservation_.Free();
 }
 #endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
 
 // static
-void IsolateAllocator::InitializeOncePerProcess() {
+void IsolateGroup::InitializeOncePerProcess() {
+  // Tests free and reinitialize the cage of the default group, see
+  // FreeDefaultPtrComprCageForTesting.
+  if (default_group_ == nullptr) default_group_ = new IsolateGroup();
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
   PtrComprCageReservationParams params;
   base::AddressRegion existing_reservation;
@@ -101,8 +139,7 @@ void IsolateAllocator::InitializeOncePerProcess() {
     params.page_allocator = sandbox->page_allocator();
   }
 #endif
-  if (!GetProcessWidePtrComprCage()->InitReservation(params,
-                                                     existing_reservation)) {
+  if (!default_group_->InitReservation(params, existing_reservation)) {
     V8::FatalProcessOutOfMemory(
         nullptr,
         "Failed to reserve virtual memory for process-wide V8 "
@@ -111,7 +148,52 @@ void IsolateAllocator::InitializeOncePerProcess() {
 #endif
 }
 
-IsolateAllocator::IsolateAllocator() {
+// static
+bool IsolateGroup::CanCreateNewGroups() {
+#if defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE) && defined(V8_SANDBOX)
+  // Only the cage of the default group is placed in the sandbox.
+  return GetProcessWideSandbox()->is_disabled();
+#else
+  return COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL;
+#endif
+}
+
+// static
+IsolateGroup* IsolateGroup::New() {
+  CHECK(CanCreateNewGroups());
+  IsolateGroup* group = new IsolateGroup();
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  PtrComprCageReservationParams params;
+  if (!group->InitReservation(params, base::AddressRegion())) {
+    V8::FatalProcessOutOfMemory(
+        nullptr,
+        "Failed to reserve virtual memory for V8 pointer compression cage of "
+        "isolate group");
+  }
+#endif
+  return group;
+}
+
+void IsolateGroup::Release() {
+  DCHECK_LT(0, reference_count_.load(std::memory_order_relaxed));
+  if (reference_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    DCHECK_NE(this, default_group_);
+    delete this;
+  }
+}
+
+IsolateGroup::~IsolateGroup() {
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // The Isolates of the group, which were the last users of the CodeRange and
+  // the read-only heap, are gone.
+  DCHECK(code_range_.expired());
+  DCHECK(read_only_artifacts_.expired());
+  reservation_.Free();
+#endif
+}
+
+IsolateAllocator::IsolateAllocator(IsolateGroup* isolate_group)
+    : isolate_group_(isolate_group->Acquire()) {
 #if defined(V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE)
   PtrComprCageReservationParams params;
   if (!isolate_ptr_compr_cage_.InitReservation(params)) {
@@ -123,8 +205,8 @@ IsolateAllocator::IsolateAllocator() {
   CommitPagesForIsolate();
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
   // Allocate Isolate in C++ heap when sharing a cage.
-  CHECK(GetProcessWidePtrComprCage()->IsReserved());
-  page_allocator_ = GetProcessWidePtrComprCage()->page_allocator();
+  CHECK(isolate_group_->GetPtrComprCage()->IsReserved());
+  page_allocator_ = isolate_group_->GetPtrComprCage()->page_allocator();
   isolate_memory_ = ::operator new(sizeof(Isolate));
 #else
   // Allocate Isolate in C++ heap.
@@ -140,19 +222,21 @@ IsolateAllocator::~IsolateAllocator() {
   if (isolate_ptr_compr_cage_.reservation()->IsReserved()) {
     // The actual memory will be freed when the |isolate_ptr_compr_cage_| will
     // die.
+    isolate_group_->Release();
     return;
   }
 #endif
 
   // The memory was allocated in C++ heap.
   ::operator delete(isolate_memory_);
+  isolate_group_->Release();
 }
 
 VirtualMemoryCage* IsolateAllocator::GetPtrComprCage() {
 #if defined V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE
   return &isolate_ptr_compr_cage_;
 #elif defined V8_COMPRESS_POINTERS_IN_SHARED_CAGE
-  return GetProcessWidePtrComprCage();
+  return isolate_group_->GetPtrComprCage();
 #else
   return nullptr;
 #endif
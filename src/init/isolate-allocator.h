@@ -5,9 +5,11 @@
 #ifndef V8_INIT_ISOLATE_ALLOCATOR_H_
 #define V8_INIT_ISOLATE_ALLOCATOR_H_
 
+#include <atomic>
 #include <memory>
 
 #include "src/base/page-allocator.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
@@ -15,12 +17,113 @@
 namespace v8 {
 namespace internal {
 
+class CodeRange;
+class ReadOnlyArtifacts;
+class SoleReadOnlyHeap;
+
+// An IsolateGroup is a set of Isolates which share a pointer compression cage,
+// and with it the CodeRange, the read-only heap and a shared heap. Objects can
+// only be shared between Isolates of the same group, so a shared Isolate must
+// be in the group of its clients.
+//
+// With V8_COMPRESS_POINTERS_IN_SHARED_CAGE, every group reserves its own cage,
+// so that the heaps of all Isolates of a process together are not limited to
+// 4GB. Otherwise there is only the default group, which owns none of this
+// state.
+//
+// Groups are reference counted. Every Isolate and every v8::IsolateGroup holds
+// a reference, the default group is never freed.
+class V8_EXPORT_PRIVATE IsolateGroup final {
+ public:
+  IsolateGroup(const IsolateGroup&) = delete;
+  IsolateGroup& operator=(const IsolateGroup&) = delete;
+
+  static void InitializeOncePerProcess();
+
+  // Returns the group Isolates are created in if no group is given.
+  static IsolateGroup* GetDefault() { return default_group_; }
+
+  // Returns whether New() can be used, which is the case when pointers are
+  // compressed in a cage per group which does not need to be in the sandbox.
+  static bool CanCreateNewGroups();
+
+  // Reserves a new pointer compression cage for a new group. The caller owns
+  // the initial reference.
+  static IsolateGroup* New();
+
+  IsolateGroup* Acquire() {
+    reference_count_.fetch_add(1, std::memory_order_relaxed);
+    return this;
+  }
+  void Release();
+
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // Returns the group owning the cage starting at {cage_base}. The first page
+  // of every cage points to its group.
+  static IsolateGroup* FromCageBase(Address cage_base) {
+    return *reinterpret_cast<IsolateGroup**>(cage_base);
+  }
+
+  VirtualMemoryCage* GetPtrComprCage() { return &reservation_; }
+
+  // Returns the CodeRange of the group, reserving it with the
+  // {requested_size} if there is none yet.
+  std::shared_ptr<CodeRange> EnsureCodeRange(size_t requested_size);
+  // Returns the CodeRange of the group, or an empty std::shared_ptr if
+  // EnsureCodeRange has not been called or all Isolates using it are gone.
+  std::shared_ptr<CodeRange> GetCodeRange() const {
+    return code_range_.lock();
+  }
+
+  // The artifacts of the read-only heap shared by the Isolates of the group,
+  // see ReadOnlyHeap::SetUp.
+  std::weak_ptr<ReadOnlyArtifacts>* read_only_artifacts() {
+    return &read_only_artifacts_;
+  }
+  SoleReadOnlyHeap* shared_read_only_heap() const {
+    return shared_read_only_heap_;
+  }
+  void set_shared_read_only_heap(SoleReadOnlyHeap* ro_heap) {
+    shared_read_only_heap_ = ro_heap;
+  }
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
+ private:
+  friend class SequentialUnmapperTest;
+
+  IsolateGroup() = default;
+  ~IsolateGroup();
+
+  // Only used for testing.
+  static void FreeDefaultPtrComprCageForTesting();
+
+#ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+  // Reserves the cage of the group, or takes over the {existing_reservation}
+  // if it is not empty, and reserves the first page to point to the group.
+  bool InitReservation(const VirtualMemoryCage::ReservationParams& params,
+                       base::AddressRegion existing_reservation);
+
+  VirtualMemoryCage reservation_;
+  // Protects creating the CodeRange.
+  base::Mutex code_range_mutex_;
+  // Only the Isolates of the group keep the CodeRange and the read-only
+  // artifacts alive, so that they are freed when no Isolates remain.
+  std::weak_ptr<CodeRange> code_range_;
+  std::weak_ptr<ReadOnlyArtifacts> read_only_artifacts_;
+  SoleReadOnlyHeap* shared_read_only_heap_ = nullptr;
+#endif  // V8_COMPRESS_POINTERS_IN_SHARED_CAGE
+
+  std::atomic<size_t> reference_count_{1};
+
+  static IsolateGroup* default_group_;
+};
+
 // IsolateAllocator object is responsible for allocating memory for one (!)
 // Isolate object. Depending on the whether pointer compression is enabled,
 // the memory can be allocated
 //
 // 1) in the C++ heap (when pointer compression is disabled or when multiple
-// Isolates share a pointer compression cage)
+// Isolates share the pointer compression cage of their IsolateGroup)
 //
 // 2) in a proper part of a properly aligned region of a reserved address space
 //   (when pointer compression is enabled and each Isolate has its own pointer
@@ -33,7 +136,7 @@ namespace internal {
 // Isolate::Delete() takes care of the proper order of the objects destruction.
 class V8_EXPORT_PRIVATE IsolateAllocator final {
  public:
-  IsolateAllocator();
+  explicit IsolateAllocator(IsolateGroup* isolate_group);
   ~IsolateAllocator();
   IsolateAllocator(const IsolateAllocator&) = delete;
   IsolateAllocator& operator=(const IsolateAllocator&) = delete;
@@ -42,6 +145,8 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
 
   v8::PageAllocator* page_allocator() const { return page_allocator_; }
 
+  IsolateGroup* isolate_group() const { return isolate_group_; }
+
   Address GetPtrComprCageBase() const {
     return COMPRESS_POINTERS_BOOL ? GetPtrComprCage()->base() : kNullAddress;
   }
@@ -51,18 +156,14 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
   VirtualMemoryCage* GetPtrComprCage();
   const VirtualMemoryCage* GetPtrComprCage() const;
 
-  static void InitializeOncePerProcess();
-
  private:
   void CommitPagesForIsolate();
 
-  friend class SequentialUnmapperTest;
-  // Only used for testing.
-  static void FreeProcessWidePtrComprCageForTesting();
-
   // The allocated memory for Isolate instance.
   void* isolate_memory_ = nullptr;
   v8::PageAllocator* page_allocator_ = nullptr;
+  // The IsolateAllocator holds a reference to the group.
+  IsolateGroup* const isolate_group_;
 #ifdef V8_COMPRESS_POINTERS_IN_ISOLATE_CAGE
   VirtualMemoryCage isolate_ptr_compr_cage_;
 #endif
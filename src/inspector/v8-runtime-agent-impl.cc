@@ -57,6 +57,8 @@ namespace v8_inspector {
 namespace V8RuntimeAgentImplState {
 static const char customObjectFormatterEnabled[] =
     "customObjectFormatterEnabled";
+static const char consoleMessagePreviewsEnabled[] =
+    "consoleMessagePreviewsEnabled";
 static const char maxCallStackSizeToCapture[] = "maxCallStackSizeToCapture";
 static const char runtimeEnabled[] = "runtimeEnabled";
 static const char bindings[] = "bindings";
@@ -500,6 +502,12 @@ Response V8RuntimeAgentImpl::setCustomObjectFormatterEnabled(bool enabled) {
   return Response::Success();
 }
 
+Response V8RuntimeAgentImpl::setConsoleMessagePreviewsEnabled(bool enabled) {
+  m_state->setBoolean(V8RuntimeAgentImplState::consoleMessagePreviewsEnabled,
+                      enabled);
+  return Response::Success();
+}
+
 Response V8RuntimeAgentImpl::setMaxCallStackSizeToCapture(int size) {
   if (size < 0) {
     return Response::ServerError(
@@ -986,7 +994,11 @@ void V8RuntimeAgentImpl::inspect(
 }
 
 void V8RuntimeAgentImpl::messageAdded(V8ConsoleMessage* message) {
-  if (m_enabled) reportMessage(message, true);
+  if (!m_enabled) return;
+  reportMessage(message,
+                m_state->booleanProperty(
+                    V8RuntimeAgentImplState::consoleMessagePreviewsEnabled,
+                    true));
 }
 
 bool V8RuntimeAgentImpl::reportMessage(V8ConsoleMessage* message,
@@ -119,6 +119,30 @@ uint32_t BytecodeArrayIterator::GetRegisterCountOperand(
   return GetUnsignedOperand(operand_index, OperandType::kRegCount);
 }
 
+void BytecodeArrayIterator::SetRegisterCountOperand(int operand_index,
+                                                    uint32_t count) {
+  DCHECK_LE(count, GetRegisterCountOperand(operand_index));
+  Address operand_start =
+      reinterpret_cast<Address>(cursor_) +
+      Bytecodes::GetOperandOffset(current_bytecode(), operand_index,
+                                  current_operand_scale());
+  switch (Bytecodes::SizeOfOperand(OperandType::kRegCount,
+                                   current_operand_scale())) {
+    case OperandSize::kByte:
+      *reinterpret_cast<uint8_t*>(operand_start) = static_cast<uint8_t>(count);
+      break;
+    case OperandSize::kShort:
+      base::WriteUnalignedValue<uint16_t>(operand_start,
+                                          static_cast<uint16_t>(count));
+      break;
+    case OperandSize::kQuad:
+      base::WriteUnalignedValue<uint32_t>(operand_start, count);
+      break;
+    case OperandSize::kNone:
+      UNREACHABLE();
+  }
+}
+
 uint32_t BytecodeArrayIterator::GetIndexOperand(int operand_index) const {
   OperandType operand_type =
       Bytecodes::GetOperandType(current_bytecode(), operand_index);
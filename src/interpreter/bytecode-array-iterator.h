@@ -116,6 +116,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayIterator {
   Register GetReceiver() const;
   Register GetParameter(int parameter_index) const;
   uint32_t GetRegisterCountOperand(int operand_index) const;
+  // Overwrites a register count operand in place with a count which is not
+  // larger than the current one, keeping the operand size.
+  void SetRegisterCountOperand(int operand_index, uint32_t count);
   Register GetRegisterOperand(int operand_index) const;
   std::pair<Register, Register> GetRegisterPairOperand(int operand_index) const;
   RegisterList GetRegisterListOperand(int operand_index) const;
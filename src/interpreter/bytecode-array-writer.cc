@@ -12,7 +12,9 @@
 #include "src/interpreter/bytecode-register.h"
 #include "src/interpreter/bytecode-source-info.h"
 #include "src/interpreter/constant-array-builder.h"
+#include "src/interpreter/constant-pool-cache.h"
 #include "src/interpreter/handler-table-builder.h"
+#include "src/interpreter/interpreter.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -47,6 +49,15 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
   int frame_size = register_count * kSystemPointerSize;
   Handle<FixedArray> constant_pool =
       constant_array_builder()->ToFixedArray(isolate);
+  if constexpr (std::is_same_v<IsolateT, Isolate>) {
+    // Off-thread compiles allocate in a local heap, so only constant pools
+    // created on the main thread are shared.
+    if (FLAG_ignition_share_constant_pools) {
+      constant_pool =
+          isolate->interpreter()->constant_pool_cache()->Canonicalize(
+              constant_pool);
+    }
+  }
   Handle<BytecodeArray> bytecode_array = isolate->factory()->NewBytecodeArray(
       bytecode_size, &bytecodes()->front(), frame_size, parameter_count,
       constant_pool);
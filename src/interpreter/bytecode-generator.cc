@@ -18,7 +18,9 @@
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/globals.h"
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
+#include "src/compiler/bytecode-analysis.h"
 #include "src/heap/parked-scope.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/interpreter/bytecode-jump-table.h"
 #include "src/interpreter/bytecode-label.h"
@@ -1228,9 +1230,42 @@ Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(
         incoming_new_target_or_generator_);
   }
 
+  if (FLAG_ignition_trim_generator_registers && suspend_count_ > 0) {
+    TrimSuspendedRegisterLists(bytecode_array);
+  }
+
   return bytecode_array;
 }
 
+void BytecodeGenerator::TrimSuspendedRegisterLists(
+    Handle<BytecodeArray> bytecode_array) {
+  // The register lists of suspend points include all registers which are
+  // allocated at that point. Shrink them to end at the last register which is
+  // live across the suspend point, so that the interpreter and baseline code
+  // don't copy dead registers at the end of the register file. TurboFan
+  // already uses the liveness to skip dead registers.
+  compiler::BytecodeAnalysis analysis(bytecode_array, zone(),
+                                      BytecodeOffset::None(), true);
+  for (BytecodeArrayIterator iterator(bytecode_array); !iterator.done();
+       iterator.Advance()) {
+    const compiler::BytecodeLivenessState* liveness;
+    if (iterator.current_bytecode() == Bytecode::kSuspendGenerator) {
+      liveness = analysis.GetInLivenessFor(iterator.current_offset());
+    } else if (iterator.current_bytecode() == Bytecode::kResumeGenerator) {
+      liveness = analysis.GetOutLivenessFor(iterator.current_offset());
+    } else {
+      continue;
+    }
+    DCHECK_EQ(0, iterator.GetRegisterOperand(1).index());
+    uint32_t register_count = iterator.GetRegisterCountOperand(2);
+    while (register_count > 0 &&
+           !liveness->RegisterIsLive(register_count - 1)) {
+      register_count--;
+    }
+    iterator.SetRegisterCountOperand(2, register_count);
+  }
+}
+
 template Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(
     Isolate* isolate, Handle<Script> script);
 template Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(
@@ -1459,8 +1494,15 @@ void BytecodeGenerator::GenerateBytecodeBody() {
     }
 
     if (literal->requires_instance_members_initializer()) {
-      BuildInstanceMemberInitialization(Register::function_closure(),
-                                        builder()->Receiver());
+      // Block coverage counts the invocations of the initializer function.
+      if (literal->inlined_instance_fields() != nullptr &&
+          block_coverage_builder_ == nullptr) {
+        BuildInlinedInstanceFields(literal->inlined_instance_fields(),
+                                   builder()->Receiver());
+      } else {
+        BuildInstanceMemberInitialization(Register::function_closure(),
+                                          builder()->Receiver());
+      }
     }
   }
 
@@ -2954,6 +2996,23 @@ void BytecodeGenerator::BuildInstanceMemberInitialization(Register constructor,
       .Bind(&done);
 }
 
+void BytecodeGenerator::BuildInlinedInstanceFields(
+    const ZonePtrList<ClassLiteral::Property>* fields, Register instance) {
+  // Same stores as in BuildClassProperty, but without source positions since
+  // the fields are outside of the constructor's source range.
+  for (ClassLiteral::Property* field : *fields) {
+    DCHECK(!field->is_private());
+    DCHECK(!field->is_computed_name());
+    DCHECK(field->key()->IsPropertyName());
+    DCHECK(field->value()->IsLiteral());
+    VisitForAccumulatorValue(field->value());
+    FeedbackSlot slot = feedback_spec()->AddDefineNamedOwnICSlot();
+    builder()->DefineNamedOwnProperty(
+        instance, field->key()->AsLiteral()->AsRawPropertyName(),
+        feedback_index(slot));
+  }
+}
+
 void BytecodeGenerator::VisitNativeFunctionLiteral(
     NativeFunctionLiteral* expr) {
   size_t entry = builder()->AllocateDeferredConstantPoolEntry();
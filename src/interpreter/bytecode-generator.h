@@ -338,6 +338,9 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
   void BuildPrivateBrandInitialization(Register receiver, Variable* brand);
   void BuildInstanceMemberInitialization(Register constructor,
                                          Register instance);
+  void TrimSuspendedRegisterLists(Handle<BytecodeArray> bytecode_array);
+  void BuildInlinedInstanceFields(
+      const ZonePtrList<ClassLiteral::Property>* fields, Register instance);
   void BuildGeneratorObjectVariableInitialization();
   void VisitBlockDeclarationsAndStatements(Block* stmt);
   void VisitLiteralAccessor(LiteralProperty* property, Register value_out);
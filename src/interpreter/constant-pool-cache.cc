@@ -0,0 +1,122 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/interpreter/constant-pool-cache.h"
+
+#include <algorithm>
+
+#include "src/base/functional.h"
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles.h"
+#include "src/heap/read-only-heap.h"
+#include "src/logging/counters.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace interpreter {
+
+namespace {
+
+// Computes a hash of {object} which does not depend on its address, if
+// possible.
+bool HashElement(Object object, size_t* hash) {
+  if (object.IsSmi()) {
+    *hash = base::hash_value(Smi::ToInt(object));
+    return true;
+  }
+  HeapObject heap_object = HeapObject::cast(object);
+  if (ReadOnlyHeap::Contains(heap_object)) {
+    *hash = base::hash_value(heap_object.ptr());
+    return true;
+  }
+  if (heap_object.IsHeapNumber()) {
+    *hash = base::hash_value(
+        HeapNumber::cast(heap_object).value_as_bits(kRelaxedLoad));
+    return true;
+  }
+  if (heap_object.IsInternalizedString()) {
+    *hash = String::cast(heap_object).EnsureHash();
+    return true;
+  }
+  return false;
+}
+
+bool ComputeHash(FixedArray array, size_t* hash) {
+  size_t seed = base::hash_value(array.length());
+  for (int i = 0; i < array.length(); ++i) {
+    size_t element_hash;
+    if (!HashElement(array.get(i), &element_hash)) return false;
+    seed = base::hash_combine(seed, element_hash);
+  }
+  *hash = seed;
+  return true;
+}
+
+// Both arrays only hold elements accepted by {HashElement}.
+bool ElementsEqual(FixedArray a, FixedArray b) {
+  if (a.length() != b.length()) return false;
+  for (int i = 0; i < a.length(); ++i) {
+    Object x = a.get(i);
+    Object y = b.get(i);
+    if (x == y) continue;
+    // Equal numbers are distinct HeapNumbers in different constant pools.
+    if (!x.IsHeapNumber() || !y.IsHeapNumber() ||
+        HeapNumber::cast(x).value_as_bits(kRelaxedLoad) !=
+            HeapNumber::cast(y).value_as_bits(kRelaxedLoad)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+ConstantPoolCache::~ConstantPoolCache() {
+  for (auto& entry : entries_) {
+    if (entry.second != nullptr) GlobalHandles::Destroy(entry.second);
+  }
+}
+
+Handle<FixedArray> ConstantPoolCache::Canonicalize(
+    Handle<FixedArray> constant_pool) {
+  if (constant_pool->length() == 0) return constant_pool;
+  size_t hash;
+  if (!ComputeHash(*constant_pool, &hash)) return constant_pool;
+
+  auto range = entries_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == nullptr) continue;
+    FixedArray cached = FixedArray::cast(Object(*it->second));
+    if (ElementsEqual(cached, *constant_pool)) {
+      isolate_->counters()->shared_constant_pools()->Increment();
+      return handle(cached, isolate_);
+    }
+  }
+
+  if (entries_.size() >= sweep_threshold_) {
+    RemoveClearedEntries();
+    sweep_threshold_ = std::max(kInitialSweepThreshold, 2 * entries_.size());
+  }
+  auto it = entries_.emplace(hash, nullptr);
+  it->second = isolate_->global_handles()->Create(*constant_pool).location();
+  GlobalHandles::MakeWeak(&it->second);
+  return constant_pool;
+}
+
+void ConstantPoolCache::RemoveClearedEntries() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second == nullptr) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,58 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INTERPRETER_CONSTANT_POOL_CACHE_H_
+#define V8_INTERPRETER_CONSTANT_POOL_CACHE_H_
+
+#include <unordered_map>
+
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class FixedArray;
+class Isolate;
+
+namespace interpreter {
+
+// Shares constant pools with identical contents between bytecode arrays of
+// the isolate. Small functions of a script often reference the same property
+// names and numbers only, and would otherwise each get their own copy.
+//
+// Only constant pools holding Smis, HeapNumbers, internalized strings and
+// read-only objects are shared, since their hashes do not depend on addresses
+// of movable objects. The cache holds its constant pools weakly.
+class ConstantPoolCache final {
+ public:
+  explicit ConstantPoolCache(Isolate* isolate) : isolate_(isolate) {}
+  ~ConstantPoolCache();
+  ConstantPoolCache(const ConstantPoolCache&) = delete;
+  ConstantPoolCache& operator=(const ConstantPoolCache&) = delete;
+
+  // Returns a cached constant pool with the same contents as {constant_pool}
+  // if there is one. Otherwise adds {constant_pool} to the cache, if it can
+  // be shared, and returns it.
+  Handle<FixedArray> Canonicalize(Handle<FixedArray> constant_pool);
+
+ private:
+  static constexpr size_t kInitialSweepThreshold = 256;
+
+  // Removes the entries whose constant pools died.
+  void RemoveClearedEntries();
+
+  Isolate* const isolate_;
+  // Maps the content hash of each cached constant pool to the location of a
+  // weak global handle to it, which the GC clears when the constant pool
+  // dies. Nodes of the map are stable, so the GC may refer to the values.
+  std::unordered_multimap<size_t, Address*> entries_;
+  // Cleared entries are removed once the cache grows beyond this size.
+  size_t sweep_threshold_ = kInitialSweepThreshold;
+};
+
+}  // namespace interpreter
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INTERPRETER_CONSTANT_POOL_CACHE_H_
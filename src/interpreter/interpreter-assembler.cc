@@ -1198,6 +1198,60 @@ void InterpreterAssembler::StarDispatchLookahead(TNode<WordT> target_bytecode) {
   BIND(&done);
 }
 
+void InterpreterAssembler::JumpIfDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Only the single-width forms are fused; a wide jump is prefixed with kWide
+  // and a jump patched by the debugger reads as kDebugBreak, neither of which
+  // matches here.
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIf(Bytecode::kJumpIfTrue);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIf(Bytecode::kJumpIfFalse);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIf(Bytecode jump_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  // Build the jump as its own handler would, so that its operand is read
+  // relative to the current BytecodeOffset() and both outcomes dispatch
+  // directly to their successor.
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator,
+                    jump_bytecode == Bytecode::kJumpIfTrue ? TrueConstant()
+                                                           : FalseConstant(),
+                    0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   Bytecode previous_bytecode = bytecode_;
   ImplicitRegisterUse previous_acc_use = implicit_register_use_;
@@ -1227,6 +1281,9 @@ void InterpreterAssembler::Dispatch() {
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
   TNode<IntPtrT> target_offset = Advance();
   TNode<WordT> target_bytecode = LoadBytecode(target_offset);
+  if (Bytecodes::IsJumpIfLookahead(bytecode_, operand_scale_)) {
+    JumpIfDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecodeWithOptionalStarLookahead(target_bytecode);
 }
 
@@ -419,6 +419,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for a single-width JumpIfTrue or JumpIfFalse and inline it in a
+  // branch, including the dispatch to either successor. Anything after this
+  // point can assume that the following instruction was not such a jump.
+  void JumpIfDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| at the current BytecodeOffset(), ending in
+  // a dispatch to the jump target or to the following bytecode.
+  void InlineJumpIf(Bytecode jump_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -1628,6 +1628,7 @@ class InterpreterCompareOpAssembler : public InterpreterAssembler {
       default:
         UNREACHABLE();
     }
+    CombineCompareOutcomeFeedback(&var_type_feedback, result);
 
     TNode<UintPtrT> slot_index = BytecodeOperandIdx(1);
     TNode<HeapObject> maybe_feedback_vector = LoadFeedbackVector();
@@ -19,6 +19,7 @@
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
+#include "src/interpreter/constant-pool-cache.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -68,7 +69,8 @@ class InterpreterCompilationJob final : public UnoptimizedCompilationJob {
 
 Interpreter::Interpreter(Isolate* isolate)
     : isolate_(isolate),
-      interpreter_entry_trampoline_instruction_start_(kNullAddress) {
+      interpreter_entry_trampoline_instruction_start_(kNullAddress),
+      constant_pool_cache_(std::make_unique<ConstantPoolCache>(isolate)) {
   memset(dispatch_table_, 0, sizeof(dispatch_table_));
 
   if (V8_IGNITION_DISPATCH_COUNTING_BOOL) {
@@ -76,6 +78,8 @@ Interpreter::Interpreter(Isolate* isolate)
   }
 }
 
+Interpreter::~Interpreter() = default;
+
 void Interpreter::InitDispatchCounters() {
   static const int kBytecodeCount = static_cast<int>(Bytecode::kLast) + 1;
   bytecode_dispatch_counters_table_.reset(
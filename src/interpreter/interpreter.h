@@ -33,12 +33,13 @@ class ZoneVector;
 
 namespace interpreter {
 
+class ConstantPoolCache;
 class InterpreterAssembler;
 
 class Interpreter {
  public:
   explicit Interpreter(Isolate* isolate);
-  virtual ~Interpreter() = default;
+  virtual ~Interpreter();
   Interpreter(const Interpreter&) = delete;
   Interpreter& operator=(const Interpreter&) = delete;
 
@@ -93,6 +94,12 @@ class Interpreter {
         &interpreter_entry_trampoline_instruction_start_);
   }
 
+  // Shares constant pools between bytecode arrays, see
+  // --ignition-share-constant-pools.
+  ConstantPoolCache* constant_pool_cache() {
+    return constant_pool_cache_.get();
+  }
+
  private:
   friend class SetupInterpreter;
   friend class v8::internal::SetupIsolateDelegate;
@@ -114,6 +121,7 @@ class Interpreter {
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
   Address interpreter_entry_trampoline_instruction_start_;
+  std::unique_ptr<ConstantPoolCache> constant_pool_cache_;
 };
 
 #ifdef V8_IGNITION_DISPATCH_COUNTING
@@ -9,6 +9,8 @@
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
+#include "src/heap/pretenuring-sampler.h"
+#include "src/json/json-scanner-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/field-type.h"
@@ -209,7 +211,8 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
     : isolate_(isolate),
       hash_seed_(HashSeed(isolate)),
       object_constructor_(isolate_->object_function()),
-      original_source_(source) {
+      original_source_(source),
+      object_map_cache_(isolate->factory()->empty_fixed_array()) {
   size_t start = 0;
   size_t length = source->length();
   PtrComprCageBase cage_base(isolate);
@@ -324,6 +327,8 @@ JsonParser<Char>::~JsonParser() {
 
 template <typename Char>
 MaybeHandle<Object> JsonParser<Char>::ParseJson() {
+  AllocationSourceScope allocation_source(isolate_->heap(),
+                                          AllocationSource::kJsonParse);
   MaybeHandle<Object> result = ParseJsonValue();
   if (!Check(JsonToken::EOS)) ReportUnexpectedToken(peek());
   if (isolate_->has_pending_exception()) return MaybeHandle<Object>();
@@ -416,6 +421,64 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::CachedObjectMap(
+    const JsonContinuation& cont,
+    const SmallVector<JsonProperty>& property_stack) {
+  const JsonString* first_key = nullptr;
+  for (size_t i = cont.index; i < property_stack.size(); ++i) {
+    if (!property_stack[i].string.is_index()) {
+      first_key = &property_stack[i].string;
+      break;
+    }
+  }
+  if (first_key == nullptr || first_key->has_escape()) return Handle<Map>();
+
+  Map map;
+  {
+    DisallowGarbageCollection no_gc;
+    base::Vector<const Char> data(chars_ + first_key->start(),
+                                  first_key->length());
+    for (int i = 0; i < object_map_cache_->length(); ++i) {
+      Object entry = object_map_cache_->get(i);
+      if (!entry.IsMap()) break;
+      Map candidate = Map::cast(entry);
+      String key = String::cast(
+          candidate.instance_descriptors(isolate_).GetKey(InternalIndex(0)));
+      if (key.IsEqualTo(data)) {
+        map = candidate;
+        break;
+      }
+    }
+    // Don't consume feedback from maps that have been detached from the
+    // transition tree since.
+    if (map.is_null() || map.IsDetached(isolate_)) return Handle<Map>();
+  }
+  Handle<Map> result = handle(map, isolate_);
+  if (result->is_deprecated()) result = Map::Update(isolate_, result);
+  return result;
+}
+
+template <typename Char>
+void JsonParser<Char>::CacheObjectMap(Handle<Map> map) {
+  if (map->is_dictionary_map() || map->NumberOfOwnDescriptors() == 0) return;
+  if (object_map_cache_->length() == 0) {
+    object_map_cache_.PatchValue(
+        *factory()->NewFixedArray(kObjectMapCacheSize));
+  }
+  DisallowGarbageCollection no_gc;
+  FixedArray cache = *object_map_cache_;
+  // Move the map to the front, dropping the least recent one if it was not
+  // in the cache yet.
+  int i = 0;
+  while (i < kObjectMapCacheSize - 1 && cache.get(i) != *map &&
+         cache.get(i).IsMap()) {
+    ++i;
+  }
+  for (; i > 0; --i) cache.set(i, cache.get(i - 1));
+  cache.set(0, *map);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -853,7 +916,11 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
               }
             }
           }
+          if (feedback.is_null()) {
+            feedback = CachedObjectMap(cont, property_stack);
+          }
           value = BuildJsonObject(cont, property_stack, feedback);
+          CacheObjectMap(handle(JSObject::cast(*value).map(), isolate_));
           property_stack.resize_no_init(cont.index);
           Expect(JsonToken::RBRACE);
 
@@ -892,6 +959,46 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
   }
 }
 
+namespace {
+
+// Computes the value of a number that consists of an optional minus sign,
+// decimal digits and at most one decimal point, if it fits into the
+// significand of a double. Dividing that significand by the exactly
+// representable power of ten then gives the correctly rounded result.
+template <typename Char>
+bool TryParseShortDecimal(base::Vector<const Char> chars, double* result) {
+  static constexpr int kMaxDigits = 15;
+  static constexpr double kPowersOfTen[kMaxDigits + 1] = {
+      1e0, 1e1, 1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+      1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+  STATIC_ASSERT(kPowersOfTen[kMaxDigits] < kMaxSafeInteger);
+
+  const Char* cursor = chars.begin();
+  const Char* end = chars.end();
+  const bool negative = *cursor == '-';
+  if (negative) cursor++;
+  int64_t significand = 0;
+  int digits = 0;
+  int fraction_digits = 0;
+  bool in_fraction = false;
+  for (; cursor != end; cursor++) {
+    if (*cursor == '.') {
+      in_fraction = true;
+      continue;
+    }
+    DCHECK(IsDecimalDigit(*cursor));
+    if (++digits > kMaxDigits) return false;
+    significand = significand * 10 + (*cursor - '0');
+    if (in_fraction) fraction_digits++;
+  }
+  double value =
+      static_cast<double>(significand) / kPowersOfTen[fraction_digits];
+  *result = negative ? -value : value;
+  return true;
+}
+
+}  // namespace
+
 template <typename Char>
 void JsonParser<Char>::AdvanceToNonDecimal() {
   cursor_ =
@@ -965,7 +1072,9 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
       AdvanceToNonDecimal();
     }
 
+    bool has_exponent = false;
     if (AsciiAlphaToLower(CurrentCharacter()) == 'e') {
+      has_exponent = true;
       c = NextCharacter();
       if (c == '-' || c == '+') c = NextCharacter();
       if (!IsDecimalDigit(c)) {
@@ -977,10 +1086,12 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
     }
 
     base::Vector<const Char> chars(start, cursor_ - start);
-    number =
-        StringToDouble(chars,
-                       NO_CONVERSION_FLAGS,  // Hex, octal or trailing junk.
-                       std::numeric_limits<double>::quiet_NaN());
+    if (has_exponent || !TryParseShortDecimal(chars, &number)) {
+      number =
+          StringToDouble(chars,
+                         NO_CONVERSION_FLAGS,  // Hex, octal or trailing junk.
+                         std::numeric_limits<double>::quiet_NaN());
+    }
 
     DCHECK(!std::isnan(number));
   }
@@ -1127,6 +1238,13 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = SkipJsonStringCharacters(cursor_, end_);
+    } else {
+      // Latin-1 characters ORed into {bits} don't change the outcome of the
+      // comparisons with kMaxChar below.
+      cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
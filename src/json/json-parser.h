@@ -297,6 +297,13 @@ class JsonParser final {
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
+  // Returns the map of an object built earlier in this parse whose first
+  // named property has the same key as the object in {property_stack}, or
+  // a null handle. It serves as feedback where no previous array element
+  // provides any, e.g. for objects nested in array elements.
+  Handle<Map> CachedObjectMap(const JsonContinuation& cont,
+                              const SmallVector<JsonProperty>& property_stack);
+  void CacheObjectMap(Handle<Map> map);
   Handle<Object> BuildJsonArray(
       const JsonContinuation& cont,
       const SmallVector<Handle<Object>>& element_stack);
@@ -311,6 +318,7 @@ class JsonParser final {
   inline Handle<JSFunction> object_constructor() { return object_constructor_; }
 
   static const int kInitialSpecialStringLength = 32;
+  static const int kObjectMapCacheSize = 8;
 
   static void UpdatePointersCallback(void* parser) {
     reinterpret_cast<JsonParser<Char>*>(parser)->UpdatePointers();
@@ -346,6 +354,9 @@ class JsonParser final {
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
   Handle<String> source_;
+  // The maps of the most recently built objects, most recent first. Empty
+  // until the first object is built.
+  Handle<FixedArray> object_map_cache_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
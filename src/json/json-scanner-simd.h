@@ -0,0 +1,221 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_SCANNER_SIMD_H_
+#define V8_JSON_JSON_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Skips the plain characters of a JSON string literal in blocks of 32 bytes.
+// Returns the first character in [begin, end) that is a quote, a backslash or
+// a control character below 0x20, or a position less than 32 bytes before
+// |end| from which the caller has to continue with scalar checks.
+V8_INLINE const uint8_t* SkipJsonStringCharacters(const uint8_t* begin,
+                                                  const uint8_t* end) {
+  const uint8_t* cursor = begin;
+#if V8_HOST_HAS_SSE2
+  constexpr int kLanes = sizeof(__m128i) / sizeof(uint8_t);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i control_bits = _mm_set1_epi8(static_cast<char>(0xE0));
+  const __m128i zero = _mm_setzero_si128();
+  auto special = [&](const uint8_t* at) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+    __m128i found = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                     _mm_cmpeq_epi8(chars, backslash)),
+        _mm_cmpeq_epi8(_mm_and_si128(chars, control_bits), zero));
+    return static_cast<uint32_t>(_mm_movemask_epi8(found));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint32_t mask = special(cursor) | (special(cursor + kLanes) << kLanes);
+    if (mask != 0) return cursor + base::bits::CountTrailingZeros(mask);
+  }
+#elif V8_HOST_HAS_NEON
+  constexpr int kLanes = sizeof(uint8x16_t) / sizeof(uint8_t);
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t control_limit = vdupq_n_u8(0x20);
+  auto special = [&](const uint8_t* at) {
+    uint8x16_t chars = vld1q_u8(at);
+    return vorrq_u8(
+        vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+        vcltq_u8(chars, control_limit));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint8x16_t lo = special(cursor);
+    uint8x16_t hi = special(cursor + kLanes);
+    if (vmaxvq_u8(vorrq_u8(lo, hi)) == 0) continue;
+    // Shift each 16-bit lane right by 4 and narrow it, which leaves four mask
+    // bits per byte lane.
+    uint64_t lo_mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(lo), 4)), 0);
+    if (lo_mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(lo_mask) / 4;
+    }
+    uint64_t hi_mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hi), 4)), 0);
+    return cursor + kLanes + base::bits::CountTrailingZeros(hi_mask) / 4;
+  }
+#endif  // V8_HOST_HAS_SSE2
+  return cursor;
+}
+
+// As above, for two-byte strings. Also ORs the skipped characters into
+// |*bits|, so that callers can tell whether any of them is outside Latin-1.
+V8_INLINE const uint16_t* SkipJsonStringCharacters(const uint16_t* begin,
+                                                   const uint16_t* end,
+                                                   uint32_t* bits) {
+  const uint16_t* cursor = begin;
+#if V8_HOST_HAS_SSE2
+  constexpr int kLanes = sizeof(__m128i) / sizeof(uint16_t);
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i control_bits = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+  const __m128i zero = _mm_setzero_si128();
+  __m128i all = zero;
+  auto special = [&](__m128i chars) {
+    __m128i found = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                     _mm_cmpeq_epi16(chars, backslash)),
+        _mm_cmpeq_epi16(_mm_and_si128(chars, control_bits), zero));
+    // Two mask bits per lane.
+    return static_cast<uint32_t>(_mm_movemask_epi8(found));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor + kLanes));
+    uint32_t mask = special(lo) | (special(hi) << (2 * kLanes));
+    if (mask != 0) {
+      const uint16_t* found = cursor + base::bits::CountTrailingZeros(mask) / 2;
+      for (const uint16_t* c = cursor; c < found; ++c) *bits |= *c;
+      cursor = found;
+      break;
+    }
+    all = _mm_or_si128(all, _mm_or_si128(lo, hi));
+  }
+  alignas(16) uint16_t lanes[kLanes];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), all);
+  for (uint16_t lane : lanes) *bits |= lane;
+#elif V8_HOST_HAS_NEON
+  constexpr int kLanes = sizeof(uint16x8_t) / sizeof(uint16_t);
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t control_limit = vdupq_n_u16(0x20);
+  uint16x8_t all = vdupq_n_u16(0);
+  auto special = [&](uint16x8_t chars) {
+    return vorrq_u16(
+        vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+        vcltq_u16(chars, control_limit));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint16x8_t lo = vld1q_u16(cursor);
+    uint16x8_t hi = vld1q_u16(cursor + kLanes);
+    uint16x8_t lo_found = special(lo);
+    uint16x8_t hi_found = special(hi);
+    if (vmaxvq_u16(vorrq_u16(lo_found, hi_found)) != 0) {
+      // Narrow the lanes to one byte each to get a 64-bit mask per vector.
+      uint64_t lo_mask =
+          vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(lo_found)), 0);
+      uint64_t hi_mask =
+          vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(hi_found)), 0);
+      const uint16_t* found =
+          lo_mask != 0
+              ? cursor + base::bits::CountTrailingZeros(lo_mask) / 8
+              : cursor + kLanes + base::bits::CountTrailingZeros(hi_mask) / 8;
+      for (const uint16_t* c = cursor; c < found; ++c) *bits |= *c;
+      cursor = found;
+      break;
+    }
+    all = vorrq_u16(all, vorrq_u16(lo, hi));
+  }
+  uint16_t lanes[kLanes];
+  vst1q_u16(lanes, all);
+  for (uint16_t lane : lanes) *bits |= lane;
+#endif  // V8_HOST_HAS_SSE2
+  return cursor;
+}
+
+// Skips the characters of a two-byte string that JSON.stringify copies
+// verbatim, in blocks of 16 characters. Returns the first character in
+// [begin, end) that is a quote, a backslash, a control character below 0x20
+// or a surrogate, or a position less than 16 characters before |end| from
+// which the caller has to continue with scalar checks. For one-byte strings,
+// the quote, backslash and control characters are the ones to escape, so
+// those use the one-byte SkipJsonStringCharacters above.
+V8_INLINE const uint16_t* SkipUnescapedJsonCharacters(const uint16_t* begin,
+                                                      const uint16_t* end) {
+  const uint16_t* cursor = begin;
+#if V8_HOST_HAS_SSE2
+  constexpr int kLanes = sizeof(__m128i) / sizeof(uint16_t);
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i control_bits = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+  const __m128i surrogate_bits = _mm_set1_epi16(static_cast<int16_t>(0xF800));
+  const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(0xD800));
+  const __m128i zero = _mm_setzero_si128();
+  auto special = [&](const uint16_t* at) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(at));
+    __m128i found = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                     _mm_cmpeq_epi16(chars, backslash)),
+        _mm_or_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(chars, control_bits), zero),
+            _mm_cmpeq_epi16(_mm_and_si128(chars, surrogate_bits), surrogate)));
+    // Two mask bits per lane.
+    return static_cast<uint32_t>(_mm_movemask_epi8(found));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint32_t mask =
+        special(cursor) | (special(cursor + kLanes) << (2 * kLanes));
+    if (mask != 0) return cursor + base::bits::CountTrailingZeros(mask) / 2;
+  }
+#elif V8_HOST_HAS_NEON
+  constexpr int kLanes = sizeof(uint16x8_t) / sizeof(uint16_t);
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t control_limit = vdupq_n_u16(0x20);
+  const uint16x8_t surrogate_bits = vdupq_n_u16(0xF800);
+  const uint16x8_t surrogate = vdupq_n_u16(0xD800);
+  auto special = [&](const uint16_t* at) {
+    uint16x8_t chars = vld1q_u16(at);
+    return vorrq_u16(
+        vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+        vorrq_u16(vcltq_u16(chars, control_limit),
+                  vceqq_u16(vandq_u16(chars, surrogate_bits), surrogate)));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint16x8_t lo = special(cursor);
+    uint16x8_t hi = special(cursor + kLanes);
+    if (vmaxvq_u16(vorrq_u16(lo, hi)) == 0) continue;
+    // Narrow the lanes to one byte each to get a 64-bit mask per vector.
+    uint64_t lo_mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(lo)), 0);
+    if (lo_mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(lo_mask) / 8;
+    }
+    uint64_t hi_mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(hi)), 0);
+    return cursor + kLanes + base::bits::CountTrailingZeros(hi_mask) / 8;
+  }
+#endif  // V8_HOST_HAS_SSE2
+  return cursor;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_SCANNER_SIMD_H_
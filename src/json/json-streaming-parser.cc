@@ -0,0 +1,143 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+class OneByteResource final : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteResource(std::vector<uint8_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(chars_.data());
+  }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<uint8_t> chars_;
+};
+
+class TwoByteResource final : public v8::String::ExternalStringResource {
+ public:
+  explicit TwoByteResource(std::vector<uint16_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const uint16_t* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<uint16_t> chars_;
+};
+
+MaybeHandle<String> NewExternalString(Factory* factory,
+                                      const OneByteResource* resource) {
+  return factory->NewExternalStringFromOneByte(resource);
+}
+
+MaybeHandle<String> NewExternalString(Factory* factory,
+                                      const TwoByteResource* resource) {
+  return factory->NewExternalStringFromTwoByte(resource);
+}
+
+template <typename Resource>
+MaybeHandle<String> NewSource(Isolate* isolate,
+                              std::unique_ptr<Resource> resource) {
+  MaybeHandle<String> result =
+      NewExternalString(isolate->factory(), resource.get());
+  // The string owns the resource, unless it is the empty string or could not
+  // be created.
+  Handle<String> string;
+  if (result.ToHandle(&string) && string->IsExternalString()) {
+    resource.release();
+  }
+  return result;
+}
+
+}  // namespace
+
+void JsonStreamingParser::AddChunk(base::Vector<const uint8_t> chunk) {
+  const uint8_t* cursor = chunk.begin();
+  const uint8_t* end = chunk.end();
+  while (cursor < end) {
+    if (state_ == unibrow::Utf8::State::kAccept) {
+      // Fast path for ASCII sequences.
+      int ascii_length = std::min(
+          NonAsciiStart(cursor, static_cast<int>(end - cursor)),
+          static_cast<int>(end - cursor));
+      if (is_one_byte_) {
+        one_byte_.insert(one_byte_.end(), cursor, cursor + ascii_length);
+      } else {
+        two_byte_.insert(two_byte_.end(), cursor, cursor + ascii_length);
+      }
+      cursor += ascii_length;
+      if (cursor == end) break;
+    }
+    unibrow::uchar c =
+        unibrow::Utf8::ValueOfIncremental(&cursor, &state_, &incomplete_char_);
+    if (c != unibrow::Utf8::kIncomplete) Add(c);
+  }
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish(Isolate* isolate) {
+  unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&state_);
+  if (c != unibrow::Utf8::kBufferEmpty) Add(c);
+  incomplete_char_ = 0;
+
+  MaybeHandle<String> maybe_source;
+  if (is_one_byte_) {
+    maybe_source = NewSource(
+        isolate, std::make_unique<OneByteResource>(std::move(one_byte_)));
+  } else {
+    maybe_source = NewSource(
+        isolate, std::make_unique<TwoByteResource>(std::move(two_byte_)));
+  }
+  is_one_byte_ = true;
+  one_byte_.clear();
+  two_byte_.clear();
+
+  Handle<String> source;
+  if (!maybe_source.ToHandle(&source)) return MaybeHandle<Object>();
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return source->IsOneByteRepresentation()
+             ? JsonParser<uint8_t>::Parse(isolate, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
+void JsonStreamingParser::Add(unibrow::uchar c) {
+  if (is_one_byte_ && c > unibrow::Latin1::kMaxChar) Widen();
+  if (is_one_byte_) {
+    one_byte_.push_back(static_cast<uint8_t>(c));
+  } else if (c <= unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    two_byte_.push_back(static_cast<uint16_t>(c));
+  } else {
+    two_byte_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    two_byte_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  }
+}
+
+void JsonStreamingParser::Widen() {
+  DCHECK(is_one_byte_);
+  two_byte_.assign(one_byte_.begin(), one_byte_.end());
+  one_byte_.clear();
+  one_byte_.shrink_to_fit();
+  is_one_byte_ = false;
+}
+
+}  // namespace internal
+}  // namespace v8
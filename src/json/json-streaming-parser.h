@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+// Collects UTF-8 encoded JSON text chunk by chunk and parses it with
+// JsonParser once it is complete. Each chunk is decoded as it arrives, into a
+// single off-heap buffer that later becomes the backing store of an external
+// string, so the text is neither concatenated nor copied again. AddChunk does
+// not touch the heap and may run on any thread.
+class V8_EXPORT_PRIVATE JsonStreamingParser final {
+ public:
+  JsonStreamingParser() = default;
+  JsonStreamingParser(const JsonStreamingParser&) = delete;
+  JsonStreamingParser& operator=(const JsonStreamingParser&) = delete;
+
+  void AddChunk(base::Vector<const uint8_t> chunk);
+
+  // Parses the text added so far, as JSON.parse would parse it. Afterwards,
+  // the parser is empty again.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish(Isolate* isolate);
+
+  size_t length() const {
+    return is_one_byte_ ? one_byte_.size() : two_byte_.size();
+  }
+
+ private:
+  void Add(unibrow::uchar c);
+  void Widen();
+
+  bool is_one_byte_ = true;
+  std::vector<uint8_t> one_byte_;
+  std::vector<uint16_t> two_byte_;
+  // State of a UTF-8 sequence that is split across chunks.
+  unibrow::Utf8::State state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer incomplete_char_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
@@ -4,8 +4,12 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <memory>
+#include <string>
+
 #include "src/base/strings.h"
 #include "src/common/message-template.h"
+#include "src/json/json-scanner-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
@@ -83,6 +87,24 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object,
                                      Handle<Object> key);
 
+  // The enumerable string keys of a fast-mode map, each already quoted,
+  // escaped and followed by a colon.
+  struct CachedKey {
+    InternalIndex index;
+    std::string escaped;
+  };
+  using CachedKeys = std::vector<CachedKey>;
+
+  // Returns the cached keys of |map|, computing them on a miss. Returns
+  // nullptr if some key is a two-byte string.
+  std::shared_ptr<const CachedKeys> KeysForMap(Handle<Map> map);
+  Result SerializeJSObjectWithCachedKeys(Handle<JSObject> object,
+                                         Handle<Map> map,
+                                         const CachedKeys& keys);
+  V8_INLINE Result SerializePropertyWithCachedKey(Handle<Object> property,
+                                                  bool comma, Handle<Map> map,
+                                                  const CachedKey& key);
+
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
@@ -135,6 +157,13 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // Maps whose keys were serialized recently, and those keys. Arrays of
+  // objects with the same map escape each key only once.
+  static const int kKeyCacheSize = 8;
+  Handle<FixedArray> key_cache_maps_;
+  std::shared_ptr<const CachedKeys> key_cache_[kKeyCacheSize];
+  int next_key_cache_entry_ = 0;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -218,7 +247,8 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       builder_(isolate),
       gap_(nullptr),
       indent_(0),
-      stack_() {
+      stack_(),
+      key_cache_maps_(isolate->factory()->empty_fixed_array()) {
   tojson_string_ = factory()->toJSON_string();
 }
 
@@ -785,6 +815,30 @@ JsonStringifier::Result JsonStringifier::SerializeArrayLikeSlow(
 }
 
 namespace {
+// Returns the first character in [begin, end) that JSON.stringify has to
+// escape, or |end| if there is none.
+V8_INLINE const uint8_t* FindCharacterToEscape(const uint8_t* begin,
+                                               const uint8_t* end) {
+  const uint8_t* cursor = SkipJsonStringCharacters(begin, end);
+  while (cursor < end && *cursor >= 0x20 && *cursor != '"' &&
+         *cursor != '\\') {
+    ++cursor;
+  }
+  return cursor;
+}
+
+V8_INLINE const base::uc16* FindCharacterToEscape(const base::uc16* begin,
+                                                  const base::uc16* end) {
+  const base::uc16* cursor = SkipUnescapedJsonCharacters(begin, end);
+  while (cursor < end && *cursor >= 0x20 && *cursor != '"' &&
+         *cursor != '\\' &&
+         !base::IsInRange(*cursor, static_cast<base::uc16>(0xD800),
+                          static_cast<base::uc16>(0xDFFF))) {
+    ++cursor;
+  }
+  return cursor;
+}
+
 V8_INLINE bool CanFastSerializeJSObject(PtrComprCageBase cage_base,
                                         JSObject raw_object, Isolate* isolate) {
   DisallowGarbageCollection no_gc;
@@ -824,6 +878,14 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
 
   Result stack_push = StackPush(object, key);
   if (stack_push != SUCCESS) return stack_push;
+  // Hold on to the keys, as nested objects may evict them from the cache.
+  std::shared_ptr<const CachedKeys> cached_keys = KeysForMap(map);
+  if (cached_keys) {
+    Result result = SerializeJSObjectWithCachedKeys(object, map, *cached_keys);
+    if (result != SUCCESS) return result;
+    StackPop();
+    return SUCCESS;
+  }
   builder_.AppendCharacter('{');
   Indent();
   bool comma = false;
@@ -863,6 +925,120 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   return SUCCESS;
 }
 
+std::shared_ptr<const JsonStringifier::CachedKeys> JsonStringifier::KeysForMap(
+    Handle<Map> map) {
+  if (key_cache_maps_->length() == 0) {
+    key_cache_maps_.PatchValue(*factory()->NewFixedArray(kKeyCacheSize));
+  }
+  DisallowGarbageCollection no_gc;
+  for (int i = 0; i < kKeyCacheSize; ++i) {
+    if (key_cache_maps_->get(i) == *map) return key_cache_[i];
+  }
+
+  // Maps with two-byte keys are cached as nullptr, so that they are not
+  // inspected again.
+  std::shared_ptr<CachedKeys> keys = std::make_shared<CachedKeys>();
+  PtrComprCageBase cage_base(isolate_);
+  DescriptorArray descriptors = map->instance_descriptors(cage_base);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    Name name = descriptors.GetKey(i);
+    if (!name.IsString(cage_base)) continue;
+    if (descriptors.GetDetails(i).IsDontEnum()) continue;
+    String::FlatContent content = String::cast(name).GetFlatContent(no_gc);
+    if (!content.IsOneByte()) {
+      keys.reset();
+      break;
+    }
+    std::string escaped = "\"";
+    for (uint8_t c : content.ToOneByteVector()) {
+      if (DoNotEscape(c)) {
+        escaped += static_cast<char>(c);
+      } else {
+        escaped += &JsonEscapeTable[c * kJsonEscapeTableEntrySize];
+      }
+    }
+    escaped += "\":";
+    keys->push_back({i, std::move(escaped)});
+  }
+  int entry = next_key_cache_entry_;
+  next_key_cache_entry_ = (entry + 1) % kKeyCacheSize;
+  key_cache_maps_->set(entry, *map);
+  key_cache_[entry] = keys;
+  return keys;
+}
+
+JsonStringifier::Result JsonStringifier::SerializeJSObjectWithCachedKeys(
+    Handle<JSObject> object, Handle<Map> map, const CachedKeys& keys) {
+  PtrComprCageBase cage_base(isolate_);
+  builder_.AppendCharacter('{');
+  Indent();
+  bool comma = false;
+  for (const CachedKey& key : keys) {
+    PropertyDetails details =
+        map->instance_descriptors(cage_base).GetDetails(key.index);
+    Handle<Object> property;
+    if (details.location() == PropertyLocation::kField &&
+        *map == object->map(cage_base)) {
+      DCHECK_EQ(PropertyKind::kData, details.kind());
+      FieldIndex field_index = FieldIndex::ForDescriptor(*map, key.index);
+      property = JSObject::FastPropertyAt(
+          isolate_, object, details.representation(), field_index);
+    } else {
+      Handle<String> key_name(
+          String::cast(map->instance_descriptors(cage_base).GetKey(key.index)),
+          isolate_);
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, property,
+          Object::GetPropertyOrElement(isolate_, object, key_name), EXCEPTION);
+    }
+    Result result = SerializePropertyWithCachedKey(property, comma, map, key);
+    if (!comma && result == SUCCESS) comma = true;
+    if (result == EXCEPTION) return result;
+  }
+  Unindent();
+  if (comma) NewLine();
+  builder_.AppendCharacter('}');
+  return SUCCESS;
+}
+
+JsonStringifier::Result JsonStringifier::SerializePropertyWithCachedKey(
+    Handle<Object> property, bool comma, Handle<Map> map,
+    const CachedKey& key) {
+  // Primitives that are serialized without calling into user code use the
+  // escaped key. Everything else takes the generic path.
+  if (replacer_function_.is_null()) {
+    PtrComprCageBase cage_base(isolate_);
+    Object value = *property;
+    bool is_primitive =
+        value.IsSmi() || value.IsHeapNumber(cage_base) ||
+        value.IsString(cage_base) || value.IsTrue(isolate_) ||
+        value.IsFalse(isolate_) || value.IsNull(isolate_);
+    if (is_primitive) {
+      Separator(!comma);
+      builder_.AppendCString(key.escaped.c_str());
+      if (gap_ != nullptr) builder_.AppendCharacter(' ');
+      if (value.IsSmi()) return SerializeSmi(Smi::cast(value));
+      if (value.IsHeapNumber(cage_base)) {
+        return SerializeHeapNumber(Handle<HeapNumber>::cast(property));
+      }
+      if (value.IsString(cage_base)) {
+        SerializeString(Handle<String>::cast(property));
+      } else if (value.IsTrue(isolate_)) {
+        builder_.AppendCStringLiteral("true");
+      } else if (value.IsFalse(isolate_)) {
+        builder_.AppendCStringLiteral("false");
+      } else {
+        builder_.AppendCStringLiteral("null");
+      }
+      return SUCCESS;
+    }
+  }
+  Handle<String> key_name(
+      String::cast(map->instance_descriptors(isolate_).GetKey(key.index)),
+      isolate_);
+  return SerializeProperty(property, comma, key_name);
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
@@ -938,6 +1114,15 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    // Copy runs of characters that need no escaping in bulk.
+    const SrcChar* run = src.begin() + i;
+    int run_length =
+        static_cast<int>(FindCharacterToEscape(run, src.end()) - run);
+    if (run_length > 0) {
+      dest->AppendChars(run, run_length);
+      i += run_length;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -41,18 +41,72 @@ int GetActualThreadPoolSize(int thread_pool_size) {
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
 
+// Returns the NUMA node to bind worker threads and memory to, or -1.
+int GetActualNumaNode(NumaAffinity numa_affinity, int numa_node) {
+  if constexpr (base::OS::IsNumaAffinitySupported()) {
+    switch (numa_affinity) {
+      case NumaAffinity::kDisabled:
+        return -1;
+      case NumaAffinity::kCurrentNode:
+        return base::OS::GetCurrentNumaNode();
+      case NumaAffinity::kFixedNode:
+        DCHECK_GE(numa_node, 0);
+        return numa_node;
+    }
+  }
+  return -1;
+}
+
+// A page allocator which prefers memory of one NUMA node.
+class NumaPageAllocator final : public base::PageAllocator {
+ public:
+  explicit NumaPageAllocator(int numa_node) : numa_node_(numa_node) {}
+
+  void* AllocatePages(void* hint, size_t size, size_t alignment,
+                      Permission access) override {
+    void* result =
+        base::PageAllocator::AllocatePages(hint, size, alignment, access);
+    if (result != nullptr) BindToNumaNode(result, size);
+    return result;
+  }
+
+  bool DecommitPages(void* address, size_t size) override {
+    // Decommitting replaces the mapping, which drops its memory policy.
+    if (!base::PageAllocator::DecommitPages(address, size)) return false;
+    BindToNumaNode(address, size);
+    return true;
+  }
+
+ private:
+  void BindToNumaNode(void* address, size_t size) {
+    if constexpr (base::OS::IsNumaAffinitySupported()) {
+      // This is only a hint, the allocation is still usable if it fails.
+      USE(base::OS::SetPagesNumaNode(address, size, numa_node_));
+    }
+  }
+
+  const int numa_node_;
+};
+
+std::unique_ptr<v8::PageAllocator> CreatePageAllocator(int numa_node) {
+  if (numa_node >= 0) return std::make_unique<NumaPageAllocator>(numa_node);
+  return std::make_unique<v8::base::PageAllocator>();
+}
+
 }  // namespace
 
 std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
-    std::unique_ptr<v8::TracingController> tracing_controller) {
+    std::unique_ptr<v8::TracingController> tracing_controller,
+    NumaAffinity numa_affinity, int numa_node) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
-      thread_pool_size, idle_task_support, std::move(tracing_controller));
+      thread_pool_size, idle_task_support, std::move(tracing_controller),
+      GetActualNumaNode(numa_affinity, numa_node));
   return platform;
 }
 
@@ -93,11 +147,12 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
 
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
-    std::unique_ptr<v8::TracingController> tracing_controller)
+    std::unique_ptr<v8::TracingController> tracing_controller, int numa_node)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
+      numa_node_(numa_node),
       tracing_controller_(std::move(tracing_controller)),
-      page_allocator_(std::make_unique<v8::base::PageAllocator>()) {
+      page_allocator_(CreatePageAllocator(numa_node)) {
   if (!tracing_controller_) {
     tracing::TracingController* controller = new tracing::TracingController();
 #if !defined(V8_USE_PERFETTO)
@@ -131,9 +186,10 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
   DCHECK_NULL(worker_threads_task_runner_);
   worker_threads_task_runner_ =
       std::make_shared<DefaultWorkerThreadsTaskRunner>(
-          thread_pool_size_, time_function_for_testing_
-                                 ? time_function_for_testing_
-                                 : DefaultTimeFunction);
+          thread_pool_size_,
+          time_function_for_testing_ ? time_function_for_testing_
+                                     : DefaultTimeFunction,
+          numa_node_);
   DCHECK_NOT_NULL(worker_threads_task_runner_);
 }
 
@@ -211,6 +267,20 @@ void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   worker_threads_task_runner_->PostTask(std::move(task));
 }
 
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(TaskPriority::kUserBlocking,
+                                        std::move(task));
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  DCHECK_NOT_NULL(worker_threads_task_runner_);
+  worker_threads_task_runner_->PostTask(TaskPriority::kBestEffort,
+                                        std::move(task));
+}
+
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                                 double delay_in_seconds) {
   // If this DCHECK fires, then this means that either
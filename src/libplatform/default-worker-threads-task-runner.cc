@@ -4,16 +4,57 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
-#include "src/libplatform/delayed-task-queue.h"
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+// The runner and index of the worker thread running on the current thread, if
+// any.
+thread_local const DefaultWorkerThreadsTaskRunner* current_runner = nullptr;
+thread_local size_t current_worker_index = 0;
+
+}  // namespace
+
+void DefaultWorkerThreadsTaskRunner::TaskQueue::Push(
+    TaskPriority priority, std::unique_ptr<Task> task) {
+  size_t lane = static_cast<size_t>(priority);
+  base::MutexGuard guard(&mutex_);
+  tasks_[lane].push_back(std::move(task));
+  sizes_[lane].store(tasks_[lane].size(), std::memory_order_relaxed);
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TaskQueue::Pop(
+    TaskPriority priority, bool newest) {
+  if (IsEmpty(priority)) return nullptr;
+  size_t lane = static_cast<size_t>(priority);
+  base::MutexGuard guard(&mutex_);
+  std::deque<std::unique_ptr<Task>>& tasks = tasks_[lane];
+  if (tasks.empty()) return nullptr;
+  std::unique_ptr<Task> task;
+  if (newest) {
+    task = std::move(tasks.back());
+    tasks.pop_back();
+  } else {
+    task = std::move(tasks.front());
+    tasks.pop_front();
+  }
+  sizes_[lane].store(tasks.size(), std::memory_order_relaxed);
+  return task;
+}
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
-    uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    uint32_t thread_pool_size, TimeFunction time_function, int numa_node)
+    : time_function_(time_function), numa_node_(numa_node) {
+  // All local queues need to exist before the first worker starts stealing.
+  for (uint32_t i = 0; i < thread_pool_size; ++i) {
+    local_queues_.push_back(std::make_unique<TaskQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i));
   }
 }
 
@@ -24,24 +65,45 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 }
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
-  base::MutexGuard guard(&lock_);
-  terminated_ = true;
-  queue_.Terminate();
+  terminated_.store(true);
+  {
+    base::MutexGuard guard(&idle_mutex_);
+    idle_condition_.NotifyAll();
+  }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
 
+void DefaultWorkerThreadsTaskRunner::PostTask(TaskPriority priority,
+                                              std::unique_ptr<Task> task) {
+  if (terminated_.load()) return;
+  // Count the task before queuing it, so that the count never underflows.
+  num_queued_tasks_.fetch_add(1);
+  if (current_runner == this) {
+    local_queues_[current_worker_index]->Push(priority, std::move(task));
+  } else {
+    shared_queue_.Push(priority, std::move(task));
+  }
+  NotifyTaskQueued();
+}
+
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
+  PostTask(TaskPriority::kUserVisible, std::move(task));
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  DCHECK_GE(delay_in_seconds, 0.0);
+  if (terminated_.load()) return;
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
+  {
+    base::MutexGuard guard(&delayed_mutex_);
+    delayed_tasks_.emplace(deadline, std::move(task));
+    num_delayed_tasks_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // Let a sleeping worker recompute when to wake up.
+  base::MutexGuard guard(&idle_mutex_);
+  idle_condition_.NotifyOne();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -55,23 +117,107 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
-  return queue_.GetNext();
+void DefaultWorkerThreadsTaskRunner::NotifyTaskQueued() {
+  // Pairs with the increment of {num_idle_workers_} in {GetNext}: Either we
+  // see the idle worker here, or it sees the queued task.
+  if (num_idle_workers_.load() == 0) return;
+  base::MutexGuard guard(&idle_mutex_);
+  idle_condition_.NotifyOne();
+}
+
+double DefaultWorkerThreadsTaskRunner::MoveDueDelayedTasks() {
+  if (num_delayed_tasks_.load(std::memory_order_relaxed) == 0) return -1;
+  base::MutexGuard guard(&delayed_mutex_);
+  double now = MonotonicallyIncreasingTime();
+  while (!delayed_tasks_.empty()) {
+    auto it = delayed_tasks_.begin();
+    if (it->first > now) return it->first - now;
+    num_queued_tasks_.fetch_add(1);
+    shared_queue_.Push(TaskPriority::kUserVisible, std::move(it->second));
+    delayed_tasks_.erase(it);
+    num_delayed_tasks_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  return -1;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryGetNext(
+    size_t worker_index) {
+  TaskQueue* local_queue = local_queues_[worker_index].get();
+  const size_t num_workers = local_queues_.size();
+  for (size_t lane = kNumPriorities; lane-- > 0;) {
+    TaskPriority priority = static_cast<TaskPriority>(lane);
+    // Prefer the newest local task, whose data is most likely still in the
+    // cache, then the oldest shared task, then steal the oldest task of
+    // another worker.
+    std::unique_ptr<Task> task = local_queue->Pop(priority, true);
+    if (!task) task = shared_queue_.Pop(priority);
+    for (size_t i = 1; !task && i < num_workers; ++i) {
+      task = local_queues_[(worker_index + i) % num_workers]->Pop(priority);
+    }
+    if (task) {
+      num_queued_tasks_.fetch_sub(1);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(
+    size_t worker_index) {
+  for (;;) {
+    MoveDueDelayedTasks();
+    if (std::unique_ptr<Task> task = TryGetNext(worker_index)) return task;
+
+    base::MutexGuard guard(&idle_mutex_);
+    num_idle_workers_.fetch_add(1);
+    // Check again after registering as idle, see {NotifyTaskQueued}. A task
+    // which is only counted but not queued yet makes us retry.
+    double wait_in_seconds = MoveDueDelayedTasks();
+    if (num_queued_tasks_.load() == 0) {
+      if (terminated_.load()) {
+        num_idle_workers_.fetch_sub(1);
+        return nullptr;
+      }
+      if (wait_in_seconds < 0) {
+        idle_condition_.Wait(&idle_mutex_);
+      } else {
+        // Wait for the next delayed task or a newly posted task.
+        // WaitFor unfortunately doesn't care about our fake time and will wait
+        // the 'real' amount of time, based on whatever clock the system call
+        // uses.
+        base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
+            base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
+        bool notified = idle_condition_.WaitFor(&idle_mutex_, wait_delta);
+        USE(notified);
+      }
+    }
+    num_idle_workers_.fetch_sub(1);
+  }
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, size_t index)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  if constexpr (base::OS::IsNumaAffinitySupported()) {
+    if (runner_->numa_node_ >= 0) {
+      // Keep running if pinning fails, e.g. because the node has no CPUs.
+      USE(base::OS::SetCurrentThreadNumaNode(runner_->numa_node_));
+    }
+  }
+  current_runner = runner_;
+  current_worker_index = index_;
+  while (std::unique_ptr<Task> task = runner_->GetNext(index_)) {
     task->Run();
   }
+  current_runner = nullptr;
 }
 
 }  // namespace platform
@@ -5,25 +5,37 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
-#include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+// Runs tasks on a pool of worker threads. Immediate tasks are queued by
+// priority. Tasks posted by a worker thread go to a queue local to that
+// worker, from which idle workers steal, so that tasks which post more tasks
+// (like job workers) do not contend on a shared queue. Tasks posted from
+// other threads go to a shared queue per priority, and run in the order they
+// were posted.
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
   using TimeFunction = double (*)();
 
+  // If |numa_node| is not negative, the worker threads only run on the CPUs
+  // of that NUMA node.
   DefaultWorkerThreadsTaskRunner(uint32_t thread_pool_size,
-                                 TimeFunction time_function);
+                                 TimeFunction time_function,
+                                 int numa_node = -1);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -31,6 +43,9 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
+  // Posts an immediate task with the given |priority|.
+  void PostTask(TaskPriority priority, std::unique_ptr<Task> task);
+
   // v8::TaskRunner implementation.
   void PostTask(std::unique_ptr<Task> task) override;
 
@@ -42,9 +57,31 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   bool IdleTasksEnabled() override;
 
  private:
+  static constexpr size_t kNumPriorities =
+      static_cast<size_t>(TaskPriority::kUserBlocking) + 1;
+
+  // A queue of immediate tasks per priority, protected by its own mutex.
+  class TaskQueue {
+   public:
+    void Push(TaskPriority priority, std::unique_ptr<Task> task);
+    // Pops the oldest task with the given |priority|, or the newest one if
+    // |newest| is true.
+    std::unique_ptr<Task> Pop(TaskPriority priority, bool newest = false);
+    bool IsEmpty(TaskPriority priority) const {
+      return sizes_[static_cast<size_t>(priority)].load(
+                 std::memory_order_relaxed) == 0;
+    }
+
+   private:
+    base::Mutex mutex_;
+    std::deque<std::unique_ptr<Task>> tasks_[kNumPriorities];
+    // Allows to skip empty queues without taking |mutex_|.
+    std::atomic<size_t> sizes_[kNumPriorities] = {};
+  };
+
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, size_t index);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -55,17 +92,42 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    size_t index_;
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // Called by the WorkerThread with the given |worker_index|. Gets the next
+  // task (delayed or immediate) to be executed. Blocks if no task is
+  // available. Returns nullptr once the runner is terminated and all tasks
+  // ran.
+  std::unique_ptr<Task> GetNext(size_t worker_index);
+  // Returns the highest priority task available to the worker, or nullptr.
+  std::unique_ptr<Task> TryGetNext(size_t worker_index);
+  // Moves delayed tasks which are due to the shared queue. Returns the time
+  // until the next delayed task is due, or a negative value if there is none.
+  double MoveDueDelayedTasks();
+  // Wakes up an idle worker after a task was queued.
+  void NotifyTaskQueued();
+
+  std::atomic<bool> terminated_{false};
+  TaskQueue shared_queue_;
+  // One local queue per worker thread.
+  std::vector<std::unique_ptr<TaskQueue>> local_queues_;
+  // Number of tasks in |shared_queue_| and |local_queues_|.
+  std::atomic<size_t> num_queued_tasks_{0};
+
+  base::Mutex delayed_mutex_;
+  std::multimap<double, std::unique_ptr<Task>> delayed_tasks_;
+  // Allows to skip an empty |delayed_tasks_| without taking |delayed_mutex_|.
+  std::atomic<size_t> num_delayed_tasks_{0};
+
+  // Protects going to sleep and waking up idle workers.
+  base::Mutex idle_mutex_;
+  base::ConditionVariable idle_condition_;
+  std::atomic<size_t> num_idle_workers_{0};
 
-  bool terminated_ = false;
-  base::Mutex lock_;
-  DelayedTaskQueue queue_;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
+  const int numa_node_;
 };
 
 }  // namespace platform
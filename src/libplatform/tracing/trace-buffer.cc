@@ -16,26 +16,39 @@ TraceBufferRingBuffer::TraceBufferRingBuffer(size_t max_chunks,
 }
 
 TraceObject* TraceBufferRingBuffer::AddTraceEvent(uint64_t* handle) {
-  base::MutexGuard guard(&mutex_);
-  if (is_empty_ || chunks_[chunk_index_]->IsFull()) {
-    chunk_index_ = is_empty_ ? 0 : NextChunkIndex(chunk_index_);
-    is_empty_ = false;
-    auto& chunk = chunks_[chunk_index_];
+  for (;;) {
+    size_t chunk_index = chunk_index_.load(std::memory_order_acquire);
+    if (chunk_index != kNoChunk) {
+      TraceBufferChunk* chunk = chunks_[chunk_index].get();
+      // Read the sequence number first, so that an event added after the
+      // chunk got reset gets a stale handle rather than another event's.
+      uint32_t chunk_seq = chunk->seq();
+      size_t event_index;
+      if (TraceObject* trace_object = chunk->AddTraceEvent(&event_index)) {
+        *handle = MakeHandle(chunk_index, chunk_seq, event_index);
+        return trace_object;
+      }
+    }
+
+    // The chunk is full. Move on to the next one, unless another thread
+    // already did.
+    base::MutexGuard guard(&mutex_);
+    if (chunk_index_.load(std::memory_order_relaxed) != chunk_index) continue;
+    size_t next_index =
+        chunk_index == kNoChunk ? 0 : NextChunkIndex(chunk_index);
+    auto& chunk = chunks_[next_index];
     if (chunk) {
       chunk->Reset(current_chunk_seq_++);
     } else {
       chunk.reset(new TraceBufferChunk(current_chunk_seq_++));
     }
+    chunk_index_.store(next_index, std::memory_order_release);
   }
-  auto& chunk = chunks_[chunk_index_];
-  size_t event_index;
-  TraceObject* trace_object = chunk->AddTraceEvent(&event_index);
-  *handle = MakeHandle(chunk_index_, chunk->seq(), event_index);
-  return trace_object;
 }
 
 TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
-  base::MutexGuard guard(&mutex_);
+  // The chunk of a valid handle has been allocated before the handle was
+  // handed out, so it can be read without taking the mutex.
   size_t chunk_index, event_index;
   uint32_t chunk_seq;
   ExtractHandle(handle, &chunk_index, &chunk_seq, &event_index);
@@ -48,19 +61,20 @@ TraceObject* TraceBufferRingBuffer::GetEventByHandle(uint64_t handle) {
 bool TraceBufferRingBuffer::Flush() {
   base::MutexGuard guard(&mutex_);
   // This flushes all the traces stored in the buffer.
-  if (!is_empty_) {
-    for (size_t i = NextChunkIndex(chunk_index_);; i = NextChunkIndex(i)) {
+  size_t chunk_index = chunk_index_.load(std::memory_order_relaxed);
+  if (chunk_index != kNoChunk) {
+    for (size_t i = NextChunkIndex(chunk_index);; i = NextChunkIndex(i)) {
       if (auto& chunk = chunks_[i]) {
         for (size_t j = 0; j < chunk->size(); ++j) {
           trace_writer_->AppendTraceEvent(chunk->GetEventAt(j));
         }
       }
-      if (i == chunk_index_) break;
+      if (i == chunk_index) break;
     }
   }
   trace_writer_->Flush();
   // This resets the trace buffer.
-  is_empty_ = true;
+  chunk_index_.store(kNoChunk, std::memory_order_relaxed);
   return true;
 }
 
@@ -88,13 +102,16 @@ size_t TraceBufferRingBuffer::NextChunkIndex(size_t index) const {
 TraceBufferChunk::TraceBufferChunk(uint32_t seq) : seq_(seq) {}
 
 void TraceBufferChunk::Reset(uint32_t new_seq) {
-  next_free_ = 0;
-  seq_ = new_seq;
+  // Readers which see the new sequence number also see the reset index.
+  next_free_.store(0, std::memory_order_relaxed);
+  seq_.store(new_seq, std::memory_order_release);
 }
 
 TraceObject* TraceBufferChunk::AddTraceEvent(size_t* event_index) {
-  *event_index = next_free_++;
-  return &chunk_[*event_index];
+  size_t index = next_free_.fetch_add(1, std::memory_order_acq_rel);
+  if (index >= kChunkSize) return nullptr;
+  *event_index = index;
+  return &chunk_[index];
 }
 
 TraceBuffer* TraceBuffer::CreateTraceBufferRingBuffer(
@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 #define V8_LIBPLATFORM_TRACING_TRACE_BUFFER_H_
 
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -15,6 +17,8 @@ namespace v8 {
 namespace platform {
 namespace tracing {
 
+// Threads add events to the current chunk without locking. Only moving on to
+// the next chunk and flushing take the mutex.
 class TraceBufferRingBuffer : public TraceBuffer {
  public:
   // Takes ownership of |trace_writer|.
@@ -33,12 +37,16 @@ class TraceBufferRingBuffer : public TraceBuffer {
   size_t Capacity() const { return max_chunks_ * TraceBufferChunk::kChunkSize; }
   size_t NextChunkIndex(size_t index) const;
 
+  static constexpr size_t kNoChunk = std::numeric_limits<size_t>::max();
+
   mutable base::Mutex mutex_;
   size_t max_chunks_;
   std::unique_ptr<TraceWriter> trace_writer_;
+  // Chunks are allocated under |mutex_| before they become the current chunk,
+  // and are never freed before the buffer is.
   std::vector<std::unique_ptr<TraceBufferChunk>> chunks_;
-  size_t chunk_index_;
-  bool is_empty_ = true;
+  // The index of the current chunk, or kNoChunk if the buffer is empty.
+  std::atomic<size_t> chunk_index_{kNoChunk};
   uint32_t current_chunk_seq_ = 1;
 };
 
@@ -11,6 +11,7 @@
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
+#include "src/base/platform/yield-processor.h"
 
 #ifdef V8_USE_PERFETTO
 #include "perfetto/ext/trace_processor/export_json.h"
@@ -137,18 +138,20 @@ uint64_t TracingController::AddTraceEventWithTimestamp(
   int64_t cpu_now_us = CurrentCpuTimestampMicroseconds();
 
   uint64_t handle = 0;
-  if (recording_.load(std::memory_order_acquire)) {
+  // Register as a writer before checking |recording_|, so that either
+  // StopTracing waits for this event, or this event sees that recording
+  // stopped.
+  active_writers_.fetch_add(1, std::memory_order_seq_cst);
+  if (recording_.load(std::memory_order_seq_cst)) {
     TraceObject* trace_object = trace_buffer_->AddTraceEvent(&handle);
     if (trace_object) {
-      {
-        base::MutexGuard lock(mutex_.get());
-        trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
-                                 bind_id, num_args, arg_names, arg_types,
-                                 arg_values, arg_convertables, flags, timestamp,
-                                 cpu_now_us);
-      }
+      trace_object->Initialize(phase, category_enabled_flag, name, scope, id,
+                               bind_id, num_args, arg_names, arg_types,
+                               arg_values, arg_convertables, flags, timestamp,
+                               cpu_now_us);
     }
   }
+  active_writers_.fetch_sub(1, std::memory_order_release);
   return handle;
 }
 
@@ -157,9 +160,12 @@ void TracingController::UpdateTraceEventDuration(
   int64_t now_us = CurrentTimestampMicroseconds();
   int64_t cpu_now_us = CurrentCpuTimestampMicroseconds();
 
-  TraceObject* trace_object = trace_buffer_->GetEventByHandle(handle);
-  if (!trace_object) return;
-  trace_object->UpdateDuration(now_us, cpu_now_us);
+  active_writers_.fetch_add(1, std::memory_order_seq_cst);
+  if (recording_.load(std::memory_order_seq_cst)) {
+    TraceObject* trace_object = trace_buffer_->GetEventByHandle(handle);
+    if (trace_object) trace_object->UpdateDuration(now_us, cpu_now_us);
+  }
+  active_writers_.fetch_sub(1, std::memory_order_release);
 }
 
 const char* TracingController::GetCategoryGroupName(
@@ -255,6 +261,11 @@ void TracingController::StopTracing() {
   trace_processor_.reset();
 #else
 
+  // Events are added without taking |mutex_|. Wait for the threads which
+  // are still writing to the buffer.
+  while (active_writers_.load(std::memory_order_acquire) > 0) {
+    YIELD_PROCESSOR;
+  }
   {
     base::MutexGuard lock(mutex_.get());
     DCHECK(trace_buffer_);
@@ -0,0 +1,274 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libsampler/perf-event-sampler.h"
+
+#include <cstring>
+
+#include "include/v8-unwinder.h"
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
+#if V8_OS_LINUX && (V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64)
+#define V8_PERF_EVENT_SAMPLER_SUPPORTED 1
+#endif
+
+#ifdef V8_PERF_EVENT_SAMPLER_SUPPORTED
+#include <asm/perf_regs.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "src/base/atomicops.h"
+#endif
+
+namespace v8 {
+namespace sampler {
+
+#ifdef V8_PERF_EVENT_SAMPLER_SUPPORTED
+
+namespace {
+
+// The user registers recorded with each sample. The kernel writes them in the
+// order of their bits, so the indices below follow that order.
+#if V8_HOST_ARCH_X64
+constexpr uint64_t kSampledRegisters = (uint64_t{1} << PERF_REG_X86_BP) |
+                                       (uint64_t{1} << PERF_REG_X86_SP) |
+                                       (uint64_t{1} << PERF_REG_X86_IP);
+enum SampledRegister { kFp, kSp, kPc, kSampledRegisterCount };
+#elif V8_HOST_ARCH_ARM64
+constexpr uint64_t kSampledRegisters = (uint64_t{1} << PERF_REG_ARM64_X29) |
+                                       (uint64_t{1} << PERF_REG_ARM64_LR) |
+                                       (uint64_t{1} << PERF_REG_ARM64_SP) |
+                                       (uint64_t{1} << PERF_REG_ARM64_PC);
+enum SampledRegister { kFp, kLr, kSp, kPc, kSampledRegisterCount };
+#endif
+
+// The kernel limits stack snapshots to just below 64 KB.
+constexpr size_t kMaxStackSnapshotSize = 65528;
+
+// The ring buffer holds at least this many samples with full stack copies.
+constexpr size_t kMinSamplesInRing = 32;
+
+// Upper bound for the size of a sample record without its stack copy.
+constexpr size_t kMaxSampleHeaderSize = 256;
+
+uint64_t ReadU64(const uint8_t* address) {
+  uint64_t value;
+  memcpy(&value, address, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<PerfEventSampler> PerfEventSampler::New(
+    int thread_id, base::TimeDelta interval, size_t stack_snapshot_size) {
+  stack_snapshot_size = std::min(stack_snapshot_size, kMaxStackSnapshotSize);
+  // The kernel requires the snapshot size to be a multiple of 8.
+  stack_snapshot_size &= ~size_t{7};
+
+  perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_SOFTWARE;
+  attr.config = PERF_COUNT_SW_TASK_CLOCK;
+  attr.sample_period =
+      std::max(int64_t{1}, interval.InMicroseconds()) * 1000;  // In ns.
+  attr.sample_type =
+      PERF_SAMPLE_TID | PERF_SAMPLE_REGS_USER | PERF_SAMPLE_STACK_USER;
+  attr.sample_regs_user = kSampledRegisters;
+  attr.sample_stack_user = static_cast<uint32_t>(stack_snapshot_size);
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, thread_id,
+                                    -1, -1, PERF_FLAG_FD_CLOEXEC));
+  if (fd < 0) return nullptr;
+
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t data_size = base::bits::RoundUpToPowerOfTwo64(
+      kMinSamplesInRing * (stack_snapshot_size + kMaxSampleHeaderSize));
+  data_size = std::max(data_size, page_size);
+  void* ring = mmap(nullptr, page_size + data_size, PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+  if (ring == MAP_FAILED) {
+    close(fd);
+    return nullptr;
+  }
+  return std::unique_ptr<PerfEventSampler>(
+      new PerfEventSampler(thread_id, fd, ring, page_size, data_size));
+}
+
+PerfEventSampler::PerfEventSampler(int thread_id, int fd, void* ring,
+                                   size_t page_size, size_t data_size)
+    : thread_id_(thread_id),
+      fd_(fd),
+      ring_(ring),
+      page_size_(page_size),
+      data_size_(data_size) {}
+
+PerfEventSampler::~PerfEventSampler() {
+  Stop();
+  munmap(ring_, page_size_ + data_size_);
+  close(fd_);
+}
+
+void PerfEventSampler::Start() {
+  DCHECK(!IsActive());
+  CHECK_EQ(0, ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0));
+  active_.store(true, std::memory_order_relaxed);
+}
+
+void PerfEventSampler::Stop() {
+  if (!IsActive()) return;
+  CHECK_EQ(0, ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0));
+  active_.store(false, std::memory_order_relaxed);
+}
+
+size_t PerfEventSampler::ReadSamples(const SampleCallback& callback) {
+  perf_event_mmap_page* metadata = static_cast<perf_event_mmap_page*>(ring_);
+  const uint8_t* data = static_cast<const uint8_t*>(ring_) + page_size_;
+  // Pairs with the kernel's release store after writing the records.
+  const uint64_t head = static_cast<uint64_t>(base::Acquire_Load(
+      reinterpret_cast<volatile const base::Atomic64*>(&metadata->data_head)));
+  uint64_t tail = metadata->data_tail;
+  size_t count = 0;
+  while (tail < head) {
+    const size_t offset = static_cast<size_t>(tail & (data_size_ - 1));
+    // Record headers are 8-byte aligned, so they never wrap.
+    perf_event_header header;
+    memcpy(&header, data + offset, sizeof(header));
+    const uint8_t* record = data + offset;
+    if (offset + header.size > data_size_) {
+      const size_t first_part = data_size_ - offset;
+      wrapped_record_.resize(header.size);
+      memcpy(wrapped_record_.data(), record, first_part);
+      memcpy(wrapped_record_.data() + first_part, data,
+             header.size - first_part);
+      record = wrapped_record_.data();
+    }
+    DispatchRecord(record, callback, &count);
+    tail += header.size;
+  }
+  // Hands the space of the read records back to the kernel.
+  base::Release_Store(
+      reinterpret_cast<volatile base::Atomic64*>(&metadata->data_tail),
+      static_cast<base::Atomic64>(tail));
+  return count;
+}
+
+void PerfEventSampler::DispatchRecord(const uint8_t* record,
+                                      const SampleCallback& callback,
+                                      size_t* count) {
+  perf_event_header header;
+  memcpy(&header, record, sizeof(header));
+  const uint8_t* position = record + sizeof(header);
+  if (header.type == PERF_RECORD_LOST) {
+    // Followed by the event id and the number of lost records.
+    lost_sample_count_ += ReadU64(position + sizeof(uint64_t));
+    return;
+  }
+  if (header.type != PERF_RECORD_SAMPLE) return;
+
+  Sample sample;
+  uint32_t pid_and_tid[2];
+  memcpy(pid_and_tid, position, sizeof(pid_and_tid));
+  position += sizeof(pid_and_tid);
+  sample.thread_id = static_cast<int>(pid_and_tid[1]);
+  // An ABI of PERF_SAMPLE_REGS_ABI_NONE means that no registers follow, e.g.
+  // for samples taken while the thread was in the kernel.
+  const uint64_t abi = ReadU64(position);
+  position += sizeof(uint64_t);
+  if (abi == PERF_SAMPLE_REGS_ABI_NONE) return;
+  uint64_t regs[kSampledRegisterCount];
+  memcpy(regs, position, sizeof(regs));
+  position += sizeof(regs);
+  sample.pc = reinterpret_cast<void*>(regs[kPc]);
+  sample.sp = reinterpret_cast<void*>(regs[kSp]);
+  sample.fp = reinterpret_cast<void*>(regs[kFp]);
+#if V8_HOST_ARCH_ARM64
+  sample.lr = reinterpret_cast<void*>(regs[kLr]);
+#endif
+  const uint64_t stack_size = ReadU64(position);
+  position += sizeof(uint64_t);
+  if (stack_size > 0) {
+    // The dynamic size, which is how much of the stack was actually copied,
+    // follows the copy.
+    sample.stack = position;
+    sample.stack_size = static_cast<size_t>(
+        std::min(stack_size, ReadU64(position + stack_size)));
+  }
+  // The event only counts the sampled thread, but check the thread in case
+  // the kernel ever reports inherited events.
+  if (sample.thread_id != thread_id_) return;
+  ++*count;
+  callback(sample);
+}
+
+#else  // !V8_PERF_EVENT_SAMPLER_SUPPORTED
+
+// static
+std::unique_ptr<PerfEventSampler> PerfEventSampler::New(
+    int thread_id, base::TimeDelta interval, size_t stack_snapshot_size) {
+  return nullptr;
+}
+
+PerfEventSampler::~PerfEventSampler() { UNREACHABLE(); }
+
+void PerfEventSampler::Start() { UNREACHABLE(); }
+
+void PerfEventSampler::Stop() { UNREACHABLE(); }
+
+size_t PerfEventSampler::ReadSamples(const SampleCallback& callback) {
+  UNREACHABLE();
+}
+
+#endif  // V8_PERF_EVENT_SAMPLER_SUPPORTED
+
+// static
+size_t PerfEventSampler::UnwindV8Frames(const Sample& sample,
+                                        size_t code_pages_length,
+                                        const MemoryRange* code_pages,
+                                        void** pcs, size_t max_frames) {
+  const uintptr_t stack_start = reinterpret_cast<uintptr_t>(sample.sp);
+  // Reads a word of the real stack at |address| from the stack copy.
+  auto read_stack = [&](uintptr_t address, uintptr_t* value) {
+    if (address < stack_start) return false;
+    const uintptr_t offset = address - stack_start;
+    if (offset > sample.stack_size ||
+        sample.stack_size - offset < sizeof(uintptr_t)) {
+      return false;
+    }
+    memcpy(value, sample.stack + offset, sizeof(uintptr_t));
+    return true;
+  };
+
+  size_t frames = 0;
+  void* pc = sample.pc;
+  uintptr_t fp = reinterpret_cast<uintptr_t>(sample.fp);
+  while (frames < max_frames &&
+         v8::Unwinder::PCIsInV8(code_pages_length, code_pages, pc)) {
+    pcs[frames++] = pc;
+    // All V8 frames on x64 and arm64 start with the caller's frame pointer,
+    // followed by the return address.
+    uintptr_t caller_fp;
+    uintptr_t return_address;
+    if (!read_stack(fp, &caller_fp) ||
+        !read_stack(fp + sizeof(uintptr_t), &return_address)) {
+      break;
+    }
+    // Callers' frames lie at higher addresses.
+    if (caller_fp <= fp) break;
+    fp = caller_fp;
+    pc = reinterpret_cast<void*>(return_address);
+  }
+  return frames;
+}
+
+}  // namespace sampler
+}  // namespace v8
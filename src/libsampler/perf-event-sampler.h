@@ -0,0 +1,109 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBSAMPLER_PERF_EVENT_SAMPLER_H_
+#define V8_LIBSAMPLER_PERF_EVENT_SAMPLER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+
+struct MemoryRange;
+
+namespace sampler {
+
+// ----------------------------------------------------------------------------
+// PerfEventSampler
+//
+// Samples a single thread with the Linux perf_event_open API instead of
+// signals. At each sample, the kernel copies the user registers and the top of
+// the user stack of the thread into a ring buffer, from which any thread can
+// read the samples later. The sampled thread never runs a signal handler, so
+// its system calls are not interrupted, and every instance only samples the
+// thread it was created for, e.g. the thread running one isolate.
+
+class V8_EXPORT_PRIVATE PerfEventSampler {
+ public:
+  // A sample as recorded by the kernel. |stack| points to a copy of the
+  // |stack_size| bytes of the stack starting at |sp|, which is only valid
+  // while the sample is passed to the callback of ReadSamples.
+  struct Sample {
+    int thread_id = 0;
+    void* pc = nullptr;
+    void* sp = nullptr;
+    void* fp = nullptr;
+    void* lr = nullptr;  // Only recorded on arm64.
+    const uint8_t* stack = nullptr;
+    size_t stack_size = 0;
+  };
+
+  using SampleCallback = std::function<void(const Sample& sample)>;
+
+  static constexpr size_t kDefaultStackSnapshotSize = 16 * 1024;
+
+  // Creates a stopped sampler for the thread |thread_id|, which samples every
+  // |interval| of CPU time the thread uses. Returns nullptr if perf events are
+  // not available, e.g. on other operating systems or architectures, or if
+  // the system's perf_event_paranoid setting does not allow them.
+  static std::unique_ptr<PerfEventSampler> New(
+      int thread_id, base::TimeDelta interval,
+      size_t stack_snapshot_size = kDefaultStackSnapshotSize);
+
+  ~PerfEventSampler();
+  PerfEventSampler(const PerfEventSampler&) = delete;
+  PerfEventSampler& operator=(const PerfEventSampler&) = delete;
+
+  void Start();
+  void Stop();
+  bool IsActive() const { return active_.load(std::memory_order_relaxed); }
+
+  int thread_id() const { return thread_id_; }
+
+  // Calls |callback| for every sample of this sampler's thread recorded since
+  // the last call, oldest first, and returns the number of samples. Must not
+  // be called concurrently.
+  size_t ReadSamples(const SampleCallback& callback);
+
+  // Number of samples the kernel dropped because the ring buffer was full.
+  uint64_t lost_sample_count() const { return lost_sample_count_; }
+
+  // Unwinds the V8 frames at the top of |sample| by following the frame
+  // pointers saved in its stack copy, and stores the PCs of up to |max_frames|
+  // frames into |pcs|. Like v8::Unwinder::TryUnwindV8Frames, this stops at the
+  // first PC outside of |code_pages|. It also stops where the stack copy ends.
+  // Returns the number of frames.
+  static size_t UnwindV8Frames(const Sample& sample, size_t code_pages_length,
+                               const MemoryRange* code_pages, void** pcs,
+                               size_t max_frames);
+
+ private:
+  PerfEventSampler(int thread_id, int fd, void* ring, size_t page_size,
+                   size_t data_size);
+
+  void DispatchRecord(const uint8_t* record, const SampleCallback& callback,
+                      size_t* count);
+
+  const int thread_id_;
+  const int fd_;
+  // One metadata page followed by a power of two number of data pages.
+  void* const ring_;
+  const size_t page_size_;
+  const size_t data_size_;
+  std::atomic_bool active_{false};
+  uint64_t lost_sample_count_ = 0;
+  // Records wrapping around the end of the ring are copied here.
+  std::vector<uint8_t> wrapped_record_;
+};
+
+}  // namespace sampler
+}  // namespace v8
+
+#endif  // V8_LIBSAMPLER_PERF_EVENT_SAMPLER_H_
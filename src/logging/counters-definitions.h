@@ -281,13 +281,22 @@ namespace internal {
 // lines) rather than one macro (of length about 80 lines) to work around
 // this problem.  Please avoid using recursive macros of this length when
 // possible.
-#define STATS_COUNTER_LIST_1(SC)                          \
-  /* Global Handle Count*/                                \
-  SC(global_handles, V8.GlobalHandles)                    \
-  SC(alive_after_last_gc, V8.AliveAfterLastGC)            \
-  SC(compilation_cache_hits, V8.CompilationCacheHits)     \
-  SC(compilation_cache_misses, V8.CompilationCacheMisses) \
-  SC(objs_since_last_young, V8.ObjsSinceLastYoung)        \
+#define STATS_COUNTER_LIST_1(SC)                                             \
+  /* Global Handle Count*/                                                   \
+  SC(global_handles, V8.GlobalHandles)                                       \
+  SC(alive_after_last_gc, V8.AliveAfterLastGC)                               \
+  SC(compilation_cache_hits, V8.CompilationCacheHits)                        \
+  SC(compilation_cache_misses, V8.CompilationCacheMisses)                    \
+  SC(compilation_cache_script_hits, V8.CompilationCacheScriptHits)           \
+  SC(compilation_cache_script_misses, V8.CompilationCacheScriptMisses)       \
+  SC(compilation_cache_script_evictions, V8.CompilationCacheScriptEvictions) \
+  SC(compilation_cache_eval_hits, V8.CompilationCacheEvalHits)               \
+  SC(compilation_cache_eval_misses, V8.CompilationCacheEvalMisses)           \
+  SC(compilation_cache_eval_evictions, V8.CompilationCacheEvalEvictions)     \
+  SC(compilation_cache_regexp_hits, V8.CompilationCacheRegExpHits)           \
+  SC(compilation_cache_regexp_misses, V8.CompilationCacheRegExpMisses)       \
+  SC(compilation_cache_regexp_evictions, V8.CompilationCacheRegExpEvictions) \
+  SC(objs_since_last_young, V8.ObjsSinceLastYoung)                           \
   SC(objs_since_last_full, V8.ObjsSinceLastFull)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
@@ -298,8 +307,11 @@ namespace internal {
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
+  SC(install_code_interrupts, V8.InstallCodeInterrupts)                        \
+  SC(install_code_requests_coalesced, V8.InstallCodeRequestsCoalesced)         \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
   SC(new_space_bytes_used, V8.MemoryNewSpaceBytesUsed)                         \
@@ -317,7 +329,18 @@ namespace internal {
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
-  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)
+  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
+  SC(turbofan_degraded_compiles, V8.TurboFanDegradedCompiles)                  \
+  SC(turbofan_budget_skipped_phases, V8.TurboFanBudgetSkippedPhases)          \
+  SC(bytecode_flushed_functions, V8.BytecodeFlushedFunctions)                  \
+  SC(bytecode_flush_recompiles, V8.BytecodeFlushRecompiles)                    \
+  SC(process_wide_script_cache_hits, V8.ProcessWideScriptCacheHits)            \
+  SC(process_wide_script_cache_misses, V8.ProcessWideScriptCacheMisses)        \
+  SC(map_deprecations, V8.MapDeprecations)                                     \
+  /* All instance migrations, including the eager ones. */                     \
+  SC(instance_migrations, V8.InstanceMigrations)                               \
+  SC(eager_instance_migrations, V8.EagerInstanceMigrations)                   \
+  SC(shared_constant_pools, V8.SharedConstantPools)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
@@ -55,6 +55,10 @@ LogFile::LogFile(V8FileLogger* logger, std::string file_name)
       output_handle_(LogFile::CreateOutputHandle(file_name)),
       os_(output_handle_ == nullptr ? stdout : output_handle_),
       format_buffer_(NewArray<char>(kMessageBufferSize)) {
+  if (output_handle_ && FLAG_log_binary) {
+    binary_encoder_ = std::make_unique<BinaryLogEncoder>(output_handle_);
+    os_.rdbuf(binary_encoder_.get());
+  }
   if (output_handle_) WriteLogHeader();
 }
 
@@ -93,6 +97,7 @@ std::unique_ptr<LogFile::MessageBuilder> LogFile::NewMessageBuilder() {
 FILE* LogFile::Close() {
   FILE* result = nullptr;
   if (output_handle_ != nullptr) {
+    if (binary_encoder_) binary_encoder_->Flush();
     fflush(output_handle_);
     result = output_handle_;
   }
@@ -244,7 +249,13 @@ void LogFile::MessageBuilder::AppendRawFormatString(const char* format, ...) {
 
 void LogFile::MessageBuilder::AppendRawCharacter(char c) { log_->os_ << c; }
 
-void LogFile::MessageBuilder::WriteToLogFile() { log_->os_ << std::endl; }
+void LogFile::MessageBuilder::WriteToLogFile() {
+  if (log_->binary_encoder_) {
+    log_->binary_encoder_->EndRecord();
+  } else {
+    log_->os_ << std::endl;
+  }
+}
 
 template <>
 LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<const char*>(
@@ -296,10 +307,116 @@ LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<Name>(Name name) {
 template <>
 LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<LogSeparator>(
     LogSeparator separator) {
-  // Skip escaping to create a new column.
-  this->AppendRawCharacter(',');
+  if (log_->binary_encoder_) {
+    log_->binary_encoder_->EndField();
+  } else {
+    // Skip escaping to create a new column.
+    this->AppendRawCharacter(',');
+  }
   return *this;
 }
 
+BinaryLogEncoder::BinaryLogEncoder(FILE* output_handle)
+    : output_handle_(output_handle) {
+  buffer_.reserve(kBufferSize);
+  buffer_.insert(buffer_.end(), kHeader, kHeader + sizeof(kHeader) - 1);
+}
+
+BinaryLogEncoder::int_type BinaryLogEncoder::overflow(int_type c) {
+  if (c != EOF) field_.push_back(static_cast<char>(c));
+  return c;
+}
+
+std::streamsize BinaryLogEncoder::xsputn(const char* s, std::streamsize n) {
+  field_.append(s, static_cast<size_t>(n));
+  return n;
+}
+
+void BinaryLogEncoder::EndField() {
+  if (!TryWriteInteger() && !TryWriteAddress()) WriteString();
+  field_.clear();
+}
+
+void BinaryLogEncoder::EndRecord() {
+  EndField();
+  buffer_.push_back(kEndOfRecord);
+  if (buffer_.size() >= kBufferSize) Flush();
+}
+
+void BinaryLogEncoder::Flush() {
+  if (buffer_.empty()) return;
+  fwrite(buffer_.data(), 1, buffer_.size(), output_handle_);
+  buffer_.clear();
+}
+
+void BinaryLogEncoder::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    buffer_.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  buffer_.push_back(static_cast<uint8_t>(value));
+}
+
+bool BinaryLogEncoder::TryWriteInteger() {
+  // Only fields which print back the same way, i.e. without a leading zero
+  // or plus sign, and without overflow.
+  size_t start = !field_.empty() && field_[0] == '-' ? 1 : 0;
+  size_t length = field_.size() - start;
+  if (length == 0 || length > 18) return false;
+  if (field_[start] == '0' && (length > 1 || start == 1)) return false;
+  int64_t value = 0;
+  for (size_t i = start; i < field_.size(); i++) {
+    if (field_[i] < '0' || field_[i] > '9') return false;
+    value = value * 10 + (field_[i] - '0');
+  }
+  buffer_.push_back(kInteger);
+  WriteZigZag(start == 1 ? -value : value);
+  return true;
+}
+
+bool BinaryLogEncoder::TryWriteAddress() {
+  size_t length = field_.size();
+  if (length < 3 || length > 18 || field_[0] != '0' || field_[1] != 'x') {
+    return false;
+  }
+  // Zero padded addresses would lose their padding.
+  if (field_[2] == '0' && length > 3) return false;
+  uint64_t value = 0;
+  for (size_t i = 2; i < length; i++) {
+    char c = field_[i];
+    int digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else {
+      return false;
+    }
+    value = (value << 4) | static_cast<uint64_t>(digit);
+  }
+  buffer_.push_back(kAddress);
+  WriteZigZag(static_cast<int64_t>(value - previous_address_));
+  previous_address_ = value;
+  return true;
+}
+
+void BinaryLogEncoder::WriteString() {
+  if (field_.size() <= kMaxInternedLength) {
+    auto it = interned_strings_.find(field_);
+    if (it != interned_strings_.end()) {
+      buffer_.push_back(kStringRef);
+      WriteVarint(it->second);
+      return;
+    }
+    uint32_t id = static_cast<uint32_t>(interned_strings_.size());
+    interned_strings_.emplace(field_, id);
+    buffer_.push_back(kString);
+  } else {
+    buffer_.push_back(kLongString);
+  }
+  WriteVarint(field_.size());
+  buffer_.insert(buffer_.end(), field_.begin(), field_.end());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -10,6 +10,10 @@
 #include <atomic>
 #include <cstdarg>
 #include <memory>
+#include <streambuf>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "src/base/compiler-specific.h"
 #include "src/base/optional.h"
@@ -32,6 +36,70 @@ class V8FileLogger;
 
 enum class LogSeparator { kSeparator };
 
+// Stream buffer which writes the log in a compact binary format instead of
+// CSV lines, used with --log-binary. The characters of each field are the
+// same as in the CSV log (i.e. escaped), so that a reader can turn records
+// back into log lines. Every field is encoded with a one byte tag:
+//   kInteger:    A decimal integer as zigzag varint.
+//   kAddress:    A hex number with "0x" prefix as zigzag varint of the
+//                difference to the previous address.
+//   kString:     A varint length and the characters. The string is interned
+//                under the next free id.
+//   kStringRef:  The varint id of an interned string.
+//   kLongString: A varint length and the characters, not interned.
+// Records end with kEndOfRecord. The output is buffered and written in large
+// chunks instead of line by line.
+class V8_EXPORT_PRIVATE BinaryLogEncoder final : public std::streambuf {
+ public:
+  enum Tag : uint8_t {
+    kEndOfRecord,
+    kInteger,
+    kAddress,
+    kString,
+    kStringRef,
+    kLongString,
+  };
+
+  // Written at the start of the log, the NUL byte distinguishes it from
+  // CSV logs.
+  static constexpr char kHeader[] = "\0v8-binary-log-1\n";
+  // Longer strings, e.g. script sources, are not worth interning.
+  static constexpr size_t kMaxInternedLength = 256;
+  static constexpr size_t kBufferSize = 64 * KB;
+
+  explicit BinaryLogEncoder(FILE* output_handle);
+  ~BinaryLogEncoder() override = default;
+
+  BinaryLogEncoder(const BinaryLogEncoder&) = delete;
+  BinaryLogEncoder& operator=(const BinaryLogEncoder&) = delete;
+
+  void EndField();
+  void EndRecord();
+  // Writes all buffered records to the output file.
+  void Flush();
+
+ protected:
+  int_type overflow(int_type c) override;
+  std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+ private:
+  void WriteVarint(uint64_t value);
+  void WriteZigZag(int64_t value) {
+    WriteVarint((static_cast<uint64_t>(value) << 1) ^
+                static_cast<uint64_t>(value >> 63));
+  }
+  bool TryWriteInteger();
+  bool TryWriteAddress();
+  void WriteString();
+
+  FILE* const output_handle_;
+  // Characters of the current field.
+  std::string field_;
+  std::vector<uint8_t> buffer_;
+  std::unordered_map<std::string, uint32_t> interned_strings_;
+  uint64_t previous_address_ = 0;
+};
+
 // Functions and data for performing output of log messages.
 class LogFile {
  public:
@@ -121,6 +189,9 @@ class LogFile {
   // destination.  mutex_ should be acquired before using output_handle_.
   FILE* output_handle_;
 
+  // Only set with --log-binary, in which case it is the buffer of os_.
+  std::unique_ptr<BinaryLogEncoder> binary_encoder_;
+
   OFStream os_;
 
   // mutex_ is a Mutex used for enforcing exclusive
@@ -277,6 +277,22 @@ void RuntimeCallStats::Reset() {
   in_use_ = true;
 }
 
+void RuntimeCallStats::RecordSample() {
+  if (!(TracingFlags::runtime_stats.load(std::memory_order_relaxed) &
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING)) {
+    return;
+  }
+  // The owning thread is interrupted, so the counter cannot change under us.
+  RuntimeCallCounter* counter = current_counter();
+  if (counter != nullptr) counter->IncrementSamples();
+}
+
+void RuntimeCallStats::ResetSamples() {
+  for (int i = 0; i < kNumberOfCounters; i++) {
+    GetCounter(i)->ResetSamples();
+  }
+}
+
 void RuntimeCallStats::Dump(v8::tracing::TracedValue* value) {
   for (int i = 0; i < kNumberOfCounters; i++) {
     if (GetCounter(i)->count() > 0) GetCounter(i)->Dump(value);
@@ -46,6 +46,14 @@ class RuntimeCallCounter final {
   void Increment() { count_++; }
   void Add(base::TimeDelta delta) { time_ += delta.InMicroseconds(); }
 
+  // Number of CPU profiler ticks which hit this counter, see
+  // RuntimeCallStats::RecordSample. Reading it is safe on any thread.
+  uint64_t samples() const {
+    return static_cast<uint64_t>(base::Relaxed_Load(&samples_));
+  }
+  void IncrementSamples() { base::Relaxed_AtomicIncrement(&samples_, 1); }
+  void ResetSamples() { base::Relaxed_Store(&samples_, 0); }
+
  private:
   friend class RuntimeCallStats;
 
@@ -53,6 +61,8 @@ class RuntimeCallCounter final {
   int64_t count_;
   // Stored as int64_t so that its initialization can be deferred.
   int64_t time_;
+  // Written by the profiler while the isolate's thread is interrupted.
+  base::AtomicWord samples_ = 0;
 };
 
 // RuntimeCallTimer is used to keep track of the stack of currently active
@@ -172,6 +182,7 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_ParseStreaming)                                   \
   V(JSON_Stringify)                                        \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
@@ -213,6 +224,7 @@ class RuntimeCallTimer final {
   V(Object_HasRealNamedProperty)                           \
   V(Object_IsCodeLike)                                     \
   V(Object_New)                                            \
+  V(Object_NewBatch)                                       \
   V(Object_ObjectProtoToString)                            \
   V(Object_Set)                                            \
   V(Object_SetAccessor)                                    \
@@ -261,6 +273,7 @@ class RuntimeCallTimer final {
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
+  V(String_NewExternalUtf8)                                \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
@@ -323,6 +336,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AllocateGeneralRegisters)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AssembleCode)                    \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, AssignSpillSlots)                \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BackgroundFinalizeCode)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BranchConditionDuplication)      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BuildLiveRangeBundles)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BuildLiveRanges)                 \
@@ -357,6 +371,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MeetRegisterConstraints)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MemoryOptimization)              \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, OptimizeMoves)                   \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, OptimizeTurboshaft)              \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, PopulatePointerMaps)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, PrintGraph)                      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, ResolveControlFlow)              \
@@ -367,6 +382,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, Scheduling)                      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, SelectInstructions)              \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, SimplifiedLowering)              \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, SLPVectorization)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, StoreStoreElimination)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TraceScheduleAndVerify)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, BuildTurboShaft)                 \
@@ -381,6 +397,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmLoopPeeling)                 \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmLoopUnrolling)               \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmOptimization)                \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmRevectorize)                 \
                                                                             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Parse, ArrowFunctionLiteral)               \
   ADD_THREAD_SPECIFIC_COUNTER(V, Parse, FunctionLiteral)                    \
@@ -431,6 +448,7 @@ class RuntimeCallTimer final {
   V(Genesis)                                   \
   V(GetCompatibleReceiver)                     \
   V(GetMoreDataCallback)                       \
+  V(HandleInterrupts)                          \
   V(IndexedDefinerCallback)                    \
   V(IndexedDeleterCallback)                    \
   V(IndexedDescriptorCallback)                 \
@@ -438,6 +456,7 @@ class RuntimeCallTimer final {
   V(IndexedGetterCallback)                     \
   V(IndexedQueryCallback)                      \
   V(IndexedSetterCallback)                     \
+  V(InstallOptimizedFunctions)                 \
   V(InstantiateFunction)                       \
   V(InstantiateObject)                         \
   V(Invoke)                                    \
@@ -605,6 +624,13 @@ class RuntimeCallStats final {
       RuntimeCallCounterId counter_id, CounterMode mode = kExact);
 
   V8_EXPORT_PRIVATE void Reset();
+  // Adds a sample to the innermost active counter, if any. Called by the CPU
+  // profiler on every tick while the thread owning this table is interrupted,
+  // if runtime call stats are in sampling mode.
+  void RecordSample();
+  // Reset() leaves the sample counts alone, as it runs whenever a tracing
+  // scope starts.
+  V8_EXPORT_PRIVATE void ResetSamples();
   // Add all entries from another stats object.
   void Add(RuntimeCallStats* other);
   V8_EXPORT_PRIVATE void Print(std::ostream& os);
@@ -41,6 +41,9 @@ class MaglevCodeGenState {
   void set_tagged_slots(int slots) { tagged_slots_ = slots; }
   void set_untagged_slots(int slots) { untagged_slots_ = slots; }
 
+  void set_osr_pc_offset(int offset) { osr_pc_offset_ = offset; }
+  int osr_pc_offset() const { return osr_pc_offset_; }
+
   void PushDeferredCode(DeferredCodeInfo* deferred_code) {
     deferred_code_.push_back(deferred_code);
   }
@@ -123,6 +126,8 @@ class MaglevCodeGenState {
   std::vector<LazyDeoptInfo*> lazy_deopts_;
   int untagged_slots_ = 0;
   int tagged_slots_ = 0;
+  // The offset of the entry point used by on-stack replacement, or -1.
+  int osr_pc_offset_ = -1;
 
   // Allow marking some codegen paths as unsupported, so that we can test maglev
   // incrementally.
@@ -49,21 +49,39 @@ class MaglevCodeGeneratingNodeProcessor {
   explicit MaglevCodeGeneratingNodeProcessor(MaglevCodeGenState* code_gen_state)
       : code_gen_state_(code_gen_state) {}
 
-  void PreProcessGraph(MaglevCompilationInfo*, Graph* graph) {
+  void PreProcessGraph(MaglevCompilationInfo* compilation_info,
+                       Graph* graph) {
     if (FLAG_maglev_break_on_entry) {
       __ int3();
     }
 
-    __ BailoutIfDeoptimized(rbx);
+    // The stack slots that are already part of the frame on entry.
+    int existing_stack_slots = 0;
+    if (compilation_info->is_osr()) {
+      // OSR-compiled functions cannot be entered directly.
+      __ Abort(AbortReason::kShouldNotDirectlyEnterOsrFunction);
+      // Unoptimized code jumps directly to this entry point while the
+      // unoptimized frame is still on the stack. The register file of that
+      // frame is reused as is, so only the remaining stack slots have to be
+      // allocated.
+      __ RecordComment("-- OSR entrypoint --");
+      code_gen_state_->set_osr_pc_offset(__ pc_offset());
+      existing_stack_slots = UnoptimizedFrameConstants::RegisterStackSlotCount(
+                                 compilation_info->toplevel_compilation_unit()
+                                     ->register_count()) +
+                             UnoptimizedFrameConstants::kExtraSlotCount;
+    } else {
+      __ BailoutIfDeoptimized(rbx);
 
-    __ EnterFrame(StackFrame::BASELINE);
+      __ EnterFrame(StackFrame::BASELINE);
 
-    // Save arguments in frame.
-    // TODO(leszeks): Consider eliding this frame if we don't make any calls
-    // that could clobber these registers.
-    __ Push(kContextRegister);
-    __ Push(kJSFunctionRegister);              // Callee's JS function.
-    __ Push(kJavaScriptCallArgCountRegister);  // Actual argument count.
+      // Save arguments in frame.
+      // TODO(leszeks): Consider eliding this frame if we don't make any calls
+      // that could clobber these registers.
+      __ Push(kContextRegister);
+      __ Push(kJSFunctionRegister);              // Callee's JS function.
+      __ Push(kJavaScriptCallArgCountRegister);  // Actual argument count.
+    }
 
     // TODO(v8:7700): Handle TieringState and cached optimized code. See also:
     // LoadTieringStateAndJumpIfNeedsProcessing and
@@ -72,15 +90,16 @@ class MaglevCodeGeneratingNodeProcessor {
     // Extend rsp by the size of the frame.
     code_gen_state_->set_untagged_slots(graph->untagged_stack_slots());
     code_gen_state_->set_tagged_slots(graph->tagged_stack_slots());
-    __ subq(rsp,
-            Immediate(code_gen_state_->stack_slots() * kSystemPointerSize));
+    DCHECK_GE(code_gen_state_->stack_slots(), existing_stack_slots);
+    int new_stack_slots = code_gen_state_->stack_slots() - existing_stack_slots;
+    __ subq(rsp, Immediate(new_stack_slots * kSystemPointerSize));
 
     // Initialize stack slots.
     // TODO(jgruber): Update logic once the register allocator is further along.
     {
       ASM_CODE_COMMENT_STRING(masm(), "Initializing stack slots");
       __ Move(rax, Immediate(0));
-      __ Move(rcx, Immediate(code_gen_state_->stack_slots()));
+      __ Move(rcx, Immediate(new_stack_slots));
       __ leaq(rdi, code_gen_state_->TopOfStack());
       __ repstosq();
     }
@@ -225,6 +244,13 @@ class MaglevCodeGeneratingNodeProcessor {
       return;
     }
 
+    // A loop phi that flows back into itself is already in place.
+    if (source.IsAnyStackSlot() &&
+        code_gen_state_->GetFramePointerOffsetForStackSlot(source) ==
+            code_gen_state_->GetFramePointerOffsetForStackSlot(target)) {
+      return;
+    }
+
     // stack->stack and reg->stack moves should be executed before registers are
     // clobbered by reg->reg or stack->reg, so emit them immediately.
     if (source.IsRegister()) {
@@ -437,15 +463,21 @@ class MaglevCodeGeneratorImpl final {
 
   void EmitLazyDeopt(LazyDeoptInfo* deopt_info) {
     const MaglevCompilationUnit& unit = deopt_info->unit;
-    DCHECK_NULL(unit.caller());
-    DCHECK_EQ(unit.inlining_depth(), 0);
 
-    int frame_count = 1;
-    int jsframe_count = 1;
+    int frame_count = 1 + unit.inlining_depth();
+    int jsframe_count = frame_count;
     int update_feedback_count = 0;
     deopt_info->translation_index = translation_array_builder_.BeginTranslation(
         frame_count, jsframe_count, update_feedback_count);
 
+    // Only the innermost frame receives the result of the call, the frames of
+    // the callers are emitted like for eager deopts.
+    const InputLocation* input_locations = deopt_info->input_locations;
+    if (deopt_info->state.parent) {
+      input_locations = EmitDeoptFrame(
+          *unit.caller(), *deopt_info->state.parent, input_locations);
+    }
+
     // Return offsets are counted from the end of the translation frame, which
     // is the array [parameters..., locals..., accumulator].
     int return_offset;
@@ -475,8 +507,7 @@ class MaglevCodeGeneratorImpl final {
         unit.register_count(), return_offset, return_count);
 
     EmitDeoptFrameValues(unit, deopt_info->state.register_frame,
-                         deopt_info->input_locations,
-                         deopt_info->result_location);
+                         input_locations, deopt_info->result_location);
   }
 
   void EmitDeoptStoreRegister(const compiler::AllocatedOperand& operand,
@@ -570,9 +601,15 @@ class MaglevCodeGeneratorImpl final {
     }
 
     // Context
-    int context_index =
-        DeoptStackSlotIndexFromFPOffset(StandardFrameConstants::kContextOffset);
-    translation_array_builder_.StoreStackSlot(context_index);
+    if (compilation_unit.inlining_depth() == 0) {
+      int context_index = DeoptStackSlotIndexFromFPOffset(
+          StandardFrameConstants::kContextOffset);
+      translation_array_builder_.StoreStackSlot(context_index);
+    } else {
+      // Inlined functions are known constants, and so is their context.
+      translation_array_builder_.StoreLiteral(
+          GetDeoptLiteral(*compilation_unit.function().context().object()));
+    }
 
     // Locals
     {
@@ -630,6 +667,7 @@ class MaglevCodeGeneratorImpl final {
     return Factory::CodeBuilder{isolate(), desc, CodeKind::MAGLEV}
         .set_stack_slots(stack_slot_count_with_fixed_frame())
         .set_deoptimization_data(GenerateDeoptimizationData())
+        .set_osr_offset(code_gen_state_.compilation_info()->osr_offset())
         .TryBuild();
   }
 
@@ -639,14 +677,15 @@ class MaglevCodeGeneratorImpl final {
     int lazy_deopt_count =
         static_cast<int>(code_gen_state_.lazy_deopts().size());
     int deopt_count = lazy_deopt_count + eager_deopt_count;
-    if (deopt_count == 0) {
+    // OSR code always needs deoptimization data for its OSR entry point.
+    if (deopt_count == 0 && !code_gen_state_.compilation_info()->is_osr()) {
       return DeoptimizationData::Empty(isolate());
     }
     Handle<DeoptimizationData> data =
         DeoptimizationData::New(isolate(), deopt_count, AllocationType::kOld);
 
     Handle<TranslationArray> translation_array =
-        translation_array_builder_.ToTranslationArray(isolate()->factory());
+        translation_array_builder_.ToTranslationArray(isolate());
 
     data->SetTranslationByteArray(*translation_array);
     // TODO(leszeks): Fix with the real inlined function count.
@@ -679,10 +718,10 @@ class MaglevCodeGeneratorImpl final {
         PodArray<InliningPosition>::New(isolate(), 0);
     data->SetInliningPositions(*inlining_positions);
 
-    // TODO(leszeks): Fix once we have OSR.
-    BytecodeOffset osr_offset = BytecodeOffset::None();
+    BytecodeOffset osr_offset =
+        code_gen_state_.compilation_info()->osr_offset();
     data->SetOsrBytecodeOffset(Smi::FromInt(osr_offset.ToInt()));
-    data->SetOsrPcOffset(Smi::FromInt(-1));
+    data->SetOsrPcOffset(Smi::FromInt(code_gen_state_.osr_pc_offset()));
 
     // Populate deoptimization entries.
     int i = 0;
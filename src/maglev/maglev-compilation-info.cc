@@ -50,9 +50,11 @@ class V8_NODISCARD MaglevCompilationHandleScope final {
 }  // namespace
 
 MaglevCompilationInfo::MaglevCompilationInfo(Isolate* isolate,
-                                             Handle<JSFunction> function)
+                                             Handle<JSFunction> function,
+                                             BytecodeOffset osr_offset)
     : zone_(isolate->allocator(), kMaglevZoneName),
       isolate_(isolate),
+      osr_offset_(osr_offset),
       broker_(new compiler::JSHeapBroker(
           isolate, zone(), FLAG_trace_heap_broker, CodeKind::MAGLEV))
 #define V(Name) , Name##_(FLAG_##Name)
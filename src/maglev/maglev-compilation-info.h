@@ -9,6 +9,7 @@
 
 #include "src/handles/handles.h"
 #include "src/handles/maybe-handles.h"
+#include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
@@ -38,10 +39,11 @@ class MaglevGraphLabeller;
 class MaglevCompilationInfo final {
  public:
   static std::unique_ptr<MaglevCompilationInfo> New(
-      Isolate* isolate, Handle<JSFunction> function) {
+      Isolate* isolate, Handle<JSFunction> function,
+      BytecodeOffset osr_offset = BytecodeOffset::None()) {
     // Doesn't use make_unique due to the private ctor.
     return std::unique_ptr<MaglevCompilationInfo>(
-        new MaglevCompilationInfo(isolate, function));
+        new MaglevCompilationInfo(isolate, function, osr_offset));
   }
   ~MaglevCompilationInfo();
 
@@ -52,6 +54,11 @@ class MaglevCompilationInfo final {
     return toplevel_compilation_unit_;
   }
 
+  // The bytecode offset of the JumpLoop that enters the code through
+  // on-stack replacement, or None for regular function entry.
+  BytecodeOffset osr_offset() const { return osr_offset_; }
+  bool is_osr() const { return !osr_offset_.IsNone(); }
+
   bool has_graph_labeller() const { return !!graph_labeller_; }
   void set_graph_labeller(MaglevGraphLabeller* graph_labeller);
   MaglevGraphLabeller* graph_labeller() const {
@@ -83,10 +90,12 @@ class MaglevCompilationInfo final {
   std::unique_ptr<CanonicalHandlesMap> DetachCanonicalHandles();
 
  private:
-  MaglevCompilationInfo(Isolate* isolate, Handle<JSFunction> function);
+  MaglevCompilationInfo(Isolate* isolate, Handle<JSFunction> function,
+                        BytecodeOffset osr_offset);
 
   Zone zone_;
   Isolate* const isolate_;
+  const BytecodeOffset osr_offset_;
   const std::unique_ptr<compiler::JSHeapBroker> broker_;
   // Must be initialized late since it requires an initialized heap broker.
   MaglevCompilationUnit* toplevel_compilation_unit_ = nullptr;
@@ -30,7 +30,10 @@ MaglevCompilationUnit::MaglevCompilationUnit(
       bytecode_(shared_function_info_.GetBytecodeArray()),
       feedback_(
           function_.feedback_vector(info_->broker()->dependencies()).value()),
-      bytecode_analysis_(bytecode_.object(), zone(), BytecodeOffset::None(),
+      // Only the toplevel function can be entered through OSR.
+      bytecode_analysis_(bytecode_.object(), zone(),
+                         caller == nullptr ? info->osr_offset()
+                                           : BytecodeOffset::None(),
                          true),
       register_count_(bytecode_.register_count()),
       parameter_count_(bytecode_.parameter_count()),
@@ -78,8 +78,8 @@ void ExportedMaglevCompilationInfo::set_canonical_handles(
 
 // static
 std::unique_ptr<MaglevCompilationJob> MaglevCompilationJob::New(
-    Isolate* isolate, Handle<JSFunction> function) {
-  auto info = maglev::MaglevCompilationInfo::New(isolate, function);
+    Isolate* isolate, Handle<JSFunction> function, BytecodeOffset osr_offset) {
+  auto info = maglev::MaglevCompilationInfo::New(isolate, function, osr_offset);
   return std::unique_ptr<MaglevCompilationJob>(
       new MaglevCompilationJob(std::move(info)));
 }
@@ -107,11 +107,11 @@ CompilationJob::Status MaglevCompilationJob::ExecuteJobImpl(
 }
 
 CompilationJob::Status MaglevCompilationJob::FinalizeJobImpl(Isolate* isolate) {
-  Handle<CodeT> codet;
-  if (!maglev::MaglevCompiler::GenerateCode(info()).ToHandle(&codet)) {
+  if (!maglev::MaglevCompiler::GenerateCode(info()).ToHandle(&code_)) {
     return CompilationJob::FAILED;
   }
-  info()->toplevel_compilation_unit()->function().object()->set_code(*codet);
+  // OSR code is only entered from the JumpLoop through the OSR code cache.
+  if (!is_osr()) function()->set_code(*code_);
   return CompilationJob::SUCCEEDED;
 }
 
@@ -119,6 +119,10 @@ Handle<JSFunction> MaglevCompilationJob::function() const {
   return info_->toplevel_compilation_unit()->function().object();
 }
 
+BytecodeOffset MaglevCompilationJob::osr_offset() const {
+  return info_->osr_offset();
+}
+
 // The JobTask is posted to V8::GetCurrentPlatform(). It's responsible for
 // processing the incoming queue on a worker thread.
 class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
@@ -188,12 +192,10 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   while (!outgoing_queue_.IsEmpty()) {
     std::unique_ptr<MaglevCompilationJob> job;
     outgoing_queue_.Dequeue(&job);
-    CompilationJob::Status status = job->FinalizeJob(isolate_);
     // TODO(v8:7700): Use the result and check if job succeed
     // when all the bytecodes are implemented.
-    if (status == CompilationJob::SUCCEEDED) {
-      Compiler::FinalizeMaglevCompilationJob(job.get(), isolate_);
-    }
+    USE(job->FinalizeJob(isolate_));
+    Compiler::FinalizeMaglevCompilationJob(job.get(), isolate_);
   }
 }
 
@@ -45,8 +45,9 @@ class ExportedMaglevCompilationInfo final {
 // The job is a single actual compilation task.
 class MaglevCompilationJob final : public OptimizedCompilationJob {
  public:
-  static std::unique_ptr<MaglevCompilationJob> New(Isolate* isolate,
-                                                   Handle<JSFunction> function);
+  static std::unique_ptr<MaglevCompilationJob> New(
+      Isolate* isolate, Handle<JSFunction> function,
+      BytecodeOffset osr_offset = BytecodeOffset::None());
   virtual ~MaglevCompilationJob();
 
   Status PrepareJobImpl(Isolate* isolate) override;
@@ -55,6 +56,11 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   Status FinalizeJobImpl(Isolate* isolate) override;
 
   Handle<JSFunction> function() const;
+  BytecodeOffset osr_offset() const;
+  bool is_osr() const { return !osr_offset().IsNone(); }
+  // The generated code, available after a successful FinalizeJob. OSR code is
+  // not installed on the function.
+  Handle<CodeT> code() const { return code_; }
 
  private:
   explicit MaglevCompilationJob(std::unique_ptr<MaglevCompilationInfo>&& info);
@@ -62,6 +68,7 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   MaglevCompilationInfo* info() const { return info_.get(); }
 
   const std::unique_ptr<MaglevCompilationInfo> info_;
+  Handle<CodeT> code_;
 };
 
 // The public API for Maglev concurrent compilation.
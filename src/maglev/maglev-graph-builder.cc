@@ -4,6 +4,7 @@
 
 #include "src/maglev/maglev-graph-builder.h"
 
+#include "src/base/small-vector.h"
 #include "src/common/globals.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/feedback-source.h"
@@ -82,8 +83,9 @@ void MaglevGraphBuilder::StartPrologue() {
 }
 
 BasicBlock* MaglevGraphBuilder::EndPrologue() {
-  BasicBlock* first_block = CreateBlock<Jump>({}, &jump_targets_[0]);
-  MergeIntoFrameState(first_block, 0);
+  BasicBlock* first_block =
+      CreateBlock<Jump>({}, &jump_targets_[entry_offset()]);
+  MergeIntoFrameState(first_block, entry_offset());
   return first_block;
 }
 
@@ -96,10 +98,17 @@ void MaglevGraphBuilder::BuildRegisterFrameInitialization() {
   // TODO(leszeks): Extract out a separate "incoming context/closure" nodes,
   // to be able to read in the machine register but also use the frame-spilled
   // slot.
-  interpreter::Register regs[] = {interpreter::Register::current_context(),
-                                  interpreter::Register::function_closure()};
-  for (interpreter::Register& reg : regs) {
-    current_interpreter_frame_.set(reg, AddNewNode<InitialValue>({}, reg));
+  if (is_inline()) {
+    // The inlined function is a known constant, and so is its context.
+    SetContext(GetConstant(compilation_unit_->function().context()));
+    current_interpreter_frame_.set(interpreter::Register::function_closure(),
+                                   GetConstant(compilation_unit_->function()));
+  } else {
+    interpreter::Register regs[] = {interpreter::Register::current_context(),
+                                    interpreter::Register::function_closure()};
+    for (interpreter::Register& reg : regs) {
+      current_interpreter_frame_.set(reg, AddNewNode<InitialValue>({}, reg));
+    }
   }
 
   interpreter::Register new_target_or_generator_register =
@@ -125,6 +134,41 @@ void MaglevGraphBuilder::BuildRegisterFrameInitialization() {
   }
 }
 
+void MaglevGraphBuilder::BuildOsrFrameInitialization() {
+  DCHECK(is_osr());
+  int osr_entry = entry_offset();
+  DCHECK(bytecode_analysis().IsLoopHeader(osr_entry));
+  // Loops nested in other loops would require peeling the outer loops, so
+  // only outermost loops are OSR'd into Maglev.
+  DCHECK_EQ(bytecode_analysis().GetLoopInfoFor(osr_entry).parent_offset(), -1);
+
+  // The unoptimized frame is still on the stack, so all values come from
+  // its slots.
+  interpreter::Register regs[] = {interpreter::Register::current_context(),
+                                  interpreter::Register::function_closure()};
+  for (interpreter::Register& reg : regs) {
+    current_interpreter_frame_.set(reg, AddNewNode<InitialValue>({}, reg));
+  }
+
+  const compiler::BytecodeLivenessState* liveness =
+      bytecode_analysis().GetInLivenessFor(osr_entry);
+  DCHECK(!liveness->AccumulatorIsLive());
+  ValueNode* undefined_value = nullptr;
+  for (int i = 0; i < register_count(); i++) {
+    interpreter::Register reg(i);
+    if (liveness->RegisterIsLive(i)) {
+      StoreRegister(reg, AddNewNode<InitialValue>({}, reg));
+      continue;
+    }
+    // Dead registers are dropped at the loop header anyway.
+    if (undefined_value == nullptr) {
+      undefined_value =
+          AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
+    }
+    StoreRegister(reg, undefined_value);
+  }
+}
+
 // TODO(v8:7700): Clean up after all bytecodes are supported.
 #define MAGLEV_UNIMPLEMENTED(BytecodeName)                              \
   do {                                                                  \
@@ -734,16 +778,55 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertyStrict)
 MAGLEV_UNIMPLEMENTED_BYTECODE(DeletePropertySloppy)
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetSuperConstructor)
 
+bool MaglevGraphBuilder::ShouldInlineCall(compiler::JSFunctionRef function,
+                                          ConvertReceiverMode receiver_mode) {
+  compiler::SharedFunctionInfoRef shared = function.shared();
+  const char* reason = nullptr;
+  int bytecode_size = 0;
+  if (!shared.IsInlineable()) {
+    reason = "not inlineable";
+  } else if (IsClassConstructor(shared.kind())) {
+    // Calling a class constructor throws.
+    reason = "class constructor";
+  } else if (is_sloppy(shared.language_mode()) && !shared.native() &&
+             receiver_mode != ConvertReceiverMode::kNullOrUndefined) {
+    // TODO(v8:7700): Convert the receiver to an object.
+    reason = "receiver conversion";
+  } else if (compilation_unit_->inlining_depth() >=
+             FLAG_max_maglev_inline_depth) {
+    reason = "inline depth";
+  } else {
+    bytecode_size = shared.GetBytecodeArray().length();
+    if (bytecode_size > FLAG_max_maglev_inlined_bytecode_size) {
+      reason = "bytecode size";
+    } else if (outermost_graph_builder()->inlined_bytecode_size_ +
+                   bytecode_size >
+               FLAG_max_maglev_inlined_bytecode_size_cumulative) {
+      reason = "cumulative bytecode size";
+    }
+  }
+  if (reason != nullptr) {
+    if (FLAG_trace_maglev_inlining) {
+      std::cout << "Not inlining " << Brief(*function.object()) << " into "
+                << Brief(*compilation_unit_->function().object()) << " ("
+                << reason << ")" << std::endl;
+    }
+    return false;
+  }
+  if (FLAG_trace_maglev_inlining) {
+    std::cout << "Inlining " << Brief(*function.object()) << " into "
+              << Brief(*compilation_unit_->function().object()) << std::endl;
+  }
+  outermost_graph_builder()->inlined_bytecode_size_ += bytecode_size;
+  return true;
+}
+
 void MaglevGraphBuilder::InlineCallFromRegisters(
     int argc_count, ConvertReceiverMode receiver_mode,
     compiler::JSFunctionRef function) {
-  // The undefined constant node has to be created before the inner graph is
-  // created.
-  RootConstant* undefined_constant;
-  if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
-    undefined_constant =
-        AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
-  }
+  // The inlined body is only valid for the function from the call feedback.
+  // Otherwise, deopt before the call, which makes the interpreter do it.
+  AddNewNode<CheckValue>({LoadRegisterTagged(0)}, function);
 
   // Create a new compilation unit and graph builder for the inlined
   // function.
@@ -752,36 +835,55 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
   MaglevGraphBuilder inner_graph_builder(local_isolate_, inner_unit, graph_,
                                          this);
 
-  // Finish the current block with a jump to the inlined function.
-  BasicBlockRef start_ref, end_ref;
-  BasicBlock* block = CreateBlock<JumpToInlined>({}, &start_ref, inner_unit);
-  ResolveJumpsToBlockAtOffset(block, block_offset_);
-
-  // Manually create the prologue of the inner function graph, so that we
-  // can manually set up the arguments.
-  inner_graph_builder.StartPrologue();
-
-  int arg_index = 0;
+  // Collect the receiver and arguments of the inlined function while the
+  // current block is still open, since loading them might need conversions.
+  // Missing arguments are undefined, and superfluous ones are dropped.
+  base::SmallVector<ValueNode*, 8> arguments;
+  ValueNode* undefined_constant =
+      AddNewNode<RootConstant>({}, RootIndex::kUndefinedValue);
   int reg_count;
   if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
     reg_count = argc_count;
-    if (function.shared().language_mode() == LanguageMode::kSloppy) {
-      // TODO(leszeks): Store the global proxy somehow.
-      inner_graph_builder.SetArgument(arg_index++, undefined_constant);
+    compiler::SharedFunctionInfoRef shared = function.shared();
+    if (is_sloppy(shared.language_mode()) && !shared.native()) {
+      arguments.push_back(GetConstant(
+          broker()->target_native_context().global_proxy_object()));
     } else {
-      inner_graph_builder.SetArgument(arg_index++, undefined_constant);
+      arguments.push_back(undefined_constant);
     }
   } else {
     reg_count = argc_count + 1;
   }
-  for (int i = 0; i < reg_count && i < inner_unit->parameter_count(); i++) {
-    inner_graph_builder.SetArgument(arg_index++, LoadRegisterTagged(i + 1));
+  for (int i = 0; i < reg_count &&
+                  static_cast<int>(arguments.size()) <
+                      inner_unit->parameter_count();
+       i++) {
+    arguments.push_back(LoadRegisterTagged(i + 1));
   }
-  for (; arg_index < inner_unit->parameter_count(); arg_index++) {
-    inner_graph_builder.SetArgument(arg_index, undefined_constant);
+  while (static_cast<int>(arguments.size()) < inner_unit->parameter_count()) {
+    arguments.push_back(undefined_constant);
+  }
+
+  // Deopts in the inlined function resume this frame after the call, so the
+  // registers live across the call are the ones live before it.
+  inner_graph_builder.caller_state_ =
+      zone()->New<CheckpointedInterpreterState>(
+          BytecodeOffset(iterator_.current_offset()),
+          zone()->New<CompactInterpreterFrameState>(
+              *compilation_unit_, GetInLiveness(), current_interpreter_frame_),
+          caller_state_);
+
+  // Finish the current block with a jump to the inlined function.
+  BasicBlockRef start_ref, end_ref;
+  BasicBlock* block = CreateBlock<JumpToInlined>({}, &start_ref, inner_unit);
+  ResolveJumpsToBlockAtOffset(block, block_offset_);
+
+  // Manually create the prologue of the inner function graph, so that we
+  // can manually set up the arguments.
+  inner_graph_builder.StartPrologue();
+  for (int i = 0; i < inner_unit->parameter_count(); i++) {
+    inner_graph_builder.SetArgument(i, arguments[i]);
   }
-  // TODO(leszeks): Also correctly set up the closure and context slots, instead
-  // of using InitialValue.
   inner_graph_builder.BuildRegisterFrameInitialization();
   BasicBlock* inlined_prologue = inner_graph_builder.EndPrologue();
 
@@ -794,6 +896,10 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
 
   // Build the inlined function body.
   inner_graph_builder.BuildBody();
+  if (inner_graph_builder.found_unsupported_bytecode()) {
+    found_unsupported_bytecode_ = true;
+    return;
+  }
 
   // All returns in the inlined body jump to a merge point one past the
   // bytecode length (i.e. at offset bytecode.length()). Create a block at
@@ -831,6 +937,10 @@ void MaglevGraphBuilder::InlineCallFromRegisters(
   // instead.
   end_ref.SetToBlockAndReturnNext(current_block_)
       ->SetToBlockAndReturnNext(current_block_);
+
+  // The inlined function might have had side effects, so the call can't be
+  // repeated by a later eager deopt.
+  MarkPossibleSideEffect();
 }
 
 // TODO(v8:7700): Read feedback and implement inlining
@@ -901,6 +1011,7 @@ void MaglevGraphBuilder::BuildCallFromRegisters(
           function.feedback_vector(broker()->dependencies());
       if (!maybe_feedback_vector.has_value()) break;
 
+      if (!ShouldInlineCall(function, receiver_mode)) break;
       return InlineCallFromRegisters(argc_count, receiver_mode, function);
     }
 
@@ -1235,7 +1346,16 @@ MAGLEV_UNIMPLEMENTED_BYTECODE(SuspendGenerator)
 MAGLEV_UNIMPLEMENTED_BYTECODE(ResumeGenerator)
 MAGLEV_UNIMPLEMENTED_BYTECODE(GetIterator)
 MAGLEV_UNIMPLEMENTED_BYTECODE(Debugger)
-MAGLEV_UNIMPLEMENTED_BYTECODE(IncBlockCounter)
+
+void MaglevGraphBuilder::VisitIncBlockCounter() {
+  base::Optional<compiler::CoverageInfoRef> coverage_info =
+      compilation_unit_->shared_function_info().coverage_info();
+  // Without a coverage info, the IncBlockCounter builtin does nothing.
+  if (!coverage_info.has_value()) return;
+  AddNewNode<IncrementBlockCounter>({}, *coverage_info,
+                                    iterator_.GetIndexOperand(0));
+}
+
 MAGLEV_UNIMPLEMENTED_BYTECODE(Abort)
 
 void MaglevGraphBuilder::VisitWide() { UNREACHABLE(); }
@@ -39,7 +39,11 @@ class MaglevGraphBuilder {
       SetArgument(i, AddNewNode<InitialValue>(
                          {}, interpreter::Register::FromParameterIndex(i)));
     }
-    BuildRegisterFrameInitialization();
+    if (is_osr()) {
+      BuildOsrFrameInitialization();
+    } else {
+      BuildRegisterFrameInitialization();
+    }
     EndPrologue();
     BuildBody();
   }
@@ -47,10 +51,12 @@ class MaglevGraphBuilder {
   void StartPrologue();
   void SetArgument(int i, ValueNode* value);
   void BuildRegisterFrameInitialization();
+  void BuildOsrFrameInitialization();
   BasicBlock* EndPrologue();
 
   void BuildBody() {
-    for (iterator_.Reset(); !iterator_.done(); iterator_.Advance()) {
+    for (iterator_.SetOffset(entry_offset()); !iterator_.done();
+         iterator_.Advance()) {
       VisitSingleBytecode();
       // TODO(v8:7700): Clean up after all bytecodes are supported.
       if (found_unsupported_bytecode()) break;
@@ -436,12 +442,7 @@ class MaglevGraphBuilder {
           BytecodeOffset(iterator_.current_offset()),
           zone()->New<CompactInterpreterFrameState>(
               *compilation_unit_, GetInLiveness(), current_interpreter_frame_),
-          parent_ == nullptr
-              ? nullptr
-              // TODO(leszeks): Don't always allocate for the parent state,
-              // maybe cache it on the graph builder?
-              : zone()->New<CheckpointedInterpreterState>(
-                    parent_->GetLatestCheckpointedState()));
+          caller_state_);
     }
     return *latest_checkpointed_state_;
   }
@@ -451,8 +452,7 @@ class MaglevGraphBuilder {
         BytecodeOffset(iterator_.current_offset()),
         zone()->New<CompactInterpreterFrameState>(
             *compilation_unit_, GetOutLiveness(), current_interpreter_frame_),
-        // TODO(leszeks): Support lazy deopts in inlined functions.
-        nullptr);
+        caller_state_);
   }
 
   template <typename NodeT>
@@ -544,6 +544,8 @@ class MaglevGraphBuilder {
     return block;
   }
 
+  bool ShouldInlineCall(compiler::JSFunctionRef function,
+                        ConvertReceiverMode receiver_mode);
   void InlineCallFromRegisters(int argc_count,
                                ConvertReceiverMode receiver_mode,
                                compiler::JSFunctionRef function);
@@ -598,7 +600,10 @@ class MaglevGraphBuilder {
     predecessors_ = zone()->NewArray<uint32_t>(array_length);
     MemsetUint32(predecessors_, 1, array_length);
 
-    interpreter::BytecodeArrayIterator iterator(bytecode().object());
+    // Bytecodes before the OSR entry are never visited, so they also don't
+    // contribute any predecessors.
+    interpreter::BytecodeArrayIterator iterator(bytecode().object(),
+                                                entry_offset());
     for (; !iterator.done(); iterator.Advance()) {
       interpreter::Bytecode bytecode = iterator.current_bytecode();
       if (interpreter::Bytecodes::IsJump(bytecode)) {
@@ -662,6 +667,24 @@ class MaglevGraphBuilder {
   // function.
   bool is_inline() const { return parent_ != nullptr; }
 
+  // True when the graph is entered through on-stack replacement at the loop
+  // header of the OSR loop, see BytecodeAnalysis::osr_entry_point. Only the
+  // toplevel function can be OSR'd.
+  bool is_osr() const { return !bytecode_analysis().osr_bailout_id().IsNone(); }
+
+  // The offset of the first bytecode executed by the graph.
+  int entry_offset() const {
+    return is_osr() ? bytecode_analysis().osr_entry_point() : 0;
+  }
+
+  // The graph builder of the outermost function, which owns the inlining
+  // budget.
+  MaglevGraphBuilder* outermost_graph_builder() {
+    MaglevGraphBuilder* builder = this;
+    while (builder->parent_ != nullptr) builder = builder->parent_;
+    return builder;
+  }
+
   // The fake offset used as a target for all exits of an inlined function.
   int inline_exit_offset() const {
     DCHECK(is_inline());
@@ -671,6 +694,13 @@ class MaglevGraphBuilder {
   LocalIsolate* const local_isolate_;
   MaglevCompilationUnit* const compilation_unit_;
   MaglevGraphBuilder* const parent_;
+  // The state of the caller frames at the call of an inlined function. Deopts
+  // in the inlined function also materialize these frames, which resume after
+  // the call.
+  const CheckpointedInterpreterState* caller_state_ = nullptr;
+  // The bytecode size of all functions inlined so far. Only used on the
+  // outermost graph builder.
+  int inlined_bytecode_size_ = 0;
   Graph* const graph_;
   interpreter::BytecodeArrayIterator iterator_;
   uint32_t* predecessors_;
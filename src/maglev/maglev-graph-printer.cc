@@ -302,6 +302,19 @@ void MaglevPrintingVisitor::PreProcessBasicBlock(
 
 namespace {
 
+// The input locations of the caller frames of an inlined function come before
+// the ones of the innermost frame.
+int CallerFramesInputLocationCount(const DeoptInfo* deopt_info) {
+  int count = 0;
+  const MaglevCompilationUnit* unit = deopt_info->unit.caller();
+  for (const CheckpointedInterpreterState* state = deopt_info->state.parent;
+       state != nullptr; state = state->parent) {
+    count += static_cast<int>(state->register_frame->size(*unit));
+    unit = unit->caller();
+  }
+  return count;
+}
+
 template <typename NodeT>
 void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
                      NodeT* node, const ProcessingState& state) {
@@ -313,7 +326,7 @@ void PrintEagerDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
   EagerDeoptInfo* deopt_info = node->eager_deopt_info();
   os << "  ↱ eager @" << deopt_info->state.bytecode_position << " : {";
   bool first = true;
-  int index = 0;
+  int index = CallerFramesInputLocationCount(deopt_info);
   deopt_info->state.register_frame->ForEachValue(
       deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
         if (first) {
@@ -352,7 +365,7 @@ void PrintLazyDeopt(std::ostream& os, std::vector<BasicBlock*> targets,
   LazyDeoptInfo* deopt_info = node->lazy_deopt_info();
   os << "  ↳ lazy @" << deopt_info->state.bytecode_position << " : {";
   bool first = true;
-  int index = 0;
+  int index = CallerFramesInputLocationCount(deopt_info);
   deopt_info->state.register_frame->ForEachValue(
       deopt_info->unit, [&](ValueNode* node, interpreter::Register reg) {
         if (first) {
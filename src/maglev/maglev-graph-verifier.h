@@ -68,6 +68,7 @@ class MaglevGraphVerifier {
       case Opcode::kInitialValue:
       case Opcode::kRegisterInput:
       case Opcode::kGapMove:
+      case Opcode::kIncrementBlockCounter:
       case Opcode::kDeopt:
       case Opcode::kJump:
       case Opcode::kJumpLoop:
@@ -87,6 +88,7 @@ class MaglevGraphVerifier {
       case Opcode::kLoadGlobal:
       // TODO(victorgomes): Can we check that the input is actually a map?
       case Opcode::kCheckMaps:
+      case Opcode::kCheckValue:
       // TODO(victorgomes): Can we check that the input is Boolean?
       case Opcode::kBranchIfTrue:
       case Opcode::kBranchIfToBooleanTrue:
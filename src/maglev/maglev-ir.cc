@@ -19,6 +19,7 @@
 #include "src/maglev/maglev-graph-processor.h"
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-vreg-allocator.h"
+#include "src/objects/debug-objects.h"
 
 namespace v8 {
 namespace internal {
@@ -608,6 +609,22 @@ void CheckMaps::PrintParams(std::ostream& os,
   os << "(" << *map().object() << ")";
 }
 
+void CheckValue::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                              const ProcessingState& state) {
+  UseRegister(target_input());
+}
+void CheckValue::GenerateCode(MaglevCodeGenState* code_gen_state,
+                              const ProcessingState& state) {
+  Register target = ToRegister(target_input());
+
+  __ Cmp(target, value().object());
+  EmitEagerDeoptIf(not_equal, code_gen_state, this);
+}
+void CheckValue::PrintParams(std::ostream& os,
+                             MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << *value().object() << ")";
+}
+
 void LoadTaggedField::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                    const ProcessingState& state) {
   UseRegister(object_input());
@@ -686,6 +703,24 @@ void StoreField::PrintParams(std::ostream& os,
   os << "(" << std::hex << handler() << std::dec << ")";
 }
 
+void IncrementBlockCounter::AllocateVreg(MaglevVregAllocationState* vreg_state,
+                                         const ProcessingState& state) {
+  set_temporaries_needed(1);
+}
+void IncrementBlockCounter::GenerateCode(MaglevCodeGenState* code_gen_state,
+                                         const ProcessingState& state) {
+  Register coverage_info = temporaries().PopFirst();
+  __ Move(coverage_info, this->coverage_info().object());
+  __ incl(FieldOperand(coverage_info,
+                       CoverageInfo::kHeaderSize +
+                           slot() * CoverageInfo::Slot::kSize +
+                           CoverageInfo::Slot::kBlockCountOffset));
+}
+void IncrementBlockCounter::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(" << slot() << ")";
+}
+
 void LoadNamedGeneric::AllocateVreg(MaglevVregAllocationState* vreg_state,
                                     const ProcessingState& state) {
   using D = LoadWithVectorDescriptor;
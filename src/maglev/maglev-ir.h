@@ -93,10 +93,12 @@ class CompactInterpreterFrameState;
   V(Float64Add)                 \
   GENERIC_OPERATIONS_NODE_LIST(V)
 
-#define NODE_LIST(V) \
-  V(CheckMaps)       \
-  V(GapMove)         \
-  V(StoreField)      \
+#define NODE_LIST(V)       \
+  V(CheckMaps)             \
+  V(CheckValue)            \
+  V(GapMove)               \
+  V(IncrementBlockCounter) \
+  V(StoreField)            \
   VALUE_NODE_LIST(V)
 
 #define CONDITIONAL_CONTROL_NODE_LIST(V) \
@@ -1367,6 +1369,28 @@ class CheckMaps : public FixedInputNodeT<1, CheckMaps> {
   const compiler::MapRef map_;
 };
 
+class CheckValue : public FixedInputNodeT<1, CheckValue> {
+  using Base = FixedInputNodeT<1, CheckValue>;
+
+ public:
+  explicit CheckValue(uint32_t bitfield, const compiler::HeapObjectRef& value)
+      : Base(bitfield), value_(value) {}
+
+  static constexpr OpProperties kProperties = OpProperties::EagerDeopt();
+
+  compiler::HeapObjectRef value() const { return value_; }
+
+  static constexpr int kTargetIndex = 0;
+  Input& target_input() { return input(kTargetIndex); }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::HeapObjectRef value_;
+};
+
 class LoadTaggedField : public FixedInputValueNodeT<1, LoadTaggedField> {
   using Base = FixedInputValueNodeT<1, LoadTaggedField>;
 
@@ -1436,6 +1460,32 @@ class StoreField : public FixedInputNodeT<2, StoreField> {
   const int handler_;
 };
 
+// Counts an execution of a block for block coverage.
+class IncrementBlockCounter : public FixedInputNodeT<0, IncrementBlockCounter> {
+  using Base = FixedInputNodeT<0, IncrementBlockCounter>;
+
+ public:
+  explicit IncrementBlockCounter(uint32_t bitfield,
+                                 const compiler::CoverageInfoRef& coverage_info,
+                                 int slot)
+      : Base(bitfield), coverage_info_(coverage_info), slot_(slot) {}
+
+  static constexpr OpProperties kProperties = OpProperties::Writing();
+
+  const compiler::CoverageInfoRef& coverage_info() const {
+    return coverage_info_;
+  }
+  int slot() const { return slot_; }
+
+  void AllocateVreg(MaglevVregAllocationState*, const ProcessingState&);
+  void GenerateCode(MaglevCodeGenState*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const compiler::CoverageInfoRef coverage_info_;
+  const int slot_;
+};
+
 class LoadGlobal : public FixedInputValueNodeT<1, LoadGlobal> {
   using Base = FixedInputValueNodeT<1, LoadGlobal>;
 
@@ -10,6 +10,7 @@
 #include "src/codegen/register.h"
 #include "src/codegen/reglist.h"
 #include "src/compiler/backend/instruction.h"
+#include "src/execution/frame-constants.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compilation-unit.h"
 #include "src/maglev/maglev-graph-labeller.h"
@@ -97,6 +98,14 @@ void ClearDeadFallthroughRegisters(RegisterFrameState<RegisterT> registers,
 StraightForwardRegisterAllocator::StraightForwardRegisterAllocator(
     MaglevCompilationInfo* compilation_info, Graph* graph)
     : compilation_info_(compilation_info) {
+  if (compilation_info->is_osr()) {
+    // OSR code extends the unoptimized frame, whose bytecode array, bytecode
+    // offset and register file slots come first and stay where they are.
+    tagged_.top = UnoptimizedFrameConstants::RegisterStackSlotCount(
+                      compilation_info->toplevel_compilation_unit()
+                          ->register_count()) +
+                  UnoptimizedFrameConstants::kExtraSlotCount;
+  }
   ComputePostDominatingHoles(graph);
   AllocateRegisters(graph);
   graph->set_tagged_stack_slots(tagged_.top);
@@ -354,10 +363,11 @@ void StraightForwardRegisterAllocator::UpdateUse(
   // If a value is dead, make sure it's cleared.
   FreeRegistersUsedBy(node);
 
-  // If the stack slot is a local slot, free it so it can be reused.
+  // If the stack slot is a local slot, free it so it can be reused. Phi slots
+  // are kept, see AllocateSpillSlot.
   if (node->is_spilled()) {
     compiler::AllocatedOperand slot = node->spill_slot();
-    if (slot.index() > 0) {
+    if (slot.index() >= 0 && !node->Is<Phi>()) {
       SpillSlots& slots =
           slot.representation() == MachineRepresentation::kTagged ? tagged_
                                                                   : untagged_;
@@ -378,9 +388,13 @@ void StraightForwardRegisterAllocator::UpdateUse(
 
 void StraightForwardRegisterAllocator::UpdateUse(
     const LazyDeoptInfo& deopt_info) {
+  int index = 0;
+  if (deopt_info.state.parent) {
+    UpdateUse(*deopt_info.unit.caller(), deopt_info.state.parent,
+              deopt_info.input_locations, index);
+  }
   const CompactInterpreterFrameState* checkpoint_state =
       deopt_info.state.register_frame;
-  int index = 0;
   checkpoint_state->ForEachValue(
       deopt_info.unit, [&](ValueNode* node, interpreter::Register reg) {
         // Skip over the result location.
@@ -413,6 +427,7 @@ void StraightForwardRegisterAllocator::AllocateNode(Node* node) {
         << "Allocating " << PrintNodeLabel(graph_labeller(), node)
         << " inputs...\n";
   }
+  DCHECK(pending_gap_moves_.empty());
   for (Input& input : *node) AssignInput(input);
   AssignTemporaries(node);
 
@@ -422,6 +437,7 @@ void StraightForwardRegisterAllocator::AllocateNode(Node* node) {
   if (node->Is<ValueNode>()) {
     AllocateNodeResult(node->Cast<ValueNode>());
   }
+  EmitPendingGapMoves();
 
   // Update uses only after allocating the node result. This order is necessary
   // to avoid emitting input-clobbering gap moves during node result allocation
@@ -457,7 +473,9 @@ void StraightForwardRegisterAllocator::AllocateNodeResult(ValueNode* node) {
 
   if (operand.basic_policy() == compiler::UnallocatedOperand::FIXED_SLOT) {
     DCHECK(node->Is<InitialValue>());
-    DCHECK_LT(operand.fixed_slot_index(), 0);
+    // Only OSR code reads registers from the unoptimized frame.
+    DCHECK_IMPLIES(!compilation_info_->is_osr(),
+                   operand.fixed_slot_index() < 0);
     // Set the stack slot to exactly where the value is.
     compiler::AllocatedOperand location(compiler::AllocatedOperand::STACK_SLOT,
                                         node->GetMachineRepresentation(),
@@ -593,6 +611,7 @@ void StraightForwardRegisterAllocator::AllocateControlNode(ControlNode* node,
                                                            BasicBlock* block) {
   for (Input& input : *node) AssignInput(input);
   AssignTemporaries(node);
+  EmitPendingGapMoves();
   if (node->properties().can_eager_deopt()) {
     UpdateUse(*node->eager_deopt_info());
   }
@@ -660,21 +679,84 @@ void StraightForwardRegisterAllocator::TryAllocateToInput(Phi* phi) {
   }
 }
 
+namespace {
+
+// Tagged and untagged stack slots are numbered separately, so the
+// representation is part of the location of a stack slot.
+bool IsSameLocation(const compiler::AllocatedOperand& a,
+                    const compiler::AllocatedOperand& b) {
+  if (a.IsAnyStackSlot()) {
+    return b.IsAnyStackSlot() && a.index() == b.index() &&
+           (a.representation() == MachineRepresentation::kTagged) ==
+               (b.representation() == MachineRepresentation::kTagged);
+  }
+  if (a.IsDoubleRegister()) {
+    return b.IsDoubleRegister() && a.register_code() == b.register_code();
+  }
+  DCHECK(a.IsRegister());
+  return b.IsRegister() && a.register_code() == b.register_code();
+}
+
+}  // namespace
+
 void StraightForwardRegisterAllocator::AddMoveBeforeCurrentNode(
     compiler::AllocatedOperand source, compiler::AllocatedOperand target) {
-  GapMove* gap_move =
-      Node::New<GapMove>(compilation_info_->zone(), {}, source, target);
-  if (compilation_info_->has_graph_labeller()) {
-    graph_labeller()->RegisterNode(gap_move);
+  if (IsSameLocation(source, target)) return;
+
+  // The moves of a gap are executed in order, so a move back to where the
+  // value was just copied from is redundant as long as neither location has
+  // been written to since.
+  for (auto it = pending_gap_moves_.rbegin(); it != pending_gap_moves_.rend();
+       ++it) {
+    if (IsSameLocation(it->target, source) &&
+        IsSameLocation(it->source, target)) {
+      if (FLAG_trace_maglev_regalloc) {
+        printing_visitor_->os() << "gap move: " << target << " ← " << source
+                                << " is redundant" << std::endl;
+      }
+      return;
+    }
+    if (IsSameLocation(it->target, source) ||
+        IsSameLocation(it->target, target)) {
+      break;
+    }
   }
-  if (*node_it_ == nullptr) {
-    // We're at the control node, so append instead.
-    (*block_it_)->nodes().Add(gap_move);
-    node_it_ = (*block_it_)->nodes().end();
-  } else {
-    DCHECK_NE(node_it_, (*block_it_)->nodes().end());
-    node_it_.InsertBefore(gap_move);
+
+  // An earlier move to the same target is dead if its result hasn't been
+  // read by any move in between.
+  for (auto it = pending_gap_moves_.rbegin(); it != pending_gap_moves_.rend();
+       ++it) {
+    if (IsSameLocation(it->source, target)) break;
+    if (IsSameLocation(it->target, target)) {
+      if (FLAG_trace_maglev_regalloc) {
+        printing_visitor_->os() << "gap move: " << it->target << " ← "
+                                << it->source << " is dead" << std::endl;
+      }
+      pending_gap_moves_.erase(std::next(it).base());
+      break;
+    }
+  }
+
+  pending_gap_moves_.push_back({source, target});
+}
+
+void StraightForwardRegisterAllocator::EmitPendingGapMoves() {
+  for (const PendingGapMove& move : pending_gap_moves_) {
+    GapMove* gap_move = Node::New<GapMove>(compilation_info_->zone(), {},
+                                           move.source, move.target);
+    if (compilation_info_->has_graph_labeller()) {
+      graph_labeller()->RegisterNode(gap_move);
+    }
+    if (*node_it_ == nullptr) {
+      // We're at the control node, so append instead.
+      (*block_it_)->nodes().Add(gap_move);
+      node_it_ = (*block_it_)->nodes().end();
+    } else {
+      DCHECK_NE(node_it_, (*block_it_)->nodes().end());
+      node_it_.InsertBefore(gap_move);
+    }
   }
+  pending_gap_moves_.clear();
 }
 
 void StraightForwardRegisterAllocator::Spill(ValueNode* node) {
@@ -769,21 +851,27 @@ void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
   // architectures.
   SpillSlots& slots = is_tagged ? tagged_ : untagged_;
   MachineRepresentation representation = node->GetMachineRepresentation();
-  if (slots.free_slots.empty()) {
-    free_slot = slots.top++;
+  // The value is stored to its spill slot right after it is defined, so the
+  // slot has to be free for the whole live range. Since the free slots are
+  // sorted by the position at which they were freed, the candidates are a
+  // prefix of the list, and the last of them is the best fit: it leaves the
+  // slots freed earlier to values whose live ranges start earlier.
+  //
+  // Phis are excluded: their slots are written by the gap moves at the end of
+  // each predecessor, which aren't ordered against the reads of other stack
+  // slots in the same gap.
+  NodeIdT start = node->live_range().start;
+  auto it = std::lower_bound(
+      slots.free_slots.begin(), slots.free_slots.end(), start,
+      [](const SpillSlotInfo& slot_info, NodeIdT s) {
+        return slot_info.freed_at_position < s;
+      });
+  if (!node->Is<Phi>() && it != slots.free_slots.begin()) {
+    --it;
+    free_slot = it->slot_index;
+    slots.free_slots.erase(it);
   } else {
-    NodeIdT start = node->live_range().start;
-    auto it =
-        std::upper_bound(slots.free_slots.begin(), slots.free_slots.end(),
-                         start, [](NodeIdT s, const SpillSlotInfo& slot_info) {
-                           return slot_info.freed_at_position < s;
-                         });
-    if (it != slots.free_slots.end()) {
-      free_slot = it->slot_index;
-      slots.free_slots.erase(it);
-    } else {
-      free_slot = slots.top++;
-    }
+    free_slot = slots.top++;
   }
   node->Spill(compiler::AllocatedOperand(compiler::AllocatedOperand::STACK_SLOT,
                                          representation, free_slot));
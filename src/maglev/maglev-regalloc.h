@@ -113,6 +113,15 @@ class StraightForwardRegisterAllocator {
   SpillSlots untagged_;
   SpillSlots tagged_;
 
+  // Gap moves requested while allocating the current node. They are buffered
+  // so that redundant moves can be dropped before they are inserted into the
+  // graph, see AddMoveBeforeCurrentNode.
+  struct PendingGapMove {
+    compiler::AllocatedOperand source;
+    compiler::AllocatedOperand target;
+  };
+  std::vector<PendingGapMove> pending_gap_moves_;
+
   void ComputePostDominatingHoles(Graph* graph);
   void AllocateRegisters(Graph* graph);
 
@@ -135,6 +144,7 @@ class StraightForwardRegisterAllocator {
 
   void AddMoveBeforeCurrentNode(compiler::AllocatedOperand source,
                                 compiler::AllocatedOperand target);
+  void EmitPendingGapMoves();
 
   void AllocateSpillSlot(ValueNode* node);
   void Spill(ValueNode* node);
@@ -35,6 +35,60 @@ constexpr uint64_t kNegativeGuardSize = uint64_t{2} * GB;
 
 #if V8_TARGET_ARCH_64_BIT
 constexpr uint64_t kFullGuardSize = uint64_t{10} * GB;
+
+// A process-wide pool of released guard region reservations (see
+// --wasm-guard-region-pool-size). Reusing them saves the mmap/munmap pair per
+// memory and avoids address space churn for short-lived memories.
+struct GuardRegionPoolImpl {
+  base::Mutex mutex_;
+  // Reservations of {kFullGuardSize} bytes with all pages decommitted, i.e.
+  // inaccessible and zero-initialized on next access, together with the page
+  // allocator they belong to. The most recently released reservation is
+  // reused first.
+  std::vector<std::pair<PageAllocator*, void*>> reservations_;
+};
+base::LazyInstance<GuardRegionPoolImpl>::type guard_region_pool_ =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Takes a reservation out of the pool, or returns nullptr if the pool is
+// empty. Sets {page_allocator} to the allocator owning the reservation.
+void* TakePooledGuardRegion(PageAllocator** page_allocator) {
+  GuardRegionPoolImpl* pool = guard_region_pool_.Pointer();
+  base::MutexGuard lock(&pool->mutex_);
+  if (pool->reservations_.empty()) return nullptr;
+  *page_allocator = pool->reservations_.back().first;
+  void* reservation_start = pool->reservations_.back().second;
+  pool->reservations_.pop_back();
+  return reservation_start;
+}
+
+// Returns whether the reservation starting at {reservation_start} was put into
+// the pool. The first {used_size} bytes of the buffer (after the negative guard
+// region) are decommitted before.
+bool ReleaseGuardRegionToPool(PageAllocator* page_allocator,
+                              void* reservation_start, size_t used_size) {
+  if (FLAG_wasm_guard_region_pool_size == 0) return false;
+  GuardRegionPoolImpl* pool = guard_region_pool_.Pointer();
+  auto pool_full = [pool] {
+    base::MutexGuard lock(&pool->mutex_);
+    return pool->reservations_.size() >= FLAG_wasm_guard_region_pool_size;
+  };
+  if (pool_full()) return false;
+  // Decommit outside of the lock, this is a system call.
+  void* buffer_start =
+      reinterpret_cast<byte*>(reservation_start) + kNegativeGuardSize;
+  if (used_size > 0 &&
+      !page_allocator->DecommitPages(buffer_start,
+                                     RoundUp(used_size, CommitPageSize()))) {
+    return false;
+  }
+  base::MutexGuard lock(&pool->mutex_);
+  if (pool->reservations_.size() >= FLAG_wasm_guard_region_pool_size) {
+    return false;
+  }
+  pool->reservations_.emplace_back(page_allocator, reservation_start);
+  return true;
+}
 #endif
 
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -241,6 +295,20 @@ BackingStore::~BackingStore() {
     auto region =
         GetReservedRegion(has_guard_regions_, buffer_start_, byte_capacity_);
 
+#if V8_TARGET_ARCH_64_BIT
+    // Keep the reservation for reuse if possible. All pages that could have
+    // been committed are decommitted.
+    if (has_guard_regions_ &&
+        ReleaseGuardRegionToPool(page_allocator,
+                                 reinterpret_cast<void*>(region.begin()),
+                                 byte_capacity_)) {
+      TRACE_BS("BSw:pool  bs=%p reservation=%p\n", this,
+               reinterpret_cast<void*>(region.begin()));
+      Clear();
+      return;
+    }
+#endif
+
     if (!region.is_empty()) {
       FreePages(page_allocator, reinterpret_cast<void*>(region.begin()),
                 region.size());
@@ -282,6 +350,23 @@ BackingStore::~BackingStore() {
   Clear();
 }
 
+bool BackingStore::ReleaseAllocationForBatchedFree(
+    v8::ArrayBuffer::Allocator* allocator, void** buffer_start,
+    size_t* byte_length) {
+  if (buffer_start_ == nullptr || !free_on_destruct_ || custom_deleter_ ||
+      is_wasm_memory_ || is_resizable_ || is_shared_ || globally_registered_) {
+    return false;
+  }
+  if (get_v8_api_array_buffer_allocator() != allocator) return false;
+  TRACE_BS("BS:release bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+           buffer_start_, this->byte_length(), byte_capacity_);
+  *buffer_start = buffer_start_;
+  *byte_length = this->byte_length();
+  // The destructor skips deallocation for backing stores without memory.
+  buffer_start_ = nullptr;
+  return true;
+}
+
 // Allocate a backing store using the array buffer allocator from the embedder.
 std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
@@ -426,6 +511,16 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
   void* allocation_base = nullptr;
   PageAllocator* page_allocator = GetPlatformPageAllocator();
   auto allocate_pages = [&] {
+#if V8_TARGET_ARCH_64_BIT && V8_ENABLE_WEBASSEMBLY
+    if (guards) {
+      DCHECK_EQ(kFullGuardSize, reservation_size);
+      allocation_base = TakePooledGuardRegion(&page_allocator);
+      if (allocation_base) {
+        TRACE_BS("BSw:try   reusing pooled reservation %p\n", allocation_base);
+        return true;
+      }
+    }
+#endif
 #ifdef V8_SANDBOX
     page_allocator = GetSandboxPageAllocator();
     allocation_base = AllocatePages(page_allocator, nullptr, reservation_size,
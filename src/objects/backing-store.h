@@ -113,6 +113,15 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   // Wrapper around ArrayBuffer::Allocator::Reallocate.
   bool Reallocate(Isolate* isolate, size_t new_byte_length);
 
+  // Transfers ownership of the memory to the caller if it was allocated
+  // through {allocator} and would be released via ArrayBuffer::Allocator::Free
+  // on destruction. The caller becomes responsible for freeing the memory,
+  // e.g. through ArrayBuffer::Allocator::FreeBatch. Must only be called on
+  // the last reference to the backing store.
+  bool ReleaseAllocationForBatchedFree(v8::ArrayBuffer::Allocator* allocator,
+                                       void** buffer_start,
+                                       size_t* byte_length);
+
 #if V8_ENABLE_WEBASSEMBLY
   // Attempt to grow this backing store in place.
   base::Optional<size_t> GrowWasmMemoryInPlace(Isolate* isolate,
@@ -610,6 +610,46 @@ MaybeHandle<Script> CallSiteInfo::GetScript(Isolate* isolate,
   return kNullMaybeHandle;
 }
 
+// static
+bool RawCallSiteFrames::Is(FixedArray frames) {
+  // Arrays of CallSiteInfo objects never start with a Smi.
+  return frames.length() > 0 && frames.get(kFrameCountIndex).IsSmi();
+}
+
+// static
+bool RawCallSiteFrames::Equals(FixedArray a, FixedArray b) {
+  DCHECK(Is(a));
+  DCHECK(Is(b));
+  if (a.length() != b.length()) return false;
+  for (int i = 0; i < a.length(); ++i) {
+    if (a.get(i) != b.get(i)) return false;
+  }
+  return true;
+}
+
+// static
+Handle<FixedArray> RawCallSiteFrames::ToCallSiteInfos(
+    Isolate* isolate, Handle<FixedArray> frames) {
+  DCHECK(Is(*frames));
+  int frame_count = Smi::ToInt(frames->get(kFrameCountIndex));
+  Handle<FixedArray> call_site_infos =
+      isolate->factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    int base = kFirstFrameIndex + i * kFrameSize;
+    Handle<CallSiteInfo> info = isolate->factory()->NewCallSiteInfo(
+        handle(frames->get(base + kReceiverOrInstanceOffset), isolate),
+        handle(frames->get(base + kFunctionOffset), isolate),
+        handle(HeapObject::cast(frames->get(base + kCodeObjectOffset)),
+               isolate),
+        Smi::ToInt(frames->get(base + kCodeOffsetOffset)),
+        Smi::ToInt(frames->get(base + kFlagsOffset)),
+        handle(FixedArray::cast(frames->get(base + kParametersOffset)),
+               isolate));
+    call_site_infos->set(i, *info);
+  }
+  return call_site_infos;
+}
+
 namespace {
 
 bool IsNonEmptyString(Handle<Object> object) {
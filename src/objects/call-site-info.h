@@ -105,6 +105,41 @@ class CallSiteInfo : public TorqueGeneratedCallSiteInfo<CallSiteInfo, Struct> {
   TQ_OBJECT_CONSTRUCTORS(CallSiteInfo)
 };
 
+// The compact form of a simple stack trace that is captured for Error.stack
+// with --lazy-call-site-infos. Instead of one CallSiteInfo per frame, a
+// single FixedArray holds the frame count followed by the CallSiteInfo
+// fields of every frame. The CallSiteInfo objects are only created once the
+// stack trace is accessed.
+class RawCallSiteFrames : public AllStatic {
+ public:
+  static constexpr int kFrameCountIndex = 0;
+  static constexpr int kFirstFrameIndex = 1;
+
+  static constexpr int kReceiverOrInstanceOffset = 0;
+  static constexpr int kFunctionOffset = 1;
+  static constexpr int kCodeObjectOffset = 2;
+  static constexpr int kCodeOffsetOffset = 3;
+  static constexpr int kFlagsOffset = 4;
+  static constexpr int kParametersOffset = 5;
+  static constexpr int kFrameSize = 6;
+
+  static int LengthFor(int frame_count) {
+    return kFirstFrameIndex + frame_count * kFrameSize;
+  }
+
+  // Returns true if |frames| is in the raw form rather than an array of
+  // CallSiteInfo objects.
+  static bool Is(FixedArray frames);
+
+  // Returns true if both arrays hold the same frames with identical fields,
+  // such that one can be used in place of the other.
+  static bool Equals(FixedArray a, FixedArray b);
+
+  // Creates the array of CallSiteInfo objects for the raw |frames|.
+  static Handle<FixedArray> ToCallSiteInfos(Isolate* isolate,
+                                            Handle<FixedArray> frames);
+};
+
 class IncrementalStringBuilder;
 void SerializeCallSiteInfo(Isolate* isolate, Handle<CallSiteInfo> frame,
                            IncrementalStringBuilder* builder);
@@ -13,6 +13,8 @@
 #include "src/codegen/source-position.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/isolate-utils-inl.h"
+#include "src/execution/local-isolate-inl.h"
+#include "src/heap/local-factory-inl.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-decoder.h"
 #include "src/interpreter/interpreter.h"
@@ -45,13 +47,19 @@ inline EmbeddedData EmbeddedDataWithMaybeRemappedEmbeddedBuiltins(
   return EmbeddedData::FromBlob(GetIsolateFromWritableObject(code));
 #elif defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
   // When pointer compression is enabled with a shared cage, there is also a
-  // shared CodeRange. When short builtin calls are enabled, there is a single
-  // copy of the re-embedded builtins in the shared CodeRange, so use that if
-  // it's present.
+  // CodeRange shared by the isolate group. When short builtin calls are
+  // enabled, there is a single copy of the re-embedded builtins in the shared
+  // CodeRange, so use that if it's present.
   if (FLAG_jitless) return EmbeddedData::FromBlob();
-  CodeRange* code_range = CodeRange::GetProcessWideCodeRange().get();
+  // Read-only objects are in the cage of their isolate group, writable ones
+  // know their Isolate.
+  IsolateGroup* group =
+      ReadOnlyHeap::Contains(code)
+          ? IsolateGroup::FromCageBase(GetPtrComprCageBaseAddress(code.ptr()))
+          : GetIsolateFromWritableObject(code)->isolate_group();
+  std::shared_ptr<CodeRange> code_range = group->GetCodeRange();
   return (code_range && code_range->embedded_blob_code_copy() != nullptr)
-             ? EmbeddedData::FromBlob(code_range)
+             ? EmbeddedData::FromBlob(code_range.get())
              : EmbeddedData::FromBlob();
 #else
   // Otherwise there is a single copy of the blob across all Isolates, use the
@@ -388,11 +396,23 @@ Handle<DeoptimizationData> DeoptimizationData::New(Isolate* isolate,
       LengthFor(deopt_entry_count), allocation));
 }
 
+Handle<DeoptimizationData> DeoptimizationData::New(LocalIsolate* isolate,
+                                                   int deopt_entry_count,
+                                                   AllocationType allocation) {
+  return Handle<DeoptimizationData>::cast(isolate->factory()->NewFixedArray(
+      LengthFor(deopt_entry_count), allocation));
+}
+
 Handle<DeoptimizationData> DeoptimizationData::Empty(Isolate* isolate) {
   return Handle<DeoptimizationData>::cast(
       isolate->factory()->empty_fixed_array());
 }
 
+Handle<DeoptimizationData> DeoptimizationData::Empty(LocalIsolate* isolate) {
+  return Handle<DeoptimizationData>::cast(
+      isolate->factory()->empty_fixed_array());
+}
+
 SharedFunctionInfo DeoptimizationData::GetInlinedFunction(int index) {
   if (index == -1) {
     return SharedFunctionInfo::cast(SharedFunctionInfo());
@@ -4,6 +4,9 @@
 
 #include "src/objects/compilation-cache-table.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/objects/compilation-cache-table-inl.h"
 
@@ -257,6 +260,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
   }
   Object obj = table->get(index + 1);
   if (obj.IsSharedFunctionInfo()) {
+    table->MarkUsed(entry);
     return handle(SharedFunctionInfo::cast(obj), isolate);
   }
   return MaybeHandle<SharedFunctionInfo>();
@@ -279,7 +283,8 @@ InfoCellPair CompilationCacheTable::LookupEval(
   Object obj = table->get(index + 1);
   if (!obj.IsSharedFunctionInfo()) return empty_result;
 
-  STATIC_ASSERT(CompilationCacheShape::kEntrySize == 3);
+  table->MarkUsed(entry);
+  STATIC_ASSERT(CompilationCacheShape::kEntrySize == 4);
   FeedbackCell feedback_cell =
       SearchLiteralsMap(*table, index + 2, *native_context);
   return InfoCellPair(isolate, SharedFunctionInfo::cast(obj), feedback_cell);
@@ -292,6 +297,7 @@ Handle<Object> CompilationCacheTable::LookupRegExp(Handle<String> src,
   RegExpKey key(src, flags);
   InternalIndex entry = FindEntry(isolate, &key);
   if (entry.is_not_found()) return isolate->factory()->undefined_value();
+  MarkUsed(entry);
   return Handle<Object>(get(EntryToIndex(entry) + 1), isolate);
 }
 
@@ -306,6 +312,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
   InternalIndex entry = cache->FindInsertionEntry(isolate, key.Hash());
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->MarkUsed(entry);
   cache->ElementAdded();
   return cache;
 }
@@ -327,10 +334,11 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
     if (entry.is_found()) {
       cache->set(EntryToIndex(entry), *k);
       cache->set(EntryToIndex(entry) + 1, *value);
+      cache->MarkUsed(entry);
       // AddToFeedbackCellsMap may allocate a new sub-array to live in the
       // entry, but it won't change the cache array. Therefore EntryToIndex
       // and entry remains correct.
-      STATIC_ASSERT(CompilationCacheShape::kEntrySize == 3);
+      STATIC_ASSERT(CompilationCacheShape::kEntrySize == 4);
       AddToFeedbackCellsMap(cache, EntryToIndex(entry) + 2, native_context,
                             feedback_cell);
       // Add hash again even on cache hit to avoid unnecessary cache delay in
@@ -359,6 +367,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
   // to the stored value with a custom IsMatch function during lookups.
   cache->set(EntryToIndex(entry), *value);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->MarkUsed(entry);
   cache->ElementAdded();
   return cache;
 }
@@ -407,6 +416,103 @@ void CompilationCacheTable::Remove(Object value) {
   }
 }
 
+int CompilationCacheTable::EvictLeastRecentlyUsed(Isolate* isolate,
+                                                  size_t max_size,
+                                                  size_t* size) {
+  DisallowGarbageCollection no_gc;
+  struct Candidate {
+    int last_use;
+    int entry_index;
+    size_t size;
+  };
+  std::vector<Candidate> candidates;
+  size_t total_size = 0;
+  for (InternalIndex entry : IterateEntries()) {
+    const int entry_index = EntryToIndex(entry);
+    // Skip the empty entries and the placeholders of the eval cache.
+    if (!get(entry_index).IsFixedArray()) continue;
+    size_t entry_size = EstimateSizeOfEntry(isolate, entry_index);
+    Object last_use = get(entry_index + kLastUseOffset);
+    candidates.push_back({last_use.IsSmi() ? Smi::ToInt(last_use) : 0,
+                          entry_index, entry_size});
+    total_size += entry_size;
+  }
+
+  int evicted = 0;
+  if (total_size > max_size) {
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& a, const Candidate& b) {
+                return a.last_use < b.last_use;
+              });
+    for (const Candidate& candidate : candidates) {
+      if (total_size <= max_size) break;
+      RemoveEntry(candidate.entry_index);
+      total_size -= candidate.size;
+      evicted++;
+    }
+  }
+  *size = total_size;
+  return evicted;
+}
+
+// static
+size_t CompilationCacheTable::EstimateEntrySize(Isolate* isolate,
+                                                String source,
+                                                HeapObject value) {
+  size_t size = source.Size();
+  if (value.IsSharedFunctionInfo()) {
+    SharedFunctionInfo info = SharedFunctionInfo::cast(value);
+    size += info.Size();
+    if (info.HasBytecodeArray()) {
+      size += info.GetBytecodeArray(isolate).Size();
+    }
+    return size;
+  }
+  // The JSRegExp::data array and the bytecode or code it refers to.
+  FixedArray data = FixedArray::cast(value);
+  size += data.Size();
+  for (int i = 0; i < data.length(); i++) {
+    Object object = data.get(i);
+    if (object.IsByteArray() || object.IsCode()) {
+      size += HeapObject::cast(object).Size();
+    }
+  }
+  return size;
+}
+
+size_t CompilationCacheTable::EstimateSizeOfEntry(Isolate* isolate,
+                                                  int entry_index) {
+  FixedArray key = FixedArray::cast(get(entry_index));
+  HeapObject value = HeapObject::cast(get(entry_index + 1));
+  // See StringSharedKey::AsHandle and RegExpKey for the encodings.
+  String source = value.IsSharedFunctionInfo()
+                      ? String::cast(key.get(1))
+                      : String::cast(key.get(JSRegExp::kSourceIndex));
+  size_t size = EstimateEntrySize(isolate, source, value);
+  if (value.IsSharedFunctionInfo()) size += key.Size();
+  return size;
+}
+
+void CompilationCacheTable::MarkUsed(InternalIndex entry) {
+  DisallowGarbageCollection no_gc;
+  Object clock_object = get(kUseClockIndex);
+  int clock = clock_object.IsSmi() ? Smi::ToInt(clock_object) : 0;
+  if (clock == Smi::kMaxValue) {
+    // Start over rather than overflow. The entries lose their order once,
+    // which only makes this round of evictions less precise.
+    for (InternalIndex i : IterateEntries()) {
+      const int entry_index = EntryToIndex(i);
+      if (!get(entry_index).IsFixedArray()) continue;
+      NoWriteBarrierSet(*this, entry_index + kLastUseOffset, Smi::zero());
+    }
+    clock = 0;
+  }
+  clock++;
+  NoWriteBarrierSet(*this, kUseClockIndex, Smi::FromInt(clock));
+  NoWriteBarrierSet(*this, EntryToIndex(entry) + kLastUseOffset,
+                    Smi::FromInt(clock));
+}
+
 void CompilationCacheTable::RemoveEntry(int entry_index) {
   Object the_hole_value = GetReadOnlyRoots().the_hole_value();
   for (int i = 0; i < kEntrySize; i++) {
@@ -39,12 +39,15 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
 
   static inline uint32_t HashForObject(ReadOnlyRoots roots, Object object);
 
-  static const int kPrefixSize = 0;
+  // The prefix holds the use clock of the table, see
+  // CompilationCacheTable::EvictLeastRecentlyUsed.
+  static const int kPrefixSize = 1;
   // An 'entry' is essentially a grouped collection of slots. Entries are used
   // in various ways by the different caches; most store the actual key in the
   // first entry slot, but it may also be used differently.
-  // Why 3 slots? Because of the eval cache.
-  static const int kEntrySize = 3;
+  // Why 4 slots? Because of the eval cache, which uses the first three, and
+  // the last use of the entry, which all caches store in the fourth.
+  static const int kEntrySize = 4;
   static const bool kMatchNeedsHoleCheck = true;
 };
 
@@ -126,9 +129,29 @@ class CompilationCacheTable
   void Remove(Object value);
   void Age(Isolate* isolate);
 
+  // Every lookup hit and every put records the current value of the use
+  // clock of the table in the entry. This removes the least recently used
+  // entries until the estimated size of the remaining entries is at most
+  // |max_size| bytes. Returns the number of removed entries and stores the
+  // estimated size of the remaining entries in |size|. The placeholder
+  // entries of the eval cache don't count and are never removed here.
+  int EvictLeastRecentlyUsed(Isolate* isolate, size_t max_size, size_t* size);
+
+  // The estimated size of an entry for |source| with the given value, i.e. a
+  // SharedFunctionInfo for scripts and evals or the JSRegExp::data array for
+  // regular expressions. Includes the source and the compiled code but not
+  // the slots of the table itself.
+  static size_t EstimateEntrySize(Isolate* isolate, String source,
+                                  HeapObject value);
+
   DECL_CAST(CompilationCacheTable)
 
  private:
+  static const int kUseClockIndex = kPrefixStartIndex;
+  static const int kLastUseOffset = 3;
+
+  void MarkUsed(InternalIndex entry);
+  size_t EstimateSizeOfEntry(Isolate* isolate, int entry_index);
   void RemoveEntry(int entry_index);
 
   OBJECT_CONSTRUCTORS(CompilationCacheTable,
@@ -297,6 +297,12 @@ void CopyDoubleToObjectElements(Isolate* isolate, FixedArrayBase from_base,
   Handle<FixedDoubleArray> from(FixedDoubleArray::cast(from_base), isolate);
   Handle<FixedArray> to(FixedArray::cast(to_base), isolate);
 
+  if (!USE_ALLOCATION_ALIGNMENT_BOOL) {
+    isolate->factory()->CopyAndBoxDoubleElements(from, from_start, to,
+                                                 to_start, copy_size);
+    return;
+  }
+
   // Use an outer loop to not waste too much time on creating HandleScopes.
   // On the other hand we might overflow a single handle scope depending on
   // the copy_size.
@@ -348,6 +354,29 @@ void CopyDoubleToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
 #endif
 }
 
+// Converts |count| slots of Smis or holes to doubles or the hole NaN. The loop
+// body is branch-free, so that compilers can vectorize the untagging, the
+// conversion and the hole check.
+void ConvertSmiOrHoleSlotsToDoubles(FixedArray from, uint32_t from_start,
+                                    FixedDoubleArray to, uint32_t to_start,
+                                    int count) {
+  DisallowGarbageCollection no_gc;
+  using SignedTagged = std::make_signed<Tagged_t>::type;
+  const Tagged_t* source = from.RawFieldOfElementAt(from_start).location();
+  Address destination =
+      to.address() + FixedDoubleArray::OffsetOfElementAt(to_start);
+  for (int i = 0; i < count; ++i) {
+    Tagged_t raw = source[i];
+    double value = static_cast<double>(static_cast<SignedTagged>(raw) >>
+                                       (kSmiTagSize + kSmiShiftSize));
+    // The only heap object in Smi elements is the hole.
+    uint64_t bits = (raw & kHeapObjectTagMask) != 0
+                        ? kHoleNanInt64
+                        : base::bit_cast<uint64_t>(value);
+    base::WriteUnalignedValue<uint64_t>(destination + i * kDoubleSize, bits);
+  }
+}
+
 void CopySmiToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
                              FixedArrayBase to_base, uint32_t to_start,
                              int raw_copy_size) {
@@ -363,18 +392,9 @@ void CopySmiToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
   DCHECK((copy_size + static_cast<int>(to_start)) <= to_base.length() &&
          (copy_size + static_cast<int>(from_start)) <= from_base.length());
   if (copy_size == 0) return;
-  FixedArray from = FixedArray::cast(from_base);
-  FixedDoubleArray to = FixedDoubleArray::cast(to_base);
-  Object the_hole = from.GetReadOnlyRoots().the_hole_value();
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(copy_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object hole_or_smi = from.get(from_start);
-    if (hole_or_smi == the_hole) {
-      to.set_the_hole(to_start);
-    } else {
-      to.set(to_start, Smi::ToInt(hole_or_smi));
-    }
-  }
+  ConvertSmiOrHoleSlotsToDoubles(FixedArray::cast(from_base), from_start,
+                                 FixedDoubleArray::cast(to_base), to_start,
+                                 copy_size);
 }
 
 void CopyPackedSmiToDoubleElements(FixedArrayBase from_base,
@@ -399,14 +419,9 @@ void CopyPackedSmiToDoubleElements(FixedArrayBase from_base,
   DCHECK((copy_size + static_cast<int>(to_start)) <= to_base.length() &&
          (copy_size + static_cast<int>(from_start)) <= from_base.length());
   if (copy_size == 0) return;
-  FixedArray from = FixedArray::cast(from_base);
-  FixedDoubleArray to = FixedDoubleArray::cast(to_base);
-  for (uint32_t from_end = from_start + static_cast<uint32_t>(packed_size);
-       from_start < from_end; from_start++, to_start++) {
-    Object smi = from.get(from_start);
-    DCHECK(!smi.IsTheHole());
-    to.set(to_start, Smi::ToInt(smi));
-  }
+  ConvertSmiOrHoleSlotsToDoubles(FixedArray::cast(from_base), from_start,
+                                 FixedDoubleArray::cast(to_base), to_start,
+                                 packed_size);
 }
 
 void CopyObjectToDoubleElements(FixedArrayBase from_base, uint32_t from_start,
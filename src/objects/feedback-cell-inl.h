@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_FEEDBACK_CELL_INL_H_
 #define V8_OBJECTS_FEEDBACK_CELL_INL_H_
 
+#include "src/execution/isolate-utils-inl.h"
 #include "src/execution/tiering-manager.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/objects/feedback-cell.h"
@@ -49,7 +50,8 @@ void FeedbackCell::reset_feedback_vector(
 }
 
 void FeedbackCell::SetInitialInterruptBudget() {
-  set_interrupt_budget(TieringManager::InitialInterruptBudget());
+  Isolate* isolate = GetIsolateFromWritableObject(*this);
+  set_interrupt_budget(TieringManager::InitialInterruptBudget(isolate));
 }
 
 
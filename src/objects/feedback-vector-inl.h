@@ -312,6 +312,8 @@ bool Is(int type_feedback) {
 }
 
 CompareOperationHint CompareOperationHintFromFeedback(int type_feedback) {
+  // Ignore the outcomes, they are extracted separately.
+  type_feedback &= CompareOperationFeedback::kAny;
   if (Is<CompareOperationFeedback::kNone>(type_feedback)) {
     return CompareOperationHint::kNone;
   }
@@ -349,6 +351,22 @@ CompareOperationHint CompareOperationHintFromFeedback(int type_feedback) {
   return CompareOperationHint::kAny;
 }
 
+// Helper function to transform the feedback to CompareOperationOutcomeHint.
+CompareOperationOutcomeHint CompareOperationOutcomeHintFromFeedback(
+    int type_feedback) {
+  switch (type_feedback & CompareOperationFeedback::kAnyOutcome) {
+    case CompareOperationFeedback::kNoOutcome:
+      return CompareOperationOutcomeHint::kNone;
+    case CompareOperationFeedback::kTrueOutcome:
+      return CompareOperationOutcomeHint::kAlwaysTrue;
+    case CompareOperationFeedback::kFalseOutcome:
+      return CompareOperationOutcomeHint::kAlwaysFalse;
+    default:
+      return CompareOperationOutcomeHint::kAny;
+  }
+  UNREACHABLE();
+}
+
 // Helper function to transform the feedback to ForInHint.
 ForInHint ForInHintFromFeedback(ForInFeedback type_feedback) {
   switch (type_feedback) {
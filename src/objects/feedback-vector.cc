@@ -1302,6 +1302,13 @@ CompareOperationHint FeedbackNexus::GetCompareOperationFeedback() const {
   return CompareOperationHintFromFeedback(feedback);
 }
 
+CompareOperationOutcomeHint FeedbackNexus::GetCompareOperationOutcomeFeedback()
+    const {
+  DCHECK_EQ(kind(), FeedbackSlotKind::kCompareOp);
+  int feedback = GetFeedback().ToSmi().value();
+  return CompareOperationOutcomeHintFromFeedback(feedback);
+}
+
 ForInHint FeedbackNexus::GetForInFeedback() const {
   DCHECK_EQ(kind(), FeedbackSlotKind::kForIn);
   int feedback = GetFeedback().ToSmi().value();
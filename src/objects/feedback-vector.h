@@ -821,6 +821,7 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
 
   BinaryOperationHint GetBinaryOperationFeedback() const;
   CompareOperationHint GetCompareOperationFeedback() const;
+  CompareOperationOutcomeHint GetCompareOperationOutcomeFeedback() const;
   ForInHint GetForInFeedback() const;
 
   // For KeyedLoad ICs.
@@ -958,6 +959,8 @@ class V8_EXPORT_PRIVATE FeedbackIterator final {
 
 inline BinaryOperationHint BinaryOperationHintFromFeedback(int type_feedback);
 inline CompareOperationHint CompareOperationHintFromFeedback(int type_feedback);
+inline CompareOperationOutcomeHint CompareOperationOutcomeHintFromFeedback(
+    int type_feedback);
 inline ForInHint ForInHintFromFeedback(ForInFeedback type_feedback);
 
 }  // namespace internal
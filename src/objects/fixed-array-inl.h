@@ -261,8 +261,26 @@ int BinarySearch(T* array, Name name, int valid_entries,
 
   DCHECK(low <= high);
 
+  // Keys are sorted by their hashes, which are distributed uniformly, so
+  // interpolating the position of {hash} converges faster than bisecting.
+  // Interpolation steps alternate with bisection steps, which bounds the number
+  // of steps for unevenly distributed hashes.
+  bool interpolate = true;
   while (low != high) {
     int mid = low + (high - low) / 2;
+    if (interpolate) {
+      uint32_t low_hash = array->GetSortedKey(low).hash();
+      uint32_t high_hash = array->GetSortedKey(high).hash();
+      if (hash <= low_hash) {
+        mid = low;
+      } else if (hash >= high_hash) {
+        mid = high - 1;
+      } else {
+        mid = low + static_cast<int>(static_cast<uint64_t>(hash - low_hash) *
+                                     (high - low) / (high_hash - low_hash));
+      }
+    }
+    interpolate = !interpolate;
     Name mid_name = array->GetSortedKey(mid);
     uint32_t mid_hash = mid_name.hash();
 
@@ -345,9 +363,15 @@ int Search(T* array, Name name, int valid_entries, int* out_insertion_index,
   }
 
   // Do linear search for small arrays, and for searches in the background
-  // thread.
+  // thread. A linear search for valid entries only compares the keys with
+  // {name}, while a binary search loads the sorted key index and the hash
+  // of the key at each step, so it pays off for larger arrays only.
   const int kMaxElementsForLinearSearch = 8;
-  if (valid_entries <= kMaxElementsForLinearSearch || concurrent_search) {
+  const int kMaxValidEntriesForLinearSearch = 32;
+  const int max_elements_for_linear_search =
+      search_mode == VALID_ENTRIES ? kMaxValidEntriesForLinearSearch
+                                   : kMaxElementsForLinearSearch;
+  if (valid_entries <= max_elements_for_linear_search || concurrent_search) {
     return LinearSearch<search_mode>(array, name, valid_entries,
                                      out_insertion_index);
   }
@@ -668,7 +692,8 @@ PodArray<T> PodArray<T>::cast(Object object) {
 
 // static
 template <class T>
-Handle<PodArray<T>> PodArray<T>::New(Isolate* isolate, int length,
+template <typename IsolateT>
+Handle<PodArray<T>> PodArray<T>::New(IsolateT* isolate, int length,
                                      AllocationType allocation) {
   return Handle<PodArray<T>>::cast(
       isolate->factory()->NewByteArray(length * sizeof(T), allocation));
@@ -578,8 +578,9 @@ class ByteArray : public TorqueGeneratedByteArray<ByteArray, FixedArrayBase> {
 template <class T>
 class PodArray : public ByteArray {
  public:
+  template <typename IsolateT>
   static Handle<PodArray<T>> New(
-      Isolate* isolate, int length,
+      IsolateT* isolate, int length,
       AllocationType allocation = AllocationType::kYoung);
   void copy_out(int index, T* result, int length) {
     ByteArray::copy_out(index * sizeof(T), reinterpret_cast<byte*>(result),
@@ -282,6 +282,26 @@ MaybeHandle<String> LocaleConvertCase(Isolate* isolate, Handle<String> s,
   return SeqString::Truncate(result, dest_length);
 }
 
+// Converts the case of a flat two-byte string without ICU if all of its
+// characters have a simple case mapping. Returns an empty handle otherwise.
+template <bool is_lower>
+MaybeHandle<String> TwoByteConvertCase(Isolate* isolate, Handle<String> s) {
+  int length = s->length();
+  Handle<SeqTwoByteString> result =
+      isolate->factory()->NewRawTwoByteString(length).ToHandleChecked();
+  DisallowGarbageCollection no_gc;
+  DCHECK(s->IsFlat());
+  String::FlatContent flat = s->GetFlatContent(no_gc);
+  DCHECK(flat.IsTwoByte());
+  bool has_changed_character = false;
+  int index_to_first_unprocessed = FastTwoByteConvert<is_lower>(
+      result->GetChars(no_gc), flat.ToUC16Vector().begin(), length,
+      &has_changed_character);
+  if (index_to_first_unprocessed != length) return MaybeHandle<String>();
+  if (!has_changed_character) return s;
+  return result;
+}
+
 }  // namespace
 
 // A stripped-down version of ConvertToLower that can only handle flat one-byte
@@ -335,7 +355,10 @@ String Intl::ConvertOneByteToLower(String src, String dst) {
 
 MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
   if (!s->IsOneByteRepresentation()) {
-    // Use a slower implementation for strings with characters beyond U+00FF.
+    // Most strings with characters beyond U+00FF only have characters with
+    // a simple case mapping. Use ICU for the others.
+    Handle<String> result;
+    if (TwoByteConvertCase<true>(isolate, s).ToHandle(&result)) return result;
     return LocaleConvertCase(isolate, s, false, "");
   }
 
@@ -346,15 +369,20 @@ MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
   // fits in the Latin1 range in the *root locale*. It does not hold
   // for ToUpperCase even in the root locale.
 
-  // Scan the string for uppercase and non-ASCII characters for strings
-  // shorter than a machine-word without any memory allocation overhead.
-  // TODO(jshin): Apply this to a longer input by breaking FastAsciiConvert()
-  // to two parts, one for scanning the prefix with no change and the other for
-  // handling ASCII-only characters.
-
-  bool is_short = length < static_cast<int>(sizeof(uintptr_t));
-  if (is_short) {
-    bool is_lower_ascii = FindFirstUpperOrNonAscii(*s, length) == length;
+  // Scan the string for uppercase and non-ASCII characters without any
+  // memory allocation overhead.
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent flat = s->GetFlatContent(no_gc);
+    bool is_lower_ascii;
+    if (flat.IsOneByte()) {
+      base::Vector<const uint8_t> chars = flat.ToOneByteVector();
+      is_lower_ascii = FindFirstAsciiToConvert<true>(
+                           reinterpret_cast<const char*>(chars.begin()),
+                           length) == length;
+    } else {
+      is_lower_ascii = FindFirstUpperOrNonAscii(*s, length) == length;
+    }
     if (is_lower_ascii) return s;
   }
 
@@ -367,6 +395,19 @@ MaybeHandle<String> Intl::ConvertToLower(Isolate* isolate, Handle<String> s) {
 MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
   int32_t length = s->length();
   if (s->IsOneByteRepresentation() && length > 0) {
+    // Return strings that are uppercase ASCII already without allocating.
+    {
+      DisallowGarbageCollection no_gc;
+      String::FlatContent flat = s->GetFlatContent(no_gc);
+      if (flat.IsOneByte()) {
+        base::Vector<const uint8_t> chars = flat.ToOneByteVector();
+        if (FindFirstAsciiToConvert<false>(
+                reinterpret_cast<const char*>(chars.begin()), length) ==
+            length) {
+          return s;
+        }
+      }
+    }
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
 
@@ -425,6 +466,10 @@ MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
     return result;
   }
 
+  if (!s->IsOneByteRepresentation()) {
+    Handle<String> result;
+    if (TwoByteConvertCase<false>(isolate, s).ToHandle(&result)) return result;
+  }
   return LocaleConvertCase(isolate, s, true, "");
 }
 
@@ -271,6 +271,66 @@ void SetCaseFirstOption(icu::Collator* icu_collator, CaseFirst case_first) {
   DCHECK(U_SUCCESS(status));
 }
 
+std::unique_ptr<icu::Collator> CreateICUCollator(
+    const icu::Locale& icu_locale, bool has_numeric, bool numeric,
+    bool has_case_first, CaseFirst case_first, Sensitivity sensitivity,
+    bool ignore_punctuation) {
+  UErrorCode status = U_ZERO_ERROR;
+  std::unique_ptr<icu::Collator> icu_collator(
+      icu::Collator::createInstance(icu_locale, status));
+  if (U_FAILURE(status) || icu_collator.get() == nullptr) {
+    status = U_ZERO_ERROR;
+    // Remove extensions and try again.
+    icu::Locale no_extension_locale(icu_locale.getBaseName());
+    icu_collator.reset(
+        icu::Collator::createInstance(no_extension_locale, status));
+
+    if (U_FAILURE(status) || icu_collator.get() == nullptr) {
+      return std::unique_ptr<icu::Collator>();
+    }
+  }
+  DCHECK(U_SUCCESS(status));
+
+  if (has_numeric) SetNumericOption(icu_collator.get(), numeric);
+  if (has_case_first) SetCaseFirstOption(icu_collator.get(), case_first);
+
+  // Normalization is always on, by the spec. We are free to optimize
+  // if the strings are already normalized (but we don't have a way to tell
+  // that right now).
+  status = U_ZERO_ERROR;
+  icu_collator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
+  DCHECK(U_SUCCESS(status));
+
+  // 26. Set collator.[[Sensitivity]] to sensitivity.
+  switch (sensitivity) {
+    case Sensitivity::kBase:
+      icu_collator->setStrength(icu::Collator::PRIMARY);
+      break;
+    case Sensitivity::kAccent:
+      icu_collator->setStrength(icu::Collator::SECONDARY);
+      break;
+    case Sensitivity::kCase:
+      icu_collator->setStrength(icu::Collator::PRIMARY);
+      status = U_ZERO_ERROR;
+      icu_collator->setAttribute(UCOL_CASE_LEVEL, UCOL_ON, status);
+      DCHECK(U_SUCCESS(status));
+      break;
+    case Sensitivity::kVariant:
+      icu_collator->setStrength(icu::Collator::TERTIARY);
+      break;
+    case Sensitivity::kUndefined:
+      break;
+  }
+
+  // 28. Set collator.[[IgnorePunctuation]] to ignorePunctuation.
+  if (ignore_punctuation) {
+    status = U_ZERO_ERROR;
+    icu_collator->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, status);
+    DCHECK(U_SUCCESS(status));
+  }
+  return icu_collator;
+}
+
 }  // anonymous namespace
 
 // static
@@ -419,38 +479,17 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   // here. The collation value can be looked up from icu::Collator on
   // demand, as part of Intl.Collator.prototype.resolvedOptions.
 
-  std::unique_ptr<icu::Collator> icu_collator(
-      icu::Collator::createInstance(icu_locale, status));
-  if (U_FAILURE(status) || icu_collator.get() == nullptr) {
-    status = U_ZERO_ERROR;
-    // Remove extensions and try again.
-    icu::Locale no_extension_locale(icu_locale.getBaseName());
-    icu_collator.reset(
-        icu::Collator::createInstance(no_extension_locale, status));
-
-    if (U_FAILURE(status) || icu_collator.get() == nullptr) {
-      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
-                      JSCollator);
-    }
-  }
-  DCHECK(U_SUCCESS(status));
-
-  icu::Locale collator_locale(
-      icu_collator->getLocale(ULOC_VALID_LOCALE, status));
-
   // 22. If relevantExtensionKeys contains "kn", then
   //     a. Set collator.[[Numeric]] to ! SameValue(r.[[kn]], "true").
   //
   // If the numeric value is passed in through the options object,
   // then we use it. Otherwise, we check if the numeric value is
   // passed in through the unicode extensions.
-  status = U_ZERO_ERROR;
-  if (found_numeric.FromJust()) {
-    SetNumericOption(icu_collator.get(), numeric);
-  } else {
+  if (!found_numeric.FromJust()) {
     auto kn_extension_it = r.extensions.find("kn");
     if (kn_extension_it != r.extensions.end()) {
-      SetNumericOption(icu_collator.get(), (kn_extension_it->second == "true"));
+      found_numeric = Just(true);
+      numeric = kn_extension_it->second == "true";
     }
   }
 
@@ -460,23 +499,15 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   // If the caseFirst value is passed in through the options object,
   // then we use it. Otherwise, we check if the caseFirst value is
   // passed in through the unicode extensions.
-  if (case_first != CaseFirst::kUndefined) {
-    SetCaseFirstOption(icu_collator.get(), case_first);
-  } else {
+  bool has_case_first = case_first != CaseFirst::kUndefined;
+  if (!has_case_first) {
     auto kf_extension_it = r.extensions.find("kf");
     if (kf_extension_it != r.extensions.end()) {
-      SetCaseFirstOption(icu_collator.get(),
-                         ToCaseFirst(kf_extension_it->second.c_str()));
+      has_case_first = true;
+      case_first = ToCaseFirst(kf_extension_it->second.c_str());
     }
   }
 
-  // Normalization is always on, by the spec. We are free to optimize
-  // if the strings are already normalized (but we don't have a way to tell
-  // that right now).
-  status = U_ZERO_ERROR;
-  icu_collator->setAttribute(UCOL_NORMALIZATION_MODE, UCOL_ON, status);
-  DCHECK(U_SUCCESS(status));
-
   // 24. Let sensitivity be ? GetOption(options, "sensitivity",
   // "string", « "base", "accent", "case", "variant" », undefined).
   Maybe<Sensitivity> maybe_sensitivity =
@@ -496,26 +527,6 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
       sensitivity = Sensitivity::kVariant;
     }
   }
-  // 26. Set collator.[[Sensitivity]] to sensitivity.
-  switch (sensitivity) {
-    case Sensitivity::kBase:
-      icu_collator->setStrength(icu::Collator::PRIMARY);
-      break;
-    case Sensitivity::kAccent:
-      icu_collator->setStrength(icu::Collator::SECONDARY);
-      break;
-    case Sensitivity::kCase:
-      icu_collator->setStrength(icu::Collator::PRIMARY);
-      status = U_ZERO_ERROR;
-      icu_collator->setAttribute(UCOL_CASE_LEVEL, UCOL_ON, status);
-      DCHECK(U_SUCCESS(status));
-      break;
-    case Sensitivity::kVariant:
-      icu_collator->setStrength(icu::Collator::TERTIARY);
-      break;
-    case Sensitivity::kUndefined:
-      break;
-  }
 
   // 27.Let ignorePunctuation be ? GetOption(options,
   // "ignorePunctuation", "boolean", undefined, false).
@@ -523,16 +534,40 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   Maybe<bool> found_ignore_punctuation = GetBoolOption(
       isolate, options, "ignorePunctuation", service, &ignore_punctuation);
   MAYBE_RETURN(found_ignore_punctuation, MaybeHandle<JSCollator>());
-
-  // 28. Set collator.[[IgnorePunctuation]] to ignorePunctuation.
-  if (found_ignore_punctuation.FromJust() && ignore_punctuation) {
-    status = U_ZERO_ERROR;
-    icu_collator->setAttribute(UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED, status);
-    DCHECK(U_SUCCESS(status));
+  ignore_punctuation =
+      found_ignore_punctuation.FromJust() && ignore_punctuation;
+
+  // All options are read above, so the icu::Collator can be shared with other
+  // Intl.Collator instances of the same locale and options.
+  std::string cache_key = icu_locale.getName();
+  cache_key += ':';
+  cache_key += found_numeric.FromJust() ? (numeric ? 'y' : 'n') : '-';
+  cache_key += has_case_first
+                   ? static_cast<char>('0' + static_cast<int>(case_first))
+                   : '-';
+  cache_key += static_cast<char>('0' + static_cast<int>(sensitivity));
+  cache_key += ignore_punctuation ? 'y' : 'n';
+  std::shared_ptr<icu::Collator> icu_collator =
+      std::static_pointer_cast<icu::Collator>(isolate->get_cached_icu_object(
+          Isolate::ICUObjectCacheType::kCollator, cache_key));
+  if (!icu_collator) {
+    icu_collator = CreateICUCollator(icu_locale, found_numeric.FromJust(),
+                                     numeric, has_case_first, case_first,
+                                     sensitivity, ignore_punctuation);
+    if (!icu_collator) {
+      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
+                      JSCollator);
+    }
+    isolate->set_icu_object_in_cache(
+        Isolate::ICUObjectCacheType::kCollator, cache_key,
+        std::static_pointer_cast<icu::UMemory>(icu_collator));
   }
 
+  icu::Locale collator_locale(
+      icu_collator->getLocale(ULOC_VALID_LOCALE, status));
+
   Handle<Managed<icu::Collator>> managed_collator =
-      Managed<icu::Collator>::FromUniquePtr(isolate, 0,
+      Managed<icu::Collator>::FromSharedPtr(isolate, 0,
                                             std::move(icu_collator));
 
   // We only need to do so if it is different from the collator would return.
@@ -1716,7 +1716,6 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::New(
 
   DateTimeStyle date_style = DateTimeStyle::kUndefined;
   DateTimeStyle time_style = DateTimeStyle::kUndefined;
-  std::unique_ptr<icu::SimpleDateFormat> icu_date_format;
 
   // 28. For each row of Table 1, except the header row, do
   bool has_hour_option = false;
@@ -1836,18 +1835,8 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::New(
       }
       UNREACHABLE();
     }
-    // b. Let pattern be DateTimeStylePattern(dateStyle, timeStyle,
-    // dataLocaleData, hc).
     isolate->CountUsage(
         v8::Isolate::UseCounterFeature::kDateTimeFormatDateTimeStyle);
-
-    icu_date_format =
-        DateTimeStylePattern(date_style, time_style, icu_locale,
-                             dateTimeFormatHourCycle, generator.get());
-    if (icu_date_format.get() == nullptr) {
-      THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
-                      JSDateTimeFormat);
-    }
   } else {
     // e. If dateTimeFormat.[[Hour]] is not undefined, then
     if (has_hour_option) {
@@ -1858,25 +1847,71 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::New(
       // Set dateTimeFormat.[[HourCycle]] to undefined.
       dateTimeFormatHourCycle = HourCycle::kUndefined;
     }
-    icu::UnicodeString skeleton_ustr(skeleton.c_str());
-    icu_date_format = CreateICUDateFormatFromCache(
-        icu_locale, skeleton_ustr, generator.get(), dateTimeFormatHourCycle);
-    if (icu_date_format.get() == nullptr) {
-      // Remove extensions and try again.
-      icu_locale = icu::Locale(icu_locale.getBaseName());
-      icu_date_format = CreateICUDateFormatFromCache(
-          icu_locale, skeleton_ustr, generator.get(), dateTimeFormatHourCycle);
-      if (icu_date_format.get() == nullptr) {
+  }
+
+  // All options are read above, so the icu::SimpleDateFormat can be shared
+  // with other Intl.DateTimeFormat instances of the same locale, time zone
+  // and pattern options.
+  icu::UnicodeString timezone_id;
+  calendar->getTimeZone().getID(timezone_id);
+  std::string cache_key = icu_locale.getName();
+  cache_key += ' ';
+  timezone_id.toUTF8String(cache_key);
+  cache_key += ' ';
+  cache_key += static_cast<char>('0' + static_cast<int>(date_style));
+  cache_key += static_cast<char>('0' + static_cast<int>(time_style));
+  cache_key +=
+      static_cast<char>('0' + static_cast<int>(dateTimeFormatHourCycle));
+  cache_key += skeleton;
+  std::shared_ptr<icu::SimpleDateFormat> icu_date_format =
+      std::static_pointer_cast<icu::SimpleDateFormat>(
+          isolate->get_cached_icu_object(
+              Isolate::ICUObjectCacheType::kSimpleDateFormat, cache_key));
+  if (!icu_date_format) {
+    std::unique_ptr<icu::SimpleDateFormat> new_date_format;
+    bool can_cache = true;
+    if (date_style != DateTimeStyle::kUndefined ||
+        time_style != DateTimeStyle::kUndefined) {
+      // 37. b. Let pattern be DateTimeStylePattern(dateStyle, timeStyle,
+      // dataLocaleData, hc).
+      new_date_format =
+          DateTimeStylePattern(date_style, time_style, icu_locale,
+                               dateTimeFormatHourCycle, generator.get());
+      if (new_date_format.get() == nullptr) {
         THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
                         JSDateTimeFormat);
       }
+    } else {
+      icu::UnicodeString skeleton_ustr(skeleton.c_str());
+      new_date_format = CreateICUDateFormatFromCache(
+          icu_locale, skeleton_ustr, generator.get(), dateTimeFormatHourCycle);
+      if (new_date_format.get() == nullptr) {
+        // Remove extensions and try again. The locale then differs from the
+        // one in the cache key.
+        can_cache = false;
+        icu_locale = icu::Locale(icu_locale.getBaseName());
+        new_date_format =
+            CreateICUDateFormatFromCache(icu_locale, skeleton_ustr,
+                                         generator.get(),
+                                         dateTimeFormatHourCycle);
+        if (new_date_format.get() == nullptr) {
+          THROW_NEW_ERROR(isolate, NewRangeError(MessageTemplate::kIcuError),
+                          JSDateTimeFormat);
+        }
+      }
     }
-  }
 
-  // The creation of Calendar depends on timeZone so we have to put 13 after 17.
-  // Also icu_date_format is not created until here.
-  // 13. Set dateTimeFormat.[[Calendar]] to r.[[ca]].
-  icu_date_format->adoptCalendar(calendar.release());
+    // The creation of Calendar depends on timeZone so we have to put 13 after
+    // 17. Also icu_date_format is not created until here.
+    // 13. Set dateTimeFormat.[[Calendar]] to r.[[ca]].
+    new_date_format->adoptCalendar(calendar.release());
+    icu_date_format = std::move(new_date_format);
+    if (can_cache) {
+      isolate->set_icu_object_in_cache(
+          Isolate::ICUObjectCacheType::kSimpleDateFormat, cache_key,
+          std::static_pointer_cast<icu::UMemory>(icu_date_format));
+    }
+  }
 
   // 12.1.1 InitializeDateTimeFormat ( dateTimeFormat, locales, options )
   //
@@ -1914,7 +1949,7 @@ MaybeHandle<JSDateTimeFormat> JSDateTimeFormat::New(
       Managed<icu::Locale>::FromRawPtr(isolate, 0, icu_locale.clone());
 
   Handle<Managed<icu::SimpleDateFormat>> managed_format =
-      Managed<icu::SimpleDateFormat>::FromUniquePtr(isolate, 0,
+      Managed<icu::SimpleDateFormat>::FromSharedPtr(isolate, 0,
                                                     std::move(icu_date_format));
 
   Handle<Managed<icu::DateIntervalFormat>> managed_interval_format =
@@ -221,7 +221,8 @@ bool JSFunction::is_compiled() const {
 }
 
 bool JSFunction::ShouldFlushBaselineCode(
-    base::EnumSet<CodeFlushMode> code_flush_mode) {
+    base::EnumSet<CodeFlushMode> code_flush_mode, int old_bytecode_age,
+    int old_baseline_code_age) {
   if (!IsBaselineCodeFlushingEnabled(code_flush_mode)) return false;
   // Do a raw read for shared and code fields here since this function may be
   // called on a concurrent thread. JSFunction itself should be fully
@@ -239,7 +240,55 @@ bool JSFunction::ShouldFlushBaselineCode(
   if (code.kind() != CodeKind::BASELINE) return false;
 
   SharedFunctionInfo shared = SharedFunctionInfo::cast(maybe_shared);
-  return shared.ShouldFlushCode(code_flush_mode);
+  return shared.ShouldFlushCode(code_flush_mode, old_bytecode_age,
+                                old_baseline_code_age);
+}
+
+bool JSFunction::ShouldFlushFeedbackVector(
+    base::EnumSet<CodeFlushMode> code_flush_mode,
+    int old_feedback_vector_age) {
+  if (!IsFeedbackVectorFlushingEnabled(code_flush_mode)) return false;
+  // Raw reads with acquire semantics, see ShouldFlushBaselineCode.
+  Object maybe_shared = ACQUIRE_READ_FIELD(*this, kSharedFunctionInfoOffset);
+  if (!maybe_shared.IsSharedFunctionInfo()) return false;
+
+  Object maybe_code = ACQUIRE_READ_FIELD(*this, kCodeOffset);
+  if (!maybe_code.IsCodeT()) return false;
+  CodeT code = CodeT::cast(maybe_code);
+  if (code.builtin_id() != Builtin::kInterpreterEntryTrampoline) return false;
+
+  Object maybe_cell = ACQUIRE_READ_FIELD(*this, kFeedbackCellOffset);
+  if (!maybe_cell.IsFeedbackCell()) return false;
+  if (!FeedbackCell::cast(maybe_cell).value(kAcquireLoad).IsFeedbackVector()) {
+    return false;
+  }
+
+  // Baseline code on the SharedFunctionInfo uses the feedback vector of all
+  // closures sharing the feedback cell.
+  SharedFunctionInfo shared = SharedFunctionInfo::cast(maybe_shared);
+  Object data = shared.function_data(kAcquireLoad);
+  if (!data.IsBytecodeArray()) return false;
+
+  if (IsStressFlushingEnabled(code_flush_mode)) return true;
+  return BytecodeArray::cast(data).bytecode_age() >= old_feedback_vector_age;
+}
+
+void JSFunction::FlushFeedbackVectorIfOld(
+    base::EnumSet<CodeFlushMode> code_flush_mode, int old_feedback_vector_age,
+    base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                      HeapObject target)>>
+        gc_notify_updated_slot) {
+  if (!ShouldFlushFeedbackVector(code_flush_mode, old_feedback_vector_age)) {
+    return;
+  }
+  FeedbackVector vector = feedback_vector();
+  if (vector.maybe_has_optimized_code() ||
+      vector.maybe_has_optimized_osr_code() ||
+      vector.tiering_state() != TieringState::kNone ||
+      vector.osr_tiering_state() != TieringState::kNone) {
+    return;
+  }
+  raw_feedback_cell().reset_feedback_vector(gc_notify_updated_slot);
 }
 
 bool JSFunction::NeedsResetDueToFlushedBytecode() {
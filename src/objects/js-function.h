@@ -252,7 +252,25 @@ class JSFunction : public TorqueGeneratedJSFunction<
   // Returns if baseline code is a candidate for flushing. This method is called
   // from concurrent marking so we should be careful when accessing data fields.
   inline bool ShouldFlushBaselineCode(
-      base::EnumSet<CodeFlushMode> code_flush_mode);
+      base::EnumSet<CodeFlushMode> code_flush_mode, int old_bytecode_age,
+      int old_baseline_code_age);
+
+  // Returns if the feedback vector is a candidate for flushing, because the
+  // function only ever ran in the interpreter and its bytecode is at least
+  // |old_feedback_vector_age| old. This method is called from concurrent
+  // marking so we should be careful when accessing data fields.
+  inline bool ShouldFlushFeedbackVector(
+      base::EnumSet<CodeFlushMode> code_flush_mode,
+      int old_feedback_vector_age);
+
+  // Replaces the feedback vector by its closure feedback cell array if it is
+  // still a candidate for flushing and no optimized code or pending
+  // optimization depends on it. A new vector is allocated lazily again.
+  inline void FlushFeedbackVectorIfOld(
+      base::EnumSet<CodeFlushMode> code_flush_mode, int old_feedback_vector_age,
+      base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                        HeapObject target)>>
+          gc_notify_updated_slot = base::nullopt);
 
   DECL_GETTER(has_prototype_slot, bool)
 
@@ -1641,26 +1641,62 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::New(Isolate* isolate,
   // 30. Set numberFormat.[[NegativePattern]] to
   // stylePatterns.[[negativePattern]].
   //
-  icu::number::LocalizedNumberFormatter icu_number_formatter =
-      settings.locale(icu_locale);
-
-  icu::number::LocalizedNumberRangeFormatter icu_number_range_formatter =
-      icu::number::UnlocalizedNumberRangeFormatter()
-          .numberFormatterBoth(settings)
-          .locale(icu_locale);
+  // All options are read above, so the ICU formatters can be shared with
+  // other Intl.NumberFormat instances of the same locale and skeleton. The
+  // shared formatters keep the state ICU compiles on their first uses.
+  std::string cache_key;
+  status = U_ZERO_ERROR;
+  icu::UnicodeString skeleton = settings.toSkeleton(status);
+  if (U_SUCCESS(status)) {
+    cache_key = icu_locale.getName();
+    cache_key += ' ';
+    skeleton.toUTF8String(cache_key);
+  }
+  std::shared_ptr<icu::number::LocalizedNumberFormatter> icu_number_formatter;
+  std::shared_ptr<icu::number::LocalizedNumberRangeFormatter>
+      icu_number_range_formatter;
+  if (!cache_key.empty()) {
+    icu_number_formatter =
+        std::static_pointer_cast<icu::number::LocalizedNumberFormatter>(
+            isolate->get_cached_icu_object(
+                Isolate::ICUObjectCacheType::kNumberFormat, cache_key));
+    icu_number_range_formatter =
+        std::static_pointer_cast<icu::number::LocalizedNumberRangeFormatter>(
+            isolate->get_cached_icu_object(
+                Isolate::ICUObjectCacheType::kNumberRangeFormat, cache_key));
+  }
+  if (!icu_number_formatter) {
+    icu_number_formatter =
+        std::make_shared<icu::number::LocalizedNumberFormatter>(
+            settings.locale(icu_locale));
+    if (!cache_key.empty()) {
+      isolate->set_icu_object_in_cache(
+          Isolate::ICUObjectCacheType::kNumberFormat, cache_key,
+          std::static_pointer_cast<icu::UMemory>(icu_number_formatter));
+    }
+  }
+  if (!icu_number_range_formatter) {
+    icu_number_range_formatter =
+        std::make_shared<icu::number::LocalizedNumberRangeFormatter>(
+            icu::number::UnlocalizedNumberRangeFormatter()
+                .numberFormatterBoth(settings)
+                .locale(icu_locale));
+    if (!cache_key.empty()) {
+      isolate->set_icu_object_in_cache(
+          Isolate::ICUObjectCacheType::kNumberRangeFormat, cache_key,
+          std::static_pointer_cast<icu::UMemory>(icu_number_range_formatter));
+    }
+  }
 
   Handle<Managed<icu::number::LocalizedNumberFormatter>>
       managed_number_formatter =
-          Managed<icu::number::LocalizedNumberFormatter>::FromRawPtr(
-              isolate, 0,
-              new icu::number::LocalizedNumberFormatter(icu_number_formatter));
+          Managed<icu::number::LocalizedNumberFormatter>::FromSharedPtr(
+              isolate, 0, std::move(icu_number_formatter));
 
   Handle<Managed<icu::number::LocalizedNumberRangeFormatter>>
       managed_number_range_formatter =
-          Managed<icu::number::LocalizedNumberRangeFormatter>::FromRawPtr(
-              isolate, 0,
-              new icu::number::LocalizedNumberRangeFormatter(
-                  icu_number_range_formatter));
+          Managed<icu::number::LocalizedNumberRangeFormatter>::FromSharedPtr(
+              isolate, 0, std::move(icu_number_range_formatter));
 
   // Now all properties are ready, so we can allocate the result object.
   Handle<JSNumberFormat> number_format = Handle<JSNumberFormat>::cast(
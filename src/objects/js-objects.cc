@@ -2043,6 +2043,15 @@ V8_WARN_UNUSED_RESULT Maybe<bool> FastGetOwnValuesOrEntries(
   if (!map->OnlyHasSimpleProperties()) return Just(false);
 
   Handle<JSObject> object(JSObject::cast(*receiver), isolate);
+
+  // The ObjectEntries and ObjectValues builtins only handle objects whose map
+  // has an enum cache. Initialize it, so that the next call for an object
+  // with this map does not have to enter the runtime.
+  if (map->EnumLength() == kInvalidEnumCacheSentinel &&
+      object->elements() == ReadOnlyRoots(isolate).empty_fixed_array()) {
+    KeyAccumulator::GetOwnEnumPropertyKeys(isolate, object);
+  }
+
   Handle<DescriptorArray> descriptors(map->instance_descriptors(isolate),
                                       isolate);
 
@@ -3380,6 +3389,7 @@ void JSObject::MigrateInstance(Isolate* isolate, Handle<JSObject> object) {
   Handle<Map> map = Map::Update(isolate, original_map);
   map->set_is_migration_target(true);
   JSObject::MigrateToMap(isolate, object, map);
+  isolate->counters()->instance_migrations()->Increment();
   if (FLAG_trace_migration) {
     object->PrintInstanceMigration(stdout, *original_map, *map);
   }
@@ -3399,6 +3409,7 @@ bool JSObject::TryMigrateInstance(Isolate* isolate, Handle<JSObject> object) {
     return false;
   }
   JSObject::MigrateToMap(isolate, object, new_map);
+  isolate->counters()->instance_migrations()->Increment();
   if (FLAG_trace_migration && *original_map != object->map()) {
     object->PrintInstanceMigration(stdout, *original_map, object->map());
   }
@@ -18,23 +18,38 @@ int DescriptorLookupCache::Hash(Map source, Name name) {
   // Uses only lower 32 bits if pointers are larger.
   uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
   uint32_t name_hash = name.hash();
-  return (source_hash ^ name_hash) % kLength;
+  return ((source_hash ^ name_hash) % kSets) * kWays;
 }
 
 int DescriptorLookupCache::Lookup(Map source, Name name) {
-  int index = Hash(source, name);
-  Key& key = keys_[index];
-  if ((key.source == source) && (key.name == name)) return results_[index];
+  int set = Hash(source, name);
+  for (int index = set; index < set + kWays; index++) {
+    Key& key = keys_[index];
+    if ((key.source == source) && (key.name == name)) return results_[index];
+  }
   return kAbsent;
 }
 
 void DescriptorLookupCache::Update(Map source, Name name, int result) {
   DCHECK_NE(result, kAbsent);
-  int index = Hash(source, name);
-  Key& key = keys_[index];
+  int set = Hash(source, name);
+  // Move the entries before the one for (source, name), or all of them if
+  // there is none, back by one and insert at the front.
+  int last = set + kWays - 1;
+  for (int index = set; index < last; index++) {
+    if ((keys_[index].source == source) && (keys_[index].name == name)) {
+      last = index;
+      break;
+    }
+  }
+  for (int index = last; index > set; index--) {
+    keys_[index] = keys_[index - 1];
+    results_[index] = results_[index - 1];
+  }
+  Key& key = keys_[set];
   key.source = source;
   key.name = name;
-  results_[index] = result;
+  results_[set] = result;
 }
 
 }  // namespace internal
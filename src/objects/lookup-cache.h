@@ -16,6 +16,10 @@ namespace internal {
 // The cache contains both positive and negative results.
 // Descriptor index equals kNotFound means the property is absent.
 // Cleared at startup and prior to any gc.
+//
+// The cache is set-associative: a (map, name) pair hashes to a set of kWays
+// entries, so that a few hot pairs with the same hash do not keep evicting
+// each other. Updates insert at the front of a set and drop its oldest entry.
 class DescriptorLookupCache {
  public:
   DescriptorLookupCache(const DescriptorLookupCache&) = delete;
@@ -41,9 +45,12 @@ class DescriptorLookupCache {
     }
   }
 
+  // Returns the index of the first entry of the set of (source, name).
   static inline int Hash(Map source, Name name);
 
-  static const int kLength = 64;
+  static const int kSets = 64;
+  static const int kWays = 4;
+  static const int kLength = kSets * kWays;
   struct Key {
     Map source;
     Name name;
@@ -124,6 +124,7 @@
 #include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/hex-format.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 #include "src/utils/sha-256.h"
 #include "src/utils/utils-inl.h"
@@ -4692,8 +4693,6 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
 
     // Write separator(s) if necessary.
     if (num_separators > 0 && separator_length > 0) {
-      // TODO(pwong): Consider doubling strategy employed by runtime-strings.cc
-      //              WriteRepeatToFlat().
       // Fast path for single character, single byte separators.
       if (use_one_byte_separator_fast_path) {
         DCHECK_LE(sink + num_separators, sink_end);
@@ -4701,11 +4700,18 @@ void WriteFixedArrayToFlat(FixedArray fixed_array, int length, String separator,
         DCHECK_EQ(separator_length, 1);
         sink += num_separators;
       } else {
-        for (uint32_t j = 0; j < num_separators; j++) {
-          DCHECK_LE(sink + separator_length, sink_end);
-          String::WriteToFlat(separator, sink, 0, separator_length);
-          sink += separator_length;
+        // Write the separator once, then repeatedly double the written run
+        // of separators. The total length of the result fits in an int.
+        const int separators_length =
+            separator_length * static_cast<int>(num_separators);
+        DCHECK_LE(sink + separators_length, sink_end);
+        String::WriteToFlat(separator, sink, 0, separator_length);
+        for (int written = separator_length; written < separators_length;) {
+          const int chunk = std::min(written, separators_length - written);
+          CopyChars(sink + written, sink, chunk);
+          written += chunk;
         }
+        sink += separators_length;
       }
     }
 
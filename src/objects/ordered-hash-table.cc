@@ -24,6 +24,7 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Allocate(
   // from number of buckets. If we decide to change kLoadFactor
   // to something other than 2, capacity should be stored as another
   // field of this object.
+  STATIC_ASSERT(MaxCapacity() < kChainEntryMask);
   capacity =
       base::bits::RoundUpToPowerOfTwo32(std::max({kInitialCapacity, capacity}));
   if (capacity > MaxCapacity()) {
@@ -140,27 +141,38 @@ InternalIndex OrderedHashTable<Derived, entrysize>::FindEntry(Isolate* isolate,
     return InternalIndex::NotFound();
   }
 
-  int raw_entry;
+  int hash;
   // This special cases for Smi, so that we avoid the HandleScope
   // creation below.
   if (key.IsSmi()) {
-    uint32_t hash = ComputeUnseededHash(Smi::ToInt(key));
-    raw_entry = HashToEntryRaw(hash & Smi::kMaxValue);
+    hash = ComputeUnseededHash(Smi::ToInt(key)) & Smi::kMaxValue;
   } else {
     HandleScope scope(isolate);
-    Object hash = key.GetHash();
+    Object hash_object = key.GetHash();
     // If the object does not have an identity hash, it was never used as a key
-    if (hash.IsUndefined(isolate)) return InternalIndex::NotFound();
-    raw_entry = HashToEntryRaw(Smi::ToInt(hash));
+    if (hash_object.IsUndefined(isolate)) return InternalIndex::NotFound();
+    hash = Smi::ToInt(hash_object);
   }
+  return FindEntryWithHash(key, hash);
+}
 
-  // Walk the chain in the bucket to find the key.
+template <class Derived, int entrysize>
+InternalIndex OrderedHashTable<Derived, entrysize>::FindEntryWithHash(
+    Object key, int hash) {
+  DisallowGarbageCollection no_gc;
+  if (NumberOfElements() == 0) return InternalIndex::NotFound();
+  const int tag = HashTag(hash);
+  // Walk the chain in the bucket to find the key, comparing only the keys
+  // of entries with the same hash tag.
+  int raw_entry = HashToEntryRaw(hash);
   while (raw_entry != kNotFound) {
-    Object candidate_key = KeyAt(InternalIndex(raw_entry));
-    if (candidate_key.SameValueZero(key)) return InternalIndex(raw_entry);
-    raw_entry = NextChainEntryRaw(raw_entry);
+    Smi chain = ChainValueAt(raw_entry);
+    if (ChainValueHashTag(chain) == tag) {
+      Object candidate_key = KeyAt(InternalIndex(raw_entry));
+      if (candidate_key.SameValueZero(key)) return InternalIndex(raw_entry);
+    }
+    raw_entry = ChainValueNextEntry(chain);
   }
-
   return InternalIndex::NotFound();
 }
 
@@ -168,16 +180,8 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
                                                 Handle<OrderedHashSet> table,
                                                 Handle<Object> key) {
   int hash = key->GetOrCreateHash(isolate).value();
-  if (table->NumberOfElements() > 0) {
-    int raw_entry = table->HashToEntryRaw(hash);
-    // Walk the chain of the bucket and try finding the key.
-    while (raw_entry != kNotFound) {
-      Object candidate_key = table->KeyAt(InternalIndex(raw_entry));
-      // Do not add if we have the key already
-      if (candidate_key.SameValueZero(*key)) return table;
-      raw_entry = table->NextChainEntryRaw(raw_entry);
-    }
-  }
+  // Do not add if we have the key already.
+  if (table->FindEntryWithHash(*key, hash).is_found()) return table;
 
   MaybeHandle<OrderedHashSet> table_candidate =
       OrderedHashSet::EnsureGrowable(isolate, table);
@@ -192,7 +196,7 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   int new_entry = nof + table->NumberOfDeletedElements();
   int new_index = table->EntryToIndexRaw(new_entry);
   table->set(new_index, *key);
-  table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
+  table->set(new_index + kChainOffset, ChainValue(previous_entry, hash));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
   table->SetNumberOfElements(nof + 1);
@@ -273,9 +277,10 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
       continue;
     }
 
-    Object hash = key.GetHash();
-    int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
+    int hash = Smi::ToInt(key.GetHash());
+    int bucket = hash & (new_buckets - 1);
+    int chain_entry =
+        Smi::ToInt(new_table->get(HashTableStartIndex() + bucket));
     new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
     int new_index = new_table->EntryToIndexRaw(new_entry);
     int old_index = table->EntryToIndexRaw(old_entry_raw);
@@ -283,7 +288,7 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
       Object value = table->get(old_index + i);
       new_table->set(new_index + i, value);
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
+    new_table->set(new_index + kChainOffset, ChainValue(chain_entry, hash));
     ++new_entry;
   }
 
@@ -370,20 +375,8 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
                                                 Handle<Object> key,
                                                 Handle<Object> value) {
   int hash = key->GetOrCreateHash(isolate).value();
-  if (table->NumberOfElements() > 0) {
-    int raw_entry = table->HashToEntryRaw(hash);
-    // Walk the chain of the bucket and try finding the key.
-    {
-      DisallowGarbageCollection no_gc;
-      Object raw_key = *key;
-      while (raw_entry != kNotFound) {
-        Object candidate_key = table->KeyAt(InternalIndex(raw_entry));
-        // Do not add if we have the key already
-        if (candidate_key.SameValueZero(raw_key)) return table;
-        raw_entry = table->NextChainEntryRaw(raw_entry);
-      }
-    }
-  }
+  // Do not add if we have the key already.
+  if (table->FindEntryWithHash(*key, hash).is_found()) return table;
 
   MaybeHandle<OrderedHashMap> table_candidate =
       OrderedHashMap::EnsureGrowable(isolate, table);
@@ -399,7 +392,7 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
   int new_index = table->EntryToIndexRaw(new_entry);
   table->set(new_index, *key);
   table->set(new_index + kValueOffset, *value);
-  table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
+  table->set(new_index + kChainOffset, ChainValue(previous_entry, hash));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
   table->SetNumberOfElements(nof + 1);
@@ -471,7 +464,7 @@ MaybeHandle<OrderedNameDictionary> OrderedNameDictionary::Add(
   // (by not doing the Smi conversion).
   table->set(new_index + kPropertyDetailsOffset, details.AsSmi());
 
-  table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
+  table->set(new_index + kChainOffset, ChainValue(previous_entry, hash));
   // and point the bucket to the new entry.
   table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
   table->SetNumberOfElements(nof + 1);
@@ -46,7 +46,8 @@ namespace internal {
 //                            handled by the derived class and the
 //                            item at kChainOffset is another entry
 //                            into the data table indicating the next
-//                            entry in this hash bucket.
+//                            entry in this hash bucket, together with
+//                            a hash tag of the entry (see ChainValue).
 //
 // When we transition the table to a new version we obsolete it and reuse parts
 // of the memory to store information how to transition an iterator to the new
@@ -142,6 +143,17 @@ class OrderedHashTable : public FixedArray {
   static const int kEntrySizeWithoutChain = entrysize;
   static const int kChainOffset = entrysize;
 
+  // The chain value of an entry holds the next entry in its bucket plus one
+  // (zero ends the chain) and, in the bits above, a tag computed from the
+  // hash of the entry's own key. Like the control bytes of a Swiss table,
+  // the tags let lookups skip most other entries of a bucket without loading
+  // and comparing their keys.
+  static const int kChainEntryBits = 25;
+  static const int kChainEntryMask = (1 << kChainEntryBits) - 1;
+  static const int kHashTagBits = 5;
+  static const uint32_t kHashTagMultiplier = 0x9E3779B1;
+  STATIC_ASSERT(kChainEntryBits + kHashTagBits <= kSmiValueSize - 1);
+
   static const int kNotFound = -1;
   // The minimum capacity. Note that despite this value, 0 is also a permitted
   // capacity, indicating a table without any storage for elements.
@@ -216,6 +228,9 @@ class OrderedHashTable : public FixedArray {
   static MaybeHandle<Derived> Rehash(IsolateT* isolate, Handle<Derived> table,
                                      int new_capacity);
 
+  // Like FindEntry, for a key with the given hash.
+  InternalIndex FindEntryWithHash(Object key, int hash);
+
   int HashToEntryRaw(int hash) {
     int bucket = HashToBucket(hash);
     Object entry = this->get(HashTableStartIndex() + bucket);
@@ -224,12 +239,32 @@ class OrderedHashTable : public FixedArray {
     return entry_int;
   }
 
-  int NextChainEntryRaw(int entry) {
+  // Mixes all bits of the hash into the tag, since the low bits select the
+  // bucket, and identity hashes don't use the high bits.
+  static int HashTag(int hash) {
+    uint32_t mixed = static_cast<uint32_t>(hash) * kHashTagMultiplier;
+    return static_cast<int>(mixed >> (32 - kHashTagBits));
+  }
+
+  static Smi ChainValue(int next_entry, int hash) {
+    DCHECK(next_entry == kNotFound ||
+           (next_entry >= 0 && next_entry < kChainEntryMask));
+    return Smi::FromInt((HashTag(hash) << kChainEntryBits) | (next_entry + 1));
+  }
+  static int ChainValueNextEntry(Smi chain) {
+    return (chain.value() & kChainEntryMask) - 1;
+  }
+  static int ChainValueHashTag(Smi chain) {
+    return chain.value() >> kChainEntryBits;
+  }
+
+  Smi ChainValueAt(int entry) {
     DCHECK_LT(entry, this->UsedCapacity());
-    Object next_entry = get(EntryToIndexRaw(entry) + kChainOffset);
-    int next_entry_int = Smi::ToInt(next_entry);
-    DCHECK(next_entry_int == kNotFound || next_entry_int >= 0);
-    return next_entry_int;
+    return Smi::cast(get(EntryToIndexRaw(entry) + kChainOffset));
+  }
+
+  int NextChainEntryRaw(int entry) {
+    return ChainValueNextEntry(ChainValueAt(entry));
   }
 
   // Returns an index into |this| for the given entry.
@@ -0,0 +1,189 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/osr-optimized-code-cache.h"
+
+#include "src/execution/isolate-inl.h"
+#include "src/objects/code.h"
+#include "src/objects/maybe-object.h"
+#include "src/objects/osr-optimized-code-cache-inl.h"
+#include "src/objects/shared-function-info.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+void OSROptimizedCodeCache::Insert(Isolate* isolate,
+                                   Handle<NativeContext> native_context,
+                                   Handle<SharedFunctionInfo> shared,
+                                   Handle<CodeT> code,
+                                   BytecodeOffset osr_offset) {
+  DCHECK(!osr_offset.IsNone());
+  DCHECK(CodeKindCanOSR(code->kind()));
+  STATIC_ASSERT(kEntryLength == 3);
+  Handle<OSROptimizedCodeCache> osr_cache(
+      OSROptimizedCodeCache::cast(native_context->osr_code_cache()), isolate);
+
+  int entry = osr_cache->FindEntry(*shared, osr_offset, code->kind());
+  if (entry != -1) {
+    // Replace the code in place, the SFI state stays the same.
+    osr_cache->Set(entry + kCachedCodeOffset, HeapObjectReference::Weak(*code));
+    return;
+  }
+
+  entry = osr_cache->FindFreeEntry();
+  if (entry == -1) {
+    int old_length = osr_cache->length();
+    if (old_length < kMaxLength) {
+      // Grow the cache and use the first new entry.
+      int grow_by = CapacityForLength(old_length) - old_length;
+      osr_cache = Handle<OSROptimizedCodeCache>::cast(
+          isolate->factory()->CopyWeakFixedArrayAndGrow(osr_cache, grow_by));
+      for (int i = old_length; i < osr_cache->length(); i++) {
+        osr_cache->Set(i, HeapObjectReference::ClearedValue(isolate));
+      }
+      native_context->set_osr_code_cache(*osr_cache);
+      entry = old_length;
+    } else {
+      // The cache is full, so reuse the first entry.
+      entry = 0;
+    }
+  }
+
+  // Drop what is left of the previous entry, e.g. a function whose code died.
+  osr_cache->ClearEntry(entry, isolate);
+  osr_cache->InitializeEntry(entry, *shared, *code, osr_offset);
+}
+
+CodeT OSROptimizedCodeCache::TryGet(SharedFunctionInfo shared,
+                                    BytecodeOffset osr_offset, CodeKind kind,
+                                    Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  if (shared.osr_code_cache_state() == kNotCached) return CodeT();
+
+  int index = FindEntry(shared, osr_offset, kind);
+  if (index == -1) return CodeT();
+
+  CodeT code = GetCodeFromEntry(index);
+  if (code.marked_for_deoptimization()) {
+    ClearEntry(index, isolate);
+    return CodeT();
+  }
+  DCHECK(shared.is_compiled());
+  return code;
+}
+
+void OSROptimizedCodeCache::EvictDeoptimizedCode(Isolate* isolate) {
+  DisallowGarbageCollection no_gc;
+  for (int index = 0; index < length(); index += kEntryLength) {
+    MaybeObject code_entry = Get(index + kCachedCodeOffset);
+    HeapObject heap_object;
+    if (!code_entry->GetHeapObject(&heap_object)) continue;
+
+    CodeT code = CodeT::cast(heap_object);
+    if (!code.marked_for_deoptimization()) continue;
+    ClearEntry(index, isolate);
+  }
+}
+
+int OSROptimizedCodeCache::FindEntry(SharedFunctionInfo shared,
+                                     BytecodeOffset osr_offset,
+                                     CodeKind kind) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(!osr_offset.IsNone());
+  for (int index = 0; index < length(); index += kEntryLength) {
+    if (GetSFIFromEntry(index) != shared) continue;
+    if (GetBytecodeOffsetFromEntry(index) != osr_offset) continue;
+    CodeT code = GetCodeFromEntry(index);
+    if (code.is_null() || code.kind() != kind) continue;
+    return index;
+  }
+  return -1;
+}
+
+int OSROptimizedCodeCache::FindFreeEntry() {
+  DisallowGarbageCollection no_gc;
+  for (int index = 0; index < length(); index += kEntryLength) {
+    // An entry whose function or code died can be reused.
+    if (GetSFIFromEntry(index).is_null() || GetCodeFromEntry(index).is_null()) {
+      return index;
+    }
+  }
+  return -1;
+}
+
+int OSROptimizedCodeCache::CapacityForLength(int current_length) {
+  DCHECK_EQ(current_length % kEntryLength, 0);
+  if (current_length == 0) return kInitialLength;
+  return std::min(current_length * 2, kMaxLength);
+}
+
+void OSROptimizedCodeCache::ClearEntry(int index, Isolate* isolate) {
+  SharedFunctionInfo shared = GetSFIFromEntry(index);
+  for (int i = 0; i < kEntryLength; i++) {
+    Set(index + i, HeapObjectReference::ClearedValue(isolate));
+  }
+  if (shared.is_null()) return;
+
+  // Downgrade the state of the SFI, counting its remaining entries if it had
+  // several.
+  if (shared.osr_code_cache_state() == kCachedOnce) {
+    shared.set_osr_code_cache_state(kNotCached);
+  } else if (shared.osr_code_cache_state() == kCachedMultiple) {
+    int remaining = 0;
+    for (int i = 0; i < length(); i += kEntryLength) {
+      if (GetSFIFromEntry(i) == shared) remaining++;
+    }
+    DCHECK_GE(remaining, 1);
+    shared.set_osr_code_cache_state(remaining > 1 ? kCachedMultiple
+                                                  : kCachedOnce);
+  }
+}
+
+void OSROptimizedCodeCache::InitializeEntry(int entry,
+                                            SharedFunctionInfo shared,
+                                            CodeT code,
+                                            BytecodeOffset osr_offset) {
+  Set(entry + OSRCodeCacheConstants::kSharedOffset,
+      HeapObjectReference::Weak(shared));
+  HeapObjectReference weak_code_entry = HeapObjectReference::Weak(code);
+  Set(entry + OSRCodeCacheConstants::kCachedCodeOffset, weak_code_entry);
+  Set(entry + OSRCodeCacheConstants::kOsrIdOffset,
+      MaybeObject::FromSmi(Smi::FromInt(osr_offset.ToInt())));
+  if (shared.osr_code_cache_state() == kNotCached) {
+    shared.set_osr_code_cache_state(kCachedOnce);
+  } else if (shared.osr_code_cache_state() == kCachedOnce) {
+    shared.set_osr_code_cache_state(kCachedMultiple);
+  }
+}
+
+CodeT OSROptimizedCodeCache::GetCodeFromEntry(int index) {
+  DCHECK_LE(index + OSRCodeCacheConstants::kEntryLength, length());
+  DCHECK_EQ(index % kEntryLength, 0);
+  HeapObject code_entry;
+  Get(index + OSRCodeCacheConstants::kCachedCodeOffset)
+      ->GetHeapObject(&code_entry);
+  if (code_entry.is_null()) return CodeT();
+  return CodeT::cast(code_entry);
+}
+
+SharedFunctionInfo OSROptimizedCodeCache::GetSFIFromEntry(int index) {
+  DCHECK_LE(index + OSRCodeCacheConstants::kEntryLength, length());
+  DCHECK_EQ(index % kEntryLength, 0);
+  HeapObject sfi_entry;
+  Get(index + OSRCodeCacheConstants::kSharedOffset)->GetHeapObject(&sfi_entry);
+  return sfi_entry.is_null() ? SharedFunctionInfo()
+                             : SharedFunctionInfo::cast(sfi_entry);
+}
+
+BytecodeOffset OSROptimizedCodeCache::GetBytecodeOffsetFromEntry(int index) {
+  DCHECK_LE(index + OSRCodeCacheConstants::kEntryLength, length());
+  DCHECK_EQ(index % kEntryLength, 0);
+  Smi osr_offset_entry;
+  Get(index + kOsrIdOffset)->ToSmi(&osr_offset_entry);
+  return BytecodeOffset(osr_offset_entry.value());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,82 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_OSR_OPTIMIZED_CODE_CACHE_H_
+#define V8_OBJECTS_OSR_OPTIMIZED_CODE_CACHE_H_
+
+#include "src/objects/fixed-array.h"
+
+// Has to be the last include (doesn't have include guards):
+#include "src/objects/object-macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Whether OSR code of a SharedFunctionInfo may be in the OSR code cache of
+// some native context. Only a hint that saves lookups for the common case.
+enum OSRCodeCacheStateOfSFI : uint8_t {
+  kNotCached,       // Likely state.
+  kCachedOnce,      // Unlikely state, one OSR optimized code cached.
+  kCachedMultiple,  // Very unlikely state, multiple OSR optimized code cached.
+};
+
+// The OSR code of a native context, keyed by function, loop header (the
+// bytecode offset of the JumpLoop) and code kind, so that Turbofan and Maglev
+// OSR code can be cached side by side. The feedback vector slot of each
+// JumpLoop remains the primary cache; this cache is consulted when the slot
+// is empty, e.g. because the function is invoked through a different closure
+// with its own feedback vector, and the hit is installed into the slot again.
+// Functions and code are held weakly.
+class V8_EXPORT OSROptimizedCodeCache : public WeakFixedArray {
+ public:
+  DECL_CAST(OSROptimizedCodeCache)
+
+  enum OSRCodeCacheConstants {
+    kSharedOffset,
+    kCachedCodeOffset,
+    kOsrIdOffset,
+    kEntryLength
+  };
+
+  static const int kInitialLength = OSRCodeCacheConstants::kEntryLength * 4;
+  static const int kMaxLength = OSRCodeCacheConstants::kEntryLength * 1024;
+
+  // Caches {code} of {shared} for the loop at {osr_offset}. Replaces earlier
+  // code of the same kind for the same loop.
+  static void Insert(Isolate* isolate, Handle<NativeContext> native_context,
+                     Handle<SharedFunctionInfo> shared, Handle<CodeT> code,
+                     BytecodeOffset osr_offset);
+
+  // Returns the cached code of {kind} for the loop at {osr_offset} of
+  // {shared}, or an empty CodeT if there is none.
+  CodeT TryGet(SharedFunctionInfo shared, BytecodeOffset osr_offset,
+               CodeKind kind, Isolate* isolate);
+
+  // Removes all code that is marked for deoptimization. Doesn't allocate.
+  void EvictDeoptimizedCode(Isolate* isolate);
+
+ private:
+  // Returns the index of the entry for the given key, or -1.
+  int FindEntry(SharedFunctionInfo shared, BytecodeOffset osr_offset,
+                CodeKind kind);
+  int FindFreeEntry();
+  int CapacityForLength(int current_length);
+
+  void ClearEntry(int index, Isolate* isolate);
+  void InitializeEntry(int entry, SharedFunctionInfo shared, CodeT code,
+                       BytecodeOffset osr_offset);
+
+  CodeT GetCodeFromEntry(int index);
+  SharedFunctionInfo GetSFIFromEntry(int index);
+  BytecodeOffset GetBytecodeOffsetFromEntry(int index);
+
+  OBJECT_CONSTRUCTORS(OSROptimizedCodeCache, WeakFixedArray);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#include "src/objects/object-macros-undef.h"
+
+#endif  // V8_OBJECTS_OSR_OPTIMIZED_CODE_CACHE_H_
@@ -1249,6 +1249,21 @@ FixedArray SourceTextModuleInfo::RegularExportExportNames(int i) const {
       i * kRegularExportLength + kRegularExportExportNamesOffset));
 }
 
+int SourceTextModuleInfo::ExportNameCount() const {
+  int count = 0;
+  for (int i = 0, n = RegularExportCount(); i < n; ++i) {
+    count += RegularExportExportNames(i).length();
+  }
+  ReadOnlyRoots roots = GetReadOnlyRoots();
+  FixedArray special = special_exports();
+  for (int i = 0, n = special.length(); i < n; ++i) {
+    SourceTextModuleInfoEntry entry =
+        SourceTextModuleInfoEntry::cast(special.get(i));
+    if (!entry.export_name().IsUndefined(roots)) count++;
+  }
+  return count;
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -264,6 +264,15 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
                     SharedFunctionInfo::MaglevCompilationFailedBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, turbofan_tier_up_hint,
+                    SharedFunctionInfo::TurbofanTierUpHintBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, bytecode_was_flushed,
+                    SharedFunctionInfo::BytecodeWasFlushedBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, baseline_code_was_flushed,
+                    SharedFunctionInfo::BaselineCodeWasFlushedBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -610,7 +619,9 @@ void SharedFunctionInfo::set_bytecode_array(BytecodeArray bytecode) {
 }
 
 bool SharedFunctionInfo::ShouldFlushCode(
-    base::EnumSet<CodeFlushMode> code_flush_mode) {
+    base::EnumSet<CodeFlushMode> code_flush_mode, int old_bytecode_age,
+    int old_baseline_code_age) {
+  DCHECK_LE(old_baseline_code_age, old_bytecode_age);
   if (IsFlushingDisabled(code_flush_mode)) return false;
 
   // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
@@ -622,6 +633,7 @@ bool SharedFunctionInfo::ShouldFlushCode(
   // check if it is old. Note, this is done this way since this function can be
   // called by the concurrent marker.
   Object data = function_data(kAcquireLoad);
+  int old_age = old_bytecode_age;
   if (data.IsCodeT()) {
     CodeT baseline_code = CodeT::cast(data);
     DCHECK_EQ(baseline_code.kind(), CodeKind::BASELINE);
@@ -629,6 +641,9 @@ bool SharedFunctionInfo::ShouldFlushCode(
     // we cannot flush baseline / bytecode.
     if (!IsBaselineCodeFlushingEnabled(code_flush_mode)) return false;
     data = baseline_code.bytecode_or_interpreter_data();
+    // Baseline code is executed with the bytecode, which thus also ages the
+    // baseline code.
+    old_age = old_baseline_code_age;
   } else if (!IsByteCodeFlushingEnabled(code_flush_mode)) {
     // If bytecode flushing isn't enabled and there is no baseline code there is
     // nothing to flush.
@@ -640,7 +655,18 @@ bool SharedFunctionInfo::ShouldFlushCode(
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
-  return bytecode.IsOld();
+  return bytecode.bytecode_age() >= old_age;
+}
+
+bool SharedFunctionInfo::ShouldKeepBytecodeOfFlushedBaselineCode(
+    base::EnumSet<CodeFlushMode> code_flush_mode, int old_bytecode_age) {
+  Object data = function_data(kAcquireLoad);
+  if (!data.IsCodeT()) return false;
+  if (!IsByteCodeFlushingEnabled(code_flush_mode)) return true;
+  if (IsStressFlushingEnabled(code_flush_mode)) return false;
+  data = CodeT::cast(data).bytecode_or_interpreter_data();
+  if (!data.IsBytecodeArray()) return false;
+  return BytecodeArray::cast(data).bytecode_age() < old_bytecode_age;
 }
 
 CodeT SharedFunctionInfo::InterpreterTrampoline() const {
@@ -449,6 +449,19 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(maglev_compilation_failed)
 
+  // Set while this function has Turbofan code that hasn't deoptimized, with
+  // --code-cache-tiering-hints. The bit is part of the code cache, so that
+  // consumers of the cache can optimize the function early.
+  DECL_BOOLEAN_ACCESSORS(turbofan_tier_up_hint)
+
+  // Set when the GC flushes the bytecode of this function, and cleared when
+  // it is compiled again, so that such recompiles can be counted.
+  DECL_BOOLEAN_ACCESSORS(bytecode_was_flushed)
+
+  // Set when the GC flushes the baseline code but keeps the bytecode of this
+  // function, and cleared when it is enqueued for baseline compilation again.
+  DECL_BOOLEAN_ACCESSORS(baseline_code_was_flushed)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -562,10 +575,19 @@ class SharedFunctionInfo
           gc_notify_updated_slot =
               [](HeapObject object, ObjectSlot slot, HeapObject target) {});
 
-  // Returns true if the function has old bytecode that could be flushed. This
-  // function shouldn't access any flags as it is used by concurrent marker.
-  // Hence it takes the mode as an argument.
-  inline bool ShouldFlushCode(base::EnumSet<CodeFlushMode> code_flush_mode);
+  // Returns true if the function has old bytecode or old baseline code that
+  // could be flushed. This function shouldn't access any flags as it is used
+  // by concurrent marker. Hence it takes the mode as an argument, as well as
+  // the BytecodeArray::Age from which bytecode and baseline code count as old.
+  inline bool ShouldFlushCode(base::EnumSet<CodeFlushMode> code_flush_mode,
+                              int old_bytecode_age, int old_baseline_code_age);
+
+  // Returns true if the function has baseline code whose bytecode should be
+  // kept when the baseline code is flushed, because bytecode flushing is
+  // disabled or the bytecode is not old yet. Only meaningful if
+  // ShouldFlushCode returned true, and may also be called concurrently.
+  inline bool ShouldKeepBytecodeOfFlushedBaselineCode(
+      base::EnumSet<CodeFlushMode> code_flush_mode, int old_bytecode_age);
 
   enum Inlineability {
     // Different reasons for not being inlineable:
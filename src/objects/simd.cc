@@ -0,0 +1,200 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/simd.h"
+
+#include <cmath>
+
+#include "src/base/memory.h"
+#include "src/common/globals.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/heap-number-inl.h"
+#include "src/objects/smi-inl.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr intptr_t kNotFound = -1;
+
+// Each of the Skip* functions below returns the index of the first vector
+// starting at or after {index} which may contain a match, or the index of the
+// remaining elements which do not fill a whole vector. The scalar loops then
+// find the exact index.
+
+#if V8_HOST_ARCH_X64
+
+uintptr_t SkipUnequal(const Tagged_t* array, uintptr_t length,
+                      uintptr_t index, Tagged_t value) {
+  if constexpr (sizeof(Tagged_t) == kInt32Size) {
+    const __m128i target = _mm_set1_epi32(static_cast<int32_t>(value));
+    for (; index + 4 <= length; index += 4) {
+      __m128i elements =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(array + index));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(elements, target)) != 0) break;
+    }
+  } else {
+    const __m128i target = _mm_set1_epi64x(static_cast<int64_t>(value));
+    for (; index + 2 <= length; index += 2) {
+      __m128i elements =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(array + index));
+      // SSE2 has no 64-bit comparison, so require both 32-bit halves of a
+      // lane to be equal.
+      __m128i equal = _mm_cmpeq_epi32(elements, target);
+      equal = _mm_and_si128(equal,
+                            _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+      if (_mm_movemask_epi8(equal) != 0) break;
+    }
+  }
+  return index;
+}
+
+uintptr_t SkipUnequal(Address array, uintptr_t length, uintptr_t index,
+                      double value) {
+  const __m128d target = _mm_set1_pd(value);
+  for (; index + 2 <= length; index += 2) {
+    __m128d elements = _mm_loadu_pd(
+        reinterpret_cast<const double*>(array + index * kDoubleSize));
+    if (_mm_movemask_pd(_mm_cmpeq_pd(elements, target)) != 0) break;
+  }
+  return index;
+}
+
+uintptr_t SkipNotNaN(Address array, uintptr_t length, uintptr_t index) {
+  for (; index + 2 <= length; index += 2) {
+    __m128d elements = _mm_loadu_pd(
+        reinterpret_cast<const double*>(array + index * kDoubleSize));
+    if (_mm_movemask_pd(_mm_cmpunord_pd(elements, elements)) != 0) break;
+  }
+  return index;
+}
+
+#elif V8_HOST_ARCH_ARM64
+
+uintptr_t SkipUnequal(const Tagged_t* array, uintptr_t length,
+                      uintptr_t index, Tagged_t value) {
+  if constexpr (sizeof(Tagged_t) == kInt32Size) {
+    const uint32x4_t target = vdupq_n_u32(static_cast<uint32_t>(value));
+    for (; index + 4 <= length; index += 4) {
+      uint32x4_t elements =
+          vld1q_u32(reinterpret_cast<const uint32_t*>(array + index));
+      if (vmaxvq_u32(vceqq_u32(elements, target)) != 0) break;
+    }
+  } else {
+    const uint64x2_t target = vdupq_n_u64(static_cast<uint64_t>(value));
+    for (; index + 2 <= length; index += 2) {
+      uint64x2_t elements =
+          vld1q_u64(reinterpret_cast<const uint64_t*>(array + index));
+      uint64x2_t equal = vceqq_u64(elements, target);
+      if (vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0) break;
+    }
+  }
+  return index;
+}
+
+uintptr_t SkipUnequal(Address array, uintptr_t length, uintptr_t index,
+                      double value) {
+  const float64x2_t target = vdupq_n_f64(value);
+  for (; index + 2 <= length; index += 2) {
+    float64x2_t elements = vld1q_f64(
+        reinterpret_cast<const double*>(array + index * kDoubleSize));
+    uint64x2_t equal = vceqq_f64(elements, target);
+    if (vmaxvq_u32(vreinterpretq_u32_u64(equal)) != 0) break;
+  }
+  return index;
+}
+
+uintptr_t SkipNotNaN(Address array, uintptr_t length, uintptr_t index) {
+  for (; index + 2 <= length; index += 2) {
+    float64x2_t elements = vld1q_f64(
+        reinterpret_cast<const double*>(array + index * kDoubleSize));
+    // Only NaN lanes compare unequal to themselves.
+    uint64x2_t ordered = vceqq_f64(elements, elements);
+    if (vminvq_u32(vreinterpretq_u32_u64(ordered)) == 0) break;
+  }
+  return index;
+}
+
+#else
+
+uintptr_t SkipUnequal(const Tagged_t* array, uintptr_t length,
+                      uintptr_t index, Tagged_t value) {
+  return index;
+}
+
+uintptr_t SkipUnequal(Address array, uintptr_t length, uintptr_t index,
+                      double value) {
+  return index;
+}
+
+uintptr_t SkipNotNaN(Address array, uintptr_t length, uintptr_t index) {
+  return index;
+}
+
+#endif
+
+// Double elements are only 4-byte aligned with pointer compression.
+double ReadDoubleElement(Address array, uintptr_t index) {
+  return base::ReadUnalignedValue<double>(array + index * kDoubleSize);
+}
+
+}  // namespace
+
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address raw_elements, uintptr_t length,
+                                         uintptr_t from_index,
+                                         Address raw_search_element) {
+  DisallowGarbageCollection no_gc;
+  FixedArray elements = FixedArray::cast(Object(raw_elements));
+  DCHECK_LE(length, static_cast<uintptr_t>(elements.length()));
+  const Tagged_t* array = reinterpret_cast<const Tagged_t*>(
+      elements.address() + FixedArray::OffsetOfElementAt(0));
+  // With pointer compression, elements are compared by their lower halves,
+  // which identify objects within the cage.
+  const Tagged_t value = static_cast<Tagged_t>(raw_search_element);
+  for (uintptr_t index = SkipUnequal(array, length, from_index, value);
+       index < length; ++index) {
+    if (array[index] == value) return static_cast<intptr_t>(index);
+  }
+  return kNotFound;
+}
+
+intptr_t ArrayIndexOfIncludesDouble(Address raw_elements, uintptr_t length,
+                                    uintptr_t from_index,
+                                    Address raw_search_element) {
+  DisallowGarbageCollection no_gc;
+  FixedDoubleArray elements = FixedDoubleArray::cast(Object(raw_elements));
+  DCHECK_LE(length, static_cast<uintptr_t>(elements.length()));
+  const Address array =
+      elements.address() + FixedDoubleArray::OffsetOfElementAt(0);
+  Object search_element(raw_search_element);
+  const double value = search_element.IsSmi()
+                           ? Smi::ToInt(search_element)
+                           : HeapNumber::cast(search_element).value();
+  if (std::isnan(value)) {
+    for (uintptr_t index = SkipNotNaN(array, length, from_index);
+         index < length; ++index) {
+      if (std::isnan(ReadDoubleElement(array, index))) {
+        return static_cast<intptr_t>(index);
+      }
+    }
+  } else {
+    for (uintptr_t index = SkipUnequal(array, length, from_index, value);
+         index < length; ++index) {
+      if (ReadDoubleElement(array, index) == value) {
+        return static_cast<intptr_t>(index);
+      }
+    }
+  }
+  return kNotFound;
+}
+
+}  // namespace internal
+}  // namespace v8
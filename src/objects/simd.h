@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_SIMD_H_
+#define V8_OBJECTS_SIMD_H_
+
+#include <cstdint>
+
+#include "include/v8-internal.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized searches backing Array.prototype.indexOf and includes, which are
+// called from CSA as fast C functions. They do not allocate, and return the
+// index of the first match in [{from_index}, {length}), or -1.
+
+// Searches the FixedArray {raw_elements} for an element identical to
+// {raw_search_element}. Only sound if identity implies equality for
+// {raw_search_element} and all elements, e.g. for a Smi in an array with
+// Smi elements, or for an object which is neither a Number, String nor BigInt.
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address raw_elements, uintptr_t length,
+                                         uintptr_t from_index,
+                                         Address raw_search_element);
+
+// Searches the FixedDoubleArray {raw_elements} for the Number
+// {raw_search_element}, with -0 equal to 0. If {raw_search_element} is NaN,
+// this finds the first NaN element, which includes holes, so the caller needs
+// to handle holey arrays.
+intptr_t ArrayIndexOfIncludesDouble(Address raw_elements, uintptr_t length,
+                                    uintptr_t from_index,
+                                    Address raw_search_element);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_SIMD_H_
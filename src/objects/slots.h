@@ -278,6 +278,22 @@ class OffHeapFullObjectSlot : public FullObjectSlot {
   inline Object Relaxed_Load() const = delete;
 };
 
+// An ExternalPointerSlot instance describes a kExternalPointerSize-sized field
+// ("slot") holding either an external pointer or, when sandboxed external
+// pointers are enabled, an encoded index into the ExternalPointerTable.
+// Pointer compression can cause the field to be only kTaggedSize aligned.
+class ExternalPointerSlot
+    : public SlotBase<ExternalPointerSlot, ExternalPointer_t, kTaggedSize> {
+ public:
+  ExternalPointerSlot() : SlotBase(kNullAddress) {}
+  explicit ExternalPointerSlot(Address ptr) : SlotBase(ptr) {}
+
+  // Loads the raw (possibly encoded) value of the field.
+  ExternalPointer_t load() const {
+    return base::ReadUnalignedValue<ExternalPointer_t>(address());
+  }
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -238,6 +238,10 @@ class SourceTextModuleInfo : public FixedArray {
   int RegularExportCellIndex(int i) const;
   FixedArray RegularExportExportNames(int i) const;
 
+  // Returns the number of names exported by regular and indirect exports,
+  // i.e. of the entries in the export table before linking.
+  int ExportNameCount() const;
+
 #ifdef DEBUG
   inline bool Equals(SourceTextModuleInfo other) const;
 #endif
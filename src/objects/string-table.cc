@@ -4,7 +4,9 @@
 
 #include "src/objects/string-table.h"
 
+#include <algorithm>
 #include <atomic>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -69,6 +71,31 @@ int ComputeStringTableCapacityWithShrink(int current_capacity,
   return new_capacity;
 }
 
+// Returns the capacity that a table of {current_capacity} has to be resized to
+// before {additional_elements} can be added, or {current_capacity} if the
+// elements fit without a resize.
+int ComputeStringTableCapacityForInsertion(int current_capacity,
+                                           int number_of_elements,
+                                           int number_of_deleted_elements,
+                                           int additional_elements) {
+  // We first try to shrink the table, if it is sufficiently empty; otherwise
+  // we make sure to grow it so that it has enough space.
+  int capacity_after_shrinking = ComputeStringTableCapacityWithShrink(
+      current_capacity, number_of_elements + additional_elements);
+  if (capacity_after_shrinking < current_capacity) {
+    DCHECK(StringTableHasSufficientCapacityToAdd(
+        capacity_after_shrinking, number_of_elements, 0, additional_elements));
+    return capacity_after_shrinking;
+  }
+  if (!StringTableHasSufficientCapacityToAdd(
+          current_capacity, number_of_elements, number_of_deleted_elements,
+          additional_elements)) {
+    return ComputeStringTableCapacity(number_of_elements +
+                                      additional_elements);
+  }
+  return current_capacity;
+}
+
 template <typename IsolateT, typename StringTableKey>
 bool KeyIsMatch(IsolateT* isolate, StringTableKey* key, String string) {
   if (string.hash() != key->hash()) return false;
@@ -106,25 +133,42 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
-  void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements(), 1));
+  // Claims {index} for {entry} if the slot still holds {expected}. Returns
+  // false if a concurrent insertion claimed the slot first.
+  bool TrySet(InternalIndex index, Object expected, String entry) {
+    DCHECK(expected == empty_element() || expected == deleted_element());
+    Tagged_t expected_value = static_cast<Tagged_t>(expected.ptr());
+    Tagged_t entry_value = static_cast<Tagged_t>(entry.ptr());
+    return AsAtomicTagged::Release_CompareAndSwap(
+               &elements_[index.as_uint32()], expected_value, entry_value) ==
+           expected_value;
+  }
 
-    number_of_elements_++;
+  // Reserves room for {count} more elements without resizing. Insertions may
+  // run concurrently, so the element count is bumped before the slots are
+  // claimed; a reservation that is not used has to be released again. Returns
+  // false, without reserving, if the table has to be resized first.
+  bool TryReserveElements(int count) {
+    int nof = number_of_elements_.fetch_add(count, std::memory_order_relaxed);
+    if (ComputeStringTableCapacityForInsertion(capacity(), nof,
+                                               number_of_deleted_elements(),
+                                               count) == capacity()) {
+      return true;
+    }
+    ReleaseReservedElements(count);
+    return false;
+  }
+  void ReleaseReservedElements(int count) {
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
-
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    DCHECK_LT(0, number_of_deleted_elements());
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +176,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -176,8 +224,10 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  // Both counts are only exact while no insertion is in flight, i.e. while
+  // the write mutex is held exclusively or in a safepoint.
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -243,7 +293,8 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -336,7 +387,7 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -476,8 +527,8 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
   //  - In-place internalizable strings do not incur a copy regardless of string
   //    table sharing. The map mutation is threadsafe even with relaxed memory
   //    order, because for concurrent table lookups, the "losing" thread will be
-  //    correctly ordered by LookupKey's write mutex and see the updated map
-  //    during the re-lookup.
+  //    correctly ordered by LookupKey's insertion mutex for the string's hash
+  //    and see the updated map during the re-lookup.
   //
   // For lookup misses, the internalized string map is the same map in RO space
   // regardless of which thread is doing the lookup.
@@ -514,8 +565,10 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
+  //   - All writes to the string table are guarded by the string table write
+  //     mutex, held shared for insertions and exclusively for resizes,
+  //   - Insertions claim free slots with a compare-and-swap, and insertions of
+  //     equal strings are serialized by a per-hash insertion mutex,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
   //     table,
@@ -535,7 +588,10 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // We therefore try to optimistically read from the string table without
   // taking the lock (both here and in the NoAllocate version of the lookup),
   // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // read lookup in case the non-locked read missed a write. Only insertions of
+  // strings with hashes mapping to the same insertion mutex contend with each
+  // other; this matters for the shared string table, where all client isolates
+  // internalize into the same table.
   //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
@@ -563,37 +619,107 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
+  while (true) {
+    {
+      base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+      // This load can be relaxed as the table pointer can only be modified
+      // while the lock is held exclusively.
+      Data* data = data_.load(std::memory_order_relaxed);
+      if (data->TryReserveElements(1)) {
+        base::MutexGuard insertion_guard(InsertionMutexFor(key->hash()));
+        return InsertReservedKey(isolate, data, key);
+      }
+    }
 
-    Data* data = EnsureCapacity(isolate, 1);
+    // The table has to be resized first, which must not race with in-flight
+    // insertions.
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+    EnsureCapacity(isolate, 1);
+  }
+}
 
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+template <typename StringTableKey, typename IsolateT>
+Handle<String> StringTable::InsertReservedKey(IsolateT* isolate, Data* data,
+                                              StringTableKey* key) {
+  // Check one last time if the key is present in the table, in case it was
+  // added after the check. Equal strings can't be added concurrently, as they
+  // share the insertion mutex.
+  InternalIndex entry =
+      data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+  Object element = data->Get(isolate, entry);
+  if (element != empty_element() && element != deleted_element()) {
+    // Return the existing string as a handle.
+    data->ReleaseReservedElements(1);
+    return handle(String::cast(element), isolate);
+  }
 
-    Object element = data->Get(isolate, entry);
-    if (element == empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
-      data->Set(entry, *new_string);
-      data->ElementAdded();
-      return new_string;
-    } else if (element == deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
-      data->Set(entry, *new_string);
-      data->DeletedElementOverwritten();
-      return new_string;
+  Handle<String> new_string = key->GetHandleForInsertion();
+  DCHECK_IMPLIES(FLAG_shared_string_table, new_string->IsShared());
+  // Insertions of other strings may claim the same free entry, in which case
+  // we move on to the next free entry of the probe sequence.
+  while (!data->TrySet(entry, element, *new_string)) {
+    entry = data->FindInsertionEntry(isolate, key->hash());
+    element = data->Get(isolate, entry);
+  }
+  // The element was already accounted for by the reservation; if it
+  // overwrote a deleted element, register that as well.
+  if (element == deleted_element()) data->DeletedElementOverwritten();
+  return new_string;
+}
+
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupKeys(IsolateT* isolate,
+                             base::Vector<StringTableKey* const> keys,
+                             Handle<String>* results) {
+  // Same as LookupKey for each key, but all misses of the optimistic lookup
+  // are inserted under a single acquisition of the write mutex and of each
+  // insertion mutex.
+  const Data* current_data = data_.load(std::memory_order_acquire);
+  std::vector<int> misses;
+  for (int i = 0; i < keys.length(); ++i) {
+    StringTableKey* key = keys[i];
+    InternalIndex entry = current_data->FindEntry(isolate, key, key->hash());
+    if (entry.is_found()) {
+      results[i] = handle(String::cast(current_data->Get(isolate, entry)),
+                          isolate);
+      DCHECK_IMPLIES(FLAG_shared_string_table, results[i]->InSharedHeap());
     } else {
-      // Return the existing string as a handle.
-      return handle(String::cast(element), isolate);
+      key->PrepareForInsertion(isolate);
+      misses.push_back(i);
     }
   }
+  if (misses.empty()) return;
+
+  // Group the misses by insertion mutex. Keeping equal keys in their original
+  // order makes later duplicates find the string inserted for the first one.
+  std::stable_sort(misses.begin(), misses.end(), [&](int a, int b) {
+    return InsertionMutexFor(keys[a]->hash()) <
+           InsertionMutexFor(keys[b]->hash());
+  });
+  int count = static_cast<int>(misses.size());
+  while (true) {
+    {
+      base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+      Data* data = data_.load(std::memory_order_relaxed);
+      if (data->TryReserveElements(count)) {
+        for (auto group = misses.begin(); group != misses.end();) {
+          base::Mutex* mutex = InsertionMutexFor(keys[*group]->hash());
+          base::MutexGuard insertion_guard(mutex);
+          for (; group != misses.end() &&
+                 InsertionMutexFor(keys[*group]->hash()) == mutex;
+               ++group) {
+            results[*group] = InsertReservedKey(isolate, data, keys[*group]);
+          }
+        }
+        return;
+      }
+    }
+
+    // The table has to be resized first, which must not race with in-flight
+    // insertions.
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
+    EnsureCapacity(isolate, count);
+  }
 }
 
 template Handle<String> StringTable::LookupKey(Isolate* isolate,
@@ -615,35 +741,37 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
                                                StringTableInsertionKey* key);
 
+template void StringTable::LookupKeys(
+    Isolate* isolate, base::Vector<OneByteStringKey* const> keys,
+    Handle<String>* results);
+template void StringTable::LookupKeys(
+    LocalIsolate* isolate, base::Vector<OneByteStringKey* const> keys,
+    Handle<String>* results);
+template void StringTable::LookupKeys(
+    Isolate* isolate, base::Vector<TwoByteStringKey* const> keys,
+    Handle<String>* results);
+template void StringTable::LookupKeys(
+    Isolate* isolate, base::Vector<SeqOneByteSubStringKey* const> keys,
+    Handle<String>* results);
+template void StringTable::LookupKeys(
+    Isolate* isolate, base::Vector<SeqTwoByteSubStringKey* const> keys,
+    Handle<String>* results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
-
-  // This load can be relaxed as the table pointer can only be modified while
-  // the lock is held.
+  // This call is only allowed while the write mutex is held exclusively, so
+  // that no insertion is in flight and the element counts are exact. This
+  // load can be relaxed as the table pointer can only be modified while the
+  // lock is held.
   Data* data = data_.load(std::memory_order_relaxed);
 
-  // Grow or shrink table if needed. We first try to shrink the table, if it
-  // is sufficiently empty; otherwise we make sure to grow it so that it has
-  // enough space.
+  // Grow or shrink table if needed.
   int current_capacity = data->capacity();
-  int current_nof = data->number_of_elements();
-  int capacity_after_shrinking =
-      ComputeStringTableCapacityWithShrink(current_capacity, current_nof + 1);
-
-  int new_capacity = -1;
-  if (capacity_after_shrinking < current_capacity) {
-    DCHECK(StringTableHasSufficientCapacityToAdd(capacity_after_shrinking,
-                                                 current_nof, 0, 1));
-    new_capacity = capacity_after_shrinking;
-  } else if (!StringTableHasSufficientCapacityToAdd(
-                 current_capacity, current_nof,
-                 data->number_of_deleted_elements(), 1)) {
-    new_capacity = ComputeStringTableCapacity(current_nof + 1);
-  }
+  int new_capacity = ComputeStringTableCapacityForInsertion(
+      current_capacity, data->number_of_elements(),
+      data->number_of_deleted_elements(), additional_elements);
 
-  if (new_capacity != -1) {
+  if (new_capacity != current_capacity) {
     std::unique_ptr<Data> new_data =
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
@@ -66,6 +66,13 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // As LookupKey, for each of {keys}, storing the strings found in {results}.
+  // Keys that are not in the table yet are added together, which takes the
+  // table's locks once rather than once per key.
+  template <typename StringTableKey, typename IsolateT>
+  void LookupKeys(IsolateT* isolate, base::Vector<StringTableKey* const> keys,
+                  Handle<String>* results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -86,12 +93,30 @@ class V8_EXPORT_PRIVATE StringTable {
  private:
   class Data;
 
+  // Number of mutexes that insertions are sharded over by string hash.
+  static constexpr int kInsertionMutexCount = 16;
+
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
+  // Inserts {key} into {data}, unless an equal string has been inserted
+  // since the last lookup. The caller must hold the write mutex shared and
+  // the insertion mutex for the key's hash, and must have reserved an element.
+  template <typename StringTableKey, typename IsolateT>
+  Handle<String> InsertReservedKey(IsolateT* isolate, Data* data,
+                                   StringTableKey* key);
+
+  base::Mutex* InsertionMutexFor(uint32_t hash) {
+    return &insertion_mutexes_[hash & (kInsertionMutexCount - 1)];
+  }
+
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
+  // Write mutex is held shared by insertions and exclusively by resizes. It is
+  // mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  mutable base::SharedMutex write_mutex_;
+  // Insertions only serialize with insertions of strings whose hash maps to
+  // the same mutex, which includes all insertions of equal strings.
+  base::Mutex insertion_mutexes_[kInsertionMutexCount];
   Isolate* isolate_;
 };
 
@@ -4,6 +4,9 @@
 
 #include "src/objects/string.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate-utils.h"
@@ -1074,6 +1077,22 @@ uint32_t ToValidIndex(String str, Object number) {
 
 }  // namespace
 
+// static
+bool String::ShouldFlattenOnAccess(Isolate* isolate, Handle<String> string) {
+  if (!string->IsConsString()) return true;
+  ConsString cons = ConsString::cast(*string);
+  if (cons.IsFlat()) return true;
+  int count = isolate->last_rope_accessed() == cons.ptr()
+                  ? isolate->last_rope_access_count() + 1
+                  : 1;
+  if (count > kRopeAccessesBeforeFlattening) {
+    isolate->set_last_rope_accessed(kNullAddress, 0);
+    return true;
+  }
+  isolate->set_last_rope_accessed(cons.ptr(), count);
+  return false;
+}
+
 Object String::IndexOf(Isolate* isolate, Handle<Object> receiver,
                        Handle<Object> search, Handle<Object> position) {
   if (receiver->IsNullOrUndefined(isolate)) {
@@ -1111,6 +1130,48 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Searches a rope without flattening it. The segments of the rope are
+// searched one after the other, with a small copy of the characters around
+// each boundary between segments for matches that span it.
+template <typename T>
+int SearchRope(Isolate* isolate, ConsString rope, base::Vector<T> pat_vector,
+               int start_index, const DisallowGarbageCollection& no_gc) {
+  const int pattern_length = pat_vector.length();
+  const int rope_length = rope.length();
+  std::vector<base::uc16> window;
+  // Start at the segment that contains {start_index}.
+  ConsStringIterator iter(rope, start_index);
+  int offset_in_segment = 0;
+  String segment = iter.Next(&offset_in_segment);
+  for (int offset = start_index - offset_in_segment; !segment.is_null();
+       offset += segment.length(), segment = iter.Next(&offset_in_segment)) {
+    // Matches that start in an earlier segment and end in this one.
+    if (offset > 0 && pattern_length > 1) {
+      int from = std::max(start_index, offset - (pattern_length - 1));
+      int to = std::min(rope_length, offset + pattern_length - 1);
+      if (from < offset && to - from >= pattern_length) {
+        window.resize(to - from);
+        String::WriteToFlat(rope, window.data(), from, to - from);
+        int index = SearchString(
+            isolate, base::Vector<const base::uc16>(window.data(), to - from),
+            pat_vector, 0);
+        if (index != -1 && from + index < offset) return from + index;
+      }
+    }
+    // Matches within this segment.
+    int segment_start = std::max(0, start_index - offset);
+    if (segment_start + pattern_length <= segment.length()) {
+      int index = SearchString(isolate, segment.GetFlatContent(no_gc),
+                               pat_vector, segment_start);
+      if (index != -1) return offset + index;
+    }
+  }
+  return -1;
+}
+
+// Longer patterns need large boundary windows; such ropes are flattened.
+const int kMaxRopeSearchPatternLength = 32;
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1124,8 +1185,20 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
+  if (search_length <= kMaxRopeSearchPatternLength &&
+      !String::ShouldFlattenOnAccess(isolate, receiver)) {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    ConsString rope = ConsString::cast(*receiver);
+    if (search_content.IsOneByte()) {
+      return SearchRope(isolate, rope, search_content.ToOneByteVector(),
+                        start_index, no_gc);
+    }
+    return SearchRope(isolate, rope, search_content.ToUC16Vector(),
+                      start_index, no_gc);
+  }
+  receiver = String::Flatten(isolate, receiver);
 
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
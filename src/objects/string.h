@@ -275,6 +275,15 @@ class String : public TorqueGeneratedString<String, Name> {
       LocalIsolate* isolate, Handle<String> string,
       AllocationType allocation = AllocationType::kYoung);
 
+  // Whether a single-pass operation on {string} should flatten it first.
+  // Operations that can read a non-flat ConsString in place do so for the
+  // first kRopeAccessesBeforeFlattening times in a row that they see it, and
+  // flatten it after that. Ropes that are read once or twice are thus never
+  // copied as a whole, and ropes that are read often still get flat accesses.
+  // Returns true for all other strings, for which flattening is cheap.
+  static bool ShouldFlattenOnAccess(Isolate* isolate, Handle<String> string);
+  static const int kRopeAccessesBeforeFlattening = 2;
+
   // Tries to return the content of a flat string as a structure holding either
   // a flat vector of char or of base::uc16.
   // If the string isn't flat, and therefore doesn't have flat content, the
@@ -59,6 +59,20 @@ std::ostream& operator<<(std::ostream& os, CompareOperationHint hint) {
   UNREACHABLE();
 }
 
+std::ostream& operator<<(std::ostream& os, CompareOperationOutcomeHint hint) {
+  switch (hint) {
+    case CompareOperationOutcomeHint::kNone:
+      return os << "None";
+    case CompareOperationOutcomeHint::kAlwaysTrue:
+      return os << "AlwaysTrue";
+    case CompareOperationOutcomeHint::kAlwaysFalse:
+      return os << "AlwaysFalse";
+    case CompareOperationOutcomeHint::kAny:
+      return os << "Any";
+  }
+  UNREACHABLE();
+}
+
 std::ostream& operator<<(std::ostream& os, ForInHint hint) {
   switch (hint) {
     case ForInHint::kNone:
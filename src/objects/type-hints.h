@@ -51,6 +51,17 @@ inline size_t hash_value(CompareOperationHint hint) {
 
 std::ostream& operator<<(std::ostream&, CompareOperationHint);
 
+// Outcome hints for a compare operation, i.e. whether it has produced true,
+// false, or both so far.
+enum class CompareOperationOutcomeHint : uint8_t {
+  kNone,
+  kAlwaysTrue,
+  kAlwaysFalse,
+  kAny
+};
+
+std::ostream& operator<<(std::ostream&, CompareOperationOutcomeHint);
+
 // Type hints for for..in statements.
 enum class ForInHint : uint8_t {
   kNone,
@@ -19,6 +19,7 @@
 #include "src/handles/handles-inl.h"
 #include "src/handles/maybe-handles-inl.h"
 #include "src/heap/factory.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -52,6 +53,8 @@ namespace internal {
 //             unknown tags)
 // Version 14: flags for JSArrayBufferViews
 // Version 15: support for shared objects with an explicit tag
+// Version 16: objects can refer to the keys of an earlier object of the same
+//             shape
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -60,7 +63,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 15;
+static const uint32_t kLatestVersion = 16;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -110,6 +113,12 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object with a shape not seen before, which gets the next shape ID.
+  // numProperties:uint32_t, then |numProperties| keys, then as many values.
+  kBeginJSObjectWithNewShape = 'h',
+  // A JS object with the keys of an earlier shape.
+  // shapeID:uint32_t, then the values of the keys.
+  kBeginJSObjectWithShape = 'j',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -156,6 +165,13 @@ enum class SerializationTag : uint8_t {
   kArrayBufferView = 'V',
   // Shared array buffer. transferID:uint32_t
   kSharedArrayBuffer = 'u',
+  // Array buffer whose contents were written out of band.
+  // backingStoreID:uint32_t
+  kOutOfBandArrayBuffer = 'O',
+  // Strings whose characters were written out of band.
+  // backingStoreID:uint32_t
+  kOutOfBandOneByteString = 'E',
+  kOutOfBandTwoByteString = 'X',
   // A HeapObject shared across Isolates. sharedValueID:uint32_t
   kSharedObject = 'p',
   // A wasm module object transfer. next value is its index.
@@ -243,6 +259,32 @@ enum class ErrorTag : uint8_t {
   kEnd = '.',
 };
 
+// The resource of an external string whose characters were written out of
+// band. Keeps the BackingStore alive for as long as the string lives.
+template <typename Resource, typename Char>
+class BackingStoreStringResource final : public Resource {
+ public:
+  explicit BackingStoreStringResource(
+      std::shared_ptr<BackingStore> backing_store)
+      : backing_store_(std::move(backing_store)) {}
+
+  const Char* data() const override {
+    return static_cast<const Char*>(backing_store_->buffer_start());
+  }
+  size_t length() const override {
+    return backing_store_->byte_length() / sizeof(Char);
+  }
+
+ private:
+  const std::shared_ptr<BackingStore> backing_store_;
+};
+
+using BackingStoreOneByteStringResource =
+    BackingStoreStringResource<v8::String::ExternalOneByteStringResource,
+                               char>;
+using BackingStoreTwoByteStringResource =
+    BackingStoreStringResource<v8::String::ExternalStringResource, uint16_t>;
+
 }  // namespace
 
 ValueSerializer::ValueSerializer(Isolate* isolate,
@@ -252,8 +294,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       supports_shared_values_(delegate && delegate->SupportsSharedValues()),
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
-      array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+      array_buffer_transfer_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -274,6 +316,11 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetOutOfBandThreshold(size_t byte_length) {
+  DCHECK_NOT_NULL(delegate_);
+  out_of_band_threshold_ = byte_length;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -454,6 +501,15 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
         if (FLAG_shared_string_table && supports_shared_values_) {
           return WriteSharedObject(String::Share(isolate_, string));
         }
+        string = String::Flatten(isolate_, string);
+        if (IsOutOfBand(string->length() *
+                        (string->IsOneByteRepresentation() ? 1 : 2))) {
+          bool written;
+          if (!WriteOutOfBandString(string).To(&written)) {
+            return Nothing<bool>();
+          }
+          if (written) return ThrowIfOutOfMemory();
+        }
         WriteString(string);
         return ThrowIfOutOfMemory();
       } else if (InstanceTypeChecker::IsJSReceiver(instance_type)) {
@@ -616,6 +672,7 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   const bool can_serialize_fast =
       object->HasFastProperties(isolate_) && object->elements().length() == 0;
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
+  if (CanWriteJSObjectWithShape(*object)) return WriteJSObjectWithShape(object);
 
   Handle<Map> map(object->map(), isolate_);
   WriteTag(SerializationTag::kBeginJSObject);
@@ -659,6 +716,58 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+bool ValueSerializer::CanWriteJSObjectWithShape(JSObject object) const {
+  DisallowGarbageCollection no_gc;
+  Map map = object.map(isolate_);
+  if (map.NumberOfOwnDescriptors() == 0) return false;
+  DescriptorArray descriptors = map.instance_descriptors(isolate_);
+  for (InternalIndex i : map.IterateOwnDescriptors()) {
+    if (!descriptors.GetKey(i).IsString(isolate_)) return false;
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (details.IsDontEnum() || details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField) {
+      return false;
+    }
+    // The values are read up front, so writing them must not run code which
+    // could change the object. Only new receivers can have getters.
+    Object value = object.RawFastPropertyAt(FieldIndex::ForDescriptor(map, i));
+    if (value.IsJSReceiver(isolate_) && !id_map_.Find(value)) return false;
+  }
+  return true;
+}
+
+Maybe<bool> ValueSerializer::WriteJSObjectWithShape(Handle<JSObject> object) {
+  Handle<Map> map(object->map(), isolate_);
+  Handle<DescriptorArray> descriptors(map->instance_descriptors(isolate_),
+                                      isolate_);
+  auto find_result = shape_map_.FindOrInsert(map);
+  if (find_result.already_exists) {
+    WriteTag(SerializationTag::kBeginJSObjectWithShape);
+    WriteVarint(*find_result.entry);
+  } else {
+    *find_result.entry = next_shape_id_++;
+    WriteTag(SerializationTag::kBeginJSObjectWithNewShape);
+    WriteVarint<uint32_t>(map->NumberOfOwnDescriptors());
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Handle<Object> key(descriptors->GetKey(i), isolate_);
+      if (!WriteObject(key).FromMaybe(false)) return Nothing<bool>();
+    }
+  }
+
+  std::vector<Handle<Object>> values;
+  values.reserve(map->NumberOfOwnDescriptors());
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+    values.push_back(JSObject::FastPropertyAt(
+        isolate_, object, details.representation(), field_index));
+  }
+  for (Handle<Object> value : values) {
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -922,6 +1031,13 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   if (byte_length > std::numeric_limits<uint32_t>::max()) {
     return ThrowDataCloneError(MessageTemplate::kDataCloneError, array_buffer);
   }
+  if (IsOutOfBand(byte_length)) {
+    bool written;
+    if (!WriteOutOfBandArrayBuffer(array_buffer).To(&written)) {
+      return Nothing<bool>();
+    }
+    if (written) return ThrowIfOutOfMemory();
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(byte_length);
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -1098,6 +1214,57 @@ Maybe<bool> ValueSerializer::WriteHostObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+Maybe<bool> ValueSerializer::WriteOutOfBandArrayBuffer(
+    Handle<JSArrayBuffer> array_buffer) {
+  size_t byte_length = array_buffer->byte_length();
+  std::unique_ptr<BackingStore> backing_store =
+      BackingStore::Allocate(isolate_, byte_length, SharedFlag::kNotShared,
+                             InitializedFlag::kUninitialized);
+  if (!backing_store) return Just(false);
+  memcpy(backing_store->buffer_start(), array_buffer->backing_store(),
+         byte_length);
+  return WriteOutOfBand(SerializationTag::kOutOfBandArrayBuffer,
+                        std::move(backing_store));
+}
+
+Maybe<bool> ValueSerializer::WriteOutOfBandString(Handle<String> string) {
+  DCHECK(string->IsFlat());
+  const bool is_one_byte = string->IsOneByteRepresentation();
+  size_t byte_length =
+      static_cast<size_t>(string->length()) * (is_one_byte ? 1 : 2);
+  // Allocating the backing store may trigger a GC, so only look at the
+  // characters afterwards.
+  std::unique_ptr<BackingStore> backing_store =
+      BackingStore::Allocate(isolate_, byte_length, SharedFlag::kNotShared,
+                             InitializedFlag::kUninitialized);
+  if (!backing_store) return Just(false);
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent flat = string->GetFlatContent(no_gc);
+    const void* chars =
+        is_one_byte ? static_cast<const void*>(flat.ToOneByteVector().begin())
+                    : static_cast<const void*>(flat.ToUC16Vector().begin());
+    memcpy(backing_store->buffer_start(), chars, byte_length);
+  }
+  return WriteOutOfBand(is_one_byte
+                            ? SerializationTag::kOutOfBandOneByteString
+                            : SerializationTag::kOutOfBandTwoByteString,
+                        std::move(backing_store));
+}
+
+Maybe<bool> ValueSerializer::WriteOutOfBand(
+    SerializationTag tag, std::unique_ptr<BackingStore> backing_store) {
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  std::shared_ptr<BackingStoreBase> base = std::move(backing_store);
+  Maybe<uint32_t> id = delegate_->GetOutOfBandBackingStoreId(
+      v8_isolate, std::static_pointer_cast<v8::BackingStore>(base));
+  RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+  if (id.IsNothing()) return Just(false);
+  WriteTag(tag);
+  WriteVarint(id.FromJust());
+  return Just(true);
+}
+
 Maybe<uint32_t> ValueSerializer::WriteJSObjectPropertiesSlow(
     Handle<JSObject> object, Handle<FixedArray> keys) {
   uint32_t properties_written = 0;
@@ -1161,6 +1328,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       end_(data.end()),
       supports_shared_values_(delegate && delegate->SupportsSharedValues()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1171,10 +1340,13 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       end_(data + size),
       supports_shared_values_(false),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shapes_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shapes_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1372,6 +1544,8 @@ void ValueDeserializer::TransferArrayBuffer(
 }
 
 MaybeHandle<Object> ValueDeserializer::ReadObjectWrapper() {
+  AllocationSourceScope allocation_source(isolate_->heap(),
+                                          AllocationSource::kValueDeserializer);
   // We had a bug which produced invalid version 13 data (see
   // crbug.com/1284506). This compatibility mode tries to first read the data
   // normally, and if it fails, and the version is 13, tries to read the broken
@@ -1462,6 +1636,10 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kOutOfBandOneByteString:
+      return ReadOutOfBandString(true);
+    case SerializationTag::kOutOfBandTwoByteString:
+      return ReadOutOfBandString(false);
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1469,6 +1647,14 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     }
     case SerializationTag::kBeginJSObject:
       return ReadJSObject();
+    case SerializationTag::kBeginJSObjectWithNewShape:
+    case SerializationTag::kBeginJSObjectWithShape:
+      if (version_ >= 16) {
+        return ReadJSObjectWithShape(
+            tag == SerializationTag::kBeginJSObjectWithNewShape);
+      }
+      // Older versions did not have these tags.
+      break;
     case SerializationTag::kBeginSparseJSArray:
       return ReadSparseJSArray();
     case SerializationTag::kBeginDenseJSArray:
@@ -1494,6 +1680,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kOutOfBandArrayBuffer:
+      return ReadOutOfBandJSArrayBuffer();
     case SerializationTag::kSharedArrayBuffer: {
       const bool is_shared = true;
       return ReadJSArrayBuffer(is_shared);
@@ -1514,16 +1702,17 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       }
       // If the delegate doesn't support shared values (e.g. older version, or
       // is for deserializing from storage), treat the tag as unknown.
-      V8_FALLTHROUGH;
+      break;
     default:
-      // Before there was an explicit tag for host objects, all unknown tags
-      // were delegated to the host.
-      if (version_ < 13) {
-        position_--;
-        return ReadHostObject();
-      }
-      return MaybeHandle<Object>();
+      break;
+  }
+  // Before there was an explicit tag for host objects, all unknown tags
+  // were delegated to the host.
+  if (version_ < 13) {
+    position_--;
+    return ReadHostObject();
   }
+  return MaybeHandle<Object>();
 }
 
 MaybeHandle<String> ValueDeserializer::ReadString() {
@@ -1667,6 +1856,60 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
   return scope.CloseAndEscape(object);
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadJSObjectWithShape(
+    bool is_new_shape) {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  HandleScope scope(isolate_);
+  Handle<FixedArray> shape;
+  if (is_new_shape) {
+    uint32_t num_properties;
+    // Each key takes at least two bytes.
+    if (!ReadVarint<uint32_t>().To(&num_properties) || num_properties == 0 ||
+        num_properties > static_cast<size_t>(end_ - position_) / 2) {
+      return MaybeHandle<JSObject>();
+    }
+    shape = isolate_->factory()->NewFixedArray(num_properties + 1);
+    for (uint32_t i = 0; i < num_properties; i++) {
+      Handle<String> key;
+      if (!ReadString().ToHandle(&key)) return MaybeHandle<JSObject>();
+      shape->set(i + 1, *isolate_->factory()->InternalizeString(key));
+    }
+    Handle<FixedArray> new_shapes =
+        FixedArray::SetAndGrow(isolate_, shapes_, num_shapes_++, shape);
+    if (!new_shapes.is_identical_to(shapes_)) {
+      GlobalHandles::Destroy(shapes_.location());
+      shapes_ = isolate_->global_handles()->Create(*new_shapes);
+    }
+  } else {
+    uint32_t shape_id;
+    if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id >= num_shapes_) {
+      return MaybeHandle<JSObject>();
+    }
+    shape = handle(FixedArray::cast(shapes_->get(shape_id)), isolate_);
+  }
+
+  uint32_t id = next_id_++;
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  std::vector<Handle<Object>> values;
+  values.reserve(shape->length() - 1);
+  for (int i = 1; i < shape->length(); i++) {
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    values.push_back(value);
+  }
+  if (!SetShapeProperties(object, shape, values)) {
+    return MaybeHandle<JSObject>();
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
 MaybeHandle<JSArray> ValueDeserializer::ReadSparseJSArray() {
   // If we are at the end of the stack, abort. This function may recurse.
   STACK_CHECK(isolate_, MaybeHandle<JSArray>());
@@ -1977,6 +2220,60 @@ MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeHandle<JSArrayBuffer> ValueDeserializer::ReadOutOfBandJSArrayBuffer() {
+  uint32_t id = next_id_++;
+  std::shared_ptr<BackingStore> backing_store = ReadOutOfBandBackingStore();
+  if (!backing_store) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, JSArrayBuffer);
+    return MaybeHandle<JSArrayBuffer>();
+  }
+  Handle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(std::move(backing_store));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
+MaybeHandle<String> ValueDeserializer::ReadOutOfBandString(bool is_one_byte) {
+  std::shared_ptr<BackingStore> backing_store = ReadOutOfBandBackingStore();
+  if (!backing_store) {
+    RETURN_EXCEPTION_IF_SCHEDULED_EXCEPTION(isolate_, String);
+    return MaybeHandle<String>();
+  }
+  size_t byte_length = backing_store->byte_length();
+  if (!is_one_byte && byte_length % sizeof(base::uc16) != 0) {
+    return MaybeHandle<String>();
+  }
+  if (byte_length == 0) return isolate_->factory()->empty_string();
+  // The string takes ownership of its resource only on success.
+  MaybeHandle<String> result;
+  if (is_one_byte) {
+    auto* resource =
+        new BackingStoreOneByteStringResource(std::move(backing_store));
+    result = isolate_->factory()->NewExternalStringFromOneByte(resource);
+    if (result.is_null()) delete resource;
+  } else {
+    auto* resource =
+        new BackingStoreTwoByteStringResource(std::move(backing_store));
+    result = isolate_->factory()->NewExternalStringFromTwoByte(resource);
+    if (result.is_null()) delete resource;
+  }
+  return result;
+}
+
+std::shared_ptr<BackingStore> ValueDeserializer::ReadOutOfBandBackingStore() {
+  uint32_t id;
+  if (!ReadVarint<uint32_t>().To(&id) || delegate_ == nullptr) return nullptr;
+  std::shared_ptr<BackingStoreBase> backing_store =
+      delegate_->GetOutOfBandBackingStoreFromId(
+          reinterpret_cast<v8::Isolate*>(isolate_), id);
+  if (!backing_store) return nullptr;
+  std::shared_ptr<BackingStore> result =
+      std::static_pointer_cast<BackingStore>(std::move(backing_store));
+  // Shared contents would be observable by the sender.
+  if (result->is_shared() || result->is_resizable()) return nullptr;
+  return result;
+}
+
 MaybeHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     Handle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->byte_length());
@@ -2215,6 +2512,30 @@ static void CommitProperties(Handle<JSObject> object, Handle<Map> map,
   }
 }
 
+// Returns whether {value} can be stored in the field {descriptor} of {map},
+// generalizing the field type if necessary.
+static bool PrepareFieldForValue(Isolate* isolate, Handle<Map> map,
+                                 InternalIndex descriptor,
+                                 Handle<Object> value) {
+  PropertyDetails details =
+      map->instance_descriptors(isolate).GetDetails(descriptor);
+  Representation expected_representation = details.representation();
+  if (!value->FitsRepresentation(expected_representation)) return false;
+  if (expected_representation.IsHeapObject() &&
+      !map->instance_descriptors(isolate)
+           .GetFieldType(descriptor)
+           .NowContains(value)) {
+    Handle<FieldType> value_type =
+        value->OptimalType(isolate, expected_representation);
+    MapUpdater::GeneralizeField(isolate, map, descriptor, details.constness(),
+                                expected_representation, value_type);
+  }
+  DCHECK(map->instance_descriptors(isolate)
+             .GetFieldType(descriptor)
+             .NowContains(value));
+  return true;
+}
+
 static bool IsValidObjectKey(Object value, Isolate* isolate) {
   if (value.IsSmi()) return true;
   auto instance_type = HeapObject::cast(value).map(isolate).instance_type();
@@ -2287,23 +2608,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
       // that we can copy them all at once. Otherwise, stop transitioning.
       if (transitioning) {
         InternalIndex descriptor(properties.size());
-        PropertyDetails details =
-            target->instance_descriptors(isolate_).GetDetails(descriptor);
-        Representation expected_representation = details.representation();
-        if (value->FitsRepresentation(expected_representation)) {
-          if (expected_representation.IsHeapObject() &&
-              !target->instance_descriptors(isolate_)
-                   .GetFieldType(descriptor)
-                   .NowContains(value)) {
-            Handle<FieldType> value_type =
-                value->OptimalType(isolate_, expected_representation);
-            MapUpdater::GeneralizeField(isolate_, target, descriptor,
-                                        details.constness(),
-                                        expected_representation, value_type);
-          }
-          DCHECK(target->instance_descriptors(isolate_)
-                     .GetFieldType(descriptor)
-                     .NowContains(value));
+        if (PrepareFieldForValue(isolate_, target, descriptor, value)) {
           properties.push_back(value);
           map = target;
           continue;
@@ -2364,6 +2669,69 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+bool ValueDeserializer::SetShapeProperties(
+    Handle<JSObject> object, Handle<FixedArray> shape,
+    const std::vector<Handle<Object>>& values) {
+  DCHECK_EQ(values.size() + 1, static_cast<size_t>(shape->length()));
+  Handle<Map> initial_map(object->map(), isolate_);
+
+  // All objects of a shape usually end up with the same map, so try the map
+  // of the previous one without looking up any transitions.
+  if (shape->get(0).IsMap()) {
+    Handle<Map> map(Map::cast(shape->get(0)), isolate_);
+    bool fits = !map->is_deprecated() &&
+                map->FindRootMap(isolate_) == *initial_map &&
+                static_cast<size_t>(map->NumberOfOwnDescriptors()) ==
+                    values.size();
+    for (size_t i = 0; fits && i < values.size(); i++) {
+      fits = PrepareFieldForValue(isolate_, map, InternalIndex(i), values[i]);
+    }
+    if (fits) {
+      CommitProperties(object, map, values);
+      return true;
+    }
+  }
+
+  // Otherwise follow the transitions for the keys, like
+  // ReadJSObjectProperties.
+  Handle<Map> map = initial_map;
+  size_t num_fields = 0;
+  for (; num_fields < values.size(); num_fields++) {
+    Handle<String> key(String::cast(shape->get(num_fields + 1)), isolate_);
+    Handle<Map> target;
+    if (!TransitionsAccessor(isolate_, *map)
+             .FindTransitionToField(key)
+             .ToHandle(&target) ||
+        !PrepareFieldForValue(isolate_, target, InternalIndex(num_fields),
+                              values[num_fields])) {
+      break;
+    }
+    map = target;
+  }
+  if (num_fields == values.size()) {
+    CommitProperties(object, map, values);
+    shape->set(0, *map);
+    return true;
+  }
+  CommitProperties(object, map,
+                   std::vector<Handle<Object>>(values.begin(),
+                                               values.begin() + num_fields));
+  for (size_t i = num_fields; i < values.size(); i++) {
+    Handle<Object> key(shape->get(static_cast<int>(i) + 1), isolate_);
+    PropertyKey lookup_key(isolate_, key);
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, values[i], NONE)
+            .is_null()) {
+      return false;
+    }
+  }
+  // Adding the properties created the transitions, so remember where they
+  // lead.
+  if (!object->map().is_dictionary_map()) shape->set(0, object->map());
+  return true;
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !id_map_->get(id).IsTheHole(isolate_);
@@ -2428,6 +2796,8 @@ void ThrowDeserializationExceptionIfNonePending(Isolate* isolate) {
 MaybeHandle<Object>
 ValueDeserializer::ReadObjectUsingEntireBufferForLegacyFormat() {
   DCHECK_EQ(version_, 0u);
+  AllocationSourceScope allocation_source(isolate_->heap(),
+                                          AllocationSource::kValueDeserializer);
   HandleScope scope(isolate_);
   std::vector<Handle<Object>> stack;
   while (position_ < end_) {
@@ -6,6 +6,8 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -20,6 +22,7 @@
 namespace v8 {
 namespace internal {
 
+class BackingStore;
 class BigInt;
 class HeapNumber;
 class Isolate;
@@ -94,6 +97,15 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Sets the size in bytes from which ArrayBuffer and string contents are
+   * passed to Delegate::GetOutOfBandBackingStoreId instead of being copied
+   * into the buffer. This should not be called when no Delegate was passed.
+   *
+   * The default of 0 writes all contents into the buffer.
+   */
+  void SetOutOfBandThreshold(size_t byte_length);
+
  private:
   friend class WebSnapshotSerializer;
 
@@ -121,6 +133,11 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  // Objects whose properties are all enumerable data fields share their keys
+  // with earlier objects of the same map, and only write their values.
+  bool CanWriteJSObjectWithShape(JSObject object) const;
+  Maybe<bool> WriteJSObjectWithShape(Handle<JSObject> object)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(JSDate date);
   Maybe<bool> WriteJSPrimitiveWrapper(Handle<JSPrimitiveWrapper> value)
@@ -144,6 +161,20 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteHostObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
 
+  // Passes a copy of the contents to the delegate and writes {tag} and the ID
+  // the delegate returned. Writes nothing and returns false if the copy
+  // cannot be allocated or the delegate declines.
+  Maybe<bool> WriteOutOfBandArrayBuffer(Handle<JSArrayBuffer> array_buffer)
+      V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteOutOfBandString(Handle<String> string)
+      V8_WARN_UNUSED_RESULT;
+  Maybe<bool> WriteOutOfBand(SerializationTag tag,
+                             std::unique_ptr<BackingStore> backing_store)
+      V8_WARN_UNUSED_RESULT;
+  bool IsOutOfBand(size_t byte_length) const {
+    return out_of_band_threshold_ != 0 && byte_length >= out_of_band_threshold_;
+  }
+
   /*
    * Reads the specified keys from the object and writes key-value pairs to the
    * buffer. Returns the number of keys actually written, which may be smaller
@@ -172,6 +203,7 @@ class ValueSerializer {
   const bool supports_shared_values_;
   bool treat_array_buffer_views_as_host_objects_ = false;
   bool out_of_memory_ = false;
+  size_t out_of_band_threshold_ = 0;
   Zone zone_;
 
   // To avoid extra lookups in the identity map, ID+1 is actually stored in the
@@ -182,6 +214,10 @@ class ValueSerializer {
 
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
+
+  // The shape IDs of the maps of objects written with their shape.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
 };
 
 /*
@@ -281,6 +317,8 @@ class ValueDeserializer {
   MaybeHandle<String> ReadTwoByteString(
       AllocationType allocation = AllocationType::kYoung) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadJSObjectWithShape(bool is_new_shape)
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -293,6 +331,12 @@ class ValueDeserializer {
       V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSArrayBuffer> ReadOutOfBandJSArrayBuffer()
+      V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadOutOfBandString(bool is_one_byte)
+      V8_WARN_UNUSED_RESULT;
+  std::shared_ptr<BackingStore> ReadOutOfBandBackingStore()
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   MaybeHandle<Object> ReadJSError() V8_WARN_UNUSED_RESULT;
@@ -311,6 +355,12 @@ class ValueDeserializer {
                                          SerializationTag end_tag,
                                          bool can_use_transitions);
 
+  // Adds the keys of {shape} with the given {values} to {object}, reusing the
+  // map of the previous object with this shape if possible.
+  bool SetShapeProperties(Handle<JSObject> object, Handle<FixedArray> shape,
+                          const std::vector<Handle<Object>>& values)
+      V8_WARN_UNUSED_RESULT;
+
   // Manipulating the map from IDs to reified objects.
   bool HasObjectWithID(uint32_t id);
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
@@ -329,6 +379,10 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  // Per shape ID, the map of the last object with this shape (or undefined),
+  // followed by the keys.
+  Handle<FixedArray> shapes_;
+  uint32_t num_shapes_ = 0;
 };
 
 }  // namespace internal
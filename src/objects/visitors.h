@@ -185,7 +185,8 @@ class ObjectVisitor {
 
   // Visits an external pointer. This is currently only guaranteed to be called
   // when the sandbox is enabled.
-  virtual void VisitExternalPointer(HeapObject host, ExternalPointer_t ptr) {}
+  virtual void VisitExternalPointer(HeapObject host,
+                                    ExternalPointerSlot slot) {}
 };
 
 // Helper version of ObjectVisitor that also takes care of caching base values
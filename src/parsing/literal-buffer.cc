@@ -65,6 +65,24 @@ void LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+void LiteralBuffer::AddAsciiChars(const uint16_t* begin,
+                                  const uint16_t* end) {
+  int count = static_cast<int>(end - begin);
+  if (count == 0) return;
+  int size = is_one_byte() ? count : count * base::kUC16Size;
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    uint8_t* dst = &backing_store_[position_];
+    for (int i = 0; i < count; i++) {
+      DCHECK_LE(begin[i], unibrow::Utf8::kMaxOneByteChar);
+      dst[i] = static_cast<uint8_t>(begin[i]);
+    }
+  } else {
+    MemCopy(&backing_store_[position_], begin, size);
+  }
+  position_ += size;
+}
+
 void LiteralBuffer::AddTwoByteChar(base::uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
@@ -3239,6 +3239,18 @@ FunctionLiteral* Parser::CreateInitializerFunction(
   return result;
 }
 
+bool Parser::CanInlineInstanceFields(
+    const ZonePtrList<ClassLiteral::Property>* fields) const {
+  if (!FLAG_ignition_inline_class_fields) return false;
+  for (ClassLiteral::Property* field : *fields) {
+    if (field->is_private() || field->is_computed_name() ||
+        !field->key()->IsPropertyName() || !field->value()->IsLiteral()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // This method generates a ClassLiteral AST node.
 // It uses the following fields of class_info:
 //   - constructor (if missing, it updates it with a default constructor)
@@ -3283,6 +3295,15 @@ Expression* Parser::RewriteClassLiteral(ClassScope* block_scope,
     class_info->constructor->set_requires_instance_members_initializer(true);
     class_info->constructor->add_expected_properties(
         class_info->instance_fields->length());
+    if (!has_extends && CanInlineInstanceFields(class_info->instance_fields)) {
+      class_info->constructor->set_inlined_instance_fields(
+          class_info->instance_fields);
+      // The fields are only visible to the constructor if it is compiled
+      // together with the class; default constructors are cheap to compile.
+      if (has_default_constructor) {
+        class_info->constructor->SetShouldEagerCompile();
+      }
+    }
   }
 
   if (class_info->requires_brand) {
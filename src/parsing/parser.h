@@ -367,6 +367,10 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                          bool is_computed_name, bool is_private,
                          ClassInfo* class_info);
   void AddClassStaticBlock(Block* block, ClassInfo* class_info);
+  // Returns true if all |fields| are public fields with a literal name and a
+  // literal value, which the constructor can define directly.
+  bool CanInlineInstanceFields(
+      const ZonePtrList<ClassLiteralProperty>* fields) const;
   Expression* RewriteClassLiteral(ClassScope* block_scope,
                                   const AstRawString* name,
                                   ClassInfo* class_info, int pos, int end_pos);
@@ -619,6 +619,15 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   }
 
   while (cursor < end && chars < position) {
+    if (state == unibrow::Utf8::State::kAccept) {
+      // Fast path for ascii sequences.
+      size_t max_length = std::min(static_cast<size_t>(end - cursor),
+                                   position - chars);
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(max_length));
+      cursor += ascii_length;
+      chars += ascii_length;
+      if (cursor == end || chars == position) break;
+    }
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
     if (t != unibrow::Utf8::kIncomplete) {
@@ -0,0 +1,99 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Returns the first code unit in [begin, end) that is either not ASCII or one
+// of the ASCII characters |c1| .. |c4|, or |end| if there is none. Callers
+// that look for fewer characters repeat one of them.
+//
+// The scanner uses this to skip the uninteresting parts of comments and
+// string literals in blocks of 16 code units, and leaves everything else,
+// including all non-ASCII input, to its scalar checks.
+V8_INLINE const uint16_t* FindNonAsciiOrAnyOf(const uint16_t* begin,
+                                              const uint16_t* end,
+                                              uint16_t c1, uint16_t c2,
+                                              uint16_t c3, uint16_t c4) {
+  const uint16_t* cursor = begin;
+#if V8_HOST_HAS_SSE2
+  constexpr int kLanes = sizeof(__m128i) / sizeof(uint16_t);
+  const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i v1 = _mm_set1_epi16(static_cast<int16_t>(c1));
+  const __m128i v2 = _mm_set1_epi16(static_cast<int16_t>(c2));
+  const __m128i v3 = _mm_set1_epi16(static_cast<int16_t>(c3));
+  const __m128i v4 = _mm_set1_epi16(static_cast<int16_t>(c4));
+  auto matches = [&](__m128i chars) {
+    __m128i ascii =
+        _mm_cmpeq_epi16(_mm_and_si128(chars, non_ascii_bits), zero);
+    __m128i any = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, v1), _mm_cmpeq_epi16(chars, v2)),
+        _mm_or_si128(_mm_cmpeq_epi16(chars, v3), _mm_cmpeq_epi16(chars, v4)));
+    // The lanes that are ASCII but don't match, two mask bits per lane.
+    uint32_t skipped = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_andnot_si128(any, ascii)));
+    return ~skipped & 0xFFFF;
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor + kLanes));
+    uint32_t mask = matches(lo) | (matches(hi) << (2 * kLanes));
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(mask) / 2;
+    }
+  }
+#elif V8_HOST_HAS_NEON
+  constexpr int kLanes = sizeof(uint16x8_t) / sizeof(uint16_t);
+  const uint16x8_t non_ascii_bits = vdupq_n_u16(0xFF80);
+  const uint16x8_t v1 = vdupq_n_u16(c1);
+  const uint16x8_t v2 = vdupq_n_u16(c2);
+  const uint16x8_t v3 = vdupq_n_u16(c3);
+  const uint16x8_t v4 = vdupq_n_u16(c4);
+  auto matches = [&](uint16x8_t chars) {
+    return vorrq_u16(
+        vorrq_u16(vtstq_u16(chars, non_ascii_bits),
+                  vorrq_u16(vceqq_u16(chars, v1), vceqq_u16(chars, v2))),
+        vorrq_u16(vceqq_u16(chars, v3), vceqq_u16(chars, v4)));
+  };
+  for (; end - cursor >= 2 * kLanes; cursor += 2 * kLanes) {
+    uint16x8_t lo = matches(vld1q_u16(cursor));
+    uint16x8_t hi = matches(vld1q_u16(cursor + kLanes));
+    if (vmaxvq_u16(vorrq_u16(lo, hi)) == 0) continue;
+    // Narrow the lanes to one byte each to get a 64-bit mask per vector.
+    uint64_t lo_mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(lo)), 0);
+    if (lo_mask != 0) {
+      return cursor + base::bits::CountTrailingZeros(lo_mask) / 8;
+    }
+    uint64_t hi_mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(hi)), 0);
+    return cursor + kLanes + base::bits::CountTrailingZeros(hi_mask) / 8;
+  }
+#endif  // V8_HOST_HAS_SSE2
+  for (; cursor < end; ++cursor) {
+    uint16_t c = *cursor;
+    if (c > 0x7F || c == c1 || c == c2 || c == c3 || c == c4) return cursor;
+  }
+  return end;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
@@ -17,6 +17,7 @@
 #include "src/objects/bigint.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/scanner-inl.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -211,7 +212,11 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil(
+      [](const uint16_t* begin, const uint16_t* end) {
+        return FindNonAsciiOrAnyOf(begin, end, '\n', '\r', '\n', '\r');
+      },
+      [](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
 
   return Token::WHITESPACE;
 }
@@ -278,13 +283,17 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntil(
+          [](const uint16_t* begin, const uint16_t* end) {
+            return FindNonAsciiOrAnyOf(begin, end, '*', '\n', '\r', '*');
+          },
+          [](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          });
 
       while (c0_ == '*') {
         Advance();
@@ -303,7 +312,11 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil(
+        [](const uint16_t* begin, const uint16_t* end) {
+          return FindNonAsciiOrAnyOf(begin, end, '*', '*', '*', '*');
+        },
+        [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -457,19 +470,26 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntil(
+        [this, quote](const uint16_t* begin, const uint16_t* end) {
+          const uint16_t* stop = FindNonAsciiOrAnyOf(
+              begin, end, static_cast<uint16_t>(quote), '\\', '\n', '\r');
+          next().literal_chars.AddAsciiChars(begin, stop);
+          return stop;
+        },
+        [this](base::uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        });
 
     while (c0_ == '\\') {
       Advance();
@@ -510,6 +530,16 @@ Token::Value Scanner::ScanPrivateName() {
   return Token::ILLEGAL;
 }
 
+namespace {
+
+// Whether |c| is added to a template span as is.
+bool IsPlainTemplateCharacter(base::uc32 c) {
+  return c != '`' && c != '$' && c != '\\' && c != '\r' &&
+         c != Scanner::kEndOfInput;
+}
+
+}  // namespace
+
 Token::Value Scanner::ScanTemplateSpan() {
   // When scanning a TemplateSpan, we are looking for the following construct:
   // TEMPLATE_SPAN ::
@@ -582,6 +612,24 @@ Token::Value Scanner::ScanTemplateSpan() {
       }
       if (capture_raw) AddRawLiteralChar(c);
       AddLiteralChar(c);
+      if (!IsPlainTemplateCharacter(c0_)) continue;
+      // Take the run of characters that need no special treatment in one go.
+      AddRawLiteralChar(c0_);
+      AddLiteralChar(c0_);
+      AdvanceUntil(
+          [this](const uint16_t* begin, const uint16_t* end) {
+            const uint16_t* stop =
+                FindNonAsciiOrAnyOf(begin, end, '`', '$', '\\', '\r');
+            next().literal_chars.AddAsciiChars(begin, stop);
+            next().raw_literal_chars.AddAsciiChars(begin, stop);
+            return stop;
+          },
+          [this](base::uc32 c0) {
+            if (!IsPlainTemplateCharacter(c0)) return true;
+            AddRawLiteralChar(c0);
+            AddLiteralChar(c0);
+            return false;
+          });
     }
   }
   next().location.end_pos = source_pos();
@@ -93,6 +93,36 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil(check), but only applies |check| to the code units that
+  // |skip| stops at. |skip| is called with the range of buffered code units
+  // still to be checked and returns the first of them that may meet the
+  // requirement, i.e. it treats all code units before that as not meeting it.
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntil(SkipFunctionType skip,
+                                    FunctionType check) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (true) {
+        cursor = skip(cursor, buffer_end_);
+        if (cursor == buffer_end_ || check(static_cast<base::uc32>(*cursor))) {
+          break;
+        }
+        ++cursor;
+      }
+
+      if (cursor == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = cursor + 1;
+        return static_cast<base::uc32>(*cursor);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -534,6 +564,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename SkipFunctionType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(SkipFunctionType skip, FunctionType check) {
+    c0_ = source_->AdvanceUntil(skip, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -63,6 +63,12 @@ class CpuSampler : public sampler::Sampler {
       if (sample->state == JS) ++js_sample_count_;
       if (sample->state == EXTERNAL) ++external_sample_count_;
     }
+#ifdef V8_RUNTIME_CALL_STATS
+    if (V8_UNLIKELY(TracingFlags::is_runtime_stats_enabled()) &&
+        !sample->timestamp.IsNull()) {
+      isolate->counters()->runtime_call_stats()->RecordSample();
+    }
+#endif  // V8_RUNTIME_CALL_STATS
     processor_->FinishTickSample();
   }
 
@@ -39,6 +39,7 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfileDelta* GetAllocationProfileDelta();
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
@@ -4,10 +4,16 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <atomic>
+#include <functional>
+#include <string>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/vector.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/common/globals.h"
@@ -15,6 +21,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -2908,6 +2915,13 @@ int HeapSnapshotJSONSerializer::GetStringId(const char* s) {
   return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
 }
 
+int HeapSnapshotJSONSerializer::LookupStringId(const char* s) const {
+  base::HashMap::Entry* cache_entry =
+      strings_.Lookup(const_cast<char*>(s), StringHash(s));
+  DCHECK_NOT_NULL(cache_entry);
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
 
 namespace {
 
@@ -2926,6 +2940,143 @@ template<> struct ToUnsigned<8> {
   using Type = uint64_t;
 };
 
+// The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
+constexpr int kEdgeBufferSize =
+    MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
+// The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
+// \n and \0
+constexpr int kNodeBufferSize =
+    5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
+    MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
+
+// Nodes or edges are formatted in chunks of this many items. At most
+// kMaxBufferedChunks formatted chunks wait to be written to the stream.
+constexpr size_t kSerializationChunkSize = 4096;
+constexpr size_t kMaxBufferedChunks = 64;
+
+size_t SerializationChunkCount(size_t items) {
+  return (items + kSerializationChunkSize - 1) / kSerializationChunkSize;
+}
+
+// Formats the chunks of a section on background threads, while the main
+// thread writes them to the stream in order. The main thread formats the next
+// chunk itself if no background thread claimed it yet, so that it never waits
+// for workers which did not start.
+class ParallelChunkWriter {
+ public:
+  using FormatChunkCallback =
+      std::function<void(size_t chunk, std::string* output)>;
+
+  ParallelChunkWriter(size_t chunk_count, FormatChunkCallback format_chunk)
+      : format_chunk_(std::move(format_chunk)),
+        states_(chunk_count),
+        outputs_(chunk_count) {}
+  ParallelChunkWriter(const ParallelChunkWriter&) = delete;
+  ParallelChunkWriter& operator=(const ParallelChunkWriter&) = delete;
+
+  void WriteTo(OutputStreamWriter* writer) {
+    std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::make_unique<FormatJob>(this));
+    for (size_t chunk = 0; chunk < outputs_.size(); ++chunk) {
+      if (TryClaim(chunk)) {
+        Format(chunk);
+      } else {
+        base::MutexGuard guard(&mutex_);
+        while (states_[chunk].load(std::memory_order_acquire) != kDone) {
+          formatted_.Wait(&mutex_);
+        }
+      }
+      std::string output = std::move(outputs_[chunk]);
+      writer->AddSubstring(output.c_str(), static_cast<int>(output.size()));
+      if (writer->aborted()) {
+        job_handle->Cancel();
+        return;
+      }
+      written_.store(chunk + 1, std::memory_order_relaxed);
+      job_handle->NotifyConcurrencyIncrease();
+    }
+    job_handle->Join();
+  }
+
+ private:
+  enum State { kPending, kClaimed, kDone };
+
+  class FormatJob final : public JobTask {
+   public:
+    explicit FormatJob(ParallelChunkWriter* chunk_writer)
+        : chunk_writer_(chunk_writer) {}
+
+    void Run(JobDelegate* delegate) override {
+      size_t chunk;
+      while (!delegate->ShouldYield() &&
+             chunk_writer_->ClaimNextChunk(&chunk)) {
+        chunk_writer_->Format(chunk);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      return worker_count + chunk_writer_->ClaimableChunkCount();
+    }
+
+   private:
+    ParallelChunkWriter* const chunk_writer_;
+  };
+
+  bool TryClaim(size_t chunk) {
+    State expected = kPending;
+    return states_[chunk].compare_exchange_strong(expected, kClaimed,
+                                                  std::memory_order_relaxed);
+  }
+
+  size_t ClaimLimit() const {
+    return std::min(outputs_.size(),
+                    written_.load(std::memory_order_relaxed) +
+                        kMaxBufferedChunks);
+  }
+
+  size_t ClaimableChunkCount() const {
+    size_t limit = ClaimLimit();
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    return next < limit ? limit - next : 0;
+  }
+
+  // Claims the first chunk which is neither claimed yet nor too far ahead of
+  // the written ones.
+  bool ClaimNextChunk(size_t* chunk) {
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    while (next < ClaimLimit()) {
+      if (!next_chunk_.compare_exchange_weak(next, next + 1,
+                                             std::memory_order_relaxed)) {
+        continue;
+      }
+      if (TryClaim(next)) {
+        *chunk = next;
+        return true;
+      }
+      // The main thread formats this chunk itself.
+      next = next_chunk_.load(std::memory_order_relaxed);
+    }
+    return false;
+  }
+
+  void Format(size_t chunk) {
+    format_chunk_(chunk, &outputs_[chunk]);
+    base::MutexGuard guard(&mutex_);
+    states_[chunk].store(kDone, std::memory_order_release);
+    formatted_.NotifyOne();
+  }
+
+  const FormatChunkCallback format_chunk_;
+  std::vector<std::atomic<State>> states_;
+  // Only accessed by the thread which claimed the chunk, until it is done.
+  std::vector<std::string> outputs_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> written_{0};
+  base::Mutex mutex_;
+  base::ConditionVariable formatted_;
+};
+
 }  // namespace
 
 template <typename T>
@@ -2955,15 +3106,16 @@ static int utoa(T value, const base::Vector<char>& buffer, int buffer_pos) {
   return utoa_impl(unsigned_value, buffer, buffer_pos);
 }
 
-void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
-                                               bool first_edge) {
-  // The buffer needs space for 3 unsigned ints, 3 commas, \n and \0
-  static const int kBufferSize =
-      MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned * 3 + 3 + 2;
-  base::EmbeddedVector<char, kBufferSize> buffer;
-  int edge_name_or_index = edge->type() == HeapGraphEdge::kElement
-      || edge->type() == HeapGraphEdge::kHidden
-      ? edge->index() : GetStringId(edge->name());
+static bool HasEdgeIndex(const HeapGraphEdge* edge) {
+  return edge->type() == HeapGraphEdge::kElement ||
+         edge->type() == HeapGraphEdge::kHidden;
+}
+
+int HeapSnapshotJSONSerializer::FormatEdge(const HeapGraphEdge* edge,
+                                           int edge_name_or_index,
+                                           bool first_edge,
+                                           const base::Vector<char>& buffer) {
+  DCHECK_GE(buffer.length(), kEdgeBufferSize);
   int buffer_pos = 0;
   if (!first_edge) {
     buffer[buffer_pos++] = ',';
@@ -2974,12 +3126,26 @@ void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(to_node_index(edge->to()), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  return buffer_pos;
+}
+
+void HeapSnapshotJSONSerializer::SerializeEdge(HeapGraphEdge* edge,
+                                               bool first_edge) {
+  base::EmbeddedVector<char, kEdgeBufferSize> buffer;
+  int edge_name_or_index =
+      HasEdgeIndex(edge) ? edge->index() : GetStringId(edge->name());
+  int length = FormatEdge(edge, edge_name_or_index, first_edge, buffer);
+  writer_->AddSubstring(buffer.begin(), length);
 }
 
 void HeapSnapshotJSONSerializer::SerializeEdges() {
   std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  if (FLAG_heap_snapshot_parallel_serialization &&
+      edges.size() > kSerializationChunkSize) {
+    SerializeEdgesInParallel();
+    return;
+  }
   for (size_t i = 0; i < edges.size(); ++i) {
     DCHECK(i == 0 ||
            edges[i - 1]->from()->index() <= edges[i]->from()->index());
@@ -2988,21 +3154,42 @@ void HeapSnapshotJSONSerializer::SerializeEdges() {
   }
 }
 
-void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
-  // The buffer needs space for 5 unsigned ints, 1 size_t, 1 uint8_t, 7 commas,
-  // \n and \0
-  static const int kBufferSize =
-      5 * MaxDecimalDigitsIn<sizeof(unsigned)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(size_t)>::kUnsigned +
-      MaxDecimalDigitsIn<sizeof(uint8_t)>::kUnsigned + 7 + 1 + 1;
-  base::EmbeddedVector<char, kBufferSize> buffer;
+void HeapSnapshotJSONSerializer::SerializeEdgesInParallel() {
+  const std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  // Background threads cannot add strings, so add the edge names in the order
+  // in which SerializeEdge would add them.
+  for (const HeapGraphEdge* edge : edges) {
+    if (!HasEdgeIndex(edge)) GetStringId(edge->name());
+  }
+  ParallelChunkWriter chunk_writer(
+      SerializationChunkCount(edges.size()),
+      [this, &edges](size_t chunk, std::string* output) {
+        base::EmbeddedVector<char, kEdgeBufferSize> buffer;
+        size_t begin = chunk * kSerializationChunkSize;
+        size_t end = std::min(edges.size(), begin + kSerializationChunkSize);
+        for (size_t i = begin; i < end; ++i) {
+          const HeapGraphEdge* edge = edges[i];
+          int edge_name_or_index = HasEdgeIndex(edge)
+                                       ? edge->index()
+                                       : LookupStringId(edge->name());
+          int length = FormatEdge(edge, edge_name_or_index, i == 0, buffer);
+          output->append(buffer.begin(), length);
+        }
+      });
+  chunk_writer.WriteTo(writer_);
+}
+
+int HeapSnapshotJSONSerializer::FormatNode(const HeapEntry* entry,
+                                           int name_id,
+                                           const base::Vector<char>& buffer) {
+  DCHECK_GE(buffer.length(), kNodeBufferSize);
   int buffer_pos = 0;
   if (to_node_index(entry) != 0) {
     buffer[buffer_pos++] = ',';
   }
   buffer_pos = utoa(entry->type(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
-  buffer_pos = utoa(GetStringId(entry->name()), buffer, buffer_pos);
+  buffer_pos = utoa(name_id, buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->id(), buffer, buffer_pos);
   buffer[buffer_pos++] = ',';
@@ -3014,18 +3201,50 @@ void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
   buffer[buffer_pos++] = ',';
   buffer_pos = utoa(entry->detachedness(), buffer, buffer_pos);
   buffer[buffer_pos++] = '\n';
-  buffer[buffer_pos++] = '\0';
-  writer_->AddString(buffer.begin());
+  buffer[buffer_pos] = '\0';
+  return buffer_pos;
+}
+
+void HeapSnapshotJSONSerializer::SerializeNode(const HeapEntry* entry) {
+  base::EmbeddedVector<char, kNodeBufferSize> buffer;
+  int length = FormatNode(entry, GetStringId(entry->name()), buffer);
+  writer_->AddSubstring(buffer.begin(), length);
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes() {
   const std::deque<HeapEntry>& entries = snapshot_->entries();
+  if (FLAG_heap_snapshot_parallel_serialization &&
+      entries.size() > kSerializationChunkSize) {
+    SerializeNodesInParallel();
+    return;
+  }
   for (const HeapEntry& entry : entries) {
     SerializeNode(&entry);
     if (writer_->aborted()) return;
   }
 }
 
+void HeapSnapshotJSONSerializer::SerializeNodesInParallel() {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  // Background threads cannot add strings, so add the node names in the order
+  // in which SerializeNode would add them.
+  for (const HeapEntry& entry : entries) GetStringId(entry.name());
+  ParallelChunkWriter chunk_writer(
+      SerializationChunkCount(entries.size()),
+      [this, &entries](size_t chunk, std::string* output) {
+        base::EmbeddedVector<char, kNodeBufferSize> buffer;
+        size_t begin = chunk * kSerializationChunkSize;
+        size_t end = std::min(entries.size(), begin + kSerializationChunkSize);
+        for (size_t i = begin; i < end; ++i) {
+          const HeapEntry* entry = &entries[i];
+          int length =
+              FormatNode(entry, LookupStringId(entry->name()), buffer);
+          output->append(buffer.begin(), length);
+        }
+      });
+  chunk_writer.WriteTo(writer_);
+}
+
 void HeapSnapshotJSONSerializer::SerializeSnapshot() {
   writer_->AddString("\"meta\":");
   // The object describing node serialization layout.
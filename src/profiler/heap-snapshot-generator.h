@@ -13,6 +13,7 @@
 
 #include "include/v8-profiler.h"
 #include "src/base/platform/time.h"
+#include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/hash-table.h"
@@ -680,13 +681,24 @@ class HeapSnapshotJSONSerializer {
   V8_INLINE static uint32_t StringHash(const void* string);
 
   int GetStringId(const char* s);
+  // Returns the id of a string which was already passed to GetStringId. Does
+  // not modify the string table, so background threads can call it.
+  int LookupStringId(const char* s) const;
   V8_INLINE int to_node_index(const HeapEntry* e);
   V8_INLINE int to_node_index(int entry_index);
+  // Formats one edge or node into |buffer| and returns the number of
+  // characters written, without a trailing \0.
+  int FormatEdge(const HeapGraphEdge* edge, int edge_name_or_index,
+                 bool first_edge, const base::Vector<char>& buffer);
+  int FormatNode(const HeapEntry* entry, int name_id,
+                 const base::Vector<char>& buffer);
   void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
   void SerializeEdges();
+  void SerializeEdgesInParallel();
   void SerializeImpl();
   void SerializeNode(const HeapEntry* entry);
   void SerializeNodes();
+  void SerializeNodesInParallel();
   void SerializeSnapshot();
   void SerializeTraceTree();
   void SerializeTraceNode(AllocationTraceNode* node);
@@ -774,6 +774,215 @@ void CpuProfile::Print() const {
   ProfilerStats::Instance()->Clear();
 }
 
+namespace {
+
+// Field numbers from profile.proto.
+namespace pprof {
+constexpr int kProfileSampleType = 1;
+constexpr int kProfileSample = 2;
+constexpr int kProfileLocation = 4;
+constexpr int kProfileFunction = 5;
+constexpr int kProfileStringTable = 6;
+constexpr int kProfileTimeNanos = 9;
+constexpr int kProfileDurationNanos = 10;
+constexpr int kProfilePeriodType = 11;
+constexpr int kProfilePeriod = 12;
+constexpr int kValueTypeType = 1;
+constexpr int kValueTypeUnit = 2;
+constexpr int kSampleLocationId = 1;
+constexpr int kSampleValue = 2;
+constexpr int kLocationId = 1;
+constexpr int kLocationLine = 4;
+constexpr int kLineFunctionId = 1;
+constexpr int kLineLine = 2;
+constexpr int kFunctionId = 1;
+constexpr int kFunctionName = 2;
+constexpr int kFunctionSystemName = 3;
+constexpr int kFunctionFilename = 4;
+constexpr int kFunctionStartLine = 5;
+}  // namespace pprof
+
+// Encodes the fields of a protocol buffer message.
+class ProtoWriter {
+ public:
+  void WriteVarint(int field, uint64_t value) {
+    WriteTag(field, kVarint);
+    AppendVarint(value);
+  }
+
+  void WriteBytes(int field, const char* data, size_t size) {
+    WriteTag(field, kLengthDelimited);
+    AppendVarint(size);
+    buffer_.append(data, size);
+  }
+
+  void WriteMessage(int field, const ProtoWriter& message) {
+    WriteBytes(field, message.buffer_.data(), message.buffer_.size());
+  }
+
+  void WritePackedVarints(int field, const std::vector<uint64_t>& values) {
+    ProtoWriter packed;
+    for (uint64_t value : values) packed.AppendVarint(value);
+    WriteMessage(field, packed);
+  }
+
+  const std::string& buffer() const { return buffer_; }
+
+ private:
+  enum WireType { kVarint = 0, kLengthDelimited = 2 };
+
+  void WriteTag(int field, WireType type) {
+    AppendVarint((static_cast<uint64_t>(field) << 3) | type);
+  }
+
+  void AppendVarint(uint64_t value) {
+    while (value >= 0x80) {
+      buffer_.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    buffer_.push_back(static_cast<char>(value));
+  }
+
+  std::string buffer_;
+};
+
+ProtoWriter ValueType(uint64_t type, uint64_t unit) {
+  ProtoWriter value_type;
+  value_type.WriteVarint(pprof::kValueTypeType, type);
+  value_type.WriteVarint(pprof::kValueTypeUnit, unit);
+  return value_type;
+}
+
+}  // namespace
+
+uint64_t CpuProfilePprofSerializer::GetStringId(const char* string) {
+  auto result = string_ids_.emplace(string, strings_.size());
+  if (result.second) strings_.push_back(result.first->first.c_str());
+  return result.first->second;
+}
+
+uint64_t CpuProfilePprofSerializer::GetFunctionId(CodeEntry* entry) {
+  // Ids have to be non-zero.
+  auto result = function_ids_.emplace(entry, functions_.size() + 1);
+  if (result.second) functions_.push_back(entry);
+  return result.first->second;
+}
+
+int64_t CpuProfilePprofSerializer::GetSamplingIntervalNanos() const {
+  // Same as in {CpuProfilesCollection::GetCommonSamplingInterval}, the
+  // requested interval is snapped to a multiple of the profiler's interval.
+  int64_t interval_us = profile_->sampling_interval_us();
+  CpuProfiler* profiler = profile_->cpu_profiler();
+  int64_t base_interval_us =
+      profiler ? profiler->sampling_interval().InMicroseconds() : 0;
+  if (base_interval_us > 0) {
+    interval_us =
+        std::max<int64_t>((interval_us + base_interval_us - 1) /
+                              base_interval_us,
+                          1) *
+        base_interval_us;
+  }
+  return interval_us * base::Time::kNanosecondsPerMicrosecond;
+}
+
+void CpuProfilePprofSerializer::Serialize(v8::OutputStream* stream) {
+  ProtoWriter profile;
+  // The first string has to be the empty string.
+  GetStringId("");
+  const uint64_t samples_id = GetStringId("samples");
+  const uint64_t count_id = GetStringId("count");
+  const uint64_t cpu_id = GetStringId("cpu");
+  const uint64_t nanoseconds_id = GetStringId("nanoseconds");
+  const int64_t interval_ns = GetSamplingIntervalNanos();
+
+  profile.WriteMessage(pprof::kProfileSampleType,
+                       ValueType(samples_id, count_id));
+  profile.WriteMessage(pprof::kProfileSampleType,
+                       ValueType(cpu_id, nanoseconds_id));
+
+  // One location per node of the tree except the root, one sample per node
+  // with self ticks.
+  std::vector<const ProfileNode*> worklist = {profile_->top_down()->root()};
+  std::vector<uint64_t> location_ids;
+  while (!worklist.empty()) {
+    const ProfileNode* node = worklist.back();
+    worklist.pop_back();
+    for (const ProfileNode* child : *node->children()) {
+      worklist.push_back(child);
+    }
+    if (node->parent() == nullptr) continue;
+
+    CodeEntry* entry = node->entry();
+    ProtoWriter line;
+    line.WriteVarint(pprof::kLineFunctionId, GetFunctionId(entry));
+    line.WriteVarint(pprof::kLineLine, entry->line_number());
+    ProtoWriter location;
+    location.WriteVarint(pprof::kLocationId, node->id());
+    location.WriteMessage(pprof::kLocationLine, line);
+    profile.WriteMessage(pprof::kProfileLocation, location);
+
+    if (node->self_ticks() == 0) continue;
+    location_ids.clear();
+    for (const ProfileNode* frame = node; frame->parent() != nullptr;
+         frame = frame->parent()) {
+      location_ids.push_back(frame->id());
+    }
+    ProtoWriter sample;
+    sample.WritePackedVarints(pprof::kSampleLocationId, location_ids);
+    uint64_t ticks = node->self_ticks();
+    sample.WritePackedVarints(pprof::kSampleValue,
+                              {ticks, ticks * interval_ns});
+    profile.WriteMessage(pprof::kProfileSample, sample);
+  }
+
+  for (size_t i = 0; i < functions_.size(); ++i) {
+    CodeEntry* entry = functions_[i];
+    const char* name = entry->name();
+    if (name[0] == '\0') name = "(anonymous)";
+    ProtoWriter function;
+    uint64_t name_id = GetStringId(name);
+    function.WriteVarint(pprof::kFunctionId, i + 1);
+    function.WriteVarint(pprof::kFunctionName, name_id);
+    function.WriteVarint(pprof::kFunctionSystemName, name_id);
+    function.WriteVarint(pprof::kFunctionFilename,
+                         GetStringId(entry->resource_name()));
+    function.WriteVarint(pprof::kFunctionStartLine, entry->line_number());
+    profile.WriteMessage(pprof::kProfileFunction, function);
+  }
+
+  // The profile only records monotonic time, derive the wall clock time of
+  // its start from the current time.
+  base::TimeDelta age = base::TimeTicks::Now() - profile_->start_time();
+  double start_ms = (base::Time::Now() - age).ToJsTime();
+  profile.WriteVarint(
+      pprof::kProfileTimeNanos,
+      static_cast<int64_t>(start_ms * base::Time::kNanosecondsPerMicrosecond *
+                           base::Time::kMicrosecondsPerMillisecond));
+  profile.WriteVarint(
+      pprof::kProfileDurationNanos,
+      (profile_->end_time() - profile_->start_time()).InNanoseconds());
+  profile.WriteMessage(pprof::kProfilePeriodType,
+                       ValueType(cpu_id, nanoseconds_id));
+  profile.WriteVarint(pprof::kProfilePeriod, interval_ns);
+
+  // The string table comes last, since all other fields add to it.
+  for (const char* string : strings_) {
+    profile.WriteBytes(pprof::kProfileStringTable, string, strlen(string));
+  }
+
+  const std::string& data = profile.buffer();
+  const size_t chunk_size = static_cast<size_t>(stream->GetChunkSize());
+  for (size_t offset = 0; offset < data.size(); offset += chunk_size) {
+    size_t size = std::min(chunk_size, data.size() - offset);
+    if (stream->WriteAsciiChunk(const_cast<char*>(data.data()) + offset,
+                                static_cast<int>(size)) ==
+        v8::OutputStream::kAbort) {
+      return;
+    }
+  }
+  stream->EndOfStream();
+}
+
 void CodeEntryStorage::AddRef(CodeEntry* entry) {
   if (entry->is_ref_counted()) entry->AddRef();
 }
@@ -10,6 +10,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -466,6 +467,32 @@ class CpuProfile {
   base::TimeDelta next_sample_delta_;
 };
 
+// Writes a CpuProfile in the pprof format, see v8::CpuProfile::Serialize.
+class V8_EXPORT_PRIVATE CpuProfilePprofSerializer {
+ public:
+  explicit CpuProfilePprofSerializer(const CpuProfile* profile)
+      : profile_(profile) {}
+  CpuProfilePprofSerializer(const CpuProfilePprofSerializer&) = delete;
+  CpuProfilePprofSerializer& operator=(const CpuProfilePprofSerializer&) =
+      delete;
+
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  // Returns the index of |string| in the string table.
+  uint64_t GetStringId(const char* string);
+  // Returns the id of the function for |entry|, adding it if needed.
+  uint64_t GetFunctionId(CodeEntry* entry);
+  // The sampling interval the profile was recorded with.
+  int64_t GetSamplingIntervalNanos() const;
+
+  const CpuProfile* const profile_;
+  std::unordered_map<std::string, uint64_t> string_ids_;
+  std::vector<const char*> strings_;
+  std::unordered_map<CodeEntry*, uint64_t> function_ids_;
+  std::vector<CodeEntry*> functions_;
+};
+
 class CpuProfileMaxSamplesCallbackTask : public v8::Task {
  public:
   explicit CpuProfileMaxSamplesCallbackTask(
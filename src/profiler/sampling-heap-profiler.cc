@@ -89,6 +89,7 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
       std::make_unique<Sample>(size, node, loc, this, next_sample_id());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
+  if (track_deltas_) unreported_samples_.insert(sample.get());
   samples_.emplace(sample.get(), std::move(sample));
 }
 
@@ -109,7 +110,12 @@ void SamplingHeapProfiler::OnWeakCallback(
       node = parent;
     }
   }
-  sample->profiler->samples_.erase(sample);
+  SamplingHeapProfiler* profiler = sample->profiler;
+  if (profiler->track_deltas_ &&
+      profiler->unreported_samples_.erase(sample) == 0) {
+    profiler->removed_sample_ids_.push_back(sample->sample_id);
+  }
+  profiler->samples_.erase(sample);
   // sample is deleted because its unique ptr was erased from samples_.
 }
 
@@ -125,6 +131,10 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
   }
   auto new_child = std::make_unique<AllocationNode>(
       parent, name, script_id, start_position, next_node_id());
+  if (track_deltas_) {
+    unreported_nodes_.push_back(UnreportedNode{
+        new_child->id_, parent->id_, name, script_id, start_position});
+  }
   return parent->AddChildNode(id, std::move(new_child));
 }
 
@@ -213,25 +223,13 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   // By pinning the node we make sure its children won't get disposed if
   // a GC kicks in during the tree retrieval.
   node->pinned_ = true;
-  Local<v8::String> script_name =
-      ToApiHandle<v8::String>(isolate_->factory()->InternalizeUtf8String(""));
-  int line = v8::AllocationProfile::kNoLineNumberInfo;
-  int column = v8::AllocationProfile::kNoColumnNumberInfo;
+  Local<v8::String> script_name;
+  int line;
+  int column;
+  ResolvePosition(node->script_id_, node->script_position_, scripts,
+                  &script_name, &line, &column);
   std::vector<v8::AllocationProfile::Allocation> allocations;
   allocations.reserve(node->allocations_.size());
-  if (node->script_id_ != v8::UnboundScript::kNoScriptId) {
-    auto script_iterator = scripts.find(node->script_id_);
-    if (script_iterator != scripts.end()) {
-      Handle<Script> script = script_iterator->second;
-      if (script->name().IsName()) {
-        Name name = Name::cast(script->name());
-        script_name = ToApiHandle<v8::String>(
-            isolate_->factory()->InternalizeUtf8String(names_->GetName(name)));
-      }
-      line = 1 + Script::GetLineNumber(script, node->script_position_);
-      column = 1 + Script::GetColumnNumber(script, node->script_position_);
-    }
-  }
   for (auto alloc : node->allocations_) {
     allocations.push_back(ScaleSample(alloc.first, alloc.second));
   }
@@ -254,21 +252,44 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   return current;
 }
 
-v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
-  if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
-    isolate_->heap()->CollectAllGarbage(
-        Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
+void SamplingHeapProfiler::ResolvePosition(
+    int script_id, int position, const std::map<int, Handle<Script>>& scripts,
+    Local<v8::String>* script_name, int* line, int* column) {
+  *script_name =
+      ToApiHandle<v8::String>(isolate_->factory()->InternalizeUtf8String(""));
+  *line = v8::AllocationProfile::kNoLineNumberInfo;
+  *column = v8::AllocationProfile::kNoColumnNumberInfo;
+  if (script_id == v8::UnboundScript::kNoScriptId) return;
+  auto script_iterator = scripts.find(script_id);
+  if (script_iterator == scripts.end()) return;
+  Handle<Script> script = script_iterator->second;
+  if (script->name().IsName()) {
+    Name name = Name::cast(script->name());
+    *script_name = ToApiHandle<v8::String>(
+        isolate_->factory()->InternalizeUtf8String(names_->GetName(name)));
   }
+  *line = 1 + Script::GetLineNumber(script, position);
+  *column = 1 + Script::GetColumnNumber(script, position);
+}
+
+std::map<int, Handle<Script>> SamplingHeapProfiler::CollectScripts() {
   // To resolve positions to line/column numbers, we will need to look up
   // scripts. Build a map to allow fast mapping from script id to script.
   std::map<int, Handle<Script>> scripts;
-  {
-    Script::Iterator iterator(isolate_);
-    for (Script script = iterator.Next(); !script.is_null();
-         script = iterator.Next()) {
-      scripts[script.id()] = handle(script, isolate_);
-    }
+  Script::Iterator iterator(isolate_);
+  for (Script script = iterator.Next(); !script.is_null();
+       script = iterator.Next()) {
+    scripts[script.id()] = handle(script, isolate_);
+  }
+  return scripts;
+}
+
+v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
+  if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
+    isolate_->heap()->CollectAllGarbage(
+        Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
   }
+  std::map<int, Handle<Script>> scripts = CollectScripts();
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
   profile->samples_ = BuildSamples();
@@ -276,6 +297,61 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   return profile;
 }
 
+v8::AllocationProfileDelta* SamplingHeapProfiler::GetAllocationProfileDelta() {
+  if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
+    isolate_->heap()->CollectAllGarbage(
+        Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
+  }
+  auto delta = new v8::internal::AllocationProfileDelta();
+  std::vector<UnreportedNode> nodes;
+  if (!track_deltas_) {
+    // The first delta contains the whole tree and all live samples.
+    track_deltas_ = true;
+    std::vector<const AllocationNode*> worklist = {&profile_root_};
+    while (!worklist.empty()) {
+      const AllocationNode* node = worklist.back();
+      worklist.pop_back();
+      nodes.push_back(UnreportedNode{
+          node->id_, node->parent_ ? node->parent_->id_ : 0, node->name_,
+          node->script_id_, node->script_position_});
+      for (const auto& it : node->children_) {
+        worklist.push_back(it.second.get());
+      }
+    }
+    delta->samples_ = BuildSamples();
+  } else {
+    nodes.swap(unreported_nodes_);
+    delta->samples_.reserve(unreported_samples_.size());
+    for (const Sample* sample : unreported_samples_) {
+      delta->samples_.emplace_back(v8::AllocationProfile::Sample{
+          sample->owner->id_, sample->size,
+          ScaleSample(sample->size, 1).count, sample->sample_id});
+    }
+    unreported_samples_.clear();
+    delta->removed_sample_ids_.swap(removed_sample_ids_);
+  }
+
+  // Everything below may allocate on the JS heap, which may add or collect
+  // samples. These are already accounted for the next delta.
+  std::map<int, Handle<Script>> scripts;
+  if (!nodes.empty()) scripts = CollectScripts();
+  delta->frames_.reserve(nodes.size());
+  for (const UnreportedNode& node : nodes) {
+    v8::AllocationProfileDelta::Frame frame;
+    frame.name = ToApiHandle<v8::String>(
+        isolate_->factory()->InternalizeUtf8String(node.name));
+    ResolvePosition(node.script_id, node.start_position, scripts,
+                    &frame.script_name, &frame.line_number,
+                    &frame.column_number);
+    frame.script_id = node.script_id;
+    frame.start_position = node.start_position;
+    frame.node_id = node.id;
+    frame.parent_node_id = node.parent_id;
+    delta->frames_.push_back(frame);
+  }
+  return delta;
+}
+
 const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
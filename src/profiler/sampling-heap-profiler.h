@@ -9,6 +9,8 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "include/v8-profiler.h"
 #include "src/heap/heap.h"
@@ -43,6 +45,30 @@ class AllocationProfile : public v8::AllocationProfile {
   friend class SamplingHeapProfiler;
 };
 
+class AllocationProfileDelta : public v8::AllocationProfileDelta {
+ public:
+  AllocationProfileDelta() = default;
+  AllocationProfileDelta(const AllocationProfileDelta&) = delete;
+  AllocationProfileDelta& operator=(const AllocationProfileDelta&) = delete;
+
+  const std::vector<Frame>& GetNewFrames() override { return frames_; }
+
+  const std::vector<v8::AllocationProfile::Sample>& GetNewSamples() override {
+    return samples_;
+  }
+
+  const std::vector<uint64_t>& GetRemovedSampleIds() override {
+    return removed_sample_ids_;
+  }
+
+ private:
+  std::vector<Frame> frames_;
+  std::vector<v8::AllocationProfile::Sample> samples_;
+  std::vector<uint64_t> removed_sample_ids_;
+
+  friend class SamplingHeapProfiler;
+};
+
 class SamplingHeapProfiler {
  public:
   class AllocationNode {
@@ -123,6 +149,7 @@ class SamplingHeapProfiler {
   SamplingHeapProfiler& operator=(const SamplingHeapProfiler&) = delete;
 
   v8::AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfileDelta* GetAllocationProfileDelta();
   StringsStorage* names() const { return names_; }
 
  private:
@@ -158,6 +185,16 @@ class SamplingHeapProfiler {
     uint64_t const rate_;
   };
 
+  // A node which has not been reported by a delta yet. The node itself may
+  // be gone by the time the delta is requested.
+  struct UnreportedNode {
+    uint32_t id;
+    uint32_t parent_id;
+    const char* name;
+    int script_id;
+    int start_position;
+  };
+
   void SampleObject(Address soon_object, size_t size);
 
   const std::vector<v8::AllocationProfile::Sample> BuildSamples() const;
@@ -181,6 +218,12 @@ class SamplingHeapProfiler {
       const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count) const;
+  // Resolves the script name, line and column of the given source position.
+  void ResolvePosition(int script_id, int position,
+                       const std::map<int, Handle<Script>>& scripts,
+                       Local<v8::String>* script_name, int* line,
+                       int* column);
+  std::map<int, Handle<Script>> CollectScripts();
   AllocationNode* AddStack();
 
   Isolate* const isolate_;
@@ -191,6 +234,12 @@ class SamplingHeapProfiler {
   StringsStorage* const names_;
   AllocationNode profile_root_;
   std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  // Changes since the last delta. Only tracked after the first delta was
+  // requested.
+  bool track_deltas_ = false;
+  std::vector<UnreportedNode> unreported_nodes_;
+  std::unordered_set<Sample*> unreported_samples_;
+  std::vector<uint64_t> removed_sample_ids_;
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
@@ -640,6 +640,51 @@ void RegExpMacroAssemblerARM64::CheckBitInTable(
   CompareAndBranchOrBacktrack(w11, 0, ne, on_bit_set);
 }
 
+bool RegExpMacroAssemblerARM64::SkipUntilCharacters(int cp_offset,
+                                                    int characters,
+                                                    base::uc16 c1,
+                                                    base::uc16 c2,
+                                                    base::uc16 mask) {
+  DCHECK(characters == 1 || characters == 2);
+  const uint32_t packed_characters =
+      c1 | (characters == 2 ? static_cast<uint32_t>(c2) << 16 : 0);
+  const uint32_t packed_masks =
+      mask | (characters == 2 ? static_cast<uint32_t>(mask) << 16 : 0);
+  static const int kNumArguments = 4;
+
+  PushCachedRegisters();
+
+  // Put arguments into arguments registers.
+  // Parameters are
+  //   x0: Address begin - Address of the first character to look at.
+  //   x1: Address end - Address past the last position to look at.
+  //   w2: uint32_t characters - The characters to look for.
+  //   w3: uint32_t masks - The masks to apply.
+  __ Add(x0, input_end(), Operand(current_input_offset(), SXTW));
+  if (cp_offset != 0) __ Add(x0, x0, cp_offset * char_size());
+  __ Sub(x1, input_end(), (characters - 1) * char_size());
+  __ Mov(w2, packed_characters);
+  __ Mov(w3, packed_masks);
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(masm_.get(), StackFrame::MANUAL);
+    ExternalReference find =
+        mode_ == LATIN1 ? ExternalReference::re_find_characters_one_byte()
+                        : ExternalReference::re_find_characters_two_byte();
+    __ CallCFunction(find, kNumArguments);
+  }
+
+  // The new position is the address of the found characters, relative to the
+  // end of the input. x0 is one of the registers used as a cache so it must
+  // be read before the cache is restored.
+  __ Sub(x10, x0, input_end());
+  PopCachedRegisters();
+  __ Sub(current_input_offset(), w10, cp_offset * char_size());
+  __ Mov(code_pointer(), Operand(masm_->CodeObject()));
+  return true;
+}
+
 bool RegExpMacroAssemblerARM64::CheckSpecialCharacterClass(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -61,6 +61,8 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   // Checks whether the given offset from the current position is before
   // the end of the string.
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
+  bool SkipUntilCharacters(int cp_offset, int characters, base::uc16 c1,
+                           base::uc16 c2, base::uc16 mask) override;
   bool CheckSpecialCharacterClass(StandardCharacterSet type,
                                   Label* on_no_match) override;
   void BindJumpTarget(Label* label = nullptr) override;
@@ -4,6 +4,11 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
@@ -55,6 +60,255 @@ bool SatisfiesAssertion(RegExpAssertion::Type type,
   }
 }
 
+// A deterministic finite automaton for a bytecode program, whose states and
+// transitions are computed on demand, as in RE2.  It can only tell whether
+// there is a match, and where the first one ends, but not where matches start
+// or what the captures are.  The NFA interpreter uses it to find out quickly
+// that there is no (further) match in the input.
+//
+// A state is the set of program counters of threads that have just consumed
+// a character, together with the kind of that character, which decides the
+// assertions that hold at the current position together with the kind of the
+// next character.  Characters are grouped into classes that behave the same
+// in every instruction of the program, so that transitions are cached per
+// class.  The number of states is bounded by
+// --experimental-regexp-engine-dfa-max-states: When the cache is full, it is
+// cleared, and if that happens too often, the DFA gives up.
+class LazyDfa final {
+ public:
+  enum CharKind : int {
+    // The start or the end of the input.
+    kNone,
+    kLineTerminator,
+    kWordChar,
+    kOtherChar,
+  };
+
+  struct Transition {
+    int next_state;
+    // Whether a thread reached ACCEPT before consuming the character.
+    bool accepts;
+    // Whether the DFA gave up because the cache was thrashing.
+    bool gave_up;
+  };
+
+  explicit LazyDfa(base::Vector<const RegExpInstruction> bytecode)
+      : bytecode_(bytecode.begin(), bytecode.end()),
+        max_states_(std::max(FLAG_experimental_regexp_engine_dfa_max_states,
+                             2)),
+        pc_marks_(bytecode.size(), 0) {
+    ComputeCharClasses();
+  }
+
+  static CharKind KindOf(base::uc16 c) {
+    if (unibrow::IsLineTerminator(c)) return kLineTerminator;
+    if (IsRegExpWord(c)) return kWordChar;
+    return kOtherChar;
+  }
+
+  // The state in which the search starts, at a position that follows a
+  // character of kind `previous`.
+  int StartState(CharKind previous) {
+    std::vector<int> key = {previous, 0};
+    auto it = state_ids_.find(key);
+    if (it != state_ids_.end()) return it->second;
+    // Make room for the start state if needed; no transitions are lost, as
+    // the search starts over.
+    if (states_.size() == static_cast<size_t>(max_states_)) {
+      states_.clear();
+      state_ids_.clear();
+    }
+    return AddState(std::move(key));
+  }
+
+  // Whether no thread is left in `state`, so that there is no match.
+  bool IsDead(int state) const { return states_[state].key.size() == 1; }
+
+  Transition Next(int state, base::uc16 c) {
+    int char_class = ClassOf(c);
+    int cached = states_[state].transitions[char_class];
+    if (cached != kNoTransition) {
+      return {cached >> 1, (cached & 1) != 0, false};
+    }
+
+    ++transitions_since_reset_;
+    bool accepts = false;
+    std::vector<int> key = Step(state, char_class, &accepts);
+    auto it = state_ids_.find(key);
+    int next_state;
+    if (it != state_ids_.end()) {
+      next_state = it->second;
+    } else if (states_.size() < static_cast<size_t>(max_states_)) {
+      next_state = AddState(std::move(key));
+    } else {
+      // RE2's heuristic: The DFA is not worth it if it needs to be rebuilt
+      // after having computed few transitions, relative to its size.
+      if (transitions_since_reset_ < 10 * max_states_) {
+        return {0, false, true};
+      }
+      states_.clear();
+      state_ids_.clear();
+      transitions_since_reset_ = 0;
+      return {AddState(std::move(key)), accepts, false};
+    }
+    states_[state].transitions[char_class] = (next_state << 1) | accepts;
+    return {next_state, accepts, false};
+  }
+
+  // Whether a thread reaches ACCEPT at the end of the input in `state`.
+  bool AcceptsAtEnd(int state) {
+    bool accepts = false;
+    Step(state, kEndOfInput, &accepts);
+    return accepts;
+  }
+
+ private:
+  static constexpr int kNoTransition = -1;
+  // The pseudo character class of the end of the input.
+  static constexpr int kEndOfInput = -1;
+
+  struct State {
+    // The kind of the previous character, followed by the sorted program
+    // counters of the threads.
+    std::vector<int> key;
+    // The transitions by character class, encoded as (next state << 1) |
+    // accepts, or kNoTransition if not computed yet.
+    std::vector<int> transitions;
+  };
+
+  void ComputeCharClasses() {
+    // The characters at which the result of a CONSUME_RANGE instruction or
+    // the kind of a character changes.
+    std::vector<int> boundaries = {0, 0x0A, 0x0B, 0x0D, 0x0E, '0', '9' + 1,
+                                   'A', 'Z' + 1, '_', '_' + 1, 'a', 'z' + 1,
+                                   0x2028, 0x202A};
+    for (const RegExpInstruction& inst : bytecode_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      boundaries.push_back(inst.payload.consume_range.min);
+      boundaries.push_back(inst.payload.consume_range.max + 1);
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    for (int boundary : boundaries) {
+      if (boundary > 0xFFFF) break;
+      if (class_starts_.empty() || class_starts_.back() != boundary) {
+        class_starts_.push_back(static_cast<base::uc16>(boundary));
+      }
+    }
+    for (int c = 0; c < kOneByteCharCount; ++c) {
+      one_byte_classes_[c] = LookUpClass(static_cast<base::uc16>(c));
+    }
+  }
+
+  int LookUpClass(base::uc16 c) const {
+    return static_cast<int>(std::upper_bound(class_starts_.begin(),
+                                             class_starts_.end(), c) -
+                            class_starts_.begin()) -
+           1;
+  }
+
+  int ClassOf(base::uc16 c) const {
+    if (c < kOneByteCharCount) return one_byte_classes_[c];
+    return LookUpClass(c);
+  }
+
+  int AddState(std::vector<int> key) {
+    DCHECK_EQ(state_ids_.count(key), 0);
+    DCHECK_LT(states_.size(), static_cast<size_t>(max_states_));
+    int id = static_cast<int>(states_.size());
+    state_ids_.emplace(key, id);
+    std::vector<int> transitions(class_starts_.size(), kNoTransition);
+    states_.push_back({std::move(key), std::move(transitions)});
+    return id;
+  }
+
+  static bool SatisfiesAssertion(RegExpAssertion::Type type,
+                                 CharKind previous, CharKind next) {
+    switch (type) {
+      case RegExpAssertion::Type::START_OF_INPUT:
+        return previous == kNone;
+      case RegExpAssertion::Type::END_OF_INPUT:
+        return next == kNone;
+      case RegExpAssertion::Type::START_OF_LINE:
+        return previous == kNone || previous == kLineTerminator;
+      case RegExpAssertion::Type::END_OF_LINE:
+        return next == kNone || next == kLineTerminator;
+      case RegExpAssertion::Type::BOUNDARY:
+        return (previous == kWordChar) != (next == kWordChar);
+      case RegExpAssertion::Type::NON_BOUNDARY:
+        return (previous == kWordChar) == (next == kWordChar);
+    }
+  }
+
+  // Runs the threads of `state` until they consume a character of class
+  // `char_class`, and returns the key of the resulting state.  Sets
+  // `*accepts` if a thread reaches ACCEPT on the way.
+  std::vector<int> Step(int state, int char_class, bool* accepts) {
+    const std::vector<int>& key = states_[state].key;
+    CharKind previous = static_cast<CharKind>(key[0]);
+    base::uc16 c = char_class == kEndOfInput ? 0 : class_starts_[char_class];
+    CharKind next = char_class == kEndOfInput ? kNone : KindOf(c);
+
+    std::vector<int> result = {next};
+    if (++pc_mark_ == 0) {
+      std::fill(pc_marks_.begin(), pc_marks_.end(), 0);
+      pc_mark_ = 1;
+    }
+    std::vector<int> worklist(key.begin() + 1, key.end());
+    while (!worklist.empty()) {
+      int pc = worklist.back();
+      worklist.pop_back();
+      while (pc_marks_[pc] != pc_mark_) {
+        pc_marks_[pc] = pc_mark_;
+        const RegExpInstruction& inst = bytecode_[pc];
+        if (inst.opcode == RegExpInstruction::CONSUME_RANGE) {
+          RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+          if (char_class != kEndOfInput && c >= range.min && c <= range.max) {
+            result.push_back(pc + 1);
+          }
+          break;
+        } else if (inst.opcode == RegExpInstruction::ACCEPT) {
+          *accepts = true;
+          break;
+        } else if (inst.opcode == RegExpInstruction::ASSERTION) {
+          if (!SatisfiesAssertion(inst.payload.assertion_type, previous,
+                                  next)) {
+            break;
+          }
+          ++pc;
+        } else if (inst.opcode == RegExpInstruction::FORK) {
+          worklist.push_back(inst.payload.pc);
+          ++pc;
+        } else if (inst.opcode == RegExpInstruction::JMP) {
+          pc = inst.payload.pc;
+        } else {
+          DCHECK(inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP ||
+                 inst.opcode == RegExpInstruction::CLEAR_REGISTER);
+          ++pc;
+        }
+      }
+    }
+    std::sort(result.begin() + 1, result.end());
+    return result;
+  }
+
+  static constexpr int kOneByteCharCount = 256;
+
+  const std::vector<RegExpInstruction> bytecode_;
+  const int max_states_;
+
+  // The first character of each character class.
+  std::vector<base::uc16> class_starts_;
+  int one_byte_classes_[kOneByteCharCount];
+
+  std::vector<State> states_;
+  std::map<std::vector<int>, int> state_ids_;
+  int transitions_since_reset_ = 0;
+
+  // Marks the program counters visited by the current Step.
+  std::vector<uint32_t> pc_marks_;
+  uint32_t pc_mark_ = 0;
+};
+
 base::Vector<RegExpInstruction> ToInstructionVector(
     ByteArray raw_bytes, const DisallowGarbageCollection& no_gc) {
   RegExpInstruction* inst_begin =
@@ -159,6 +413,12 @@ class NfaInterpreter {
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    // Building the DFA does not pay off for short inputs.
+    if (FLAG_experimental_regexp_engine_lazy_dfa &&
+        input_.length() - input_index_ >= kMinInputLengthForDfa) {
+      dfa_ = std::make_unique<LazyDfa>(bytecode_);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -328,6 +588,13 @@ class NfaInterpreter {
       best_match_registers_ = base::nullopt;
     }
 
+    if (dfa_) {
+      bool has_match;
+      int err_code = HasMatch(&has_match);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!has_match) return RegExp::kInternalRegExpSuccess;
+    }
+
     // All threads start at bytecode 0.
     active_threads_.Add(
         InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
@@ -348,7 +615,6 @@ class NfaInterpreter {
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -364,6 +630,40 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Runs the DFA from the current `input_index_` to find out whether there is
+  // a match in the rest of the input, and sets `*has_match` accordingly.  If
+  // the DFA gives up, it is discarded and `*has_match` is set to true, so
+  // that the NFA decides.  Returns an error code if execution was interrupted
+  // and RegExp::kInternalRegExpSuccess otherwise.
+  int HasMatch(bool* has_match) {
+    LazyDfa::CharKind previous = LazyDfa::kNone;
+    if (input_index_ > 0) previous = LazyDfa::KindOf(input_[input_index_ - 1]);
+    int state = dfa_->StartState(previous);
+    for (int i = input_index_; i < input_.length(); ++i) {
+      if ((i + 1) % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+      LazyDfa::Transition transition = dfa_->Next(state, input_[i]);
+      if (transition.gave_up) {
+        dfa_.reset();
+        *has_match = true;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      if (transition.accepts) {
+        *has_match = true;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      state = transition.next_state;
+      if (dfa_->IsDead(state)) {
+        *has_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+    }
+    *has_match = dfa_->AcceptsAtEnd(state);
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -510,6 +810,9 @@ class NfaInterpreter {
     pc_last_input_index_[pc] = input_index_;
   }
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+  static constexpr int kMinInputLengthForDfa = 64;
+
   Isolate* const isolate_;
 
   const RegExp::CallOrigin call_origin_;
@@ -551,6 +854,10 @@ class NfaInterpreter {
   // `register_array_allocator_`.
   base::Optional<base::Vector<int>> best_match_registers_;
 
+  // Finds out quickly whether there is a match at all, if the input is long
+  // enough and the DFA has not given up.
+  std::unique_ptr<LazyDfa> dfa_;
+
   Zone* zone_;
 };
 
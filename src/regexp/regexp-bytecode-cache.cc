@@ -0,0 +1,108 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <map>
+#include <tuple>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct Key {
+  std::vector<base::uc16> pattern;
+  int flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+
+  bool operator<(const Key& other) const {
+    return std::tie(pattern, flags, is_one_byte, backtrack_limit) <
+           std::tie(other.pattern, other.flags, other.is_one_byte,
+                    other.backtrack_limit);
+  }
+};
+
+struct Cache {
+  std::map<Key, std::shared_ptr<const RegExpBytecodeCache::Entry>> entries;
+  size_t bytecode_bytes = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(Cache, GetCache)
+base::LazyMutex g_cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+std::vector<base::uc16> ToVector(String string) {
+  DCHECK(string.IsFlat());
+  std::vector<base::uc16> result(string.length());
+  String::WriteToFlat(string, result.data(), 0, string.length());
+  return result;
+}
+
+Key MakeKey(Handle<String> pattern, RegExpFlags flags, bool is_one_byte,
+            uint32_t backtrack_limit) {
+  return {ToVector(*pattern), static_cast<int>(flags), is_one_byte,
+          backtrack_limit};
+}
+
+}  // namespace
+
+// static
+std::shared_ptr<const RegExpBytecodeCache::Entry> RegExpBytecodeCache::Lookup(
+    Handle<String> pattern, RegExpFlags flags, bool is_one_byte,
+    uint32_t backtrack_limit) {
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+  base::MutexGuard guard(g_cache_mutex.Pointer());
+  Cache* cache = GetCache();
+  auto it = cache->entries.find(key);
+  if (it == cache->entries.end()) return {};
+  return it->second;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Handle<String> pattern, RegExpFlags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 Handle<ByteArray> bytecode, int register_count,
+                                 uint32_t compiled_backtrack_limit,
+                                 Handle<FixedArray> capture_name_map) {
+  auto entry = std::make_shared<Entry>();
+  entry->bytecode.resize(bytecode->length());
+  bytecode->copy_out(0, entry->bytecode.data(), bytecode->length());
+  entry->register_count = register_count;
+  entry->backtrack_limit = compiled_backtrack_limit;
+  if (!capture_name_map.is_null()) {
+    for (int i = 0; i < capture_name_map->length(); i += 2) {
+      String name = String::cast(capture_name_map->get(i));
+      int index = Smi::ToInt(capture_name_map->get(i + 1));
+      entry->named_captures.emplace_back(ToVector(name), index);
+    }
+  }
+  Key key = MakeKey(pattern, flags, is_one_byte, backtrack_limit);
+
+  base::MutexGuard guard(g_cache_mutex.Pointer());
+  Cache* cache = GetCache();
+  if (cache->bytecode_bytes + entry->bytecode.size() > kMaxBytecodeBytes) {
+    return;
+  }
+  size_t size = entry->bytecode.size();
+  if (cache->entries.emplace(std::move(key), std::move(entry)).second) {
+    cache->bytecode_bytes += size;
+  }
+}
+
+// static
+void RegExpBytecodeCache::ClearForTesting() {
+  base::MutexGuard guard(g_cache_mutex.Pointer());
+  Cache* cache = GetCache();
+  cache->entries.clear();
+  cache->bytecode_bytes = 0;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "src/base/strings.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class FixedArray;
+class String;
+
+// A process-wide cache of irregexp bytecode, keyed by pattern, flags,
+// subject encoding and backtrack limit. Bytecode does not refer to heap
+// objects, so all isolates can share it: a regexp compiled to bytecode once
+// is neither parsed nor compiled again, not in other isolates and not after
+// its data was flushed. Native code is not cached, since it embeds
+// isolate-specific references.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  // The cache stops accepting entries once it holds this many bytes of
+  // bytecode.
+  static constexpr size_t kMaxBytecodeBytes = 4 * MB;
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count = 0;
+    // The backtrack limit after compilation, which may differ from the one
+    // in the key.
+    uint32_t backtrack_limit = 0;
+    // Pairs of capture name and capture index, sorted by index.
+    std::vector<std::pair<std::vector<base::uc16>, int>> named_captures;
+  };
+
+  // Returns the entry for the given key, or null if there is none. {pattern}
+  // must be flat.
+  static std::shared_ptr<const Entry> Lookup(Handle<String> pattern,
+                                             RegExpFlags flags,
+                                             bool is_one_byte,
+                                             uint32_t backtrack_limit);
+
+  // Adds the bytecode and capture name map of a freshly compiled regexp.
+  // {pattern} must be flat and {capture_name_map} may be null.
+  static void Insert(Handle<String> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit,
+                     Handle<ByteArray> bytecode, int register_count,
+                     uint32_t compiled_backtrack_limit,
+                     Handle<FixedArray> capture_name_map);
+
+  static void ClearForTesting();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
@@ -327,6 +327,21 @@ void RegExpBytecodeGenerator::CheckBitInTable(Handle<ByteArray> table,
   }
 }
 
+bool RegExpBytecodeGenerator::SkipUntilCharacters(int cp_offset,
+                                                  int characters,
+                                                  base::uc16 c1, base::uc16 c2,
+                                                  base::uc16 mask) {
+  DCHECK(characters == 1 || characters == 2);
+  DCHECK_LE(kMinCPOffset, cp_offset);
+  DCHECK_GE(kMaxCPOffset, cp_offset);
+  Emit(BC_SKIP_UNTIL_CHARS, cp_offset);
+  Emit16(c1);
+  Emit16(c2);
+  Emit16(mask);
+  Emit16(characters);
+  return true;
+}
+
 void RegExpBytecodeGenerator::CheckNotBackReference(int start_reg,
                                                     bool read_backward,
                                                     Label* on_not_equal) {
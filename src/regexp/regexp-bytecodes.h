@@ -211,7 +211,18 @@ STATIC_ASSERT(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   /* 0x40 - 0xBF    Bit Table                                               */ \
   /* 0xC0 - 0xDF    Address of bytecode when character is matched           */ \
   /* 0xE0 - 0xFF    Address of bytecode when no match                       */ \
-  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)
+  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)                                 \
+  /* Advances to the first position at which one or two characters match    */ \
+  /* after masking, or past the end of the subject.                         */ \
+  /* Emitted by RegExpBytecodeGenerator::SkipUntilCharacters.               */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3B (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x2F    First character to match (after mask applied)           */ \
+  /* 0x30 - 0x3F    Second character to match (after mask applied)          */ \
+  /* 0x40 - 0x4F    Bitmask bitwise and combined with the characters        */ \
+  /* 0x50 - 0x5F    Number of characters to match (1 or 2)                  */ \
+  V(SKIP_UNTIL_CHARS, 59, 12)
 
 #define COUNT(...) +1
 static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
@@ -221,7 +232,7 @@ static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
 // contiguous, strictly increasing, and start at 0.
 // TODO(jgruber): Do not explicitly assign values, instead generate them
 // implicitly from the list order.
-STATIC_ASSERT(kRegExpBytecodeCount == 59);
+STATIC_ASSERT(kRegExpBytecodeCount == 60);
 
 #define DECLARE_BYTECODES(name, code, length) \
   static constexpr int BC_##name = code;
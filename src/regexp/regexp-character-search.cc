@@ -0,0 +1,179 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-character-search.h"
+
+#include <limits>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/logging.h"
+
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Whether no character of type Char is equal to `c` after masking.
+template <typename Char>
+bool CannotMatch(base::uc16 c, base::uc16 mask) {
+  return (c & ~mask) != 0 || c > std::numeric_limits<Char>::max();
+}
+
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+// Compares blocks of characters at once. ToBits returns kBitsPerLane bits
+// per lane, in the order of the characters.
+template <typename Char>
+struct Block;
+
+#if V8_HOST_HAS_SSE2
+
+template <>
+struct Block<uint8_t> {
+  using Vector = __m128i;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(uint8_t);
+  static constexpr int kBitsPerLane = 1;
+
+  static Vector Splat(base::uc16 c) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  }
+  static Vector Equal(const uint8_t* chars, Vector c, Vector mask) {
+    Vector loaded = _mm_loadu_si128(reinterpret_cast<const Vector*>(chars));
+    return _mm_cmpeq_epi8(_mm_and_si128(loaded, mask), c);
+  }
+  static Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+  static uint64_t ToBits(Vector v) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(v));
+  }
+};
+
+template <>
+struct Block<base::uc16> {
+  using Vector = __m128i;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(base::uc16);
+  static constexpr int kBitsPerLane = 1;
+
+  static Vector Splat(base::uc16 c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static Vector Equal(const base::uc16* chars, Vector c, Vector mask) {
+    Vector loaded = _mm_loadu_si128(reinterpret_cast<const Vector*>(chars));
+    return _mm_cmpeq_epi16(_mm_and_si128(loaded, mask), c);
+  }
+  static Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+  static uint64_t ToBits(Vector v) {
+    // Saturate the lanes to one byte each to get one mask bit per lane.
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_packs_epi16(v, _mm_setzero_si128())));
+  }
+};
+
+#elif V8_HOST_HAS_NEON
+
+template <>
+struct Block<uint8_t> {
+  using Vector = uint8x16_t;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(uint8_t);
+  static constexpr int kBitsPerLane = 4;
+
+  static Vector Splat(base::uc16 c) {
+    return vdupq_n_u8(static_cast<uint8_t>(c));
+  }
+  static Vector Equal(const uint8_t* chars, Vector c, Vector mask) {
+    return vceqq_u8(vandq_u8(vld1q_u8(chars), mask), c);
+  }
+  static Vector And(Vector a, Vector b) { return vandq_u8(a, b); }
+  static uint64_t ToBits(Vector v) {
+    // Shift each 16-bit lane right by 4 and narrow it, which leaves four
+    // bits per byte lane.
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+  }
+};
+
+template <>
+struct Block<base::uc16> {
+  using Vector = uint16x8_t;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(base::uc16);
+  static constexpr int kBitsPerLane = 8;
+
+  static Vector Splat(base::uc16 c) { return vdupq_n_u16(c); }
+  static Vector Equal(const base::uc16* chars, Vector c, Vector mask) {
+    return vceqq_u16(vandq_u16(vld1q_u16(chars), mask), c);
+  }
+  static Vector And(Vector a, Vector b) { return vandq_u16(a, b); }
+  static uint64_t ToBits(Vector v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(v)), 0);
+  }
+};
+
+#endif  // V8_HOST_HAS_SSE2
+
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+template <typename Char, bool kPair>
+const Char* FindMasked(const Char* begin, const Char* end, base::uc16 c1,
+                       base::uc16 c2, base::uc16 mask) {
+  DCHECK_LE(begin, end);
+  if (CannotMatch<Char>(c1, mask)) return end;
+  if (kPair && CannotMatch<Char>(c2, mask)) return end;
+  const Char* cursor = begin;
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  using B = Block<Char>;
+  const typename B::Vector v1 = B::Splat(c1);
+  const typename B::Vector v2 = B::Splat(c2);
+  const typename B::Vector vmask = B::Splat(mask);
+  // For pairs, the second load reads up to end[0].
+  for (; end - cursor >= B::kLanes; cursor += B::kLanes) {
+    typename B::Vector found = B::Equal(cursor, v1, vmask);
+    if (kPair) found = B::And(found, B::Equal(cursor + 1, v2, vmask));
+    uint64_t bits = B::ToBits(found);
+    if (bits != 0) {
+      return cursor + base::bits::CountTrailingZeros(bits) / B::kBitsPerLane;
+    }
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  for (; cursor < end; ++cursor) {
+    if ((cursor[0] & mask) != c1) continue;
+    if (kPair && (cursor[1] & mask) != c2) continue;
+    return cursor;
+  }
+  return end;
+}
+
+}  // namespace
+
+const uint8_t* FindMaskedCharacter(const uint8_t* begin, const uint8_t* end,
+                                   base::uc16 c, base::uc16 mask) {
+  return FindMasked<uint8_t, false>(begin, end, c, 0, mask);
+}
+
+const base::uc16* FindMaskedCharacter(const base::uc16* begin,
+                                      const base::uc16* end, base::uc16 c,
+                                      base::uc16 mask) {
+  return FindMasked<base::uc16, false>(begin, end, c, 0, mask);
+}
+
+const uint8_t* FindMaskedCharacterPair(const uint8_t* begin,
+                                       const uint8_t* end, base::uc16 c1,
+                                       base::uc16 c2, base::uc16 mask) {
+  return FindMasked<uint8_t, true>(begin, end, c1, c2, mask);
+}
+
+const base::uc16* FindMaskedCharacterPair(const base::uc16* begin,
+                                          const base::uc16* end,
+                                          base::uc16 c1, base::uc16 c2,
+                                          base::uc16 mask) {
+  return FindMasked<base::uc16, true>(begin, end, c1, c2, mask);
+}
+
+}  // namespace internal
+}  // namespace v8
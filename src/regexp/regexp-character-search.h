@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_CHARACTER_SEARCH_H_
+#define V8_REGEXP_REGEXP_CHARACTER_SEARCH_H_
+
+#include <cstdint>
+
+#include "src/base/strings.h"
+
+namespace v8 {
+namespace internal {
+
+// Returns the first position p in [begin, end) at which (p[0] & mask) == c,
+// or end if there is none.
+const uint8_t* FindMaskedCharacter(const uint8_t* begin, const uint8_t* end,
+                                   base::uc16 c, base::uc16 mask);
+const base::uc16* FindMaskedCharacter(const base::uc16* begin,
+                                      const base::uc16* end, base::uc16 c,
+                                      base::uc16 mask);
+
+// Returns the first position p in [begin, end) at which (p[0] & mask) == c1
+// and (p[1] & mask) == c2, or end if there is none. Reads end[0], so end must
+// be before the end of the subject.
+const uint8_t* FindMaskedCharacterPair(const uint8_t* begin,
+                                       const uint8_t* end, base::uc16 c1,
+                                       base::uc16 c2, base::uc16 mask);
+const base::uc16* FindMaskedCharacterPair(const base::uc16* begin,
+                                          const base::uc16* end,
+                                          base::uc16 c1, base::uc16 c2,
+                                          base::uc16 mask);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_CHARACTER_SEARCH_H_
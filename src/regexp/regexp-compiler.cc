@@ -2891,6 +2891,39 @@ int BoyerMooreLookahead::GetSkipTable(int min_lookahead, int max_lookahead,
   return skip;
 }
 
+// Every match has the single character of a position with a map count of one
+// at that offset.  If two such positions are adjacent, e.g. in a literal
+// prefix, the macro assembler can search for the pair a block of positions at
+// a time, which is faster than skipping ahead one table lookup at a time.  We
+// pick the pair that is least likely to occur in the sample subject string.
+bool BoyerMooreLookahead::EmitCharacterPairSearch(RegExpMacroAssembler* masm) {
+  const int kSize = RegExpMacroAssembler::kTableSize;
+  int best_offset = -1;
+  int best_frequency = 0;
+  int best_c1 = 0;
+  int best_c2 = 0;
+  for (int i = 0; i + 1 < length_; i++) {
+    if (Count(i) != 1 || Count(i + 1) != 1) continue;
+    int c1 = BitsetFirstSetBit(bitmaps_->at(i)->raw_bitset());
+    int c2 = BitsetFirstSetBit(bitmaps_->at(i + 1)->raw_bitset());
+    DCHECK_NE(c1, -1);
+    DCHECK_NE(c2, -1);
+    int frequency = (compiler_->frequency_collator()->Frequency(c1) + 1) *
+                    (compiler_->frequency_collator()->Frequency(c2) + 1);
+    if (best_offset == -1 || frequency < best_frequency) {
+      best_offset = i;
+      best_frequency = frequency;
+      best_c1 = c1;
+      best_c2 = c2;
+    }
+  }
+  if (best_offset == -1) return false;
+
+  const base::uc16 mask =
+      max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xFFFF;
+  return masm->SkipUntilCharacters(best_offset, 2, best_c1, best_c2, mask);
+}
+
 // See comment above on the implementation of GetSkipTable.
 void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   const int kSize = RegExpMacroAssembler::kTableSize;
@@ -2900,6 +2933,8 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   if (!FindWorthwhileInterval(&min_lookahead, &max_lookahead)) return;
 
+  if (EmitCharacterPairSearch(masm)) return;
+
   // Check if we only have a single non-empty position info, and that info
   // contains precisely one character.
   bool found_single_character = false;
@@ -2930,6 +2965,12 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
+    const base::uc16 mask =
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xFFFF;
+    if (masm->SkipUntilCharacters(max_lookahead, 1, single_character, 0,
+                                  mask)) {
+      return;
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -13,6 +13,7 @@
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/regexp-bytecodes.h"
+#include "src/regexp/regexp-character-search.h"
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-stack.h"  // For kMaximumStackSize.
 #include "src/regexp/regexp.h"
@@ -405,13 +406,12 @@ IrregexpInterpreter::Result RawMatch(
 // Fill dispatch table from last defined bytecode up to the next power of two
 // with BREAK (invalid operation).
 // TODO(pthier): Find a way to fill up automatically (at compile time)
-// 59 real bytecodes -> 5 fillers
+// 60 real bytecodes -> 4 fillers
 #define BYTECODE_FILLER_ITERATOR(V) \
   V(BREAK) /* 1 */                  \
   V(BREAK) /* 2 */                  \
   V(BREAK) /* 3 */                  \
-  V(BREAK) /* 4 */                  \
-  V(BREAK) /* 5 */
+  V(BREAK) /* 4 */
 
 #define COUNT(...) +1
   static constexpr int kRegExpBytecodeFillerCount =
@@ -1026,6 +1026,27 @@ IrregexpInterpreter::Result RawMatch(
       SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
       DISPATCH();
     }
+    BYTECODE(SKIP_UNTIL_CHARS) {
+      ADVANCE(SKIP_UNTIL_CHARS);
+      int32_t load_offset = LoadPacked24Signed(insn);
+      base::uc16 c1 = Load16Aligned(pc + 4);
+      base::uc16 c2 = Load16Aligned(pc + 6);
+      base::uc16 mask = Load16Aligned(pc + 8);
+      int characters = Load16Aligned(pc + 10);
+      int from = current + load_offset;
+      int to = subject.length() - (characters - 1);
+      if (from >= 0 && from < to) {
+        const Char* begin = subject.begin() + from;
+        const Char* end = subject.begin() + to;
+        const Char* found =
+            characters == 1
+                ? FindMaskedCharacter(begin, end, c1, mask)
+                : FindMaskedCharacterPair(begin, end, c1, c2, mask);
+        SET_CURRENT_POSITION(static_cast<int>(found - subject.begin()) -
+                             load_offset);
+      }
+      DISPATCH();
+    }
 #if V8_USE_COMPUTED_GOTO
 // Lint gets confused a lot if we just use !V8_USE_COMPUTED_GOTO or ifndef
 // V8_USE_COMPUTED_GOTO here.
@@ -392,6 +392,20 @@ void RegExpMacroAssemblerTracer::CheckPosition(int cp_offset,
   assembler_->CheckPosition(cp_offset, on_outside_input);
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacters(int cp_offset,
+                                                     int characters,
+                                                     base::uc16 c1,
+                                                     base::uc16 c2,
+                                                     base::uc16 mask) {
+  bool supported =
+      assembler_->SkipUntilCharacters(cp_offset, characters, c1, c2, mask);
+  PrintF(
+      " SkipUntilCharacters(cp_offset=%d, characters=%d, c1=0x%04x, "
+      "c2=0x%04x, mask=0x%04x): %s;\n",
+      cp_offset, characters, c1, c2, mask, supported ? "true" : "false");
+  return supported;
+}
+
 bool RegExpMacroAssemblerTracer::CheckSpecialCharacterClass(
     StandardCharacterSet type, Label* on_no_match) {
   bool supported = assembler_->CheckSpecialCharacterClass(type,
@@ -54,6 +54,8 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
                                      Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
+  bool SkipUntilCharacters(int cp_offset, int characters, base::uc16 c1,
+                           base::uc16 c2, base::uc16 mask) override;
   bool CheckSpecialCharacterClass(StandardCharacterSet type,
                                   Label* on_no_match) override;
   void Fail() override;
@@ -9,6 +9,7 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/pointer-authentication.h"
 #include "src/execution/simulator.h"
+#include "src/regexp/regexp-character-search.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/regexp/special-case.h"
 #include "src/strings/unicode-inl.h"
@@ -228,6 +229,39 @@ uint32_t RegExpMacroAssembler::IsCharacterInRangeArray(uint32_t current_char,
   return (current_range_start_index % 2) == 0 ? kTrue : kFalse;
 }
 
+namespace {
+
+template <typename Char>
+Address FindCharacters(Address begin, Address end, uint32_t characters,
+                       uint32_t masks) {
+  if (begin >= end) return begin;
+  const Char* from = reinterpret_cast<const Char*>(begin);
+  const Char* to = reinterpret_cast<const Char*>(end);
+  const base::uc16 c1 = characters & 0xFFFF;
+  const base::uc16 c2 = characters >> 16;
+  const base::uc16 mask = masks & 0xFFFF;
+  const Char* found = (masks >> 16) == 0
+                          ? FindMaskedCharacter(from, to, c1, mask)
+                          : FindMaskedCharacterPair(from, to, c1, c2, mask);
+  return reinterpret_cast<Address>(found);
+}
+
+}  // namespace
+
+// static
+Address RegExpMacroAssembler::FindCharactersOneByte(Address begin, Address end,
+                                                    uint32_t characters,
+                                                    uint32_t masks) {
+  return FindCharacters<uint8_t>(begin, end, characters, masks);
+}
+
+// static
+Address RegExpMacroAssembler::FindCharactersTwoByte(Address begin, Address end,
+                                                    uint32_t characters,
+                                                    uint32_t masks) {
+  return FindCharacters<base::uc16>(begin, end, characters, masks);
+}
+
 void RegExpMacroAssembler::CheckNotInSurrogatePair(int cp_offset,
                                                    Label* on_failure) {
   Label ok;
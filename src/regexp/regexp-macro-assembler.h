@@ -108,6 +108,17 @@ class RegExpMacroAssembler {
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
+  // Advances the current position to the first position at which the
+  // `characters` (1 or 2) subject characters from `cp_offset` on are equal to
+  // c1 and c2 after and-ing them with `mask`, or to a position at which they
+  // are out of bounds.  Never moves backwards.  Returns false if the search
+  // is not supported, in which case nothing was emitted.
+  // May overwrite the current character.
+  virtual bool SkipUntilCharacters(int cp_offset, int characters,
+                                   base::uc16 c1, base::uc16 c2,
+                                   base::uc16 mask) {
+    return false;
+  }
   // Check whether a standard/default character class matches the current
   // character. Returns false if the type of special character class does
   // not have custom support.
@@ -215,6 +226,18 @@ class RegExpMacroAssembler {
                                           Address raw_byte_array,
                                           Isolate* isolate);
 
+  // Returns the address of the first position in [begin, end) at which the
+  // subject matches `characters` after and-ing it with `masks`, or end if
+  // there is none.  Returns begin if begin >= end.  Both arguments hold the
+  // first character in the low and the second one in the high 16 bits; a
+  // second mask of zero searches for the first character only.
+  //
+  // Called from generated code.
+  static Address FindCharactersOneByte(Address begin, Address end,
+                                       uint32_t characters, uint32_t masks);
+  static Address FindCharactersTwoByte(Address begin, Address end,
+                                       uint32_t characters, uint32_t masks);
+
   // Controls the generation of large inlined constants in the code.
   void set_slow_safe(bool ssc) { slow_safe_compiler_ = ssc; }
   bool slow_safe() const { return slow_safe_compiler_; }
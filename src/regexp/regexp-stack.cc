@@ -30,8 +30,10 @@ char* RegExpStack::ArchiveStack(char* to) {
     // Force dynamic stacks prior to archiving. Any growth will do. A dynamic
     // stack is needed because stack archival & restoration rely on `memory_`
     // pointing at a fixed-location backing store, whereas the static stack is
-    // tied to a RegExpStack instance.
-    EnsureCapacity(thread_local_.memory_size_ + 1);
+    // tied to a RegExpStack instance. The same holds for the pool, which the
+    // next thread uses.
+    GrowByCopying(
+        std::max(thread_local_.memory_size_, kMinimumDynamicStackSize));
     DCHECK(thread_local_.owns_memory_);
   }
 
@@ -70,29 +72,95 @@ void RegExpStack::ThreadLocal::FreeAndInvalidate() {
   limit_ = kMemoryTop;
 }
 
+void RegExpStack::ResetIfEmpty() {
+  if (thread_local_.stack_pointer_ != thread_local_.memory_top_) return;
+  thread_local_.ResetToStaticStack(this);
+  if (++resets_since_decay_ < kResetsPerDecay) return;
+  ShrinkPool(recent_high_water_mark_);
+  resets_since_decay_ = 0;
+  recent_high_water_mark_ = 0;
+}
+
 Address RegExpStack::EnsureCapacity(size_t size) {
   if (size > kMaximumStackSize) return kNullAddress;
   if (thread_local_.memory_size_ < size) {
     if (size < kMinimumDynamicStackSize) size = kMinimumDynamicStackSize;
-    byte* new_memory = NewArray<byte>(size);
-    if (thread_local_.memory_size_ > 0) {
-      // Copy original memory into top of new memory.
-      MemCopy(new_memory + size - thread_local_.memory_size_,
-              thread_local_.memory_, thread_local_.memory_size_);
-      if (thread_local_.owns_memory_) DeleteArray(thread_local_.memory_);
-    }
-    ptrdiff_t delta = sp_top_delta();
-    thread_local_.memory_ = new_memory;
-    thread_local_.memory_top_ = new_memory + size;
-    thread_local_.memory_size_ = size;
-    thread_local_.stack_pointer_ = thread_local_.memory_top_ + delta;
-    thread_local_.limit_ = reinterpret_cast<Address>(new_memory) +
-                           kStackLimitSlack * kSystemPointerSize;
-    thread_local_.owns_memory_ = true;
+    recent_high_water_mark_ = std::max(recent_high_water_mark_, size);
+    if (!GrowInReservation(size)) GrowByCopying(size);
   }
   return reinterpret_cast<Address>(thread_local_.memory_top_);
 }
 
+bool RegExpStack::GrowInReservation(size_t size) {
+  // Do not tie up the address space of 32-bit hosts.
+  if (kSystemPointerSize < 8) return false;
+  if (!reservation_.IsReserved()) {
+    VirtualMemory reservation(GetPlatformPageAllocator(), kMaximumStackSize,
+                              nullptr);
+    if (!reservation.IsReserved()) return false;
+    reservation_ = std::move(reservation);
+  }
+
+  const Address top = reservation_.end();
+  if (committed_size_ < size) {
+    const size_t new_committed_size = RoundUp(size, CommitPageSize());
+    DCHECK_LE(new_committed_size, reservation_.size());
+    if (!reservation_.SetPermissions(
+            top - new_committed_size, new_committed_size - committed_size_,
+            PageAllocator::kReadWrite)) {
+      return false;
+    }
+    committed_size_ = new_committed_size;
+  }
+
+  ptrdiff_t delta = sp_top_delta();
+  byte* new_memory_top = reinterpret_cast<byte*>(top);
+  if (!InReservation()) {
+    // Copy original memory into top of the pool.
+    MemCopy(new_memory_top - thread_local_.memory_size_, thread_local_.memory_,
+            thread_local_.memory_size_);
+    if (thread_local_.owns_memory_) DeleteArray(thread_local_.memory_);
+  }
+  thread_local_.memory_ = new_memory_top - committed_size_;
+  thread_local_.memory_top_ = new_memory_top;
+  thread_local_.memory_size_ = committed_size_;
+  thread_local_.stack_pointer_ = new_memory_top + delta;
+  thread_local_.limit_ = reinterpret_cast<Address>(thread_local_.memory_) +
+                         kStackLimitSlack * kSystemPointerSize;
+  thread_local_.owns_memory_ = false;
+  return true;
+}
+
+void RegExpStack::GrowByCopying(size_t size) {
+  DCHECK_LE(thread_local_.memory_size_, size);
+  byte* new_memory = NewArray<byte>(size);
+  if (thread_local_.memory_size_ > 0) {
+    // Copy original memory into top of new memory.
+    MemCopy(new_memory + size - thread_local_.memory_size_,
+            thread_local_.memory_, thread_local_.memory_size_);
+    if (thread_local_.owns_memory_) DeleteArray(thread_local_.memory_);
+  }
+  ptrdiff_t delta = sp_top_delta();
+  thread_local_.memory_ = new_memory;
+  thread_local_.memory_top_ = new_memory + size;
+  thread_local_.memory_size_ = size;
+  thread_local_.stack_pointer_ = thread_local_.memory_top_ + delta;
+  thread_local_.limit_ = reinterpret_cast<Address>(new_memory) +
+                         kStackLimitSlack * kSystemPointerSize;
+  thread_local_.owns_memory_ = true;
+}
+
+void RegExpStack::ShrinkPool(size_t size) {
+  DCHECK(!InReservation());
+  size = RoundUp(size, CommitPageSize());
+  if (size >= committed_size_) return;
+  const Address top = reservation_.end();
+  CHECK(reservation_.SetPermissions(top - committed_size_,
+                                    committed_size_ - size,
+                                    PageAllocator::kNoAccess));
+  committed_size_ = size;
+}
+
 
 }  // namespace internal
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/common/globals.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
@@ -57,6 +58,12 @@ class RegExpStack final {
 
   size_t memory_size() const { return thread_local_.memory_size_; }
 
+  // Memory held for the stack, including pooled memory that is not in use.
+  size_t allocated_size() const {
+    return committed_size_ +
+           (thread_local_.owns_memory_ ? thread_local_.memory_size_ : 0);
+  }
+
   // If the stack pointer gets below the limit, we should react and
   // either grow the stack or report an out-of-stack exception.
   // There is only a limited number of locations below the stack limit,
@@ -87,6 +94,10 @@ class RegExpStack final {
   // Minimal size of dynamically-allocated stack area.
   static constexpr size_t kMinimumDynamicStackSize = 1 * KB;
 
+  // Pooled memory that the last kResetsPerDecay executions did not need is
+  // decommitted.
+  static constexpr int kResetsPerDecay = 64;
+
   // In addition to dynamically-allocated, variable-sized stacks, we also have
   // a statically allocated and sized area that is used whenever no dynamic
   // stack is allocated. This guarantees that a stack is always available and
@@ -118,9 +129,6 @@ class RegExpStack final {
     bool owns_memory_ = false;  // Whether memory_ is owned and must be freed.
 
     void ResetToStaticStack(RegExpStack* regexp_stack);
-    void ResetToStaticStackIfEmpty(RegExpStack* regexp_stack) {
-      if (stack_pointer_ == memory_top_) ResetToStaticStack(regexp_stack);
-    }
     void FreeAndInvalidate();
   };
   static constexpr size_t kThreadLocalSize = sizeof(ThreadLocal);
@@ -143,14 +151,39 @@ class RegExpStack final {
   }
 
   // Resets the buffer if it has grown beyond the default/minimum size and is
-  // empty.
-  void ResetIfEmpty() { thread_local_.ResetToStaticStackIfEmpty(this); }
+  // empty. Memory in the pool is kept for later executions, unless recent
+  // executions did not need it.
+  void ResetIfEmpty();
+
+  // Grows the stack within reservation_ by committing more of it, so that
+  // the current stack contents stay in place. Returns false if there is no
+  // reservation.
+  bool GrowInReservation(size_t size);
+  // Moves the stack into a new array of the given size.
+  void GrowByCopying(size_t size);
+  // Decommits pooled memory beyond the given size.
+  void ShrinkPool(size_t size);
+
+  bool InReservation() const {
+    return reservation_.IsReserved() &&
+           reinterpret_cast<Address>(thread_local_.memory_top_) ==
+               reservation_.end();
+  }
 
   // Whether the ThreadLocal storage has been invalidated.
   bool IsValid() const { return thread_local_.memory_ != nullptr; }
 
   ThreadLocal thread_local_;
 
+  // Address space for stacks of up to kMaximumStackSize that grow downwards
+  // from its end, without copying. The committed part is the pool, which is
+  // used by the current thread and outlives the executions that grew it.
+  VirtualMemory reservation_;
+  size_t committed_size_ = 0;
+  // The largest stack size that executions asked for since the last decay.
+  size_t recent_high_water_mark_ = 0;
+  int resets_since_decay_ = 0;
+
   friend class ExternalReference;
   friend class RegExpStackScope;
 };
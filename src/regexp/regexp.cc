@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -83,6 +84,10 @@ class RegExpImpl final : public AllStatic {
 
   static bool CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
+  // Installs bytecode from the RegExpBytecodeCache, if it has any for {re}.
+  static bool CompileIrregexpFromCache(Isolate* isolate, Handle<JSRegExp> re,
+                                       Handle<String> pattern,
+                                       bool is_one_byte);
   static inline bool EnsureCompiledIrregexp(Isolate* isolate,
                                             Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
@@ -540,6 +545,13 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+  const bool use_bytecode_cache =
+      FLAG_regexp_bytecode_cache && re->ShouldProduceBytecode();
+  if (use_bytecode_cache &&
+      CompileIrregexpFromCache(isolate, re, pattern, is_one_byte)) {
+    return true;
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -556,7 +568,8 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  uint32_t backtrack_limit = re->backtrack_limit();
+  const uint32_t initial_backtrack_limit = re->backtrack_limit();
+  uint32_t backtrack_limit = initial_backtrack_limit;
   const bool compilation_succeeded =
       Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
               is_one_byte, backtrack_limit);
@@ -595,6 +608,13 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  if (use_bytecode_cache) {
+    RegExpBytecodeCache::Insert(
+        pattern, flags, is_one_byte, initial_backtrack_limit,
+        Handle<ByteArray>::cast(compile_data.code), compile_data.register_count,
+        backtrack_limit, capture_name_map);
+  }
+
   if (FLAG_trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -607,6 +627,53 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   return true;
 }
 
+bool RegExpImpl::CompileIrregexpFromCache(Isolate* isolate,
+                                          Handle<JSRegExp> re,
+                                          Handle<String> pattern,
+                                          bool is_one_byte) {
+  std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+      RegExpBytecodeCache::Lookup(pattern, JSRegExp::AsRegExpFlags(re->flags()),
+                                  is_one_byte, re->backtrack_limit());
+  if (!entry) return false;
+
+  Factory* factory = isolate->factory();
+  const int length = static_cast<int>(entry->bytecode.size());
+  Handle<ByteArray> bytecode =
+      factory->NewByteArray(length, AllocationType::kOld);
+  bytecode->copy_in(0, entry->bytecode.data(), length);
+
+  Handle<FixedArray> capture_name_map;
+  if (!entry->named_captures.empty()) {
+    const int count = static_cast<int>(entry->named_captures.size());
+    capture_name_map = factory->NewFixedArray(count * 2);
+    for (int i = 0; i < count; i++) {
+      const std::vector<base::uc16>& name = entry->named_captures[i].first;
+      Handle<String> internalized = factory->InternalizeString(
+          base::Vector<const base::uc16>(name.data(), name.size()));
+      capture_name_map->set(i * 2, *internalized);
+      capture_name_map->set(i * 2 + 1,
+                            Smi::FromInt(entry->named_captures[i].second));
+    }
+  }
+
+  FixedArray data = FixedArray::cast(re->data());
+  data.set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+  data.set(JSRegExp::code_index(is_one_byte),
+           *BUILTIN_CODE(isolate, RegExpInterpreterTrampoline));
+  re->set_capture_name_map(capture_name_map);
+  if (entry->register_count > IrregexpMaxRegisterCount(data)) {
+    SetIrregexpMaxRegisterCount(data, entry->register_count);
+  }
+  data.set(JSRegExp::kIrregexpBacktrackLimit,
+           Smi::FromInt(entry->backtrack_limit));
+
+  if (FLAG_trace_regexp_tier_up) {
+    PrintF("JSRegExp object %p bytecode size: %d (cached)\n",
+           reinterpret_cast<void*>(re->ptr()), bytecode->Size());
+  }
+  return true;
+}
+
 int RegExpImpl::IrregexpMaxRegisterCount(FixedArray re) {
   return Smi::ToInt(re.get(JSRegExp::kIrregexpMaxRegisterCountIndex));
 }
@@ -1048,17 +1115,15 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       regexp_(regexp),
       subject_(subject),
       isolate_(isolate) {
-  DCHECK(IsGlobal(JSRegExp::AsRegExpFlags(regexp->flags())));
-
   switch (regexp_->type_tag()) {
     case JSRegExp::NOT_COMPILED:
       UNREACHABLE();
     case JSRegExp::ATOM: {
-      // ATOM regexps do not have a global loop, so we search for one match at
-      // a time.
+      // AtomExecRaw searches for as many matches as fit into the offsets
+      // vector.
       static const int kAtomRegistersPerMatch = 2;
       registers_per_match_ = kAtomRegistersPerMatch;
-      register_array_size_ = registers_per_match_;
+      register_array_size_ = Isolate::kJSRegexpStaticOffsetsVectorSize;
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1068,9 +1133,11 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         num_matches_ = -1;  // Signal exception.
         return;
       }
-      if (regexp->ShouldProduceBytecode()) {
-        // Global loop in interpreted regexp is not implemented.  We choose the
-        // size of the offsets vector so that it can only store one match.
+      if (regexp->ShouldProduceBytecode() ||
+          !IsGlobal(JSRegExp::AsRegExpFlags(regexp->flags()))) {
+        // Global loop in interpreted regexp is not implemented, and native
+        // code for non-global regexps has none.  We choose the size of the
+        // offsets vector so that it can only store one match.
         register_array_size_ = registers_per_match_;
         max_matches_ = 1;
       } else {
@@ -169,6 +169,9 @@ class RegExp final : public AllStatic {
 // Uses a special global mode of irregexp-generated code to perform a global
 // search and return multiple results at once. As such, this is essentially an
 // iterator over multiple results (retrieved batch-wise in advance).
+// Iterates over all matches of a regexp in a subject, fetching them from the
+// compiled code in batches where possible. The regexp need not be global;
+// @@split consumes all matches of non-global regexps, too.
 class RegExpGlobalCache final {
  public:
   RegExpGlobalCache(Handle<JSRegExp> regexp, Handle<String> subject,
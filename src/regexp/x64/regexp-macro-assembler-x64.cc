@@ -578,6 +578,54 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacters(int cp_offset,
+                                                  int characters,
+                                                  base::uc16 c1, base::uc16 c2,
+                                                  base::uc16 mask) {
+  DCHECK(characters == 1 || characters == 2);
+  const uint32_t packed_characters =
+      c1 | (characters == 2 ? static_cast<uint32_t>(c2) << 16 : 0);
+  const uint32_t packed_masks =
+      mask | (characters == 2 ? static_cast<uint32_t>(mask) << 16 : 0);
+  PushCallerSavedRegisters();
+
+  static const int kNumArguments = 4;
+  __ PrepareCallCFunction(kNumArguments);
+
+  // Put arguments into parameter registers. Parameters are
+  //   Address begin - Address of the first character to look at.
+  //   Address end - Address past the last position to look at.
+  //   uint32_t characters - The characters to look for.
+  //   uint32_t masks - The masks to apply.
+  // Compute both addresses before overwriting rdi and rsi, which are
+  // parameter registers on AMD64.
+  __ leaq(rax, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+  __ leaq(rbx, Operand(rsi, -(characters - 1) * char_size()));
+  __ movq(arg_reg_1, rax);
+  __ movq(arg_reg_2, rbx);
+  __ movl(arg_reg_3, Immediate(static_cast<int32_t>(packed_characters)));
+  __ movl(arg_reg_4, Immediate(static_cast<int32_t>(packed_masks)));
+
+  {
+    // We have a frame (set up in GetCode), but the assembler doesn't know.
+    FrameScope scope(&masm_, StackFrame::MANUAL);
+    ExternalReference find =
+        mode_ == LATIN1 ? ExternalReference::re_find_characters_one_byte()
+                        : ExternalReference::re_find_characters_two_byte();
+    __ CallCFunction(find, kNumArguments);
+  }
+
+  __ Move(code_object_pointer(), masm_.CodeObject());
+  PopCallerSavedRegisters();
+
+  // The new position is the address of the found characters, relative to the
+  // end of the input.
+  __ movq(rdi, rax);
+  __ subq(rdi, rsi);
+  if (cp_offset != 0) __ subq(rdi, Immediate(cp_offset * char_size()));
+  return true;
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
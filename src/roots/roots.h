@@ -300,6 +300,7 @@ class Symbol;
 #define STRONG_MUTABLE_MOVABLE_ROOT_LIST(V)                                 \
   /* Caches */                                                              \
   V(FixedArray, number_string_cache, NumberStringCache)                     \
+  V(Object, error_stack_frames_cache, ErrorStackFramesCache)                \
   /* Lists and dictionaries */                                              \
   V(RegisteredSymbolTable, public_symbol_table, PublicSymbolTable)          \
   V(RegisteredSymbolTable, api_symbol_table, ApiSymbolTable)                \
@@ -322,6 +323,8 @@ class Symbol;
     InterpreterEntryTrampolineForProfiling)                                 \
   V(Object, pending_optimize_for_test_bytecode,                             \
     PendingOptimizeForTestBytecode)                                         \
+  /* Code cache sections of functions that are deserialized lazily */      \
+  V(Object, lazy_code_cache_functions, LazyCodeCacheFunctions)              \
   V(ArrayList, basic_block_profiling_data, BasicBlockProfilingData)         \
   V(WeakArrayList, shared_wasm_memories, SharedWasmMemories)                \
   IF_WASM(V, HeapObject, active_continuation, ActiveContinuation)           \
@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "src/codegen/compiler.h"
 #include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
@@ -9,6 +14,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/logging/counters.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/allocation-site-inl.h"
@@ -424,5 +430,172 @@ RUNTIME_FUNCTION(Runtime_ArrayIndexOf) {
   return Smi::FromInt(-1);
 }
 
+namespace {
+
+// Returns whether calling {comparefn} with two Numbers a and b is known to
+// be the same as computing `a - b`, or `b - a` if {descending} is set, as
+// for the common `(a, b) => a - b`. Subtracting Numbers has no side
+// effects, so such a comparator can be replaced by a numeric comparison.
+bool IsSubtractingComparator(Isolate* isolate, Handle<Object> comparefn,
+                             bool* descending) {
+  if (!comparefn->IsJSFunction()) return false;
+  Handle<JSFunction> function = Handle<JSFunction>::cast(comparefn);
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  if (IsClassConstructor(shared->kind()) ||
+      IsResumableFunction(shared->kind())) {
+    return false;
+  }
+  // Breakpoints and precise coverage have to see the calls.
+  if (isolate->debug()->is_active()) return false;
+  if (!isolate->is_best_effort_code_coverage()) return false;
+
+  IsCompiledScope is_compiled_scope(shared->is_compiled_scope(isolate));
+  if (!is_compiled_scope.is_compiled() &&
+      !Compiler::Compile(isolate, function, Compiler::CLEAR_EXCEPTION,
+                         &is_compiled_scope)) {
+    return false;
+  }
+  if (!shared->HasBytecodeArray()) return false;
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
+  // The receiver and the two arguments.
+  if (bytecode->parameter_count() != 3) return false;
+
+  // Match `Ldar <rhs>; Sub <lhs>, [slot]; Return`.
+  interpreter::BytecodeArrayIterator it(bytecode);
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return false;
+  }
+  interpreter::Register rhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return false;
+  }
+  interpreter::Register lhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return false;
+  }
+  it.Advance();
+  if (!it.done()) return false;
+
+  const interpreter::Register a = interpreter::Register::FromParameterIndex(1);
+  const interpreter::Register b = interpreter::Register::FromParameterIndex(2);
+  if (lhs == a && rhs == b) {
+    *descending = false;
+    return true;
+  }
+  if (lhs == b && rhs == a) {
+    *descending = true;
+    return true;
+  }
+  return false;
+}
+
+// Returns a key whose order is the order of the decimal representations of
+// Smis as strings: the negative numbers first, as '-' comes before all the
+// digits, then the magnitudes digit by digit from the left, with a number
+// before the longer numbers it is a prefix of.
+uint64_t SmiLexicographicKey(int value) {
+  static constexpr int kMaxDigits = 10;
+  static_assert(Smi::kMaxValue < 10000000000LL, "Smis have 10 digits");
+  static constexpr uint64_t kPowersOfTen[] = {
+      1,      10,      100,      1000,      10000,     100000,
+      1000000, 10000000, 100000000, 1000000000, 10000000000};
+  uint64_t magnitude =
+      value < 0 ? -static_cast<int64_t>(value) : static_cast<uint64_t>(value);
+  int digits = 1;
+  while (digits < kMaxDigits && magnitude >= kPowersOfTen[digits]) digits++;
+  uint64_t padded = magnitude * kPowersOfTen[kMaxDigits - digits];
+  return (uint64_t{value >= 0} << 40) | (padded << 4) | digits;
+}
+
+int SmiFromLexicographicKey(uint64_t key) {
+  static constexpr int kMaxDigits = 10;
+  int digits = static_cast<int>(key & 0xF);
+  uint64_t padded = (key >> 4) & ((uint64_t{1} << 36) - 1);
+  int64_t magnitude = static_cast<int64_t>(padded);
+  for (int i = digits; i < kMaxDigits; i++) magnitude /= 10;
+  return static_cast<int>((key >> 40) ? magnitude : -magnitude);
+}
+
+}  // namespace
+
+// Sorts a packed Smi or double array in place without calling into
+// JavaScript, if that is not observable: Smi arrays without a comparator,
+// and arrays of Numbers other than NaN with a subtracting comparator.
+// Returns false if the array has to be sorted by the generic TimSort.
+RUNTIME_FUNCTION(Runtime_ArraySortNumbers) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<JSArray> array = args.at<JSArray>(0);
+  Handle<Object> comparefn = args.at(1);
+  const ReadOnlyRoots roots(isolate);
+
+  if (isolate->debug_execution_mode() == DebugInfo::kSideEffects) {
+    return roots.false_value();
+  }
+  const ElementsKind kind = array->GetElementsKind();
+  if (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS) {
+    return roots.false_value();
+  }
+  bool descending = false;
+  if (comparefn->IsUndefined(isolate)) {
+    if (kind != PACKED_SMI_ELEMENTS) return roots.false_value();
+  } else if (!IsSubtractingComparator(isolate, comparefn, &descending)) {
+    return roots.false_value();
+  }
+  JSObject::EnsureWritableFastElements(array);
+
+  DisallowGarbageCollection no_gc;
+  const int length = Smi::ToInt(array->length());
+  if (kind == PACKED_SMI_ELEMENTS) {
+    FixedArray elements = FixedArray::cast(array->elements());
+    DCHECK_LE(length, elements.length());
+    if (comparefn->IsUndefined(isolate)) {
+      std::vector<uint64_t> keys(length);
+      for (int i = 0; i < length; i++) {
+        keys[i] = SmiLexicographicKey(Smi::ToInt(elements.get(i)));
+      }
+      // Different Smis have different keys, so the order of equal elements
+      // does not matter.
+      std::sort(keys.begin(), keys.end());
+      for (int i = 0; i < length; i++) {
+        elements.set(i, Smi::FromInt(SmiFromLexicographicKey(keys[i])));
+      }
+    } else {
+      std::vector<int> values(length);
+      for (int i = 0; i < length; i++) {
+        values[i] = Smi::ToInt(elements.get(i));
+      }
+      if (descending) {
+        std::sort(values.begin(), values.end(), std::greater<int>());
+      } else {
+        std::sort(values.begin(), values.end());
+      }
+      for (int i = 0; i < length; i++) {
+        elements.set(i, Smi::FromInt(values[i]));
+      }
+    }
+  } else {
+    FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
+    DCHECK_LE(length, elements.length());
+    std::vector<double> values(length);
+    for (int i = 0; i < length; i++) {
+      values[i] = elements.get_scalar(i);
+      // NaN compares equal to everything, which makes the sort order
+      // implementation-defined; leave that to TimSort.
+      if (std::isnan(values[i])) return roots.false_value();
+    }
+    // -0 and +0 compare equal, so keep their order with a stable sort.
+    if (descending) {
+      std::stable_sort(values.begin(), values.end(), std::greater<double>());
+    } else {
+      std::stable_sort(values.begin(), values.end());
+    }
+    for (int i = 0; i < length; i++) elements.set(i, values[i]);
+  }
+  return roots.true_value();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -133,6 +133,7 @@ RUNTIME_FUNCTION(Runtime_HealOptimizedCodeSlot) {
 
   function->feedback_vector().EvictOptimizedCodeMarkedForDeoptimization(
       function->shared(), "Runtime_HealOptimizedCodeSlot");
+  function->shared().set_turbofan_tier_up_hint(false);
   return function->code();
 }
 
@@ -236,6 +237,10 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   Handle<Code> optimized_code = deoptimizer->compiled_code();
   const DeoptimizeKind deopt_kind = deoptimizer->deopt_kind();
 
+  // Code that deoptimizes, including lazily on a dependency change, is not
+  // worth optimizing early for consumers of the code cache.
+  function->shared().set_turbofan_tier_up_hint(false);
+
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
   isolate->set_context(deoptimizer->function()->native_context());
@@ -334,7 +339,7 @@ RUNTIME_FUNCTION(Runtime_CompileOptimizedOSR) {
   }
 
   DCHECK(!result.is_null());
-  DCHECK(result->is_turbofanned());  // TODO(v8:7700): Support Maglev.
+  DCHECK(result->is_turbofanned() || result->is_maglevved());
   DCHECK(CodeKindIsOptimizedJSFunction(result->kind()));
 
 #ifdef DEBUG
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <functional>
 
 #include "src/base/small-vector.h"
@@ -1792,6 +1793,97 @@ RUNTIME_FUNCTION(Runtime_RegExpSplit) {
   return *NewJSArrayWithElements(isolate, elems, num_elems);
 }
 
+// Fast path for @@split on long subjects: fetches matches in batches through
+// RegExpGlobalCache instead of one RegExpExecInternal call per match. The
+// result and the last match info are the same as RegExpPrototypeSplitBody's.
+RUNTIME_FUNCTION(Runtime_RegExpSplitBatched) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+
+  Handle<JSRegExp> regexp = args.at<JSRegExp>(0);
+  Handle<String> subject = args.at<String>(1);
+  const uint32_t limit = args.smi_value_at(2);
+
+  DCHECK(!IsSticky(JSRegExp::AsRegExpFlags(regexp->flags())));
+  DCHECK_LT(0, limit);
+
+  subject = String::Flatten(isolate, subject);
+  const int length = subject->length();
+  DCHECK_LT(0, length);
+
+  // Like global replaces, batched matching requires native code.
+  if (FLAG_regexp_tier_up && regexp->type_tag() == JSRegExp::IRREGEXP) {
+    regexp->MarkTierUpForNextExec();
+    if (FLAG_trace_regexp_tier_up) {
+      PrintF("Forcing tier-up of JSRegExp object %p in RegExpSplitBatched\n",
+             reinterpret_cast<void*>(regexp->ptr()));
+    }
+  }
+
+  RegExpGlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  Factory* factory = isolate->factory();
+  const int capture_count = regexp->capture_count();
+  const int registers_per_match =
+      JSRegExp::RegistersForCaptureCount(capture_count);
+
+  // The registers of the last match that RegExpPrototypeSplitBody would have
+  // seen, which becomes the last match info.
+  base::SmallVector<int32_t, Isolate::kJSRegexpStaticOffsetsVectorSize>
+      last_match(registers_per_match);
+  bool has_last_match = false;
+
+  Handle<FixedArray> elems = factory->NewFixedArrayWithHoles(1);
+  uint32_t num_elems = 0;
+  int last_matched_until = 0;
+
+  while (num_elems < limit) {
+    int32_t* current_match = global_cache.FetchNext();
+    if (current_match == nullptr) break;
+    const int match_start = current_match[0];
+    const int match_end = current_match[1];
+
+    // A match at the end of the subject counts as a failure.
+    if (match_start >= length) break;
+
+    std::copy_n(current_match, registers_per_match, last_match.begin());
+    has_last_match = true;
+
+    // Skip empty matches directly after the previous match.
+    if (match_end == last_matched_until) continue;
+
+    HandleScope inner_scope(isolate);
+    Handle<String> substr =
+        factory->NewSubString(subject, last_matched_until, match_start);
+    elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, substr);
+    for (int i = 2; i < registers_per_match && num_elems < limit; i += 2) {
+      const int from = current_match[i];
+      const int to = current_match[i + 1];
+      Handle<Object> capture = factory->undefined_value();
+      if (to != -1) capture = factory->NewSubString(subject, from, to);
+      elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, capture);
+    }
+    elems = inner_scope.CloseAndEscape(elems);
+    last_matched_until = match_end;
+  }
+
+  if (global_cache.HasException()) return ReadOnlyRoots(isolate).exception();
+
+  if (num_elems < limit) {
+    Handle<String> substr =
+        factory->NewSubString(subject, last_matched_until, length);
+    elems = FixedArray::SetAndGrow(isolate, elems, num_elems++, substr);
+  }
+
+  if (has_last_match) {
+    RegExp::SetLastMatchInfo(isolate, isolate->regexp_last_match_info(),
+                             subject, capture_count, last_match.data());
+  }
+
+  return *NewJSArrayWithElements(isolate, elems, num_elems);
+}
+
 // Slow path for:
 // ES#sec-regexp.prototype-@@replace
 // RegExp.prototype [ @@replace ] ( string, replaceValue )
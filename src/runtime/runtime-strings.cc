@@ -157,6 +157,17 @@ RUNTIME_FUNCTION(Runtime_StringSubstring) {
   return *isolate->factory()->NewSubString(string, start, end);
 }
 
+RUNTIME_FUNCTION(Runtime_StringIndexOfUnchecked) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  Handle<String> receiver = args.at<String>(0);
+  Handle<String> search = args.at<String>(1);
+  int index = args.smi_value_at(2);
+  DCHECK_LE(0, index);
+  DCHECK_LE(index + search->length(), receiver->length());
+  return Smi::FromInt(String::IndexOf(isolate, receiver, search, index));
+}
+
 RUNTIME_FUNCTION(Runtime_StringAdd) {
   HandleScope scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -181,10 +192,11 @@ RUNTIME_FUNCTION(Runtime_StringCharCodeAt) {
   Handle<String> subject = args.at<String>(0);
   uint32_t i = NumberToUint32(args[1]);
 
-  // Flatten the string.  If someone wants to get a char at an index
-  // in a cons string, it is likely that more indices will be
-  // accessed.
-  subject = String::Flatten(isolate, subject);
+  // Flatten the string if it is accessed repeatedly. If someone gets chars
+  // at many indices of a cons string, flat accesses pay off quickly.
+  if (String::ShouldFlattenOnAccess(isolate, subject)) {
+    subject = String::Flatten(isolate, subject);
+  }
 
   if (i >= static_cast<uint32_t>(subject->length())) {
     return ReadOnlyRoots(isolate).nan_value();
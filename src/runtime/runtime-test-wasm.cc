@@ -400,6 +400,24 @@ RUNTIME_FUNCTION(Runtime_WasmNumCodeSpaces) {
   return *isolate->factory()->NewNumberFromSize(num_spaces);
 }
 
+// Returns the size of the code of a module which was not freed yet.
+RUNTIME_FUNCTION(Runtime_WasmLiveCodeSize) {
+  DCHECK_EQ(1, args.length());
+  HandleScope scope(isolate);
+  Handle<JSObject> argument = args.at<JSObject>(0);
+  Handle<WasmModuleObject> module;
+  if (argument->IsWasmInstanceObject()) {
+    module = handle(Handle<WasmInstanceObject>::cast(argument)->module_object(),
+                    isolate);
+  } else if (argument->IsWasmModuleObject()) {
+    module = Handle<WasmModuleObject>::cast(argument);
+  }
+  wasm::NativeModule* native_module = module->native_module();
+  size_t live_code_size =
+      native_module->generated_code_size() - native_module->freed_code_size();
+  return *isolate->factory()->NewNumberFromSize(live_code_size);
+}
+
 RUNTIME_FUNCTION(Runtime_WasmTraceMemory) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
@@ -880,6 +880,14 @@ RUNTIME_FUNCTION(Runtime_NotifyContextDisposed) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_NotifyCriticalMemoryPressure) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(0, args.length());
+  isolate->heap()->MemoryPressureNotification(MemoryPressureLevel::kCritical,
+                                              true);
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_SetAllocationTimeout) {
   SealHandleScope shs(isolate);
   DCHECK(args.length() == 2 || args.length() == 3);
@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -81,6 +86,88 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Maps the elements of a typed array to unsigned keys that are ordered like
+// the elements themselves, i.e. like CompareNum for floating point elements.
+template <typename T>
+struct RadixSortKey {
+  using Key = typename std::make_unsigned<T>::type;
+  static Key Get(T value) {
+    Key key = static_cast<Key>(value);
+    if (std::is_signed<T>::value) {
+      key ^= Key{1} << (kBitsPerByte * sizeof(T) - 1);
+    }
+    return key;
+  }
+};
+
+template <typename Float, typename Bits>
+struct FloatRadixSortKey {
+  using Key = Bits;
+  static Key Get(Float value) {
+    // All NaNs sort last.
+    if (std::isnan(value)) return std::numeric_limits<Key>::max();
+    // Flip all bits of negative numbers, including -0, so that they sort
+    // before the positive ones in reverse order of their magnitude.
+    constexpr Key kSignBit = Key{1} << (kBitsPerByte * sizeof(Float) - 1);
+    Key bits = base::bit_cast<Key>(value);
+    return (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  }
+};
+
+template <>
+struct RadixSortKey<float> : FloatRadixSortKey<float, uint32_t> {};
+template <>
+struct RadixSortKey<double> : FloatRadixSortKey<double, uint64_t> {};
+
+// Below this length, std::sort is faster than the passes of a radix sort.
+constexpr size_t kMinLengthForRadixSort = 1024;
+
+// Sorts {data} with a least significant digit first radix sort on the bytes
+// of the keys, skipping the bytes that are the same for all elements.
+// Returns false without touching {data} if it cannot be sorted this way.
+template <typename T>
+bool TryRadixSort(T* data, size_t length) {
+  using Traits = RadixSortKey<T>;
+  using Key = typename Traits::Key;
+  constexpr int kDigits = sizeof(Key);
+  constexpr int kBuckets = 1 << kBitsPerByte;
+
+  if (length < kMinLengthForRadixSort) return false;
+  if (!IsAligned(reinterpret_cast<Address>(data), alignof(T))) return false;
+  std::unique_ptr<T[]> scratch(new (std::nothrow) T[length]);
+  if (!scratch) return false;
+
+  // Count the digits of all passes at once.
+  std::vector<size_t> counts(kDigits * kBuckets);
+  for (size_t i = 0; i < length; i++) {
+    Key key = Traits::Get(data[i]);
+    for (int digit = 0; digit < kDigits; digit++) {
+      counts[digit * kBuckets + ((key >> (digit * kBitsPerByte)) & 0xFF)]++;
+    }
+  }
+
+  T* from = data;
+  T* to = scratch.get();
+  for (int digit = 0; digit < kDigits; digit++) {
+    const int shift = digit * kBitsPerByte;
+    size_t* offsets = &counts[digit * kBuckets];
+    if (offsets[(Traits::Get(from[0]) >> shift) & 0xFF] == length) continue;
+    size_t offset = 0;
+    for (int bucket = 0; bucket < kBuckets; bucket++) {
+      size_t count = offsets[bucket];
+      offsets[bucket] = offset;
+      offset += count;
+    }
+    for (size_t i = 0; i < length; i++) {
+      T value = from[i];
+      to[offsets[(Traits::Get(value) >> shift) & 0xFF]++] = value;
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+  return true;
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -135,6 +222,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
+    if (TryRadixSort(data, length)) break;                                 \
     if (kExternal##Type##Array == kExternalFloat64Array ||                 \
         kExternal##Type##Array == kExternalFloat32Array) {                 \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
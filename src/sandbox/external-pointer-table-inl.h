@@ -57,6 +57,8 @@ void ExternalPointerTable::TearDown() {
   capacity_ = 0;
   freelist_head_ = 0;
   mutex_ = nullptr;
+  start_of_evacuation_area_ = kNotCompactingMarker;
+  num_free_entries_after_sweep_ = 0;
 }
 
 Address ExternalPointerTable::Get(uint32_t index,
@@ -123,7 +125,36 @@ uint32_t ExternalPointerTable::Allocate() {
   return index;
 }
 
-void ExternalPointerTable::Mark(uint32_t index) {
+uint32_t ExternalPointerTable::AllocateEvacuationEntry(
+    uint32_t start_of_evacuation_area) {
+  base::Atomic32* freelist_head_ptr =
+      reinterpret_cast<base::Atomic32*>(&freelist_head_);
+
+  uint32_t index;
+  bool success = false;
+  while (!success) {
+    // See Allocate() for why this load has to be an acquire load. The table is
+    // never grown here: grown entries would end up in the evacuation area.
+    // Sweeping leaves the freelist sorted by index, so once the head is inside
+    // the evacuation area, so are all other free entries.
+    uint32_t freelist_head = base::Acquire_Load(freelist_head_ptr);
+    if (!freelist_head || freelist_head >= start_of_evacuation_area) return 0;
+
+    DCHECK_LT(freelist_head, capacity_);
+    index = freelist_head;
+
+    // The next free element is stored in the lower 32 bits of the entry.
+    uint32_t new_freelist_head = static_cast<uint32_t>(load_atomic(index));
+
+    uint32_t old_val = base::Relaxed_CompareAndSwap(
+        freelist_head_ptr, freelist_head, new_freelist_head);
+    success = old_val == freelist_head;
+  }
+
+  return index;
+}
+
+void ExternalPointerTable::Mark(uint32_t index, Address handle_location) {
   DCHECK_LT(index, capacity_);
   STATIC_ASSERT(sizeof(base::Atomic64) == sizeof(Address));
 
@@ -138,7 +169,20 @@ void ExternalPointerTable::Mark(uint32_t index) {
   base::Atomic64* ptr = reinterpret_cast<base::Atomic64*>(entry_address(index));
   base::Atomic64 val = base::Relaxed_CompareAndSwap(ptr, old_val, new_val);
   DCHECK((val == old_val) || is_marked(val));
-  USE(val);
+
+  // Only the thread that marked the entry evacuates it, so that no entry is
+  // evacuated twice. Entries that were (re)written during marking are already
+  // marked and stay in place.
+  uint32_t start_of_evacuation_area = start_of_evacuation_area_;
+  if (index < start_of_evacuation_area || handle_location == kNullAddress ||
+      val != old_val || is_marked(old_val)) {
+    return;
+  }
+  uint32_t new_index = AllocateEvacuationEntry(start_of_evacuation_area);
+  // If there is no free entry left below the evacuation area, the entry stays
+  // where it is and the table can only be shrunk partially.
+  if (!new_index) return;
+  store_atomic(new_index, make_evacuation_entry(index, handle_location));
 }
 
 }  // namespace internal
@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/logging/counters.h"
 #include "src/sandbox/external-pointer-table-inl.h"
 
@@ -22,20 +23,96 @@ uint32_t ExternalPointerTable::AllocateEntry(ExternalPointerTable* table) {
   return table->Allocate();
 }
 
+void ExternalPointerTable::StartCompactingIfNeeded() {
+  DCHECK(!is_compacting());
+  if (!FLAG_compact_external_pointer_table) return;
+
+  // Background threads may grow the table concurrently.
+  base::MutexGuard guard(mutex_);
+
+  // Evacuate at most half of the free entries worth of blocks, so that there
+  // are enough free entries left below the evacuation area to hold the live
+  // entries from inside of it. The free entry count is only an estimate as
+  // entries may have been allocated since the last sweep; if the free entries
+  // run out during marking, the table is only shrunk partially.
+  uint32_t num_free_entries =
+      std::min(num_free_entries_after_sweep_, capacity_);
+  double free_ratio = static_cast<double>(num_free_entries) / capacity_;
+  uint32_t num_blocks_to_evacuate = (num_free_entries / 2) / kEntriesPerBlock;
+  if (free_ratio < kMinFreeRatioForCompaction || num_blocks_to_evacuate == 0) {
+    return;
+  }
+
+  // The capacity is always a multiple of the block size, so the evacuation
+  // area starts at a block boundary.
+  DCHECK_EQ(0, capacity_ % kEntriesPerBlock);
+  start_of_evacuation_area_ =
+      capacity_ - num_blocks_to_evacuate * kEntriesPerBlock;
+}
+
+uint32_t ExternalPointerTable::FinishCompaction(Isolate* isolate) {
+  DCHECK(is_compacting());
+  const uint32_t start_of_evacuation_area = start_of_evacuation_area_;
+  const Address cage_base = isolate->cage_base();
+
+  // Evacuation entries can only be located below the evacuation area.
+  for (uint32_t i = 1; i < start_of_evacuation_area; i++) {
+    Address entry = load(i);
+    if (!is_evacuation_entry(entry)) continue;
+
+    uint32_t old_index = static_cast<uint32_t>(
+        (entry & ~kEvacuationEntryTagMask) >> kEvacuationEntryIndexShift);
+    Address handle_location = cage_base + static_cast<uint32_t>(entry);
+    DCHECK_GE(old_index, start_of_evacuation_area);
+    DCHECK_LT(old_index, capacity_);
+
+    // If the handle no longer references the evacuated entry, the evacuation
+    // entry is left unmarked and is freed by the sweep.
+    ExternalPointer_t expected_handle = old_index
+                                        << kExternalPointerIndexShift;
+    if (base::Memory<ExternalPointer_t>(handle_location) != expected_handle) {
+      continue;
+    }
+
+    // The copied entry keeps its marking bit, the old one is left unmarked.
+    Address old_entry = load(old_index);
+    DCHECK(is_marked(old_entry));
+    store(i, old_entry);
+    store(old_index, make_freelist_entry(0));
+    base::Memory<ExternalPointer_t>(handle_location) =
+        i << kExternalPointerIndexShift;
+  }
+
+  // Blocks at the end of the table that only contain dead entries can be
+  // released. Entries that were not evacuated, e.g. because they were written
+  // during marking, keep their block alive.
+  uint32_t new_capacity = start_of_evacuation_area;
+  for (uint32_t i = capacity_ - 1; i >= start_of_evacuation_area; i--) {
+    if (is_marked(load(i))) {
+      new_capacity = RoundUp(i + 1, static_cast<uint32_t>(kEntriesPerBlock));
+      break;
+    }
+  }
+
+  start_of_evacuation_area_ = kNotCompactingMarker;
+  return new_capacity;
+}
+
 uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
   // Sweep top to bottom and rebuild the freelist from newly dead and
   // previously freed entries. This way, the freelist ends up sorted by index,
   // which helps defragment the table. This method must run either on the
   // mutator thread or while the mutator is stopped. Also clear marking bits on
   // live entries.
-  // TODO(v8:10391, saelo) could also shrink the table using DecommitPages() if
-  // elements at the end are free. This might require some form of compaction.
+  uint32_t new_capacity = capacity_;
+  if (is_compacting()) new_capacity = FinishCompaction(isolate);
+
   uint32_t freelist_size = 0;
   uint32_t current_freelist_head = 0;
 
   // Skip the special null entry.
-  DCHECK_GE(capacity_, 1);
-  for (uint32_t i = capacity_ - 1; i > 0; i--) {
+  DCHECK_GE(new_capacity, 1);
+  for (uint32_t i = new_capacity - 1; i > 0; i--) {
     // No other threads are active during sweep, so there is no need to use
     // atomic operations here.
     Address entry = load(i);
@@ -48,7 +125,17 @@ uint32_t ExternalPointerTable::Sweep(Isolate* isolate) {
     }
   }
 
+  if (new_capacity < capacity_) {
+    VirtualAddressSpace* root_space = GetPlatformVirtualAddressSpace();
+    DCHECK(IsAligned(kBlockSize, root_space->page_size()));
+    CHECK(root_space->DecommitPages(
+        entry_address(new_capacity),
+        (capacity_ - new_capacity) * sizeof(Address)));
+    capacity_ = new_capacity;
+  }
+
   freelist_head_ = current_freelist_head;
+  num_free_entries_after_sweep_ = freelist_size;
 
   uint32_t num_active_entries = capacity_ - freelist_size;
   isolate->counters()->sandboxed_external_pointers_count()->AddSample(
@@ -5,6 +5,8 @@
 #ifndef V8_SANDBOX_EXTERNAL_POINTER_TABLE_H_
 #define V8_SANDBOX_EXTERNAL_POINTER_TABLE_H_
 
+#include <limits>
+
 #include "include/v8config.h"
 #include "src/base/atomicops.h"
 #include "src/base/memory.h"
@@ -57,12 +59,26 @@ class Isolate;
  * to store the index of the next free entry. When the freelist is empty and a
  * new entry is allocated, the table grows in place and the freelist is
  * re-populated from the newly added entries.
+ *
+ * As the table only grows in place, it is compacted during major GCs when it
+ * is sufficiently sparse:
+ *  - When marking starts, StartCompactingIfNeeded() determines the evacuation
+ *    area, a number of blocks at the end of the table.
+ *  - When the marking visitor marks a live entry inside the evacuation area
+ *    for the first time, Mark() allocates a free entry below the evacuation
+ *    area and turns it into an evacuation entry, which records the location
+ *    of the handle referencing the old entry. This relies on every entry
+ *    being referenced from only a single handle. Handles in young objects are
+ *    never recorded, as scavenges may move them before the table is swept.
+ *  - Sweep() then copies the evacuated entries to their new location, updates
+ *    the handles, and decommits the blocks of the evacuation area that no
+ *    longer contain live entries.
  */
 class V8_EXPORT_PRIVATE ExternalPointerTable {
  public:
   // Size of an ExternalPointerTable, for layout computation in IsolateData.
   // Asserted to be equal to the actual size in external-pointer-table.cc.
-  static int constexpr kSize = 3 * kSystemPointerSize;
+  static int constexpr kSize = 4 * kSystemPointerSize;
 
   ExternalPointerTable() = default;
 
@@ -94,12 +110,22 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // Runtime function called from CSA. Internally just calls Allocate().
   static uint32_t AllocateEntry(ExternalPointerTable* table);
 
-  // Marks the specified entry as alive.
+  // Marks the specified entry as alive. If the table is being compacted and
+  // the entry has to be evacuated, {handle_location} is recorded so that the
+  // handle can be updated when sweeping. Pass kNullAddress if the handle may
+  // move before the table is swept.
   //
   // This method is atomic and can be called from background threads.
-  inline void Mark(uint32_t index);
+  inline void Mark(uint32_t index, Address handle_location);
 
-  // Frees unmarked entries.
+  // Determines whether the table should be compacted during the current GC
+  // and, if so, sets up the evacuation area.
+  //
+  // This method must be called on the mutator thread before marking starts.
+  void StartCompactingIfNeeded();
+
+  // Frees unmarked entries and, if the table is being compacted, finishes the
+  // evacuation and shrinks the table.
   //
   // This method must be called on the mutator thread or while that thread is
   // stopped.
@@ -107,6 +133,9 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // Returns the number of live entries after sweeping.
   uint32_t Sweep(Isolate* isolate);
 
+  // The current number of usable entries, including free ones.
+  uint32_t capacity() const { return capacity_; }
+
  private:
   // Required for Isolate::CheckIsolateLayout().
   friend class Isolate;
@@ -118,6 +147,22 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
 
   static const Address kExternalPointerMarkBit = 1ULL << 63;
 
+  // Evacuation entries are identified by this value in their top byte. It has
+  // neither the marking bit nor all bits of kExternalPointerFreeEntryTag set.
+  // The remaining bits hold the index of the evacuated entry and the offset
+  // of its handle within the pointer compression cage.
+  static const Address kEvacuationEntryTag = 1ULL << 56;
+  static const Address kEvacuationEntryTagMask = 0xffULL << 56;
+  static const uint32_t kEvacuationEntryIndexShift = 32;
+
+  // The table is only compacted if at least this fraction of its entries
+  // were free after the previous sweep.
+  static constexpr double kMinFreeRatioForCompaction = 0.10;
+
+  // Value of start_of_evacuation_area_ when the table is not being compacted.
+  static const uint32_t kNotCompactingMarker =
+      std::numeric_limits<uint32_t>::max();
+
   // Returns true if this external pointer table has been initialized.
   bool is_initialized() { return buffer_ != kNullAddress; }
 
@@ -127,6 +172,20 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // TODO(saelo) this can fail, deal with that appropriately.
   uint32_t Grow();
 
+  // Allocates an entry below {start_of_evacuation_area} to which a live entry
+  // can be evacuated. Returns zero if no such entry is available.
+  //
+  // This method is atomic and can be called from background threads.
+  inline uint32_t AllocateEvacuationEntry(uint32_t start_of_evacuation_area);
+
+  // Copies the evacuated entries to their new location, updates their handles
+  // and returns the capacity the table can be shrunk to.
+  uint32_t FinishCompaction(Isolate* isolate);
+
+  bool is_compacting() const {
+    return start_of_evacuation_area_ != kNotCompactingMarker;
+  }
+
   // Computes the address of the specified entry.
   inline Address entry_address(uint32_t index) const {
     return buffer_ + index * sizeof(Address);
@@ -179,6 +238,22 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
     return entry | kExternalPointerFreeEntryTag;
   }
 
+  static bool is_evacuation_entry(Address entry) {
+    return (entry & kEvacuationEntryTagMask) == kEvacuationEntryTag;
+  }
+
+  static Address make_evacuation_entry(uint32_t old_index,
+                                       Address handle_location) {
+    STATIC_ASSERT(kMaxSandboxedExternalPointers <=
+                  1ULL << (56 - kEvacuationEntryIndexShift));
+    Address entry = static_cast<Address>(old_index)
+                    << kEvacuationEntryIndexShift;
+    // Handles are located inside the pointer compression cage, so their
+    // offset within it is sufficient to locate them.
+    return entry | static_cast<uint32_t>(handle_location) |
+           kEvacuationEntryTag;
+  }
+
   // The buffer backing this table. This is const after initialization. Should
   // only be accessed using the load_x() and store_x() methods, which take care
   // of atomicicy if necessary.
@@ -195,6 +270,14 @@ class V8_EXPORT_PRIVATE ExternalPointerTable {
   // IsolateData), it cannot directly contain a Mutex and so instead contains a
   // pointer to one.
   base::Mutex* mutex_ = nullptr;
+
+  // The index of the first entry of the evacuation area, or
+  // kNotCompactingMarker. Set before marking starts and reset when sweeping.
+  uint32_t start_of_evacuation_area_ = kNotCompactingMarker;
+
+  // The number of free entries after the last sweep, used to decide whether
+  // compacting the table is worthwhile.
+  uint32_t num_free_entries_after_sweep_ = 0;
 };
 
 }  // namespace internal
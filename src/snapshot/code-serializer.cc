@@ -4,11 +4,15 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/platform.h"
+#include "src/codegen/background-merge-task.h"
+#include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
 #include "src/debug/debug.h"
@@ -20,6 +24,8 @@
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/hash-table-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
@@ -47,6 +53,119 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
 
+namespace {
+
+// A function whose compiled data goes into the lazy functions section of the
+// code cache, while the function itself is serialized as uncompiled.
+struct LazyFunction {
+  Handle<SharedFunctionInfo> shared;
+  // The bytecode and the feedback metadata.
+  Handle<FixedArray> compiled_data;
+  // The function data, which may also be baseline code or interpreter data.
+  Handle<Object> function_data;
+  // Replaces the function data while the function is serialized.
+  Handle<UncompiledData> uncompiled_data;
+};
+
+// Whether the compiled data of |shared| can be deserialized independently of
+// the rest of the script. Functions that create closures can't, since their
+// bytecode refers to the SharedFunctionInfos of the closures.
+bool CanDeserializeLazily(Isolate* isolate, SharedFunctionInfo shared) {
+  DisallowGarbageCollection no_gc;
+  if (shared.is_toplevel() || !shared.HasBytecodeArray() ||
+      shared.HasDebugInfo()) {
+    return false;
+  }
+  if (!shared.HasFeedbackMetadata()) return false;
+  FixedArray constant_pool = shared.GetBytecodeArray(isolate).constant_pool();
+  for (int i = 0; i < constant_pool.length(); i++) {
+    if (constant_pool.get(i).IsSharedFunctionInfo()) return false;
+  }
+  return true;
+}
+
+// Compiles the functions of |script| which were never called and have no
+// preparse data for inner functions, so that their bytecode goes into the
+// lazy functions section. Calling them after deserialization then skips
+// scanning and parsing. Functions whose bytecode still can't be deserialized
+// lazily are discarded again.
+void PrecompileLeafFunctions(Isolate* isolate, Handle<Script> script) {
+  std::vector<Handle<SharedFunctionInfo>> candidates;
+  {
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (SharedFunctionInfo raw_shared = iter.Next(); !raw_shared.is_null();
+         raw_shared = iter.Next()) {
+      if (raw_shared.HasUncompiledDataWithoutPreparseData()) {
+        candidates.push_back(handle(raw_shared, isolate));
+      }
+    }
+  }
+  // Compiling adds the inner functions to the script, so it can't be done
+  // while iterating.
+  for (Handle<SharedFunctionInfo> shared : candidates) {
+    IsCompiledScope is_compiled_scope;
+    if (!Compiler::Compile(isolate, shared, Compiler::CLEAR_EXCEPTION,
+                           &is_compiled_scope)) {
+      continue;
+    }
+    if (!CanDeserializeLazily(isolate, *shared)) {
+      SharedFunctionInfo::DiscardCompiled(isolate, shared);
+    }
+  }
+}
+
+std::vector<LazyFunction> CollectLazyFunctions(Isolate* isolate,
+                                               Handle<Script> script) {
+  std::vector<LazyFunction> lazy_functions;
+  SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+  for (SharedFunctionInfo raw_shared = iter.Next(); !raw_shared.is_null();
+       raw_shared = iter.Next()) {
+    if (!CanDeserializeLazily(isolate, raw_shared)) continue;
+    Handle<SharedFunctionInfo> shared(raw_shared, isolate);
+    Handle<FixedArray> compiled_data = isolate->factory()->NewFixedArray(2);
+    compiled_data->set(0, shared->GetBytecodeArray(isolate));
+    compiled_data->set(1, shared->feedback_metadata());
+    Handle<UncompiledData> uncompiled_data =
+        isolate->factory()->NewUncompiledDataWithoutPreparseData(
+            handle(shared->inferred_name(), isolate), shared->StartPosition(),
+            shared->EndPosition());
+    lazy_functions.push_back(
+        {shared, compiled_data,
+         handle(shared->function_data(kAcquireLoad), isolate),
+         uncompiled_data});
+  }
+  return lazy_functions;
+}
+
+// Makes the functions look as if their bytecode was flushed, i.e. uncompiled
+// but with their scope info, while the script is serialized.
+void DiscardCompiledData(Isolate* isolate,
+                         const std::vector<LazyFunction>& lazy_functions) {
+  DisallowGarbageCollection no_gc;
+  for (const LazyFunction& function : lazy_functions) {
+    SharedFunctionInfo shared = *function.shared;
+    ScopeInfo scope_info = shared.scope_info(kAcquireLoad);
+    HeapObject outer_scope_info =
+        scope_info.HasOuterScopeInfo()
+            ? HeapObject::cast(scope_info.OuterScopeInfo())
+            : HeapObject::cast(ReadOnlyRoots(isolate).the_hole_value());
+    shared.set_function_data(*function.uncompiled_data, kReleaseStore);
+    shared.set_raw_outer_scope_info_or_feedback_metadata(outer_scope_info);
+  }
+}
+
+void RestoreCompiledData(const std::vector<LazyFunction>& lazy_functions) {
+  DisallowGarbageCollection no_gc;
+  for (const LazyFunction& function : lazy_functions) {
+    SharedFunctionInfo shared = *function.shared;
+    shared.set_function_data(*function.function_data, kReleaseStore);
+    shared.set_raw_outer_scope_info_or_feedback_metadata(
+        FeedbackMetadata::cast(function.compiled_data->get(1)));
+  }
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -74,11 +193,23 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   HandleScope scope(isolate);
+  std::vector<LazyFunction> lazy_functions;
+  if (FLAG_lazy_code_cache_deserialization) {
+    if (FLAG_code_cache_precompile_leaf_functions) {
+      PrecompileLeafFunctions(isolate, script);
+    }
+    lazy_functions = CollectLazyFunctions(isolate, script);
+  }
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
   DisallowGarbageCollection no_gc;
+  for (const LazyFunction& function : lazy_functions) {
+    cs.SerializeLazyFunction(function.shared, function.compiled_data);
+  }
   cs.reference_map()->AddAttachedReference(*source);
+  DiscardCompiledData(isolate, lazy_functions);
   AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
+  RestoreCompiledData(lazy_functions);
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -109,6 +240,40 @@ AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
   return data.GetScriptData();
 }
 
+void CodeSerializer::SerializeLazyFunction(Handle<SharedFunctionInfo> shared,
+                                           Handle<FixedArray> compiled_data) {
+  DisallowGarbageCollection no_gc;
+  CodeSerializer serializer(isolate(), source_hash_);
+  // The scope infos are serialized with the function in the main payload.
+  // Everything else that the compiled data refers to is either unique to the
+  // function, or is internalized on deserialization.
+  ScopeInfo scope_info = shared->scope_info(kAcquireLoad);
+  while (true) {
+    serializer.reference_map()->AddAttachedReference(scope_info);
+    if (!scope_info.HasOuterScopeInfo()) break;
+    scope_info = scope_info.OuterScopeInfo();
+  }
+  serializer.VisitRootPointer(Root::kHandleScope, nullptr,
+                              FullObjectSlot(compiled_data.location()));
+  serializer.SerializeDeferredObjects();
+  serializer.Pad();
+
+  const std::vector<byte>* payload = serializer.Payload();
+  size_t offset = lazy_functions_.size();
+  lazy_functions_.resize(offset + SerializedCodeData::kLazyFunctionHeaderSize +
+                         payload->size());
+  Address record = reinterpret_cast<Address>(lazy_functions_.data() + offset);
+  base::WriteLittleEndianValue<uint32_t>(
+      record + SerializedCodeData::kLazyFunctionLiteralIdOffset,
+      shared->function_literal_id());
+  base::WriteLittleEndianValue<uint32_t>(
+      record + SerializedCodeData::kLazyFunctionLengthOffset,
+      static_cast<uint32_t>(payload->size()));
+  std::copy(payload->begin(), payload->end(),
+            lazy_functions_.begin() + offset +
+                SerializedCodeData::kLazyFunctionHeaderSize);
+}
+
 bool CodeSerializer::SerializeReadOnlyObject(
     HeapObject obj, const DisallowGarbageCollection& no_gc) {
   if (!ReadOnlyHeap::Contains(obj)) return false;
@@ -414,6 +579,54 @@ void FinalizeDeserialization(Isolate* isolate,
   }
 }
 
+// Keeps the records of the lazy functions section of |scd| for the functions
+// of the script of |result| until they are first compiled, see
+// CodeSerializer::DeserializeLazyFunction. The records are copied to the
+// heap, since the embedder may release the code cache after compilation.
+void RegisterLazyFunctions(Isolate* isolate, const SerializedCodeData& scd,
+                           Handle<SharedFunctionInfo> result) {
+  base::Vector<const byte> lazy_functions = scd.LazyFunctions();
+  if (lazy_functions.empty()) return;
+
+  Handle<WeakFixedArray> infos(
+      Script::cast(result->script()).shared_function_infos(), isolate);
+  Handle<Object> maybe_table(isolate->heap()->lazy_code_cache_functions(),
+                             isolate);
+  Handle<EphemeronHashTable> table =
+      maybe_table->IsUndefined(isolate)
+          ? EphemeronHashTable::New(isolate, 1)
+          : Handle<EphemeronHashTable>::cast(maybe_table);
+  size_t offset = 0;
+  while (offset + SerializedCodeData::kLazyFunctionHeaderSize <=
+         lazy_functions.size()) {
+    Address record = reinterpret_cast<Address>(lazy_functions.begin() + offset);
+    uint32_t literal_id = base::ReadLittleEndianValue<uint32_t>(
+        record + SerializedCodeData::kLazyFunctionLiteralIdOffset);
+    uint32_t length = base::ReadLittleEndianValue<uint32_t>(
+        record + SerializedCodeData::kLazyFunctionLengthOffset);
+    offset += SerializedCodeData::kLazyFunctionHeaderSize;
+    if (length > lazy_functions.size() - offset) break;
+    const byte* payload = lazy_functions.begin() + offset;
+    offset += length;
+
+    // The function may be gone, or may have been compiled in the meantime if
+    // the script was merged into an existing one.
+    HeapObject object;
+    if (literal_id >= static_cast<uint32_t>(infos->length()) ||
+        !infos->Get(literal_id).GetHeapObjectIfWeak(&object)) {
+      continue;
+    }
+    Handle<SharedFunctionInfo> shared(SharedFunctionInfo::cast(object),
+                                      isolate);
+    if (shared->is_compiled()) continue;
+    Handle<ByteArray> bytes =
+        isolate->factory()->NewByteArray(length, AllocationType::kOld);
+    bytes->copy_in(0, payload, length);
+    table = EphemeronHashTable::Put(table, shared, bytes);
+  }
+  isolate->heap()->SetLazyCodeCacheFunctions(*table);
+}
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
@@ -462,6 +675,7 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
+  RegisterLazyFunctions(isolate, scd, result);
   FinalizeDeserialization(isolate, result, timer);
 
   return scope.CloseAndEscape(result);
@@ -498,7 +712,8 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
 MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     Isolate* isolate, OffThreadDeserializeData&& data,
     AlignedCachedData* cached_data, Handle<String> source,
-    ScriptOriginOptions origin_options) {
+    ScriptOriginOptions origin_options,
+    BackgroundMergeTask* background_merge_task) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
 
@@ -545,23 +760,32 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
   DCHECK(data.persistent_handles->Contains(result.location()));
   result = handle(*result, isolate);
 
-  // Fix up the source on the script. This should be the only deserialized
-  // script, and the off-thread deserializer should have set its source to
-  // the empty string.
-  DCHECK_EQ(data.scripts.size(), 1);
-  DCHECK_EQ(result->script(), *data.scripts[0]);
-  DCHECK_EQ(Script::cast(result->script()).source(),
-            ReadOnlyRoots(isolate).empty_string());
-  Script::cast(result->script()).set_source(*source);
-
-  // Fix up the script list to include the newly deserialized script.
-  Handle<WeakArrayList> list = isolate->factory()->script_list();
-  for (Handle<Script> script : data.scripts) {
-    DCHECK(data.persistent_handles->Contains(script.location()));
-    list =
-        WeakArrayList::AddToEnd(isolate, list, MaybeObjectHandle::Weak(script));
+  if (background_merge_task &&
+      background_merge_task->HasPendingForegroundWork()) {
+    // The deserialized script is dropped in favor of the one in the
+    // compilation cache, which takes over the deserialized functions it
+    // doesn't have compiled.
+    result = background_merge_task->CompleteMergeInForeground(isolate);
+    DCHECK(Script::cast(result->script()).source().StrictEquals(*source));
+  } else {
+    // Fix up the source on the script. This should be the only deserialized
+    // script, and the off-thread deserializer should have set its source to
+    // the empty string.
+    DCHECK_EQ(data.scripts.size(), 1);
+    DCHECK_EQ(result->script(), *data.scripts[0]);
+    DCHECK_EQ(Script::cast(result->script()).source(),
+              ReadOnlyRoots(isolate).empty_string());
+    Script::cast(result->script()).set_source(*source);
+
+    // Fix up the script list to include the newly deserialized script.
+    Handle<WeakArrayList> list = isolate->factory()->script_list();
+    for (Handle<Script> script : data.scripts) {
+      DCHECK(data.persistent_handles->Contains(script.location()));
+      list = WeakArrayList::AddToEnd(isolate, list,
+                                     MaybeObjectHandle::Weak(script));
+    }
+    isolate->heap()->SetRootScriptList(*list);
   }
-  isolate->heap()->SetRootScriptList(*list);
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -570,17 +794,88 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
            length, ms);
   }
 
+  RegisterLazyFunctions(isolate, scd, result);
   FinalizeDeserialization(isolate, result, timer);
 
   return scope.CloseAndEscape(result);
 }
 
+// static
+bool CodeSerializer::DeserializeLazyFunction(
+    Isolate* isolate, Handle<SharedFunctionInfo> shared) {
+  DCHECK(!shared->is_compiled());
+  Handle<Object> maybe_table(isolate->heap()->lazy_code_cache_functions(),
+                             isolate);
+  if (maybe_table->IsUndefined(isolate)) return false;
+  Handle<EphemeronHashTable> table =
+      Handle<EphemeronHashTable>::cast(maybe_table);
+  Handle<Object> bytes(table->Lookup(shared), isolate);
+  if (bytes->IsTheHole(isolate)) return false;
+  bool was_present;
+  table = EphemeronHashTable::Remove(isolate, table, shared, &was_present);
+  DCHECK(was_present);
+  isolate->heap()->SetLazyCodeCacheFunctions(*table);
+
+  // Leave the functions that the debugger or the profilers need to see being
+  // compiled to the compiler.
+  if (shared->scope_info(kAcquireLoad).IsEmpty() || shared->HasDebugInfo() ||
+      FLAG_interpreted_frames_native_stack ||
+      isolate->NeedsSourcePositionsForProfiling() ||
+      isolate->v8_file_logger()->is_listening_to_code_events() ||
+      isolate->is_profiling() ||
+      isolate->log_event_dispatcher()->is_listening_to_code_events()) {
+    return false;
+  }
+
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  // The deserializer allocates while it reads the payload, which would move
+  // the byte array.
+  Handle<ByteArray> record = Handle<ByteArray>::cast(bytes);
+  std::vector<byte> payload(
+      record->GetDataStartAddress(),
+      record->GetDataStartAddress() + record->length());
+  // Attach the scope infos in the order they were attached on serialization.
+  std::vector<Handle<HeapObject>> attached_objects;
+  {
+    DisallowGarbageCollection no_gc;
+    ScopeInfo scope_info = shared->scope_info(kAcquireLoad);
+    while (true) {
+      attached_objects.push_back(handle(scope_info, isolate));
+      if (!scope_info.HasOuterScopeInfo()) break;
+      scope_info = scope_info.OuterScopeInfo();
+    }
+  }
+  Handle<HeapObject> result;
+  if (!ObjectDeserializer::DeserializeWithAttachedObjects(
+           isolate, base::VectorOf(payload), attached_objects)
+           .ToHandle(&result)) {
+    if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
+    return false;
+  }
+
+  Handle<FixedArray> compiled_data = Handle<FixedArray>::cast(result);
+  shared->set_feedback_metadata(
+      FeedbackMetadata::cast(compiled_data->get(1)), kReleaseStore);
+  shared->set_bytecode_array(BytecodeArray::cast(compiled_data->get(0)));
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Deserializing lazy function from %zu bytes took %0.3f ms]\n",
+           payload.size(), ms);
+  }
+  return true;
+}
+
 SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
                                        const CodeSerializer* cs) {
   DisallowGarbageCollection no_gc;
 
   // Calculate sizes.
-  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size());
+  const std::vector<byte>* lazy_functions = cs->lazy_functions();
+  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size()) +
+                  static_cast<uint32_t>(lazy_functions->size());
   DCHECK(IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
@@ -602,6 +897,10 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   // Copy serialized data.
   CopyBytes(data_ + kHeaderSize, payload->data(),
             static_cast<size_t>(payload->size()));
+  if (!lazy_functions->empty()) {
+    CopyBytes(data_ + kHeaderSize + payload->size(), lazy_functions->data(),
+              lazy_functions->size());
+  }
   uint32_t checksum =
       FLAG_verify_snapshot_checksum ? Checksum(ChecksummedContent()) : 0;
   SetHeaderValue(kChecksumOffset, checksum);
@@ -679,10 +978,18 @@ base::Vector<const byte> SerializedCodeData::Payload() const {
   const byte* payload = data_ + kHeaderSize;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
-  DCHECK_EQ(data_ + size_, payload + length);
+  DCHECK_LE(payload + length, data_ + size_);
   return base::Vector<const byte>(payload, length);
 }
 
+base::Vector<const byte> SerializedCodeData::LazyFunctions() const {
+  const byte* lazy_functions =
+      data_ + kHeaderSize + GetHeaderValue(kPayloadLengthOffset);
+  DCHECK_LE(lazy_functions, data_ + size_);
+  return base::Vector<const byte>(
+      lazy_functions, static_cast<size_t>(data_ + size_ - lazy_functions));
+}
+
 SerializedCodeData::SerializedCodeData(AlignedCachedData* data)
     : SerializedData(const_cast<byte*>(data->data()), data->length()) {}
 
@@ -12,6 +12,7 @@
 namespace v8 {
 namespace internal {
 
+class BackgroundMergeTask;
 class PersistentHandles;
 
 class V8_EXPORT_PRIVATE AlignedCachedData {
@@ -62,6 +63,13 @@ enum class SerializedCodeSanityCheckResult {
 class CodeSerializer : public Serializer {
  public:
   struct OffThreadDeserializeData {
+   public:
+    bool HasResult() const { return !maybe_result.is_null(); }
+    Handle<Script> GetOnlyScript() const {
+      DCHECK_EQ(scripts.size(), 1);
+      return scripts[0];
+    }
+
    private:
     friend class CodeSerializer;
     MaybeHandle<SharedFunctionInfo> maybe_result;
@@ -86,13 +94,24 @@ class CodeSerializer : public Serializer {
   StartDeserializeOffThread(LocalIsolate* isolate,
                             AlignedCachedData* cached_data);
 
+  // If |background_merge_task| has a pending merge, the result is merged
+  // into the script in the compilation cache instead of added as a new
+  // script.
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo>
-  FinishOffThreadDeserialize(Isolate* isolate, OffThreadDeserializeData&& data,
-                             AlignedCachedData* cached_data,
-                             Handle<String> source,
-                             ScriptOriginOptions origin_options);
+  FinishOffThreadDeserialize(
+      Isolate* isolate, OffThreadDeserializeData&& data,
+      AlignedCachedData* cached_data, Handle<String> source,
+      ScriptOriginOptions origin_options,
+      BackgroundMergeTask* background_merge_task = nullptr);
+
+  // Installs the compiled data of |shared| if the code cache it was
+  // deserialized from has a lazy functions section for it. Returns whether
+  // |shared| is compiled.
+  static bool DeserializeLazyFunction(Isolate* isolate,
+                                      Handle<SharedFunctionInfo> shared);
 
   uint32_t source_hash() const { return source_hash_; }
+  const std::vector<byte>* lazy_functions() const { return &lazy_functions_; }
 
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
@@ -107,8 +126,14 @@ class CodeSerializer : public Serializer {
   bool SerializeReadOnlyObject(HeapObject obj,
                                const DisallowGarbageCollection& no_gc);
 
+  // Serializes the compiled data of |shared| into its own record of the lazy
+  // functions section.
+  void SerializeLazyFunction(Handle<SharedFunctionInfo> shared,
+                             Handle<FixedArray> compiled_data);
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  std::vector<byte> lazy_functions_;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
@@ -122,6 +147,14 @@ class SerializedCodeData : public SerializedData {
   // [4] payload length
   // [5] payload checksum
   // ...  serialized payload
+  // ...  lazy functions section
+  //
+  // The lazy functions section holds the compiled data of the functions that
+  // are serialized as uncompiled, one pointer-size aligned record per
+  // function:
+  // [0] function literal id
+  // [1] record payload length
+  // ...  serialized bytecode and feedback metadata
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
   static const uint32_t kFlagHashOffset = kSourceHashOffset + kUInt32Size;
@@ -130,6 +163,13 @@ class SerializedCodeData : public SerializedData {
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
+  // Offsets within a record of the lazy functions section.
+  static const uint32_t kLazyFunctionLiteralIdOffset = 0;
+  static const uint32_t kLazyFunctionLengthOffset =
+      kLazyFunctionLiteralIdOffset + kUInt32Size;
+  static const uint32_t kLazyFunctionHeaderSize =
+      kLazyFunctionLengthOffset + kUInt32Size;
+
   // Used when consuming.
   static SerializedCodeData FromCachedData(
       AlignedCachedData* cached_data, uint32_t expected_source_hash,
@@ -154,6 +194,7 @@ class SerializedCodeData : public SerializedData {
   AlignedCachedData* GetScriptData();
 
   base::Vector<const byte> Payload() const;
+  base::Vector<const byte> LazyFunctions() const;
 
   static uint32_t SourceHash(Handle<String> source,
                              ScriptOriginOptions origin_options);
@@ -0,0 +1,74 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/context-snapshot-cache.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "src/init/v8.h"
+#include "src/snapshot/snapshot-compression.h"
+
+namespace v8 {
+namespace internal {
+
+class ContextSnapshotCache::DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(ContextSnapshotCache* cache) : cache_(cache) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_entry_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= cache_->entries_.size()) return;
+      Decompress(cache_->entries_[index].get());
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_entry = next_entry_.load(std::memory_order_relaxed);
+    return cache_->entries_.size() -
+           std::min(next_entry, cache_->entries_.size());
+  }
+
+ private:
+  ContextSnapshotCache* const cache_;
+  std::atomic<size_t> next_entry_{0};
+};
+
+ContextSnapshotCache::ContextSnapshotCache(
+    std::vector<base::Vector<const byte>> compressed_contexts) {
+  for (base::Vector<const byte> compressed_data : compressed_contexts) {
+    entries_.push_back(std::make_unique<Entry>());
+    entries_.back()->compressed_data = compressed_data;
+  }
+}
+
+ContextSnapshotCache::~ContextSnapshotCache() {
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+void ContextSnapshotCache::DecompressInBackground() {
+  DCHECK(!job_handle_);
+  if (entries_.empty()) return;
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible, std::make_unique<DecompressionJob>(this));
+}
+
+base::Vector<const byte> ContextSnapshotCache::Get(size_t index) {
+  DCHECK_LT(index, entries_.size());
+  Entry* entry = entries_[index].get();
+  Decompress(entry);
+  return entry->data->RawData();
+}
+
+// static
+void ContextSnapshotCache::Decompress(Entry* entry) {
+  base::MutexGuard guard(&entry->mutex);
+  if (entry->data) return;
+  entry->data = std::make_unique<SnapshotData>(
+      SnapshotCompression::Decompress(entry->compressed_data));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,60 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CONTEXT_SNAPSHOT_CACHE_H_
+#define V8_SNAPSHOT_CONTEXT_SNAPSHOT_CACHE_H_
+
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/snapshot/snapshot-data.h"
+
+namespace v8 {
+namespace internal {
+
+// Keeps the decompressed context snapshots of an isolate, so that creating a
+// context from a compressed snapshot only decompresses it the first time.
+// The context snapshots are decompressed on worker threads while the isolate
+// is being set up, ahead of the first Context::New.
+class ContextSnapshotCache final {
+ public:
+  // |compressed_contexts| are the compressed context snapshots of the blob the
+  // isolate is created from, and must outlive the cache.
+  explicit ContextSnapshotCache(
+      std::vector<base::Vector<const byte>> compressed_contexts);
+  ~ContextSnapshotCache();
+  ContextSnapshotCache(const ContextSnapshotCache&) = delete;
+  ContextSnapshotCache& operator=(const ContextSnapshotCache&) = delete;
+
+  void DecompressInBackground();
+
+  // Returns the decompressed context snapshot |index|, which stays valid for
+  // the lifetime of the cache. Decompresses it on the calling thread unless
+  // a worker thread did or is doing so.
+  base::Vector<const byte> Get(size_t index);
+
+ private:
+  class DecompressionJob;
+
+  struct Entry {
+    base::Vector<const byte> compressed_data;
+    base::Mutex mutex;
+    std::unique_ptr<SnapshotData> data;
+  };
+
+  // Decompresses |entry| unless that happened already.
+  static void Decompress(Entry* entry);
+
+  std::vector<std::unique_ptr<Entry>> entries_;
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CONTEXT_SNAPSHOT_CACHE_H_
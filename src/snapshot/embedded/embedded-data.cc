@@ -100,14 +100,16 @@ Builtin OffHeapInstructionStream::TryLookupCode(Isolate* isolate,
 
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
   if (V8_SHORT_BUILTIN_CALLS_BOOL && !Builtins::IsBuiltinId(builtin)) {
-    // When shared pointer compression cage is enabled and it has the embedded
-    // code blob copy then it could have been used regardless of whether the
-    // isolate uses it or knows about it or not (see
-    // Code::OffHeapInstructionStart()).
+    // When shared pointer compression cage is enabled and the CodeRange of the
+    // isolate group has the embedded code blob copy then it could have been
+    // used regardless of whether the isolate uses it or knows about it or not
+    // (see Code::OffHeapInstructionStart()).
     // So, this blob has to be checked too.
-    CodeRange* code_range = CodeRange::GetProcessWideCodeRange().get();
+    std::shared_ptr<CodeRange> code_range =
+        isolate->isolate_group()->GetCodeRange();
     if (code_range && code_range->embedded_blob_code_copy() != nullptr) {
-      builtin = i::TryLookupCode(EmbeddedData::FromBlob(code_range), address);
+      builtin =
+          i::TryLookupCode(EmbeddedData::FromBlob(code_range.get()), address);
     }
   }
 #endif
@@ -22,6 +22,11 @@ ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
                    false) {}
 
+ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
+                                       base::Vector<const byte> payload)
+    : Deserializer(isolate, payload, SerializedData::kMagicNumber, true,
+                   false) {}
+
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfo(
     Isolate* isolate, const SerializedCodeData* data, Handle<String> source) {
@@ -35,6 +40,19 @@ ObjectDeserializer::DeserializeSharedFunctionInfo(
              : MaybeHandle<SharedFunctionInfo>();
 }
 
+// static
+MaybeHandle<HeapObject> ObjectDeserializer::DeserializeWithAttachedObjects(
+    Isolate* isolate, base::Vector<const byte> payload,
+    const std::vector<Handle<HeapObject>>& attached_objects) {
+  ObjectDeserializer d(isolate, payload);
+
+  for (Handle<HeapObject> attached_object : attached_objects) {
+    d.AddAttachedObject(attached_object);
+  }
+
+  return d.Deserialize();
+}
+
 MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   DCHECK(deserializing_user_code());
   HandleScope scope(isolate());
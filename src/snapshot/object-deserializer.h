@@ -19,8 +19,15 @@ class ObjectDeserializer final : public Deserializer<Isolate> {
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
       Isolate* isolate, const SerializedCodeData* data, Handle<String> source);
 
+  // Deserializes a payload without a header, i.e. a section of a code cache,
+  // which may refer to the |attached_objects|.
+  static MaybeHandle<HeapObject> DeserializeWithAttachedObjects(
+      Isolate* isolate, base::Vector<const byte> payload,
+      const std::vector<Handle<HeapObject>>& attached_objects);
+
  private:
   explicit ObjectDeserializer(Isolate* isolate, const SerializedCodeData* data);
+  ObjectDeserializer(Isolate* isolate, base::Vector<const byte> payload);
 
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize();
@@ -1067,13 +1067,14 @@ void Serializer::ObjectSerializer::VisitExternalReference(Code host,
                           kExternalPointerNullTag);
 }
 
-void Serializer::ObjectSerializer::VisitExternalPointer(HeapObject host,
-                                                        ExternalPointer_t ptr) {
+void Serializer::ObjectSerializer::VisitExternalPointer(
+    HeapObject host, ExternalPointerSlot slot) {
   // TODO(v8:12700) handle other external references here as well. This should
   // allow removing some of the other Visit* methods, should unify the sandbox
   // vs no-sandbox implementation, and should allow removing various
   // XYZForSerialization methods throughout the codebase.
   if (host.IsJSExternalObject()) {
+    ExternalPointer_t ptr = slot.load();
 #ifdef V8_SANDBOXED_EXTERNAL_POINTERS
     // TODO(saelo) maybe add a helper method for this conversion if also needed
     // in other places? This might require a ExternalPointerTable::Get variant
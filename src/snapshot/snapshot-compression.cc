@@ -4,7 +4,13 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +18,75 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// The compressed data starts with a table of uint32_t-sized entries:
+// [0] uncompressed size
+// [1] number of chunks
+// [2 + i] compressed size of chunk i
+// It is followed by the chunks, which are compressed independently of each
+// other, so that they can be decompressed in parallel. All chunks but the
+// last one decompress to kChunkSize bytes.
+constexpr uint32_t kUncompressedSizeOffset = 0;
+constexpr uint32_t kChunkCountOffset = kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kChunkSizesOffset = kChunkCountOffset + kUInt32Size;
+constexpr uint32_t kChunkSize = 256 * KB;
+
+uint32_t ReadUint32(const byte* data, uint32_t offset) {
+  uint32_t value;
+  MemCopy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void WriteUint32(byte* data, uint32_t offset, uint32_t value) {
+  MemCopy(data + offset, &value, sizeof(value));
+}
+
+uint32_t ChunkCount(uint32_t uncompressed_size) {
+  return (uncompressed_size + kChunkSize - 1) / kChunkSize;
+}
+
+struct DecompressionChunk {
+  const Bytef* compressed_data;
+  uLong compressed_size;
+  Bytef* uncompressed_data;
+  uLongf uncompressed_size;
+};
+
+void DecompressChunk(const DecompressionChunk& chunk) {
+  uLongf uncompressed_size = chunk.uncompressed_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, chunk.uncompressed_data, &uncompressed_size,
+               chunk.compressed_data, chunk.compressed_size),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, chunk.uncompressed_size);
 }
 
+class DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(const std::vector<DecompressionChunk>* chunks)
+      : chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) return;
+      DecompressChunk((*chunks_)[index]);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next_chunk, chunks_->size());
+  }
+
+ private:
+  const std::vector<DecompressionChunk>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,39 +94,51 @@ SnapshotData SnapshotCompression::Compress(
   if (FLAG_profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const byte> input = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(input.size());
+  uint32_t chunk_count = ChunkCount(payload_length);
+  uint32_t chunks_offset = kChunkSizesOffset + chunk_count * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  uint32_t max_size = chunks_offset;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    max_size += static_cast<uint32_t>(compressBound(
+        std::min(kChunkSize, payload_length - i * kChunkSize)));
+  }
+  snapshot_data.AllocateData(max_size);
 
   byte* compressed_data = const_cast<byte*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          base::bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  // manually store the sizes.
+  WriteUint32(compressed_data, kUncompressedSizeOffset, payload_length);
+  WriteUint32(compressed_data, kChunkCountOffset, chunk_count);
+
+  uint32_t size = chunks_offset;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t input_offset = i * kChunkSize;
+    const uLongf input_size =
+        std::min(kChunkSize, payload_length - input_offset);
+    uLongf compressed_chunk_size = max_size - size;
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + size,
+                 &compressed_chunk_size,
+                 base::bit_cast<const Bytef*>(input.begin() + input_offset),
+                 input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    WriteUint32(compressed_data, kChunkSizesOffset + i * kUInt32Size,
+                static_cast<uint32_t>(compressed_chunk_size));
+    size += static_cast<uint32_t>(compressed_chunk_size);
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(size);
+  DCHECK_EQ(payload_length, ReadUint32(snapshot_data.RawData().begin(),
+                                       kUncompressedSizeOffset));
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -68,29 +149,45 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      base::bit_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const byte* input = compressed_data.begin();
+  CHECK_LE(kChunkSizesOffset, compressed_data.size());
+  uint32_t uncompressed_payload_length =
+      ReadUint32(input, kUncompressedSizeOffset);
+  uint32_t chunk_count = ReadUint32(input, kChunkCountOffset);
+  CHECK_EQ(chunk_count, ChunkCount(uncompressed_payload_length));
+  uint32_t chunks_offset = kChunkSizesOffset + chunk_count * kUInt32Size;
+  CHECK_LE(chunks_offset, compressed_data.size());
 
   snapshot_data.AllocateData(uncompressed_payload_length);
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               base::bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  std::vector<DecompressionChunk> chunks(chunk_count);
+  Bytef* output = base::bit_cast<Bytef*>(snapshot_data.RawData().begin());
+  uint32_t offset = chunks_offset;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    DecompressionChunk& chunk = chunks[i];
+    chunk.compressed_data = base::bit_cast<const Bytef*>(input + offset);
+    chunk.compressed_size =
+        ReadUint32(input, kChunkSizesOffset + i * kUInt32Size);
+    CHECK_LE(chunk.compressed_size, compressed_data.size() - offset);
+    chunk.uncompressed_data = output + i * kChunkSize;
+    chunk.uncompressed_size =
+        std::min(kChunkSize, uncompressed_payload_length - i * kChunkSize);
+    offset += static_cast<uint32_t>(chunk.compressed_size);
+  }
+
+  if (chunk_count > 1 && FLAG_concurrent_snapshot_decompression) {
+    std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking,
+        std::make_unique<DecompressionJob>(&chunks));
+    job_handle->Join();
+  } else {
+    for (const DecompressionChunk& chunk : chunks) DecompressChunk(chunk);
+  }
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
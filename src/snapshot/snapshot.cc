@@ -27,6 +27,7 @@
 #include "src/utils/version.h"
 
 #ifdef V8_SNAPSHOT_COMPRESSION
+#include "src/snapshot/context-snapshot-cache.h"
 #include "src/snapshot/snapshot-compression.h"
 #endif
 
@@ -187,6 +188,20 @@ bool Snapshot::Initialize(Isolate* isolate) {
   bool success = isolate->InitWithSnapshot(
       &startup_snapshot_data, &read_only_snapshot_data,
       &shared_heap_snapshot_data, ExtractRehashability(blob));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (success && FLAG_background_context_snapshot_decompression) {
+    // Decompress the context snapshots while the embedder finishes setting up
+    // the isolate, instead of on every NewContextFromSnapshot.
+    std::vector<base::Vector<const byte>> context_data;
+    uint32_t num_contexts = SnapshotImpl::ExtractNumContexts(blob);
+    for (uint32_t i = 0; i < num_contexts; i++) {
+      context_data.push_back(SnapshotImpl::ExtractContextData(blob, i));
+    }
+    isolate->set_context_snapshot_cache(
+        std::make_unique<ContextSnapshotCache>(std::move(context_data)));
+    isolate->context_snapshot_cache()->DecompressInBackground();
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     int bytes = startup_data.length();
@@ -208,7 +223,14 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   bool can_rehash = ExtractRehashability(blob);
   base::Vector<const byte> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
+#ifdef V8_SNAPSHOT_COMPRESSION
+  ContextSnapshotCache* cache = isolate->context_snapshot_cache();
+  SnapshotData snapshot_data =
+      cache != nullptr ? SnapshotData(cache->Get(context_index))
+                       : MaybeDecompress(isolate, context_data);
+#else
   SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
+#endif  // V8_SNAPSHOT_COMPRESSION
 
   MaybeHandle<Context> maybe_result = ContextDeserializer::DeserializeContext(
       isolate, &snapshot_data, can_rehash, global_proxy,
@@ -4,11 +4,21 @@
 
 #include "src/strings/string-case.h"
 
+#include <algorithm>
+
+#include "src/base/build_config.h"
 #include "src/base/logging.h"
+#include "src/base/macros.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -58,6 +68,64 @@ static inline word_t AsciiRangeMask(word_t w, char m, char n) {
   return (tmp1 & tmp2 & (kOneInEveryByte * 0x80));
 }
 
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+constexpr int kAsciiBlockSize = 16;
+
+// Converts the kAsciiBlockSize characters at src. Returns false without
+// writing anything if one of them is not ASCII.
+template <bool is_lower>
+V8_INLINE bool ConvertAsciiBlock(char* dst, const char* src, bool* changed) {
+  const char lo = is_lower ? 'A' - 1 : 'a' - 1;
+  const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+#if V8_HOST_HAS_SSE2
+  const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  if (_mm_movemask_epi8(chars) != 0) return false;
+  // Signed comparisons are fine since all characters are ASCII.
+  const __m128i in_range =
+      _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(lo)),
+                    _mm_cmplt_epi8(chars, _mm_set1_epi8(hi)));
+  if (_mm_movemask_epi8(in_range) != 0) *changed = true;
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(dst),
+      _mm_xor_si128(chars, _mm_and_si128(in_range, _mm_set1_epi8(1 << 5))));
+#elif V8_HOST_HAS_NEON
+  const uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+  if (vmaxvq_u8(chars) & 0x80) return false;
+  const uint8x16_t in_range = vandq_u8(vcgtq_u8(chars, vdupq_n_u8(lo)),
+                                       vcltq_u8(chars, vdupq_n_u8(hi)));
+  if (vmaxvq_u8(in_range) != 0) *changed = true;
+  vst1q_u8(reinterpret_cast<uint8_t*>(dst),
+           veorq_u8(chars, vandq_u8(in_range, vdupq_n_u8(1 << 5))));
+#endif  // V8_HOST_HAS_SSE2
+  return true;
+}
+
+// Whether one of the kAsciiBlockSize characters at src is not ASCII or would
+// be changed by the conversion.
+template <bool is_lower>
+V8_INLINE bool AsciiBlockNeedsConversion(const char* src) {
+  const char lo = is_lower ? 'A' - 1 : 'a' - 1;
+  const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+#if V8_HOST_HAS_SSE2
+  const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  // Non-ASCII characters are negative and compare below {hi}.
+  const __m128i found = _mm_or_si128(
+      chars, _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(lo)),
+                           _mm_cmplt_epi8(chars, _mm_set1_epi8(hi))));
+  return _mm_movemask_epi8(found) != 0;
+#elif V8_HOST_HAS_NEON
+  const uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+  const uint8x16_t found =
+      vorrq_u8(vcgeq_u8(chars, vdupq_n_u8(0x80)),
+               vandq_u8(vcgtq_u8(chars, vdupq_n_u8(lo)),
+                        vcltq_u8(chars, vdupq_n_u8(hi))));
+  return vmaxvq_u8(found) != 0;
+#endif  // V8_HOST_HAS_SSE2
+}
+
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length,
                      bool* changed_out) {
@@ -77,6 +145,18 @@ int FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  // Process blocks of the input with unaligned vector accesses first. Their
+  // size is a multiple of the word size, so this keeps the alignment of src
+  // and dst for the word loops below.
+  while (limit - src >= kAsciiBlockSize) {
+    if (!ConvertAsciiBlock<is_lower>(dst, src, &changed)) {
+      return static_cast<int>(src - saved_src);
+    }
+    src += kAsciiBlockSize;
+    dst += kAsciiBlockSize;
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
     // Process the prefix of the input that requires no conversion one aligned
@@ -132,5 +212,244 @@ template int FastAsciiConvert<false>(char* dst, const char* src, int length,
 template int FastAsciiConvert<true>(char* dst, const char* src, int length,
                                     bool* changed_out);
 
+template <bool is_lower>
+int FindFirstAsciiToConvert(const char* src, int length) {
+  static const char lo = is_lower ? 'A' - 1 : 'a' - 1;
+  static const char hi = is_lower ? 'Z' + 1 : 'z' + 1;
+  int index = 0;
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  while (length - index >= kAsciiBlockSize &&
+         !AsciiBlockNeedsConversion<is_lower>(src + index)) {
+    index += kAsciiBlockSize;
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  for (; index < length; ++index) {
+    char c = src[index];
+    if ((c & kAsciiMask) != 0 || (lo < c && c < hi)) break;
+  }
+  return index;
+}
+
+template int FindFirstAsciiToConvert<false>(const char* src, int length);
+template int FindFirstAsciiToConvert<true>(const char* src, int length);
+
+namespace {
+
+// The case of the characters in a range of the table below.
+enum CaseKind : uint8_t {
+  // No case mapping.
+  kCaseless,
+  // Uppercase characters c whose lowercase is c + delta.
+  kUpper,
+  // Lowercase characters c whose uppercase is c + delta.
+  kLower,
+  // Pairs of an uppercase character c at an even respectively odd code point
+  // and its lowercase c + 1.
+  kEvenUpper,
+  kOddUpper,
+};
+
+struct CaseRange {
+  uint16_t first;
+  uint16_t last;
+  CaseKind kind;
+  int32_t delta;
+};
+
+// The case mappings of the characters of Latin, Greek, Cyrillic, Armenian,
+// Latin Extended Additional, the symbol blocks from U+2000 to U+2BFF, CJK,
+// Hangul, private use and halfwidth and fullwidth forms that map to exactly
+// one BMP character in the root locale, independent of their context.
+// Generated from the Unicode character database. Characters that are not in
+// the table, such as U+00DF (uppercase "SS"), U+0130 (lowercase "i" with a
+// combining dot) and U+03A3 (lowercase depends on the position in the word),
+// need the full Unicode case mapping.
+constexpr CaseRange kCaseRanges[] = {
+    {0x0000, 0x0040, kCaseless, 0}, {0x0041, 0x005A, kUpper, 32},
+    {0x005B, 0x0060, kCaseless, 0}, {0x0061, 0x007A, kLower, -32},
+    {0x007B, 0x00B4, kCaseless, 0}, {0x00B5, 0x00B5, kLower, 743},
+    {0x00B6, 0x00BF, kCaseless, 0}, {0x00C0, 0x00D6, kUpper, 32},
+    {0x00D7, 0x00D7, kCaseless, 0}, {0x00D8, 0x00DE, kUpper, 32},
+    {0x00E0, 0x00F6, kLower, -32}, {0x00F7, 0x00F7, kCaseless, 0},
+    {0x00F8, 0x00FE, kLower, -32}, {0x00FF, 0x00FF, kLower, 121},
+    {0x0100, 0x012F, kEvenUpper, 0}, {0x0131, 0x0131, kLower, -232},
+    {0x0132, 0x0137, kEvenUpper, 0}, {0x0138, 0x0138, kCaseless, 0},
+    {0x0139, 0x0148, kOddUpper, 0}, {0x014A, 0x0177, kEvenUpper, 0},
+    {0x0178, 0x0178, kUpper, -121}, {0x0179, 0x017E, kOddUpper, 0},
+    {0x017F, 0x017F, kLower, -300}, {0x0180, 0x0180, kLower, 195},
+    {0x0181, 0x0181, kUpper, 210}, {0x0182, 0x0185, kEvenUpper, 0},
+    {0x0186, 0x0186, kUpper, 206}, {0x0187, 0x0188, kOddUpper, 0},
+    {0x0189, 0x018A, kUpper, 205}, {0x018B, 0x018C, kOddUpper, 0},
+    {0x018D, 0x018D, kCaseless, 0}, {0x018E, 0x018E, kUpper, 79},
+    {0x018F, 0x018F, kUpper, 202}, {0x0190, 0x0190, kUpper, 203},
+    {0x0191, 0x0192, kOddUpper, 0}, {0x0193, 0x0193, kUpper, 205},
+    {0x0194, 0x0194, kUpper, 207}, {0x0195, 0x0195, kLower, 97},
+    {0x0196, 0x0196, kUpper, 211}, {0x0197, 0x0197, kUpper, 209},
+    {0x0198, 0x0199, kEvenUpper, 0}, {0x019A, 0x019A, kLower, 163},
+    {0x019B, 0x019B, kLower, 42561}, {0x019C, 0x019C, kUpper, 211},
+    {0x019D, 0x019D, kUpper, 213}, {0x019E, 0x019E, kLower, 130},
+    {0x019F, 0x019F, kUpper, 214}, {0x01A0, 0x01A5, kEvenUpper, 0},
+    {0x01A6, 0x01A6, kUpper, 218}, {0x01A7, 0x01A8, kOddUpper, 0},
+    {0x01A9, 0x01A9, kUpper, 218}, {0x01AA, 0x01AB, kCaseless, 0},
+    {0x01AC, 0x01AD, kEvenUpper, 0}, {0x01AE, 0x01AE, kUpper, 218},
+    {0x01AF, 0x01B0, kOddUpper, 0}, {0x01B1, 0x01B2, kUpper, 217},
+    {0x01B3, 0x01B6, kOddUpper, 0}, {0x01B7, 0x01B7, kUpper, 219},
+    {0x01B8, 0x01B9, kEvenUpper, 0}, {0x01BA, 0x01BB, kCaseless, 0},
+    {0x01BC, 0x01BD, kEvenUpper, 0}, {0x01BE, 0x01BE, kCaseless, 0},
+    {0x01BF, 0x01BF, kLower, 56}, {0x01C0, 0x01C3, kCaseless, 0},
+    {0x01C4, 0x01C4, kUpper, 2}, {0x01C6, 0x01C6, kLower, -2},
+    {0x01C7, 0x01C7, kUpper, 2}, {0x01C9, 0x01C9, kLower, -2},
+    {0x01CA, 0x01CA, kUpper, 2}, {0x01CC, 0x01CC, kLower, -2},
+    {0x01CD, 0x01DC, kOddUpper, 0}, {0x01DD, 0x01DD, kLower, -79},
+    {0x01DE, 0x01EF, kEvenUpper, 0}, {0x01F1, 0x01F1, kUpper, 2},
+    {0x01F3, 0x01F3, kLower, -2}, {0x01F4, 0x01F5, kEvenUpper, 0},
+    {0x01F6, 0x01F6, kUpper, -97}, {0x01F7, 0x01F7, kUpper, -56},
+    {0x01F8, 0x021F, kEvenUpper, 0}, {0x0220, 0x0220, kUpper, -130},
+    {0x0221, 0x0221, kCaseless, 0}, {0x0222, 0x0233, kEvenUpper, 0},
+    {0x0234, 0x0239, kCaseless, 0}, {0x023A, 0x023A, kUpper, 10795},
+    {0x023B, 0x023C, kOddUpper, 0}, {0x023D, 0x023D, kUpper, -163},
+    {0x023E, 0x023E, kUpper, 10792}, {0x023F, 0x0240, kLower, 10815},
+    {0x0241, 0x0242, kOddUpper, 0}, {0x0243, 0x0243, kUpper, -195},
+    {0x0244, 0x0244, kUpper, 69}, {0x0245, 0x0245, kUpper, 71},
+    {0x0246, 0x024F, kEvenUpper, 0}, {0x0250, 0x0250, kLower, 10783},
+    {0x0251, 0x0251, kLower, 10780}, {0x0252, 0x0252, kLower, 10782},
+    {0x0253, 0x0253, kLower, -210}, {0x0254, 0x0254, kLower, -206},
+    {0x0255, 0x0255, kCaseless, 0}, {0x0256, 0x0257, kLower, -205},
+    {0x0258, 0x0258, kCaseless, 0}, {0x0259, 0x0259, kLower, -202},
+    {0x025A, 0x025A, kCaseless, 0}, {0x025B, 0x025B, kLower, -203},
+    {0x025C, 0x025C, kLower, 42319}, {0x025D, 0x025F, kCaseless, 0},
+    {0x0260, 0x0260, kLower, -205}, {0x0261, 0x0261, kLower, 42315},
+    {0x0262, 0x0262, kCaseless, 0}, {0x0263, 0x0263, kLower, -207},
+    {0x0264, 0x0264, kLower, 42343}, {0x0265, 0x0265, kLower, 42280},
+    {0x0266, 0x0266, kLower, 42308}, {0x0267, 0x0267, kCaseless, 0},
+    {0x0268, 0x0268, kLower, -209}, {0x0269, 0x0269, kLower, -211},
+    {0x026A, 0x026A, kLower, 42308}, {0x026B, 0x026B, kLower, 10743},
+    {0x026C, 0x026C, kLower, 42305}, {0x026D, 0x026E, kCaseless, 0},
+    {0x026F, 0x026F, kLower, -211}, {0x0270, 0x0270, kCaseless, 0},
+    {0x0271, 0x0271, kLower, 10749}, {0x0272, 0x0272, kLower, -213},
+    {0x0273, 0x0274, kCaseless, 0}, {0x0275, 0x0275, kLower, -214},
+    {0x0276, 0x027C, kCaseless, 0}, {0x027D, 0x027D, kLower, 10727},
+    {0x027E, 0x027F, kCaseless, 0}, {0x0280, 0x0280, kLower, -218},
+    {0x0281, 0x0281, kCaseless, 0}, {0x0282, 0x0282, kLower, 42307},
+    {0x0283, 0x0283, kLower, -218}, {0x0284, 0x0286, kCaseless, 0},
+    {0x0287, 0x0287, kLower, 42282}, {0x0288, 0x0288, kLower, -218},
+    {0x0289, 0x0289, kLower, -69}, {0x028A, 0x028B, kLower, -217},
+    {0x028C, 0x028C, kLower, -71}, {0x028D, 0x0291, kCaseless, 0},
+    {0x0292, 0x0292, kLower, -219}, {0x0293, 0x029C, kCaseless, 0},
+    {0x029D, 0x029D, kLower, 42261}, {0x029E, 0x029E, kLower, 42258},
+    {0x029F, 0x0344, kCaseless, 0}, {0x0345, 0x0345, kLower, 84},
+    {0x0346, 0x036F, kCaseless, 0}, {0x0370, 0x0373, kEvenUpper, 0},
+    {0x0374, 0x0375, kCaseless, 0}, {0x0376, 0x0377, kEvenUpper, 0},
+    {0x0378, 0x037A, kCaseless, 0}, {0x037B, 0x037D, kLower, 130},
+    {0x037E, 0x037E, kCaseless, 0}, {0x037F, 0x037F, kUpper, 116},
+    {0x0380, 0x0385, kCaseless, 0}, {0x0386, 0x0386, kUpper, 38},
+    {0x0387, 0x0387, kCaseless, 0}, {0x0388, 0x038A, kUpper, 37},
+    {0x038B, 0x038B, kCaseless, 0}, {0x038C, 0x038C, kUpper, 64},
+    {0x038D, 0x038D, kCaseless, 0}, {0x038E, 0x038F, kUpper, 63},
+    {0x0391, 0x03A1, kUpper, 32}, {0x03A2, 0x03A2, kCaseless, 0},
+    {0x03A4, 0x03AB, kUpper, 32}, {0x03AC, 0x03AC, kLower, -38},
+    {0x03AD, 0x03AF, kLower, -37}, {0x03B1, 0x03C1, kLower, -32},
+    {0x03C2, 0x03C2, kLower, -31}, {0x03C3, 0x03CB, kLower, -32},
+    {0x03CC, 0x03CC, kLower, -64}, {0x03CD, 0x03CE, kLower, -63},
+    {0x03CF, 0x03CF, kUpper, 8}, {0x03D0, 0x03D0, kLower, -62},
+    {0x03D1, 0x03D1, kLower, -57}, {0x03D2, 0x03D4, kCaseless, 0},
+    {0x03D5, 0x03D5, kLower, -47}, {0x03D6, 0x03D6, kLower, -54},
+    {0x03D7, 0x03D7, kLower, -8}, {0x03D8, 0x03EF, kEvenUpper, 0},
+    {0x03F0, 0x03F0, kLower, -86}, {0x03F1, 0x03F1, kLower, -80},
+    {0x03F2, 0x03F2, kLower, 7}, {0x03F3, 0x03F3, kLower, -116},
+    {0x03F4, 0x03F4, kUpper, -60}, {0x03F5, 0x03F5, kLower, -96},
+    {0x03F6, 0x03F6, kCaseless, 0}, {0x03F7, 0x03F8, kOddUpper, 0},
+    {0x03F9, 0x03F9, kUpper, -7}, {0x03FA, 0x03FB, kEvenUpper, 0},
+    {0x03FC, 0x03FC, kCaseless, 0}, {0x03FD, 0x03FF, kUpper, -130},
+    {0x0400, 0x040F, kUpper, 80}, {0x0410, 0x042F, kUpper, 32},
+    {0x0430, 0x044F, kLower, -32}, {0x0450, 0x045F, kLower, -80},
+    {0x0460, 0x0481, kEvenUpper, 0}, {0x0482, 0x0489, kCaseless, 0},
+    {0x048A, 0x04BF, kEvenUpper, 0}, {0x04C0, 0x04C0, kUpper, 15},
+    {0x04C1, 0x04CE, kOddUpper, 0}, {0x04CF, 0x04CF, kLower, -15},
+    {0x04D0, 0x052F, kEvenUpper, 0}, {0x0530, 0x0530, kCaseless, 0},
+    {0x0531, 0x0556, kUpper, 48}, {0x0557, 0x0560, kCaseless, 0},
+    {0x0561, 0x0586, kLower, -48}, {0x0588, 0x058F, kCaseless, 0},
+    {0x1E00, 0x1E95, kEvenUpper, 0}, {0x1E9B, 0x1E9B, kLower, -59},
+    {0x1E9C, 0x1E9D, kCaseless, 0}, {0x1E9E, 0x1E9E, kUpper, -7615},
+    {0x1E9F, 0x1E9F, kCaseless, 0}, {0x1EA0, 0x1EFF, kEvenUpper, 0},
+    {0x2000, 0x2125, kCaseless, 0}, {0x2126, 0x2126, kUpper, -7517},
+    {0x2127, 0x2129, kCaseless, 0}, {0x212A, 0x212A, kUpper, -8383},
+    {0x212B, 0x212B, kUpper, -8262}, {0x212C, 0x2131, kCaseless, 0},
+    {0x2132, 0x2132, kUpper, 28}, {0x2133, 0x214D, kCaseless, 0},
+    {0x214E, 0x214E, kLower, -28}, {0x214F, 0x215F, kCaseless, 0},
+    {0x2160, 0x216F, kUpper, 16}, {0x2170, 0x217F, kLower, -16},
+    {0x2180, 0x2182, kCaseless, 0}, {0x2183, 0x2184, kOddUpper, 0},
+    {0x2185, 0x24B5, kCaseless, 0}, {0x24B6, 0x24CF, kUpper, 26},
+    {0x24D0, 0x24E9, kLower, -26}, {0x24EA, 0x2BFF, kCaseless, 0},
+    {0x3000, 0x9FFF, kCaseless, 0}, {0xAC00, 0xD7A3, kCaseless, 0},
+    {0xE000, 0xF8FF, kCaseless, 0}, {0xFF00, 0xFF20, kCaseless, 0},
+    {0xFF21, 0xFF3A, kUpper, 32}, {0xFF3B, 0xFF40, kCaseless, 0},
+    {0xFF41, 0xFF5A, kLower, -32}, {0xFF5B, 0xFFFF, kCaseless, 0},
+};
+
+// Returns the case conversion of c, or -1 if it needs the full Unicode case
+// mapping. Looks up the range of c in the table, starting with *range.
+template <bool is_lower>
+V8_INLINE int ConvertTwoByteCharacter(uint16_t c, const CaseRange** range) {
+  const CaseRange* r = *range;
+  if (c < r->first || c > r->last) {
+    const CaseRange* end = kCaseRanges + arraysize(kCaseRanges);
+    r = std::upper_bound(
+        kCaseRanges, end, c,
+        [](uint16_t c, const CaseRange& range) { return c < range.first; });
+    if (r == kCaseRanges) return -1;
+    --r;
+    if (c > r->last) return -1;
+    *range = r;
+  }
+  switch (r->kind) {
+    case kCaseless:
+      return c;
+    case kUpper:
+      return is_lower ? c + r->delta : c;
+    case kLower:
+      return is_lower ? c : c + r->delta;
+    case kEvenUpper:
+    case kOddUpper: {
+      bool is_upper = (c % 2 == 0) == (r->kind == kEvenUpper);
+      if (is_lower) return is_upper ? c + 1 : c;
+      return is_upper ? c : c - 1;
+    }
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+template <bool is_lower>
+int FastTwoByteConvert(uint16_t* dst, const uint16_t* src, int length,
+                       bool* changed_out) {
+  DisallowGarbageCollection no_gc;
+  bool changed = false;
+  const CaseRange* range = kCaseRanges;
+  for (int index = 0; index < length; ++index) {
+    uint16_t c = src[index];
+    uint16_t converted;
+    if (c < 0x80) {
+      // ASCII is common enough to skip the table.
+      constexpr char lo = is_lower ? 'A' : 'a';
+      converted = static_cast<unsigned>(c - lo) < 26 ? c ^ (1 << 5) : c;
+    } else {
+      int result = ConvertTwoByteCharacter<is_lower>(c, &range);
+      if (result < 0) return index;
+      converted = static_cast<uint16_t>(result);
+    }
+    changed |= converted != c;
+    dst[index] = converted;
+  }
+  *changed_out = changed;
+  return length;
+}
+
+template int FastTwoByteConvert<false>(uint16_t* dst, const uint16_t* src,
+                                       int length, bool* changed_out);
+template int FastTwoByteConvert<true>(uint16_t* dst, const uint16_t* src,
+                                      int length, bool* changed_out);
+
 }  // namespace internal
 }  // namespace v8
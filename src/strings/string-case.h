@@ -5,12 +5,33 @@
 #ifndef V8_STRINGS_STRING_CASE_H_
 #define V8_STRINGS_STRING_CASE_H_
 
+#include <cstdint>
+
 namespace v8 {
 namespace internal {
 
+// Converts the case of an ASCII string. Returns the index of the first
+// character that has not been converted because it (or a character near it)
+// is not ASCII, or length if all of them have been.
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length, bool* changed_out);
 
+// Returns the index of the first character of src that is not ASCII or that
+// FastAsciiConvert would change, or length if there is none. Callers use this
+// to return strings that are already in the right case without allocating.
+template <bool is_lower>
+int FindFirstAsciiToConvert(const char* src, int length);
+
+// Converts the case of a two-byte string as long as its characters have a
+// simple case mapping to one BMP character that does not depend on the
+// context or the locale, which is the case for most characters of the common
+// alphabetic scripts and for caseless scripts such as CJK. Returns the index
+// of the first character that needs the full Unicode case mapping, or length
+// if all of them have been converted.
+template <bool is_lower>
+int FastTwoByteConvert(uint16_t* dst, const uint16_t* src, int length,
+                       bool* changed_out);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -26,6 +26,24 @@ uint32_t StringHasher::AddCharacterCore(uint32_t running_hash, uint16_t c) {
   return running_hash;
 }
 
+template <typename uchar>
+uint32_t StringHasher::AddCharactersCore(uint32_t running_hash,
+                                         const uchar* chars, int length) {
+  // Every step of the hash depends on the previous one, so the best we can do
+  // is to keep the loop overhead off that dependency chain.
+  const uchar* end = chars + length;
+  for (; end - chars >= 4; chars += 4) {
+    running_hash = AddCharacterCore(running_hash, chars[0]);
+    running_hash = AddCharacterCore(running_hash, chars[1]);
+    running_hash = AddCharacterCore(running_hash, chars[2]);
+    running_hash = AddCharacterCore(running_hash, chars[3]);
+  }
+  for (; chars != end; ++chars) {
+    running_hash = AddCharacterCore(running_hash, *chars);
+  }
+  return running_hash;
+}
+
 uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   running_hash += (running_hash << 3);
   running_hash ^= (running_hash >> 11);
@@ -113,11 +131,8 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
+  uint32_t running_hash =
+      AddCharactersCore(static_cast<uint32_t>(seed), chars, length);
 
   return String::CreateHashFieldValue(GetHashCore(running_hash),
                                       String::HashFieldType::kHash);
@@ -37,6 +37,9 @@ class V8_EXPORT_PRIVATE StringHasher final {
 
   // Reusable parts of the hashing algorithm.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
+  template <typename uchar>
+  V8_INLINE static uint32_t AddCharactersCore(uint32_t running_hash,
+                                              const uchar* chars, int length);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
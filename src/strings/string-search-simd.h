@@ -0,0 +1,170 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SEARCH_SIMD_H_
+#define V8_STRINGS_STRING_SEARCH_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/macros.h"
+#include "src/base/strings.h"
+
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+// Compares blocks of characters with a character at once. ToBits returns
+// kBitsPerLane bits per lane, in the order of the characters.
+template <typename Char>
+struct StringSearchBlock;
+
+#if V8_HOST_HAS_SSE2
+
+template <>
+struct StringSearchBlock<uint8_t> {
+  using Vector = __m128i;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(uint8_t);
+  static constexpr int kBitsPerLane = 1;
+
+  static V8_INLINE Vector Splat(uint8_t c) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  }
+  static V8_INLINE Vector Equal(const uint8_t* chars, Vector c) {
+    Vector loaded = _mm_loadu_si128(reinterpret_cast<const Vector*>(chars));
+    return _mm_cmpeq_epi8(loaded, c);
+  }
+  static V8_INLINE Vector And(Vector a, Vector b) {
+    return _mm_and_si128(a, b);
+  }
+  static V8_INLINE uint64_t ToBits(Vector v) {
+    return static_cast<uint32_t>(_mm_movemask_epi8(v));
+  }
+};
+
+template <>
+struct StringSearchBlock<base::uc16> {
+  using Vector = __m128i;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(base::uc16);
+  static constexpr int kBitsPerLane = 1;
+
+  static V8_INLINE Vector Splat(base::uc16 c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static V8_INLINE Vector Equal(const base::uc16* chars, Vector c) {
+    Vector loaded = _mm_loadu_si128(reinterpret_cast<const Vector*>(chars));
+    return _mm_cmpeq_epi16(loaded, c);
+  }
+  static V8_INLINE Vector And(Vector a, Vector b) {
+    return _mm_and_si128(a, b);
+  }
+  static V8_INLINE uint64_t ToBits(Vector v) {
+    // Saturate the lanes to one byte each to get one mask bit per lane.
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_packs_epi16(v, _mm_setzero_si128())));
+  }
+};
+
+#elif V8_HOST_HAS_NEON
+
+template <>
+struct StringSearchBlock<uint8_t> {
+  using Vector = uint8x16_t;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(uint8_t);
+  static constexpr int kBitsPerLane = 4;
+
+  static V8_INLINE Vector Splat(uint8_t c) { return vdupq_n_u8(c); }
+  static V8_INLINE Vector Equal(const uint8_t* chars, Vector c) {
+    return vceqq_u8(vld1q_u8(chars), c);
+  }
+  static V8_INLINE Vector And(Vector a, Vector b) { return vandq_u8(a, b); }
+  static V8_INLINE uint64_t ToBits(Vector v) {
+    // Shift each 16-bit lane right by 4 and narrow it, which leaves four
+    // bits per byte lane.
+    return vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+  }
+};
+
+template <>
+struct StringSearchBlock<base::uc16> {
+  using Vector = uint16x8_t;
+  static constexpr int kLanes = sizeof(Vector) / sizeof(base::uc16);
+  static constexpr int kBitsPerLane = 8;
+
+  static V8_INLINE Vector Splat(base::uc16 c) { return vdupq_n_u16(c); }
+  static V8_INLINE Vector Equal(const base::uc16* chars, Vector c) {
+    return vceqq_u16(vld1q_u16(chars), c);
+  }
+  static V8_INLINE Vector And(Vector a, Vector b) { return vandq_u16(a, b); }
+  static V8_INLINE uint64_t ToBits(Vector v) {
+    return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(v)), 0);
+  }
+};
+
+#endif  // V8_HOST_HAS_SSE2
+
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+// Returns the first position p in [begin, end) at which p[0] == c, or end if
+// there is none.
+template <typename Char>
+V8_INLINE const Char* FindCharacterInBlocks(const Char* begin, const Char* end,
+                                            Char c) {
+  const Char* cursor = begin;
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  using B = StringSearchBlock<Char>;
+  const typename B::Vector splat = B::Splat(c);
+  for (; end - cursor >= B::kLanes; cursor += B::kLanes) {
+    uint64_t bits = B::ToBits(B::Equal(cursor, splat));
+    if (bits != 0) {
+      return cursor + base::bits::CountTrailingZeros(bits) / B::kBitsPerLane;
+    }
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  for (; cursor < end; ++cursor) {
+    if (*cursor == c) return cursor;
+  }
+  return end;
+}
+
+// Returns the first position p in [begin, end) at which p[0] == first and
+// p[distance] == last, or end if there is none. Checking the last character
+// of a pattern as well as its first one filters out most of the false
+// candidates of a first character search. Reads up to end[distance - 1].
+template <typename Char>
+V8_INLINE const Char* FindCharacterPairInBlocks(const Char* begin,
+                                                const Char* end, Char first,
+                                                Char last, int distance) {
+  const Char* cursor = begin;
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  using B = StringSearchBlock<Char>;
+  const typename B::Vector first_splat = B::Splat(first);
+  const typename B::Vector last_splat = B::Splat(last);
+  for (; end - cursor >= B::kLanes; cursor += B::kLanes) {
+    uint64_t bits = B::ToBits(B::And(B::Equal(cursor, first_splat),
+                                     B::Equal(cursor + distance, last_splat)));
+    if (bits != 0) {
+      return cursor + base::bits::CountTrailingZeros(bits) / B::kBitsPerLane;
+    }
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  for (; cursor < end; ++cursor) {
+    if (cursor[0] == first && cursor[distance] == last) return cursor;
+  }
+  return end;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SEARCH_SIMD_H_
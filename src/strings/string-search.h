@@ -8,6 +8,7 @@
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
+#include "src/strings/string-search-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -201,6 +202,17 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  if (sizeof(SubjectChar) == 2) {
+    // memchr can only look for one of the two bytes of a character, which
+    // finds many false candidates in two-byte strings.
+    const SubjectChar* end = subject.begin() + max_n;
+    const SubjectChar* found = FindCharacterInBlocks(
+        subject.begin() + index, end,
+        static_cast<SubjectChar>(pattern_first_char));
+    return found == end ? -1 : static_cast<int>(found - subject.begin());
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
   if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
     // Special-case looking for the 0 char in other than one-byte strings.
     // memchr mostly fails in this case due to every other byte being 0 in text
@@ -227,6 +239,26 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Returns the first index at or after |index| at which |pattern| may occur in
+// |subject|, or -1. With SIMD support, both the first and the last character
+// of the pattern are compared, which leaves few candidates to verify.
+template <typename PatternChar, typename SubjectChar>
+inline int FindCandidate(base::Vector<const PatternChar> pattern,
+                         base::Vector<const SubjectChar> subject, int index) {
+  DCHECK_GT(pattern.length(), 1);
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  const int distance = pattern.length() - 1;
+  const SubjectChar* end = subject.begin() + subject.length() - distance;
+  DCHECK_LE(subject.begin() + index, end);
+  const SubjectChar* found = FindCharacterPairInBlocks(
+      subject.begin() + index, end, static_cast<SubjectChar>(pattern[0]),
+      static_cast<SubjectChar>(pattern[distance]), distance);
+  return found == end ? -1 : static_cast<int>(found - subject.begin());
+#else
+  return FindFirstCharacter(pattern, subject, index);
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -274,7 +306,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindCandidate(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
@@ -509,7 +541,7 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindCandidate(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
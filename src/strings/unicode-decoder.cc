@@ -30,6 +30,11 @@ Utf8Decoder::Utf8Decoder(const base::Vector<const uint8_t>& chars)
       is_one_byte = is_one_byte && t <= unibrow::Latin1::kMaxChar;
       utf16_length_++;
       if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) utf16_length_++;
+      // Fast path for ascii sequences.
+      DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(end - cursor));
+      cursor += ascii_length;
+      utf16_length_ += ascii_length;
     }
   }
 
@@ -64,6 +69,12 @@ void Utf8Decoder::Decode(Char* out, const base::Vector<const uint8_t>& data) {
         *(out++) = unibrow::Utf16::LeadSurrogate(t);
         *(out++) = unibrow::Utf16::TrailSurrogate(t);
       }
+      // Fast path for ascii sequences.
+      DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
+      int ascii_length = NonAsciiStart(cursor, static_cast<int>(end - cursor));
+      CopyChars(out, cursor, ascii_length);
+      cursor += ascii_length;
+      out += ascii_length;
     }
   }
 
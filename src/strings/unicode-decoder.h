@@ -5,9 +5,17 @@
 #ifndef V8_STRINGS_UNICODE_DECODER_H_
 #define V8_STRINGS_UNICODE_DECODER_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/base/vector.h"
 #include "src/strings/unicode.h"
 
+#if V8_HOST_HAS_SSE2
+#include <emmintrin.h>
+#elif V8_HOST_HAS_NEON
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -19,7 +27,35 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
-  if (static_cast<size_t>(length) >= kIntptrSize) {
+#if V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+  // Check blocks of 32 bytes, leaving the rest to the word-wise checks.
+  constexpr int kBlockSize = 32;
+  while (limit - chars >= kBlockSize) {
+#if V8_HOST_HAS_SSE2
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 16));
+    // The mask has the top bit of each byte.
+    int mask = _mm_movemask_epi8(_mm_or_si128(lo, hi));
+    if (mask != 0) {
+      mask = _mm_movemask_epi8(lo);
+      if (mask == 0) {
+        mask = _mm_movemask_epi8(hi);
+        chars += 16;
+      }
+      return static_cast<int>(chars - start) +
+             base::bits::CountTrailingZeros(static_cast<uint32_t>(mask));
+    }
+#else
+    uint8x16_t lo = vld1q_u8(chars);
+    uint8x16_t hi = vld1q_u8(chars + 16);
+    // Let the word-wise checks below find the exact position.
+    if (vmaxvq_u8(vorrq_u8(lo, hi)) > unibrow::Utf8::kMaxOneByteChar) break;
+#endif
+    chars += kBlockSize;
+  }
+#endif  // V8_HOST_HAS_SSE2 || V8_HOST_HAS_NEON
+
+  if (static_cast<size_t>(limit - chars) >= kIntptrSize) {
     // Check unaligned bytes.
     while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
       if (*chars > unibrow::Utf8::kMaxOneByteChar) {
@@ -769,13 +769,23 @@ void LiftoffAssembler::MergeFullStackWith(CacheState& target,
                                             source.stack_height() - i - 1)));
   }
 
-  // Full stack merging is only done for forward jumps, so we can just clear the
-  // cache registers at the target in case of mismatch.
-  if (source.cached_instance != target.cached_instance) {
-    target.ClearCachedInstanceRegister();
-  }
-  if (source.cached_mem_start != target.cached_mem_start) {
-    target.ClearCachedMemStartRegister();
+  // Full stack merging is only done for forward jumps. If the source holds a
+  // cached value in another register, move it as part of the stack transfers
+  // to keep it live at the target. Otherwise clear the cache register at the
+  // target.
+  for (auto pair : {std::make_pair(source.cached_instance,
+                                   &target.cached_instance),
+                    std::make_pair(source.cached_mem_start,
+                                   &target.cached_mem_start)}) {
+    Register src_reg = pair.first;
+    Register* dst_reg = pair.second;
+    if (src_reg == *dst_reg || *dst_reg == no_reg) continue;
+    if (src_reg == no_reg) {
+      target.ClearCacheRegister(dst_reg);
+    } else {
+      transfers.MoveRegister(LiftoffRegister{*dst_reg},
+                             LiftoffRegister{src_reg}, kPointerKind);
+    }
   }
 }
 
@@ -830,14 +840,15 @@ void LiftoffAssembler::MergeStackWith(CacheState& target, uint32_t arity,
     // If the registers match, or the destination has no cache register, nothing
     // needs to be done.
     if (src_reg == *dst_reg || *dst_reg == no_reg) continue;
-    // On forward jumps, just reset the cached register in the target state.
-    if (jump_direction == kForwardJump) {
-      target.ClearCacheRegister(dst_reg);
-    } else if (src_reg != no_reg) {
+    if (src_reg != no_reg) {
       // If the source has the content but in the wrong register, execute a
       // register move as part of the stack transfer.
       transfers.MoveRegister(LiftoffRegister{*dst_reg},
                              LiftoffRegister{src_reg}, kPointerKind);
+    } else if (jump_direction == kForwardJump) {
+      // On forward jumps without the content, just reset the cached register
+      // in the target state.
+      target.ClearCacheRegister(dst_reg);
     } else {
       // Otherwise (the source state has no cached content), we reload later.
       *reload = true;
@@ -891,6 +902,29 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::PrepareLoopLocals() {
+  // Only keep up to half of the cache registers for locals, so the loop body
+  // is left with enough registers for its temporaries.
+  constexpr unsigned kMaxGpLocalRegs = kLiftoffAssemblerGpCacheRegs.Count() / 2;
+  constexpr unsigned kMaxFpLocalRegs = kLiftoffAssemblerFpCacheRegs.Count() / 2;
+  LiftoffRegList kept_regs;
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState* slot = &cache_state_.stack_state[i];
+    // Constants cannot be restored on the back-edge. Registers used more than
+    // once (by another local or a stack value) would be clobbered if the loop
+    // body assigns the local.
+    if (slot->is_reg() && cache_state_.get_use_count(slot->reg()) == 1) {
+      LiftoffRegList new_kept_regs = kept_regs | LiftoffRegList{slot->reg()};
+      if (new_kept_regs.GetGpList().Count() <= kMaxGpLocalRegs &&
+          new_kept_regs.GetFpList().Count() <= kMaxFpLocalRegs) {
+        kept_regs = new_kept_regs;
+        continue;
+      }
+    }
+    Spill(slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
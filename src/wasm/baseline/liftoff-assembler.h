@@ -617,6 +617,9 @@ class LiftoffAssembler : public TurboAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Prepare the locals for a loop header: Each local either stays in a
+  // register that is not used by any other value, or gets spilled.
+  void PrepareLoopLocals();
   void SpillAllRegisters();
 
   // Clear any uses of {reg} in both the cache and in {possible_uses}.
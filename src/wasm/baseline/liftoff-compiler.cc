@@ -1163,12 +1163,17 @@ class LiftoffCompiler {
   void Block(FullDecoder* decoder, Control* block) { PushControl(block); }
 
   void Loop(FullDecoder* decoder, Control* loop) {
-    // Before entering a loop, spill all locals to the stack, in order to free
-    // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
+    // Before entering a loop, keep locals in registers if they are not shared
+    // with other values and register pressure allows; this avoids spilling
+    // and reloading them on every iteration. Spill the remaining locals to
+    // free the cache registers. Debug code keeps spilling all locals.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (for_debugging_ == kNoDebugging) {
+      __ PrepareLoopLocals();
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -2808,13 +2813,22 @@ class LiftoffCompiler {
     }
 
     // Early return for trap handler.
-    DCHECK_IMPLIES(env_->module->is_memory64,
-                   env_->bounds_checks == kExplicitBoundsChecks);
     if (!force_check && !statically_oob &&
         env_->bounds_checks == kTrapHandler) {
       // With trap handlers we should not have a register pair as input (we
       // would only return the lower half).
       DCHECK(index.is_gp());
+      if (env_->module->is_memory64) {
+        // The guard regions only cover 32-bit indexes, so the upper half of a
+        // 64-bit index must be zero.
+        CODE_COMMENT("bounds check memory64 index high word");
+        Label* trap_label = AddOutOfLineTrap(
+            decoder, WasmCode::kThrowWasmTrapMemOutOfBounds, 0);
+        LiftoffRegister high_word =
+            __ GetUnusedRegister(kGpReg, pinned | LiftoffRegList{index});
+        __ emit_i64_shri(high_word, index, 32);
+        __ emit_cond_jump(kNotEqualZero, trap_label, kI32, high_word.gp());
+      }
       return index_ptrsize;
     }
 
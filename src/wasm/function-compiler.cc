@@ -18,6 +18,7 @@
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-import-wrapper-cache.h"
 
 namespace v8 {
 namespace internal {
@@ -63,7 +64,7 @@ WasmCompilationResult WasmCompilationUnit::ExecuteImportWrapperCompilation(
   // instantiation time.
   auto kind = compiler::kDefaultImportCallKind;
   bool source_positions = is_asmjs_module(env->module);
-  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
+  WasmCompilationResult result = SharedImportWrapperCache::CompileWrapper(
       env, kind, sig, source_positions,
       static_cast<int>(sig->parameter_count()), wasm::kNoSuspend);
   return result;
@@ -148,8 +148,11 @@ class V8_EXPORT_PRIVATE JumpTableAssembler : public MacroAssembler {
     FlushInstructionCache(base, table_size);
   }
 
-  static void PatchJumpTableSlot(Address jump_table_slot,
-                                 Address far_jump_table_slot, Address target) {
+  // Callers passing {SKIP_ICACHE_FLUSH} must flush the instruction cache for
+  // the slot themselves, e.g. together with adjacent slots.
+  static void PatchJumpTableSlot(
+      Address jump_table_slot, Address far_jump_table_slot, Address target,
+      ICacheFlushMode icache_flush_mode = FLUSH_ICACHE_IF_NEEDED) {
     // First, try to patch the jump table slot.
     JumpTableAssembler jtasm(jump_table_slot);
     if (!jtasm.EmitJumpSlot(target)) {
@@ -160,7 +163,9 @@ class V8_EXPORT_PRIVATE JumpTableAssembler : public MacroAssembler {
       CHECK(jtasm.EmitJumpSlot(far_jump_table_slot));
     }
     jtasm.NopBytes(kJumpTableSlotSize - jtasm.pc_offset());
-    FlushInstructionCache(jump_table_slot, kJumpTableSlotSize);
+    if (icache_flush_mode != SKIP_ICACHE_FLUSH) {
+      FlushInstructionCache(jump_table_slot, kJumpTableSlotSize);
+    }
   }
 
  private:
@@ -28,6 +28,7 @@
 #include "src/wasm/assembler-buffer-cache.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
@@ -1767,6 +1768,30 @@ std::unique_ptr<CompilationUnitBuilder> InitializeCompilation(
   return builder;
 }
 
+// Schedules TurboFan compilation of the functions that the tiering profile of
+// a previous run recorded as hot, alongside baseline compilation. The restored
+// tier-up priorities keep {TriggerTierUp} from compiling them again.
+void TierUpHotFunctionsFromProfile(NativeModule* native_module) {
+  if (!FLAG_experimental_wasm_pgo_from_file) return;
+  const WasmModule* module = native_module->module();
+  CompilationStateImpl* compilation_state =
+      Impl(native_module->compilation_state());
+  if (module->origin != kWasmOrigin || !compilation_state->dynamic_tiering() ||
+      native_module->IsTieredDown()) {
+    return;
+  }
+  std::unique_ptr<ProfileInformation> profile =
+      LoadTieringProfileFromFile(module, native_module->wire_bytes());
+  if (!profile) return;
+  for (const ProfileInformation::HotFunction& hot_function :
+       profile->hot_functions()) {
+    WasmCompilationUnit tiering_unit{static_cast<int>(hot_function.func_index),
+                                     ExecutionTier::kTurbofan, kNoDebugging};
+    compilation_state->AddTopTierPriorityCompilationUnit(
+        tiering_unit, hot_function.tierup_priority);
+  }
+}
+
 bool MayCompriseLazyFunctions(const WasmModule* module,
                               const WasmFeatures& enabled_features,
                               bool lazy_module) {
@@ -1906,6 +1931,7 @@ void CompileNativeModule(Isolate* isolate,
   std::unique_ptr<CompilationUnitBuilder> builder =
       InitializeCompilation(isolate, native_module.get());
   compilation_state->InitializeCompilationUnits(std::move(builder));
+  TierUpHotFunctionsFromProfile(native_module.get());
 
   compilation_state->WaitForCompilationEvent(
       CompilationEvent::kFinishedExportWrappers);
@@ -1975,8 +2001,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
     v8::metrics::Recorder::ContextId context_id) {
   const WasmModule* wasm_module = module.get();
   WasmEngine* engine = GetWasmEngine();
-  base::OwnedVector<uint8_t> wire_bytes_copy =
-      base::OwnedVector<uint8_t>::Of(wire_bytes.module_bytes());
+  base::OwnedVector<const uint8_t> wire_bytes_copy =
+      base::OwnedVector<const uint8_t>::Of(wire_bytes.module_bytes());
   // Prefer {wire_bytes_copy} to {wire_bytes.module_bytes()} for the temporary
   // cache key. When we eventually install the module in the cache, the wire
   // bytes of the temporary key and the new key have the same base pointer and
@@ -1989,6 +2015,17 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
     return native_module;
   }
 
+  native_module =
+      DeserializeFromCodeCache(isolate, enabled, module, &wire_bytes_copy);
+  if (native_module) {
+    native_module->compilation_state()->set_compilation_id(compilation_id);
+    engine->UpdateNativeModuleCache(false, &native_module, isolate);
+    StoreInCodeCacheAfterTierUp(native_module);
+    CompileJsToWasmWrappers(isolate, wasm_module, export_wrappers_out);
+    engine->LogOutstandingCodesForIsolate(isolate);
+    return native_module;
+  }
+
   TimedHistogramScope wasm_compile_module_time_scope(SELECT_WASM_COUNTER(
       isolate->counters(), wasm_module->origin, wasm_compile, module_time));
 
@@ -2021,6 +2058,8 @@ std::shared_ptr<NativeModule> CompileToNativeModule(
     return native_module;
   }
 
+  StoreInCodeCacheAfterTierUp(native_module);
+
   // Ensure that the code objects are logged before returning.
   engine->LogOutstandingCodesForIsolate(isolate);
 
@@ -2106,11 +2145,170 @@ void AsyncCompileJob::Abort() {
   GetWasmEngine()->RemoveCompileJob(this);
 }
 
+// Validates the bodies of functions that are not compiled eagerly on
+// background threads while the module is still streaming in. Functions are
+// submitted in batches, and the main thread only waits for validation when the
+// stream finished or a validation error was found.
+class StreamingValidator {
+ public:
+  StreamingValidator(std::shared_ptr<const WasmModule> module,
+                     const WasmFeatures& enabled_features,
+                     std::shared_ptr<WireBytesStorage> wire_bytes_storage)
+      : state_(std::make_shared<State>(std::move(module), enabled_features,
+                                       std::move(wire_bytes_storage))) {}
+
+  ~StreamingValidator() { Cancel(); }
+
+  // {code} has to stay valid as long as the wire bytes storage does.
+  void AddFunction(int func_index, base::Vector<const uint8_t> code) {
+    batch_.push_back({func_index, code});
+    batch_size_ += code.size();
+    if (batch_size_ >= kMaxBatchSize) Flush();
+  }
+
+  // Submits all functions added so far for validation.
+  void Flush() {
+    if (batch_.empty()) return;
+    if (FLAG_wasm_num_compilation_tasks == 0) {
+      // Without background threads, validate right away.
+      ValidateBatch(state_.get(), batch_);
+      batch_.clear();
+      batch_size_ = 0;
+      return;
+    }
+    {
+      base::MutexGuard guard(&state_->mutex);
+      state_->batches.emplace_back(std::move(batch_));
+      state_->num_batches.store(state_->batches.size(),
+                                std::memory_order_relaxed);
+    }
+    batch_.clear();
+    batch_size_ = 0;
+    if (job_handle_) {
+      job_handle_->NotifyConcurrencyIncrease();
+    } else {
+      job_handle_ = V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserVisible, std::make_unique<ValidationJob>(state_));
+    }
+  }
+
+  bool has_error() const {
+    return state_->has_error.load(std::memory_order_relaxed);
+  }
+
+  // Validates all remaining functions, and returns the error of the invalid
+  // function with the lowest index, if any. This is the error that validating
+  // functions one by one in order of arrival would have reported.
+  WasmError Finish() {
+    Flush();
+    if (job_handle_) {
+      job_handle_->Join();
+      job_handle_.reset();
+    }
+    base::MutexGuard guard(&state_->mutex);
+    DCHECK(state_->batches.empty());
+    return state_->error;
+  }
+
+  void Cancel() {
+    if (!job_handle_) return;
+    job_handle_->Cancel();
+    job_handle_.reset();
+  }
+
+ private:
+  // Flush after this many bytes of function bodies, so that the work is split
+  // into reasonably sized tasks even if the embedder passes huge chunks.
+  static constexpr size_t kMaxBatchSize = 64 * KB;
+
+  struct Function {
+    int func_index;
+    base::Vector<const uint8_t> code;
+  };
+
+  // Shared with the background job, which can outlive the validator if it is
+  // cancelled.
+  struct State {
+    State(std::shared_ptr<const WasmModule> module,
+          const WasmFeatures& enabled_features,
+          std::shared_ptr<WireBytesStorage> wire_bytes_storage)
+        : module(std::move(module)),
+          enabled_features(enabled_features),
+          wire_bytes_storage(std::move(wire_bytes_storage)) {}
+
+    const std::shared_ptr<const WasmModule> module;
+    const WasmFeatures enabled_features;
+    // Keeps the submitted function bodies alive.
+    const std::shared_ptr<WireBytesStorage> wire_bytes_storage;
+    std::atomic<size_t> num_batches{0};
+    std::atomic<bool> has_error{false};
+
+    base::Mutex mutex;
+    // Protected by {mutex}:
+    std::vector<std::vector<Function>> batches;
+    int error_func_index = kMaxInt;
+    WasmError error;
+  };
+
+  static void ValidateBatch(State* state, const std::vector<Function>& batch) {
+    AccountingAllocator* allocator = GetWasmEngine()->allocator();
+    for (const Function& function : batch) {
+      // Every validation uses its own zone.
+      DecodeResult result = ValidateSingleFunction(
+          state->module.get(), function.func_index, function.code, allocator,
+          state->enabled_features);
+      if (result.ok()) continue;
+      base::MutexGuard guard(&state->mutex);
+      if (function.func_index < state->error_func_index) {
+        state->error_func_index = function.func_index;
+        state->error = result.error();
+      }
+      state->has_error.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  class ValidationJob final : public JobTask {
+   public:
+    explicit ValidationJob(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    void Run(JobDelegate* delegate) override {
+      TRACE_EVENT0("v8.wasm", "wasm.StreamingValidation");
+      while (!delegate->ShouldYield()) {
+        std::vector<Function> batch;
+        {
+          base::MutexGuard guard(&state_->mutex);
+          if (state_->batches.empty()) return;
+          batch = std::move(state_->batches.back());
+          state_->batches.pop_back();
+          state_->num_batches.store(state_->batches.size(),
+                                    std::memory_order_relaxed);
+        }
+        ValidateBatch(state_.get(), batch);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t worker_count) const override {
+      return std::min(
+          static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+          worker_count +
+              state_->num_batches.load(std::memory_order_relaxed));
+    }
+
+   private:
+    const std::shared_ptr<State> state_;
+  };
+
+  const std::shared_ptr<State> state_;
+  std::unique_ptr<JobHandle> job_handle_;
+  std::vector<Function> batch_;
+  size_t batch_size_ = 0;
+};
+
 class AsyncStreamingProcessor final : public StreamingProcessor {
  public:
-  explicit AsyncStreamingProcessor(AsyncCompileJob* job,
-                                   std::shared_ptr<Counters> counters,
-                                   AccountingAllocator* allocator);
+  AsyncStreamingProcessor(AsyncCompileJob* job,
+                          std::shared_ptr<Counters> counters);
 
   ~AsyncStreamingProcessor() override;
 
@@ -2154,7 +2352,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
   std::shared_ptr<Counters> async_counters_;
-  AccountingAllocator* allocator_;
+  // Validates lazily compiled functions unless {--wasm-lazy-validation} is
+  // set. Created when the code section starts.
+  std::unique_ptr<StreamingValidator> validator_;
 
   // Running hash of the wire bytes up to code section size, but excluding the
   // code section itself. Used by the {NativeModuleCache} to detect potential
@@ -2165,8 +2365,8 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 std::shared_ptr<StreamingDecoder> AsyncCompileJob::CreateStreamingDecoder() {
   DCHECK_NULL(stream_);
   stream_ = StreamingDecoder::CreateAsyncStreamingDecoder(
-      std::make_unique<AsyncStreamingProcessor>(
-          this, isolate_->async_counters(), isolate_->allocator()));
+      std::make_unique<AsyncStreamingProcessor>(this,
+                                                isolate_->async_counters()));
   return stream_;
 }
 
@@ -2212,13 +2412,24 @@ void AsyncCompileJob::CreateNativeModule(
 
 bool AsyncCompileJob::GetOrCreateNativeModule(
     std::shared_ptr<const WasmModule> module, size_t code_size_estimate) {
-  native_module_ = GetWasmEngine()->MaybeGetNativeModule(
+  WasmEngine* engine = GetWasmEngine();
+  native_module_ = engine->MaybeGetNativeModule(
       module->origin, wire_bytes_.module_bytes(), isolate_);
-  if (native_module_ == nullptr) {
-    CreateNativeModule(std::move(module), code_size_estimate);
-    return false;
+  if (native_module_) return true;
+
+  base::OwnedVector<const uint8_t> bytes_copy{std::move(bytes_copy_),
+                                              wire_bytes_.length()};
+  native_module_ = DeserializeFromCodeCache(isolate_, enabled_features_,
+                                            module, &bytes_copy);
+  bytes_copy_ = bytes_copy.ReleaseData();
+  if (native_module_) {
+    native_module_->compilation_state()->set_compilation_id(compilation_id_);
+    engine->UpdateNativeModuleCache(false, &native_module_, isolate_);
+    StoreInCodeCacheAfterTierUp(native_module_);
+    return true;
   }
-  return true;
+  CreateNativeModule(std::move(module), code_size_estimate);
+  return false;
 }
 
 void AsyncCompileJob::PrepareRuntimeObjects() {
@@ -2682,6 +2893,7 @@ class AsyncCompileJob::PrepareAndStartCompile : public CompileStep {
       std::unique_ptr<CompilationUnitBuilder> builder =
           InitializeCompilation(job->isolate(), job->native_module_.get());
       compilation_state->InitializeCompilationUnits(std::move(builder));
+      TierUpHotFunctionsFromProfile(job->native_module_.get());
       // We are in single-threaded mode, so there are no worker tasks that will
       // do the compilation. We call {WaitForCompilationEvent} here so that the
       // main thread paticipates and finishes the compilation.
@@ -2752,6 +2964,7 @@ class AsyncCompileJob::CompileFinished : public CompileStep {
       // finished. This callback will *not* keep the NativeModule alive.
       job->native_module_->compilation_state()->AddCallback(
           std::make_unique<SampleTopTierCodeSizeCallback>(job->native_module_));
+      StoreInCodeCacheAfterTierUp(job->native_module_);
     }
     // Then finalize and publish the generated module.
     job->FinishCompile(cached_native_module_ != nullptr);
@@ -2767,13 +2980,11 @@ void AsyncCompileJob::FinishModule() {
 }
 
 AsyncStreamingProcessor::AsyncStreamingProcessor(
-    AsyncCompileJob* job, std::shared_ptr<Counters> async_counters,
-    AccountingAllocator* allocator)
+    AsyncCompileJob* job, std::shared_ptr<Counters> async_counters)
     : decoder_(job->enabled_features_),
       job_(job),
       compilation_unit_builder_(nullptr),
-      async_counters_(async_counters),
-      allocator_(allocator) {}
+      async_counters_(async_counters) {}
 
 AsyncStreamingProcessor::~AsyncStreamingProcessor() {
   if (job_->native_module_ && job_->native_module_->wire_bytes().empty()) {
@@ -2788,6 +2999,7 @@ void AsyncStreamingProcessor::FinishAsyncCompileJobWithError(
   // Make sure all background tasks stopped executing before we change the state
   // of the AsyncCompileJob to DecodeFail.
   job_->background_task_manager_.CancelAndWait();
+  if (validator_) validator_->Cancel();
 
   // Record event metrics.
   auto duration = base::TimeTicks::Now() - job_->start_time_;
@@ -2891,6 +3103,10 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
 
   decoder_.set_code_section(code_section_start,
                             static_cast<uint32_t>(code_section_length));
+  if (!FLAG_wasm_lazy_validation) {
+    validator_ = std::make_unique<StreamingValidator>(
+        decoder_.shared_module(), job_->enabled_features_, wire_bytes_storage);
+  }
 
   prefix_hash_ = base::hash_combine(prefix_hash_,
                                     static_cast<uint32_t>(code_section_length));
@@ -2947,12 +3163,11 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
        strategy == CompileStrategy::kLazyBaselineEagerTopTier);
   if (validate_lazily_compiled_function) {
     // The native module does not own the wire bytes until {SetWireBytes} is
-    // called in {OnFinishedStream}. Validation must use {bytes} parameter.
-    DecodeResult result = ValidateSingleFunction(module, func_index, bytes,
-                                                 allocator_, enabled_features);
-
-    if (result.failed()) {
-      FinishAsyncCompileJobWithError(result.error());
+    // called in {OnFinishedStream}. Validation must use {bytes}, which the
+    // validator keeps alive via the wire bytes storage.
+    validator_->AddFunction(func_index, bytes);
+    if (validator_->has_error()) {
+      FinishAsyncCompileJobWithError(validator_->Finish());
       return false;
     }
   }
@@ -2979,6 +3194,7 @@ void AsyncStreamingProcessor::CommitCompilationUnits() {
 void AsyncStreamingProcessor::OnFinishedChunk() {
   TRACE_STREAMING("FinishChunk...\n");
   if (compilation_unit_builder_) CommitCompilationUnits();
+  if (validator_) validator_->Flush();
 }
 
 // Finish the processing of the stream.
@@ -2986,6 +3202,13 @@ void AsyncStreamingProcessor::OnFinishedStream(
     base::OwnedVector<uint8_t> bytes) {
   TRACE_STREAMING("Finish stream...\n");
   DCHECK_EQ(NativeModuleCache::PrefixHash(bytes.as_vector()), prefix_hash_);
+  if (validator_) {
+    WasmError error = validator_->Finish();
+    if (error.has_error()) {
+      FinishAsyncCompileJobWithError(error);
+      return;
+    }
+  }
   ModuleResult result = decoder_.FinishDecoding(false);
   if (result.failed()) {
     FinishAsyncCompileJobWithError(result.error());
@@ -3040,6 +3263,8 @@ void AsyncStreamingProcessor::OnFinishedStream(
   } else {
     job_->native_module_->SetWireBytes(
         {std::move(job_->bytes_copy_), job_->wire_bytes_.length()});
+    // The profile is keyed by the wire bytes, which are only complete now.
+    TierUpHotFunctionsFromProfile(job_->native_module_.get());
   }
   const bool needs_finish = job_->DecrementAndCheckFinisherCount();
   DCHECK_IMPLIES(!has_code_section, needs_finish);
@@ -4016,7 +4241,7 @@ WasmCode* CompileImportWrapper(
   // Keep the {WasmCode} alive until we explicitly call {IncRef}.
   WasmCodeRefScope code_ref_scope;
   CompilationEnv env = native_module->CreateCompilationEnv();
-  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
+  WasmCompilationResult result = SharedImportWrapperCache::CompileWrapper(
       &env, kind, sig, source_positions, expected_arity, suspend);
   WasmCode* published_code;
   {
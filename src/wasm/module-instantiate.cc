@@ -14,6 +14,7 @@
 #include "src/objects/descriptor-array-inl.h"
 #include "src/objects/property-descriptor.h"
 #include "src/tracing/trace-event.h"
+#include "src/utils/allocation.h"
 #include "src/utils/utils.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/init-expr-interface.h"
@@ -43,6 +44,26 @@ byte* raw_buffer_ptr(MaybeHandle<JSArrayBuffer> buffer, int offset) {
   return static_cast<byte*>(buffer.ToHandleChecked()->backing_store()) + offset;
 }
 
+// Copies {source} to {dest}, which is known to be zero-initialized. Pages of
+// {dest} which would only receive zeros are not written, so that they do not
+// get committed before the program uses them.
+void CopyToZeroedMemory(byte* dest, base::Vector<const byte> source) {
+  const uintptr_t page_size = CommitPageSize();
+  size_t offset = 0;
+  while (offset < source.size()) {
+    // Copy up to the next page boundary of {dest}.
+    uintptr_t address = reinterpret_cast<uintptr_t>(dest + offset);
+    size_t chunk_size = std::min(
+        source.size() - offset,
+        static_cast<size_t>(RoundUp(address + 1, page_size) - address));
+    const byte* chunk = source.begin() + offset;
+    if (std::any_of(chunk, chunk + chunk_size, [](byte b) { return b != 0; })) {
+      std::memcpy(dest + offset, chunk, chunk_size);
+    }
+    offset += chunk_size;
+  }
+}
+
 using ImportWrapperQueue = WrapperQueue<WasmImportWrapperCache::CacheKey,
                                         WasmImportWrapperCache::CacheKeyHash>;
 
@@ -295,6 +316,9 @@ class InstanceBuilder {
   MaybeHandle<JSReceiver> ffi_;
   MaybeHandle<JSArrayBuffer> memory_buffer_;
   Handle<WasmMemoryObject> memory_object_;
+  // Whether the memory was allocated by this instantiation, and hence is still
+  // zero-initialized when loading data segments.
+  bool memory_is_fresh_ = false;
   Handle<JSArrayBuffer> untagged_globals_;
   Handle<FixedArray> tagged_globals_;
   std::vector<Handle<WasmTagObject>> tags_wrappers_;
@@ -999,6 +1023,9 @@ MaybeHandle<Object> InstanceBuilder::LookupImportAsm(
 void InstanceBuilder::LoadDataSegments(Handle<WasmInstanceObject> instance) {
   base::Vector<const uint8_t> wire_bytes =
       module_object_->native_module()->wire_bytes();
+  // The end of the memory written by previous segments. Memory beyond it is
+  // still zero if the memory is fresh.
+  size_t written_end = 0;
   for (const WasmDataSegment& segment : module_->data_segments) {
     uint32_t size = segment.source.length();
 
@@ -1030,8 +1057,14 @@ void InstanceBuilder::LoadDataSegments(Handle<WasmInstanceObject> instance) {
       return;
     }
 
-    std::memcpy(instance->memory_start() + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    base::Vector<const uint8_t> source = wire_bytes.SubVector(
+        segment.source.offset(), segment.source.end_offset());
+    if (memory_is_fresh_ && dest_offset >= written_end) {
+      CopyToZeroedMemory(instance->memory_start() + dest_offset, source);
+    } else {
+      std::memcpy(instance->memory_start() + dest_offset, source.begin(), size);
+    }
+    written_end = std::max(written_end, dest_offset + size);
   }
 }
 
@@ -1749,6 +1782,7 @@ bool InstanceBuilder::AllocateMemory() {
   }
   memory_buffer_ =
       Handle<JSArrayBuffer>(memory_object_->array_buffer(), isolate_);
+  memory_is_fresh_ = true;
   return true;
 }
 
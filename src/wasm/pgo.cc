@@ -0,0 +1,161 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include "src/base/strings.h"
+#include "src/utils/utils.h"
+#include "src/wasm/decoder.h"
+#include "src/wasm/wasm-engine.h"
+#include "src/wasm/wasm-module-builder.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+// Bump this whenever the format below changes. Profiles are encoded as LEBs:
+//   version, number of declared functions, number of hot functions,
+//   for each hot function:
+//     function index, tier-up priority,
+//     number of call positions, [position, call index]...,
+//     number of call sites, [target function index, call count]...
+constexpr uint32_t kProfileFormatVersion = 1;
+
+std::string ProfileFileName(base::Vector<const uint8_t> wire_bytes) {
+  base::EmbeddedVector<char, 32> filename;
+  base::SNPrintF(filename, "profile-wasm-%08zx",
+           NativeModuleCache::WireBytesHash(wire_bytes));
+  return filename.begin();
+}
+
+}  // namespace
+
+base::OwnedVector<uint8_t> SerializeTieringProfile(const WasmModule* module) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  buffer.write_u32v(kProfileFormatVersion);
+  buffer.write_u32v(module->num_declared_functions);
+
+  TypeFeedbackStorage& type_feedback = module->type_feedback;
+  base::MutexGuard mutex_guard(&type_feedback.mutex);
+  std::vector<uint32_t> hot_functions;
+  for (const auto& entry : type_feedback.feedback_for_function) {
+    if (entry.second.tierup_priority > 0) hot_functions.push_back(entry.first);
+  }
+  buffer.write_u32v(static_cast<uint32_t>(hot_functions.size()));
+  for (uint32_t func_index : hot_functions) {
+    const FunctionTypeFeedback& feedback =
+        type_feedback.feedback_for_function.at(func_index);
+    buffer.write_u32v(func_index);
+    buffer.write_u32v(feedback.tierup_priority);
+    buffer.write_u32v(static_cast<uint32_t>(feedback.positions.size()));
+    for (const auto& position : feedback.positions) {
+      buffer.write_u32v(position.first);
+      buffer.write_u32v(position.second);
+    }
+    buffer.write_u32v(static_cast<uint32_t>(feedback.feedback_vector.size()));
+    for (const CallSiteFeedback& call_site : feedback.feedback_vector) {
+      buffer.write_i32v(call_site.function_index);
+      buffer.write_i32v(call_site.absolute_call_frequency);
+    }
+  }
+  return base::OwnedVector<uint8_t>::Of(
+      base::VectorOf(buffer.begin(), buffer.size()));
+}
+
+std::unique_ptr<ProfileInformation> DeserializeTieringProfile(
+    const WasmModule* module, base::Vector<const uint8_t> profile) {
+  Decoder decoder(profile);
+  if (decoder.consume_u32v("version") != kProfileFormatVersion) return {};
+  if (decoder.consume_u32v("functions") != module->num_declared_functions) {
+    return {};
+  }
+  const uint32_t start = module->num_imported_functions;
+  const uint32_t end = start + module->num_declared_functions;
+  auto is_declared_function = [=](uint32_t func_index) {
+    return func_index >= start && func_index < end;
+  };
+
+  // Decode everything before touching the module, so that malformed profiles
+  // do not leave partial feedback behind.
+  std::vector<ProfileInformation::HotFunction> hot_functions;
+  std::vector<FunctionTypeFeedback> feedbacks;
+  uint32_t num_hot_functions = decoder.consume_u32v("hot functions");
+  for (uint32_t i = 0; i < num_hot_functions && decoder.ok(); ++i) {
+    uint32_t func_index = decoder.consume_u32v("function index");
+    int tierup_priority =
+        static_cast<int>(decoder.consume_u32v("tier-up priority"));
+    if (!is_declared_function(func_index) || tierup_priority <= 0 ||
+        (!hot_functions.empty() &&
+         hot_functions.back().func_index >= func_index)) {
+      return {};
+    }
+    FunctionTypeFeedback feedback;
+    feedback.tierup_priority = tierup_priority;
+    uint32_t num_positions = decoder.consume_u32v("positions");
+    for (uint32_t j = 0; j < num_positions && decoder.ok(); ++j) {
+      uint32_t position = decoder.consume_u32v("position");
+      uint32_t call_index = decoder.consume_u32v("call index");
+      if (call_index >= num_positions) return {};
+      feedback.positions[position] = static_cast<int>(call_index);
+    }
+    uint32_t num_call_sites = decoder.consume_u32v("call sites");
+    if (num_call_sites != 0 && num_call_sites != num_positions) return {};
+    for (uint32_t j = 0; j < num_call_sites && decoder.ok(); ++j) {
+      int target = decoder.consume_i32v("target");
+      int count = decoder.consume_i32v("count");
+      if (target != -1 && !is_declared_function(target)) return {};
+      feedback.feedback_vector.push_back({target, count});
+    }
+    hot_functions.push_back({func_index, tierup_priority});
+    feedbacks.push_back(std::move(feedback));
+  }
+  if (!decoder.ok() || decoder.more()) return {};
+
+  TypeFeedbackStorage& type_feedback = module->type_feedback;
+  base::MutexGuard mutex_guard(&type_feedback.mutex);
+  for (size_t i = 0; i < hot_functions.size(); ++i) {
+    FunctionTypeFeedback& existing =
+        type_feedback.feedback_for_function[hot_functions[i].func_index];
+    // Feedback collected in this process takes precedence.
+    if (existing.tierup_priority > 0) continue;
+    existing = std::move(feedbacks[i]);
+  }
+  return std::make_unique<ProfileInformation>(std::move(hot_functions));
+}
+
+void DumpTieringProfileToFile(const WasmModule* module,
+                              base::Vector<const uint8_t> wire_bytes) {
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module);
+  std::string filename = ProfileFileName(wire_bytes);
+  if (FLAG_trace_wasm_compiler) {
+    PrintF("Dumping Wasm tiering profile to %s (%zu bytes)\n",
+           filename.c_str(), profile.size());
+  }
+  WriteBytes(filename.c_str(), profile.begin(),
+             static_cast<int>(profile.size()), false);
+}
+
+std::unique_ptr<ProfileInformation> LoadTieringProfileFromFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes) {
+  std::string filename = ProfileFileName(wire_bytes);
+  bool exists = false;
+  std::string profile = ReadFile(filename.c_str(), &exists, false);
+  if (!exists) return {};
+  if (FLAG_trace_wasm_compiler) {
+    PrintF("Loading Wasm tiering profile from %s (%zu bytes)\n",
+           filename.c_str(), profile.size());
+  }
+  return DeserializeTieringProfile(
+      module, base::VectorOf(reinterpret_cast<const uint8_t*>(profile.data()),
+                             profile.size()));
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,71 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_PGO_H_
+#define V8_WASM_PGO_H_
+
+#include <memory>
+#include <vector>
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+struct WasmModule;
+
+// The tiering profile of a module, as recorded by a previous run with dynamic
+// tiering enabled.
+class ProfileInformation {
+ public:
+  struct HotFunction {
+    uint32_t func_index;
+    int tierup_priority;
+  };
+
+  explicit ProfileInformation(std::vector<HotFunction> hot_functions)
+      : hot_functions_(std::move(hot_functions)) {}
+
+  // Functions that were tiered up to TurboFan, in order of their function
+  // index.
+  base::Vector<const HotFunction> hot_functions() const {
+    return base::VectorOf(hot_functions_);
+  }
+
+ private:
+  const std::vector<HotFunction> hot_functions_;
+};
+
+// Serializes the tiering profile of {module}: all functions that triggered
+// tier-up, with their tier-up priority and the call site feedback collected
+// for speculative inlining.
+V8_EXPORT_PRIVATE base::OwnedVector<uint8_t> SerializeTieringProfile(
+    const WasmModule* module);
+
+// Restores the call site feedback and tier-up priorities of a profile created
+// by {SerializeTieringProfile} in {module}, and returns the hot functions for
+// the caller to compile. Returns {nullptr} if the profile is malformed or does
+// not match {module}.
+V8_EXPORT_PRIVATE std::unique_ptr<ProfileInformation>
+DeserializeTieringProfile(const WasmModule* module,
+                          base::Vector<const uint8_t> profile);
+
+// Support for {--experimental-wasm-pgo-to-file} and
+// {--experimental-wasm-pgo-from-file}. Profiles are stored in the current
+// working directory, in a file named after the hash of the wire bytes.
+void DumpTieringProfileToFile(const WasmModule* module,
+                              base::Vector<const uint8_t> wire_bytes);
+std::unique_ptr<ProfileInformation> LoadTieringProfileFromFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_PGO_H_
@@ -31,6 +31,7 @@
 #include "src/wasm/jump-table-assembler.h"
 #include "src/wasm/memory-protection-key.h"
 #include "src/wasm/module-compiler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-import-wrapper-cache.h"
@@ -964,8 +965,13 @@ namespace {
 BoundsCheckStrategy GetBoundsChecks(const WasmModule* module) {
   if (!FLAG_wasm_bounds_checks) return kNoBoundsChecks;
   if (FLAG_wasm_enforce_bounds_checks) return kExplicitBoundsChecks;
-  // We do not have trap handler support for memory64 yet.
-  if (module->is_memory64) return kExplicitBoundsChecks;
+  // Memory64 can use the trap handler on 64-bit hosts, because memories never
+  // exceed 4GB; the guard regions then cover all indexes below 2^32, and the
+  // upper half of the index is checked explicitly.
+  if (module->is_memory64 &&
+      (kSystemPointerSize == kInt32Size || !FLAG_wasm_memory64_trap_handling)) {
+    return kExplicitBoundsChecks;
+  }
   if (trap_handler::IsTrapHandlerEnabled()) return kTrapHandler;
   return kExplicitBoundsChecks;
 }
@@ -1294,11 +1300,17 @@ std::vector<WasmCode*> NativeModule::PublishCode(
                "wasm.PublishCode", "number", codes.size());
   std::vector<WasmCode*> published_code;
   published_code.reserve(codes.size());
+  std::vector<std::pair<uint32_t, Address>> jump_table_patches;
+  jump_table_patches.reserve(codes.size());
   base::RecursiveMutexGuard lock(&allocation_mutex_);
   // The published code is put into the top-most surrounding {WasmCodeRefScope}.
   for (auto& code : codes) {
-    published_code.push_back(PublishCodeLocked(std::move(code)));
+    published_code.push_back(
+        PublishCodeLocked(std::move(code), &jump_table_patches));
   }
+  // Patch all jump table slots at once, so that the jump tables are made
+  // writable and the instruction cache is flushed once for the whole batch.
+  PatchJumpTablesLocked(base::VectorOf(jump_table_patches));
   return published_code;
 }
 
@@ -1314,7 +1326,8 @@ WasmCode::Kind GetCodeKind(const WasmCompilationResult& result) {
 }
 
 WasmCode* NativeModule::PublishCodeLocked(
-    std::unique_ptr<WasmCode> owned_code) {
+    std::unique_ptr<WasmCode> owned_code,
+    std::vector<std::pair<uint32_t, Address>>* jump_table_patches) {
   allocation_mutex_.AssertHeld();
 
   WasmCode* code = owned_code.get();
@@ -1370,7 +1383,11 @@ WasmCode* NativeModule::PublishCodeLocked(
       prior_code->DecRefOnLiveCode();
     }
 
-    PatchJumpTablesLocked(slot_idx, code->instruction_start());
+    if (jump_table_patches) {
+      jump_table_patches->emplace_back(slot_idx, code->instruction_start());
+    } else {
+      PatchJumpTablesLocked(slot_idx, code->instruction_start());
+    }
   } else {
     // The code tables does not hold a reference to the code, hence decrement
     // the initial ref count of 1. The code was added to the
@@ -1533,8 +1550,46 @@ void NativeModule::PatchJumpTablesLocked(uint32_t slot_index, Address target) {
   }
 }
 
+void NativeModule::PatchJumpTablesLocked(
+    base::Vector<const std::pair<uint32_t, Address>> patches) {
+  allocation_mutex_.AssertHeld();
+  if (patches.empty()) return;
+
+  // Compute ranges of adjacent slots, to flush the instruction cache once per
+  // range instead of once per slot.
+  std::vector<uint32_t> slot_indexes;
+  slot_indexes.reserve(patches.size());
+  for (auto& patch : patches) slot_indexes.push_back(patch.first);
+  std::sort(slot_indexes.begin(), slot_indexes.end());
+  std::vector<std::pair<uint32_t, uint32_t>> slot_ranges;  // [begin, end)
+  for (uint32_t slot_index : slot_indexes) {
+    if (slot_ranges.empty() || slot_index > slot_ranges.back().second) {
+      slot_ranges.emplace_back(slot_index, slot_index + 1);
+    } else {
+      slot_ranges.back().second = slot_index + 1;
+    }
+  }
+
+  for (auto& code_space_data : code_space_data_) {
+    DCHECK_IMPLIES(code_space_data.jump_table, code_space_data.far_jump_table);
+    if (!code_space_data.jump_table) continue;
+    // Patch in the given order, later patches of the same slot win.
+    for (auto& patch : patches) {
+      PatchJumpTableLocked(code_space_data, patch.first, patch.second,
+                           WasmCode::kNoFlushICache);
+    }
+    Address jump_table_start = code_space_data.jump_table->instruction_start();
+    for (auto& range : slot_ranges) {
+      uint32_t begin = JumpTableAssembler::JumpSlotIndexToOffset(range.first);
+      uint32_t end = JumpTableAssembler::JumpSlotIndexToOffset(range.second);
+      FlushInstructionCache(jump_table_start + begin, end - begin);
+    }
+  }
+}
+
 void NativeModule::PatchJumpTableLocked(const CodeSpaceData& code_space_data,
-                                        uint32_t slot_index, Address target) {
+                                        uint32_t slot_index, Address target,
+                                        WasmCode::FlushICache flush_icache) {
   allocation_mutex_.AssertHeld();
 
   DCHECK_NOT_NULL(code_space_data.jump_table);
@@ -1572,8 +1627,9 @@ void NativeModule::PatchJumpTableLocked(const CodeSpaceData& code_space_data,
   Address far_jump_table_slot =
       has_far_jump_slot ? far_jump_table_start + far_jump_table_offset
                         : kNullAddress;
-  JumpTableAssembler::PatchJumpTableSlot(jump_table_slot, far_jump_table_slot,
-                                         target);
+  JumpTableAssembler::PatchJumpTableSlot(
+      jump_table_slot, far_jump_table_slot, target,
+      flush_icache ? FLUSH_ICACHE_IF_NEEDED : SKIP_ICACHE_FLUSH);
 }
 
 void NativeModule::AddCodeSpaceLocked(base::AddressRegion region) {
@@ -1880,6 +1936,10 @@ NativeModule::~NativeModule() {
   // Cancel all background compilation before resetting any field of the
   // NativeModule or freeing anything.
   compilation_state_->CancelCompilation();
+  if (V8_UNLIKELY(FLAG_experimental_wasm_pgo_to_file) &&
+      module_->origin == kWasmOrigin && !wire_bytes().empty()) {
+    DumpTieringProfileToFile(module_.get(), wire_bytes());
+  }
   GetWasmEngine()->FreeNativeModule(this);
   // Free the import wrapper cache before releasing the {WasmCode} objects in
   // {owned_code_}. The destructor of {WasmImportWrapperCache} still needs to
@@ -2492,6 +2552,48 @@ void NativeModule::FreeCode(base::Vector<WasmCode* const> codes) {
   if (debug_info) debug_info->RemoveDebugSideTables(codes);
 }
 
+size_t NativeModule::FlushTopTierCode() {
+  // Asm.js modules do not have a cheaper tier to fall back to.
+  if (is_asmjs_module(module())) return 0;
+  // Hold the scope until the end of this method, such that the flushed code
+  // only becomes potentially dead after the lock is released.
+  WasmCodeRefScope code_ref_scope;
+  CodeSpaceWriteScope code_space_write_scope(this);
+  base::RecursiveMutexGuard guard(&allocation_mutex_);
+  if (lazy_compile_frozen_ || tiering_state_ == kTieredDown) return 0;
+  // The lazy compile table can only be created in a single code space.
+  if (!lazy_compile_table_ && code_space_data_.size() > 1) return 0;
+
+  size_t num_flushed = 0;
+  const uint32_t num_imported_functions = module_->num_imported_functions;
+  for (uint32_t slot_index = 0; slot_index < module_->num_declared_functions;
+       ++slot_index) {
+    WasmCode* code = code_table_[slot_index];
+    if (!code || code->tier() != ExecutionTier::kTurbofan ||
+        code->for_debugging()) {
+      continue;
+    }
+    code_table_[slot_index] = nullptr;
+    UseLazyStub(num_imported_functions + slot_index);
+    // Let the recompiled Liftoff code collect a new tier-up budget.
+    if (tiering_budgets_) {
+      tiering_budgets_[slot_index] = FLAG_wasm_tiering_budget;
+    }
+    {
+      base::MutexGuard feedback_guard(&module_->type_feedback.mutex);
+      auto& feedback = module_->type_feedback.feedback_for_function;
+      auto it = feedback.find(num_imported_functions + slot_index);
+      if (it != feedback.end()) it->second.tierup_priority = 0;
+    }
+    // The code might still be executing; the code GC finds out when it is
+    // really dead.
+    WasmCodeRefScope::AddRef(code);
+    code->DecRefOnLiveCode();
+    ++num_flushed;
+  }
+  return num_flushed;
+}
+
 size_t NativeModule::GetNumberOfCodeSpacesForTesting() const {
   base::RecursiveMutexGuard guard{&allocation_mutex_};
   return code_allocator_.GetNumCodeSpaces();
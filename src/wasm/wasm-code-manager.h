@@ -771,6 +771,7 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t generated_code_size() const {
     return code_allocator_.generated_code_size();
   }
+  size_t freed_code_size() const { return code_allocator_.freed_code_size(); }
   size_t liftoff_bailout_count() const { return liftoff_bailout_count_.load(); }
   size_t liftoff_code_size() const { return liftoff_code_size_.load(); }
   size_t turbofan_code_size() const { return turbofan_code_size_.load(); }
@@ -837,6 +838,14 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // its accounting.
   void FreeCode(base::Vector<WasmCode* const>);
 
+  // Drop the TurboFan code of all functions and patch their jump table slots
+  // to the lazy compile stub, such that they get recompiled with Liftoff on
+  // their next call and can tier up again. The dropped code becomes
+  // potentially dead and is freed by the next code GC. Modules which are
+  // tiered down for debugging, asm.js modules and modules with frozen lazy
+  // compilation are not changed. Returns the number of flushed functions.
+  size_t FlushTopTierCode();
+
   // Retrieve the number of separately reserved code spaces for this module.
   size_t GetNumberOfCodeSpacesForTesting() const;
 
@@ -886,14 +895,23 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // {slot_index} is the index in the declared functions, i.e. function index
   // minus the number of imported functions.
   void PatchJumpTablesLocked(uint32_t slot_index, Address target);
+  // Patches all {slot_index, target} pairs in order, and flushes the
+  // instruction cache once per range of adjacent slots.
+  void PatchJumpTablesLocked(
+      base::Vector<const std::pair<uint32_t, Address>> patches);
   void PatchJumpTableLocked(const CodeSpaceData&, uint32_t slot_index,
-                            Address target);
+                            Address target,
+                            WasmCode::FlushICache = WasmCode::kFlushICache);
 
   // Called by the {WasmCodeAllocator} to register a new code space.
   void AddCodeSpaceLocked(base::AddressRegion);
 
-  // Hold the {allocation_mutex_} when calling {PublishCodeLocked}.
-  WasmCode* PublishCodeLocked(std::unique_ptr<WasmCode>);
+  // Hold the {allocation_mutex_} when calling {PublishCodeLocked}. If
+  // {jump_table_patches} is given, jump table updates are appended there
+  // instead of being executed.
+  WasmCode* PublishCodeLocked(
+      std::unique_ptr<WasmCode>,
+      std::vector<std::pair<uint32_t, Address>>* jump_table_patches = nullptr);
 
   // Transfer owned code from {new_owned_code_} to {owned_code_}.
   void TransferNewOwnedCodeLocked() const;
@@ -1415,6 +1415,60 @@ void WasmEngine::ReportLiveCodeFromStackForGC(Isolate* isolate) {
       isolate, base::OwnedVector<WasmCode*>::Of(live_wasm_code).as_vector());
 }
 
+void WasmEngine::MemoryPressureNotification(Isolate* isolate,
+                                            MemoryPressureLevel level) {
+  if (!FLAG_wasm_code_gc || level == MemoryPressureLevel::kNone) return;
+  if (level == MemoryPressureLevel::kCritical &&
+      FLAG_wasm_flush_code_on_memory_pressure) {
+    std::vector<std::shared_ptr<NativeModule>> native_modules;
+    {
+      base::MutexGuard guard(&mutex_);
+      DCHECK_EQ(1, isolates_.count(isolate));
+      for (NativeModule* native_module : isolates_[isolate]->native_modules) {
+        DCHECK_EQ(1, native_modules_.count(native_module));
+        if (auto shared_native_module =
+                native_modules_[native_module]->weak_ptr.lock()) {
+          native_modules.emplace_back(std::move(shared_native_module));
+        }
+      }
+    }
+    // Flushed code is added to the set of potentially dead code, which takes
+    // {mutex_}, so flush without holding it.
+    for (auto& native_module : native_modules) {
+      size_t num_flushed = native_module->FlushTopTierCode();
+      TRACE_CODE_GC("Flushed TurboFan code of %zu functions of module %p.\n",
+                    num_flushed, native_module.get());
+      USE(num_flushed);
+    }
+  }
+
+  // Start a GC for all potentially dead code, independent of its size.
+  base::MutexGuard guard(&mutex_);
+  if (new_potentially_dead_code_size_ == 0) return;
+  NativeModuleInfo* info = nullptr;
+  for (auto& entry : native_modules_) {
+    if (entry.second->potentially_dead_code.empty()) continue;
+    info = entry.second.get();
+    break;
+  }
+  if (info == nullptr) return;
+  if (info->num_code_gcs_triggered < std::numeric_limits<int8_t>::max()) {
+    ++info->num_code_gcs_triggered;
+  }
+  if (current_gc_info_ == nullptr) {
+    TRACE_CODE_GC(
+        "Triggering GC on memory pressure (potentially dead: %zu bytes).\n",
+        new_potentially_dead_code_size_);
+    TriggerGC(info->num_code_gcs_triggered);
+  } else if (current_gc_info_->next_gc_sequence_index == 0) {
+    TRACE_CODE_GC(
+        "Scheduling another GC on memory pressure (potentially dead: %zu "
+        "bytes).\n",
+        new_potentially_dead_code_size_);
+    current_gc_info_->next_gc_sequence_index = info->num_code_gcs_triggered;
+  }
+}
+
 bool WasmEngine::AddPotentiallyDeadCode(WasmCode* code) {
   base::MutexGuard guard(&mutex_);
   auto it = native_modules_.find(code->native_module());
@@ -15,6 +15,7 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "include/v8-isolate.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/tasks/cancelable-task.h"
@@ -25,6 +26,9 @@
 #include "src/zone/accounting-allocator.h"
 
 namespace v8 {
+
+class WasmCodeCache;
+
 namespace internal {
 
 class AsmWasmData;
@@ -323,6 +327,15 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   void FreeNativeModule(NativeModule*);
 
+  // Install the embedder's cache for serialized native modules, see
+  // {v8::WasmCodeCache}. Passing {nullptr} removes the cache again.
+  void SetCodeCache(v8::WasmCodeCache* code_cache) {
+    code_cache_.store(code_cache, std::memory_order_release);
+  }
+  v8::WasmCodeCache* code_cache() const {
+    return code_cache_.load(std::memory_order_acquire);
+  }
+
   // Sample the code size of the given {NativeModule} in all isolates that have
   // access to it. Call this after top-tier compilation finished.
   // This will spawn foreground tasks that do *not* keep the NativeModule alive.
@@ -334,6 +347,13 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void ReportLiveCodeForGC(Isolate*, base::Vector<WasmCode*>);
   void ReportLiveCodeFromStackForGC(Isolate*);
 
+  // Called by the heap of {isolate} on memory pressure. Starts a code GC if
+  // there is potentially dead code, e.g. Liftoff code of functions which were
+  // tiered up. On critical pressure and with
+  // {--wasm-flush-code-on-memory-pressure}, the TurboFan code of all modules
+  // used by {isolate} is dropped first, see {NativeModule::FlushTopTierCode}.
+  void MemoryPressureNotification(Isolate* isolate, MemoryPressureLevel level);
+
   // Add potentially dead code. The occurrence in the set of potentially dead
   // code counts as a reference, and is decremented on the next GC.
   // Returns {true} if the code was added to the set of potentially dead code,
@@ -395,6 +415,9 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   std::atomic<int> next_compilation_id_{0};
 
+  // The embedder's cache for serialized native modules, or {nullptr}.
+  std::atomic<v8::WasmCodeCache*> code_cache_{nullptr};
+
   TypeCanonicalizer type_canonicalizer_;
 
   // This mutex protects all information which is mutated concurrently or
@@ -4,9 +4,15 @@
 
 #include "src/wasm/wasm-import-wrapper-cache.h"
 
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
+#include "src/base/lazy-instance.h"
+#include "src/codegen/assembler.h"
+#include "src/flags/flags.h"
 #include "src/logging/counters.h"
+#include "src/wasm/compilation-environment.h"
 #include "src/wasm/wasm-code-manager.h"
 
 namespace v8 {
@@ -56,6 +62,123 @@ WasmImportWrapperCache::~WasmImportWrapperCache() {
   WasmCode::DecrementRefCount(base::VectorOf(ptrs));
 }
 
+namespace {
+
+struct SharedWrapperKey {
+  SharedWrapperKey(compiler::WasmImportCallKind kind, const FunctionSig* sig,
+                   bool source_positions, int expected_arity, Suspend suspend,
+                   WasmFeatures enabled_features)
+      : kind(kind),
+        return_count(sig->return_count()),
+        types(sig->all().begin(), sig->all().end()),
+        source_positions(source_positions),
+        expected_arity(expected_arity),
+        suspend(suspend),
+        enabled_features(enabled_features) {}
+
+  bool operator==(const SharedWrapperKey& other) const {
+    return kind == other.kind && return_count == other.return_count &&
+           types == other.types && source_positions == other.source_positions &&
+           expected_arity == other.expected_arity && suspend == other.suspend &&
+           enabled_features == other.enabled_features;
+  }
+
+  compiler::WasmImportCallKind kind;
+  size_t return_count;
+  std::vector<ValueType> types;
+  bool source_positions;
+  int expected_arity;
+  Suspend suspend;
+  WasmFeatures enabled_features;
+};
+
+struct SharedWrapperKeyHash {
+  size_t operator()(const SharedWrapperKey& key) const {
+    size_t hash = base::hash_combine(
+        static_cast<uint8_t>(key.kind), key.return_count, key.source_positions,
+        key.expected_arity, static_cast<uint8_t>(key.suspend),
+        key.enabled_features.ToIntegral());
+    for (ValueType type : key.types) {
+      hash = base::hash_combine(hash, hash_value(type));
+    }
+    return hash;
+  }
+};
+
+struct SharedImportWrapperCacheImpl {
+  base::Mutex mutex;
+  std::unordered_map<SharedWrapperKey, WasmCompilationResult,
+                     SharedWrapperKeyHash>
+      results;
+};
+
+base::LazyInstance<SharedImportWrapperCacheImpl>::type
+    shared_import_wrapper_cache_ = LAZY_INSTANCE_INITIALIZER;
+
+bool CanShareWrapper(const FunctionSig* sig) {
+  if (!FLAG_wasm_shared_import_wrappers) return false;
+  for (ValueType type : sig->all()) {
+    if (type.has_index()) return false;
+  }
+  return true;
+}
+
+WasmCompilationResult CopyCompilationResult(
+    const WasmCompilationResult& result) {
+  WasmCompilationResult copy;
+  copy.instr_buffer = NewAssemblerBuffer(result.code_desc.buffer_size);
+  std::memcpy(copy.instr_buffer->start(), result.code_desc.buffer,
+              result.code_desc.buffer_size);
+  copy.code_desc = result.code_desc;
+  copy.code_desc.buffer = copy.instr_buffer->start();
+  copy.code_desc.origin = nullptr;
+  copy.frame_slot_count = result.frame_slot_count;
+  copy.tagged_parameter_slots = result.tagged_parameter_slots;
+  copy.source_positions =
+      base::OwnedVector<byte>::Of(result.source_positions.as_vector());
+  copy.protected_instructions_data = base::OwnedVector<byte>::Of(
+      result.protected_instructions_data.as_vector());
+  copy.func_index = result.func_index;
+  copy.requested_tier = result.requested_tier;
+  copy.result_tier = result.result_tier;
+  copy.kind = result.kind;
+  copy.for_debugging = result.for_debugging;
+  copy.feedback_vector_slots = result.feedback_vector_slots;
+  return copy;
+}
+
+}  // namespace
+
+// static
+WasmCompilationResult SharedImportWrapperCache::CompileWrapper(
+    CompilationEnv* env, compiler::WasmImportCallKind kind,
+    const FunctionSig* sig, bool source_positions, int expected_arity,
+    Suspend suspend) {
+  if (!CanShareWrapper(sig)) {
+    return compiler::CompileWasmImportCallWrapper(
+        env, kind, sig, source_positions, expected_arity, suspend);
+  }
+  SharedWrapperKey key(kind, sig, source_positions, expected_arity, suspend,
+                       env->enabled_features);
+  SharedImportWrapperCacheImpl* cache = shared_import_wrapper_cache_.Pointer();
+  {
+    base::MutexGuard guard(&cache->mutex);
+    auto it = cache->results.find(key);
+    if (it != cache->results.end()) return CopyCompilationResult(it->second);
+  }
+  // Compile without holding the lock. If another thread compiles the same
+  // wrapper concurrently, the first result stays in the cache.
+  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
+      env, kind, sig, source_positions, expected_arity, suspend);
+  if (!result.succeeded() || result.code_desc.unwinding_info_size != 0) {
+    return result;
+  }
+  WasmCompilationResult copy = CopyCompilationResult(result);
+  base::MutexGuard guard(&cache->mutex);
+  cache->results.emplace(std::move(key), std::move(result));
+  return copy;
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -88,6 +88,21 @@ class WasmImportWrapperCache {
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
 };
 
+// Process-wide cache of compiled import wrappers, shared by all modules and
+// isolates. Signatures are compared structurally, so signatures which refer to
+// module-specific type indexes are never shared. The cache holds compilation
+// results; each module still adds its own copy of the code, since wrappers
+// call runtime stubs through the jump tables of their module.
+class SharedImportWrapperCache {
+ public:
+  // Thread-safe. Returns a copy of a cached wrapper for the given parameters,
+  // or compiles the wrapper and adds it to the cache first.
+  V8_EXPORT_PRIVATE static WasmCompilationResult CompileWrapper(
+      CompilationEnv* env, compiler::WasmImportCallKind kind,
+      const FunctionSig* sig, bool source_positions, int expected_arity,
+      Suspend suspend);
+};
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -4,9 +4,11 @@
 
 #include "src/wasm/wasm-serialization.h"
 
+#include "include/v8-wasm.h"
 #include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/external-reference-table.h"
+#include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
 #include "src/runtime/runtime.h"
@@ -14,7 +16,9 @@
 #include "src/utils/ostreams.h"
 #include "src/utils/utils.h"
 #include "src/utils/version.h"
+#include "src/tracing/trace-event.h"
 #include "src/wasm/code-space-access.h"
+#include "src/wasm/compilation-environment.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
@@ -498,10 +502,28 @@ bool WasmSerializer::SerializeNativeModule(base::Vector<byte> buffer) const {
   return true;
 }
 
+// The serialized data of a function, as found by {ReadCode}. The {WasmCode}
+// gets created on a background thread, together with copying and relocating
+// the instructions.
 struct DeserializationUnit {
+  int fn_index;
+  int constant_pool_offset;
+  int safepoint_table_offset;
+  int handler_table_offset;
+  int code_comment_offset;
+  int unpadded_binary_size;
+  int stack_slot_count;
+  uint32_t tagged_parameter_slots;
+  WasmCode::Kind kind;
+  ExecutionTier tier;
   base::Vector<const byte> src_code_buffer;
-  std::unique_ptr<WasmCode> code;
+  base::Vector<const byte> reloc_info;
+  base::Vector<const byte> source_positions;
+  base::Vector<const byte> protected_instructions;
+  // Empty for functions without code.
+  base::Vector<byte> instructions;
   NativeModule::JumpTablesRef jump_tables;
+  std::unique_ptr<WasmCode> code;
 };
 
 class DeserializationQueue {
@@ -564,7 +586,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
-  void CopyAndRelocate(const DeserializationUnit& unit);
+  void CopyAndRelocate(DeserializationUnit* unit);
   void Publish(std::vector<DeserializationUnit> batch);
 
   NativeModule* const native_module_;
@@ -594,8 +616,8 @@ class DeserializeCodeTask : public JobTask {
 
       auto batch = reloc_queue_->Pop();
       if (batch.empty()) break;
-      for (const auto& unit : batch) {
-        deserializer_->CopyAndRelocate(unit);
+      for (auto& unit : batch) {
+        deserializer_->CopyAndRelocate(&unit);
       }
       publish_queue_.Add(std::move(batch));
       delegate->NotifyConcurrencyIncrease();
@@ -672,8 +694,8 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   CodeSpaceWriteScope code_space_write_scope(native_module_);
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
     DeserializationUnit unit = ReadCode(i, reader);
-    if (!unit.code) continue;
-    batch_size += unit.code->instructions().size();
+    if (unit.instructions.empty()) continue;
+    batch_size += unit.instructions.size();
     batch.emplace_back(std::move(unit));
     if (batch_size >= batch_limit) {
       reloc_queue.Add(std::move(batch));
@@ -705,29 +727,31 @@ void NativeModuleDeserializer::ReadHeader(Reader* reader) {
 
 DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
                                                        Reader* reader) {
+  DeserializationUnit unit{};
+  unit.fn_index = fn_index;
   uint8_t code_kind = reader->Read<uint8_t>();
   if (code_kind == kLazyFunction) {
     lazy_functions_.push_back(fn_index);
-    return {};
+    return unit;
   }
   if (code_kind == kLiftoffFunction) {
     liftoff_functions_.push_back(fn_index);
-    return {};
+    return unit;
   }
 
-  int constant_pool_offset = reader->Read<int>();
-  int safepoint_table_offset = reader->Read<int>();
-  int handler_table_offset = reader->Read<int>();
-  int code_comment_offset = reader->Read<int>();
-  int unpadded_binary_size = reader->Read<int>();
-  int stack_slot_count = reader->Read<int>();
-  uint32_t tagged_parameter_slots = reader->Read<uint32_t>();
+  unit.constant_pool_offset = reader->Read<int>();
+  unit.safepoint_table_offset = reader->Read<int>();
+  unit.handler_table_offset = reader->Read<int>();
+  unit.code_comment_offset = reader->Read<int>();
+  unit.unpadded_binary_size = reader->Read<int>();
+  unit.stack_slot_count = reader->Read<int>();
+  unit.tagged_parameter_slots = reader->Read<uint32_t>();
   int code_size = reader->Read<int>();
   int reloc_size = reader->Read<int>();
   int source_position_size = reader->Read<int>();
   int protected_instructions_size = reader->Read<int>();
-  WasmCode::Kind kind = reader->Read<WasmCode::Kind>();
-  ExecutionTier tier = reader->Read<ExecutionTier>();
+  unit.kind = reader->Read<WasmCode::Kind>();
+  unit.tier = reader->Read<ExecutionTier>();
 
   DCHECK(IsAligned(code_size, kCodeAlignment));
   DCHECK_GE(remaining_code_size_, code_size);
@@ -743,31 +767,30 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
     DCHECK(current_jump_tables_.is_valid());
   }
 
-  DeserializationUnit unit;
   unit.src_code_buffer = reader->ReadVector<byte>(code_size);
-  auto reloc_info = reader->ReadVector<byte>(reloc_size);
-  auto source_pos = reader->ReadVector<byte>(source_position_size);
-  auto protected_instructions =
+  unit.reloc_info = reader->ReadVector<byte>(reloc_size);
+  unit.source_positions = reader->ReadVector<byte>(source_position_size);
+  unit.protected_instructions =
       reader->ReadVector<byte>(protected_instructions_size);
 
-  base::Vector<uint8_t> instructions =
-      current_code_space_.SubVector(0, code_size);
+  unit.instructions = current_code_space_.SubVector(0, code_size);
   current_code_space_ += code_size;
   remaining_code_size_ -= code_size;
-
-  unit.code = native_module_->AddDeserializedCode(
-      fn_index, instructions, stack_slot_count, tagged_parameter_slots,
-      safepoint_table_offset, handler_table_offset, constant_pool_offset,
-      code_comment_offset, unpadded_binary_size, protected_instructions,
-      reloc_info, source_pos, kind, tier);
   unit.jump_tables = current_jump_tables_;
   return unit;
 }
 
-void NativeModuleDeserializer::CopyAndRelocate(
-    const DeserializationUnit& unit) {
-  memcpy(unit.code->instructions().begin(), unit.src_code_buffer.begin(),
-         unit.src_code_buffer.size());
+void NativeModuleDeserializer::CopyAndRelocate(DeserializationUnit* unit) {
+  unit->code = native_module_->AddDeserializedCode(
+      unit->fn_index, unit->instructions, unit->stack_slot_count,
+      unit->tagged_parameter_slots, unit->safepoint_table_offset,
+      unit->handler_table_offset, unit->constant_pool_offset,
+      unit->code_comment_offset, unit->unpadded_binary_size,
+      unit->protected_instructions, unit->reloc_info, unit->source_positions,
+      unit->kind, unit->tier);
+  WasmCode* code = unit->code.get();
+  memcpy(code->instructions().begin(), unit->src_code_buffer.begin(),
+         unit->src_code_buffer.size());
 
   // Relocate the code.
   int mask = RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
@@ -775,15 +798,15 @@ void NativeModuleDeserializer::CopyAndRelocate(
              RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
              RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE) |
              RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE_ENCODED);
-  for (RelocIterator iter(unit.code->instructions(), unit.code->reloc_info(),
-                          unit.code->constant_pool(), mask);
+  for (RelocIterator iter(code->instructions(), code->reloc_info(),
+                          code->constant_pool(), mask);
        !iter.done(); iter.next()) {
     RelocInfo::Mode mode = iter.rinfo()->rmode();
     switch (mode) {
       case RelocInfo::WASM_CALL: {
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
-        Address target =
-            native_module_->GetNearCallTargetForFunction(tag, unit.jump_tables);
+        Address target = native_module_->GetNearCallTargetForFunction(
+            tag, unit->jump_tables);
         iter.rinfo()->set_wasm_call_address(target, SKIP_ICACHE_FLUSH);
         break;
       }
@@ -791,7 +814,7 @@ void NativeModuleDeserializer::CopyAndRelocate(
         uint32_t tag = GetWasmCalleeTag(iter.rinfo());
         DCHECK_LT(tag, WasmCode::kRuntimeStubCount);
         Address target = native_module_->GetNearRuntimeStubEntry(
-            static_cast<WasmCode::RuntimeStubId>(tag), unit.jump_tables);
+            static_cast<WasmCode::RuntimeStubId>(tag), unit->jump_tables);
         iter.rinfo()->set_wasm_stub_call_address(target, SKIP_ICACHE_FLUSH);
         break;
       }
@@ -804,7 +827,7 @@ void NativeModuleDeserializer::CopyAndRelocate(
       case RelocInfo::INTERNAL_REFERENCE:
       case RelocInfo::INTERNAL_REFERENCE_ENCODED: {
         Address offset = iter.rinfo()->target_internal_reference();
-        Address target = unit.code->instruction_start() + offset;
+        Address target = code->instruction_start() + offset;
         Assembler::deserialization_set_target_internal_reference_at(
             iter.rinfo()->pc(), target, mode);
         break;
@@ -815,8 +838,8 @@ void NativeModuleDeserializer::CopyAndRelocate(
   }
 
   // Finally, flush the icache for that code.
-  FlushInstructionCache(unit.code->instructions().begin(),
-                        unit.code->instructions().size());
+  FlushInstructionCache(code->instructions().begin(),
+                        code->instructions().size());
 }
 
 void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
@@ -914,6 +937,151 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   return module_object;
 }
 
+namespace {
+
+// Code cache keys cover the serialization header, so that different V8
+// versions, flags and CPUs do not evict each other's entries, plus the enabled
+// features and a hash of the wire bytes. Since the hash can collide, the values
+// start with a copy of the wire bytes, followed by the serialized module.
+constexpr size_t kCodeCacheKeySize =
+    WasmSerializer::kHeaderSize + 3 * sizeof(uint64_t);
+using CodeCacheKey = std::array<byte, kCodeCacheKeySize>;
+
+CodeCacheKey GetCodeCacheKey(base::Vector<const byte> wire_bytes,
+                             const WasmFeatures& enabled_features) {
+  CodeCacheKey key;
+  Writer writer(base::VectorOf(key));
+  WriteHeader(&writer);
+  writer.Write(static_cast<uint64_t>(enabled_features.ToIntegral()));
+  writer.Write(static_cast<uint64_t>(wire_bytes.size()));
+  writer.Write(
+      static_cast<uint64_t>(NativeModuleCache::WireBytesHash(wire_bytes)));
+  DCHECK_EQ(kCodeCacheKeySize, writer.bytes_written());
+  return key;
+}
+
+void StoreInCodeCache(NativeModule* native_module) {
+  v8::WasmCodeCache* code_cache = GetWasmEngine()->code_cache();
+  if (code_cache == nullptr || native_module->IsTieredDown()) return;
+  TRACE_EVENT0("v8.wasm", "wasm.StoreInCodeCache");
+  base::Vector<const byte> wire_bytes = native_module->wire_bytes();
+  if (wire_bytes.empty()) return;
+  WasmSerializer serializer(native_module);
+  size_t size = wire_bytes.size() + serializer.GetSerializedNativeModuleSize();
+  auto data = base::OwnedVector<byte>::NewForOverwrite(size);
+  memcpy(data.start(), wire_bytes.begin(), wire_bytes.size());
+  if (!serializer.SerializeNativeModule(data.as_vector() + wire_bytes.size())) {
+    return;
+  }
+  CodeCacheKey key =
+      GetCodeCacheKey(wire_bytes, native_module->enabled_features());
+  code_cache->Put({key.data(), key.size()}, {data.start(), data.size()});
+}
+
+class StoreInCodeCacheTask : public v8::Task {
+ public:
+  StoreInCodeCacheTask(std::weak_ptr<NativeModule> native_module,
+                       std::shared_ptr<std::atomic<bool>> task_pending)
+      : native_module_(std::move(native_module)),
+        engine_barrier_(GetWasmEngine()->GetBarrierForBackgroundCompile()),
+        task_pending_(std::move(task_pending)) {}
+
+  void Run() override {
+    // Reset the flag first, so that code finished while we serialize gets
+    // stored by another task.
+    task_pending_->store(false);
+    auto engine_scope = engine_barrier_->TryLock();
+    if (!engine_scope) return;
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      StoreInCodeCache(native_module.get());
+    }
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+  const std::shared_ptr<OperationsBarrier> engine_barrier_;
+  const std::shared_ptr<std::atomic<bool>> task_pending_;
+};
+
+class StoreInCodeCacheCallback : public CompilationEventCallback {
+ public:
+  explicit StoreInCodeCacheCallback(std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void call(CompilationEvent event) override {
+    if (event != CompilationEvent::kFinishedCompilationChunk &&
+        event != CompilationEvent::kFinishedTopTierCompilation) {
+      return;
+    }
+    // A pending task will also pick up the code of this event.
+    if (task_pending_->exchange(true)) return;
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<StoreInCodeCacheTask>(native_module_, task_pending_));
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return CompilationEventCallback::ReleaseAfterFinalEvent::kKeep;
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+  const std::shared_ptr<std::atomic<bool>> task_pending_ =
+      std::make_shared<std::atomic<bool>>(false);
+};
+
+}  // namespace
+
+std::shared_ptr<NativeModule> DeserializeFromCodeCache(
+    Isolate* isolate, const WasmFeatures& enabled_features,
+    std::shared_ptr<const WasmModule> module,
+    base::OwnedVector<const uint8_t>* wire_bytes) {
+  WasmEngine* wasm_engine = GetWasmEngine();
+  v8::WasmCodeCache* code_cache = wasm_engine->code_cache();
+  if (code_cache == nullptr || module->origin != kWasmOrigin) return {};
+  TRACE_EVENT0("v8.wasm", "wasm.DeserializeFromCodeCache");
+  base::Vector<const byte> wire_bytes_vec = wire_bytes->as_vector();
+  CodeCacheKey key = GetCodeCacheKey(wire_bytes_vec, enabled_features);
+  OwnedBuffer entry = code_cache->Get({key.data(), key.size()});
+  if (entry.size <= wire_bytes_vec.size() ||
+      memcmp(entry.buffer.get(), wire_bytes_vec.begin(),
+             wire_bytes_vec.size()) != 0) {
+    return {};
+  }
+  base::Vector<const byte> data =
+      base::VectorOf(entry.buffer.get(), entry.size) + wire_bytes_vec.size();
+  if (!IsSupportedVersion(data)) return {};
+
+  bool dynamic_tiering = isolate->IsWasmDynamicTieringEnabled();
+  const bool include_liftoff = !dynamic_tiering;
+  size_t code_size_estimate =
+      wasm::WasmCodeManager::EstimateNativeModuleCodeSize(
+          module.get(), include_liftoff, DynamicTiering{dynamic_tiering});
+  std::shared_ptr<NativeModule> native_module = wasm_engine->NewNativeModule(
+      isolate, enabled_features, std::move(module), code_size_estimate);
+  // Code deserialized for a module that is being debugged would be replaced
+  // right away.
+  if (native_module->IsTieredDown()) return {};
+
+  // The wire bytes are only set once the code was read successfully, so that a
+  // failed attempt does not touch the {NativeModuleCache} entry of the caller
+  // when {native_module} dies.
+  NativeModuleDeserializer deserializer(native_module.get());
+  Reader reader(data + WasmSerializer::kHeaderSize);
+  if (!deserializer.Read(&reader)) return {};
+  native_module->SetWireBytes(std::move(*wire_bytes));
+  native_module->compilation_state()->InitializeAfterDeserialization(
+      deserializer.lazy_functions(), deserializer.liftoff_functions());
+  return native_module;
+}
+
+void StoreInCodeCacheAfterTierUp(
+    const std::shared_ptr<NativeModule>& native_module) {
+  if (GetWasmEngine()->code_cache() == nullptr) return;
+  if (native_module->module()->origin != kWasmOrigin) return;
+  native_module->compilation_state()->AddCallback(
+      std::make_unique<StoreInCodeCacheCallback>(native_module));
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -61,6 +61,20 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate*, base::Vector<const byte> data,
     base::Vector<const byte> wire_bytes, base::Vector<const char> source_url);
 
+// Support for the {v8::WasmCodeCache} installed in the {WasmEngine}.
+// Looks up the code for {wire_bytes} in the code cache. On a hit, returns a
+// new {NativeModule} with the deserialized code, which took ownership of
+// {wire_bytes}. Returns {nullptr} and leaves {wire_bytes} untouched otherwise.
+std::shared_ptr<NativeModule> DeserializeFromCodeCache(
+    Isolate*, const WasmFeatures& enabled_features,
+    std::shared_ptr<const WasmModule>,
+    base::OwnedVector<const uint8_t>* wire_bytes);
+
+// Stores the code of {native_module} in the code cache from a background task
+// whenever top-tier compilation finished a chunk of functions. Does nothing if
+// there is no code cache.
+void StoreInCodeCacheAfterTierUp(const std::shared_ptr<NativeModule>&);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -4,25 +4,181 @@
 
 #include "src/web-snapshot/web-snapshot.h"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <vector>
 
 #include "include/v8-isolate.h"
 #include "include/v8-local-handle.h"
 #include "include/v8-object.h"
+#include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
 #include "src/api/api-inl.h"
 #include "src/base/platform/wrappers.h"
 #include "src/handles/handles.h"
+#include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/contexts.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/script.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// The maximum number of bytes that ValueSerializer::WriteUint32 writes.
+constexpr size_t kMaxVarintSize = 5;
+
+// The number of bytes that ValueSerializer::WriteUint32 writes for |value|.
+size_t VarintSize(size_t value) {
+  size_t size = 1;
+  while (value >= 0x80) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+
+// Decodes the UTF-8 strings of a string table on worker threads. The strings
+// are split into chunks of about kChunkSize bytes, each of which is decoded
+// into a buffer of its own, so that the main thread only needs to allocate
+// the strings and copy the characters.
+class ConcurrentStringDecoder final {
+ public:
+  explicit ConcurrentStringDecoder(
+      const std::vector<base::Vector<const uint8_t>>& utf8_strings)
+      : utf8_strings_(utf8_strings), strings_(utf8_strings.size()) {
+    size_t chunk_begin = 0;
+    size_t chunk_size = 0;
+    for (size_t i = 0; i < utf8_strings.size(); ++i) {
+      chunk_size += utf8_strings[i].size();
+      if (chunk_size >= kChunkSize || i + 1 == utf8_strings.size()) {
+        chunks_.push_back({chunk_begin, i + 1, nullptr});
+        chunk_begin = i + 1;
+        chunk_size = 0;
+      }
+    }
+  }
+
+  // Whether the strings are large enough to be worth decoding concurrently.
+  static bool ShouldDecodeConcurrently(size_t utf8_size) {
+    return FLAG_web_snapshot_concurrent_string_decoding &&
+           utf8_size >= 2 * kChunkSize;
+  }
+
+  void Decode() {
+    std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::make_unique<DecodeJob>(this));
+    job_handle->Join();
+  }
+
+  MaybeHandle<String> NewString(Factory* factory, size_t index) const {
+    const DecodedString& string = strings_[index];
+    if (string.length == 0) return factory->empty_string();
+    if (string.is_one_byte) {
+      Handle<SeqOneByteString> result;
+      if (!factory->NewRawOneByteString(string.length, AllocationType::kOld)
+               .ToHandle(&result)) {
+        return {};
+      }
+      DisallowGarbageCollection no_gc;
+      CopyChars(result->GetChars(no_gc), string.chars, string.length);
+      return result;
+    }
+    Handle<SeqTwoByteString> result;
+    if (!factory->NewRawTwoByteString(string.length, AllocationType::kOld)
+             .ToHandle(&result)) {
+      return {};
+    }
+    DisallowGarbageCollection no_gc;
+    CopyChars(result->GetChars(no_gc),
+              reinterpret_cast<const uint16_t*>(string.chars), string.length);
+    return result;
+  }
+
+ private:
+  static constexpr size_t kChunkSize = 64 * KB;
+
+  struct DecodedString {
+    const uint8_t* chars;
+    int length;
+    bool is_one_byte;
+  };
+
+  struct Chunk {
+    size_t begin;
+    size_t end;
+    std::unique_ptr<uint16_t[]> buffer;
+  };
+
+  class DecodeJob final : public JobTask {
+   public:
+    explicit DecodeJob(ConcurrentStringDecoder* decoder) : decoder_(decoder) {}
+
+    void Run(JobDelegate* delegate) override {
+      while (!delegate->ShouldYield()) {
+        size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= decoder_->chunks_.size()) return;
+        decoder_->DecodeChunk(&decoder_->chunks_[index]);
+      }
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      size_t chunk_count = decoder_->chunks_.size();
+      size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+      return chunk_count - std::min(next_chunk, chunk_count);
+    }
+
+   private:
+    ConcurrentStringDecoder* const decoder_;
+    std::atomic<size_t> next_chunk_{0};
+  };
+
+  void DecodeChunk(Chunk* chunk) {
+    std::vector<Utf8Decoder> decoders;
+    decoders.reserve(chunk->end - chunk->begin);
+    // The offsets of the strings in the buffer, in uint16_t units so that
+    // two-byte strings are aligned.
+    std::vector<size_t> offsets;
+    offsets.reserve(chunk->end - chunk->begin);
+    size_t buffer_size = 0;
+    for (size_t i = chunk->begin; i < chunk->end; ++i) {
+      decoders.emplace_back(utf8_strings_[i]);
+      offsets.push_back(buffer_size);
+      const Utf8Decoder& decoder = decoders.back();
+      buffer_size += decoder.is_one_byte() ? (decoder.utf16_length() + 1) / 2
+                                           : decoder.utf16_length();
+    }
+    chunk->buffer.reset(new uint16_t[std::max<size_t>(buffer_size, 1)]);
+    for (size_t i = chunk->begin; i < chunk->end; ++i) {
+      Utf8Decoder& decoder = decoders[i - chunk->begin];
+      uint16_t* out = chunk->buffer.get() + offsets[i - chunk->begin];
+      DecodedString& string = strings_[i];
+      string.chars = reinterpret_cast<const uint8_t*>(out);
+      string.length = decoder.utf16_length();
+      string.is_one_byte = decoder.is_one_byte();
+      if (string.is_one_byte) {
+        decoder.Decode(reinterpret_cast<uint8_t*>(out), utf8_strings_[i]);
+      } else {
+        decoder.Decode(out, utf8_strings_[i]);
+      }
+    }
+  }
+
+  const std::vector<base::Vector<const uint8_t>>& utf8_strings_;
+  std::vector<DecodedString> strings_;
+  std::vector<Chunk> chunks_;
+};
+
+}  // namespace
+
 constexpr uint8_t WebSnapshotSerializerDeserializer::kMagicNumber[4];
+constexpr uint32_t WebSnapshotSerializerDeserializer::kFormatVersion;
 constexpr int WebSnapshotSerializerDeserializer::kBuiltinObjectCount;
 
 // When encountering an error during deserializing, we note down the error but
@@ -429,13 +585,25 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
       context_serializer_.buffer_size_ + function_serializer_.buffer_size_ +
       class_serializer_.buffer_size_ + array_serializer_.buffer_size_ +
       object_serializer_.buffer_size_ + export_serializer_.buffer_size_ +
-      8 * sizeof(uint32_t);
+      (2 * kSectionCount + 1) * kMaxVarintSize;
   if (total_serializer.ExpandBuffer(needed_size).IsNothing()) {
     Throw("Out of memory");
     return;
   }
 
   total_serializer.WriteRawBytes(kMagicNumber, 4);
+  total_serializer.WriteUint32(kFormatVersion);
+  WriteSectionSize(total_serializer, string_count(), string_serializer_);
+  WriteSectionSize(total_serializer, symbol_count(), symbol_serializer_);
+  WriteSectionSize(total_serializer, builtin_object_count(),
+                   builtin_object_serializer_);
+  WriteSectionSize(total_serializer, map_count(), map_serializer_);
+  WriteSectionSize(total_serializer, context_count(), context_serializer_);
+  WriteSectionSize(total_serializer, function_count(), function_serializer_);
+  WriteSectionSize(total_serializer, array_count(), array_serializer_);
+  WriteSectionSize(total_serializer, object_count(), object_serializer_);
+  WriteSectionSize(total_serializer, class_count(), class_serializer_);
+  WriteSectionSize(total_serializer, export_count_, export_serializer_);
   WriteObjects(total_serializer, string_count(), string_serializer_, "strings");
   WriteObjects(total_serializer, symbol_count(), symbol_serializer_, "symbols");
   WriteObjects(total_serializer, builtin_object_count(),
@@ -469,6 +637,19 @@ void WebSnapshotSerializer::WriteObjects(ValueSerializer& destination,
   destination.WriteRawBytes(source.buffer_, source.buffer_size_);
 }
 
+void WebSnapshotSerializer::WriteSectionSize(ValueSerializer& destination,
+                                             size_t count,
+                                             const ValueSerializer& source) {
+  // The section consists of what WriteObjects writes: the item count followed
+  // by the items.
+  size_t size = VarintSize(count) + source.buffer_size_;
+  if (size > std::numeric_limits<uint32_t>::max()) {
+    Throw("Too large section");
+    return;
+  }
+  destination.WriteUint32(static_cast<uint32_t>(size));
+}
+
 bool WebSnapshotSerializer::InsertIntoIndexMap(ObjectCacheIndexMap& map,
                                                HeapObject heap_object,
                                                uint32_t& id) {
@@ -1728,23 +1909,68 @@ bool WebSnapshotDeserializer::DeserializeSnapshot(bool skip_exports) {
     Throw("Invalid magic number");
     return false;
   }
+  if (!ReadSectionIndex()) return false;
 
   DeserializeStrings();
+  CheckSectionEnd(kStringSection);
   DeserializeSymbols();
+  CheckSectionEnd(kSymbolSection);
   DeserializeBuiltinObjects();
+  CheckSectionEnd(kBuiltinObjectSection);
   DeserializeMaps();
+  CheckSectionEnd(kMapSection);
   DeserializeContexts();
+  CheckSectionEnd(kContextSection);
   DeserializeFunctions();
+  CheckSectionEnd(kFunctionSection);
   DeserializeArrays();
+  CheckSectionEnd(kArraySection);
   DeserializeObjects();
+  CheckSectionEnd(kObjectSection);
   DeserializeClasses();
+  CheckSectionEnd(kClassSection);
   ProcessDeferredReferences();
   DeserializeExports(skip_exports);
+  CheckSectionEnd(kExportSection);
   DCHECK_EQ(0, deferred_references_->Length());
 
   return !has_error();
 }
 
+bool WebSnapshotDeserializer::ReadSectionIndex() {
+  uint32_t version;
+  if (!deserializer_.ReadUint32(&version) || version != kFormatVersion) {
+    Throw("Unsupported format version");
+    return false;
+  }
+  uint32_t section_sizes[kSectionCount];
+  for (int i = 0; i < kSectionCount; ++i) {
+    if (!deserializer_.ReadUint32(&section_sizes[i])) {
+      Throw("Malformed section index");
+      return false;
+    }
+  }
+  // Anything after the sections is treated as a script.
+  const uint8_t* section_end = deserializer_.position_;
+  for (int i = 0; i < kSectionCount; ++i) {
+    if (section_sizes[i] >
+        static_cast<size_t>(deserializer_.end_ - section_end)) {
+      Throw("Malformed section index");
+      return false;
+    }
+    section_end += section_sizes[i];
+    section_ends_[i] = section_end;
+  }
+  return true;
+}
+
+void WebSnapshotDeserializer::CheckSectionEnd(Section section) {
+  if (has_error()) return;
+  if (deserializer_.position_ != section_ends_[section]) {
+    Throw("Malformed section");
+  }
+}
+
 void WebSnapshotDeserializer::CollectBuiltinObjects() {
   // TODO(v8:11525): Look up the builtin objects from the global object.
   builtin_object_name_to_object_ =
@@ -1813,6 +2039,11 @@ void WebSnapshotDeserializer::DeserializeStrings() {
   STATIC_ASSERT(kMaxItemCount <= FixedArray::kMaxLength);
   strings_handle_ = factory()->NewFixedArray(string_count_);
   strings_ = *strings_handle_;
+  if (ConcurrentStringDecoder::ShouldDecodeConcurrently(static_cast<size_t>(
+          section_ends_[kStringSection] - deserializer_.position_))) {
+    DeserializeStringsConcurrently();
+    return;
+  }
   for (uint32_t i = 0; i < string_count_; ++i) {
     MaybeHandle<String> maybe_string =
         deserializer_.ReadUtf8String(AllocationType::kOld);
@@ -1825,6 +2056,33 @@ void WebSnapshotDeserializer::DeserializeStrings() {
   }
 }
 
+void WebSnapshotDeserializer::DeserializeStringsConcurrently() {
+  // Find the strings on the main thread, which only needs to read their
+  // lengths.
+  std::vector<base::Vector<const uint8_t>> utf8_strings(string_count_);
+  for (uint32_t i = 0; i < string_count_; ++i) {
+    uint32_t utf8_length;
+    const void* utf8_data;
+    if (!deserializer_.ReadUint32(&utf8_length) ||
+        !deserializer_.ReadRawBytes(utf8_length, &utf8_data)) {
+      Throw("Malformed string");
+      return;
+    }
+    utf8_strings[i] = {static_cast<const uint8_t*>(utf8_data), utf8_length};
+  }
+
+  ConcurrentStringDecoder decoder(utf8_strings);
+  decoder.Decode();
+  for (uint32_t i = 0; i < string_count_; ++i) {
+    Handle<String> string;
+    if (!decoder.NewString(factory(), i).ToHandle(&string)) {
+      Throw("Malformed string");
+      return;
+    }
+    strings_.set(i, *string);
+  }
+}
+
 String WebSnapshotDeserializer::ReadString(
     InternalizeStrings internalize_strings) {
   DCHECK(!strings_handle_->is_null());
@@ -68,6 +68,25 @@ class WebSnapshotSerializerDeserializer {
   };
 
   static constexpr uint8_t kMagicNumber[4] = {'+', '+', '+', ';'};
+  static constexpr uint32_t kFormatVersion = 1;
+
+  // The sections of a snapshot, in the order in which they are written. The
+  // magic number and the format version are followed by the byte length of
+  // each section, so that a section can be located without parsing the ones
+  // before it.
+  enum Section : uint8_t {
+    kStringSection,
+    kSymbolSection,
+    kBuiltinObjectSection,
+    kMapSection,
+    kContextSection,
+    kFunctionSection,
+    kArraySection,
+    kObjectSection,
+    kClassSection,
+    kExportSection,
+    kSectionCount
+  };
 
   enum ContextType : uint8_t { FUNCTION, BLOCK };
 
@@ -194,6 +213,8 @@ class V8_EXPORT WebSnapshotSerializer
   void WriteSnapshot(uint8_t*& buffer, size_t& buffer_size);
   void WriteObjects(ValueSerializer& destination, size_t count,
                     ValueSerializer& source, const char* name);
+  void WriteSectionSize(ValueSerializer& destination, size_t count,
+                        const ValueSerializer& source);
 
   // Returns true if the object was already in the map, false if it was added.
   bool InsertIntoIndexMap(ObjectCacheIndexMap& map, HeapObject heap_object,
@@ -372,6 +393,8 @@ class V8_EXPORT WebSnapshotDeserializer
   base::Vector<const uint8_t> ExtractScriptBuffer(
       Isolate* isolate, Handle<Script> snapshot_as_script);
   bool DeserializeSnapshot(bool skip_exports);
+  bool ReadSectionIndex();
+  void CheckSectionEnd(Section section);
   void CollectBuiltinObjects();
   bool DeserializeScript();
 
@@ -379,6 +402,7 @@ class V8_EXPORT WebSnapshotDeserializer
   WebSnapshotDeserializer& operator=(const WebSnapshotDeserializer&) = delete;
 
   void DeserializeStrings();
+  void DeserializeStringsConcurrently();
   void DeserializeSymbols();
   void DeserializeMaps();
   void DeserializeBuiltinObjects();
@@ -491,6 +515,9 @@ class V8_EXPORT WebSnapshotDeserializer
   uint32_t object_count_ = 0;
   uint32_t current_object_count_ = 0;
 
+  // Where each section ends in the buffer, according to the section index.
+  const uint8_t* section_ends_[kSectionCount] = {};
+
   ValueDeserializer deserializer_;
   ReadOnlyRoots roots_;
 
@@ -4,12 +4,18 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
+#include "src/base/sanitizer/asan.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -65,8 +71,207 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
   return allocator;
 }
 
+// Each thread takes the pool shard with this index, so that threads running
+// concurrent compilation jobs mostly use different shards.
+thread_local int segment_pool_shard = -1;
+std::atomic<int> next_segment_pool_shard{0};
+
 }  // namespace
 
+// Keeps returned segments in buckets of power-of-two sizes, so that zones of
+// later compilation jobs can reuse them instead of going to malloc again.
+// Segments which were not needed for --zone-segment-pool-decay-ms are freed.
+class AccountingAllocator::SegmentPool final {
+ public:
+  // Smaller segments are rare, as zones start with 8 KB segments. Larger ones
+  // are only used for very large allocations.
+  static constexpr int kMinSizeLog2 = 13;
+  static constexpr int kMaxSizeLog2 = 18;
+  static constexpr int kNumBuckets = kMaxSizeLog2 - kMinSizeLog2 + 1;
+  static constexpr int kNumShards = 8;
+
+  SegmentPool(size_t max_pooled_bytes, base::TimeDelta decay_interval,
+              ZoneBackingAllocator::FreeFn free)
+      : max_pooled_bytes_(max_pooled_bytes),
+        decay_interval_(decay_interval),
+        free_(free),
+        next_decay_(base::TimeTicks::Now() + decay_interval) {}
+
+  ~SegmentPool() { ReleaseAll(); }
+
+  // Returns the bucket size which segments of {bytes} are rounded up to, or 0
+  // if segments of that size are not pooled.
+  static size_t BucketSize(size_t bytes) {
+    if (bytes < (size_t{1} << kMinSizeLog2) ||
+        bytes > (size_t{1} << kMaxSizeLog2)) {
+      return 0;
+    }
+    return base::bits::RoundUpToPowerOfTwo64(bytes);
+  }
+
+  // Returns a pooled segment of {bucket_size}, preferably one returned on the
+  // current thread, or nullptr if there is none.
+  Segment* Get(size_t bucket_size) {
+    int bucket = BucketIndex(bucket_size);
+    int own_shard = CurrentShardIndex();
+    for (int i = 0; i < kNumShards; ++i) {
+      Shard& shard = shards_[(own_shard + i) % kNumShards];
+      if (shard.pooled_segments.load(std::memory_order_relaxed) == 0) continue;
+      base::MutexGuard guard(&shard.mutex);
+      Bucket& b = shard.buckets[bucket];
+      if (b.head == nullptr) continue;
+      Segment* segment = b.head;
+      b.head = segment->next();
+      b.count--;
+      b.low_water = std::min(b.low_water, b.count);
+      shard.pooled_segments.fetch_sub(1, std::memory_order_relaxed);
+      pooled_bytes_.fetch_sub(bucket_size, std::memory_order_relaxed);
+      hits_.fetch_add(1, std::memory_order_relaxed);
+      ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                                  segment->capacity());
+      return segment;
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  // Adds {segment} to the pool. Returns false if it does not fit, in which
+  // case the caller frees it.
+  bool Put(Segment* segment) {
+    size_t size = segment->total_size();
+    if (BucketSize(size) != size) return false;
+    MaybeDecay();
+    size_t pooled = pooled_bytes_.load(std::memory_order_relaxed);
+    do {
+      if (pooled + size > max_pooled_bytes_) return false;
+    } while (!pooled_bytes_.compare_exchange_weak(pooled, pooled + size,
+                                                  std::memory_order_relaxed));
+    ASAN_POISON_MEMORY_REGION(reinterpret_cast<void*>(segment->start()),
+                              segment->capacity());
+    segment->set_zone(nullptr);
+    Shard& shard = shards_[CurrentShardIndex()];
+    base::MutexGuard guard(&shard.mutex);
+    Bucket& b = shard.buckets[BucketIndex(size)];
+    segment->set_next(b.head);
+    b.head = segment;
+    b.count++;
+    shard.pooled_segments.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  void ReleaseAll() { Release(false); }
+
+  SegmentPoolStats GetStats() const {
+    SegmentPoolStats stats;
+    stats.pooled_bytes = pooled_bytes_.load(std::memory_order_relaxed);
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.misses = misses_.load(std::memory_order_relaxed);
+    stats.released_bytes = released_bytes_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  struct Bucket {
+    // Most recently returned segment first.
+    Segment* head = nullptr;
+    size_t count = 0;
+    // The smallest {count} since the last decay. That many segments were not
+    // needed during the last decay interval.
+    size_t low_water = 0;
+  };
+
+  struct Shard {
+    base::Mutex mutex;
+    Bucket buckets[kNumBuckets];
+    // Allows to skip empty shards without taking {mutex}.
+    std::atomic<size_t> pooled_segments{0};
+  };
+
+  static int BucketIndex(size_t bucket_size) {
+    DCHECK_EQ(BucketSize(bucket_size), bucket_size);
+    return base::bits::WhichPowerOfTwo(bucket_size) - kMinSizeLog2;
+  }
+
+  static int CurrentShardIndex() {
+    if (V8_UNLIKELY(segment_pool_shard < 0)) {
+      segment_pool_shard =
+          next_segment_pool_shard.fetch_add(1, std::memory_order_relaxed) %
+          kNumShards;
+    }
+    return segment_pool_shard;
+  }
+
+  void MaybeDecay() {
+    base::TimeTicks now = base::TimeTicks::Now();
+    base::TimeTicks next_decay = next_decay_.load(std::memory_order_relaxed);
+    if (now < next_decay) return;
+    // Only one thread decays the pool per interval.
+    if (!next_decay_.compare_exchange_strong(next_decay,
+                                             now + decay_interval_,
+                                             std::memory_order_relaxed)) {
+      return;
+    }
+    Release(true);
+  }
+
+  // Frees the segments which were not needed since the last decay if {decay}
+  // is true, or all segments otherwise.
+  void Release(bool decay) {
+    for (Shard& shard : shards_) {
+      Segment* released = nullptr;
+      {
+        base::MutexGuard guard(&shard.mutex);
+        for (Bucket& b : shard.buckets) {
+          size_t keep = decay ? b.count - b.low_water : 0;
+          // Keep the most recently returned segments.
+          Segment* last_kept = nullptr;
+          Segment* segment = b.head;
+          for (size_t i = 0; i < keep; ++i) {
+            last_kept = segment;
+            segment = segment->next();
+          }
+          if (last_kept == nullptr) {
+            b.head = nullptr;
+          } else {
+            last_kept->set_next(nullptr);
+          }
+          while (segment != nullptr) {
+            Segment* next = segment->next();
+            segment->set_next(released);
+            released = segment;
+            segment = next;
+            b.count--;
+            shard.pooled_segments.fetch_sub(1, std::memory_order_relaxed);
+          }
+          DCHECK_EQ(keep, b.count);
+          b.low_water = b.count;
+        }
+      }
+      while (released != nullptr) {
+        Segment* next = released->next();
+        size_t size = released->total_size();
+        pooled_bytes_.fetch_sub(size, std::memory_order_relaxed);
+        released_bytes_.fetch_add(size, std::memory_order_relaxed);
+        ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<void*>(released->start()),
+                                    released->capacity());
+        released->ZapHeader();
+        free_(released);
+        released = next;
+      }
+    }
+  }
+
+  const size_t max_pooled_bytes_;
+  const base::TimeDelta decay_interval_;
+  const ZoneBackingAllocator::FreeFn free_;
+  std::atomic<base::TimeTicks> next_decay_;
+  Shard shards_[kNumShards];
+  std::atomic<size_t> pooled_bytes_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+  std::atomic<size_t> released_bytes_{0};
+};
+
 AccountingAllocator::AccountingAllocator()
     : zone_backing_malloc_(
           V8::GetCurrentPlatform()->GetZoneBackingAllocator()->GetMallocFn()),
@@ -79,10 +284,25 @@ AccountingAllocator::AccountingAllocator()
     bounded_page_allocator_ = CreateBoundedAllocator(platform_page_allocator,
                                                      reserved_area_->address());
   }
+  if (FLAG_zone_segment_pool_size > 0) {
+    segment_pool_ = std::make_unique<SegmentPool>(
+        FLAG_zone_segment_pool_size,
+        base::TimeDelta::FromMilliseconds(FLAG_zone_segment_pool_decay_ms),
+        zone_backing_free_);
+  }
 }
 
 AccountingAllocator::~AccountingAllocator() = default;
 
+AccountingAllocator::SegmentPoolStats
+AccountingAllocator::GetSegmentPoolStats() const {
+  return segment_pool_ ? segment_pool_->GetStats() : SegmentPoolStats{};
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  if (segment_pool_) segment_pool_->ReleaseAll();
+}
+
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
   void* memory;
@@ -92,7 +312,14 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
   } else {
-    memory = AllocWithRetry(bytes, zone_backing_malloc_);
+    size_t bucket_size = segment_pool_ ? SegmentPool::BucketSize(bytes) : 0;
+    if (bucket_size != 0) {
+      bytes = bucket_size;
+      memory = segment_pool_->Get(bucket_size);
+    } else {
+      memory = nullptr;
+    }
+    if (memory == nullptr) memory = AllocWithRetry(bytes, zone_backing_malloc_);
   }
   if (memory == nullptr) return nullptr;
 
@@ -112,10 +339,11 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
-  } else {
+  } else if (!segment_pool_ || !segment_pool_->Put(segment)) {
+    segment->ZapHeader();
     zone_backing_free_(segment);
   }
 }
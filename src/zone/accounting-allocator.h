@@ -46,6 +46,23 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  struct SegmentPoolStats {
+    // Bytes of returned segments kept for reuse. They are not included in
+    // {GetCurrentMemoryUsage}.
+    size_t pooled_bytes = 0;
+    // Segment allocations served from the pool and from the backing
+    // allocator, respectively.
+    size_t hits = 0;
+    size_t misses = 0;
+    // Bytes of pooled segments freed because of decay or memory pressure.
+    size_t released_bytes = 0;
+  };
+
+  SegmentPoolStats GetSegmentPoolStats() const;
+
+  // Frees all pooled segments. Can be called from any thread.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,6 +84,8 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  class SegmentPool;
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
@@ -75,6 +94,10 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   ZoneBackingAllocator::MallocFn zone_backing_malloc_ = nullptr;
   ZoneBackingAllocator::FreeFn zone_backing_free_ = nullptr;
+
+  // Pools returned uncompressed segments, nullptr if disabled by
+  // --zone-segment-pool-size.
+  std::unique_ptr<SegmentPool> segment_pool_;
 };
 
 }  // namespace internal
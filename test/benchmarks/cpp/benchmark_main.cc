@@ -0,0 +1,20 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+// Expanded macro BENCHMARK_MAIN() to allow per-process setup. Benchmark flags
+// are parsed first, so that the remaining arguments can be V8 flags. Use
+// --benchmark_format=json or --benchmark_out=<file> for results which a
+// dashboard can compare.
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  v8::benchmarking::BenchmarkWithIsolate::InitializeProcess(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  v8::benchmarking::BenchmarkWithIsolate::ShutdownProcess();
+  return 0;
+}
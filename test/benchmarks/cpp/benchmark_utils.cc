@@ -0,0 +1,65 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/benchmark_utils.h"
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "include/v8-local-handle.h"
+#include "src/base/logging.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// static
+std::unique_ptr<v8::Platform> BenchmarkWithIsolate::platform_;
+
+// static
+void BenchmarkWithIsolate::InitializeProcess(int* argc, char** argv) {
+  v8::V8::SetFlagsFromCommandLine(argc, argv, true);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  platform_ = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform_.get());
+#ifdef V8_SANDBOX
+  CHECK(v8::V8::InitializeSandbox());
+#endif  // V8_SANDBOX
+  v8::V8::Initialize();
+}
+
+// static
+void BenchmarkWithIsolate::ShutdownProcess() {
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  platform_.reset();
+}
+
+void BenchmarkWithIsolate::SetUp(::benchmark::State& state) {
+  array_buffer_allocator_.reset(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator_.get();
+  v8_isolate_ = v8::Isolate::New(create_params);
+  CHECK_NOT_NULL(v8_isolate_);
+  v8_isolate_->Enter();
+  v8::HandleScope handle_scope(v8_isolate_);
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate_);
+  context_.Reset(v8_isolate_, context);
+  context->Enter();
+}
+
+void BenchmarkWithIsolate::TearDown(::benchmark::State& state) {
+  {
+    v8::HandleScope handle_scope(v8_isolate_);
+    context_.Get(v8_isolate_)->Exit();
+  }
+  context_.Reset();
+  v8_isolate_->Exit();
+  v8_isolate_->Dispose();
+  v8_isolate_ = nullptr;
+  array_buffer_allocator_.reset();
+}
+
+}  // namespace benchmarking
+}  // namespace v8
@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
+#define TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-platform.h"
+#include "src/execution/isolate.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace benchmarking {
+
+// Creates an isolate with an entered context for each benchmark run, so that
+// benchmarks can drive internal subsystems directly.
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ public:
+  static void InitializeProcess(int* argc, char** argv);
+  static void ShutdownProcess();
+
+ protected:
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+  v8::Isolate* v8_isolate() const { return v8_isolate_; }
+  internal::Isolate* isolate() const {
+    return reinterpret_cast<internal::Isolate*>(v8_isolate_);
+  }
+  internal::Factory* factory() const { return isolate()->factory(); }
+  internal::Heap* heap() const { return isolate()->heap(); }
+
+ private:
+  static std::unique_ptr<v8::Platform> platform_;
+
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+}  // namespace benchmarking
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
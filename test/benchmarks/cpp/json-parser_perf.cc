@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory-inl.h"
+#include "src/json/json-parser.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using JsonParse = benchmarking::BenchmarkWithIsolate;
+
+// An array of records with the usual mix of integers, doubles, strings,
+// nested arrays and a repeating set of property names.
+std::string MakeRecordsJson(int count) {
+  std::string json = "[";
+  for (int i = 0; i < count; ++i) {
+    if (i != 0) json += ",";
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"record " +
+            std::to_string(i) +
+            "\",\"score\":" + std::to_string(i * 0.25) +
+            ",\"active\":true,\"tags\":[\"a\",\"b\",\"c\"],\"parent\":null}";
+  }
+  json += "]";
+  return json;
+}
+
+BENCHMARK_F(JsonParse, Records)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  std::string json = MakeRecordsJson(1000);
+  Handle<String> source = factory()->NewStringFromAsciiChecked(json.c_str());
+  Handle<Object> reviver = factory()->undefined_value();
+  for (auto _ : st) {
+    USE(_);
+    HandleScope iteration_scope(isolate());
+    benchmark::DoNotOptimize(
+        JsonParser<uint8_t>::Parse(isolate(), source, reviver)
+            .ToHandleChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json.size());
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
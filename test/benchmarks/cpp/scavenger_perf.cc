@@ -0,0 +1,54 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/fixed-array-inl.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Scavenge = benchmarking::BenchmarkWithIsolate;
+
+constexpr int kObjectCount = 10000;
+
+// Measures young generation collections in which all objects survive.
+BENCHMARK_F(Scavenge, SurvivingObjects)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    HandleScope handle_scope(isolate());
+    Handle<FixedArray> objects = factory()->NewFixedArray(kObjectCount);
+    for (int i = 0; i < kObjectCount; ++i) {
+      objects->set(i, *factory()->NewHeapNumber(i));
+    }
+    st.ResumeTiming();
+    heap()->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+  }
+  st.SetItemsProcessed(st.iterations() * kObjectCount);
+}
+
+// Measures young generation collections in which all objects die.
+BENCHMARK_F(Scavenge, DeadObjects)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    {
+      HandleScope handle_scope(isolate());
+      for (int i = 0; i < kObjectCount; ++i) factory()->NewHeapNumber(i);
+    }
+    st.ResumeTiming();
+    heap()->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+  }
+  st.SetItemsProcessed(st.iterations() * kObjectCount);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,44 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "src/base/macros.h"
+#include "src/strings/string-hasher-inl.h"
+#include "src/utils/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// Hashes one-byte strings of the given length.
+void BM_StringHasherOneByte(benchmark::State& st) {
+  std::string string(static_cast<size_t>(st.range(0)), 'a');
+  for (size_t i = 0; i < string.size(); ++i) string[i] += i % 26;
+  const uint8_t* chars = reinterpret_cast<const uint8_t*>(string.data());
+  int length = static_cast<int>(string.size());
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        StringHasher::HashSequentialString(chars, length, kZeroHashSeed));
+  }
+  st.SetBytesProcessed(st.iterations() * length);
+}
+BENCHMARK(BM_StringHasherOneByte)->Arg(8)->Arg(64)->Arg(1024);
+
+// Hashes strings of digits, which take the array index path.
+void BM_StringHasherArrayIndex(benchmark::State& st) {
+  const uint8_t* chars = reinterpret_cast<const uint8_t*>("123456789");
+  for (auto _ : st) {
+    USE(_);
+    benchmark::DoNotOptimize(
+        StringHasher::HashSequentialString(chars, 9, kZeroHashSeed));
+  }
+}
+BENCHMARK(BM_StringHasherArrayIndex);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
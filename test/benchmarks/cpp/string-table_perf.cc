@@ -0,0 +1,74 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory-inl.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using StringTableLookup = benchmarking::BenchmarkWithIsolate;
+
+constexpr int kStringCount = 1024;
+
+std::vector<std::string> MakeNames(const char* prefix) {
+  std::vector<std::string> names;
+  for (int i = 0; i < kStringCount; ++i) {
+    names.push_back(prefix + std::to_string(i));
+  }
+  return names;
+}
+
+BENCHMARK_F(StringTableLookup, Hit)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  std::vector<std::string> names = MakeNames("internalizedName");
+  for (const std::string& name : names) {
+    factory()->InternalizeUtf8String(base::CStrVector(name.c_str()));
+  }
+  for (auto _ : st) {
+    USE(_);
+    HandleScope iteration_scope(isolate());
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(factory()->InternalizeString(
+          base::Vector<const char>(name.data(), name.size())));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kStringCount);
+}
+
+BENCHMARK_F(StringTableLookup, HitNonInternalized)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  std::vector<std::string> names = MakeNames("internalizedName");
+  std::vector<Handle<String>> strings;
+  for (const std::string& name : names) {
+    factory()->InternalizeUtf8String(base::CStrVector(name.c_str()));
+  }
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    HandleScope iteration_scope(isolate());
+    // Internalizing a string turns it into a ThinString, so every iteration
+    // needs fresh copies.
+    strings.clear();
+    for (const std::string& name : names) {
+      strings.push_back(factory()->NewStringFromAsciiChecked(name.c_str()));
+    }
+    st.ResumeTiming();
+    for (Handle<String> string : strings) {
+      benchmark::DoNotOptimize(factory()->InternalizeString(string));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kStringCount);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
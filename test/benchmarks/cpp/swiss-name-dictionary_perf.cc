@@ -0,0 +1,79 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory-inl.h"
+#include "src/objects/swiss-name-dictionary-inl.h"
+#include "test/benchmarks/cpp/benchmark_utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using SwissNameDictionaryFind = benchmarking::BenchmarkWithIsolate;
+
+std::vector<Handle<Name>> MakeKeys(Factory* factory, const char* prefix,
+                                   int count) {
+  std::vector<Handle<Name>> keys;
+  for (int i = 0; i < count; ++i) {
+    std::string name = prefix + std::to_string(i);
+    keys.push_back(factory->InternalizeUtf8String(name.c_str()));
+  }
+  return keys;
+}
+
+Handle<SwissNameDictionary> MakeTable(Isolate* isolate,
+                                      const std::vector<Handle<Name>>& keys) {
+  Handle<SwissNameDictionary> table =
+      isolate->factory()->NewSwissNameDictionary(static_cast<int>(keys.size()));
+  for (size_t i = 0; i < keys.size(); ++i) {
+    table = SwissNameDictionary::Add(
+        isolate, table, keys[i],
+        handle(Smi::FromInt(static_cast<int>(i)), isolate),
+        PropertyDetails::Empty());
+  }
+  return table;
+}
+
+// Probes tables with the given number of entries for keys which are present.
+BENCHMARK_DEFINE_F(SwissNameDictionaryFind, Hit)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  int count = static_cast<int>(st.range(0));
+  std::vector<Handle<Name>> keys = MakeKeys(factory(), "key", count);
+  Handle<SwissNameDictionary> table = MakeTable(isolate(), keys);
+  for (auto _ : st) {
+    USE(_);
+    for (Handle<Name> key : keys) {
+      benchmark::DoNotOptimize(table->FindEntry(isolate(), *key));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(SwissNameDictionaryFind, Hit)->Arg(8)->Arg(64)->Arg(512);
+
+// Probes tables with the given number of entries for keys which are absent.
+BENCHMARK_DEFINE_F(SwissNameDictionaryFind, Miss)(benchmark::State& st) {
+  HandleScope handle_scope(isolate());
+  int count = static_cast<int>(st.range(0));
+  Handle<SwissNameDictionary> table =
+      MakeTable(isolate(), MakeKeys(factory(), "key", count));
+  std::vector<Handle<Name>> absent_keys = MakeKeys(factory(), "absent", count);
+  for (auto _ : st) {
+    USE(_);
+    for (Handle<Name> key : absent_keys) {
+      benchmark::DoNotOptimize(table->FindEntry(isolate(), *key));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * count);
+}
+BENCHMARK_REGISTER_F(SwissNameDictionaryFind, Miss)->Arg(8)->Arg(64)->Arg(512);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,34 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/macros.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+constexpr int kAllocationsPerZone = 1000;
+
+// Allocates objects of the given size in a fresh zone, including the cost of
+// releasing the zone's segments.
+void BM_ZoneAllocate(benchmark::State& st) {
+  AccountingAllocator allocator;
+  size_t size = static_cast<size_t>(st.range(0));
+  for (auto _ : st) {
+    USE(_);
+    Zone zone(&allocator, ZONE_NAME);
+    for (int i = 0; i < kAllocationsPerZone; ++i) {
+      benchmark::DoNotOptimize(zone.Allocate<void>(size));
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * kAllocationsPerZone * size);
+}
+BENCHMARK(BM_ZoneAllocate)->Arg(8)->Arg(64)->Arg(512);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
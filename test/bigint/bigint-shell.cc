@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -36,6 +39,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -123,6 +127,26 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs parallel tasks on new threads, to test their results against the
+// sequential implementation.
+class ThreadPlatform : public Platform {
+ public:
+  static constexpr int kThreads = 4;
+
+  int MaxParallelism() override { return kThreads; }
+
+  void RunInParallel(ParallelTask* task, int count) override {
+    std::atomic<int> next_index{0};
+    auto work = [&]() {
+      for (int i = next_index++; i < count; i = next_index++) task->Run(i);
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < kThreads; i++) threads.emplace_back(work);
+    work();
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -130,12 +154,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -204,6 +233,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -311,6 +344,33 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // Random samples around the thresholds for parallel Toom-Cook and FFT
+    // multiplication, compared against the sequential results.
+    const int kSizes[] = {kToomParallelThreshold / 2, kFftThreshold,
+                          kFftParallelThreshold / 2, 2 * kFftParallelThreshold};
+    for (int size : kSizes) {
+      uint64_t random_bits = rng_.NextUint64();
+      int right_size = size + static_cast<int>(random_bits & 255);
+      random_bits >>= 8;
+      int left_size = right_size + static_cast<int>(random_bits & 1023);
+      ScratchDigits A(left_size);
+      ScratchDigits B(right_size);
+      int result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_sequential(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->Multiply(result, A, B);
+      processor()->Multiply(result_sequential, A, B);
+      AssertEquals(A, B, result_sequential, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
@@ -601,6 +661,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
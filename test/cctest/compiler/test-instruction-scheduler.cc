@@ -6,6 +6,7 @@
 #include "src/compiler/backend/instruction-selector-impl.h"
 #include "src/compiler/backend/instruction.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -51,6 +52,7 @@ class InstructionSchedulerTester {
   }
 
   Zone* zone() { return scope_.main_zone(); }
+  const InstructionScheduler& scheduler() const { return scheduler_; }
 
  private:
   InstructionScheduler::ScheduleGraphNode* GetNode(Instruction* instr) {
@@ -104,6 +106,37 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(EstimatedCycles) {
+  FlagScope<bool> trace_scheduling(&FLAG_trace_turbo_instruction_scheduling,
+                                   true);
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  // A truncation whose result is used right away, followed by an independent
+  // instruction that can be scheduled while waiting for the result.
+  tester.StartBlock();
+  InstructionOperand truncated =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0);
+  InstructionOperand input =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1);
+  InstructionOperand independent =
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2);
+  tester.AddInstruction(
+      Instruction::New(zone, kArchTruncateDoubleToI, 1, &truncated, 1, &input,
+                       0, nullptr));
+  tester.AddInstruction(
+      Instruction::New(zone, kArchNop, 0, nullptr, 1, &truncated, 0, nullptr));
+  tester.AddInstruction(
+      Instruction::New(zone, kArchNop, 1, &independent, 0, nullptr, 0,
+                       nullptr));
+  tester.AddTerminator(Instruction::New(zone, kArchRet));
+  tester.EndBlock();
+
+  CHECK_LE(4, tester.scheduler().original_cycles());
+  CHECK_LE(tester.scheduler().scheduled_cycles(),
+           tester.scheduler().original_cycles());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
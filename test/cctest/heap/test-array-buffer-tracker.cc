@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+
 #include "src/api/api-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/array-buffer-sweeper.h"
@@ -478,6 +480,65 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+namespace {
+
+class BatchCountingAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    allocator_->Free(data, length);
+  }
+  void FreeBatch(void* const* data, const size_t* lengths,
+                 size_t count) override {
+    batched_frees_ += count;
+    v8::ArrayBuffer::Allocator::FreeBatch(data, lengths, count);
+  }
+
+  size_t batched_frees() const { return batched_frees_; }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_{
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator()};
+  std::atomic<size_t> batched_frees_{0};
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ArrayBuffer_SweeperFreesInBatches) {
+  ManualGCScope manual_gc_scope;
+  BatchCountingAllocator allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    // Enough buffers to be split into several chunks.
+    const size_t kNumberOfBuffers = 3000;
+    {
+      v8::HandleScope inner_scope(isolate);
+      for (size_t i = 0; i < kNumberOfBuffers; i++) {
+        v8::ArrayBuffer::New(isolate, 16);
+      }
+    }
+    const size_t batched_frees_before = allocator.batched_frees();
+    CcTest::CollectAllGarbage(i_isolate);
+    heap->array_buffer_sweeper()->EnsureFinished();
+    CHECK_LE(batched_frees_before + kNumberOfBuffers,
+             allocator.batched_frees());
+  }
+  isolate->Dispose();
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
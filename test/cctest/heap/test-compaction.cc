@@ -496,6 +496,49 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithRememberedSetEntries) {
   heap->RemoveNearHeapLimitCallback(reset_oom, 0u);
 }
 
+#ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+HEAP_TEST(CompactionPinnedByConservativeStackReference) {
+  if (!FLAG_compact) return;
+  // Test that an evacuation candidate holding an object that is only
+  // referenced from a raw stack slot is not evacuated.
+
+  ManualGCScope manual_gc_scope;
+  FLAG_manual_evacuation_candidates_selection = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    Page* pinned_page = nullptr;
+    volatile Address raw_object = kNullAddress;
+    {
+      HandleScope scope2(isolate);
+      CHECK(heap->old_space()->Expand());
+      auto compaction_page_handles = heap::CreatePadding(
+          heap,
+          static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+          AllocationType::kOld);
+      pinned_page = Page::FromHeapObject(*compaction_page_handles.front());
+      pinned_page->SetFlag(MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+      CheckAllObjectsOnPage(compaction_page_handles, pinned_page);
+      raw_object = compaction_page_handles.front()->address();
+    }
+
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted(
+        MarkCompactCollector::SweepingForcedFinalizationMode::kV8Only);
+
+    // The object was kept alive and in place by the stack slot.
+    CHECK_EQ(pinned_page, Page::FromAddress(raw_object));
+    CHECK(HeapObject::FromAddress(raw_object).IsFixedArray());
+    CheckInvariantsOfAbortedPage(pinned_page);
+  }
+}
+#endif  // V8_ENABLE_CONSERVATIVE_STACK_SCANNING
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
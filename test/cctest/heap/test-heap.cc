@@ -52,6 +52,7 @@
 #include "src/heap/memory-chunk.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/parked-scope.h"
+#include "src/heap/pretenuring-sampler.h"
 #include "src/heap/remembered-set-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/ic/ic.h"
@@ -59,6 +60,7 @@
 #include "src/objects/call-site-info-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/field-type.h"
+#include "src/objects/foreign-inl.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-collection-inl.h"
@@ -1163,6 +1165,151 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+static Handle<JSFunction> CompileBytecodeFlushingTestFunction(
+    Isolate* i_isolate) {
+  const char* source =
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = 42;"
+      "  var z = x + y;"
+      "};"
+      "foo()";
+  {
+    v8::HandleScope new_scope(CcTest::isolate());
+    CompileRun(source);
+  }
+  Handle<Object> func_value =
+      Object::GetProperty(i_isolate, i_isolate->global_object(),
+                          i_isolate->factory()->InternalizeUtf8String("foo"))
+          .ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  CHECK(function->shared().is_compiled());
+  return function;
+}
+
+TEST(TestBytecodeFlushingOverBudget) {
+#ifndef V8_LITE_MODE
+  FLAG_turbofan = false;
+  FLAG_always_turbofan = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  // No bytecode fits into the budget, so everything that did not run since
+  // the previous full GC is flushed.
+  isolate->SetBytecodeFlushingBudget(1);
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Handle<JSFunction> function =
+        CompileBytecodeFlushingTestFunction(i_isolate);
+    CHECK(!function->shared().bytecode_was_flushed());
+
+    // The first GC lowers the flush age, the next ones flush.
+    const int kAgingThreshold = 3;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!function->shared().is_compiled());
+    CHECK(function->shared().bytecode_was_flushed());
+
+    // Recompiling clears the bit again.
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK(!function->shared().bytecode_was_flushed());
+  }
+  isolate->SetBytecodeFlushingBudget(0);
+}
+
+TEST(TestBytecodeFlushingWithinBudget) {
+#ifndef V8_LITE_MODE
+  FLAG_turbofan = false;
+  FLAG_always_turbofan = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  // All bytecode fits into the budget, so it is only flushed once it reaches
+  // the highest age, rather than BytecodeArray::kIsOldBytecodeAge.
+  isolate->SetBytecodeFlushingBudget(64 * MB);
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Handle<JSFunction> function =
+        CompileBytecodeFlushingTestFunction(i_isolate);
+
+    for (int i = 0; i <= BytecodeArray::kIsOldBytecodeAge; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(function->shared().is_compiled());
+
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!function->shared().is_compiled());
+  }
+  isolate->SetBytecodeFlushingBudget(0);
+}
+
+TEST(TestFeedbackVectorFlushing) {
+#ifndef V8_LITE_MODE
+  FLAG_turbofan = false;
+  FLAG_always_turbofan = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+#if ENABLE_SPARKPLUG
+  FLAG_always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_flush_feedback_vectors = true;
+  i::FLAG_flush_feedback_vector_age = 1;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Handle<JSFunction> function =
+        CompileBytecodeFlushingTestFunction(i_isolate);
+    CompileRun("%EnsureFeedbackVectorForFunction(foo); foo();");
+    CHECK(function->has_feedback_vector());
+
+    // The bytecode is at least one GC old after the second GC, but still
+    // younger than BytecodeArray::kIsOldBytecodeAge.
+    CcTest::CollectAllGarbage();
+    CcTest::CollectAllGarbage();
+    CHECK(!function->has_feedback_vector());
+    CHECK(function->has_closure_feedback_cell_array());
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+
+    // The function still runs, and gets a new feedback vector.
+    CompileRun("%EnsureFeedbackVectorForFunction(foo); foo();");
+    CHECK(function->has_feedback_vector());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -1537,6 +1684,55 @@ TEST(CompilationCacheCachingBehavior) {
   }
 }
 
+TEST(CompilationCacheLeastRecentlyUsedEviction) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_compilation_cache_script_size = 4;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
+  v8::HandleScope outer_scope(CcTest::isolate());
+
+  // Each script is about a tenth of the budget.
+  const std::string padding(300, ' ');
+  auto script_source = [&](const char* name) {
+    return std::string("var ") + name + " = 0;" + padding;
+  };
+  auto is_cached = [&](const std::string& raw_source) {
+    v8::HandleScope scope(CcTest::isolate());
+    Handle<String> source = factory->InternalizeUtf8String(raw_source.c_str());
+    ScriptDetails script_details(Handle<Object>(),
+                                 v8::ScriptOriginOptions(true, false));
+    return !compilation_cache->LookupScript(source, script_details,
+                                            language_mode)
+                .is_null();
+  };
+
+  const std::string hot = script_source("hot");
+  const std::string first_cold = script_source("cold0");
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(hot.c_str());
+    CompileRun(first_cold.c_str());
+  }
+  CHECK(is_cached(hot));
+  CHECK(is_cached(first_cold));
+
+  // Compiling many more scripts than fit exceeds the budget several times.
+  // The hot script is used in between and survives, unlike the scripts
+  // compiled before or after it that are not used again.
+  for (int i = 1; i < 50; i++) {
+    v8::HandleScope scope(CcTest::isolate());
+    std::string name = "cold" + std::to_string(i);
+    CompileRun(script_source(name.c_str()).c_str());
+    CHECK(is_cached(hot));
+  }
+  CHECK(!is_cached(first_cold));
+  CHECK(is_cached(script_source("cold49")));
+  FLAG_compilation_cache_script_size = 0;
+}
+
 
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
@@ -2097,6 +2293,41 @@ TEST(CollectingAllAvailableGarbageShrinksNewSpace) {
   CHECK_EQ(old_capacity, new_capacity);
 }
 
+TEST(SetMaxYoungGenerationSize) {
+  if (FLAG_single_generation) return;
+  // Avoid shrinking new space in GC epilogue.
+  FLAG_predictable = true;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  NewSpace* new_space = heap->new_space();
+  if (heap->MaxSemiSpaceSize() == heap->InitialSemiSpaceSize()) {
+    return;
+  }
+
+  CcTest::CollectAllGarbage();
+  GrowNewSpaceToMaximumCapacity(heap);
+  const size_t max_capacity = new_space->MaximumCapacity();
+  CHECK_EQ(max_capacity, new_space->TotalCapacity());
+
+  // Lowering the limit shrinks the new space after the next GC.
+  CcTest::isolate()->SetMaxYoungGenerationSize(
+      Heap::YoungGenerationSizeFromSemiSpaceSize(
+          heap->InitialSemiSpaceSize()));
+  CHECK_EQ(max_capacity, new_space->MaximumCapacity());
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK_EQ(heap->InitialSemiSpaceSize(), new_space->MaximumCapacity());
+  CHECK_EQ(heap->InitialSemiSpaceSize(), new_space->TotalCapacity());
+  CHECK_EQ(heap->InitialSemiSpaceSize(), heap->MaxSemiSpaceSize());
+
+  // Raising it again allows the new space to grow.
+  CcTest::isolate()->SetMaxYoungGenerationSize(
+      Heap::YoungGenerationSizeFromSemiSpaceSize(max_capacity));
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK_EQ(max_capacity, new_space->MaximumCapacity());
+  GrowNewSpaceToMaximumCapacity(heap);
+  CHECK_EQ(max_capacity, new_space->TotalCapacity());
+}
+
 static int NumberOfGlobalObjects() {
   int count = 0;
   HeapObjectIterator iterator(CcTest::heap());
@@ -2915,6 +3146,35 @@ TEST(OptimizedPretenuringNestedDoubleLiterals) {
   CHECK(CcTest::heap()->InOldSpace(double_array_handle_2->elements()));
 }
 
+TEST(AllocationSamplingPretenuringJsonParse) {
+  FLAG_allocation_sampling_pretenuring = true;
+  FLAG_allocation_sampling_pretenuring_interval = 256;
+  CcTest::InitializeVM();
+  if (FLAG_single_generation || FLAG_minor_mc || FLAG_gc_global ||
+      FLAG_stress_compaction || FLAG_stress_incremental_marking)
+    return;
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  PretenuringSampler* sampler = heap->pretenuring_sampler();
+  CHECK_NOT_NULL(sampler);
+  CHECK(!sampler->IsPretenured(AllocationSource::kJsonParse));
+
+  // All objects created by JSON.parse stay alive.
+  CompileRun(
+      "var retained = [];"
+      "var json = '[' + '{\"a\": [1, 2, 3]},'.repeat(50) + '{}]';"
+      "for (var i = 0; i < 100; i++) {"
+      "  retained.push(JSON.parse(json));"
+      "}");
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(sampler->IsPretenured(AllocationSource::kJsonParse));
+
+  v8::Local<v8::Value> res = CompileRun("JSON.parse('{\"a\": [1, 2, 3]}')");
+  Handle<JSObject> o = Handle<JSObject>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Object>::Cast(res)));
+  CHECK(heap->InOldSpace(*o));
+}
+
 
 // Test regular array literals allocation.
 TEST(OptimizedAllocationArrayLiterals) {
@@ -6093,6 +6353,37 @@ TEST(Regress618958) {
          !heap->incremental_marking()->IsStopped()));
 }
 
+TEST(ConcurrentMinorMCMarkingWriteBarrier) {
+  if (!FLAG_concurrent_minor_mc_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MinorMarkCompactCollector* collector = heap->minor_mark_compact_collector();
+  HandleScope scope(isolate);
+
+  Handle<FixedArray> holder = isolate->factory()->NewFixedArray(1);
+  collector->StartConcurrentMarking();
+  CHECK(collector->IsConcurrentMarkingActive());
+  {
+    // The only reference to the number is created after marking was seeded,
+    // so it has to be found through the marking barrier.
+    HandleScope inner_scope(isolate);
+    Handle<HeapNumber> number = isolate->factory()->NewHeapNumber(42.0);
+    holder->set(0, *number);
+  }
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK(!collector->IsConcurrentMarkingActive());
+  CHECK_EQ(42.0, HeapNumber::cast(holder->get(0)).value());
+
+  // Full GCs abort a concurrent young generation marking cycle.
+  collector->StartConcurrentMarking();
+  CHECK(collector->IsConcurrentMarkingActive());
+  CcTest::CollectAllGarbage();
+  CHECK(!collector->IsConcurrentMarkingActive());
+  CHECK_EQ(42.0, HeapNumber::cast(holder->get(0)).value());
+}
+
 TEST(YoungGenerationLargeObjectAllocationScavenge) {
   if (FLAG_minor_mc) return;
   CcTest::InitializeVM();
@@ -6122,6 +6413,38 @@ TEST(YoungGenerationLargeObjectAllocationScavenge) {
   CcTest::CollectAllAvailableGarbage();
 }
 
+TEST(YoungGenerationLargeObjectScavengeInChunks) {
+  if (FLAG_minor_mc) return;
+  FLAG_scavenger_split_large_arrays = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+  if (!isolate->serializer_enabled()) return;
+
+  // Large enough to be split into several chunks.
+  const int kLength = 200000;
+  const int kStride = 997;
+  Handle<FixedArray> array = isolate->factory()->NewFixedArray(kLength);
+  CHECK_EQ(NEW_LO_SPACE, MemoryChunk::FromHeapObject(*array)->owner_identity());
+  for (int i = 0; i < kLength; i += kStride) {
+    HandleScope inner_scope(isolate);
+    array->set(i, *isolate->factory()->NewHeapNumber(i));
+  }
+  // Also reference a young object from the very last slot.
+  array->set(kLength - 1, *isolate->factory()->NewHeapNumber(-1));
+
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  CHECK_EQ(LO_SPACE, MemoryChunk::FromHeapObject(*array)->owner_identity());
+  for (int i = 0; i < kLength; i += kStride) {
+    CHECK_EQ(i, HeapNumber::cast(array->get(i)).value());
+  }
+  CHECK_EQ(-1, HeapNumber::cast(array->get(kLength - 1)).value());
+
+  CcTest::CollectAllAvailableGarbage();
+}
+
 TEST(YoungGenerationLargeObjectAllocationMarkCompact) {
   if (FLAG_minor_mc) return;
   CcTest::InitializeVM();
@@ -7412,6 +7735,70 @@ TEST(LongTaskStatsYoung) {
       v8::metrics::LongTaskStats::Get(isolate).gc_young_wall_clock_duration_us);
 }
 
+#ifdef V8_SANDBOXED_EXTERNAL_POINTERS
+TEST(ExternalPointerTableCompaction) {
+  FLAG_compact_external_pointer_table = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  ExternalPointerTable& table = isolate->external_pointer_table();
+  HandleScope scope(isolate);
+
+  // Allocate enough foreigns to grow the table by several blocks, but only
+  // keep the most recently allocated ones, which are at the end of the table.
+  constexpr int kNumForeigns = 64 * 1024;
+  constexpr int kNumSurvivors = kNumForeigns / 16;
+  Handle<FixedArray> survivors =
+      factory->NewFixedArray(kNumSurvivors, AllocationType::kOld);
+  {
+    HandleScope inner_scope(isolate);
+    for (int i = 0; i < kNumForeigns; i++) {
+      Handle<Foreign> foreign = factory->NewForeign(static_cast<Address>(i));
+      int survivor_index = i - (kNumForeigns - kNumSurvivors);
+      if (survivor_index >= 0) survivors->set(survivor_index, *foreign);
+    }
+  }
+  uint32_t capacity_before = table.capacity();
+
+  // The first GC frees the dead entries and promotes the survivors. The second
+  // one evacuates the survivors from the end of the table and shrinks it.
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  CHECK_LT(table.capacity(), capacity_before);
+
+  for (int i = 0; i < kNumSurvivors; i++) {
+    Foreign foreign = Foreign::cast(survivors->get(i));
+    CHECK_EQ(static_cast<Address>(kNumForeigns - kNumSurvivors + i),
+             foreign.foreign_address());
+  }
+}
+#endif  // V8_SANDBOXED_EXTERNAL_POINTERS
+
+TEST(SampledObjectStats) {
+  // Sampling every page makes the results deterministic.
+  FLAG_gc_object_stats_sampling_rate = 1;
+  TracingFlags::gc_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE);
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  const int kNumArrays = 64;
+  Handle<FixedArray> arrays =
+      isolate->factory()->NewFixedArray(kNumArrays, AllocationType::kOld);
+  for (int i = 0; i < kNumArrays; i++) {
+    arrays->set(i, *isolate->factory()->NewFixedDoubleArray(
+                       1, AllocationType::kOld));
+  }
+  CcTest::CollectAllGarbage();
+
+  CHECK_GE(heap->ObjectCountAtLastGC(FIXED_DOUBLE_ARRAY_TYPE),
+           static_cast<size_t>(kNumArrays));
+  CHECK_GE(heap->ObjectSizeAtLastGC(FIXED_DOUBLE_ARRAY_TYPE),
+           static_cast<size_t>(kNumArrays * FixedDoubleArray::SizeFor(1)));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -219,6 +219,17 @@ TEST(LazyMemoryMeasurement) {
   CHECK(!platform.TaskPosted());
 }
 
+TEST(ContinuousMemoryMeasurement) {
+  FLAG_continuous_memory_measurement = true;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+  CHECK_EQ(0, env->GetMeasuredMemorySize());
+  CompileRun("var large = new Array(100000).fill(0);");
+  CcTest::CollectAllGarbage();
+  CHECK_LT(100000 * kTaggedSize, env->GetMeasuredMemorySize());
+}
+
 TEST(PartiallyInitializedJSFunction) {
   LocalContext env;
   Isolate* isolate = CcTest::i_isolate();
@@ -338,6 +338,9 @@ V8InitializationScope::V8InitializationScope(const char* exec_path)
   i::FLAG_always_turbofan = false;
   i::FLAG_allow_natives_syntax = true;
   i::FLAG_enable_lazy_source_positions = false;
+  // Keep in sync with InitializedIgnitionHandleScope in
+  // test-bytecode-generator.cc.
+  i::FLAG_ignition_trim_generator_registers = false;
 
   v8::V8::InitializeICUDefaultLocation(exec_path);
   v8::V8::InitializeExternalStartupData(exec_path);
@@ -55,6 +55,9 @@ class V8_NODISCARD InitializedIgnitionHandleScope
     i::FLAG_always_turbofan = false;
     i::FLAG_allow_natives_syntax = true;
     i::FLAG_enable_lazy_source_positions = false;
+    // The golden files show the register lists of suspend points as they
+    // are generated, before trimming them to the live registers.
+    i::FLAG_ignition_trim_generator_registers = false;
   }
 };
 
@@ -1815,6 +1815,13 @@ bool CompareC(Token::Value op, T lhs, T rhs, bool types_differed = false) {
   }
 }
 
+// The comparison feedback records the outcome next to the operand types.
+static int CompareOutcomeFeedback(Isolate* isolate, Handle<Object> result) {
+  return result->BooleanValue(isolate)
+             ? CompareOperationFeedback::kTrueOutcome
+             : CompareOperationFeedback::kFalseOutcome;
+}
+
 TEST(InterpreterSmiComparisons) {
   // NB Constants cover 31-bit space.
   int inputs[] = {v8::internal::kMinInt / 2,
@@ -1863,7 +1870,8 @@ TEST(InterpreterSmiComparisons) {
         if (tester.HasFeedbackMetadata()) {
           MaybeObject feedback = callable.vector().Get(slot);
           CHECK(feedback->IsSmi());
-          CHECK_EQ(CompareOperationFeedback::kSignedSmall,
+          CHECK_EQ(CompareOperationFeedback::kSignedSmall |
+                       CompareOutcomeFeedback(isolate, return_value),
                    feedback->ToSmi().value());
         }
       }
@@ -1914,7 +1922,8 @@ TEST(InterpreterHeapNumberComparisons) {
         if (tester.HasFeedbackMetadata()) {
           MaybeObject feedback = callable.vector().Get(slot);
           CHECK(feedback->IsSmi());
-          CHECK_EQ(CompareOperationFeedback::kNumber,
+          CHECK_EQ(CompareOperationFeedback::kNumber |
+                       CompareOutcomeFeedback(isolate, return_value),
                    feedback->ToSmi().value());
         }
       }
@@ -1959,7 +1968,8 @@ TEST(InterpreterBigIntComparisons) {
         if (tester.HasFeedbackMetadata()) {
           MaybeObject feedback = callable.vector().Get(slot);
           CHECK(feedback->IsSmi());
-          CHECK_EQ(CompareOperationFeedback::kBigInt,
+          CHECK_EQ(CompareOperationFeedback::kBigInt |
+                       CompareOutcomeFeedback(isolate, return_value),
                    feedback->ToSmi().value());
         }
       }
@@ -2013,7 +2023,9 @@ TEST(InterpreterStringComparisons) {
               Token::IsOrderedRelationalCompareOp(comparison)
                   ? CompareOperationFeedback::kString
                   : CompareOperationFeedback::kInternalizedString;
-          CHECK_EQ(expected_feedback, feedback->ToSmi().value());
+          CHECK_EQ(expected_feedback |
+                       CompareOutcomeFeedback(isolate, return_value),
+                   feedback->ToSmi().value());
         }
       }
     }
@@ -2127,11 +2139,13 @@ TEST(InterpreterMixedComparisons) {
                     CompareOperationFeedback::kNumber |
                         (string_type == kInternalizedStringConstant
                              ? CompareOperationFeedback::kInternalizedString
-                             : CompareOperationFeedback::kString),
+                             : CompareOperationFeedback::kString) |
+                        CompareOutcomeFeedback(isolate, return_value),
                     feedback->ToSmi().value());
               } else {
                 // Comparison with a number and string collects kAny feedback.
-                CHECK_EQ(CompareOperationFeedback::kAny,
+                CHECK_EQ(CompareOperationFeedback::kAny |
+                             CompareOutcomeFeedback(isolate, return_value),
                          feedback->ToSmi().value());
               }
             }
@@ -5029,6 +5043,47 @@ TEST(InterpreterGenerators) {
   }
 }
 
+TEST(InterpreterGeneratorsTrimRegisters) {
+  FLAG_ignition_trim_generator_registers = true;
+  HandleAndZoneScope handles;
+  Isolate* isolate = handles.main_isolate();
+
+  // |x| is allocated after |y| but dead across the yield.
+  const char* source =
+      "var f = function*(a) {\n"
+      "  let y = a * 2;\n"
+      "  let x = a + 1;\n"
+      "  y += x;\n"
+      "  yield y;\n"
+      "  return y;\n"
+      "};\n"
+      "var it = f(3);\n"
+      "it.next().value";
+  CHECK(CompileRun(source)->StrictEquals(v8_num(10)));
+
+  Handle<JSFunction> function = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(CompileRun("f"))));
+  Handle<BytecodeArray> bytecode_array =
+      handle(function->shared().GetBytecodeArray(isolate), isolate);
+  int suspend_count = 0;
+  uint32_t saved_register_count = 0;
+  for (BytecodeArrayIterator iterator(bytecode_array); !iterator.done();
+       iterator.Advance()) {
+    if (iterator.current_bytecode() == Bytecode::kSuspendGenerator) {
+      suspend_count++;
+      saved_register_count = iterator.GetRegisterCountOperand(2);
+      CHECK_LT(saved_register_count,
+               static_cast<uint32_t>(bytecode_array->register_count()));
+    } else if (iterator.current_bytecode() == Bytecode::kResumeGenerator) {
+      CHECK_LE(iterator.GetRegisterCountOperand(2), saved_register_count);
+    }
+  }
+  CHECK_EQ(1, suspend_count);
+
+  // Resuming restores the live registers.
+  CHECK(CompileRun("var r = it.next(); r.value === 10 && r.done")->IsTrue());
+}
+
 #ifndef V8_TARGET_ARCH_ARM
 TEST(InterpreterWithNativeStack) {
   // "Always sparkplug" messes with this test.
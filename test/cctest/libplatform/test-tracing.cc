@@ -1,6 +1,7 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <algorithm>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
@@ -142,6 +143,66 @@ TEST(TestTraceBufferRingBuffer) {
 }
 #endif  // !defined(V8_USE_PERFETTO)
 
+class AddTraceEventsThread : public base::Thread {
+ public:
+  static const size_t kEventCount = TraceBufferChunk::kChunkSize * 4;
+
+  AddTraceEventsThread(TraceBuffer* ring_buffer, int id)
+      : base::Thread(base::Thread::Options("AddTraceEventsThread")),
+        ring_buffer_(ring_buffer) {
+    for (size_t i = 0; i < kEventCount; ++i) {
+      names_.push_back("Test.Thread" + std::to_string(id) + ".EventNo" +
+                       std::to_string(i));
+    }
+  }
+
+  void Run() override {
+    uint8_t category_enabled_flag = 41;
+    for (const std::string& name : names_) {
+      uint64_t handle;
+      TraceObject* trace_object = ring_buffer_->AddTraceEvent(&handle);
+      CHECK_NOT_NULL(trace_object);
+      trace_object->Initialize('X', &category_enabled_flag, name.c_str(),
+                               "Test.Scope", 42, 123, 0, nullptr, nullptr,
+                               nullptr, nullptr, 0, 1729, 4104);
+      CHECK_EQ(trace_object, ring_buffer_->GetEventByHandle(handle));
+    }
+  }
+
+  const std::vector<std::string>& names() const { return names_; }
+
+ private:
+  TraceBuffer* ring_buffer_;
+  std::vector<std::string> names_;
+};
+
+TEST(TestTraceBufferRingBufferConcurrentAdd) {
+  // The buffer is large enough to hold the events of all threads.
+  const int kThreads = 4;
+  MockTraceWriter* writer = new MockTraceWriter();
+  TraceBuffer* ring_buffer =
+      TraceBuffer::CreateTraceBufferRingBuffer(kThreads * 4, writer);
+  std::vector<std::unique_ptr<AddTraceEventsThread>> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.push_back(std::make_unique<AddTraceEventsThread>(ring_buffer, i));
+  }
+  for (auto& thread : threads) CHECK(thread->Start());
+  for (auto& thread : threads) thread->Join();
+
+  ring_buffer->Flush();
+  std::vector<std::string> events = writer->events();
+  std::vector<std::string> expected;
+  for (auto& thread : threads) {
+    expected.insert(expected.end(), thread->names().begin(),
+                    thread->names().end());
+  }
+  std::sort(events.begin(), events.end());
+  std::sort(expected.begin(), expected.end());
+  CHECK(events == expected);
+  delete ring_buffer;
+}
+#endif  // !defined(V8_USE_PERFETTO)
+
 // Perfetto has an internal JSON exporter.
 #if !defined(V8_USE_PERFETTO)
 void PopulateJSONWriter(TraceWriter* writer) {
@@ -7,6 +7,8 @@
 #include "include/v8-function.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
+#include "include/v8-unwinder.h"
+#include "src/libsampler/perf-event-sampler.h"
 #include "src/libsampler/sampler.h"
 #include "test/cctest/cctest.h"
 
@@ -220,5 +222,73 @@ TEST(AtomicGuard_GetBlockingSuccess) {
 
 #endif  // USE_SIGNALS
 
+TEST(PerfEventSampler_SamplesCurrentThread) {
+  int thread_id = base::OS::GetCurrentThreadId();
+  std::unique_ptr<PerfEventSampler> sampler =
+      PerfEventSampler::New(thread_id, base::TimeDelta::FromMilliseconds(1));
+  // Perf events may not be supported or allowed on this system.
+  if (!sampler) return;
+
+  sampler->Start();
+  CHECK(sampler->IsActive());
+  base::TimeTicks end =
+      base::TimeTicks::Now() + base::TimeDelta::FromMilliseconds(100);
+  volatile double sink = 0;
+  while (base::TimeTicks::Now() < end) sink = sink + 1.5;
+  sampler->Stop();
+  CHECK(!sampler->IsActive());
+
+  size_t callbacks = 0;
+  size_t samples =
+      sampler->ReadSamples([&](const PerfEventSampler::Sample& sample) {
+        CHECK_EQ(thread_id, sample.thread_id);
+        CHECK_NOT_NULL(sample.pc);
+        CHECK_GT(sample.stack_size, size_t{0});
+        ++callbacks;
+      });
+  CHECK_EQ(callbacks, samples);
+  CHECK_GT(samples + sampler->lost_sample_count(), uint64_t{0});
+  // All samples have been consumed.
+  CHECK_EQ(size_t{0},
+           sampler->ReadSamples([](const PerfEventSampler::Sample&) {}));
+}
+
+TEST(PerfEventSampler_UnwindV8Frames) {
+  constexpr uintptr_t kStackStart = 0x10000;
+  constexpr uintptr_t kCodeStart = 0x2000;
+  // Two V8 frames, called from a frame outside of V8 code.
+  uintptr_t stack[12] = {0};
+  stack[2] = kStackStart + 6 * sizeof(uintptr_t);  // Caller's fp.
+  stack[3] = kCodeStart + 0x40;                     // Return address.
+  stack[6] = kStackStart + 10 * sizeof(uintptr_t);
+  stack[7] = 0x9000;
+  MemoryRange code_pages[] = {{reinterpret_cast<void*>(kCodeStart), 0x100}};
+
+  PerfEventSampler::Sample sample;
+  sample.pc = reinterpret_cast<void*>(kCodeStart + 0x10);
+  sample.sp = reinterpret_cast<void*>(kStackStart);
+  sample.fp = reinterpret_cast<void*>(kStackStart + 2 * sizeof(uintptr_t));
+  sample.stack = reinterpret_cast<const uint8_t*>(stack);
+  sample.stack_size = sizeof(stack);
+
+  void* pcs[4];
+  CHECK_EQ(size_t{2},
+           PerfEventSampler::UnwindV8Frames(sample, 1, code_pages, pcs, 4));
+  CHECK_EQ(sample.pc, pcs[0]);
+  CHECK_EQ(reinterpret_cast<void*>(kCodeStart + 0x40), pcs[1]);
+  CHECK_EQ(size_t{1},
+           PerfEventSampler::UnwindV8Frames(sample, 1, code_pages, pcs, 1));
+
+  // The walk stops where the stack copy ends.
+  sample.stack_size = 3 * sizeof(uintptr_t);
+  CHECK_EQ(size_t{1},
+           PerfEventSampler::UnwindV8Frames(sample, 1, code_pages, pcs, 4));
+
+  // Nothing is unwound outside of V8 code.
+  sample.pc = reinterpret_cast<void*>(0x9000);
+  CHECK_EQ(size_t{0},
+           PerfEventSampler::UnwindV8Frames(sample, 1, code_pages, pcs, 4));
+}
+
 }  // namespace sampler
 }  // namespace v8
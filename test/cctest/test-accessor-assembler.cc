@@ -11,6 +11,7 @@
 #include "src/objects/smi.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -26,18 +27,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,11 +81,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -257,5 +259,41 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheResizing) {
+  FlagScope<bool> stub_cache_resizing(&FLAG_stub_cache_resizing, true);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  HandleScope scope(isolate);
+  Factory* factory = isolate->factory();
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+
+  std::vector<Handle<Name>> names;
+  for (int i = 0; i <= StubCache::kPrimaryTableSize; i++) {
+    names.push_back(factory->NewSymbol());
+  }
+  Handle<Map> map = Map::Create(isolate, 0);
+  Handle<Code> code = CreateCodeOfKind(CodeKind::FOR_TESTING);
+  MaybeObject handler = MaybeObject::FromObject(ToCodeT(*code));
+
+  // More updates than the primary table has entries make the next Clear()
+  // grow the tables.
+  for (Handle<Name> name : names) stub_cache.Set(*name, *map, handler);
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+           stub_cache.secondary_table_size());
+  CHECK(stub_cache.Get(*names[0], *map).ptr() == kNullAddress);
+  stub_cache.Set(*names[0], *map, handler);
+  CHECK(stub_cache.Get(*names[0], *map) == handler);
+
+  // A cache that is hardly updated any more shrinks back.
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+}
+
 }  // namespace internal
 }  // namespace v8
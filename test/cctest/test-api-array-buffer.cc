@@ -432,6 +432,41 @@ THREADED_TEST(SharedArrayBuffer_NewBackingStore) {
   CHECK_EQ(backing_store.get(), ab->GetBackingStore().get());
 }
 
+THREADED_TEST(SharedArrayBuffer_Ring) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  // Room for 7 bytes, since one byte of the ring is never used.
+  Local<v8::SharedArrayBuffer> ab = v8::SharedArrayBuffer::New(
+      isolate, v8::SharedArrayBuffer::kRingHeaderSize + 8);
+  uint8_t data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  uint8_t out[16] = {};
+  CHECK_EQ(0u, ab->RingPop(out, sizeof(out)));
+  CHECK_EQ(5u, ab->RingPush(data, 5));
+  CHECK_EQ(2u, ab->RingPush(data + 5, 4));
+  CHECK_EQ(0u, ab->RingPush(data, 1));
+  CHECK_EQ(3u, ab->RingPop(out, 3));
+  CHECK_EQ(1, out[0]);
+  CHECK_EQ(3, out[2]);
+  // Wraps around the end of the ring.
+  CHECK_EQ(2u, ab->RingPush(data + 7, 2));
+  CHECK_EQ(6u, ab->RingPop(out, sizeof(out)));
+  for (int i = 0; i < 6; ++i) CHECK_EQ(4 + i, out[i]);
+  CHECK_EQ(0u, ab->RingPop(out, sizeof(out)));
+
+  // JavaScript sees the same indices and data.
+  CHECK(env->Global()->Set(env.local(), v8_str("ring"), ab).FromJust());
+  CHECK_EQ(3, CompileRun("var indices = new Int32Array(ring, 0, 2);"
+                         "var bytes = new Uint8Array(ring, 8);"
+                         "bytes[Atomics.load(indices, 0)] = 42;"
+                         "Atomics.store(indices, 1, 2);"
+                         "Atomics.load(indices, 0) + Atomics.load(indices, 1)")
+                  ->Int32Value(env.local())
+                  .FromJust());
+  CHECK_EQ(1u, ab->RingPop(out, sizeof(out)));
+  CHECK_EQ(42, out[0]);
+}
+
 static void* backing_store_custom_data = nullptr;
 static size_t backing_store_custom_length = 0;
 static bool backing_store_custom_called = false;
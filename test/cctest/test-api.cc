@@ -31,6 +31,7 @@
 #include <csignal>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 
 #include "test/cctest/cctest.h"
@@ -18330,6 +18331,104 @@ UNINITIALIZED_TEST(DisposeIsolateWhenInUse) {
   isolate->Dispose();
 }
 
+TEST(IsolatePoolAcquire) {
+  v8::Isolate* current_isolate = CcTest::isolate();
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  std::vector<v8::Isolate*> isolates;
+  {
+    v8::IsolatePool pool(create_params, 2);
+    // More isolates than the pool keeps, so that some are created on this
+    // thread or after refilling the pool.
+    for (int i = 0; i < 4; i++) {
+      v8::Isolate* isolate = pool.Acquire();
+      CHECK_NOT_NULL(isolate);
+      CHECK(current_isolate == CcTest::isolate());
+      {
+        v8::Isolate::Scope isolate_scope(isolate);
+        v8::HandleScope scope(isolate);
+        LocalContext context(isolate);
+        ExpectInt32("6 * 7", 42);
+      }
+      isolates.push_back(isolate);
+    }
+  }
+  for (v8::Isolate* isolate : isolates) isolate->Dispose();
+}
+
+TEST(IsolateGroups) {
+  v8::IsolateGroup default_group = v8::IsolateGroup::GetDefault();
+  CHECK(default_group == CcTest::isolate()->GetGroup());
+  if (!v8::IsolateGroup::CanCreateNewGroups()) return;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  std::vector<v8::Isolate*> isolates;
+  std::set<i::Address> cage_bases = {CcTest::i_isolate()->cage_base()};
+  for (int i = 0; i < 2; i++) {
+    v8::IsolateGroup group = v8::IsolateGroup::Create();
+    CHECK(group != default_group);
+    v8::Isolate* isolate = v8::Isolate::New(group, create_params);
+    CHECK(isolate->GetGroup() == group);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    // Every group has its own pointer compression cage.
+    CHECK(cage_bases.insert(i_isolate->cage_base()).second);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope scope(isolate);
+      LocalContext context(isolate);
+      ExpectInt32("[1, 2, 3].map(x => x * 2).reduce((a, b) => a + b)", 12);
+      i_isolate->heap()->CollectAllGarbage(
+          i::Heap::kNoGCFlags, i::GarbageCollectionReason::kTesting);
+      ExpectString("typeof undefined", "undefined");
+    }
+    // The isolate keeps its group alive after the handle is gone.
+    isolates.push_back(isolate);
+  }
+  // A second isolate in a group shares its read-only heap.
+  {
+    v8::Isolate* isolate =
+        v8::Isolate::New(isolates[0]->GetGroup(), create_params);
+    CHECK_EQ(reinterpret_cast<i::Isolate*>(isolate)->read_only_heap(),
+             reinterpret_cast<i::Isolate*>(isolates[0])->read_only_heap());
+    isolate->Dispose();
+  }
+  for (v8::Isolate* isolate : isolates) isolate->Dispose();
+}
+
+TEST(TieringPolicyBudgets) {
+  i::FLAG_allow_natives_syntax = true;
+  FlagScope<bool> no_maglev(&i::FLAG_maglev, false);
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  v8::HandleScope scope(isolate);
+
+  v8::TieringPolicy policy;
+  policy.sparkplug_interrupt_budget = 1234;
+  policy.turbofan_interrupt_budget = 5678;
+  isolate->SetTieringPolicy(policy);
+
+  // New closures start with the Sparkplug budget.
+  CompileRun("function f() {}");
+  i::Handle<i::JSFunction> f = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str("f"))
+                                 .ToLocalChecked()));
+  if (i::FLAG_lazy_feedback_allocation) {
+    CHECK_EQ(1234, f->raw_feedback_cell().interrupt_budget());
+  }
+
+  // Functions with a feedback vector use the TurboFan budget.
+  CompileRun("%EnsureFeedbackVectorForFunction(f); f();");
+  f->SetInterruptBudget(i_isolate);
+  CHECK_EQ(5678, f->raw_feedback_cell().interrupt_budget());
+
+  // Budgets of 0 fall back to the flags.
+  isolate->SetTieringPolicy(v8::TieringPolicy());
+  f->SetInterruptBudget(i_isolate);
+  CHECK_EQ(i::FLAG_interrupt_budget, f->raw_feedback_cell().interrupt_budget());
+}
+
 
 static void BreakArrayGuarantees(const char* script) {
   v8::Isolate::CreateParams create_params;
@@ -18620,6 +18719,38 @@ TEST(IsolateDifferentContexts) {
   isolate->Dispose();
 }
 
+TEST(ContextCpuTime) {
+  if (!v8::base::ThreadTicks::IsSupported()) return;
+  i::FlagScope<bool> context_cpu_time(&i::FLAG_context_cpu_time, true);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::Context> busy = v8::Context::New(isolate);
+    Local<v8::Context> idle = v8::Context::New(isolate);
+    {
+      v8::Context::Scope context_scope(busy);
+      // Spin until the thread used some CPU time.
+      v8::base::ThreadTicks start = v8::base::ThreadTicks::Now();
+      while ((v8::base::ThreadTicks::Now() - start).InMilliseconds() < 10) {
+        CompileRun("for (let i = 0; i < 1000; i++) {}");
+      }
+      CcTest::CollectAllGarbage(reinterpret_cast<i::Isolate*>(isolate));
+    }
+    v8::Context::CpuTime busy_time = busy->GetCpuTime();
+    CHECK_GT(busy_time.total_us, 0);
+    CHECK_GT(busy_time.gc_us, 0);
+    CHECK_LE(busy_time.gc_us + busy_time.compile_us +
+                 busy_time.microtasks_us,
+             busy_time.total_us);
+    v8::Context::CpuTime idle_time = idle->GetCpuTime();
+    CHECK_EQ(0, idle_time.total_us);
+  }
+  isolate->Dispose();
+}
+
 class InitDefaultIsolateThread : public v8::base::Thread {
  public:
   enum TestCase {
@@ -20891,6 +21022,49 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  v8::JSON::StreamingParser parser;
+
+  // Split the text at every byte, including within UTF-8 sequences.
+  const char* texts[] = {
+      "{\"ascii\":[1,2.5,true,null],\"s\":\"x\\u20ac\"}",
+      "[\"caf\xC3\xA9\",\"\xE2\x82\xAC\",\"\xF0\x9F\x98\x80\"]",
+      "\"\xC3\xA9\xFF\"",
+  };
+  for (const char* text : texts) {
+    Local<Value> expected =
+        v8::JSON::Parse(context.local(), v8_str(text)).ToLocalChecked();
+    size_t length = strlen(text);
+    for (size_t split = 0; split <= length; split++) {
+      const uint8_t* bytes = reinterpret_cast<const uint8_t*>(text);
+      parser.AddChunk(bytes, split);
+      parser.AddChunk(bytes + split, length - split);
+      Local<Value> value = parser.Finish(context.local()).ToLocalChecked();
+      Local<String> json =
+          v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+      CHECK(json->StrictEquals(
+          v8::JSON::Stringify(context.local(), expected).ToLocalChecked()));
+    }
+  }
+
+  // Errors are the same as those of JSON.parse.
+  {
+    v8::TryCatch try_catch(isolate);
+    parser.AddChunk(reinterpret_cast<const uint8_t*>("[1,"), 3);
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -21879,6 +22053,56 @@ THREADED_TEST(ObjectNew) {
   }
 }
 
+THREADED_TEST(ObjectNewBatch) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  {
+    // Verify that the objects get the same map, which fits all values.
+    Local<v8::Name> names[2] = {v8_str("x"), v8_str("y")};
+    Local<v8::Value> values[6] = {v8_num(1),   v8_str("a"), v8_num(0.5),
+                                  v8_num(2),   v8_num(3),   v8_str("b")};
+    Local<v8::Object> objects[3];
+    v8::Object::NewBatch(isolate, names, arraysize(names), values,
+                         arraysize(objects), objects);
+    for (size_t i = 0; i < arraysize(objects); ++i) {
+      Verify(isolate, objects[i]);
+      CHECK(objects[i]->GetPrototype()->SameValue(
+          CompileRun("Object.prototype")));
+      CHECK(v8::Utils::OpenHandle(*objects[i])->HasFastProperties());
+      CHECK_EQ(v8::Utils::OpenHandle(*objects[0])->map(),
+               v8::Utils::OpenHandle(*objects[i])->map());
+      Local<Array> keys =
+          objects[i]->GetOwnPropertyNames(env.local()).ToLocalChecked();
+      CHECK_EQ(arraysize(names), keys->Length());
+      for (uint32_t j = 0; j < arraysize(names); ++j) {
+        CHECK(names[j]->SameValue(keys->Get(env.local(), j).ToLocalChecked()));
+        CHECK(values[i * arraysize(names) + j]->SameValue(
+            objects[i]->Get(env.local(), names[j]).ToLocalChecked()));
+      }
+    }
+  }
+  {
+    // This has to work with duplicate names and array indices too.
+    Local<v8::Name> names[3] = {v8_str("a"), v8_str("0"), v8_str("a")};
+    Local<v8::Value> values[6] = {v8_num(1), v8_num(2), v8_num(3),
+                                  v8_num(4), v8_num(5), v8_num(6)};
+    Local<v8::Object> objects[2];
+    v8::Object::NewBatch(isolate, names, arraysize(names), values,
+                         arraysize(objects), objects);
+    for (size_t i = 0; i < arraysize(objects); ++i) {
+      Verify(isolate, objects[i]);
+      Local<Array> keys =
+          objects[i]->GetOwnPropertyNames(env.local()).ToLocalChecked();
+      CHECK_EQ(2, keys->Length());
+      CHECK(values[i * 3 + 1]->SameValue(
+          objects[i]->Get(env.local(), 0).ToLocalChecked()));
+      CHECK(values[i * 3 + 2]->SameValue(
+          objects[i]->Get(env.local(), v8_str("a")).ToLocalChecked()));
+    }
+  }
+}
+
 TEST(EscapableHandleScope) {
   HandleScope outer_scope(CcTest::isolate());
   LocalContext context;
@@ -28,7 +28,9 @@
 // Tests of the CPU profiler and utilities.
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -786,6 +788,171 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+namespace {
+
+class TestPprofStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override { ++eos_signaled_; }
+  int GetChunkSize() override { return 64; }
+  WriteResult WriteAsciiChunk(char* buffer, int size) override {
+    CHECK_GT(size, 0);
+    CHECK_LE(size, GetChunkSize());
+    data_.append(buffer, size);
+    return kContinue;
+  }
+
+  const std::string& data() const { return data_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  std::string data_;
+  int eos_signaled_ = 0;
+};
+
+// A field of a protocol buffer message, either a varint or a
+// length-delimited value.
+struct ProtoField {
+  int number;
+  uint64_t value;
+  std::string bytes;
+};
+
+uint64_t ReadVarint(const std::string& data, size_t* pos) {
+  uint64_t value = 0;
+  for (int shift = 0;; shift += 7) {
+    CHECK_LT(*pos, data.size());
+    uint8_t byte = data[(*pos)++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return value;
+  }
+}
+
+std::vector<ProtoField> ReadMessage(const std::string& data) {
+  std::vector<ProtoField> fields;
+  size_t pos = 0;
+  while (pos < data.size()) {
+    uint64_t tag = ReadVarint(data, &pos);
+    ProtoField field{static_cast<int>(tag >> 3), 0, ""};
+    if ((tag & 7) == 0) {
+      field.value = ReadVarint(data, &pos);
+    } else {
+      CHECK_EQ(2u, tag & 7);
+      size_t size = ReadVarint(data, &pos);
+      CHECK_LE(pos + size, data.size());
+      field.bytes = data.substr(pos, size);
+      pos += size;
+    }
+    fields.push_back(field);
+  }
+  return fields;
+}
+
+std::vector<uint64_t> ReadPackedVarints(const std::string& data) {
+  std::vector<uint64_t> values;
+  size_t pos = 0;
+  while (pos < data.size()) values.push_back(ReadVarint(data, &pos));
+  return values;
+}
+
+}  // namespace
+
+TEST(CpuProfilePprofSerialization) {
+  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
+  // since it requires a precise trace.
+  if (i::FLAG_concurrent_sparkplug) return;
+
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  int32_t profiling_interval_ms = 200;
+  v8::Local<v8::Value> args[] = {
+      v8::Integer::New(env->GetIsolate(), profiling_interval_ms)};
+  ProfilerHelper helper(env.local());
+  v8::CpuProfile* profile = helper.Run(function, args, arraysize(args), 200);
+
+  TestPprofStream stream;
+  profile->Serialize(&stream);
+  CHECK_EQ(1, stream.eos_signaled());
+
+  std::vector<std::string> strings;
+  std::map<uint64_t, uint64_t> function_names;
+  std::map<uint64_t, uint64_t> location_functions;
+  std::vector<std::vector<uint64_t>> stacks;
+  uint64_t total_samples = 0;
+  for (const ProtoField& field : ReadMessage(stream.data())) {
+    switch (field.number) {
+      case 2: {  // Sample.
+        for (const ProtoField& sample_field : ReadMessage(field.bytes)) {
+          if (sample_field.number == 1) {
+            stacks.push_back(ReadPackedVarints(sample_field.bytes));
+          } else if (sample_field.number == 2) {
+            std::vector<uint64_t> values =
+                ReadPackedVarints(sample_field.bytes);
+            CHECK_EQ(2u, values.size());
+            CHECK_GT(values[0], 0u);
+            total_samples += values[0];
+          }
+        }
+        break;
+      }
+      case 4: {  // Location.
+        uint64_t id = 0;
+        uint64_t function_id = 0;
+        for (const ProtoField& location_field : ReadMessage(field.bytes)) {
+          if (location_field.number == 1) id = location_field.value;
+          if (location_field.number != 4) continue;
+          for (const ProtoField& line : ReadMessage(location_field.bytes)) {
+            if (line.number == 1) function_id = line.value;
+          }
+        }
+        CHECK_NE(0u, id);
+        location_functions[id] = function_id;
+        break;
+      }
+      case 5: {  // Function.
+        uint64_t id = 0;
+        uint64_t name = 0;
+        for (const ProtoField& function_field : ReadMessage(field.bytes)) {
+          if (function_field.number == 1) id = function_field.value;
+          if (function_field.number == 2) name = function_field.value;
+        }
+        CHECK_NE(0u, id);
+        function_names[id] = name;
+        break;
+      }
+      case 6:  // String table.
+        strings.push_back(field.bytes);
+        break;
+    }
+  }
+
+  CHECK(!strings.empty());
+  CHECK_EQ("", strings[0]);
+  CHECK_GE(total_samples, 200u);
+
+  // Find the start -> foo -> bar -> delay -> loop stack, stored from the leaf.
+  const std::vector<std::string> expected = {"loop", "delay", "bar", "foo",
+                                             "start"};
+  bool found = false;
+  for (const std::vector<uint64_t>& stack : stacks) {
+    std::vector<std::string> names;
+    for (uint64_t location_id : stack) {
+      CHECK_EQ(1u, location_functions.count(location_id));
+      uint64_t name = function_names.at(location_functions.at(location_id));
+      CHECK_LT(name, strings.size());
+      names.push_back(strings[name]);
+    }
+    if (names == expected) found = true;
+  }
+  CHECK(found);
+
+  profile->Delete();
+}
+
 TEST(CollectCpuProfileCallerLineNumbers) {
   // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
   // since it requires a precise trace.
@@ -3091,6 +3258,30 @@ TEST(StaticCollectSampleAPI) {
   profile->Delete();
 }
 
+TEST(DeoptCountAPI) {
+  if (!CcTest::i_isolate()->use_optimizer() || i::FLAG_always_turbofan) return;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  CompileRun(
+      "function add(a, b) { return a + b; }\n"
+      "function other(a) { return a; }\n"
+      "%PrepareFunctionForOptimization(add);\n"
+      "add(1, 2);\n"
+      "%OptimizeFunctionOnNextCall(add);\n"
+      "add(1, 2);\n");
+  v8::Local<v8::Function> add = GetFunction(env.local(), "add");
+  v8::Local<v8::Function> other = GetFunction(env.local(), "other");
+  CHECK_EQ(0, v8::CpuProfiler::GetDeoptCount(isolate, add));
+
+  // Passing strings deoptimizes the code that was specialized for Smis.
+  CompileRun("add('a', 'b');");
+  CHECK_EQ(1, v8::CpuProfiler::GetDeoptCount(isolate, add));
+  CHECK_EQ(0, v8::CpuProfiler::GetDeoptCount(isolate, other));
+}
+
 TEST(CodeEntriesMemoryLeak) {
   v8::HandleScope scope(CcTest::isolate());
   v8::Local<v8::Context> env = CcTest::NewContext({PROFILER_EXTENSION_ID});
@@ -464,6 +464,42 @@ TEST(VectorCallSpeculationModeAndFeedbackContent) {
   CHECK_EQ(CallFeedbackContent::kReceiver, nexus.GetCallFeedbackContent());
 }
 
+TEST(VectorCompareOutcome) {
+  if (!i::FLAG_use_ic) return;
+  if (i::FLAG_always_turbofan) return;
+  FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function f(a, b) { return a < b; }"
+      "%EnsureFeedbackVectorForFunction(f);");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackSlot slot(0);
+  FeedbackNexus nexus(feedback_vector, slot);
+  CHECK_EQ(FeedbackSlotKind::kCompareOp, nexus.kind());
+  CHECK_EQ(InlineCacheState::UNINITIALIZED, nexus.ic_state());
+
+  CompileRun("f(1, 2); f(3, 4);");
+  CHECK_EQ(CompareOperationOutcomeHint::kAlwaysTrue,
+           nexus.GetCompareOperationOutcomeFeedback());
+  // The outcome doesn't affect the operand type feedback.
+  CHECK_EQ(CompareOperationHint::kSignedSmall,
+           nexus.GetCompareOperationFeedback());
+  CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
+
+  CompileRun("f(2, 1);");
+  CHECK_EQ(CompareOperationOutcomeHint::kAny,
+           nexus.GetCompareOperationOutcomeFeedback());
+  CHECK_EQ(CompareOperationHint::kSignedSmall,
+           nexus.GetCompareOperationFeedback());
+}
+
 TEST(VectorLoadICStates) {
   if (!i::FLAG_use_ic) return;
   if (i::FLAG_always_turbofan) return;
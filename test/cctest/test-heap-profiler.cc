@@ -1231,6 +1231,34 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(HeapSnapshotJSONSerializationParallel) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "var objects = [];\n"
+      "for (var i = 0; i < 10000; i++) objects.push({value: 'v' + i});");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  // Formatting nodes and edges on background threads produces the same JSON
+  // as formatting them on the main thread.
+  i::FLAG_heap_snapshot_parallel_serialization = true;
+  TestJSONStream parallel_stream;
+  snapshot->Serialize(&parallel_stream, v8::HeapSnapshot::kJSON);
+  i::FLAG_heap_snapshot_parallel_serialization = false;
+  TestJSONStream serial_stream;
+  snapshot->Serialize(&serial_stream, v8::HeapSnapshot::kJSON);
+  CHECK_EQ(1, parallel_stream.eos_signaled());
+  CHECK_EQ(serial_stream.size(), parallel_stream.size());
+  v8::base::ScopedVector<char> parallel_json(parallel_stream.size());
+  parallel_stream.WriteTo(parallel_json);
+  v8::base::ScopedVector<char> serial_json(serial_stream.size());
+  serial_stream.WriteTo(serial_json);
+  CHECK_EQ(0, memcmp(serial_json.begin(), parallel_json.begin(),
+                     serial_json.length()));
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
@@ -3924,6 +3952,83 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerDelta) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+
+  std::unordered_set<uint32_t> node_ids;
+  std::unordered_set<uint64_t> live_samples;
+  auto apply_delta = [&](v8::AllocationProfileDelta* delta) {
+    for (const auto& frame : delta->GetNewFrames()) {
+      CHECK_LT(0, frame.node_id);
+      CHECK_EQ(0, node_ids.count(frame.node_id));
+      CHECK(frame.parent_node_id == 0 ||
+            node_ids.count(frame.parent_node_id) == 1);
+      node_ids.insert(frame.node_id);
+    }
+    for (const auto& sample : delta->GetNewSamples()) {
+      CHECK_EQ(1, node_ids.count(sample.node_id));
+      CHECK_EQ(0, live_samples.count(sample.sample_id));
+      live_samples.insert(sample.sample_id);
+    }
+    for (uint64_t sample_id : delta->GetRemovedSampleIds()) {
+      CHECK_EQ(1, live_samples.erase(sample_id));
+    }
+  };
+
+  CompileRun(simple_sampling_heap_profiler_script);
+  std::unique_ptr<v8::AllocationProfileDelta> delta(
+      heap_profiler->GetAllocationProfileDelta());
+  CHECK(delta);
+  CHECK(!delta->GetNewFrames().empty());
+  CHECK(!delta->GetNewSamples().empty());
+  CHECK(delta->GetRemovedSampleIds().empty());
+  apply_delta(delta.get());
+
+  // Samples are only reported once.
+  delta.reset(heap_profiler->GetAllocationProfileDelta());
+  CHECK(delta->GetRemovedSampleIds().empty());
+  apply_delta(delta.get());
+
+  // New allocations from new stacks are reported once.
+  CompileRun(
+      "var B = [];\n"
+      "function baz() { for (var i = 0; i < 1024; ++i) B[i] = new Array(64); }"
+      "\nbaz();");
+  delta.reset(heap_profiler->GetAllocationProfileDelta());
+  CHECK(!delta->GetNewFrames().empty());
+  CHECK(!delta->GetNewSamples().empty());
+  apply_delta(delta.get());
+
+  // Freed samples are reported as removed.
+  CompileRun("A = null; B = null;");
+  CcTest::CollectAllAvailableGarbage();
+  delta.reset(heap_profiler->GetAllocationProfileDelta());
+  CHECK(!delta->GetRemovedSampleIds().empty());
+  apply_delta(delta.get());
+
+  // The deltas add up to the full profile. Building the profile may sample
+  // new allocations, which are not part of any delta yet.
+  uint64_t last_sample_id = 0;
+  for (uint64_t sample_id : live_samples) {
+    last_sample_id = std::max(last_sample_id, sample_id);
+  }
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  for (const auto& sample : profile->GetSamples()) {
+    if (sample.sample_id > last_sample_id) continue;
+    CHECK_EQ(1, live_samples.count(sample.sample_id));
+  }
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
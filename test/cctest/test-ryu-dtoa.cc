@@ -0,0 +1,77 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <stdlib.h>
+
+#include "src/base/numbers/double.h"
+#include "src/base/numbers/ryu-dtoa.h"
+#include "src/base/numbers/strtod.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace base {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckShortest(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(expected)), length);
+  CHECK_EQ(expected_point, point);
+}
+
+TEST(RyuDtoaVariousDoubles) {
+  CheckShortest(1.0, "1", 1);
+  CheckShortest(1.5, "15", 1);
+  CheckShortest(0.1, "1", 0);
+  CheckShortest(1e22, "1", 23);
+  CheckShortest(1e23, "1", 24);
+  CheckShortest(5e-324, "5", -323);
+  CheckShortest(1.7976931348623157e308, "17976931348623157", 309);
+  CheckShortest(4294967272.0, "4294967272", 10);
+  CheckShortest(4.1855804968213567e298, "4185580496821357", 299);
+  CheckShortest(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckShortest(2147483648.0, "2147483648", 10);
+  // FastDtoa cannot compute this one, and needs the bignum fallback.
+  CheckShortest(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckShortest(Double(uint64_t{0x0010'0000'0000'0000}).value(),
+                "22250738585072014", -307);
+  CheckShortest(Double(uint64_t{0x000F'FFFF'FFFF'FFFF}).value(),
+                "2225073858507201", -307);
+  // Powers of two have a closer lower neighbor.
+  CheckShortest(9007199254740992.0, "9007199254740992", 16);
+  CheckShortest(Double(uint64_t{0x7FE0'0000'0000'0000}).value(),
+                "898846567431158", 308);
+}
+
+TEST(RyuDtoaGayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    double v = current_test.v;
+    RyuDtoa(v, buffer, &length, &point);
+    CHECK_GE(kRyuDtoaMaximalLength, length);
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+    // The digits read back as the same double.
+    CHECK_EQ(v, Strtod(Vector<const char>(buffer.begin(), length),
+                       point - length));
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace base
+}  // namespace v8
@@ -36,6 +36,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler-inl.h"
+#include "src/codegen/process-wide-script-cache.h"
 #include "src/codegen/script-details.h"
 #include "src/common/assert-scope.h"
 #include "src/debug/debug.h"
@@ -55,6 +56,7 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
+#include "src/snapshot/context-snapshot-cache.h"
 #include "src/snapshot/read-only-deserializer.h"
 #include "src/snapshot/read-only-serializer.h"
 #include "src/snapshot/shared-heap-deserializer.h"
@@ -464,6 +466,54 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   context_blob.Dispose();
 }
 
+TEST(SnapshotCompressionChunks) {
+  // Data that spans several chunks, the last of which is partial.
+  std::vector<byte> data(1 * MB + 123);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = static_cast<byte>((i * 7) ^ (i >> 10));
+  }
+  base::Vector<const byte> expected(data.data(), data.size());
+  SnapshotData original_snapshot_data(expected);
+  SnapshotData compressed =
+      i::SnapshotCompression::Compress(&original_snapshot_data);
+  CHECK_LT(compressed.RawData().size(), expected.size());
+
+  for (bool concurrent : {true, false}) {
+    FLAG_concurrent_snapshot_decompression = concurrent;
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(expected, decompressed.RawData());
+  }
+}
+
+TEST(ContextSnapshotCache) {
+  std::vector<std::vector<byte>> contexts = {std::vector<byte>(300 * KB),
+                                             std::vector<byte>(1 * KB)};
+  std::vector<SnapshotData> compressed;
+  for (std::vector<byte>& data : contexts) {
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = static_cast<byte>(i * 13 + data.size());
+    }
+    SnapshotData snapshot_data(
+        base::Vector<const byte>(data.data(), data.size()));
+    compressed.push_back(i::SnapshotCompression::Compress(&snapshot_data));
+  }
+
+  std::vector<base::Vector<const byte>> compressed_data;
+  for (const SnapshotData& data : compressed) {
+    compressed_data.push_back(data.RawData());
+  }
+  i::ContextSnapshotCache cache(std::move(compressed_data));
+  cache.DecompressInBackground();
+  for (size_t i = 0; i < contexts.size(); i++) {
+    base::Vector<const byte> expected(contexts[i].data(), contexts[i].size());
+    base::Vector<const byte> decompressed = cache.Get(i);
+    CHECK_EQ(expected, decompressed);
+    // Later lookups reuse the decompressed data.
+    CHECK_EQ(decompressed.begin(), cache.Get(i).begin());
+  }
+}
+
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
   base::Vector<const byte> startup_blob;
@@ -2588,6 +2638,73 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+namespace {
+
+// Returns whether the script evaluated to "abcdef".
+bool CompileAndRunInNewIsolate(const std::string& js_source,
+                               bool allow_compilation) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  bool is_abcdef;
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(isolate, v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source.c_str()), origin);
+    v8::Local<v8::UnboundScript> script;
+    {
+      base::Optional<DisallowCompilation> no_compile;
+      if (!allow_compilation) {
+        no_compile.emplace(reinterpret_cast<Isolate*>(isolate));
+      }
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    is_abcdef = result->ToString(context)
+                    .ToLocalChecked()
+                    ->Equals(context, v8_str("abcdef"))
+                    .FromJust();
+  }
+  isolate->Dispose();
+  return is_abcdef;
+}
+
+}  // namespace
+
+TEST(ProcessWideScriptCacheIsolates) {
+  FLAG_process_wide_script_cache = true;
+  ProcessWideScriptCache* cache = ProcessWideScriptCache::Get();
+  cache->Clear();
+
+  // Short scripts are not cached.
+  std::string js_source = "function f() { return 'abc'; }; f() + 'def'";
+  CHECK(CompileAndRunInNewIsolate(js_source, true));
+  CHECK_EQ(0u, cache->size_for_testing());
+
+  js_source = "/*" +
+              std::string(ProcessWideScriptCache::kMinSourceLength, ' ') +
+              "*/" + js_source;
+  CHECK(CompileAndRunInNewIsolate(js_source, true));
+  size_t size = cache->size_for_testing();
+  CHECK_LT(0u, size);
+
+  // Another isolate deserializes the script instead of compiling it.
+  CHECK(CompileAndRunInNewIsolate(js_source, false));
+  CHECK_EQ(size, cache->size_for_testing());
+
+  // Entries are evicted once the cache is over budget.
+  FLAG_process_wide_script_cache_size = 0;
+  CHECK(CompileAndRunInNewIsolate(js_source + ";", true));
+  CHECK_EQ(0u, cache->size_for_testing());
+  cache->Clear();
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* js_source =
       "function f() {"
@@ -2687,6 +2804,177 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerTieringHints) {
+  if (!FLAG_turbofan || FLAG_always_turbofan) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_code_cache_tiering_hints = true;
+  FlagList::EnforceFlagImplications();
+  const char* js_source =
+      "function f() { return 'abc'; };"
+      "function g() { return 'xyz'; };"
+      "%PrepareFunctionForOptimization(f);"
+      "f(); g();"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // Only the optimized function {f} carries the hint.
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate2, Script::cast(toplevel->script()));
+    int hinted_functions = 0;
+    for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (!info.turbofan_tier_up_hint()) continue;
+      CHECK_EQ(0, strcmp("f", info.DebugNameCStr().get()));
+      ++hinted_functions;
+    }
+    CHECK_EQ(1, hinted_functions);
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerLazyFunctionDeserialization) {
+  FLAG_lazy_code_cache_deserialization = true;
+  FlagList::EnforceFlagImplications();
+  // {f} doesn't create closures, so its bytecode goes into a section of the
+  // code cache that is only deserialized when {f} is first called.
+  const char* js_source =
+      "function f() { let x = 'abc'; return x; };"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    CHECK(toplevel->is_compiled());
+    Handle<SharedFunctionInfo> f;
+    {
+      SharedFunctionInfo::ScriptIterator iter(
+          i_isolate2, Script::cast(toplevel->script()));
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (strcmp("f", info.DebugNameCStr().get()) == 0) {
+          f = handle(info, i_isolate2);
+        }
+      }
+    }
+    CHECK(!f.is_null());
+    CHECK(!f->is_compiled());
+    CHECK_EQ(1, EphemeronHashTable::cast(
+                    i_isolate2->heap()->lazy_code_cache_functions())
+                    .NumberOfElements());
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+    CHECK(f->is_compiled());
+    CHECK_EQ(0, EphemeronHashTable::cast(
+                    i_isolate2->heap()->lazy_code_cache_functions())
+                    .NumberOfElements());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerPrecompileLeafFunctions) {
+  FLAG_code_cache_precompile_leaf_functions = true;
+  FlagList::EnforceFlagImplications();
+  // {f} is never called before the cache is produced, but still gets its
+  // bytecode into the lazy functions section. {g} creates a closure, so it
+  // stays uncompiled.
+  const char* js_source =
+      "function f() { let x = 'abc'; return x; };"
+      "function g() { return () => 1; };"
+      "'def'";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(js_source, CodeCacheType::kAfterExecute);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    CHECK_EQ(1, EphemeronHashTable::cast(
+                    i_isolate2->heap()->lazy_code_cache_functions())
+                    .NumberOfElements());
+
+    script->BindToCurrentContext()
+        ->Run(isolate2->GetCurrentContext())
+        .ToLocalChecked();
+    v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("f")).ToLocalChecked());
+    // Calling {f} deserializes its bytecode instead of compiling it.
+    v8::Local<v8::Value> result =
+        f->Call(context, v8::Undefined(isolate2), 0, nullptr).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abc"))
+              .FromJust());
+    CHECK_EQ(0, EphemeronHashTable::cast(
+                    i_isolate2->heap()->lazy_code_cache_functions())
+                    .NumberOfElements());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <vector>
+
 #include "include/v8-initialization.h"
 #include "include/v8-json.h"
 #include "src/api/api-inl.h"
@@ -41,7 +43,9 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
 #include "src/init/v8.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/string-table.h"
 #include "src/strings/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1885,6 +1889,40 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(StringTableLookupKeys) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  uint64_t seed = HashSeed(isolate);
+
+  // A key that is in the table already, new keys, and a duplicate of one
+  // of the new keys.
+  const char* names[] = {"length", "bulk_key_a", "bulk_key_b", "bulk_key_a"};
+  std::vector<OneByteStringKey> keys;
+  std::vector<OneByteStringKey*> key_pointers;
+  keys.reserve(arraysize(names));
+  for (const char* name : names) {
+    keys.emplace_back(base::OneByteVector(name), seed);
+    key_pointers.push_back(&keys.back());
+  }
+  Handle<String> results[arraysize(names)];
+  isolate->string_table()->LookupKeys(
+      isolate,
+      base::Vector<OneByteStringKey* const>(key_pointers.data(),
+                                            key_pointers.size()),
+      results);
+
+  for (size_t i = 0; i < arraysize(names); i++) {
+    CHECK(results[i]->IsInternalizedString());
+    CHECK(results[i]->IsOneByteEqualTo(base::CStrVector(names[i])));
+    CHECK_EQ(*results[i], *factory->InternalizeUtf8String(names[i]));
+  }
+  CHECK_EQ(*results[0], *factory->length_string());
+  CHECK_EQ(*results[1], *results[3]);
+  CHECK_NE(*results[1], *results[2]);
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
@@ -2187,6 +2225,66 @@ TEST(CheckCachedDataInternalExternalUncachedStringTwoByte) {
   }
 }
 
+class Utf8Resource : public v8::String::ExternalUtf8StringResource {
+ public:
+  Utf8Resource(const char* data, bool* disposed)
+      : data_(data), length_(strlen(data)), disposed_(disposed) {}
+  ~Utf8Resource() override { *disposed_ = true; }
+  const char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  const char* data_;
+  size_t length_;
+  bool* disposed_;
+};
+
+TEST(NewExternalUtf8Ascii) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* data = "external ascii string";
+  bool disposed = false;
+  {
+    v8::HandleScope inner_scope(CcTest::isolate());
+    v8::Local<v8::String> str =
+        v8::String::NewExternalUtf8(CcTest::isolate(),
+                                    new Utf8Resource(data, &disposed))
+            .ToLocalChecked();
+    Handle<String> string = v8::Utils::OpenHandle(*str);
+    // Pure ASCII data is used in place.
+    CHECK(string->IsExternalOneByteString());
+    CHECK_EQ(data, reinterpret_cast<const char*>(
+                       Handle<ExternalOneByteString>::cast(string)
+                           ->GetChars(GetPtrComprCageBase(*string))));
+    CHECK(string->IsOneByteEqualTo(base::CStrVector(data)));
+  }
+  CHECK(!disposed);
+  CcTest::CollectAllAvailableGarbage();
+  CHECK(disposed);
+}
+
+TEST(NewExternalUtf8NonAscii) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  bool disposed = false;
+  // "ä€😀" encoded as UTF-8.
+  v8::Local<v8::String> str =
+      v8::String::NewExternalUtf8(
+          CcTest::isolate(),
+          new Utf8Resource("\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80",
+                           &disposed))
+          .ToLocalChecked();
+  // Non-ASCII data is decoded right away, and the resource freed.
+  CHECK(disposed);
+  Handle<String> string = v8::Utils::OpenHandle(*str);
+  CHECK(!string->IsExternalString());
+  CHECK_EQ(4, string->length());
+  CHECK_EQ(0xE4, string->Get(0));
+  CHECK_EQ(0x20AC, string->Get(1));
+  CHECK_EQ(0xD83D, string->Get(2));
+  CHECK_EQ(0xDE00, string->Get(3));
+}
+
 }  // namespace test_strings
 }  // namespace internal
 }  // namespace v8
@@ -4,6 +4,7 @@
 
 #include <stdlib.h>
 #include <utility>
+#include <vector>
 
 #include "src/init/v8.h"
 
@@ -195,6 +196,47 @@ TEST(TransitionArray_DifferentFieldNames) {
 }
 
 
+TEST(TransitionArray_ManyFieldNames) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  // Enough transitions for the lookup to search by hash instead of linearly.
+  const int PROPS_COUNT = 500;
+  std::vector<Handle<String>> names;
+  std::vector<Handle<Map>> maps;
+  PropertyAttributes attributes = NONE;
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    base::EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    Handle<String> name = factory->InternalizeUtf8String(buffer.begin());
+    Handle<Map> map =
+        Map::CopyWithField(isolate, map0, name, FieldType::Any(isolate),
+                           attributes, PropertyConstness::kMutable,
+                           Representation::Tagged(), OMIT_TRANSITION)
+            .ToHandleChecked();
+    names.push_back(name);
+    maps.push_back(map);
+
+    TransitionsAccessor::Insert(isolate, map0, name, map, PROPERTY_TRANSITION);
+  }
+
+  TransitionsAccessor transitions(isolate, *map0);
+  CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    CHECK_EQ(*maps[i], transitions.SearchTransition(
+                           *names[i], PropertyKind::kData, attributes));
+  }
+  Handle<String> missing = factory->InternalizeUtf8String("missing");
+  CHECK(transitions.SearchTransition(*missing, PropertyKind::kData, attributes)
+            .is_null());
+
+  DCHECK(transitions.IsSortedNoDuplicates());
+}
+
 TEST(TransitionArray_SameFieldNamesDifferentAttributesSimple) {
   CcTest::InitializeVM();
   v8::HandleScope scope(CcTest::isolate());
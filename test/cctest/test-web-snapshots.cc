@@ -1000,5 +1000,39 @@ TEST(builtin_objectsDeduplicated) {
                   kFunctionCount, kObjectCount, kArrayCount);
 }
 
+TEST(ConcurrentStringDecoding) {
+  FlagScope<bool> concurrent_string_decoding(
+      &FLAG_web_snapshot_concurrent_string_decoding, true);
+  // A string table that is large enough to be decoded concurrently, with
+  // ASCII, Latin-1 and two-byte strings. The strings are referred to twice so
+  // that they are not written in-place.
+  const char* snapshot_source =
+      "var foo = [];\n"
+      "for (let i = 0; i < 20000; i++) {\n"
+      "  const s = 'string' + i + ['', '\\u00e9', '\\u{1F600}'][i % 3];\n"
+      "  foo.push(s, s);\n"
+      "}\n";
+  const char* test_source =
+      "(function() {\n"
+      "  for (let i = 0; i < 20000; i++) {\n"
+      "    const s = 'string' + i + ['', '\\u00e9', '\\u{1F600}'][i % 3];\n"
+      "    if (foo[2 * i] !== s || foo[2 * i + 1] !== s) return 'fail';\n"
+      "  }\n"
+      "  return foo.length == 40000 ? 'pass' : 'fail';\n"
+      "})()";
+  const char* expected_result = "pass";
+  uint32_t kStringCount = 20001;  // 'foo' and the strings in the array.
+  uint32_t kSymbolCount = 0;
+  uint32_t kBuiltinObjectCount = 0;
+  uint32_t kMapCount = 0;
+  uint32_t kContextCount = 0;
+  uint32_t kFunctionCount = 0;
+  uint32_t kObjectCount = 0;
+  uint32_t kArrayCount = 1;
+  TestWebSnapshot(snapshot_source, test_source, expected_result, kStringCount,
+                  kSymbolCount, kBuiltinObjectCount, kMapCount, kContextCount,
+                  kFunctionCount, kObjectCount, kArrayCount);
+}
+
 }  // namespace internal
 }  // namespace v8
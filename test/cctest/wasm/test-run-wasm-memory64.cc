@@ -52,6 +52,11 @@ WASM_EXEC_TEST(Load) {
   CHECK_TRAP(r.Call(kWasmPageSize - 3));
   CHECK_EQ(0x0, r.Call(kWasmPageSize - 4));
   CHECK_TRAP(r.Call(uint64_t{1} << 32));
+  // Indexes with any bit of the upper half set are out of bounds, even if the
+  // lower half is in bounds.
+  CHECK_TRAP(r.Call((uint64_t{1} << 32) + 4));
+  CHECK_TRAP(r.Call(uint64_t{1} << 40));
+  CHECK_TRAP(r.Call(uint64_t{1} << 63));
 }
 
 // TODO(clemensb): Test atomic instructions.
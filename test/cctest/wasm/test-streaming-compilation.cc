@@ -1383,6 +1383,59 @@ STREAM_TEST(TestCompileErrorFunctionName) {
   }
 }
 
+// Lazily compiled functions are validated in the background while the module
+// streams in. The reported error is still the one of the first invalid
+// function.
+STREAM_TEST(TestLazyFunctionValidationError) {
+  FlagScope<bool> lazy_compilation(&i::FLAG_wasm_lazy_compilation, true);
+  FlagScope<bool> no_lazy_validation(&i::FLAG_wasm_lazy_validation, false);
+
+  const uint8_t bytes[] = {
+      WASM_MODULE_HEADER,                 // module header
+      kTypeSectionCode,                   // section code
+      U32V_1(1 + SIZEOF_SIG_ENTRY_x_x),   // section size
+      U32V_1(1),                          // type count
+      SIG_ENTRY_x_x(kI32Code, kI32Code),  // signature entry
+      kFunctionSectionCode,               // section code
+      U32V_1(1 + 3),                      // section size
+      U32V_1(3),                          // functions count
+      0,                                  // signature index
+      0,                                  // signature index
+      0,                                  // signature index
+      kCodeSectionCode,                   // section code
+      U32V_1(1 + 5 + 3 + 5),              // section size
+      U32V_1(3),                          // functions count
+  };
+  const uint8_t valid_code[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprLocalGet, 0, kExprEnd  // body
+  };
+  const uint8_t missing_end[] = {
+      U32V_1(2),  // body size
+      U32V_1(0),  // locals count
+      kExprNop    // body
+  };
+  const uint8_t invalid_local[] = {
+      U32V_1(4),                  // body size
+      U32V_1(0),                  // locals count
+      kExprLocalGet, 5, kExprEnd  // body
+  };
+
+  StreamTester tester(isolate);
+  tester.OnBytesReceived(bytes, arraysize(bytes));
+  tester.OnBytesReceived(valid_code, arraysize(valid_code));
+  tester.OnBytesReceived(missing_end, arraysize(missing_end));
+  tester.RunCompilerTasks();
+  tester.OnBytesReceived(invalid_local, arraysize(invalid_local));
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+
+  CHECK(tester.IsPromiseRejected());
+  CHECK_NE(std::string::npos,
+           tester.error_message().find("must end with \"end\" opcode"));
+}
+
 STREAM_TEST(TestSetModuleCodeSection) {
   StreamTester tester(isolate);
 
@@ -144,6 +144,50 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(SharedAcrossModules) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module1 = NewModule(isolate);
+  auto module2 = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+
+  auto kind = compiler::WasmImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_ii();
+  int expected_arity = static_cast<int>(sig->parameter_count());
+
+  WasmCode* c1;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(
+        module1->import_wrapper_cache());
+    c1 = CompileImportWrapper(module1.get(), isolate->counters(), kind, sig,
+                              expected_arity, kNoSuspend, &cache_scope);
+  }
+  // A structurally equal signature of another module gets its own copy of the
+  // shared wrapper.
+  const ValueType kTypes[] = {kWasmI32, kWasmI32, kWasmI32};
+  FunctionSig other_sig_storage(1, 2, kTypes);
+  const FunctionSig* other_sig = &other_sig_storage;
+  CHECK_NE(sig, other_sig);
+  WasmCode* c2;
+  {
+    WasmImportWrapperCache::ModificationScope cache_scope(
+        module2->import_wrapper_cache());
+    c2 = CompileImportWrapper(module2.get(), isolate->counters(), kind,
+                              other_sig, expected_arity, kNoSuspend,
+                              &cache_scope);
+  }
+
+  CHECK_NOT_NULL(c1);
+  CHECK_NOT_NULL(c2);
+  CHECK_NE(c1, c2);
+  CHECK_EQ(module1.get(), c1->native_module());
+  CHECK_EQ(module2.get(), c2->native_module());
+  CHECK_EQ(WasmCode::Kind::kWasmToJsWrapper, c2->kind());
+  CHECK_EQ(c1->instructions().size(), c2->instructions().size());
+  CHECK_EQ(c1->reloc_info().size(), c2->reloc_info().size());
+  CHECK_EQ(c1->stack_slots(), c2->stack_slots());
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
@@ -5,8 +5,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <map>
+#include <string>
+
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
 #include "src/objects/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
@@ -363,6 +368,108 @@ TEST(SerializeLiftoffModuleFails) {
   CHECK(!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
 }
 
+namespace {
+
+class InMemoryCodeCache : public v8::WasmCodeCache {
+ public:
+  v8::OwnedBuffer Get(v8::MemorySpan<const uint8_t> key) override {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(ToString(key));
+    if (it == entries_.end()) return {};
+    ++hits_;
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[it->second.size()]);
+    memcpy(buffer.get(), it->second.data(), it->second.size());
+    return {std::move(buffer), it->second.size()};
+  }
+
+  void Put(v8::MemorySpan<const uint8_t> key,
+           v8::MemorySpan<const uint8_t> data) override {
+    base::MutexGuard guard(&mutex_);
+    entries_[ToString(key)] = ToString(data);
+    stored_.Signal();
+  }
+
+  void WaitForPut() { stored_.Wait(); }
+
+  int hits() {
+    base::MutexGuard guard(&mutex_);
+    return hits_;
+  }
+
+ private:
+  static std::string ToString(v8::MemorySpan<const uint8_t> bytes) {
+    return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+  }
+
+  base::Mutex mutex_;
+  base::Semaphore stored_{0};
+  std::map<std::string, std::string> entries_;
+  int hits_ = 0;
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(CodeCacheRoundTrip) {
+  FlagScope<bool> no_wasm_dynamic_tiering(&FLAG_wasm_dynamic_tiering, false);
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  WasmSerializationTest::BuildWireBytes(&zone, &buffer);
+
+  InMemoryCodeCache code_cache;
+  v8::WasmCodeCache::Set(&code_cache);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // The first compilation misses the cache and stores the TurboFan code once
+  // top-tier compilation finished.
+  std::weak_ptr<NativeModule> weak_native_module;
+  v8::Isolate* first_isolate = v8::Isolate::New(create_params);
+  {
+    v8::HandleScope scope(first_isolate);
+    LocalContext env(first_isolate);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(first_isolate);
+    ErrorThrower thrower(i_isolate, "CodeCacheRoundTrip");
+    Handle<WasmModuleObject> module_object =
+        GetWasmEngine()
+            ->SyncCompile(i_isolate, WasmFeatures::FromIsolate(i_isolate),
+                          &thrower,
+                          ModuleWireBytes(buffer.begin(), buffer.end()))
+            .ToHandleChecked();
+    weak_native_module = module_object->shared_native_module();
+    module_object->native_module()
+        ->compilation_state()
+        ->WaitForTopTierFinished();
+    code_cache.WaitForPut();
+    CHECK_EQ(0, code_cache.hits());
+  }
+  first_isolate->Dispose();
+  while (weak_native_module.lock()) {
+  }
+
+  // Compiling the same bytes again takes the code from the cache.
+  v8::Isolate* second_isolate = v8::Isolate::New(create_params);
+  {
+    v8::HandleScope scope(second_isolate);
+    LocalContext env(second_isolate);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(second_isolate);
+    ErrorThrower thrower(i_isolate, "CodeCacheRoundTrip");
+    Handle<WasmModuleObject> module_object =
+        GetWasmEngine()
+            ->SyncCompile(i_isolate, WasmFeatures::FromIsolate(i_isolate),
+                          &thrower,
+                          ModuleWireBytes(buffer.begin(), buffer.end()))
+            .ToHandleChecked();
+    CHECK_EQ(1, code_cache.hits());
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = module_object->native_module()->GetCode(0);
+    CHECK_NOT_NULL(code);
+    CHECK_EQ(ExecutionTier::kTurbofan, code->tier());
+  }
+  second_isolate->Dispose();
+  v8::WasmCodeCache::Set(nullptr);
+}
+
 }  // namespace test_wasm_serialization
 }  // namespace wasm
 }  // namespace internal
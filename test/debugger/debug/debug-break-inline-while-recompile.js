@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --concurrent-recompilation
+// Flags: --no-always-turbofan
+
+// Setting a break point in a function which a concurrent job inlines does not
+// abort the job, but keeps its code from being installed.
+
+Debug = debug.Debug
+
+var hit = false;
+Debug.setListener(function(event) {
+  if (event == Debug.DebugEvent.Break) hit = true;
+});
+
+function g() {
+  return 1;
+}
+
+function f() {
+  return g() + 1;
+}
+
+function h() {
+  return 2;
+}
+
+%PrepareFunctionForOptimization(f);
+f();
+f();
+%DisableOptimizationFinalization();
+%OptimizeFunctionOnNextCall(f, "concurrent");
+f();
+%WaitForBackgroundOptimization();
+
+// A break point in an unrelated function keeps the job.
+Debug.setBreakPoint(h, 0, 0);
+Debug.clearAllBreakPoints();
+
+// A break point in the inlined function discards the job's code.
+Debug.setBreakPoint(g, 0, 0);
+%FinalizeOptimization();
+assertUnoptimized(f);
+assertEquals(2, f());
+assertTrue(hit);
+
+Debug.clearAllBreakPoints();
+Debug.setListener(null);
@@ -48,10 +48,9 @@ foo();
 %OptimizeFunctionOnNextCall(foo, "concurrent");
 foo();
 
-// Set break points on an unrelated function. This clears both optimized
-// and (shared) unoptimized code on foo, and sets both to lazy-compile builtin.
-// Clear the break point immediately after to deactivate the debugger.
-// Do all of this after compile graph has been created.
+// Set break points on an unrelated function. This leaves the recompilation
+// of foo alone. Clear the break point immediately after to deactivate the
+// debugger. Do all of this after compile graph has been created.
 %WaitForBackgroundOptimization();
 Debug.setListener(function(){});
 Debug.setBreakPoint(bar, 0, 0);
@@ -60,6 +59,5 @@ Debug.setListener(null);
 assertUnoptimized(foo);
 
 // Install optimized code when concurrent optimization finishes.
-// This needs to be able to deal with shared code being a builtin.
 %FinalizeOptimization();
-assertUnoptimized(foo);
+assertOptimized(foo);
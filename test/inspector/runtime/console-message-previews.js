@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that console message previews can be disabled.');
+
+function logArgument(message) {
+  const arg = message.params.args[0];
+  InspectorTest.log(`type: ${arg.type}, has objectId: ${!!arg.objectId}, ` +
+                    `has preview: ${!!arg.preview}`);
+  return arg;
+}
+
+(async function test() {
+  await Protocol.Runtime.enable();
+
+  InspectorTest.log('Log with previews:');
+  Protocol.Runtime.evaluate({expression: 'console.log({a: 1})'});
+  logArgument(await Protocol.Runtime.onceConsoleAPICalled());
+
+  InspectorTest.log('Log without previews:');
+  await Protocol.Runtime.setConsoleMessagePreviewsEnabled({enabled: false});
+  Protocol.Runtime.evaluate({expression: 'console.log({a: 1})'});
+  const arg = logArgument(await Protocol.Runtime.onceConsoleAPICalled());
+  const {result} = await Protocol.Runtime.getProperties(
+      {objectId: arg.objectId, ownProperties: true});
+  const property = result.result.find(property => property.name === 'a');
+  InspectorTest.log(`a: ${property.value.value}`);
+
+  InspectorTest.log('Log with previews enabled again:');
+  await Protocol.Runtime.setConsoleMessagePreviewsEnabled({enabled: true});
+  Protocol.Runtime.evaluate({expression: 'console.log({a: 1})'});
+  logArgument(await Protocol.Runtime.onceConsoleAPICalled());
+
+  InspectorTest.completeTest();
+})();
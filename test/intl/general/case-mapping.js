@@ -217,3 +217,39 @@ assertEquals("\u00A0¡¢£¤¥¦§¨©ª«¬\u00AD®°±²³´µ¶·¸¹º»¼½
     "àáâãäåæçèéêëi\u0307\u0300i\u0307\u0301îïðñòóôõö×øùúûüýþß" +
     "àáâãäåæçèéêëìíîïðñòóôõö÷øùúûüýþÿ",
     latin1Suppl.toLocaleLowerCase("lt"));
+
+// Two-byte strings whose characters have a simple case mapping
+assertEquals("привет, мир ёж", "ПРИВЕТ, Мир Ёж".toLowerCase());
+assertEquals("ПРИВЕТ, МИР ЁЖ", "привет, Мир ёж".toUpperCase());
+assertEquals("ĀāĂăĆć".toLowerCase(), "āāăăćć");
+assertEquals("ĀāĂăĆć".toUpperCase(), "ĀĀĂĂĆĆ");
+assertEquals("東京 ｔｏｋｙｏ ㍿", "東京 ＴＯＫＹＯ ㍿".toLowerCase());
+assertEquals("東京 ＴＯＫＹＯ ㍿", "東京 ｔｏｋｙｏ ㍿".toUpperCase());
+assertEquals("ⓐⓑ → ⅰⅱ", "ⒶⒷ → ⅠⅡ".toLowerCase());
+assertEquals("ÿ ŀ µ ɥ", "Ÿ Ŀ µ Ɥ".toLowerCase());
+assertEquals("Ÿ Ŀ Μ Ɥ", "ÿ ŀ µ ɥ".toUpperCase());
+var already_lower = "content-type: текст";
+assertEquals(already_lower, already_lower.toLowerCase());
+// Characters that need the full Unicode case mapping, after a prefix that
+// does not
+assertEquals("привет σς", "ПРИВЕТ ΣΣ".toLowerCase());
+assertEquals("привет i̇", "ПРИВЕТ İ".toLowerCase());
+assertEquals("ПРИВЕТ SS", "привет ß".toUpperCase());
+assertEquals("ПРИВЕТ 𐐘", "привет 𐑀".toUpperCase());
+assertEquals("ǆ ǆ", "ǅ Ǆ".toLowerCase());
+
+// Strings that are long enough for the vectorized ASCII loops
+var header = "Content-Type: Application/JSON; Charset=UTF-8";
+assertEquals("content-type: application/json; charset=utf-8",
+             header.toLowerCase());
+assertEquals("CONTENT-TYPE: APPLICATION/JSON; CHARSET=UTF-8",
+             header.toUpperCase());
+assertEquals("abcdefghijklmnopqrstuvwxyzé",
+             "ABCDEFGHIJKLMNOPQRSTUVWXYZÉ".toLowerCase());
+assertEquals("ABCDEFGHIJKLMNOPQRSTUVWXYZÉ",
+             "abcdefghijklmnopqrstuvwxyzé".toUpperCase());
+assertEquals("ABCDEFGHIJKLMNOPQRSTUVWXYZSS",
+             "abcdefghijklmnopqrstuvwxyzß".toUpperCase());
+var lower = "abcdefghijklmnopqrstuvwxyz0123456789";
+assertEquals(lower, lower.toLowerCase());
+assertEquals(lower.toUpperCase(), lower.toUpperCase().toUpperCase());
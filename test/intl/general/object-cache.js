@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --intl-object-cache-size=2
+
+// Intl objects of the same locale and options share their ICU objects, and
+// ones with different options must not.
+
+for (let i = 0; i < 3; i++) {
+  assertEquals(-1, new Intl.Collator('en').compare('a', 'B'));
+  assertEquals(1,
+      new Intl.Collator('en', {caseFirst: 'upper'}).compare('a', 'A'));
+  assertEquals(-1,
+      new Intl.Collator('en', {caseFirst: 'lower'}).compare('a', 'A'));
+  assertEquals(0,
+      new Intl.Collator('en', {sensitivity: 'base'}).compare('a', 'A'));
+  assertEquals(-1, new Intl.Collator('en-u-kn').compare('2', '10'));
+  assertEquals(1, new Intl.Collator('en').compare('2', '10'));
+  assertEquals('en-u-kn',
+      new Intl.Collator('en-u-kn').resolvedOptions().locale);
+  assertEquals('en', new Intl.Collator('en', {numeric: true})
+      .resolvedOptions().locale);
+
+  assertEquals('1,234.5', new Intl.NumberFormat('en').format(1234.5));
+  assertEquals('1.234,5', new Intl.NumberFormat('de').format(1234.5));
+  assertEquals('1,234.50', new Intl.NumberFormat('en',
+      {minimumFractionDigits: 2}).format(1234.5));
+  assertEquals('1234.5', new Intl.NumberFormat('en',
+      {useGrouping: false}).format(1234.5));
+  assertEquals('1–2', new Intl.NumberFormat('en').formatRange(1, 2));
+
+  const date = new Date(Date.UTC(2022, 0, 2, 3, 4, 5));
+  assertEquals('1/2/2022', new Intl.DateTimeFormat('en',
+      {timeZone: 'UTC'}).format(date));
+  assertEquals('1/1/2022', new Intl.DateTimeFormat('en',
+      {timeZone: 'America/Los_Angeles'}).format(date));
+  assertEquals('03:04', new Intl.DateTimeFormat('en',
+      {timeZone: 'UTC', hour: '2-digit', minute: '2-digit', hour12: false})
+      .format(date));
+  assertEquals('03:04 AM', new Intl.DateTimeFormat('en',
+      {timeZone: 'UTC', hour: '2-digit', minute: '2-digit'}).format(date));
+  assertEquals('America/Los_Angeles', new Intl.DateTimeFormat('en',
+      {timeZone: 'America/Los_Angeles'}).resolvedOptions().timeZone);
+  assertEquals('Sunday, January 2, 2022', new Intl.DateTimeFormat('en',
+      {timeZone: 'UTC', dateStyle: 'full'}).format(date));
+  assertEquals('1/2/22', new Intl.DateTimeFormat('en',
+      {timeZone: 'UTC', dateStyle: 'short'}).format(date));
+}
@@ -0,0 +1,69 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Restores application state into a fresh realm, once from a web snapshot and
+// once with JSON.parse. The state only consists of plain objects, arrays and
+// primitives, so that both can represent it.
+
+function createState() {
+  const users = [];
+  for (let i = 0; i < 2000; i++) {
+    users.push({
+      id: i,
+      name: 'user' + i,
+      email: 'user' + i + '@example.com',
+      bio: 'Biography of user ' + i + ' with some non-ASCII text: é世',
+      tags: ['tag' + (i % 10), 'tag' + (i % 7), 'tag' + (i % 3)],
+      scores: [i, i * 2, i * 3, i / 2],
+      active: i % 2 == 0,
+    });
+  }
+  globalThis.state = {
+    version: 1,
+    users: users,
+    settings: {theme: 'dark', language: 'en', pageSize: 50},
+  };
+}
+
+let snapshot;
+let json;
+
+function Setup() {
+  const realm = Realm.create();
+  Realm.eval(realm, createState, {type: 'function'});
+  snapshot = Realm.takeWebSnapshot(realm, ['state']);
+  json = Realm.eval(realm, () => JSON.stringify(globalThis.state),
+                    {type: 'function'});
+  Realm.dispose(realm);
+}
+
+function TearDown() {
+  snapshot = undefined;
+  json = undefined;
+}
+
+function RestoreFromWebSnapshot() {
+  const realm = Realm.create();
+  if (!Realm.useWebSnapshot(realm, snapshot)) {
+    throw new Error('Deserializing the web snapshot failed');
+  }
+  Realm.dispose(realm);
+}
+
+function RestoreFromJSON() {
+  const realm = Realm.create();
+  Realm.eval(realm, (json) => { globalThis.state = JSON.parse(json); },
+             {type: 'function', arguments: [json]});
+  Realm.dispose(realm);
+}
+
+new BenchmarkSuite('RestoreFromWebSnapshot', [1000], [
+  new Benchmark('RestoreFromWebSnapshot', false, false, 0,
+                RestoreFromWebSnapshot, Setup, TearDown)
+]);
+
+new BenchmarkSuite('RestoreFromJSON', [1000], [
+  new Benchmark('RestoreFromJSON', false, false, 0, RestoreFromJSON, Setup,
+                TearDown)
+]);
@@ -0,0 +1,66 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Copies between elements kinds convert Smis to doubles and box doubles in
+// batches. Use lengths that cross the batch size of the boxing.
+
+function Smis(length, holey) {
+  const a = [];
+  for (let i = 0; i < length; i++) a.push(i - (length >> 1));
+  if (holey) for (let i = 0; i < length; i += 3) delete a[i];
+  return a;
+}
+
+function Doubles(length, holey) {
+  const a = [0.5];
+  for (let i = 1; i < length; i++) a.push(i + 0.5);
+  if (holey) for (let i = 0; i < length; i += 5) delete a[i];
+  return a;
+}
+
+function CheckCopy(expected, actual, offset = 0) {
+  assertEquals(expected.length + offset, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertEquals(i in expected, i + offset in actual);
+    assertEquals(expected[i], actual[i + offset]);
+  }
+}
+
+(function TestSmiToDouble() {
+  for (const holey of [false, true]) {
+    const smis = Smis(3000, holey);
+    const doubles = [1.5, 2.5];
+    const result = doubles.concat(smis);
+    assertTrue(%HasDoubleElements(result));
+    assertEquals([1.5, 2.5], result.slice(0, 2));
+    CheckCopy(smis, result, 2);
+    CheckCopy(smis, smis.concat([0.5]).slice(0, smis.length));
+  }
+})();
+
+(function TestDoubleToObject() {
+  for (const holey of [false, true]) {
+    const doubles = Doubles(2500, holey);
+    const result = ['a'].concat(doubles);
+    assertTrue(%HasObjectElements(result));
+    assertEquals('a', result[0]);
+    CheckCopy(doubles, result, 1);
+    // The boxed numbers are independent of each other.
+    result[1] = 7;
+    assertEquals(holey ? undefined : 0.5, doubles[0]);
+    assertEquals(1.5, result[2]);
+  }
+})();
+
+(function TestSpread() {
+  const doubles = Doubles(1500, true);
+  const result = ['a', ...doubles];
+  assertEquals(1501, result.length);
+  for (let i = 0; i < doubles.length; i++) {
+    // Spread reads holes as undefined.
+    assertEquals(doubles[i], result[i + 1]);
+  }
+})();
@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long fast arrays are searched with vectorized C functions.
+
+const kLength = 1000;
+
+(function testSmis() {
+  const a = [];
+  for (let i = 0; i < kLength; ++i) a.push(i * 3);
+  assertTrue(%HasSmiElements(a));
+  for (const i of [0, 1, 17, kLength - 2, kLength - 1]) {
+    assertEquals(i, a.indexOf(i * 3));
+    assertTrue(a.includes(i * 3));
+    assertEquals(-1, a.indexOf(i * 3, i + 1));
+    assertFalse(a.includes(i * 3, i + 1));
+  }
+  assertEquals(-1, a.indexOf(1));
+  assertFalse(a.includes(-3));
+  assertEquals(kLength - 1, a.indexOf((kLength - 1) * 3, -1));
+  // Numbers which are no Smis still compare equal.
+  assertEquals(2, a.indexOf(6.0));
+  assertTrue(a.includes(-0));
+
+  const holey = a.slice();
+  holey[kLength + 10] = 1;
+  assertTrue(%HasHoleyElements(holey));
+  assertEquals(kLength + 10, holey.indexOf(1));
+  assertTrue(holey.includes(undefined));
+  assertEquals(-1, holey.indexOf(undefined));
+})();
+
+(function testDoubles() {
+  const a = [];
+  for (let i = 0; i < kLength; ++i) a.push(i + 0.5);
+  assertTrue(%HasDoubleElements(a));
+  assertEquals(7, a.indexOf(7.5));
+  assertEquals(-1, a.indexOf(7.5, 8));
+  assertTrue(a.includes(kLength - 0.5));
+  assertEquals(-1, a.indexOf(7));
+  assertEquals(-1, a.indexOf(NaN));
+  assertFalse(a.includes(NaN));
+
+  a[kLength - 10] = 0;
+  a[kLength - 5] = NaN;
+  assertEquals(kLength - 10, a.indexOf(-0));
+  assertTrue(a.includes(-0));
+  assertEquals(-1, a.indexOf(NaN));
+  assertTrue(a.includes(NaN));
+  assertFalse(a.includes(NaN, kLength - 4));
+  assertFalse(a.includes("7.5"));
+
+  const holey = a.slice();
+  holey[kLength + 10] = 0.25;
+  assertTrue(%HasHoleyElements(holey));
+  assertEquals(kLength + 10, holey.indexOf(0.25));
+  assertEquals(7, holey.indexOf(7.5));
+  assertTrue(holey.includes(NaN));
+  assertTrue(holey.includes(undefined));
+  assertEquals(-1, holey.indexOf(undefined));
+})();
+
+(function testObjects() {
+  const objects = [];
+  for (let i = 0; i < kLength; ++i) objects.push({i});
+  const a = objects.slice();
+  const symbol = Symbol();
+  a.push(symbol, null, true, "string", 1.5);
+  assertEquals(17, a.indexOf(objects[17]));
+  assertTrue(a.includes(objects[kLength - 1]));
+  assertEquals(-1, a.indexOf(objects[17], 18));
+  assertFalse(a.includes({i: 17}));
+  assertEquals(kLength, a.indexOf(symbol));
+  assertEquals(kLength + 1, a.indexOf(null));
+  assertEquals(kLength + 2, a.indexOf(true));
+  assertEquals(-1, a.indexOf(false));
+  assertEquals(-1, a.indexOf(undefined));
+  // Strings and Numbers are compared by value.
+  assertEquals(kLength + 3, a.indexOf("str" + "ing".repeat(1)));
+  assertEquals(kLength + 4, a.indexOf(1.5));
+})();
@@ -0,0 +1,97 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packed Smi and double arrays are sorted natively when the comparator is
+// missing or just subtracts its arguments. Check that the results are the
+// same as with an opaque comparator.
+
+function lexicographic(a, b) {
+  const x = String(a), y = String(b);
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+function numeric(a, b) {
+  return a < b ? -1 : a > b ? 1 : 0;
+}
+
+let seed = 1;
+function random() {
+  seed = (seed * 16807) % 2147483647;
+  return seed / 2147483647;
+}
+
+function smis(length) {
+  const result = [];
+  for (let i = 0; i < length; i++) {
+    const scale = [10, 1000, 2 ** 30][i % 3];
+    result.push(Math.floor((random() - 0.5) * scale));
+  }
+  result.push(0, -1, 1, 10, 100, -10, 2 ** 30 - 1, -(2 ** 30));
+  return result;
+}
+
+function doubles(length) {
+  const result = [-0, 0, 0.5, -0.5, Infinity, -Infinity];
+  for (let i = 0; i < length; i++) result.push((random() - 0.5) * 1e6);
+  return result;
+}
+
+(function TestDefaultSortOfSmis() {
+  for (const length of [3, 20, 1000]) {
+    const array = smis(length);
+    const expected = array.slice().sort(lexicographic);
+    assertEquals(expected, array.sort());
+  }
+})();
+
+(function TestSubtractingComparators() {
+  for (const length of [3, 20, 1000]) {
+    for (const make of [smis, doubles]) {
+      const ascending = make(length);
+      const expected = ascending.slice().sort(numeric);
+      ascending.sort((a, b) => a - b);
+      for (let i = 0; i < expected.length; i++) {
+        assertSame(expected[i], ascending[i]);
+      }
+
+      const descending = make(length);
+      const reversed = descending.slice().sort((a, b) => numeric(b, a));
+      descending.sort(function(a, b) { return b - a; });
+      for (let i = 0; i < reversed.length; i++) {
+        assertSame(reversed[i], descending[i]);
+      }
+    }
+  }
+})();
+
+(function TestZerosKeepTheirOrder() {
+  const array = [];
+  for (let i = 0; i < 40; i++) array.push(i % 2 ? 0 : -0, 1.5);
+  array.sort((a, b) => a - b);
+  for (let i = 0; i < 40; i++) assertSame(i % 2 ? 0 : -0, array[i]);
+})();
+
+(function TestNaNs() {
+  const array = doubles(50);
+  array.push(NaN);
+  array.sort((a, b) => a - b);
+  assertEquals(51 + 6, array.length);
+  assertTrue(array.some(Number.isNaN));
+})();
+
+(function TestOtherComparatorsAreCalled() {
+  const array = smis(100);
+  let calls = 0;
+  array.sort((a, b) => { calls++; return a - b; });
+  assertTrue(calls > 0);
+  for (let i = 1; i < array.length; i++) assertTrue(array[i - 1] <= array[i]);
+
+  // Comparing other arguments, or comparing with a class, is not numeric.
+  const same = smis(100);
+  const unchanged = same.slice();
+  same.sort((a, b) => a - a);
+  assertEquals(unchanged, same);
+  class C { constructor(a, b) { return a - b; } }
+  assertThrows(() => smis(100).sort(C), TypeError);
+})();
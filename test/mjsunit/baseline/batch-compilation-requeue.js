@@ -0,0 +1,48 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --sparkplug --no-always-sparkplug --sparkplug-filter="test*"
+// Flags: --allow-natives-syntax --no-always-turbofan
+// Flags: --baseline-batch-compilation
+// Flags: --baseline-batch-compilation-threshold=100000
+// Flags: --interrupt-budget-factor-for-feedback-allocation=4
+// Flags: --interrupt-budget=1000 --no-concurrent-sparkplug
+
+// Flags to drive Fuzzers into the right direction
+// TODO(v8:11853): Remove these flags once fuzzers handle flag implications
+// better.
+// Flags: --lazy-feedback-allocation --no-stress-concurrent-inlining
+
+// A function that exhausts its interrupt budget again while it is still
+// waiting in a batch that is far from full gets its batch compiled right
+// away.
+(function() {
+  function test_hot(a, b) {
+    return (a + b + 11) * 42 / a % b;
+  }
+
+  function test_cold(a, b) {
+    return (a + b + 11) * 42 / a % b;
+  }
+
+  %NeverOptimizeFunction(test_hot);
+  %NeverOptimizeFunction(test_cold);
+  // Trigger the first budget interrupt of both functions.
+  for (let i = 0; i < 5; ++i) {
+    test_cold(i, 4711);
+    test_hot(i, 4711);
+  }
+  assertFalse(isBaseline(test_cold));
+  assertFalse(isBaseline(test_hot));
+
+  // Keep calling test_hot until it runs out of budget another time.
+  for (let i = 0; i < 200; ++i) {
+    test_hot(i, 4711);
+  }
+  assertTrue(isBaseline(test_hot));
+
+  // The rest of the batch was compiled along with it.
+  test_cold(1, 2);
+  assertTrue(isBaseline(test_cold));
+})();
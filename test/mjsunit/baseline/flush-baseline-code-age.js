@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --allow-natives-syntax --no-stress-flush-code
+// Flags: --baseline-batch-compilation-threshold=0 --sparkplug
+// Flags: --no-always-sparkplug --lazy-feedback-allocation
+// Flags: --flush-baseline-code --flush-bytecode --no-turbofan
+// Flags: --flush-baseline-code-age=1 --bytecode-flushing-budget=0
+// Flags: --no-stress-concurrent-inlining
+// Flags: --no-concurrent-sparkplug
+
+// Baseline code is flushed after fewer GCs than bytecode.
+
+function HasBaselineCode(f) {
+  let opt_status = %GetOptimizationStatus(f);
+  return (opt_status & V8OptimizationStatus.kBaseline) !== 0;
+}
+
+function HasByteCode(f) {
+  let opt_status = %GetOptimizationStatus(f);
+  return (opt_status & V8OptimizationStatus.kInterpreted) !== 0;
+}
+
+var x = {b:20, c:30};
+function f() {
+  return x.b + 10;
+}
+
+for (let i = 1; i < 50; i++) {
+  f();
+}
+assertTrue(HasBaselineCode(f));
+
+// The baseline code gets old first, while the bytecode is kept.
+for (let i = 0; i < 3 && HasBaselineCode(f); i++) gc();
+assertFalse(HasBaselineCode(f));
+assertTrue(HasByteCode(f));
+
+// Once hot again, the function is compiled with Sparkplug again.
+for (let i = 1; i < 50; i++) {
+  f();
+}
+assertTrue(HasBaselineCode(f));
+assertEquals(30, f());
+
+// Without running, the bytecode eventually gets old as well.
+for (let i = 0; i < 10 && HasByteCode(f); i++) gc();
+assertFalse(HasBaselineCode(f));
+assertFalse(HasByteCode(f));
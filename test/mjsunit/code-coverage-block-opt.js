@@ -49,4 +49,21 @@ TestCoverage("Partial coverage collection",
  {"start":111,"end":121,"count":0}]
 );
 
+TestCoverage(
+"branches in optimized functions",
+`
+function f(x) {                           // 0000
+  if (x) { nop(); } else { nop(); }       // 0050
+}                                         // 0100
+%PrepareFunctionForOptimization(f);       // 0150
+f(true); f(false);                        // 0200
+%OptimizeFunctionOnNextCall(f);           // 0250
+f(true); f(true); f(false);               // 0300
+`,
+[{"start":0,"end":349,"count":1},
+ {"start":0,"end":101,"count":5},
+ {"start":59,"end":69,"count":3},
+ {"start":75,"end":85,"count":2}]
+);
+
 %DebugToggleBlockCoverage(false);
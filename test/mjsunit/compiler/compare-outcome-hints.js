@@ -0,0 +1,32 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-compare-outcome-hints
+
+// A branch that the comparison has never taken is moved out of line, but
+// it still has to work when it is taken in optimized code.
+function clamp(x) {
+  if (x > 100) return 100;
+  return x;
+}
+%PrepareFunctionForOptimization(clamp);
+assertEquals(1, clamp(1));
+assertEquals(2, clamp(2));
+%OptimizeFunctionOnNextCall(clamp);
+assertEquals(3, clamp(3));
+assertEquals(100, clamp(1000));
+assertOptimized(clamp);
+
+// Same for loops whose exit has never been seen, e.g. on OSR.
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    if (i === 2) %OptimizeOsr();
+    s += i;
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(sum);
+assertEquals(45, sum(10));
+assertEquals(45, sum(10));
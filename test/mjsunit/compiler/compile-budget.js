@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-compile-budget-ms=1
+// Flags: --trace-turbo-compile-budget --turbo-instruction-scheduling
+
+// Loop peeling, store-store elimination and instruction scheduling may be
+// skipped here, which must not change the result.
+function f(a) {
+  const o = {x: 0, y: 0};
+  for (let i = 0; i < a.length; ++i) {
+    o.x = a[i];
+    o.x += i;
+    o.y += o.x;
+  }
+  return o.y;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(9, f([1, 2, 3]));
+assertEquals(9, f([1, 2, 3]));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(9, f([1, 2, 3]));
+assertEquals(16, f([1, 2, 3, 4]));
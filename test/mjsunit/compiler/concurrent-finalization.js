@@ -0,0 +1,58 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --concurrent-recompilation --no-always-turbofan
+// Flags: --concurrent-turbofan-finalization
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+// The code built on the background thread runs and deoptimizes like code
+// built on the main thread. The double constant ends up in the deoptimization
+// literals, which are allocated on the background thread as well.
+function scale(x) {
+  return x * 1.5 + 0.25;
+}
+%PrepareFunctionForOptimization(scale);
+assertEquals(1.75, scale(1));
+assertEquals(3.25, scale(2));
+%OptimizeFunctionOnNextCall(scale, "concurrent");
+assertEquals(4.75, scale(3));
+%FinalizeOptimization();
+assertOptimized(scale);
+assertEquals(6.25, scale(4));
+assertEquals(NaN, scale("a"));
+assertUnoptimized(scale);
+
+// Dependencies are still committed on the main thread, so code that was
+// built on the background thread is dropped if they no longer hold.
+function new_object() {
+  var o = {};
+  o.a = 1;
+  o.b = 2;
+  return o;
+}
+
+function add_field(obj) {
+  // Assign twice to make the field non-constant.
+  obj.c = 0;
+  obj.c = 3;
+}
+%PrepareFunctionForOptimization(add_field);
+add_field(new_object());
+add_field(new_object());
+%DisableOptimizationFinalization();
+%OptimizeFunctionOnNextCall(add_field, "concurrent");
+
+var o = new_object();
+add_field(o);
+%WaitForBackgroundOptimization();
+// Invalidate the transition map after the code has been built.
+o.c = 2.2;
+%FinalizeOptimization();
+if (!%IsDictPropertyConstTrackingEnabled()) {
+  assertUnoptimized(add_field);
+}
@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+
+// Closures are allocated inline from sites which have created one closure so
+// far, and bump the closure count of their feedback cell.
+
+(function testCallbackClosure() {
+  function sum(array) {
+    let result = 0;
+    array.forEach(x => { result += x; });
+    return result;
+  }
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3]));
+  assertEquals(15, sum([4, 5, 6]));
+  assertOptimized(sum);
+})();
+
+(function testContextSpecializedClosure() {
+  function makeAdder(n) {
+    return x => x + n;
+  }
+  %PrepareFunctionForOptimization(makeAdder);
+  const addOne = makeAdder(1);
+
+  // The only closure of its feedback cell gets specialized to its context.
+  %PrepareFunctionForOptimization(addOne);
+  assertEquals(2, addOne(1));
+  %OptimizeFunctionOnNextCall(addOne);
+  assertEquals(2, addOne(1));
+
+  // The optimized {makeAdder} creates a second closure from the cell, which
+  // must not use the code specialized to the first closure's context.
+  %OptimizeFunctionOnNextCall(makeAdder);
+  const addTwo = makeAdder(2);
+  assertOptimized(makeAdder);
+  %PrepareFunctionForOptimization(addTwo);
+  assertEquals(3, addTwo(1));
+  %OptimizeFunctionOnNextCall(addTwo);
+  assertEquals(3, addTwo(1));
+  assertEquals(2, addOne(1));
+})();
@@ -0,0 +1,35 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --deopt-loop-threshold=2
+
+function load(o) {
+  return o.x;
+}
+
+// Every new map deoptimizes the map check of the load.
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+assertEquals(2, load({y: 0, x: 2}));
+assertUnoptimized(load);
+
+%PrepareFunctionForOptimization(load);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+assertEquals(3, load({z: 0, x: 3}));
+assertUnoptimized(load);
+
+// The load deoptimized twice for the same reason, so it is no longer
+// specialized for the maps seen so far.
+%PrepareFunctionForOptimization(load);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+assertEquals(4, load({w: 0, x: 4}));
+assertOptimized(load);
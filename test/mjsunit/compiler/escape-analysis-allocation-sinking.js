@@ -0,0 +1,102 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape --turbo-allocation-sinking
+
+(function TestEscapeInOneBranch() {
+  let escaped;
+  function g(o) { escaped = o; }
+  %NeverOptimizeFunction(g);
+  function f(x) {
+    const o = {value: x, done: false};
+    if (x < 0) {
+      g(o);
+      return -1;
+    }
+    return o.value + 1;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(2, f(1));
+  assertEquals(-1, f(-1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(3, f(2));
+  assertEquals(-1, f(-5));
+  assertEquals(-5, escaped.value);
+  assertFalse(escaped.done);
+  assertOptimized(f);
+})();
+
+(function TestUseAfterEscape() {
+  function g(o) { o.value *= 2; return o; }
+  %NeverOptimizeFunction(g);
+  function f(x) {
+    const o = {value: x};
+    if (x > 10) {
+      const same = g(o) === o;
+      return same ? o.value : 0;
+    }
+    return o.value;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1));
+  assertEquals(22, f(11));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(2));
+  assertEquals(24, f(12));
+})();
+
+(function TestUseAfterMerge() {
+  function g(o) { o.value++; }
+  %NeverOptimizeFunction(g);
+  function f(x) {
+    const o = {value: x};
+    if (x > 10) g(o);
+    return o.value;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1));
+  assertEquals(12, f(11));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(2));
+  assertEquals(13, f(12));
+})();
+
+(function TestDeoptBeforeEscape() {
+  function g(o) { return o.value; }
+  %NeverOptimizeFunction(g);
+  function f(x, deopt) {
+    const o = {value: x};
+    if (deopt) %_DeoptimizeNow();
+    if (x < 0) return g(o);
+    return o.value;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f(1, false));
+  assertEquals(-1, f(-1, false));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(2, false));
+  assertEquals(-2, f(-2, false));
+  assertEquals(-3, f(-3, true));
+  assertEquals(3, f(3, true));
+})();
+
+(function TestEscapeInLoop() {
+  const objects = [];
+  function g(o) { objects.push(o); }
+  %NeverOptimizeFunction(g);
+  function f(n) {
+    const o = {value: n};
+    for (let i = 0; i < n; ++i) {
+      if (i % 2 == 0) g(o);
+    }
+    return o.value;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(3, f(3));
+  %OptimizeFunctionOnNextCall(f);
+  objects.length = 0;
+  assertEquals(4, f(4));
+  assertEquals(2, objects.length);
+  assertSame(objects[0], objects[1]);
+})();
@@ -147,6 +147,55 @@ for (let i = 0; i < 100; i++) {
   ExpectFastCall(uint32_test, 6);
 })();
 
+(function () {
+  function int8_test() {
+    let typed_array = new Int8Array([-42, 1, 2, 3]);
+    return fast_c_api.add_all_int8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(int8_test, -36);
+})();
+
+(function () {
+  function uint8_test() {
+    let typed_array = new Uint8Array([1, 2, 3]);
+    return fast_c_api.add_all_uint8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(uint8_test, 6);
+})();
+
+// Uint8ClampedArray has a different elements kind than Uint8Array.
+(function () {
+  function uint8_clamped_test() {
+    let typed_array = new Uint8ClampedArray([1, 2, 3]);
+    return fast_c_api.add_all_uint8_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  %PrepareFunctionForOptimization(uint8_clamped_test);
+  assertThrows(uint8_clamped_test);
+  %OptimizeFunctionOnNextCall(uint8_clamped_test);
+  assert_throws_and_optimized(uint8_clamped_test);
+})();
+
+(function () {
+  function int16_test() {
+    let typed_array = new Int16Array([-4200, 1, 2, 3]);
+    return fast_c_api.add_all_int16_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(int16_test, -4194);
+})();
+
+(function () {
+  function uint16_test() {
+    let typed_array = new Uint16Array([1000, 2000, 3000]);
+    return fast_c_api.add_all_uint16_typed_array(false /* should_fallback */,
+      typed_array);
+  }
+  ExpectFastCall(uint16_test, 6000);
+})();
+
 (function () {
   function float32_test() {
     let typed_array = new Float32Array([1.3, 2.4, 3.5]);
@@ -173,6 +222,52 @@ for (let i = 0; i < 100; i++) {
   }
 })();
 
+// ----------- add_all_double_array -----------
+// `add_all_double_array` has the following signature:
+// double add_all_double_array(bool /*should_fallback*/, FastApiArray<double>)
+
+// Packed double arrays are passed as spans.
+(function () {
+  function double_array_test() {
+    let array = [1.3, 2.4, 3.5];
+    return fast_c_api.add_all_double_array(false /* should_fallback */,
+      array);
+  }
+  if (fast_c_api.supports_fp_params) {
+    ExpectFastCall(double_array_test, 7.2);
+  } else {
+    ExpectSlowCall(double_array_test, 7.2);
+  }
+})();
+
+// Arrays of Smis, holey arrays and arrays of objects take the slow path.
+(function () {
+  function smi_array_test() {
+    return fast_c_api.add_all_double_array(false /* should_fallback */,
+      [1, 2, 3]);
+  }
+  ExpectSlowCall(smi_array_test, 6);
+})();
+
+(function () {
+  function holey_double_array_test() {
+    return fast_c_api.add_all_double_array(false /* should_fallback */,
+      [1.5, , 3.5]);
+  }
+  ExpectSlowCall(holey_double_array_test, 5);
+})();
+
+(function () {
+  function object_array_test() {
+    return fast_c_api.add_all_double_array(false /* should_fallback */,
+      [1.5, {}]);
+  }
+  %PrepareFunctionForOptimization(object_array_test);
+  assertThrows(object_array_test);
+  %OptimizeFunctionOnNextCall(object_array_test);
+  assert_throws_and_optimized(object_array_test);
+})();
+
 // ----------- TypedArray tests in various conditions -----------
 // Detached backing store.
 (function () {
@@ -0,0 +1,91 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises string support for fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// --always-turbofan is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+d8.file.execute('test/mjsunit/compiler/fast-api-helpers.js');
+
+const fast_c_api = new d8.test.FastCAPI();
+
+// ----------- add_all_<ENCODING>_char_codes -----------
+// `add_all_<ENCODING>_char_codes` have the following signature:
+// int32_t add_all_<ENCODING>_char_codes(bool /*should_fallback*/,
+//     Fast<ENCODING>String)
+
+// Flat one-byte strings hit the fast path.
+(function () {
+  function one_byte_test(str) {
+    return fast_c_api.add_all_one_byte_char_codes(false /* should_fallback */,
+      str);
+  }
+  ExpectFastCall(() => one_byte_test('abc'), 294);
+})();
+
+// Flat two-byte strings hit the fast path.
+(function () {
+  function two_byte_test(str) {
+    return fast_c_api.add_all_two_byte_char_codes(false /* should_fallback */,
+      str);
+  }
+  ExpectFastCall(() => two_byte_test('ሴ䌡'), 0x5555);
+})();
+
+// Strings with a mismatching encoding take the slow path.
+(function () {
+  function one_byte_mismatch_test() {
+    return fast_c_api.add_all_one_byte_char_codes(false /* should_fallback */,
+      'ሴ䌡');
+  }
+  ExpectSlowCall(one_byte_mismatch_test, 0x5555);
+
+  function two_byte_mismatch_test() {
+    return fast_c_api.add_all_two_byte_char_codes(false /* should_fallback */,
+      'abc');
+  }
+  ExpectSlowCall(two_byte_mismatch_test, 294);
+})();
+
+// Strings that are not flat take the slow path.
+(function () {
+  const long_string = 'abcdefghijklmnopqrstuvwxyz';
+  let cons_string = %ConstructConsString(long_string, long_string);
+  function cons_string_test() {
+    return fast_c_api.add_all_one_byte_char_codes(false /* should_fallback */,
+      cons_string);
+  }
+  ExpectSlowCall(cons_string_test, 2 * 2847);
+})();
+
+// Falling back from the fast call.
+(function () {
+  function fallback_test() {
+    return fast_c_api.add_all_one_byte_char_codes(true /* should_fallback */,
+      'abc');
+  }
+  optimize_and_check(fallback_test, 1, 1, 294);
+})();
+
+// Invalid argument types instead of a string.
+(function () {
+  function invalid_test(arg) {
+    return fast_c_api.add_all_one_byte_char_codes(false /* should_fallback */,
+      arg);
+  }
+  %PrepareFunctionForOptimization(invalid_test);
+  invalid_test('abc');
+  %OptimizeFunctionOnNextCall(invalid_test);
+
+  assert_throws_and_optimized(invalid_test, 42);
+  assert_throws_and_optimized(invalid_test, {});
+  assert_throws_and_optimized(invalid_test, [1, 2]);
+  assert_throws_and_optimized(invalid_test, Symbol());
+})();
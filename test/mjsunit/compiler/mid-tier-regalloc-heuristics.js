@@ -0,0 +1,21 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-stats
+// Flags: --turbo-mid-tier-regalloc-instruction-threshold=1
+// Flags: --turbo-mid-tier-regalloc-cold-ticks=1000
+
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; ++i) result += a[i] * i;
+  return result;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(8, sum([1, 2, 3]));
+assertEquals(8, sum([1, 2, 3]));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(8, sum([1, 2, 3]));
+assertOptimized(sum);
+assertEquals(20, sum([1, 2, 3, 4]));
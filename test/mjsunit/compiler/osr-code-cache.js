@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --osr-code-cache
+
+// Closures of the same function may have separate feedback vectors, but
+// they share the OSR code cached in the native context.
+function makeBatch() {
+  return new Function('a', `
+      let sum = 0;
+      for (let i = 0; i < a.length; i++) {
+        sum += a[i];
+        if (i == 5) %OptimizeOsr();
+      }
+      return sum;`);
+}
+
+const numbers = Array.from({length: 10}, (_, i) => i);
+for (let round = 0; round < 3; round++) {
+  const batch = makeBatch();
+  %PrepareFunctionForOptimization(batch);
+  assertEquals(45, batch(numbers));
+}
+
+// Cached OSR code that got deoptimized must not be used anymore.
+const strings = numbers.map(String);
+for (let round = 0; round < 3; round++) {
+  const batch = makeBatch();
+  %PrepareFunctionForOptimization(batch);
+  assertEquals('00123456789', batch(strings));
+  assertEquals(45, batch(numbers));
+}
@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --stress-background-compile --parallel-eager-inner-compile
+
+// Eagerly compiled module wrappers are compiled in parallel in the background
+// and each of them, as well as the functions they compile eagerly in turn, is
+// finalized as usual.
+var modules = [];
+
+(function() {
+  modules.push(function() { return 'a'; });
+})();
+
+(function() {
+  modules.push(function() { return 'b'; });
+  (function() {
+    modules.push(function() { return 'c'; });
+  })();
+})();
+
+(function() {
+  function AsmModule() {
+    'use asm';
+    function f() { return 4; }
+    return {f: f};
+  }
+  var asm = AsmModule();
+  modules.push(function() { return String(asm.f()); });
+})();
+
+(function() {
+  modules.push(() => 'e');
+})();
+
+assertEquals('abc4e', modules.map(f => f()).join(''));
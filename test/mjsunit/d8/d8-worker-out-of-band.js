@@ -0,0 +1,40 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --serializer-out-of-band-threshold=64
+
+// Large ArrayBuffer and string contents are passed to the worker out of band.
+// They are still copies, so changes are not visible to the other side.
+
+if (this.Worker) {
+  (function TestEcho() {
+    const script = `onmessage = function(msg) {
+      msg.bytes[0] = 7;
+      postMessage(msg);
+    };`;
+    const w = new Worker(script, {type: 'string'});
+
+    const bytes = new Uint8Array(1024);
+    for (let i = 0; i < bytes.length; ++i) bytes[i] = i & 0xFF;
+    const small = new Float64Array([1.5, 2.5]);
+    const one_byte = 'x'.repeat(100);
+    const two_byte = '\u2603'.repeat(100);
+    w.postMessage({bytes, view: new DataView(bytes.buffer, 16, 8), small,
+                   one_byte, two_byte});
+    bytes[1] = 42;
+
+    const result = w.getMessage();
+    assertEquals(0, bytes[0]);
+    assertEquals(7, result.bytes[0]);
+    assertEquals(1, result.bytes[1]);
+    assertEquals(1024, result.bytes.length);
+    assertEquals(255, result.bytes[255]);
+    assertSame(result.bytes.buffer, result.view.buffer);
+    assertEquals(16, result.view.getUint8(0));
+    assertEquals([1.5, 2.5], Array.from(result.small));
+    assertEquals(one_byte, result.one_byte);
+    assertEquals(two_byte, result.two_byte);
+    w.terminate();
+  })();
+}
@@ -0,0 +1,37 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups of own properties in objects with a few dozen fast properties,
+// with present and absent names and maps that share their descriptors.
+
+(function TestMidSizedObjects() {
+  for (let count of [7, 8, 9, 31, 32, 33, 48, 60]) {
+    const objects = [];
+    for (let variant = 0; variant < 4; variant++) {
+      const o = {};
+      for (let i = 0; i < count; i++) o['p' + i] = i * 10 + variant;
+      objects.push(o);
+    }
+    for (let round = 0; round < 3; round++) {
+      objects.forEach((o, variant) => {
+        for (let i = 0; i < count; i++) {
+          const name = 'p' + i;
+          assertTrue(o.hasOwnProperty(name));
+          assertEquals(i * 10 + variant, o[name]);
+          assertEquals(i * 10 + variant,
+                       Object.getOwnPropertyDescriptor(o, name).value);
+        }
+        assertFalse(o.hasOwnProperty('p' + count));
+        assertEquals(undefined, o['q0']);
+        assertEquals(count, Object.keys(o).length);
+      });
+    }
+    // Extending one object shares the descriptors with its transition
+    // parent, whose lookups of the new name must still miss.
+    objects[0]['extra'] = 1;
+    assertEquals(1, objects[0].extra);
+    assertFalse(objects[1].hasOwnProperty('extra'));
+    assertEquals(undefined, objects[1].extra);
+  }
+})();
@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-lazy-feedback-allocation
+
+// Loads of integral values from double fields and double elements don't
+// allocate a new HeapNumber.
+
+function loadX(o) { return o.x; }
+function loadKeyed(o, key) { return o[key]; }
+
+(function testField() {
+  const o = {x: 1.5};
+  o.x = 2;
+  loadX(o);
+  const x = loadX(o);
+  assertEquals(2, x);
+  assertTrue(%IsSmi(x));
+  assertEquals(2, loadKeyed(o, 'x'));
+
+  o.x = -0;
+  assertEquals(-0, loadX(o));
+  o.x = 0.25;
+  assertEquals(0.25, loadX(o));
+  o.x = NaN;
+  assertEquals(NaN, loadX(o));
+  o.x = 2 ** 40;
+  assertEquals(2 ** 40, loadX(o));
+})();
+
+(function testElement() {
+  const a = [1.5, 3];
+  assertTrue(%HasDoubleElements(a));
+  loadKeyed(a, 1);
+  const element = loadKeyed(a, 1);
+  assertEquals(3, element);
+  assertTrue(%IsSmi(element));
+  a[1] = -0;
+  assertEquals(-0, loadKeyed(a, 1));
+  assertEquals(1.5, loadKeyed(a, 0));
+})();
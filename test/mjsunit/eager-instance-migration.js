@@ -0,0 +1,28 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --eager-instance-migration
+
+// Instances of deprecated maps get migrated in one batch after a full GC,
+// without being accessed.
+
+function make(x) {
+  return {x: x, y: 'y'};
+}
+
+function noop() {}
+
+(function testMigrateAfterGC() {
+  const old_instances = [];
+  for (let i = 0; i < 100; ++i) old_instances.push(make(i));
+  // Generalizes the representation of "x" and deprecates the old map.
+  const fresh = make(1.5);
+  assertFalse(%HaveSameMap(old_instances[0], fresh));
+  gc();
+  // The migration runs on the next stack check.
+  noop();
+  for (const o of old_instances) assertTrue(%HaveSameMap(o, fresh));
+  assertEquals(42, old_instances[42].x);
+  assertEquals('y', old_instances[42].y);
+})();
@@ -0,0 +1,83 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Lookups in Map and Set only compare the keys whose hash tag matches; make
+// sure that entries are still found across growing, shrinking and deletes.
+
+(function TestManyKeys() {
+  const kCount = 3000;
+  const keys = [];
+  for (let i = 0; i < kCount; i++) {
+    switch (i % 4) {
+      case 0: keys.push(i); break;
+      case 1: keys.push('key' + i); break;
+      case 2: keys.push(i + 0.5); break;
+      case 3: keys.push({i}); break;
+    }
+  }
+  const map = new Map();
+  const set = new Set();
+  keys.forEach((key, i) => {
+    map.set(key, i);
+    set.add(key);
+  });
+  assertEquals(kCount, map.size);
+  assertEquals(kCount, set.size);
+  keys.forEach((key, i) => {
+    assertEquals(i, map.get(key));
+    assertTrue(set.has(key));
+  });
+  assertFalse(map.has('key0'));
+  assertFalse(set.has(1.5 + kCount));
+  assertFalse(map.has({}));
+
+  // Delete most of the keys so that the tables shrink and get rehashed.
+  keys.forEach((key, i) => {
+    if (i % 10 != 0) {
+      assertTrue(map.delete(key));
+      assertTrue(set.delete(key));
+    }
+  });
+  keys.forEach((key, i) => {
+    assertEquals(i % 10 == 0, map.has(key));
+    assertEquals(i % 10 == 0, set.has(key));
+    assertEquals(i % 10 == 0 ? i : undefined, map.get(key));
+  });
+
+  // Re-adding a key must not create a second entry for it.
+  keys.forEach((key, i) => {
+    map.set(key, -i);
+    set.add(key);
+  });
+  assertEquals(kCount, map.size);
+  assertEquals(kCount, set.size);
+  keys.forEach((key, i) => assertEquals(-i, map.get(key)));
+})();
+
+(function TestIterationOrder() {
+  const map = new Map();
+  for (let i = 0; i < 100; i++) map.set('k' + i, i);
+  for (let i = 0; i < 100; i += 3) map.delete('k' + i);
+  let expected = 0;
+  for (const [key, value] of map) {
+    while (expected % 3 == 0) expected++;
+    assertEquals('k' + expected, key);
+    assertEquals(expected, value);
+    expected++;
+  }
+})();
+
+(function TestOptimizedLookups() {
+  function lookup(map, key) { return map.get(key); }
+  const map = new Map();
+  for (let i = 0; i < 500; i++) map.set(i, i * 2);
+  %PrepareFunctionForOptimization(lookup);
+  assertEquals(10, lookup(map, 5));
+  %OptimizeFunctionOnNextCall(lookup);
+  for (let i = 0; i < 500; i++) assertEquals(i * 2, lookup(map, i));
+  assertEquals(undefined, lookup(map, 500));
+  assertEquals(undefined, lookup(map, -1));
+})();
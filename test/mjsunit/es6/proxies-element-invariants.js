@@ -0,0 +1,87 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Trap results for array indices of targets with fast elements pass the
+// invariant checks, while frozen, sealed and non-extensible targets and
+// targets with dictionary elements are still checked.
+
+const handler = {
+  get(target, key) { return 'trapped'; },
+  set(target, key, value) { return true; },
+  has(target, key) { return false; },
+  deleteProperty(target, key) { return true; },
+};
+
+function get(proxy, key) { return proxy[key]; }
+function set(proxy, key, value) { 'use strict'; proxy[key] = value; }
+function has(proxy, key) { return key in proxy; }
+function remove(proxy, key) { 'use strict'; return delete proxy[key]; }
+
+(function TestFastElements() {
+  for (const target of [[1, 2, 3], [1.5, 2.5], [, 'a'], {0: 'x', 1: 'y'}]) {
+    const proxy = new Proxy(target, handler);
+    for (let i = 0; i < 3; ++i) {
+      assertEquals('trapped', get(proxy, i));
+      assertEquals('trapped', get(proxy, String(i)));
+      set(proxy, i, 42);
+      assertFalse(has(proxy, i));
+      assertTrue(remove(proxy, i));
+    }
+  }
+})();
+
+(function TestFrozenTarget() {
+  const proxy = new Proxy(Object.freeze([1, 2]), handler);
+  assertThrows(() => get(proxy, 0), TypeError);
+  assertThrows(() => set(proxy, 1, 42), TypeError);
+  assertThrows(() => has(proxy, 0), TypeError);
+  assertThrows(() => remove(proxy, 1), TypeError);
+  // Missing elements are fine unless the target is not extensible.
+  assertEquals('trapped', get(proxy, 2));
+  set(proxy, 2, 42);
+  assertFalse(has(proxy, 2));
+  assertTrue(remove(proxy, 2));
+})();
+
+(function TestSealedTarget() {
+  const proxy = new Proxy(Object.seal([1, 2]), handler);
+  assertEquals('trapped', get(proxy, 0));
+  set(proxy, 0, 42);
+  assertThrows(() => has(proxy, 0), TypeError);
+  assertThrows(() => remove(proxy, 0), TypeError);
+})();
+
+(function TestNonExtensibleTarget() {
+  const proxy = new Proxy(Object.preventExtensions([1, 2]), handler);
+  assertEquals('trapped', get(proxy, 0));
+  set(proxy, 0, 42);
+  assertThrows(() => has(proxy, 0), TypeError);
+  assertThrows(() => remove(proxy, 0), TypeError);
+})();
+
+(function TestDictionaryElements() {
+  const target = [1, 2];
+  Object.defineProperty(target, 0, {writable: false, configurable: false});
+  const proxy = new Proxy(target, handler);
+  assertThrows(() => get(proxy, 0), TypeError);
+  assertThrows(() => set(proxy, 0, 42), TypeError);
+  assertThrows(() => has(proxy, 0), TypeError);
+  assertThrows(() => remove(proxy, 0), TypeError);
+  assertEquals('trapped', get(proxy, 1));
+  assertTrue(remove(proxy, 1));
+})();
+
+(function TestTypedArrayTarget() {
+  const proxy = new Proxy(new Uint8Array(2), handler);
+  assertEquals('trapped', get(proxy, 0));
+  assertFalse(has(proxy, 0));
+  Object.preventExtensions(proxy);
+  assertThrows(() => has(proxy, 0), TypeError);
+})();
+
+(function TestStringWrapperTarget() {
+  const proxy = new Proxy(new String('ab'), handler);
+  assertThrows(() => get(proxy, 0), TypeError);
+  assertThrows(() => has(proxy, 1), TypeError);
+})();
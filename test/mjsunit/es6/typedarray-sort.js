@@ -149,3 +149,47 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Large arrays without a comparator are radix sorted; compare the result
+// with sorting through a comparator. Includes the special float values,
+// arrays whose elements share most bytes, and views at an odd offset.
+(function TestLargeDefaultSort() {
+  const kLength = 3000;
+  function numericCompare(a, b) {
+    if (a < b) return -1;
+    if (b < a) return 1;
+    if (Object.is(a, -0) && Object.is(b, 0)) return -1;
+    if (Object.is(a, 0) && Object.is(b, -0)) return 1;
+    if (a !== a) return b !== b ? 0 : 1;
+    if (b !== b) return -1;
+    return 0;
+  }
+  let seed = 17;
+  function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed / 2147483648;
+  }
+  const specials = [0, -0, NaN, Infinity, -Infinity, 5e-324, -5e-324, 1.5];
+  for (const ctor of [...typedArrayConstructors, BigInt64Array,
+                      BigUint64Array]) {
+    const isBig = ctor === BigInt64Array || ctor === BigUint64Array;
+    const isFloat = ctor === Float32Array || ctor === Float64Array;
+    for (const range of [2 ** 40, 16]) {
+      const values = [];
+      for (let i = 0; i < kLength; i++) {
+        let value = Math.floor((random() - 0.5) * range);
+        if (isFloat && i % 5 == 0) value = specials[i % specials.length];
+        if (isFloat && i % 7 == 0) value = value / 1024;
+        values.push(isBig ? BigInt(value) : value);
+      }
+      const buffer = new ArrayBuffer((kLength + 1) * ctor.BYTES_PER_ELEMENT);
+      for (const offset of [0, ctor.BYTES_PER_ELEMENT]) {
+        const array = new ctor(buffer, offset, kLength);
+        array.set(values);
+        const expected = new ctor(values).sort(numericCompare);
+        assertEquals(array, array.sort());
+        assertArrayLikeEquals(array, expected, ctor);
+      }
+    }
+  }
+})();
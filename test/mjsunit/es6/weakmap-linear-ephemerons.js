@@ -0,0 +1,49 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --ephemeron-fixpoint-iterations=0
+
+// Chains of ephemerons, which have to be marked with the linear ephemeron
+// algorithm, keep all their values alive.
+
+(function TestChain() {
+  const kLength = 1000;
+  const map = new WeakMap();
+  const keys = [];
+  for (let i = 0; i <= kLength; ++i) keys.push({index: i});
+  // Insert in reverse order, so that each key is marked after its entry was
+  // processed.
+  for (let i = kLength - 1; i >= 0; --i) map.set(keys[i], keys[i + 1]);
+  let key = keys[0];
+  keys.length = 0;
+  gc();
+  for (let i = 0; i < kLength; ++i) {
+    assertTrue(map.has(key));
+    key = map.get(key);
+    assertEquals(i + 1, key.index);
+  }
+  assertFalse(map.has(key));
+})();
+
+(function TestNestedMaps() {
+  // Each value holds the next map of the chain, whose ephemerons are only
+  // discovered while marking.
+  const kLength = 100;
+  const key = {};
+  const first = new WeakMap();
+  let map = first;
+  for (let i = 0; i < kLength; ++i) {
+    const next = new WeakMap();
+    map.set(key, {index: i, next});
+    map = next;
+  }
+  map = null;
+  gc();
+  map = first;
+  for (let i = 0; i < kLength; ++i) {
+    const value = map.get(key);
+    assertEquals(i, value.index);
+    map = value.next;
+  }
+})();
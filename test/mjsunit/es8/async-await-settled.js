@@ -0,0 +1,75 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting primitives and already fulfilled promises resumes after exactly
+// one tick, interleaved with other reaction jobs in queue order.
+(function TestAwaitSettledOrder() {
+  const log = [];
+  const fulfilled = Promise.resolve('fulfilled');
+  async function f() {
+    log.push('start');
+    log.push(await 1);
+    log.push(await 'string');
+    log.push(await undefined);
+    log.push(await fulfilled);
+    log.push(await Symbol.for('symbol'));
+    return 'done';
+  }
+  function tick(n) {
+    log.push('tick ' + n);
+    if (n < 6) Promise.resolve().then(() => tick(n + 1));
+  }
+  Promise.resolve().then(() => tick(0));
+  f().then(v => log.push(v));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([
+    'start', 'tick 0', 1, 'tick 1', 'string', 'tick 2', undefined, 'tick 3',
+    'fulfilled', 'tick 4', Symbol.for('symbol'), 'tick 5', 'done', 'tick 6'
+  ], log);
+})();
+
+// Pending and rejected promises take the general path.
+(function TestAwaitPendingAndRejected() {
+  const log = [];
+  let resolve;
+  const pending = new Promise(r => resolve = r);
+  async function f() {
+    log.push(await pending);
+    try {
+      await Promise.reject('rejected');
+    } catch (e) {
+      log.push(e);
+    }
+    return 'done';
+  }
+  f().then(v => log.push(v));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([], log);
+  resolve('pending');
+  %PerformMicrotaskCheckpoint();
+  assertEquals(['pending', 'rejected', 'done'], log);
+})();
+
+// Awaiting a fulfilled promise marks it as handled.
+(function TestAwaitFulfilledHasHandler() {
+  const fulfilled = Promise.resolve(42);
+  let result;
+  (async () => result = await fulfilled)();
+  %PerformMicrotaskCheckpoint();
+  assertEquals(42, result);
+})();
+
+// Async generators share the fast path.
+(function TestAsyncGeneratorAwaitSettled() {
+  const log = [];
+  async function* g() {
+    log.push(await 1);
+    yield await Promise.resolve(2);
+  }
+  g().next().then(r => log.push(r.value));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([1, 2], log);
+})();
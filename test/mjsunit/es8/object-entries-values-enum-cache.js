@@ -0,0 +1,60 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Object.entries and Object.values read fields through the enum cache
+// indices once the enum cache of a map is initialized.
+
+function MakeObject(x, y) {
+  const o = {a: 1, b: 'two', c: x};
+  // Add enough properties to move some into the property backing store.
+  for (let i = 0; i < 10; i++) o['p' + i] = i + y;
+  Object.defineProperty(o, 'hidden', {value: 'hidden', enumerable: false});
+  o[Symbol('symbol')] = 'symbol';
+  return o;
+}
+
+(function TestValuesAndEntries() {
+  const expected_keys =
+      ['a', 'b', 'c', 'p0', 'p1', 'p2', 'p3', 'p4', 'p5', 'p6', 'p7', 'p8',
+       'p9'];
+  for (let i = 0; i < 3; i++) {
+    const o = MakeObject(1.5 + i, 0.5);
+    const values = Object.values(o);
+    const entries = Object.entries(o);
+    assertEquals(expected_keys.length, values.length);
+    assertEquals(expected_keys, entries.map(e => e[0]));
+    for (let j = 0; j < expected_keys.length; j++) {
+      assertEquals(o[expected_keys[j]], values[j]);
+      assertEquals(o[expected_keys[j]], entries[j][1]);
+    }
+  }
+})();
+
+(function TestDoubleFieldsAreCopied() {
+  const o = MakeObject(1.5, 0.5);
+  Object.values(o);
+  for (let i = 0; i < 3; i++) {
+    const values = Object.values(o);
+    const entries = Object.entries(o);
+    // Update the double fields in place. The results keep the old numbers.
+    o.c += 1;
+    o.p9 += 1;
+    assertEquals(1.5 + i, values[2]);
+    assertEquals(9.5 + i, values[12]);
+    assertEquals(1.5 + i, entries[2][1]);
+    assertEquals(9.5 + i, entries[12][1]);
+  }
+})();
+
+(function TestAccessorsAfterEnumCache() {
+  const o = {a: 1, b: 2};
+  Object.values(o);
+  const p = {a: 1, b: 2};
+  let calls = 0;
+  Object.defineProperty(p, 'c', {get() { calls++; return 3; },
+                                 enumerable: true});
+  assertEquals([1, 2, 3], Object.values(p));
+  assertEquals([['a', 1], ['b', 2], ['c', 3]], Object.entries(p));
+  assertEquals(2, calls);
+})();
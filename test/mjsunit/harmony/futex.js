@@ -245,4 +245,49 @@ if (this.Worker) {
   };
 
   TestWakeMulti(Atomics.notify);
+
+  // Waiters on different addresses don't see each other's notifications.
+  var TestWakeDistinctAddresses = function(notify) {
+    const kWorkers = 8;
+    var sab = new SharedArrayBuffer(4 * 2 * kWorkers);
+    var i32a = new Int32Array(sab);
+
+    // Worker |id| waits on i32a[id] and then stores 1 to i32a[kWorkers + id].
+    function workerCode() {
+      onmessage = function(msg) {
+        var i32a = new Int32Array(msg.sab);
+        var result = Atomics.wait(i32a, msg.id, 0);
+        Atomics.store(i32a, msg.workers + msg.id, 1);
+        postMessage(result);
+      };
+    }
+
+    var workers = [];
+    for (var id = 0; id < kWorkers; id++) {
+      workers[id] = new Worker(workerCode, {type: 'function'});
+      workers[id].postMessage({sab: sab, id: id, workers: kWorkers});
+    }
+    for (var id = 0; id < kWorkers; id++) {
+      while (%AtomicsNumWaitersForTesting(i32a, id) != 1) {}
+    }
+
+    // Nobody waits on the second half of the buffer.
+    for (var id = kWorkers; id < 2 * kWorkers; id++) {
+      assertEquals(0, notify(i32a, id));
+    }
+
+    // Wake the workers in reverse order, the others keep waiting.
+    for (var id = kWorkers - 1; id >= 0; id--) {
+      assertEquals(1, notify(i32a, id));
+      assertEquals("ok", workers[id].getMessage());
+      assertEquals(1, Atomics.load(i32a, kWorkers + id));
+      for (var other = 0; other < id; other++) {
+        assertEquals(1, %AtomicsNumWaitersForTesting(i32a, other));
+        assertEquals(0, Atomics.load(i32a, kWorkers + other));
+      }
+      workers[id].terminate();
+    }
+  };
+
+  TestWakeDistinctAddresses(Atomics.notify);
 }
@@ -0,0 +1,130 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Classes whose instance fields all have literal names and values get the
+// fields defined directly in their constructor.
+
+"use strict";
+
+{
+  class C {
+    a = 1;
+    b;
+    'c' = "str";
+    d = 1.5;
+  }
+
+  function make() { return new C; }
+  %PrepareFunctionForOptimization(make);
+  for (let i = 0; i < 3; ++i) {
+    let c = make();
+    assertEquals(['a', 'b', 'c', 'd'], Object.keys(c));
+    assertEquals(1, c.a);
+    assertEquals(undefined, c.b);
+    assertEquals("str", c.c);
+    assertEquals(1.5, c.d);
+    assertTrue(%HaveSameMap(make(), c));
+  }
+  %OptimizeFunctionOnNextCall(make);
+  assertEquals(['a', 'b', 'c', 'd'], Object.keys(make()));
+  assertTrue(%HasFastProperties(make()));
+
+  let descriptor = Object.getOwnPropertyDescriptor(make(), 'a');
+  assertTrue(descriptor.writable);
+  assertTrue(descriptor.enumerable);
+  assertTrue(descriptor.configurable);
+}
+
+{
+  // Each instance gets fresh fields.
+  class C {
+    a = 1;
+  }
+  let c1 = new C;
+  let c2 = new C;
+  c1.a = 2;
+  assertEquals(1, c2.a);
+}
+
+{
+  // Fields are defined, so setters on the prototype are not called.
+  class C {
+    a = 1;
+  }
+  Object.defineProperty(C.prototype, 'a', {
+    set(v) { throw new Error('setter called'); }
+  });
+  assertEquals(1, new C().a);
+}
+
+{
+  // An explicit constructor sees the fields already initialized.
+  class C {
+    a = 1;
+    b = 2;
+    constructor() {
+      assertEquals(1, this.a);
+      assertEquals(2, this.b);
+      this.c = this.a + this.b;
+    }
+  }
+  assertEquals(['a', 'b', 'c'], Object.keys(new C));
+  assertEquals(3, new C().c);
+}
+
+{
+  // Subclasses initialize both the base and their own fields.
+  class B {
+    a = 1;
+  }
+  class D extends B {
+    b = 2;
+  }
+  let d = new D;
+  assertEquals(['a', 'b'], Object.keys(d));
+  assertEquals(1, d.a);
+  assertEquals(2, d.b);
+  assertInstanceof(d, B);
+}
+
+{
+  // A different new.target still gets the fields.
+  class C {
+    a = 1;
+  }
+  function F() {}
+  let c = Reflect.construct(C, [], F);
+  assertEquals(1, c.a);
+  assertSame(F.prototype, Object.getPrototypeOf(c));
+}
+
+{
+  // Classes with non-literal fields keep calling the initializer.
+  let count = 0;
+  class C {
+    a = 1;
+    b = ++count;
+    ['c'] = 3;
+  }
+  assertEquals(['a', 'b', 'c'], Object.keys(new C));
+  assertEquals(2, new C().b);
+}
+
+{
+  // Classes created repeatedly from the same source.
+  function makeClass() {
+    return class {
+      a = 1;
+      b = 'x';
+    };
+  }
+  for (let i = 0; i < 3; ++i) {
+    let C = makeClass();
+    let c = new C;
+    assertEquals(1, c.a);
+    assertEquals('x', c.b);
+  }
+}
@@ -0,0 +1,33 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --finalization-registry-cleanup-task-budget-ms=1000
+
+// A cleanup task can process several dirty FinalizationRegistries, and all of
+// them get cleaned up eventually.
+
+const kRegistries = 100;
+let cleanup_call_count = 0;
+
+function cleanup(holdings) {
+  ++cleanup_call_count;
+}
+
+const registries = [];
+(function() {
+  for (let i = 0; i < kRegistries; ++i) {
+    const registry = new FinalizationRegistry(cleanup);
+    registry.register({}, i);
+    registries.push(registry);
+  }
+})();
+
+// This GC will discover dirty WeakCells and schedule cleanup.
+gc();
+assertEquals(0, cleanup_call_count);
+
+setTimeout(() => {
+  assertEquals(kRegistries, cleanup_call_count);
+}, 0);
@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-sparkplug --no-always-turbofan --no-turbofan
+
+// Comparisons dispatch straight into a following JumpIfTrue/JumpIfFalse.
+// Exercise both outcomes of each fused pair, forward and in loops.
+function classify(x) {
+  if (x === 0) return "zero";
+  if (x < 0) return "negative";
+  if (x == "10") return "ten";
+  if (x >= 100) return "large";
+  if (x instanceof Object) return "object";
+  if (x === null || x === undefined) return "nullish";
+  return "other";
+}
+
+for (let i = 0; i < 3; i++) {
+  assertEquals("zero", classify(0));
+  assertEquals("negative", classify(-5));
+  assertEquals("ten", classify(10));
+  assertEquals("large", classify(100));
+  assertEquals("object", classify(new Number(7)));
+  assertEquals("nullish", classify(null));
+  assertEquals("nullish", classify(undefined));
+  assertEquals("other", classify(7));
+}
+
+function countWhile(n) {
+  let i = 0;
+  let evens = 0;
+  while (i < n) {
+    if (i % 2 === 0) evens++;
+    i++;
+  }
+  return evens;
+}
+assertEquals(0, countWhile(0));
+assertEquals(5, countWhile(10));
+assertEquals(50, countWhile(99));
+
+function hasKey(o, k) {
+  return (k in o) ? 1 : 2;
+}
+assertEquals(1, hasKey({a: 1}, "a"));
+assertEquals(2, hasKey({a: 1}, "b"));
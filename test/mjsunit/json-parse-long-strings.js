@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings are scanned in blocks. Put quotes, escapes, control characters and
+// non-Latin-1 characters at every offset within and around a block.
+const kPadding = "abcdefghijklmnopqrstuvwxyz0123456789".repeat(3);
+for (let i = 0; i < kPadding.length; i++) {
+  const prefix = kPadding.substring(0, i);
+  const suffix = kPadding.substring(i);
+  assertEquals(prefix + suffix, JSON.parse('"' + prefix + suffix + '"'));
+  assertEquals(prefix + '"' + suffix,
+               JSON.parse('"' + prefix + '\\"' + suffix + '"'));
+  assertEquals(prefix + "\n" + suffix,
+               JSON.parse('"' + prefix + "\\n" + suffix + '"'));
+  assertEquals(prefix + "é" + suffix,
+               JSON.parse('"' + prefix + "é" + suffix + '"'));
+  assertEquals(prefix + "€" + suffix,
+               JSON.parse('"' + prefix + "€" + suffix + '"'));
+  assertEquals(prefix + "€" + suffix,
+               JSON.parse('"' + prefix + "\\u20ac" + suffix + '"'));
+  assertEquals(["€" + prefix, suffix],
+               JSON.parse('["€' + prefix + '","' + suffix + '"]'));
+  assertThrows(() => JSON.parse('"' + prefix + "\n" + suffix + '"'),
+               SyntaxError);
+  assertThrows(() => JSON.parse('"' + prefix + "€\u0001" + suffix + '"'),
+               SyntaxError);
+  assertThrows(() => JSON.parse('"' + prefix), SyntaxError);
+}
+
+// Numbers with digits and at most one decimal point.
+const numbers = [
+  "0", "-0", "0.5", "-0.5", "1.25", "123456789012345", "1234567890.12345",
+  "9007199254740993", "0.1", "0.3", "123.456", "-98765.4321",
+  "0.000000000000001", "0.0000000000000001", "1.7976931348623157",
+  "12345678901234567890", "1e5", "1.5E-3", "-0.0",
+];
+for (const n of numbers) {
+  assertEquals(Number(n), JSON.parse(n));
+  assertEquals(Number(n), JSON.parse("[" + n + "]")[0]);
+}
+assertEquals(-Infinity, 1 / JSON.parse("-0.0"));
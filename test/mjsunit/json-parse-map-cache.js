@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects nested in array elements reuse the maps of earlier objects with
+// the same keys.
+const records = JSON.parse(JSON.stringify(
+    Array.from({length: 10}, (_, i) => ({
+      id: i,
+      point: {x: i, y: -i},
+      tags: [{name: "a" + i, weight: i / 2}],
+    }))));
+for (let i = 1; i < records.length; i++) {
+  assertTrue(%HaveSameMap(records[0], records[i]));
+  assertTrue(%HaveSameMap(records[0].point, records[i].point));
+  assertTrue(%HaveSameMap(records[0].tags[0], records[i].tags[0]));
+  assertEquals({x: i, y: -i}, records[i].point);
+  assertEquals([{name: "a" + i, weight: i / 2}], records[i].tags);
+}
+
+// Objects that only share their first key get their own maps.
+const mixed = JSON.parse(
+    '[{"a":{"k":1,"v":2}},{"a":{"k":1,"w":2}},{"a":{"k":"s","v":2.5}},' +
+    '{"a":{"v":1,"k":2}},{"a":{"k":1}},{"a":{"k":1,"v":2,"x":3}}]');
+assertEquals({k: 1, v: 2}, mixed[0].a);
+assertEquals({k: 1, w: 2}, mixed[1].a);
+assertEquals({k: "s", v: 2.5}, mixed[2].a);
+assertEquals({v: 1, k: 2}, mixed[3].a);
+assertEquals({k: 1}, mixed[4].a);
+assertEquals({k: 1, v: 2, x: 3}, mixed[5].a);
+assertFalse(%HaveSameMap(mixed[0].a, mixed[1].a));
+assertFalse(%HaveSameMap(mixed[0].a, mixed[3].a));
+
+// Elements and escaped keys are fine, too.
+const elements = JSON.parse('[{"0":1,"x":2},{"0":3,"x":4},{"\\u0078":5}]');
+assertEquals([{0: 1, x: 2}, {0: 3, x: 4}, {x: 5}], elements);
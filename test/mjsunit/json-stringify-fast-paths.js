@@ -0,0 +1,111 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Reference implementation of the string escaping of JSON.stringify.
+function quote(s) {
+  let result = '"';
+  for (let i = 0; i < s.length; i++) {
+    const c = s.charCodeAt(i);
+    const next = s.charCodeAt(i + 1);
+    if (c == 0x22) {
+      result += '\\"';
+    } else if (c == 0x5C) {
+      result += '\\\\';
+    } else if (c < 0x20) {
+      const escapes = {8: 'b', 9: 't', 10: 'n', 12: 'f', 13: 'r'};
+      result += '\\' +
+          (escapes[c] || 'u' + c.toString(16).padStart(4, '0'));
+    } else if (c >= 0xD800 && c <= 0xDBFF && next >= 0xDC00 &&
+               next <= 0xDFFF) {
+      result += s[i] + s[i + 1];
+      i++;
+    } else if (c >= 0xD800 && c <= 0xDFFF) {
+      result += '\\u' + c.toString(16);
+    } else {
+      result += s[i];
+    }
+  }
+  return result + '"';
+}
+
+// Long strings with characters to escape at every position around the
+// boundaries of vector blocks.
+(function TestEscaping() {
+  const specials = ['"', '\\', '\n', '\x01', '\x1f', '\x7f', '\xff',
+                    '\u0100', '\ud800', '\udc00', '\ud83d\ude00'];
+  for (const base of ['a', '\xe9', '\u20ac']) {
+    for (const special of specials) {
+      for (let position = 0; position < 70; position++) {
+        const s = base.repeat(position) + special + base.repeat(70 - position);
+        assertEquals(quote(s), JSON.stringify(s));
+        assertEquals(`["x",${quote(s)}]`, JSON.stringify(['x', s]));
+      }
+    }
+  }
+})();
+
+// Arrays of objects with the same map reuse the escaped keys.
+(function TestSameMapObjects() {
+  const keys = ['a', 'needs "quotes"', 'line\nbreak', 'caf\xe9', '\x7f'];
+  const rows = [];
+  for (let i = 0; i < 10; i++) {
+    const row = {};
+    for (const key of keys) row[key] = i;
+    rows.push(row);
+  }
+  const row = '{' + keys.map(k => quote(k) + ':' + 0).join(',') + '}';
+  const json = JSON.stringify(rows);
+  assertEquals(row, JSON.stringify(rows[0]));
+  assertEquals(rows, JSON.parse(json));
+  assertEquals(json, JSON.stringify(JSON.parse(json)));
+})();
+
+// Values that are omitted, call into user code or change the object keep
+// their semantics.
+(function TestSpecialValues() {
+  function make(i) {
+    return {
+      n: i,
+      d: i + 0.5,
+      s: 'v' + i,
+      t: true,
+      f: false,
+      z: null,
+      u: undefined,
+      fn() {},
+      nested: {x: i},
+      date: new Date(0),
+      withToJSON: {toJSON() { return 'json' + i; }},
+      get getter() { return [i]; },
+    };
+  }
+  const expected =
+      '{"n":1,"d":1.5,"s":"v1","t":true,"f":false,"z":null,' +
+      '"nested":{"x":1},"date":"1970-01-01T00:00:00.000Z",' +
+      '"withToJSON":"json1","getter":[1]}';
+  const objects = [make(1), make(1), make(1)];
+  assertEquals(`[${expected},${expected},${expected}]`,
+               JSON.stringify(objects));
+
+  assertEquals(
+      '[\n  {\n    "a": 1,\n    "b": "x"\n  },\n  {\n    "a": 2,\n' +
+      '    "b": "x"\n  }\n]',
+      JSON.stringify([{a: 1, b: 'x'}, {a: 2, b: 'x'}], null, 2));
+  assertEquals('[{"a":2,"b":"x!"},{"a":4,"b":"x!"}]',
+               JSON.stringify([{a: 1, b: 'x'}, {a: 2, b: 'x'}],
+                              (k, v) => typeof v == 'number' ? v * 2 :
+                                  typeof v == 'string' ? v + '!' : v));
+
+  // A getter that changes the map of its holder.
+  const a = {x: 1, get y() { delete this.z; this.w = 4; return 2; }, z: 3};
+  const b = {x: 1, get y() { return 2; }, z: 3};
+  assertEquals('[{"x":1,"y":2},{"x":1,"y":2,"z":3}]', JSON.stringify([a, b]));
+})();
+
+// Two-byte keys are serialized as before.
+(function TestTwoByteKeys() {
+  const rows = [{'\u20ac': 1, '\ud800': 2}, {'\u20ac': 3, '\ud800': 4}];
+  assertEquals('[{"\u20ac":1,"\\ud800":2},{"\u20ac":3,"\\ud800":4}]',
+               JSON.stringify(rows));
+})();
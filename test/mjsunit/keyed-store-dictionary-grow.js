@@ -0,0 +1,82 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function store(object, key, value) {
+  object[key] = value;
+}
+
+function makeDictionary() {
+  const object = {a: 1, b: 2};
+  // Deleting a property other than the last one normalizes the object.
+  delete object.a;
+  delete object.b;
+  assertFalse(%HasFastProperties(object));
+  return object;
+}
+
+// Growing the properties dictionary keeps all properties and their order.
+(function TestGrow() {
+  const object = makeDictionary();
+  const keys = [];
+  for (let i = 0; i < 1000; ++i) {
+    const key = 'key' + i;
+    keys.push(key);
+    store(object, key, i);
+  }
+  assertFalse(%HasFastProperties(object));
+  assertEquals(keys, Object.keys(object));
+  for (let i = 0; i < 1000; ++i) assertEquals(i, object['key' + i]);
+})();
+
+// Deleted entries are dropped when the dictionary is rehashed, and properties
+// that are added back go to the end.
+(function TestRehashAfterDelete() {
+  const object = makeDictionary();
+  for (let i = 0; i < 200; ++i) store(object, 'key' + i, i);
+  for (let round = 0; round < 10; ++round) {
+    for (let i = 0; i < 150; ++i) delete object['key' + i];
+    for (let i = 0; i < 150; ++i) store(object, 'key' + i, round);
+  }
+  const keys = Object.keys(object);
+  assertEquals(200, keys.length);
+  assertEquals('key150', keys[0]);
+  assertEquals('key0', keys[50]);
+  assertEquals(9, object.key0);
+  assertEquals(199, object.key199);
+})();
+
+// The identity hash of the object survives growing its dictionary.
+(function TestIdentityHash() {
+  const object = makeDictionary();
+  const map = new Map([[object, 'value']]);
+  const weak_map = new WeakMap([[object, 'weak']]);
+  for (let i = 0; i < 100; ++i) store(object, 'key' + i, i);
+  assertEquals('value', map.get(object));
+  assertEquals('weak', weak_map.get(object));
+})();
+
+// Symbols and private symbols are added as well.
+(function TestSymbols() {
+  const object = makeDictionary();
+  const symbols = [];
+  for (let i = 0; i < 50; ++i) {
+    const symbol = Symbol('s' + i);
+    symbols.push(symbol);
+    store(object, symbol, i);
+  }
+  assertEquals(symbols, Object.getOwnPropertySymbols(object));
+  assertEquals(49, object[symbols[49]]);
+})();
+
+// Objects that are not extensible still throw or ignore the store.
+(function TestNonExtensible() {
+  const object = makeDictionary();
+  for (let i = 0; i < 10; ++i) store(object, 'key' + i, i);
+  Object.preventExtensions(object);
+  store(object, 'other', 1);
+  assertFalse('other' in object);
+  assertThrows(() => { 'use strict'; object['other'] = 1; }, TypeError);
+})();
@@ -0,0 +1,30 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+
+function f(x) {
+  "use strict"
+  return x + 1;
+}
+
+function g(x) {
+  "use strict"
+  return x + 2;
+}
+
+function foo(o, x) {
+  return o.callee(x);
+}
+
+%PrepareFunctionForOptimization(f);
+%PrepareFunctionForOptimization(g);
+%PrepareFunctionForOptimization(foo);
+assertEquals(2, foo({callee: f}, 1));
+assertEquals(2, foo({callee: f}, 1));
+
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(2, foo({callee: f}, 1));
+// The object has the same map, but the inlined call target is different.
+assertEquals(3, foo({callee: g}, 1));
@@ -0,0 +1,36 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+
+function sloppy() {
+  return this;
+}
+
+function strict() {
+  "use strict"
+  return this;
+}
+
+function foo_sloppy() {
+  return sloppy();
+}
+
+function foo_strict() {
+  return strict();
+}
+
+%PrepareFunctionForOptimization(sloppy);
+%PrepareFunctionForOptimization(strict);
+%PrepareFunctionForOptimization(foo_sloppy);
+%PrepareFunctionForOptimization(foo_strict);
+assertSame(globalThis, foo_sloppy());
+assertSame(undefined, foo_strict());
+assertSame(globalThis, foo_sloppy());
+assertSame(undefined, foo_strict());
+
+%OptimizeMaglevOnNextCall(foo_sloppy);
+%OptimizeMaglevOnNextCall(foo_strict);
+assertSame(globalThis, foo_sloppy());
+assertSame(undefined, foo_strict());
@@ -0,0 +1,30 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining --no-stress-opt
+
+function bar(x) {
+  %DeoptimizeFunction(foo);
+  return x + 1;
+}
+
+function inner(x) {
+  "use strict"
+  return bar(x) + 10;
+}
+
+function foo(x) {
+  return inner(x) + 100;
+}
+
+%PrepareFunctionForOptimization(bar);
+%PrepareFunctionForOptimization(inner);
+%PrepareFunctionForOptimization(foo);
+assertEquals(112, foo(1));
+assertEquals(112, foo(1));
+
+%OptimizeMaglevOnNextCall(foo);
+// The call to bar in the inlined inner function will lazy deopt, which has to
+// materialize the frames of both inner and foo.
+assertEquals(112, foo(1));
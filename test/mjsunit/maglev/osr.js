@@ -0,0 +1,30 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-osr --no-always-turbofan
+// Flags: --no-concurrent-osr
+
+function requestOsr() {
+  // A pending Maglev request makes Maglev the OSR target.
+  %OptimizeMaglevOnNextCall(f);
+  %OptimizeOsr(1);
+}
+
+function assertOptimizedFrame() {
+  assertTrue((%GetOptimizationStatus(f) &
+              V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0);
+}
+
+function f(n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    if (i == 5) requestOsr();
+    if (i == 10) assertOptimizedFrame();
+    sum += i;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(4950, f(100));
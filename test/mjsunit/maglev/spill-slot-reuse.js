@@ -0,0 +1,50 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-stress-opt
+
+// Values that are live across a call are spilled. Once a value is dead its
+// stack slot is reused, which must not clobber values that are still live.
+
+function id(x) {
+  return x;
+}
+
+function f(a, b) {
+  let x = a + 1;
+  let y = b + 2;
+  id(0);  // Spills x and y.
+  let s = x + y;
+  let z = a * 3;
+  id(0);  // Spills s and z, possibly reusing the slots of x and y.
+  let w = z - a;
+  id(0);
+  return s + z + w + y;
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(23, f(2, 3));
+assertEquals(23, f(2, 3));
+
+%OptimizeMaglevOnNextCall(f);
+assertEquals(23, f(2, 3));
+assertEquals(43, f(5, 4));
+assertTrue(isMaglevved(f));
+
+function g(a, b) {
+  let x = a + 0.5;
+  id(0);  // Spills the double x.
+  let y = x * 2;
+  id(0);
+  let z = b + 0.25;
+  id(0);
+  return y + z + x;
+}
+
+%PrepareFunctionForOptimization(g);
+assertEquals(10.75, g(2, 3));
+
+%OptimizeMaglevOnNextCall(g);
+assertEquals(10.75, g(2, 3));
+assertTrue(isMaglevved(g));
@@ -0,0 +1,25 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --precollect-source-positions
+
+// The source positions of the functions on the stack trace are collected in a
+// task before the stack is formatted, and must give the same result.
+
+function inner() {
+  return new Error('boom');
+}
+
+function outer() {
+  return inner();
+}
+
+const error = outer();
+setTimeout(() => {
+  const lines = error.stack.split('\n');
+  assertTrue(lines[1].includes('inner'));
+  assertTrue(lines[1].includes(':11:10'));
+  assertTrue(lines[2].includes('outer'));
+  assertTrue(lines[2].includes(':15:10'));
+}, 0);
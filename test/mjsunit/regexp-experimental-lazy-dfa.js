@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+// Flags: --experimental-regexp-engine-dfa-max-states=4
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+// Long enough for the DFA to be used.
+const padding = "x".repeat(100);
+
+Test(/abc/, padding, null, 0);
+Test(/abc/, padding + "abc" + padding, ["abc"], 0);
+Test(/(a)(b+)c/, padding + "abbc", ["abbc", "a", "bb"], 0);
+Test(/a|b/g, padding + "b" + padding, ["b"], 101);
+Test(new RegExp(""), padding, [""], 0);
+
+// Assertions, which depend on the characters around the current position.
+Test(/^x+$/, padding, [padding], 0);
+Test(/^y/, padding + "y", null, 0);
+Test(/y$/, "y" + padding, null, 0);
+Test(/^y/m, padding + "\ny", ["y"], 0);
+Test(/y$/m, "y\n" + padding, ["y"], 0);
+Test(/\by\b/, padding + "y", null, 0);
+Test(/\by\b/, padding + " y", ["y"], 0);
+Test(/\By/, " y" + padding, null, 0);
+
+// Two byte subjects.
+Test(/쁰d/, padding + "쁰d", ["쁰d"], 0);
+Test(/쁰d/, padding + "쁰", null, 0);
+
+// Patterns that need more states than the cache holds, so that it is
+// cleared, or the DFA gives up and the NFA finds the match.
+Test(/a[ab]{5}c/, ("ab".repeat(50) + "a").repeat(4) + "abbbbbc",
+     ["abbbbbc"], 0);
+Test(/a[ab]{5}c/, ("ab".repeat(50) + "a").repeat(4), null, 0);
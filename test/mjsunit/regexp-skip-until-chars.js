@@ -0,0 +1,51 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1
+
+// Regexps that start with characters at fixed offsets skip ahead to them.
+// Each regexp runs in the interpreter first and as native code after tier-up.
+
+function test(pattern, subject, expected) {
+  for (let i = 0; i < 3; i++) {
+    assertEquals(expected, subject.search(new RegExp(pattern)));
+  }
+  const re = new RegExp(pattern);
+  for (let i = 0; i < 3; i++) {
+    assertEquals(expected, subject.search(re));
+  }
+}
+
+const padding = "x".repeat(100);
+
+// Literal prefixes, which search for a pair of characters.
+test("abc", padding + "abc", 100);
+test("abc", padding + "ab", -1);
+test("abc", "abc" + padding, 0);
+test("ab", padding + "ab", 100);
+test("ab", padding + "a", -1);
+test("GET /api", padding + "GET /ap GET /api", 108);
+test("ab+c", padding + "abbbc", 100);
+
+// A single character at a fixed offset.
+test("...z", padding + "z", 97);
+test("...z", padding, -1);
+
+// Characters that are equal to the pattern's after masking.
+test("abc", padding + "\xe1\xe2\xe3" + "abc", 103);
+test("abc", padding + "šŢţ" + "abc", 103);
+
+// Two byte subjects.
+test("abc", "ሴ".repeat(100) + "abc", 100);
+test("ሴ噸", padding + "ሴ噸", 100);
+test("ሴ噸", padding + "ሴ", -1);
+
+// Global regexps continue the search after each match.
+const subject = (padding + "abc").repeat(3);
+for (let i = 0; i < 3; i++) {
+  const re = /abc/g;
+  assertEquals(["abc", "abc", "abc"], subject.match(re));
+  re.lastIndex = 101;
+  assertEquals(203, re.exec(subject).index);
+}
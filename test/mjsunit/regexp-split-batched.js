@@ -0,0 +1,45 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long subjects are split with batched matches. Sticky regexps take the spec
+// path, so the results must agree.
+
+function Check(re, subject, limit) {
+  const sticky = new RegExp(re.source, re.flags + "y");
+  const expected = subject.split(sticky, limit);
+  const expected_last_match = RegExp.lastMatch;
+  const expected_capture = RegExp.$1;
+  assertEquals(expected, subject.split(re, limit));
+  if (limit !== 0) {
+    assertEquals(expected_last_match, RegExp.lastMatch);
+    assertEquals(expected_capture, RegExp.$1);
+  }
+}
+
+const kRepeat = 100;
+const subjects = [
+  "a,b,,c;".repeat(kRepeat),
+  ",".repeat(300),
+  "abc".repeat(kRepeat) + "x",
+  "\u{1F600}x".repeat(kRepeat),
+  "é-Ā,".repeat(kRepeat),
+  "a".repeat(300) + ",",
+];
+const regexps = [
+  /,/, /,/g, /[,;]/, /(,)|(;)/, /(?:)/, /(?:)/u, /,*/, /,*/g, /x?/u,
+  /(b)?,/, /a/, /Ā/, /-|,/,
+];
+
+for (const subject of subjects) {
+  for (const re of regexps) {
+    for (const limit of [undefined, 0, 1, 2, 7, 100, 1000]) {
+      Check(re, subject, limit);
+    }
+  }
+}
+
+// A trailing separator leaves an empty suffix, a match at the very end does
+// not.
+assertEquals(["a".repeat(300), ""], ("a".repeat(300) + ",").split(/,/));
+assertEquals(301, ("a".repeat(300) + "b").split(/(?:)/).length);
@@ -0,0 +1,38 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long comments, string literals and template literals are scanned in blocks.
+// Put the interesting characters at every offset within and across blocks,
+// and of the buffered input.
+for (let length = 0; length < 1100; length += 37) {
+  const plain = 'x'.repeat(length);
+
+  assertEquals(plain, eval(`"${plain}"`));
+  assertEquals(plain + "'", eval(`"${plain}'"`));
+  assertEquals(plain + '"' + plain, eval(`'${plain}"${plain}'`));
+  assertEquals(plain + '\n' + plain, eval(`"${plain}\\n${plain}"`));
+  assertEquals(plain + 'é' + plain, eval(`"${plain}é${plain}"`));
+  assertEquals(plain + ' ' + plain, eval(`"${plain} ${plain}"`));
+  assertThrows(() => eval(`"${plain}\n"`), SyntaxError);
+  assertThrows(() => eval(`"${plain}`), SyntaxError);
+
+  assertEquals(plain, eval('`' + plain + '`'));
+  assertEquals(plain + '1' + plain, eval('`' + plain + '${1}' + plain + '`'));
+  assertEquals(plain + '$' + plain, eval('`' + plain + '$' + plain + '`'));
+  assertEquals(plain + '\n' + plain, eval('`' + plain + '\r\n' + plain + '`'));
+  assertEquals(plain + '☃' + plain, eval('`' + plain + '☃' + plain + '`'));
+  assertEquals(plain + '\\r' + plain,
+               eval('String.raw`' + plain + '\\r' + plain + '`'));
+
+  assertEquals(1, eval(`// ${plain}\n1`));
+  assertEquals(2, eval(`// ${plain}  2`));
+  assertEquals(3, eval(`/* ${plain} * / ${plain} **/ 3`));
+  assertEquals(4, eval(`/* ${plain}\n${plain}é */ 4`));
+  assertThrows(() => eval(`/* ${plain}`), SyntaxError);
+}
+
+// A multi-line comment contains a line terminator, so it completes a return
+// statement.
+assertEquals(undefined, eval(`(function() { return /* ${'y'.repeat(100)}
+    */ 5; })()`));
@@ -0,0 +1,42 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct --allow-natives-syntax
+
+"use strict";
+
+let S = new SharedStructType(['field']);
+
+(function TestOptimizedConstantStores() {
+  // Smi and Oddball constants are trivially shared and are stored without a
+  // call to the IC.
+  function store(s) {
+    s.field = 42;
+    s.field = undefined;
+    s.field = true;
+    s.field = 7;
+  }
+  %PrepareFunctionForOptimization(store);
+  let s = new S();
+  store(s);
+  store(s);
+  %OptimizeFunctionOnNextCall(store);
+  store(s);
+  assertEquals(7, s.field);
+})();
+
+(function TestOptimizedNonConstantStores() {
+  // Other values still go through the shared value barrier.
+  function store(s, v) {
+    s.field = v;
+  }
+  %PrepareFunctionForOptimization(store);
+  let s = new S();
+  store(s, 1);
+  store(s, 'foo');
+  %OptimizeFunctionOnNextCall(store);
+  store(s, 1.5);
+  assertEquals(1.5, s.field);
+  assertThrows(() => store(s, {}));
+})();
@@ -0,0 +1,94 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --lazy-call-site-infos --error-stack-dedup-window=100000
+
+function validate(value) {
+  if (typeof value !== 'number') return new TypeError('not a number');
+  return null;
+}
+
+function check(value) {
+  return validate(value);
+}
+
+// Errors from the same place share their raw frames, but still get their own
+// stack, and the stack is formatted the same way as without the flag.
+(function TestIdenticalStacks() {
+  const errors = [];
+  for (let i = 0; i < 3; ++i) errors.push(check('x'));
+  const stack = errors[0].stack;
+  assertTrue(stack.startsWith('TypeError: not a number\n'));
+  assertTrue(stack.includes('at validate'));
+  assertTrue(stack.includes('at check'));
+  assertTrue(stack.includes('at TestIdenticalStacks'));
+  for (const error of errors) assertEquals(stack, error.stack);
+})();
+
+// Stacks that differ only in a receiver are not shared.
+(function TestDifferentReceivers() {
+  function Validator(name) { this.name = name; }
+  Validator.prototype.fail = function() { return new Error(this.name); };
+  const oldPrepareStackTrace = Error.prepareStackTrace;
+  Error.prepareStackTrace = (error, frames) => frames;
+  try {
+    const a = new Validator('a');
+    const b = new Validator('b');
+    assertSame(a, a.fail().stack[0].getThis());
+    assertSame(b, b.fail().stack[0].getThis());
+  } finally {
+    Error.prepareStackTrace = oldPrepareStackTrace;
+  }
+})();
+
+// Error.captureStackTrace and structured frames resolve positions on demand.
+(function TestCaptureStackTrace() {
+  const object = {};
+  Error.captureStackTrace(object);
+  const oldPrepareStackTrace = Error.prepareStackTrace;
+  Error.prepareStackTrace = (error, frames) => frames;
+  try {
+    const frames = new Error().stack;
+    assertEquals('TestCaptureStackTrace', frames[0].getFunctionName());
+    assertTrue(frames[0].getLineNumber() > 0);
+    assertTrue(frames[0].getColumnNumber() > 0);
+  } finally {
+    Error.prepareStackTrace = oldPrepareStackTrace;
+  }
+  assertTrue(object.stack.includes('at TestCaptureStackTrace'));
+})();
+
+// Setting .stack before reading it drops the raw frames.
+(function TestSetStack() {
+  const error = check('x');
+  error.stack = 'custom';
+  assertEquals('custom', error.stack);
+})();
+
+// Async frames are part of the raw frames.
+(function TestAsyncFrames() {
+  async function inner() {
+    await 1;
+    throw new Error('async');
+  }
+  async function outer() {
+    await inner();
+  }
+  let stack;
+  outer().catch(e => stack = e.stack);
+  %PerformMicrotaskCheckpoint();
+  assertTrue(stack.includes('at inner'));
+  assertTrue(stack.includes('at async outer'));
+})();
+
+// An empty stack stays empty.
+(function TestNoFrames() {
+  const oldLimit = Error.stackTraceLimit;
+  Error.stackTraceLimit = 0;
+  try {
+    assertEquals('Error: none', new Error('none').stack);
+  } finally {
+    Error.stackTraceLimit = oldLimit;
+  }
+})();
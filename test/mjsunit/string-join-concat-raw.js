@@ -0,0 +1,48 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+(function TestConcat() {
+  assertEquals("abc", "a".concat("b", "c"));
+  assertEquals("a1nullundefined", "a".concat(1, null, undefined));
+  assertEquals("a", "a".concat("", ""));
+  assertEquals("", "".concat("", "", ""));
+  assertEquals("a☃b", "a".concat("☃", "b"));
+  assertEquals("☃ab", "☃".concat("a", "b"));
+  var log = [];
+  var logged = (s) => ({toString() { log.push(s); return s; }});
+  assertEquals("xyz", "x".concat(logged("y"), logged("z")));
+  assertEquals(["y", "z"], log);
+  assertThrows(() => "x".concat("y", {toString() { throw 42; }}));
+
+  // Results long enough to be built as ropes.
+  var long = "0123456789".repeat(200);
+  assertEquals(long + "a" + long, long.concat("a", long));
+  var s = "";
+  for (var i = 0; i < 100; i++) s = s.concat("ab", "☃");
+  assertEquals("ab☃".repeat(100), s);
+})();
+
+(function TestRaw() {
+  assertEquals("a1b2c", String.raw`a${1}b${2}c`);
+  assertEquals("\\n☃", String.raw`\n${"☃"}`);
+  assertEquals("", String.raw({raw: []}));
+  assertEquals("", String.raw({raw: ["", ""]}, ""));
+  assertEquals("ab", String.raw({raw: ["a", "b"]}));
+  assertEquals("a-b", String.raw({raw: ["a", "b"]}, "-", "ignored"));
+  assertEquals("a,b", String.raw({raw: {length: 2, 0: "a", 1: "b"}}, ","));
+  var parts = [];
+  for (var i = 0; i < 100; i++) parts.push("part" + i);
+  assertEquals(parts.join("|"),
+               String.raw({raw: parts}, ...new Array(99).fill("|")));
+})();
+
+(function TestJoinRepeatedSeparators() {
+  var sparse = [1, , , , , 2];
+  assertEquals("1, , , , , 2", sparse.join(", "));
+  assertEquals("1☃☃☃☃☃2", sparse.join("☃"));
+  assertEquals("1abcabcabcabcabc2", sparse.join("abc"));
+  var holes = new Array(100);
+  holes[50] = "x";
+  assertEquals("--".repeat(50) + "x" + "--".repeat(49), holes.join("--"));
+})();
@@ -0,0 +1,85 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function MakeRope(parts) {
+  let rope = '';
+  for (const part of parts) rope += part;
+  return rope;
+}
+
+function Flat(s) {
+  return s.split('').join('');
+}
+
+(function TestCharCodeAt() {
+  const parts = [];
+  for (let i = 0; i < 64; i++) parts.push('segment' + i + '-');
+  const rope = MakeRope(parts);
+  const flat = Flat(rope);
+  for (let i = 0; i < flat.length; i += 7) {
+    assertEquals(flat.charCodeAt(i), rope.charCodeAt(i));
+  }
+  assertTrue(isNaN(rope.charCodeAt(rope.length)));
+})();
+
+(function TestIndexOfAcrossSegments() {
+  const parts = [];
+  for (let i = 0; i < 40; i++) parts.push('abcdefghij'.repeat(3) + i);
+  parts.push('xy', 'z', 'needle', 'tail');
+  // Each search builds a fresh rope, so that it is not flattened.
+  function rope() { return MakeRope(parts); }
+  const flat = Flat(rope());
+  for (const pattern of ['xyzneedle', 'yzn', 'z', 'needletail', 'j39xy',
+                         'ij1abc', 'missing', 'tail', 'abcdefghija']) {
+    assertEquals(flat.indexOf(pattern), rope().indexOf(pattern), pattern);
+    assertEquals(flat.includes(pattern), rope().includes(pattern), pattern);
+    for (const start of [0, 1, 100, 500, flat.length - 12]) {
+      assertEquals(flat.indexOf(pattern, start), rope().indexOf(pattern, start),
+                   pattern + ' from ' + start);
+    }
+  }
+})();
+
+(function TestIndexOfTwoByte() {
+  const parts = [];
+  for (let i = 0; i < 20; i++) parts.push('☃snow' + i, 'man');
+  const rope = () => MakeRope(parts);
+  const flat = Flat(rope());
+  assertEquals(flat.indexOf('☃snow19man'), rope().indexOf('☃snow19man'));
+  assertEquals(flat.indexOf('7man☃'), rope().indexOf('7man☃'));
+  assertEquals(flat.indexOf('man', 40), rope().indexOf('man', 40));
+  assertEquals(-1, rope().indexOf('☄'));
+})();
+
+(function TestRepeatedAccess() {
+  const parts = [];
+  for (let i = 0; i < 100; i++) parts.push('part' + i);
+  const rope = MakeRope(parts);
+  const flat = Flat(rope);
+  for (let i = 0; i < 10; i++) {
+    const pattern = 'part' + (i * 9);
+    assertEquals(flat.indexOf(pattern), rope.indexOf(pattern));
+    assertEquals(flat.charCodeAt(i * 13), rope.charCodeAt(i * 13));
+  }
+})();
+
+(function TestSubstring() {
+  const parts = [];
+  for (let i = 0; i < 50; i++) parts.push('0123456789'.repeat(2) + '|' + i);
+  const rope = () => MakeRope(parts);
+  const flat = Flat(rope());
+  const ranges = [[0, 5], [3, 40], [10, flat.length], [flat.length - 30],
+                  [200, 201], [200, 202], [450, 900], [0, flat.length - 1]];
+  for (const [begin, end] of ranges) {
+    assertEquals(flat.substring(begin, end), rope().substring(begin, end));
+    assertEquals(flat.slice(begin, end), rope().slice(begin, end));
+  }
+  // Slicing off one end of a concatenation.
+  const head = 'head'.repeat(10);
+  const tail = 'tail'.repeat(10);
+  assertEquals(head, (head + tail).substring(0, head.length));
+  assertEquals(tail, (head + tail).substring(head.length));
+  assertEquals('ailtail',
+               (head + tail).substring(head.length + 1, head.length + 8));
+})();
@@ -0,0 +1,59 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function naiveIndexOf(subject, pattern, start) {
+  outer: for (let i = start; i + pattern.length <= subject.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[i + j] != pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+// Patterns whose first and last characters occur often in the subject, at
+// positions around the boundaries of vector blocks.
+(function TestIndexOf() {
+  for (const filler of ['ab', 'aĀ']) {
+    const base = filler.repeat(100);
+    for (let length = 1; length <= 20; length++) {
+      const pattern = 'a' + 'x'.repeat(Math.max(0, length - 2)) +
+          (length > 1 ? 'b' : '');
+      for (let position = 0; position < 70; position++) {
+        const subject = base.substring(0, position) + pattern +
+            base.substring(position);
+        for (const start of [0, 1, position, position + 1]) {
+          assertEquals(naiveIndexOf(subject, pattern, start),
+                       subject.indexOf(pattern, start));
+        }
+        assertTrue(subject.includes(pattern));
+        assertFalse(base.includes(pattern + '!'));
+      }
+    }
+  }
+})();
+
+// Patterns that can only occur in two-byte subjects.
+(function TestTwoBytePatterns() {
+  const subject = 'abc'.repeat(50) + 'Āā' + 'abc'.repeat(50);
+  assertEquals(150, subject.indexOf('Ā'));
+  assertEquals(150, subject.indexOf('Āā'));
+  assertEquals(149, subject.indexOf('cĀāa'));
+  assertEquals(-1, subject.indexOf('āĀ'));
+  assertEquals(-1, 'abc'.repeat(100).indexOf('aĀ'));
+  assertEquals(-1, ('Ā' + 'a'.repeat(100)).indexOf('\0'));
+  assertEquals(50, ('Ā'.repeat(50) + '\0').indexOf('\0'));
+})();
+
+(function TestSplit() {
+  const line = 'key=value;'.repeat(1000) + 'last';
+  const parts = line.split(';');
+  assertEquals(1001, parts.length);
+  assertEquals('key=value', parts[0]);
+  assertEquals('last', parts[1000]);
+  const wide = line.replace(/value/g, 'v€');
+  assertEquals(Array(1000).fill('key=v€').concat('last'),
+               wide.split(';'));
+  assertEquals(1001, wide.split('€;').length);
+})();
@@ -0,0 +1,73 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+
+function load_twice(o) {
+  return o.a + o.a;
+}
+
+%PrepareFunctionForOptimization(load_twice);
+assertEquals(4, load_twice({a: 2}));
+%OptimizeFunctionOnNextCall(load_twice);
+assertEquals(4, load_twice({a: 2}));
+assertEquals(10, load_twice({a: 5}));
+
+function store_then_load(o, x) {
+  o.a = x;
+  o.b = x + 1;
+  return o.a + o.b;
+}
+
+%PrepareFunctionForOptimization(store_then_load);
+assertEquals(5, store_then_load({a: 0, b: 0}, 2));
+%OptimizeFunctionOnNextCall(store_then_load);
+assertEquals(5, store_then_load({a: 0, b: 0}, 2));
+assertEquals(9, store_then_load({a: 0, b: 0}, 4));
+
+// A store to the same field of a possibly aliasing object must invalidate the
+// known value.
+function aliasing_store(o, p) {
+  let before = o.a;
+  p.a = 7;
+  return before + o.a;
+}
+
+%PrepareFunctionForOptimization(aliasing_store);
+let object = {a: 1};
+assertEquals(2, aliasing_store({a: 1}, {a: 1}));
+assertEquals(8, aliasing_store(object, object));
+%OptimizeFunctionOnNextCall(aliasing_store);
+assertEquals(2, aliasing_store({a: 1}, {a: 1}));
+object = {a: 1};
+assertEquals(8, aliasing_store(object, object));
+
+// Knowledge must not flow from one branch into the merge.
+function branches(o, c) {
+  let x = o.a;
+  if (c) o.a = x + 1;
+  return o.a;
+}
+
+%PrepareFunctionForOptimization(branches);
+assertEquals(1, branches({a: 1}, false));
+assertEquals(2, branches({a: 1}, true));
+%OptimizeFunctionOnNextCall(branches);
+assertEquals(1, branches({a: 1}, false));
+assertEquals(2, branches({a: 1}, true));
+
+// Values computed in a loop must not be reused across iterations.
+function loop(o, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += o.a * 2;
+    o.a = o.a + 1;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(loop);
+assertEquals(12, loop({a: 1}, 3));
+%OptimizeFunctionOnNextCall(loop);
+assertEquals(12, loop({a: 1}, 3));
@@ -0,0 +1,47 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --icu-timezone-data --date-cache-min-year=2020
+// Flags: --date-cache-max-year=2021
+// Environment Variables: TZ=America/New_York
+
+// Times inside and outside of the years covered by the transition table of
+// the date cache get the same offsets.
+
+// 2021-03-14T02:00 : UTC-5 => UTC-4
+assertEquals(new Date(Date.UTC(2021, 2, 14, 6, 59)),
+   new Date(2021, 2, 14, 1, 59));
+assertEquals(new Date(Date.UTC(2021, 2, 14, 7, 30)),
+   new Date(2021, 2, 14, 2, 30));
+assertEquals(new Date(Date.UTC(2021, 2, 14, 7)),
+   new Date(2021, 2, 14, 3));
+assertEquals(300, new Date(Date.UTC(2021, 2, 14, 6, 59, 59, 999))
+   .getTimezoneOffset());
+assertEquals(240, new Date(Date.UTC(2021, 2, 14, 7)).getTimezoneOffset());
+
+// 2021-11-07T02:00 : UTC-4 => UTC-5
+assertEquals(new Date(Date.UTC(2021, 10, 7, 4, 59)),
+   new Date(2021, 10, 7, 0, 59));
+assertEquals(new Date(Date.UTC(2021, 10, 7, 5, 30)),
+   new Date(2021, 10, 7, 1, 30));
+assertEquals(new Date(Date.UTC(2021, 10, 7, 7)),
+   new Date(2021, 10, 7, 2));
+assertEquals(240, new Date(Date.UTC(2021, 10, 7, 5, 59, 59, 999))
+   .getTimezoneOffset());
+assertEquals(300, new Date(Date.UTC(2021, 10, 7, 6)).getTimezoneOffset());
+
+// Around the start and the end of the covered years.
+assertEquals(new Date(Date.UTC(2020, 0, 1, 5)), new Date(2020, 0, 1));
+assertEquals(new Date(Date.UTC(2020, 0, 2, 5)), new Date(2020, 0, 2));
+assertEquals(new Date(Date.UTC(2021, 0, 1, 5)), new Date(2021, 0, 1));
+assertEquals(new Date(Date.UTC(2021, 11, 31, 5)), new Date(2021, 11, 31));
+assertEquals(new Date(Date.UTC(2022, 0, 1, 5)), new Date(2022, 0, 1));
+assertEquals(300, new Date(Date.UTC(2021, 11, 31, 23)).getTimezoneOffset());
+assertEquals(300, new Date(Date.UTC(2022, 0, 1, 1)).getTimezoneOffset());
+
+// Outside of the covered years.
+assertEquals(240, new Date(2019, 6, 1).getTimezoneOffset());
+assertEquals(240, new Date(2022, 6, 1).getTimezoneOffset());
+assertEquals(new Date(Date.UTC(2022, 2, 13, 7, 30)),
+   new Date(2022, 2, 13, 2, 30));
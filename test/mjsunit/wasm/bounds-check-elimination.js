@@ -0,0 +1,120 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-wasm-trap-handler
+
+// TurboFan omits explicit bounds checks which are implied by a dominating
+// check or by the computation of the index. Traps still happen at the right
+// access.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function instantiate(builder) {
+  const instance = builder.instantiate();
+  for (let i = 0; i < builder.functions.length; ++i) {
+    %WasmTierUpFunction(instance, i);
+  }
+  return instance;
+}
+
+function storeSequence(offsets) {
+  const body = [];
+  for (const offset of offsets) {
+    body.push(kExprLocalGet, 0, kExprLocalGet, 1,
+              kExprI32StoreMem, 2, offset);
+  }
+  return body;
+}
+
+(function testDescendingOffsets() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('store', kSig_v_ii)
+      .addBody(storeSequence([8, 4, 0]))
+      .exportFunc();
+  const instance = instantiate(builder);
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  instance.exports.store(kPageSize - 12, 17);
+  assertEquals([17, 17, 17], Array.from(memory.slice(-3)));
+  // The first store is out of bounds, so nothing gets written.
+  assertTraps(
+      kTrapMemOutOfBounds, () => instance.exports.store(kPageSize - 8, 3));
+  assertEquals([17, 17, 17], Array.from(memory.slice(-3)));
+})();
+
+(function testAscendingOffsets() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('store', kSig_v_ii)
+      .addBody(storeSequence([0, 4, 8]))
+      .exportFunc();
+  const instance = instantiate(builder);
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  // Only the last store is out of bounds; the first two happen.
+  assertTraps(
+      kTrapMemOutOfBounds, () => instance.exports.store(kPageSize - 8, 5));
+  assertEquals([5, 5], Array.from(memory.slice(-2)));
+})();
+
+(function testCheckInBranchDoesNotDominate() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.addFunction('load', kSig_i_ii)
+      .addBody([
+        kExprLocalGet, 1,
+        kExprIf, kWasmVoid,
+          kExprLocalGet, 0, kExprI32LoadMem, 2, 8, kExprDrop,
+        kExprEnd,
+        kExprLocalGet, 0, kExprI32LoadMem, 2, 4
+      ])
+      .exportFunc();
+  const instance = instantiate(builder);
+  assertEquals(0, instance.exports.load(kPageSize - 12, 1));
+  assertEquals(0, instance.exports.load(kPageSize - 8, 0));
+  assertTraps(
+      kTrapMemOutOfBounds, () => instance.exports.load(kPageSize - 7, 0));
+  assertTraps(
+      kTrapMemOutOfBounds, () => instance.exports.load(kPageSize - 8, 1));
+})();
+
+(function testBoundedIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('load_masked', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, ...wasmSignedLeb(0xfff), kExprI32And,
+        kExprI32LoadMem, 2, 0
+      ])
+      .exportFunc();
+  builder.addFunction('load_shifted', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, 16, kExprI32ShrU,
+        kExprI32LoadMem8U, 0, 0
+      ])
+      .exportFunc();
+  // The mask does not keep a four byte access in bounds.
+  builder.addFunction('load_masked_oob', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, ...wasmSignedLeb(0xffff),
+        kExprI32And, kExprI32LoadMem, 0, 0
+      ])
+      .exportFunc();
+  const instance = instantiate(builder);
+  const bytes = new Uint8Array(instance.exports.memory.buffer);
+  bytes[0xffc] = 42;
+  bytes[0xffff] = 7;
+  assertEquals(42, instance.exports.load_masked(0xffc));
+  assertEquals(42, instance.exports.load_masked(-4));
+  assertEquals(7, instance.exports.load_shifted(-1));
+  assertEquals(0, instance.exports.load_shifted(0xffff));
+  assertEquals(7, instance.exports.load_masked_oob(0xffff - 3) >>> 24);
+  assertTraps(kTrapMemOutOfBounds, () => instance.exports.load_masked_oob(-1));
+})();
@@ -0,0 +1,52 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-flush-code-on-memory-pressure
+// Flags: --liftoff --wasm-dynamic-tiering
+
+// Critical memory pressure drops the TurboFan code of wasm functions. They
+// get recompiled with Liftoff on their next call and can tier up again.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function processInterrupts() {
+  // The code GC runs on the next stack check.
+  for (let i = 0; i < 10; ++i) {}
+}
+
+(function testFlushAndReTier() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('add', kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add])
+      .exportFunc();
+  builder.addFunction('sub', kSig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Sub])
+      .exportFunc();
+  const instance = builder.instantiate();
+  const {add, sub} = instance.exports;
+  assertEquals(3, add(1, 2));
+  assertEquals(-1, sub(1, 2));
+  %WasmTierUpFunction(instance, 0);
+  assertTrue(%IsTurboFanFunction(add));
+  assertEquals(3, add(1, 2));
+  processInterrupts();
+  const liveCodeSizeBefore = %WasmLiveCodeSize(instance);
+
+  %NotifyCriticalMemoryPressure();
+  processInterrupts();
+  // The TurboFan code is gone, Liftoff code which was not tiered up stays.
+  assertFalse(%IsTurboFanFunction(add));
+  assertFalse(%IsLiftoffFunction(add));
+  assertTrue(%IsLiftoffFunction(sub));
+  assertTrue(%WasmLiveCodeSize(instance) < liveCodeSizeBefore);
+
+  // The next call compiles the function lazily.
+  assertEquals(7, add(3, 4));
+  assertTrue(%IsLiftoffFunction(add));
+  %WasmTierUpFunction(instance, 0);
+  assertTrue(%IsTurboFanFunction(add));
+  assertEquals(7, add(3, 4));
+  assertEquals(-1, sub(1, 2));
+})();
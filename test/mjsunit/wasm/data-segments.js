@@ -61,3 +61,42 @@ function GlobalImportedInitTest(pad) {
 GlobalImportedInitTest(0);
 GlobalImportedInitTest(1);
 GlobalImportedInitTest(4);
+
+function ZeroPagesTest(memory) {
+  print("ZeroPagesTest(" + (memory ? "imported" : "own") + " memory)...");
+  var builder = new WasmModuleBuilder();
+  if (memory) {
+    builder.addImportedMemory("mod", "memory", 4, 4);
+  } else {
+    builder.addMemory(4, 4);
+    builder.exportMemoryAs("memory");
+  }
+  // Mostly zeros, with non-zero bytes right around the page boundaries.
+  var data = new Array(3 * kPageSize).fill(0);
+  data[0] = 1;
+  data[kPageSize - 1] = 2;
+  data[2 * kPageSize] = 3;
+  data[data.length - 1] = 4;
+  builder.addDataSegment(100, data);
+  // Zeros overwrite parts of the previous segment.
+  builder.addDataSegment(100 + kPageSize - 4, [0, 0, 0, 0]);
+  builder.addDataSegment(100 + 2 * kPageSize, [0]);
+
+  var buffer = builder.toBuffer(debug);
+  var instance = new WebAssembly.Instance(
+      new WebAssembly.Module(buffer), {mod: {memory: memory}});
+  var bytes = new Uint8Array(instance.exports.memory ?
+      instance.exports.memory.buffer : memory.buffer);
+  for (var i = 0; i < bytes.length; ++i) {
+    var expected = 0;
+    if (i == 100) expected = 1;
+    if (i == 100 + data.length - 1) expected = 4;
+    if (memory && (i < 100 || i >= 100 + data.length)) expected = 0xff;
+    if (bytes[i] != expected) assertEquals(expected, bytes[i], "at " + i);
+  }
+}
+
+ZeroPagesTest(undefined);
+var memory = new WebAssembly.Memory({initial: 4, maximum: 4});
+new Uint8Array(memory.buffer).fill(0xff);
+ZeroPagesTest(memory);
@@ -403,3 +403,70 @@ d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
   let instance = builder.instantiate();
   assertEquals(10, instance.exports.main(10));
 })();
+
+(function EscapeAnalysisWithMutableFieldsAcrossCalls() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI32, true),
+                                  makeField(kWasmI32, true)]);
+
+  let nop = builder.addFunction("nop", kSig_v_v).addBody([]);
+
+  // The struct does not escape, so the calls cannot change its fields. TF
+  // should forward the stored values, fold the null checks of the nullable
+  // local and eliminate the allocation.
+  builder.addFunction("main", kSig_i_ii)
+    .addLocals(wasmOptRefType(struct), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprRttCanon, struct,
+      kGCPrefix, kExprStructNewWithRtt, struct,
+      kExprLocalSet, 2,
+      kExprCallFunction, nop.index,
+      kExprLocalGet, 2,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprStructGet, struct, 1,
+      kGCPrefix, kExprStructSet, struct, 0,
+      kExprCallFunction, nop.index,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprStructGet, struct, 0,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprStructGet, struct, 1,
+      kExprI32Mul])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(49, instance.exports.main(3, 7));
+  assertEquals(4, instance.exports.main(5, -2));
+})();
+
+(function EscapeAnalysisWithPackedFields() {
+  print(arguments.callee.name);
+
+  let builder = new WasmModuleBuilder();
+  let struct = builder.addStruct([makeField(kWasmI8, true),
+                                  makeField(kWasmI16, false)]);
+
+  // Packed fields are truncated on store, so loads must not be replaced by
+  // the stored values.
+  builder.addFunction("main", kSig_i_i)
+    .addLocals(wasmOptRefType(struct), 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 0,
+      kGCPrefix, kExprRttCanon, struct,
+      kGCPrefix, kExprStructNewWithRtt, struct,
+      kExprLocalSet, 1,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGetS, struct, 0,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprStructGetU, struct, 1,
+      kExprI32Add])
+    .exportFunc();
+
+  let instance = builder.instantiate({});
+  assertEquals(-1 + 0xffff, instance.exports.main(-1));
+  assertEquals(-1 + 0x1ff, instance.exports.main(0x1ff));
+})();
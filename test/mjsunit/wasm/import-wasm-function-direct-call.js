@@ -0,0 +1,68 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Imported Wasm functions with a matching signature are called directly,
+// without wrappers. The callee runs on its own instance, and sees tier-up of
+// the exporting module.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function instantiateExporter(value) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  const global =
+      builder.addGlobal(kWasmI32, true, WasmInitExpr.I32Const(value));
+  builder.addFunction('load', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, kExprI32LoadMem, 2, 0,
+        kExprGlobalGet, global.index, kExprI32Add
+      ])
+      .exportFunc();
+  return builder.instantiate();
+}
+
+function instantiateImporter(imports) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  const load = builder.addImport('m', 'load', kSig_i_i);
+  builder.addExport('reexported', load);
+  builder.addFunction('call', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, load])
+      .exportFunc();
+  return builder.instantiate({m: imports});
+}
+
+(function testCalleeUsesOwnInstance() {
+  print(arguments.callee.name);
+  const exporter = instantiateExporter(100);
+  new Int32Array(exporter.exports.memory.buffer)[1] = 11;
+  const importer = instantiateImporter({load: exporter.exports.load});
+  assertEquals(111, importer.exports.call(4));
+  // Re-exporting keeps the identity of the imported function.
+  assertSame(exporter.exports.load, importer.exports.reexported);
+  assertTraps(kTrapMemOutOfBounds, () => importer.exports.call(kPageSize));
+})();
+
+(function testChainOfImports() {
+  print(arguments.callee.name);
+  const exporter = instantiateExporter(7);
+  const middle = instantiateImporter({load: exporter.exports.load});
+  const last = instantiateImporter({load: middle.exports.reexported});
+  assertEquals(7, last.exports.call(0));
+  const other = instantiateImporter({load: middle.exports.call});
+  assertEquals(7, other.exports.call(0));
+})();
+
+(function testTierUpOfCallee() {
+  print(arguments.callee.name);
+  const exporter = instantiateExporter(3);
+  const importer = instantiateImporter({load: exporter.exports.load});
+  assertEquals(3, importer.exports.call(0));
+  %WasmTierUpFunction(exporter, 0);
+  assertTrue(%IsTurboFanFunction(exporter.exports.load));
+  assertEquals(3, importer.exports.call(0));
+})();
@@ -0,0 +1,125 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+
+// Locals stay in registers across loop back-edges, and the cached instance
+// and memory start stay in registers across merges.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testSwapLocalsInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Swapping two locals in every iteration creates a register cycle on the
+  // back-edge.
+  builder.addFunction('fib', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprI32Const, 1, kExprLocalSet, 2,  // b = 1
+        kExprBlock, kWasmVoid,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 0, kExprI32Eqz, kExprBrIf, 1,
+            kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add,
+            kExprLocalGet, 2, kExprLocalSet, 1,  // a = b
+            kExprLocalSet, 2,                    // b = a + b
+            kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalSet, 0,
+            kExprBr, 0,
+          kExprEnd,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.fib));
+  assertEquals(0, instance.exports.fib(0));
+  assertEquals(1, instance.exports.fib(1));
+  assertEquals(55, instance.exports.fib(10));
+  assertEquals(6765, instance.exports.fib(20));
+})();
+
+(function testSharedRegisterBeforeLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Local 1 starts in the same register as local 0, but only local 1 gets
+  // modified in the loop.
+  builder.addFunction('sum5', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalSet, 1,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 2, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 2,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32Const, 5, kExprI32Add, kExprI32Ne,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprLocalGet, 0, kExprI32Add
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  for (let x of [0, 3, 100, -7]) {
+    assertEquals(6 * x + 10, instance.exports.sum5(x));
+  }
+})();
+
+(function testI64LocalInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('sum', makeSig([kWasmI32], [kWasmI64]))
+      .addLocals(kWasmI64, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 0, kExprI64UConvertI32, kExprI64Add,
+          kExprLocalSet, 1,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(1n, instance.exports.sum(1));
+  assertEquals(5050n, instance.exports.sum(100));
+})();
+
+(function testMemoryAndCallsInLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  const double = builder.addFunction('double', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprLocalGet, 0, kExprI32Add
+  ]);
+  // Odd elements are loaded directly, even elements are passed through a
+  // call, which spills all registers in one arm of the if.
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32And,
+          kExprIf, kWasmVoid,
+            kExprLocalGet, 2,
+            kExprLocalGet, 1, kExprI32Const, 2, kExprI32Shl,
+            kExprI32LoadMem, 2, 0, kExprI32Add, kExprLocalSet, 2,
+          kExprElse,
+            kExprLocalGet, 2,
+            kExprLocalGet, 1, kExprI32Const, 2, kExprI32Shl,
+            kExprI32LoadMem, 2, 0, kExprCallFunction, double.index,
+            kExprI32Add, kExprLocalSet, 2,
+          kExprEnd,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtU, kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 16; ++i) memory[i] = i + 1;
+  for (let n of [1, 2, 10, 16]) {
+    let expected = 0;
+    for (let i = 0; i < n; ++i) expected += (i & 1) ? i + 1 : 2 * (i + 1);
+    assertEquals(expected, instance.exports.sum(n));
+  }
+})();
@@ -42,6 +42,10 @@ function BasicMemory64Tests(num_pages) {
 
   assertEquals(0, load(num_bytes - 4));
   assertThrows(() => load(num_bytes - 3));
+  // The upper half of the index is checked as well.
+  assertThrows(() => load(2 ** 32));
+  assertThrows(() => load(2 ** 32 + 4));
+  assertThrows(() => load(2 ** 48));
 
   store(num_bytes - 4, 0x12345678);
   assertEquals(0x12345678, load(num_bytes - 4));
@@ -0,0 +1,97 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-revectorize
+
+// Pairs of adjacent 128-bit loads, operations and stores get combined into
+// 256-bit ones where the hardware supports it. Accesses which might alias stay
+// in program order.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function simd(op) {
+  return [kSimdPrefix, ...wasmUnsignedLeb(op)];
+}
+
+// Computes dst[k] = a[k] op b[k] for two 16 byte chunks, where all arrays are
+// given as static offsets from the address in local 0.
+function binopPair(op, a, b, dst) {
+  const body = [];
+  for (const k of [0, 16]) {
+    body.push(
+        kExprLocalGet, 0,
+        kExprLocalGet, 0, ...simd(kExprS128LoadMem), 0, a + k,
+        kExprLocalGet, 0, ...simd(kExprS128LoadMem), 0, b + k,
+        ...simd(op),
+        ...simd(kExprS128StoreMem), 0, dst + k);
+  }
+  return body;
+}
+
+function instantiate(op, a, b, dst) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('main', kSig_v_i)
+      .addBody(binopPair(op, a, b, dst))
+      .exportFunc();
+  const instance = builder.instantiate();
+  %WasmTierUpFunction(instance, 0);
+  return instance;
+}
+
+(function testI32x4Add() {
+  print(arguments.callee.name);
+  const instance = instantiate(kExprI32x4Add, 0, 32, 64);
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  const base = 16;
+  for (let i = 0; i < 8; ++i) {
+    memory[base / 4 + i] = i;
+    memory[base / 4 + 8 + i] = 10 * i;
+  }
+  instance.exports.main(base);
+  assertEquals(
+      [0, 11, 22, 33, 44, 55, 66, 77],
+      Array.from(memory.slice(base / 4 + 16, base / 4 + 24)));
+})();
+
+(function testF64x2Sub() {
+  print(arguments.callee.name);
+  const instance = instantiate(kExprF64x2Sub, 0, 32, 64);
+  const memory = new Float64Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 4; ++i) {
+    memory[i] = 1.5 * i;
+    memory[4 + i] = i;
+  }
+  instance.exports.main(0);
+  assertEquals([0, 0.5, 1, 1.5], Array.from(memory.slice(8, 12)));
+})();
+
+(function testStoreAliasesLoad() {
+  print(arguments.callee.name);
+  // The first store writes the upper half of {a}, which the second half of
+  // the computation reads.
+  const instance = instantiate(kExprS128Xor, 0, 64, 16);
+  const memory = new Int32Array(instance.exports.memory.buffer);
+  for (let i = 0; i < 8; ++i) {
+    memory[i] = 1 << i;
+    memory[16 + i] = 1 << (8 + i);
+  }
+  instance.exports.main(0);
+  const expected = [];
+  for (let i = 0; i < 4; ++i) expected.push((1 << i) | (1 << (8 + i)));
+  for (let i = 4; i < 8; ++i) {
+    expected.push(expected[i - 4] | (1 << (8 + i)));
+  }
+  assertEquals(expected, Array.from(memory.slice(4, 12)));
+})();
+
+(function testOutOfBounds() {
+  print(arguments.callee.name);
+  const instance = instantiate(kExprI32x4Add, 0, 32, 64);
+  instance.exports.main(kPageSize - 96);
+  assertTraps(
+      kTrapMemOutOfBounds, () => instance.exports.main(kPageSize - 88));
+  assertTraps(kTrapMemOutOfBounds, () => instance.exports.main(-16));
+})();
@@ -10,6 +10,9 @@
 #include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
+#include "src/api/api-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -238,4 +241,64 @@ TEST_F(DeserializeTest, OffThreadDeserializeRejectsDifferentSource) {
   }
 }
 
+
+// Check that off-thread deserialization merges into the script that the
+// compilation cache already has, and compiles its functions from the cache.
+TEST_F(DeserializeTest, OffThreadDeserializeMergesWithCompilationCache) {
+  const char* kSource = "function foo() { return 42; }";
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+
+  {
+    IsolateAndContextScope scope(this);
+
+    Local<Script> script =
+        Script::Compile(context(), NewString(kSource)).ToLocalChecked();
+
+    CHECK(!script->Run(context()).IsEmpty());
+    CHECK_EQ(RunGlobalFunc("foo"), Integer::New(isolate(), 42));
+
+    cached_data.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    // Without calling foo, so that the cached script only has the top-level
+    // function compiled.
+    Local<Script> cached_script =
+        Script::Compile(context(), NewString(kSource)).ToLocalChecked();
+    CHECK(!cached_script->Run(context()).IsEmpty());
+
+    Local<String> source_code = NewString(kSource);
+    std::unique_ptr<ScriptCompiler::ConsumeCodeCacheTask> task(
+        ScriptCompiler::StartConsumingCodeCache(
+            isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                           cached_data->data, cached_data->length,
+                           ScriptCompiler::CachedData::BufferNotOwned)));
+    task->SourceTextAvailable(isolate(), source_code,
+                              ScriptOrigin(isolate(), Local<Value>()));
+    DeserializeThread deserialize_thread(task.release());
+    CHECK(deserialize_thread.Start());
+    deserialize_thread.Join();
+
+    ScriptCompiler::Source source(source_code, cached_data.release(),
+                                  deserialize_thread.TakeTask().release());
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+
+    CHECK(!source.GetCachedData()->rejected);
+    CHECK_EQ(script->GetUnboundScript()->GetId(),
+             cached_script->GetUnboundScript()->GetId());
+    Local<Value> foo =
+        context()->Global()->Get(context(), NewString("foo")).ToLocalChecked();
+    i::Handle<i::JSFunction> foo_function =
+        i::Handle<i::JSFunction>::cast(Utils::OpenHandle(*foo));
+    CHECK(foo_function->shared().is_compiled());
+    CHECK_EQ(RunGlobalFunc("foo"), v8::Integer::New(isolate(), 42));
+  }
+}
+
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "src/base/build_config.h"
+#include "src/base/page-allocator.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 #ifdef V8_TARGET_OS_LINUX
@@ -155,6 +156,45 @@ TEST(OS, GetSharedLibraryAddresses) {
   EXPECT_EQ(shared_library_addresses[1].start, 0x12430000u - 0x62000);
 #endif
 }
+
+namespace {
+
+class NumaAffinityThread : public Thread {
+ public:
+  NumaAffinityThread() : Thread(Options("NumaAffinityThread")) {}
+
+  void Run() final {
+    // Pin a separate thread, so that the test runner keeps its affinity.
+    int node = OS::GetCurrentNumaNode();
+    if (node < 0) return;
+    EXPECT_TRUE(OS::SetCurrentThreadNumaNode(node));
+    EXPECT_EQ(node, OS::GetCurrentNumaNode());
+  }
+};
+
+}  // namespace
+
+TEST(OS, NumaAffinity) {
+  NumaAffinityThread thread;
+  ASSERT_TRUE(thread.Start());
+  thread.Join();
+
+  EXPECT_FALSE(OS::SetCurrentThreadNumaNode(-1));
+
+  PageAllocator page_allocator;
+  size_t size = page_allocator.AllocatePageSize();
+  void* pages = page_allocator.AllocatePages(nullptr, size, size,
+                                             PageAllocator::kReadWrite);
+  ASSERT_NE(nullptr, pages);
+  int node = OS::GetCurrentNumaNode();
+  if (node >= 0) {
+    EXPECT_TRUE(OS::SetPagesNumaNode(pages, size, node));
+    // The pages stay usable.
+    memset(pages, 0xab, size);
+  }
+  EXPECT_FALSE(OS::SetPagesNumaNode(pages, size, -1));
+  EXPECT_TRUE(page_allocator.FreePages(pages, size));
+}
 #endif  // V8_TARGET_OS_LINUX
 
 namespace {
@@ -512,6 +512,37 @@ TEST_F(LazyCompileDispatcherTest, IdleTaskSmallIdleTime) {
   dispatcher.AbortAll();
 }
 
+TEST_F(LazyCompileDispatcherTest, CompileInEnqueueOrder) {
+  MockPlatform platform;
+  LazyCompileDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1);
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2);
+
+  // The function enqueued first is compiled first.
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 2u);
+  ASSERT_EQ(
+      dispatcher.pending_background_jobs_.front(),
+      dispatcher.GetJobFor(shared_1, base::MutexGuard(&dispatcher.mutex_)));
+  ASSERT_EQ(
+      dispatcher.pending_background_jobs_.back(),
+      dispatcher.GetJobFor(shared_2, base::MutexGuard(&dispatcher.mutex_)));
+
+  platform.RunJobTasksAndBlock(V8::GetCurrentPlatform());
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 0u);
+  ASSERT_EQ(dispatcher.finalizable_jobs_.size(), 2u);
+
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_TRUE(shared_1->is_compiled());
+  ASSERT_TRUE(shared_2->is_compiled());
+  dispatcher.AbortAll();
+}
+
 TEST_F(LazyCompileDispatcherTest, IdleTaskException) {
   MockPlatform platform;
   LazyCompileDispatcher dispatcher(i_isolate(), &platform, 50);
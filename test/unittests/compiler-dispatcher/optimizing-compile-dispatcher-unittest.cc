@@ -96,5 +96,37 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, CoalesceInstallRequests) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  BlockingCompilationJob* job1 = new BlockingCompilationJob(i_isolate(), fun);
+  BlockingCompilationJob* job2 = new BlockingCompilationJob(i_isolate(), fun);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  StackGuard* stack_guard = i_isolate()->stack_guard();
+  stack_guard->ClearInstallCode();
+  dispatcher.QueueForOptimization(job1);
+  while (!job1->IsBlocking()) {
+  }
+  job1->Signal();
+  while (!stack_guard->CheckInstallCode()) {
+  }
+
+  // Pretend the interrupt was postponed. The second job joins the batch that
+  // is waiting to be installed instead of requesting another interrupt.
+  stack_guard->ClearInstallCode();
+  dispatcher.QueueForOptimization(job2);
+  while (!job2->IsBlocking()) {
+  }
+  job2->Signal();
+  dispatcher.AwaitCompileTasks();
+  EXPECT_FALSE(stack_guard->CheckInstallCode());
+
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,159 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/slp-vectorizer.h"
+
+#include "src/compiler/node-properties.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class SLPVectorizerTest : public GraphTest {
+ public:
+  SLPVectorizerTest()
+      : GraphTest(),
+        machine_(zone(), MachineType::PointerRepresentation(),
+                 MachineOperatorBuilder::kNoFlags) {}
+  ~SLPVectorizerTest() override = default;
+
+ protected:
+  void Reduce() {
+    SLPVectorizer vectorizer(zone(), graph(), machine());
+    vectorizer.Reduce();
+  }
+
+  Node* LoadFloat64(Node* base, int64_t offset, Node* effect) {
+    return graph()->NewNode(machine()->Load(MachineType::Float64()), base,
+                            Int64Constant(offset), effect, graph()->start());
+  }
+
+  Node* StoreFloat64(Node* base, int64_t offset, Node* value, Node* effect) {
+    return graph()->NewNode(
+        machine()->Store(StoreRepresentation(MachineRepresentation::kFloat64,
+                                             kNoWriteBarrier)),
+        base, Int64Constant(offset), value, effect, graph()->start());
+  }
+
+  Node* Return(Node* value, Node* effect) {
+    Node* ret = graph()->NewNode(common()->Return(), Int32Constant(0), value,
+                                 effect, graph()->start());
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return ret;
+  }
+
+  MachineOperatorBuilder* machine() { return &machine_; }
+
+ private:
+  MachineOperatorBuilder machine_;
+};
+
+// -----------------------------------------------------------------------------
+// c[0] = a[0] * b[0]; c[1] = a[1] * b[1];
+
+TEST_F(SLPVectorizerTest, PackMultiplication) {
+  Node* a = Parameter(0);
+  Node* b = Parameter(1);
+  Node* c = Parameter(2);
+  Node* a0 = LoadFloat64(a, 0, graph()->start());
+  Node* a1 = LoadFloat64(a, 8, a0);
+  Node* b0 = LoadFloat64(b, 0, a1);
+  Node* b1 = LoadFloat64(b, 8, b0);
+  Node* mul0 = graph()->NewNode(machine()->Float64Mul(), a0, b0);
+  Node* mul1 = graph()->NewNode(machine()->Float64Mul(), a1, b1);
+  Node* store0 = StoreFloat64(c, 0, mul0, b1);
+  Node* store1 = StoreFloat64(c, 8, mul1, store0);
+  Node* ret = Return(Int32Constant(0), store1);
+
+  Reduce();
+
+  Node* store = NodeProperties::GetEffectInput(ret);
+  ASSERT_EQ(IrOpcode::kStore, store->opcode());
+  EXPECT_EQ(MachineRepresentation::kSimd128,
+            StoreRepresentationOf(store->op()).representation());
+  EXPECT_EQ(c, store->InputAt(0));
+  Node* mul = store->InputAt(2);
+  ASSERT_EQ(IrOpcode::kF64x2Mul, mul->opcode());
+  for (int i = 0; i < 2; ++i) {
+    Node* load = mul->InputAt(i);
+    ASSERT_EQ(IrOpcode::kLoad, load->opcode());
+    EXPECT_EQ(MachineType::Simd128(), LoadRepresentationOf(load->op()));
+    EXPECT_EQ(i == 0 ? a : b, load->InputAt(0));
+  }
+  // The packed loads keep their order on the effect chain.
+  EXPECT_EQ(mul->InputAt(1), NodeProperties::GetEffectInput(store));
+  EXPECT_EQ(mul->InputAt(0),
+            NodeProperties::GetEffectInput(mul->InputAt(1)));
+  EXPECT_EQ(graph()->start(),
+            NodeProperties::GetEffectInput(mul->InputAt(0)));
+}
+
+// -----------------------------------------------------------------------------
+// c[0] = a[0] + k; c[1] = a[1] + k;
+
+TEST_F(SLPVectorizerTest, SplatCommonOperand) {
+  Node* a = Parameter(0);
+  Node* c = Parameter(1);
+  Node* k = Float64Constant(1.5);
+  Node* a0 = LoadFloat64(a, 0, graph()->start());
+  Node* a1 = LoadFloat64(a, 8, a0);
+  Node* add0 = graph()->NewNode(machine()->Float64Add(), a0, k);
+  Node* add1 = graph()->NewNode(machine()->Float64Add(), a1, k);
+  Node* store0 = StoreFloat64(c, 0, add0, a1);
+  Node* store1 = StoreFloat64(c, 8, add1, store0);
+  Node* ret = Return(Int32Constant(0), store1);
+
+  Reduce();
+
+  Node* store = NodeProperties::GetEffectInput(ret);
+  ASSERT_EQ(IrOpcode::kStore, store->opcode());
+  Node* add = store->InputAt(2);
+  ASSERT_EQ(IrOpcode::kF64x2Add, add->opcode());
+  EXPECT_EQ(IrOpcode::kLoad, add->InputAt(0)->opcode());
+  ASSERT_EQ(IrOpcode::kF64x2Splat, add->InputAt(1)->opcode());
+  EXPECT_EQ(k, add->InputAt(1)->InputAt(0));
+}
+
+// -----------------------------------------------------------------------------
+// Scalar values with other uses block packing.
+
+TEST_F(SLPVectorizerTest, KeepScalarWithOtherUse) {
+  Node* a = Parameter(0);
+  Node* c = Parameter(1);
+  Node* a0 = LoadFloat64(a, 0, graph()->start());
+  Node* a1 = LoadFloat64(a, 8, a0);
+  Node* store0 = StoreFloat64(c, 0, a0, a1);
+  Node* store1 = StoreFloat64(c, 8, a1, store0);
+  Node* ret = Return(a0, store1);
+
+  Reduce();
+
+  EXPECT_EQ(store1, NodeProperties::GetEffectInput(ret));
+  EXPECT_EQ(store0, NodeProperties::GetEffectInput(store1));
+}
+
+// -----------------------------------------------------------------------------
+// Accesses that aren't neighbours on the effect chain are not packed.
+
+TEST_F(SLPVectorizerTest, KeepNonAdjacentStores) {
+  Node* a = Parameter(0);
+  Node* c = Parameter(1);
+  Node* a0 = LoadFloat64(a, 0, graph()->start());
+  Node* a1 = LoadFloat64(a, 8, a0);
+  Node* store0 = StoreFloat64(c, 0, a0, a1);
+  Node* load = LoadFloat64(a, 16, store0);
+  Node* store1 = StoreFloat64(c, 8, a1, load);
+  Node* ret = Return(load, store1);
+
+  Reduce();
+
+  EXPECT_EQ(store1, NodeProperties::GetEffectInput(ret));
+  EXPECT_EQ(load, NodeProperties::GetEffectInput(store1));
+  EXPECT_EQ(store0, NodeProperties::GetEffectInput(load));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -2331,6 +2331,12 @@ static constexpr ArchShuffle kArchShuffles[] = {
         kX64S8x16Dup,
         2,
     },
+    // Byte-wise blend which doesn't match a 16x8 blend.
+    {
+        {0, 17, 2, 3, 20, 5, 6, 7, 8, 9, 26, 11, 12, 13, 14, 31},
+        kX64S8x16Blend,
+        6,
+    },
     // Generic shuffle that only uses 1 input.
     {
         {1, 15, 2, 14, 3, 13, 4, 12, 5, 11, 6, 10, 7, 9, 8},
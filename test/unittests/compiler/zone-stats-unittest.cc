@@ -15,6 +15,7 @@ class ZoneStatsTest : public TestWithPlatform {
   ZoneStatsTest() : zone_stats_(&allocator_) {}
 
  protected:
+  AccountingAllocator* allocator() { return &allocator_; }
   ZoneStats* zone_stats() { return &zone_stats_; }
 
   void ExpectForPool(size_t current, size_t max, size_t total) {
@@ -155,6 +156,33 @@ TEST_F(ZoneStatsTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZoneStatsTest, SegmentPool) {
+  AccountingAllocator::SegmentPoolStats stats =
+      zone_stats()->GetSegmentPoolStats();
+  ASSERT_EQ(0u, stats.pooled_bytes);
+  {
+    ZoneStats::Scope scope(zone_stats(), ZONE_NAME);
+    scope.zone()->Allocate<void>(1000);
+  }
+  stats = zone_stats()->GetSegmentPoolStats();
+  ASSERT_LT(0u, stats.pooled_bytes);
+  ASSERT_EQ(0u, stats.hits);
+  ASSERT_EQ(1u, stats.misses);
+  ASSERT_EQ(0u, allocator()->GetCurrentMemoryUsage());
+  {
+    // The next zone reuses the segment of the previous one.
+    ZoneStats::Scope scope(zone_stats(), ZONE_NAME);
+    scope.zone()->Allocate<void>(1000);
+    ASSERT_EQ(1u, zone_stats()->GetSegmentPoolStats().hits);
+    ASSERT_EQ(0u, zone_stats()->GetSegmentPoolStats().pooled_bytes);
+  }
+  size_t pooled_bytes = zone_stats()->GetSegmentPoolStats().pooled_bytes;
+  allocator()->ReleasePooledSegments();
+  stats = zone_stats()->GetSegmentPoolStats();
+  ASSERT_EQ(0u, stats.pooled_bytes);
+  ASSERT_EQ(pooled_bytes, stats.released_bytes);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
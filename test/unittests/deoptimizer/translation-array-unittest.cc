@@ -0,0 +1,40 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/translation-array.h"
+
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using TranslationArrayBuilderTest = TestWithZone;
+
+namespace {
+
+int AddTranslation(TranslationArrayBuilder* builder, int stack_slot) {
+  int index = builder->BeginTranslation(1, 1, 0);
+  builder->BeginInterpretedFrame(BytecodeOffset(3), 0, 1, 0, 0);
+  builder->StoreStackSlot(stack_slot);
+  return builder->FinishTranslation(index);
+}
+
+}  // namespace
+
+TEST_F(TranslationArrayBuilderTest, SharesIdenticalTranslations) {
+  TranslationArrayBuilder builder(zone());
+  int first = AddTranslation(&builder, 1);
+  int second = AddTranslation(&builder, 2);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first, AddTranslation(&builder, 1));
+  EXPECT_EQ(second, AddTranslation(&builder, 2));
+  // Shared translations are dropped, so new ones start where the last unshared
+  // one ended.
+  int third = AddTranslation(&builder, 3);
+  EXPECT_EQ(second - first, third - second);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "include/v8-function.h"
+#include "src/base/platform/platform.h"
 #include "src/heap/factory.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
@@ -191,6 +192,75 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// Batches of microtasks resize the ring buffer at most once.
+TEST_P(MicrotaskQueueTest, EnqueueBatch) {
+  constexpr int kCount = 4 * MicrotaskQueue::kMinimumCapacity + 1;
+  std::vector<int> order;
+  std::vector<void*> data;
+  for (int i = 0; i < kCount; ++i) {
+    data.push_back(new Closure([&order, i] { order.push_back(i); }));
+  }
+  microtask_queue()->EnqueueMicrotasks(
+      v8_isolate(), &RunStdFunction,
+      MemorySpan<void* const>(data.data(), data.size()));
+  EXPECT_EQ(8 * MicrotaskQueue::kMinimumCapacity,
+            microtask_queue()->capacity());
+  EXPECT_EQ(kCount, microtask_queue()->size());
+
+  EXPECT_EQ(kCount, microtask_queue()->RunMicrotasks(isolate()));
+  ASSERT_EQ(static_cast<size_t>(kCount), order.size());
+  for (int i = 0; i < kCount; ++i) EXPECT_EQ(i, order[i]);
+}
+
+namespace {
+
+class EnqueueThread final : public base::Thread {
+ public:
+  EnqueueThread(MicrotaskQueue* microtask_queue, std::vector<int>* order,
+                int count)
+      : base::Thread(base::Thread::Options("EnqueueThread")),
+        microtask_queue_(microtask_queue),
+        order_(order),
+        count_(count) {}
+
+  void Run() override {
+    for (int i = 0; i < count_; ++i) {
+      std::vector<int>* order = order_;
+      microtask_queue_->EnqueueMicrotaskFromAnyThread(
+          &RunStdFunction, new Closure([order, i] { order->push_back(i); }));
+    }
+  }
+
+ private:
+  MicrotaskQueue* microtask_queue_;
+  std::vector<int>* order_;
+  int count_;
+};
+
+}  // namespace
+
+// Microtasks enqueued from other threads run at the next checkpoint, in the
+// order each thread enqueued them.
+TEST_P(MicrotaskQueueTest, EnqueueFromAnyThread) {
+  constexpr int kThreads = 4;
+  constexpr int kCount = 1000;
+  std::vector<int> orders[kThreads];
+  std::vector<std::unique_ptr<EnqueueThread>> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.push_back(
+        std::make_unique<EnqueueThread>(microtask_queue(), &orders[i], kCount));
+  }
+  for (auto& thread : threads) EXPECT_TRUE(thread->Start());
+  for (auto& thread : threads) thread->Join();
+  EXPECT_EQ(0, microtask_queue()->size());
+
+  EXPECT_EQ(kThreads * kCount, microtask_queue()->RunMicrotasks(isolate()));
+  for (const std::vector<int>& order : orders) {
+    ASSERT_EQ(static_cast<size_t>(kCount), order.size());
+    for (int i = 0; i < kCount; ++i) EXPECT_EQ(i, order[i]);
+  }
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
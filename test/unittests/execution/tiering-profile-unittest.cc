@@ -0,0 +1,56 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "src/flags/flags.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+using TieringProfileTest = TestWithContext;
+
+TEST_F(TieringProfileTest, RecordsOptimizedFunctionAndInlinees) {
+  if (!FLAG_turbofan || !FLAG_turbo_inlining) return;
+  FLAG_allow_natives_syntax = true;
+  const char* filename = "tiering-profile-unittest.txt";
+  FlagScope<const char*> output_scope(&FLAG_tiering_profile_output, filename);
+
+  // Function literal ids: 0 is the script, 1 is callee and 2 is caller.
+  const char* source =
+      "function callee(x) { return x + 1; }\n"
+      "function caller(x) { return callee(x); }\n"
+      "%PrepareFunctionForOptimization(caller);\n"
+      "caller(1);\n"
+      "caller(2);\n"
+      "%OptimizeFunctionOnNextCall(caller);\n"
+      "caller(3);\n";
+  CompileWithOrigin(NewString(source), NewString("profiled.js"), false)
+      ->Run(context())
+      .ToLocalChecked();
+  TieringProfile::WriteOutput();
+
+  std::ifstream file(filename);
+  ASSERT_TRUE(file.good());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  file.close();
+  std::remove(filename);
+
+  const std::string profile = contents.str();
+  EXPECT_NE(std::string::npos, profile.find("script,0,profiled.js\n"));
+  EXPECT_NE(std::string::npos, profile.find("function,0,2\n"));
+  EXPECT_NE(std::string::npos, profile.find("inlinee,0,2,0,1\n"));
+}
+
+}  // namespace internal
+}  // namespace v8
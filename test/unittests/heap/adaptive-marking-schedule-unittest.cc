@@ -0,0 +1,98 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/adaptive-marking-schedule.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+constexpr size_t kLiveBytes = 100 * MB;
+constexpr size_t kLargeHeadroom = size_t{1} << 40;
+}  // namespace
+
+TEST(AdaptiveMarkingSchedule, NoProgressBeforeTimePasses) {
+  AdaptiveMarkingSchedule schedule;
+  schedule.Start(0, kLiveBytes, 0);
+  EXPECT_EQ(0u, schedule.BytesToMarkOnMainThread(0, 0, 0, 0, kLargeHeadroom));
+}
+
+TEST(AdaptiveMarkingSchedule, IdleMutatorUsesWallTimeBudget) {
+  AdaptiveMarkingSchedule schedule;
+  schedule.Start(0, kLiveBytes, 0);
+  // Without allocation and concurrent marking, the main thread has to mark
+  // everything within the wall time budget.
+  const double step_ms = 10;
+  size_t bytes =
+      schedule.BytesToMarkOnMainThread(step_ms, 0, 0, 0, kLargeHeadroom);
+  EXPECT_EQ(AdaptiveMarkingSchedule::kTargetMarkingWallTimeInMs,
+            schedule.target_finish_time_ms());
+  const double expected =
+      kLiveBytes * step_ms /
+      (AdaptiveMarkingSchedule::kTargetMarkingWallTimeInMs - step_ms);
+  EXPECT_NEAR(expected, static_cast<double>(bytes), 2.0);
+}
+
+TEST(AdaptiveMarkingSchedule, AllocationPressureMovesDeadline) {
+  AdaptiveMarkingSchedule relaxed;
+  AdaptiveMarkingSchedule pressured;
+  relaxed.Start(0, kLiveBytes, 0);
+  pressured.Start(0, kLiveBytes, 0);
+  // 1MB/ms allocation rate with only 50MB of headroom leaves 50ms to finish.
+  const size_t relaxed_bytes =
+      relaxed.BytesToMarkOnMainThread(10, 0, 0, 10 * MB, kLargeHeadroom);
+  const size_t pressured_bytes =
+      pressured.BytesToMarkOnMainThread(10, 0, 0, 10 * MB, 50 * MB);
+  EXPECT_DOUBLE_EQ(60, pressured.target_finish_time_ms());
+  EXPECT_GT(pressured_bytes, relaxed_bytes);
+}
+
+TEST(AdaptiveMarkingSchedule, ConcurrentMarkingReducesMainThreadWork) {
+  AdaptiveMarkingSchedule alone;
+  AdaptiveMarkingSchedule helped;
+  alone.Start(0, kLiveBytes, 0);
+  helped.Start(0, kLiveBytes, 0);
+  const size_t alone_bytes =
+      alone.BytesToMarkOnMainThread(100, 0, 0, 0, kLargeHeadroom);
+  const size_t helped_bytes =
+      helped.BytesToMarkOnMainThread(100, 10 * MB, 10 * MB, 0, kLargeHeadroom);
+  EXPECT_LT(helped_bytes, alone_bytes);
+}
+
+TEST(AdaptiveMarkingSchedule, FastConcurrentMarkingNeedsNoMainThreadWork) {
+  AdaptiveMarkingSchedule schedule;
+  schedule.Start(0, kLiveBytes, 0);
+  // 50MB in 100ms: the remaining 50MB are covered by concurrent marking well
+  // before the deadline.
+  EXPECT_EQ(0u, schedule.BytesToMarkOnMainThread(100, 50 * MB, 50 * MB, 0,
+                                                 kLargeHeadroom));
+}
+
+TEST(AdaptiveMarkingSchedule, DoneWhenEverythingIsMarked) {
+  AdaptiveMarkingSchedule schedule;
+  schedule.Start(0, kLiveBytes, 0);
+  EXPECT_EQ(0u, schedule.BytesToMarkOnMainThread(10, kLiveBytes, 0, 0,
+                                                 kLargeHeadroom));
+}
+
+TEST(AdaptiveMarkingSchedule, LateCycleCatchesUpOverSeveralSteps) {
+  AdaptiveMarkingSchedule schedule;
+  schedule.Start(0, kLiveBytes, 0);
+  // Past the deadline the remaining work is still spread over at least
+  // kMinRemainingTimeInMs.
+  const double step_ms = 1;
+  size_t bytes =
+      schedule.BytesToMarkOnMainThread(1000, 0, 0, 0, kLargeHeadroom);
+  EXPECT_EQ(kLiveBytes, bytes);
+  bytes = schedule.BytesToMarkOnMainThread(1000 + step_ms, 0, 0, 0,
+                                           kLargeHeadroom);
+  EXPECT_NEAR(kLiveBytes * step_ms /
+                  AdaptiveMarkingSchedule::kMinRemainingTimeInMs,
+              static_cast<double>(bytes), 2.0);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -241,5 +241,36 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, FragmentationTriggersCompaction) {
+  static constexpr int kNumObjects = 1024;
+  static constexpr int kGarbagePerLiveObject = 7;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  for (int i = 0; i < kNumObjects; ++i) {
+    for (int j = 0; j < kGarbagePerLiveObject; ++j) {
+      MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+    }
+    holder->objects[i] =
+        MakeGarbageCollected<CompactableGCed>(GetAllocationHandle());
+    holder->objects[i]->id = i;
+  }
+  // Sweeping turns the interleaved garbage into a freelist that is below the
+  // absolute size threshold but makes up most of the space.
+  heap()->CollectGarbage(GarbageCollector::Config::PreciseAtomicConfig());
+  compactor().InitializeIfShouldCompact(
+      GarbageCollector::Config::MarkingType::kIncremental,
+      GarbageCollector::Config::StackState::kNoHeapPointers);
+  EXPECT_TRUE(compactor().IsEnabledForTesting());
+  CompactableGCed::g_destructor_callcount = 0u;
+  heap()->StartIncrementalGarbageCollection(
+      GarbageCollector::Config::PreciseIncrementalConfig());
+  EndGC();
+  EXPECT_EQ(0u, CompactableGCed::g_destructor_callcount);
+  for (int i = 0; i < kNumObjects; ++i) {
+    EXPECT_EQ(static_cast<size_t>(i), holder->objects[i]->id);
+  }
+}
+
 }  // namespace internal
 }  // namespace cppgc
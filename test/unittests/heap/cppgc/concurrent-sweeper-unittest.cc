@@ -355,5 +355,35 @@ TEST_F(ConcurrentSweeperTest, IncrementalSweeping) {
   FinishSweeping();
 }
 
+TEST_F(ConcurrentSweeperTest, IncrementalFinalizationWithDeadline) {
+  // Enough objects to span multiple pages, each having more finalizers than
+  // are invoked between two deadline checks.
+  static constexpr size_t kNumberOfObjects = 16 * 1024;
+  std::vector<void*> objects;
+  objects.reserve(kNumberOfObjects);
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    objects.push_back(
+        MakeGarbageCollected<NormalFinalizable>(GetAllocationHandle()));
+  }
+  const BaseSpace& space = BasePage::FromPayload(objects[0])->space();
+
+  StartSweeping();
+  WaitForConcurrentSweeping();
+  EXPECT_EQ(0u, g_destructor_callcount);
+
+  // Finalize in short slices. Slices may stop in the middle of a page and
+  // must resume without finalizing objects twice or skipping any.
+  Sweeper& sweeper = Heap::From(GetHeap())->sweeper();
+  static constexpr double kSliceInSeconds = 0.002;
+  while (!sweeper.PerformSweepOnMutatorThread(
+      GetPlatform().MonotonicallyIncreasingTime() + kSliceInSeconds)) {
+    EXPECT_GE(kNumberOfObjects, g_destructor_callcount);
+  }
+
+  EXPECT_EQ(kNumberOfObjects, g_destructor_callcount);
+  CheckFreeListEntries(objects);
+  EXPECT_TRUE(FreeListContains(space, objects));
+}
+
 }  // namespace internal
 }  // namespace cppgc
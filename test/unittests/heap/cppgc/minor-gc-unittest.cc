@@ -572,6 +572,51 @@ TEST_F(MinorGCTest, ReexecuteCustomCallback) {
   // The callback must be called only once.
   EXPECT_EQ(4u, GCedWithCustomWeakCallback::custom_callback_called);
 }
+
+using MinorGCApiTest = testing::TestWithPlatform;
+
+TEST_F(MinorGCApiTest, GenerationalGCThroughHeapOptions) {
+  cppgc::Heap::HeapOptions options;
+  options.enable_generational_gc = true;
+  std::unique_ptr<cppgc::Heap> heap =
+      cppgc::Heap::Create(GetPlatformHandle(), std::move(options));
+  Heap* internal_heap = Heap::From(heap.get());
+  // Generational GC only becomes active with the first garbage collection,
+  // so the first minor GC is performed as a major GC.
+  EXPECT_FALSE(internal_heap->generational_gc_supported());
+  heap->ForceMinorGarbageCollectionSlow("test", "testing");
+  EXPECT_TRUE(internal_heap->generational_gc_supported());
+
+  SimpleGCedBase::destructed_objects = 0;
+  Persistent<Small> old_object =
+      MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+  heap->ForceMinorGarbageCollectionSlow("test", "testing");
+  EXPECT_TRUE(IsHeapObjectOld(old_object.Get()));
+
+  MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+  {
+    // Make the young object reachable only from the old one, so that the
+    // write barrier must record the slot.
+    Small* young = MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+    old_object->next = young;
+  }
+  heap->ForceMinorGarbageCollectionSlow("test", "testing");
+  // Only the unreachable young object is reclaimed.
+  EXPECT_EQ(1u, SimpleGCedBase::destructed_objects);
+  EXPECT_TRUE(IsHeapObjectOld(old_object->next.Get()));
+
+  internal_heap->Terminate();
+}
+
+TEST_F(MinorGCApiTest, MinorGCFallsBackToMajorGCWithoutGenerationalGC) {
+  std::unique_ptr<cppgc::Heap> heap = cppgc::Heap::Create(GetPlatformHandle());
+  SimpleGCedBase::destructed_objects = 0;
+  heap->ForceMinorGarbageCollectionSlow("test", "testing");
+  EXPECT_FALSE(Heap::From(heap.get())->generational_gc_supported());
+  MakeGarbageCollected<Small>(heap->GetAllocationHandle());
+  heap->ForceMinorGarbageCollectionSlow("test", "testing");
+  EXPECT_EQ(1u, SimpleGCedBase::destructed_objects);
+}
 }  // namespace internal
 }  // namespace cppgc
 
@@ -0,0 +1,92 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/gc-phase-histogram.h"
+
+#include <algorithm>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(GCPhaseHistogram, BucketsAreContiguous) {
+  EXPECT_EQ(0, GCPhaseHistogram::BucketLowerBound(0));
+  for (int i = 0; i < GCPhaseHistogram::kBucketCount; i++) {
+    const int64_t lower = GCPhaseHistogram::BucketLowerBound(i);
+    const int64_t upper = GCPhaseHistogram::BucketUpperBound(i);
+    EXPECT_LT(lower, upper);
+    EXPECT_EQ(i, GCPhaseHistogram::BucketIndex(lower));
+    EXPECT_EQ(i, GCPhaseHistogram::BucketIndex(upper - 1));
+    // The width of a bucket is bounded by 1/kSubBucketCount of its values.
+    EXPECT_LE((upper - lower) * GCPhaseHistogram::kSubBucketCount,
+              std::max(lower, int64_t{GCPhaseHistogram::kSubBucketCount}));
+  }
+}
+
+TEST(GCPhaseHistogram, OutOfRangeValuesAreClamped) {
+  EXPECT_EQ(0, GCPhaseHistogram::BucketIndex(-5));
+  EXPECT_EQ(GCPhaseHistogram::kBucketCount - 1,
+            GCPhaseHistogram::BucketIndex(int64_t{1} << 40));
+}
+
+TEST(GCPhaseHistogram, Empty) {
+  GCPhaseHistogram histogram;
+  EXPECT_TRUE(histogram.IsEmpty());
+  EXPECT_EQ(-1, histogram.ValueAtPercentile(50));
+  v8::metrics::GarbageCollectionPhaseHistogram event;
+  histogram.FillEvent(&event);
+  EXPECT_EQ(0, event.sample_count);
+  EXPECT_EQ(-1, event.p99_in_us);
+  EXPECT_TRUE(event.bucket_counts.empty());
+}
+
+TEST(GCPhaseHistogram, Percentiles) {
+  GCPhaseHistogram histogram;
+  // 990 short pauses and 10 long ones.
+  for (int i = 0; i < 990; i++) histogram.Record(100);
+  for (int i = 0; i < 10; i++) histogram.Record(50000);
+  EXPECT_EQ(1000, histogram.count());
+  EXPECT_EQ(100, histogram.min());
+  EXPECT_EQ(50000, histogram.max());
+  EXPECT_EQ(990 * 100 + 10 * 50000, histogram.sum());
+  EXPECT_EQ(GCPhaseHistogram::BucketLowerBound(
+                GCPhaseHistogram::BucketIndex(100)),
+            histogram.ValueAtPercentile(50));
+  EXPECT_EQ(GCPhaseHistogram::BucketLowerBound(
+                GCPhaseHistogram::BucketIndex(100)),
+            histogram.ValueAtPercentile(99));
+  const int64_t p999 = histogram.ValueAtPercentile(99.9);
+  EXPECT_LE(p999, 50000);
+  EXPECT_GE(p999 * GCPhaseHistogram::kSubBucketCount,
+            50000 * (GCPhaseHistogram::kSubBucketCount - 1));
+}
+
+TEST(GCPhaseHistogram, FillEventAndReset) {
+  GCPhaseHistogram histogram;
+  histogram.Record(3);
+  histogram.Record(3);
+  histogram.Record(1000);
+  v8::metrics::GarbageCollectionPhaseHistogram event;
+  histogram.FillEvent(&event);
+  EXPECT_EQ(3, event.sample_count);
+  EXPECT_EQ(3, event.min_in_us);
+  EXPECT_EQ(1000, event.max_in_us);
+  EXPECT_EQ(1006, event.sum_in_us);
+  ASSERT_EQ(2u, event.bucket_counts.size());
+  ASSERT_EQ(2u, event.bucket_lower_bounds_in_us.size());
+  ASSERT_EQ(2u, event.bucket_upper_bounds_in_us.size());
+  EXPECT_EQ(2, event.bucket_counts[0]);
+  EXPECT_EQ(3, event.bucket_lower_bounds_in_us[0]);
+  EXPECT_EQ(4, event.bucket_upper_bounds_in_us[0]);
+  EXPECT_EQ(1, event.bucket_counts[1]);
+  EXPECT_LE(event.bucket_lower_bounds_in_us[1], 1000);
+  EXPECT_GT(event.bucket_upper_bounds_in_us[1], 1000);
+
+  histogram.Reset();
+  EXPECT_TRUE(histogram.IsEmpty());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -52,6 +52,25 @@ TEST_F(MemoryControllerTest, HeapGrowingFactor) {
                     V8Controller::DynamicGrowingFactor(400, 1, 4.0));
 }
 
+TEST_F(MemoryControllerTest, HeapGrowingFactorWithGoal) {
+  CheckEqualRounded(1.613,
+                    V8Controller::DynamicGrowingFactor(50, 1, 4.0, 0.95));
+  CheckEqualRounded(1.235,
+                    V8Controller::DynamicGrowingFactor(100, 1, 4.0, 0.95));
+  CheckEqualRounded(V8HeapTrait::kMinGrowingFactor,
+                    V8Controller::DynamicGrowingFactor(100, 1, 4.0, 0.9));
+}
+
+TEST_F(MemoryControllerTest, GoalMutatorUtilization) {
+  // Without measurements, the goal is used as is.
+  CheckEqualRounded(0.95, V8Controller::GoalMutatorUtilization(0.05, 1.0));
+  // Too much time spent in GC raises the target.
+  CheckEqualRounded(0.96, V8Controller::GoalMutatorUtilization(0.05, 0.94));
+  CheckEqualRounded(0.975, V8Controller::GoalMutatorUtilization(0.05, 0.5));
+  // Less time spent in GC lowers the target.
+  CheckEqualRounded(0.91, V8Controller::GoalMutatorUtilization(0.05, 0.99));
+}
+
 TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
   CheckEqualRounded(1.3, V8Controller::MaxGrowingFactor(V8HeapTrait::kMinSize));
   CheckEqualRounded(1.600,
@@ -0,0 +1,84 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/load-schedule.h"
+
+#include <limits>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(LoadSchedule, Empty) {
+  LoadSchedule schedule;
+  EXPECT_TRUE(schedule.IsEmpty());
+  EXPECT_FALSE(schedule.InLoadWindow(0));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            schedule.TimeUntilNextLoadWindow(0));
+  EXPECT_EQ(0, schedule.OverlappingWindowEnd(0, 1000));
+}
+
+TEST(LoadSchedule, SingleWindow) {
+  LoadSchedule schedule;
+  schedule.AddWindow(100, 200);
+  EXPECT_FALSE(schedule.InLoadWindow(50));
+  EXPECT_EQ(50, schedule.TimeUntilNextLoadWindow(50));
+  EXPECT_TRUE(schedule.InLoadWindow(150));
+  EXPECT_EQ(0, schedule.TimeUntilNextLoadWindow(150));
+  EXPECT_EQ(0, schedule.OverlappingWindowEnd(50, 40));
+  EXPECT_EQ(200, schedule.OverlappingWindowEnd(50, 60));
+  EXPECT_EQ(200, schedule.OverlappingWindowEnd(150, 0));
+  // Expired windows are dropped.
+  EXPECT_FALSE(schedule.InLoadWindow(200));
+  EXPECT_TRUE(schedule.IsEmpty());
+}
+
+TEST(LoadSchedule, InvalidWindowIsIgnored) {
+  LoadSchedule schedule;
+  schedule.AddWindow(200, 100);
+  schedule.AddWindow(100, 100);
+  EXPECT_TRUE(schedule.IsEmpty());
+}
+
+TEST(LoadSchedule, OverlappingWindowsAreMerged) {
+  LoadSchedule schedule;
+  schedule.AddWindow(300, 400);
+  schedule.AddWindow(100, 200);
+  schedule.AddWindow(150, 350);
+  EXPECT_TRUE(schedule.InLoadWindow(250));
+  EXPECT_EQ(400, schedule.OverlappingWindowEnd(120, 0));
+  EXPECT_EQ(0, schedule.TimeUntilNextLoadWindow(399));
+}
+
+TEST(LoadSchedule, GapsBetweenWindows) {
+  LoadSchedule schedule;
+  schedule.AddWindow(100, 200);
+  schedule.AddWindow(500, 600);
+  EXPECT_EQ(300, schedule.TimeUntilNextLoadWindow(200));
+  EXPECT_EQ(0, schedule.OverlappingWindowEnd(200, 300));
+  EXPECT_EQ(600, schedule.OverlappingWindowEnd(200, 301));
+}
+
+TEST(LoadSchedule, Clear) {
+  LoadSchedule schedule;
+  schedule.AddWindow(100, 200);
+  schedule.Clear();
+  EXPECT_TRUE(schedule.IsEmpty());
+  EXPECT_FALSE(schedule.InLoadWindow(150));
+}
+
+TEST(LoadSchedule, NumberOfWindowsIsBounded) {
+  LoadSchedule schedule;
+  for (size_t i = 0; i <= LoadSchedule::kMaxWindows; i++) {
+    double start = static_cast<double>(i) * 100;
+    schedule.AddWindow(start, start + 50);
+  }
+  double last_start = static_cast<double>(LoadSchedule::kMaxWindows) * 100;
+  EXPECT_TRUE(schedule.InLoadWindow(last_start - 90));
+  EXPECT_FALSE(schedule.InLoadWindow(last_start + 10));
+}
+
+}  // namespace internal
+}  // namespace v8
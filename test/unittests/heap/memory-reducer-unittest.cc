@@ -61,6 +61,7 @@ MemoryReducer::Event TimerEvent(double time_ms,
   event.time_ms = time_ms;
   event.should_start_incremental_gc = should_start_incremental_gc;
   event.can_start_incremental_gc = can_start_incremental_gc;
+  event.load_window_end_ms = 0;
   return event;
 }
 
@@ -230,6 +231,28 @@ TEST(MemoryReducer, FromWaitToRun) {
   EXPECT_EQ(state0.last_gc_time_ms, state1.last_gc_time_ms);
 }
 
+TEST(MemoryReducer, FromWaitToWaitDuringExpectedLoad) {
+  if (!FLAG_incremental_marking) return;
+
+  MemoryReducer::State state0(WaitState(0, 1000.0)), state1(DoneState());
+
+  MemoryReducer::Event event =
+      TimerEventLowAllocationRate(state0.next_gc_start_ms + 1);
+  event.load_window_end_ms = 5000.0;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kWait, state1.action);
+  EXPECT_EQ(5000.0, state1.next_gc_start_ms);
+  EXPECT_EQ(state0.started_gcs, state1.started_gcs);
+  EXPECT_EQ(state0.last_gc_time_ms, state1.last_gc_time_ms);
+
+  // The watchdog is not delayed by expected load.
+  event = TimerEventHighAllocationRate(MemoryReducer::kWatchdogDelayMs + 2);
+  event.load_window_end_ms = MemoryReducer::kWatchdogDelayMs + 5000.0;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kRun, state1.action);
+  EXPECT_EQ(state0.started_gcs + 1, state1.started_gcs);
+}
+
 
 TEST(MemoryReducer, FromWaitToDone) {
   if (!FLAG_incremental_marking) return;
@@ -9,6 +9,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/parked-scope.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -105,9 +106,9 @@ class RunningThread final : public v8::base::Thread {
   std::atomic<int>* counter_;
 };
 
-TEST_F(SafepointTest, StopRunningThreads) {
-  Heap* heap = i_isolate()->heap();
+namespace {
 
+void StopRunningThreads(Heap* heap) {
   const int kThreads = 10;
   const int kRuns = 5;
   const int kSafepoints = 3;
@@ -137,5 +138,16 @@ TEST_F(SafepointTest, StopRunningThreads) {
   CHECK_EQ(safepoint_count, kRuns * kSafepoints);
 }
 
+}  // namespace
+
+TEST_F(SafepointTest, StopRunningThreads) {
+  StopRunningThreads(i_isolate()->heap());
+}
+
+TEST_F(SafepointTest, StopRunningThreadsWithSpinning) {
+  FlagScope<int> spin_iterations(&FLAG_safepoint_spin_iterations, 1000);
+  StopRunningThreads(i_isolate()->heap());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -327,5 +327,42 @@ TEST(TypedSlotSet, Merge) {
       TypedSlotSet::KEEP_EMPTY_CHUNKS);
 }
 
+TEST(TypedSlotSet, Compact) {
+  TypedSlotSet set(0);
+  static const uint32_t kEntries = 1000;
+  // Insert every slot twice, in descending order.
+  for (uint32_t i = kEntries; i > 0; i--) {
+    set.Insert(SlotType::kEmbeddedObjectFull, i);
+    set.Insert(SlotType::kEmbeddedObjectFull, i);
+  }
+  // Without cleared slots the set is left as is.
+  EXPECT_EQ(2 * kEntries, set.Compact());
+
+  set.Iterate(
+      [](SlotType slot_type, Address slot_addr) {
+        return slot_addr % 2 == 0 ? KEEP_SLOT : REMOVE_SLOT;
+      },
+      TypedSlotSet::KEEP_EMPTY_CHUNKS);
+  EXPECT_EQ(kEntries / 2, set.Compact());
+
+  // The remaining slots are unique and sorted by offset.
+  Address last = 0;
+  uint32_t count = 0;
+  set.Iterate(
+      [&last, &count](SlotType slot_type, Address slot_addr) {
+        EXPECT_EQ(0u, slot_addr % 2);
+        EXPECT_LT(last, slot_addr);
+        last = slot_addr;
+        ++count;
+        return KEEP_SLOT;
+      },
+      TypedSlotSet::KEEP_EMPTY_CHUNKS);
+  EXPECT_EQ(kEntries / 2, count);
+
+  set.Iterate([](SlotType slot_type, Address slot_addr) { return REMOVE_SLOT; },
+              TypedSlotSet::KEEP_EMPTY_CHUNKS);
+  EXPECT_EQ(0u, set.Compact());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
@@ -295,5 +296,29 @@ TEST_F(SpacesTest,
   }
 }
 
+// Tests that the non-empty category bitmap of FreeListManyBitmap only reports
+// categories that are at least as large as the requested one.
+TEST_F(SpacesTest, FreeListManyBitmapNonEmptyCategoriesFrom) {
+  FreeListManyBitmap free_list;
+  EXPECT_EQ(0u, free_list.NonEmptyCategoriesFrom(kFirstCategory));
+
+  // Pretend that categories 3, 10 and the last one are non-empty.
+  free_list.nonempty_categories_ = (uint32_t{1} << 3) | (uint32_t{1} << 10) |
+                                   (uint32_t{1} << free_list.last_category_);
+  for (int cat = kFirstCategory; cat <= free_list.last_category_; cat++) {
+    uint32_t candidates = free_list.NonEmptyCategoriesFrom(cat);
+    int expected_first =
+        cat <= 3 ? 3 : cat <= 10 ? 10 : free_list.last_category_;
+    ASSERT_NE(0u, candidates);
+    EXPECT_EQ(expected_first, base::bits::CountTrailingZeros(candidates));
+    for (int lower = kFirstCategory; lower < cat; lower++) {
+      EXPECT_EQ(0u, candidates & (uint32_t{1} << lower));
+    }
+  }
+
+  free_list.Reset();
+  EXPECT_EQ(0u, free_list.NonEmptyCategoriesFrom(kFirstCategory));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -11,6 +11,7 @@
 #include "src/heap/memory-allocator.h"
 #include "src/heap/spaces-inl.h"
 #include "src/utils/ostreams.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -301,8 +302,8 @@ class SequentialUnmapperTest : public                                     //
   SequentialUnmapperTest(const SequentialUnmapperTest&) = delete;
   SequentialUnmapperTest& operator=(const SequentialUnmapperTest&) = delete;
 
-  static void FreeProcessWidePtrComprCageForTesting() {
-    IsolateAllocator::FreeProcessWidePtrComprCageForTesting();
+  static void FreeDefaultPtrComprCageForTesting() {
+    IsolateGroup::FreeDefaultPtrComprCageForTesting();
   }
 
   static void DoMixinSetUp() {
@@ -315,10 +316,10 @@ class SequentialUnmapperTest : public                                     //
     old_flag_ = i::FLAG_concurrent_sweeping;
     i::FLAG_concurrent_sweeping = false;
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
-    // Reinitialize the process-wide pointer cage so it can pick up the
-    // TrackingPageAllocator.
+    // Reinitialize the pointer cage of the default isolate group so it can
+    // pick up the TrackingPageAllocator.
     // The pointer cage must be destroyed before the sandbox.
-    IsolateAllocator::FreeProcessWidePtrComprCageForTesting();
+    IsolateGroup::FreeDefaultPtrComprCageForTesting();
 #ifdef V8_SANDBOX
     // Reinitialze the sandbox so it uses the TrackingPageAllocator.
     GetProcessWideSandbox()->TearDown();
@@ -326,15 +327,15 @@ class SequentialUnmapperTest : public                                     //
     CHECK(GetProcessWideSandbox()->Initialize(
         tracking_page_allocator_, kSandboxMinimumSize, use_guard_regions));
 #endif
-    IsolateAllocator::InitializeOncePerProcess();
+    IsolateGroup::InitializeOncePerProcess();
 #endif
   }
 
   static void DoMixinTearDown() {
 #ifdef V8_COMPRESS_POINTERS_IN_SHARED_CAGE
-    // Free the process-wide cage reservation, otherwise the pages won't be
-    // freed until process teardown.
-    IsolateAllocator::FreeProcessWidePtrComprCageForTesting();
+    // Free the cage reservation of the default isolate group, otherwise the
+    // pages won't be freed until process teardown.
+    IsolateGroup::FreeDefaultPtrComprCageForTesting();
 #endif
 #ifdef V8_SANDBOX
     GetProcessWideSandbox()->TearDown();
@@ -432,6 +433,43 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(page->address(), page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+TEST_F(SequentialUnmapperTest, HugePagePoolKeepsRegionsUntilReleased) {
+  if (FLAG_enable_third_party_heap) return;
+  FLAG_SCOPE(huge_page_pool);
+  MemoryAllocator::HugePagePool* pool = allocator()->huge_page_pool();
+  Page* page =
+      allocator()->AllocatePage(MemoryAllocator::AllocationMode::kRegular,
+                                static_cast<PagedSpace*>(heap()->old_space()),
+                                Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  EXPECT_EQ(1u, pool->NumberOfRegions());
+  const Address address = page->address();
+  EXPECT_TRUE(IsAligned(address, MemoryAllocator::HugePagePool::kRegionSize));
+  tracking_page_allocator()->CheckPagePermissions(
+      address, MemoryAllocator::HugePagePool::kRegionSize,
+      PageAllocator::kReadWrite);
+
+  // Freed pages are neither queued in the unmapper nor uncommitted.
+  allocator()->Free(MemoryAllocator::FreeMode::kConcurrentlyAndPool, page);
+  EXPECT_EQ(0, unmapper()->NumberOfChunks());
+  tracking_page_allocator()->CheckPagePermissions(
+      address, MemoryChunk::kPageSize, PageAllocator::kReadWrite);
+  EXPECT_EQ(MemoryAllocator::HugePagePool::kRegionSize,
+            pool->CommittedFreeMemory());
+
+  page = allocator()->AllocatePage(
+      MemoryAllocator::AllocationMode::kRegular,
+      static_cast<PagedSpace*>(heap()->old_space()),
+      Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(address, page->address());
+  EXPECT_EQ(0u, pool->ReleaseFreeRegions());
+
+  allocator()->Free(MemoryAllocator::FreeMode::kImmediately, page);
+  EXPECT_EQ(MemoryAllocator::HugePagePool::kRegionSize,
+            pool->ReleaseFreeRegions());
+  EXPECT_EQ(0u, pool->NumberOfRegions());
+}
 #endif  // !V8_OS_FUCHSIA && !V8_SANDBOX
 
 }  // namespace internal
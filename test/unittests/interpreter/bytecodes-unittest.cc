@@ -319,6 +319,27 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, IsJumpIfLookahead) {
+  // Handlers with a fused JumpIfTrue/JumpIfFalse must leave a boolean in the
+  // accumulator, and only single-width bytecodes are fused.
+#define TEST_BYTECODE(Name, ...)                                           \
+  if (Bytecodes::IsJumpIfLookahead(Bytecode::k##Name,                      \
+                                   OperandScale::kSingle)) {               \
+    EXPECT_TRUE(Bytecodes::WritesAccumulator(Bytecode::k##Name));          \
+    EXPECT_FALSE(Bytecodes::IsStarLookahead(Bytecode::k##Name,             \
+                                            OperandScale::kSingle));       \
+  }                                                                        \
+  EXPECT_FALSE(                                                            \
+      Bytecodes::IsJumpIfLookahead(Bytecode::k##Name, OperandScale::kDouble));
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+  EXPECT_TRUE(Bytecodes::IsJumpIfLookahead(Bytecode::kTestEqualStrict,
+                                           OperandScale::kSingle));
+  EXPECT_FALSE(Bytecodes::IsJumpIfLookahead(Bytecode::kTestTypeOf,
+                                            OperandScale::kSingle));
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
@@ -9,6 +9,7 @@
 #include "src/handles/handles-inl.h"
 #include "src/heap/factory.h"
 #include "src/interpreter/constant-array-builder.h"
+#include "src/interpreter/constant-pool-cache.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/unittests/test-utils.h"
@@ -397,6 +398,34 @@ TEST_F(ConstantArrayBuilderTest, AllocateEntriesWithFixedReservations) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, ConstantPoolCacheSharesEqualContents) {
+  ConstantPoolCache cache(isolate());
+  Handle<String> name = isolate()->factory()->InternalizeUtf8String("name");
+  auto build = [&](double number) {
+    Handle<FixedArray> constant_pool = isolate()->factory()->NewFixedArray(4);
+    constant_pool->set(0, Smi::FromInt(42));
+    constant_pool->set(1, *isolate()->factory()->NewHeapNumber(number));
+    constant_pool->set(2, *name);
+    constant_pool->set(3, ReadOnlyRoots(isolate()).undefined_value());
+    return constant_pool;
+  };
+  Handle<FixedArray> first = build(0.5);
+  CHECK_EQ(*first, *cache.Canonicalize(first));
+  // Equal numbers are different HeapNumbers, but the contents are equal.
+  Handle<FixedArray> second = build(0.5);
+  CHECK_NE(*first, *second);
+  CHECK_EQ(*first, *cache.Canonicalize(second));
+  Handle<FixedArray> third = build(1.5);
+  CHECK_EQ(*third, *cache.Canonicalize(third));
+
+  // Constant pools with other objects are not shared.
+  Handle<FixedArray> with_object = isolate()->factory()->NewFixedArray(1);
+  with_object->set(0, *isolate()->factory()->NewFixedArray(1));
+  Handle<FixedArray> copy = isolate()->factory()->CopyFixedArray(with_object);
+  CHECK_EQ(*with_object, *cache.Canonicalize(with_object));
+  CHECK_EQ(*copy, *cache.Canonicalize(copy));
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
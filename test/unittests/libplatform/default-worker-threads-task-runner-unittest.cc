@@ -133,6 +133,60 @@ class FakeClock {
 
 std::atomic<double> FakeClock::time_{0.0};
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriorities) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocker_started(0);
+  base::Semaphore unblock(0);
+  base::Semaphore done(0);
+
+  // Keep the only worker busy until all other tasks have been posted.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    blocker_started.Signal();
+    unblock.Wait();
+  }));
+  blocker_started.Wait();
+
+  runner.PostTask(TaskPriority::kBestEffort, std::make_unique<TestTask>([&] {
+                    order.push_back(3);
+                    done.Signal();
+                  }));
+  runner.PostTask(TaskPriority::kUserVisible,
+                  std::make_unique<TestTask>([&] { order.push_back(2); }));
+  runner.PostTask(TaskPriority::kUserBlocking,
+                  std::make_unique<TestTask>([&] { order.push_back(1); }));
+  unblock.Signal();
+
+  done.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(3UL, order.size());
+  ASSERT_EQ(1, order[0]);
+  ASSERT_EQ(2, order[1]);
+  ASSERT_EQ(3, order[2]);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, StealTaskPostedByWorker) {
+  DefaultWorkerThreadsTaskRunner runner(2, RealTime);
+
+  base::Semaphore subtask_done(0);
+  base::Semaphore done(0);
+
+  // The subtask lands in the local queue of the worker running the outer
+  // task, which blocks on it, so the other worker has to steal it.
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    runner.PostTask(
+        std::make_unique<TestTask>([&] { subtask_done.Signal(); }));
+    subtask_done.Wait();
+    done.Signal();
+  }));
+
+  done.Wait();
+
+  runner.Terminate();
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostDelayedTaskOrder) {
   FakeClock::set_time(0.0);
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
@@ -436,6 +436,48 @@ TEST_F(LogTest, LogVersion) {
   }
 }
 
+TEST(BinaryLogEncoderTest, EncodeFields) {
+  FILE* file = v8::base::OS::OpenTemporaryFile();
+  CHECK_NOT_NULL(file);
+  {
+    i::BinaryLogEncoder encoder(file);
+    std::ostream os(&encoder);
+    os << "tick";
+    encoder.EndField();
+    os << "0x10";
+    encoder.EndField();
+    os << -3;
+    encoder.EndField();
+    os << "0x8";
+    encoder.EndRecord();
+    os << "tick";
+    encoder.EndField();
+    // Not an integer which prints back the same way.
+    os << "007";
+    encoder.EndRecord();
+    encoder.Flush();
+  }
+  std::vector<uint8_t> expected(
+      i::BinaryLogEncoder::kHeader,
+      i::BinaryLogEncoder::kHeader + sizeof(i::BinaryLogEncoder::kHeader) - 1);
+  std::vector<uint8_t> records = {
+      i::BinaryLogEncoder::kString, 4, 't', 'i', 'c', 'k',
+      i::BinaryLogEncoder::kAddress, 32,
+      i::BinaryLogEncoder::kInteger, 5,
+      i::BinaryLogEncoder::kAddress, 15,
+      i::BinaryLogEncoder::kEndOfRecord,
+      i::BinaryLogEncoder::kStringRef, 0,
+      i::BinaryLogEncoder::kString, 3, '0', '0', '7',
+      i::BinaryLogEncoder::kEndOfRecord};
+  expected.insert(expected.end(), records.begin(), records.end());
+
+  std::vector<uint8_t> actual(expected.size() + 1);
+  rewind(file);
+  actual.resize(fread(actual.data(), 1, actual.size(), file));
+  fclose(file);
+  CHECK(expected == actual);
+}
+
 // https://crbug.com/539892
 // CodeCreateEvents with really large names should not crash.
 TEST_F(LogTest, Issue539892) {
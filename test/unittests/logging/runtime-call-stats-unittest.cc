@@ -280,6 +280,48 @@ TEST_F(RuntimeCallStatsTest, RenameTimer) {
   EXPECT_EQ(50, counter2()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, Sampling) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  stats()->ResetSamples();
+  stats()->RecordSample();
+  {
+    RCS_SCOPE(stats(), counter_id());
+    Sleep(50);
+    stats()->RecordSample();
+    {
+      RCS_SCOPE(stats(), counter_id2());
+      stats()->RecordSample();
+      stats()->RecordSample();
+    }
+    stats()->RecordSample();
+  }
+  stats()->RecordSample();
+  // Sampling mode does not time the counters.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter()->time().InMicroseconds());
+  EXPECT_EQ(2u, counter()->samples());
+  EXPECT_EQ(2u, counter2()->samples());
+  EXPECT_EQ(0u, counter3()->samples());
+
+  std::vector<std::pair<std::string, uint64_t>> reported;
+  v8_isolate()->GetRuntimeCallStatsSamples(
+      [](const char* name, uint64_t samples, void* data) {
+        static_cast<std::vector<std::pair<std::string, uint64_t>>*>(data)
+            ->emplace_back(name, samples);
+      },
+      &reported);
+  EXPECT_EQ(2u, reported.size());
+
+  // Resetting the timers does not drop the samples.
+  stats()->Reset();
+  EXPECT_EQ(2u, counter()->samples());
+  v8_isolate()->ResetRuntimeCallStatsSamples();
+  EXPECT_EQ(0u, counter()->samples());
+  EXPECT_EQ(0u, counter2()->samples());
+}
+
 TEST_F(RuntimeCallStatsTest, BasicPrintAndSnapshot) {
   std::ostringstream out;
   stats()->Print(out);
@@ -965,6 +965,64 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithSameShape) {
+  std::vector<uint8_t> encoded = EncodeTest(
+      "var shared = {};"
+      "[{key: 1, other: 'a', s: shared}, {key: 2.5, other: 'b', s: shared},"
+      " {key: 3, other: 'c', s: shared}]");
+  // The keys are only written for the first object.
+  const uint8_t kKey[] = {0x22, 0x03, 'k', 'e', 'y'};
+  int key_count = 0;
+  for (auto it = encoded.begin();
+       (it = std::search(it, encoded.end(), std::begin(kKey),
+                         std::end(kKey))) != encoded.end();
+       ++it) {
+    key_count++;
+  }
+  EXPECT_EQ(1, key_count);
+  Local<Value> value = DecodeTest(encoded);
+  ExpectScriptTrue("result.length === 3");
+  ExpectScriptTrue("result[0].key === 1 && result[1].key === 2.5");
+  ExpectScriptTrue("result[2].other === 'c'");
+  ExpectScriptTrue("result[0].s === result[2].s");
+  ExpectScriptTrue("Object.keys(result[1]).join() === 'key,other,s'");
+  Local<Object> array = value.As<Object>();
+  Local<Context> context = deserialization_context();
+  i::Handle<i::JSObject> first = i::Handle<i::JSObject>::cast(Utils::OpenHandle(
+      *array->Get(context, 0).ToLocalChecked()));
+  i::Handle<i::JSObject> last = i::Handle<i::JSObject>::cast(Utils::OpenHandle(
+      *array->Get(context, 2).ToLocalChecked()));
+  EXPECT_EQ(first->map(), last->map());
+
+  // Objects with unserialized receivers as values, or non-enumerable
+  // properties, don't use shapes.
+  RoundTripTest(
+      "[{a: {b: 1}}, {a: {b: 2}},"
+      " Object.defineProperty({c: 1}, 'd', {value: 2})]");
+  ExpectScriptTrue("result[1].a.b === 2");
+  ExpectScriptTrue("Object.keys(result[2]).join() === 'c'");
+}
+
+TEST_F(ValueSerializerTest, DecodeObjectsWithShape) {
+  // [{a: 1}, {a: 2}]
+  Local<Value> value =
+      DecodeTest({0xFF, 0x10, 0x41, 0x02, 0x68, 0x01, 0x22, 0x01, 0x61, 0x49,
+                  0x02, 0x6A, 0x00, 0x49, 0x04, 0x24, 0x00, 0x02});
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0].a === 1 && result[1].a === 2");
+  ExpectScriptTrue("Object.keys(result[1]).length === 1");
+
+  // Unknown shape ID.
+  InvalidDecodeTest({0xFF, 0x10, 0x6A, 0x00, 0x49, 0x02});
+  // Duplicate keys.
+  InvalidDecodeTest(
+      {0xFF, 0x10, 0x68, 0x02, 0x22, 0x01, 0x61, 0x22, 0x01, 0x61, 0x49, 0x02,
+       0x49, 0x04});
+  // The tags are unknown before version 16.
+  InvalidDecodeTest(
+      {0xFF, 0x0F, 0x68, 0x01, 0x22, 0x01, 0x61, 0x49, 0x02});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -2621,6 +2679,101 @@ TEST_F(ValueSerializerTestWithSharedArrayBufferClone,
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+class ValueSerializerTestWithOutOfBandContents : public ValueSerializerTest {
+ protected:
+  static const size_t kThreshold = 16;
+
+  ValueSerializerTestWithOutOfBandContents()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(ValueSerializerTestWithOutOfBandContents* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<uint32_t> GetOutOfBandBackingStoreId(
+        Isolate* isolate,
+        std::shared_ptr<BackingStore> backing_store) override {
+      test_->backing_stores_.push_back(std::move(backing_store));
+      return Just(static_cast<uint32_t>(test_->backing_stores_.size() - 1));
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandContents* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithOutOfBandContents* test)
+        : test_(test) {}
+    std::shared_ptr<BackingStore> GetOutOfBandBackingStoreFromId(
+        Isolate* isolate, uint32_t id) override {
+      if (id >= test_->backing_stores_.size()) return nullptr;
+      return test_->backing_stores_[id];
+    }
+
+   private:
+    ValueSerializerTestWithOutOfBandContents* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetOutOfBandThreshold(kThreshold);
+  }
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+
+ private:
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, RoundTripTypedArray) {
+  std::vector<uint8_t> encoded = EncodeTest(
+      "var a = new Uint8Array(32);"
+      "for (var i = 0; i < a.length; i++) a[i] = i;"
+      "({ a, b: new Uint16Array(a.buffer, 2, 4), c: new Uint8Array(15) })");
+  // Only the 32 byte buffer is written out of band.
+  ASSERT_EQ(1u, backing_stores_.size());
+  EXPECT_EQ(32u, backing_stores_[0]->ByteLength());
+  EXPECT_LT(encoded.size(), 32u);
+  DecodeTest(encoded);
+  ExpectScriptTrue("result.a.length === 32 && result.a[31] === 31");
+  ExpectScriptTrue("result.a.buffer === result.b.buffer");
+  ExpectScriptTrue("result.b.toString() === '770,1284,1798,2312'");
+  ExpectScriptTrue("result.c.length === 15");
+  // The deserialized buffer adopts the backing store.
+  ExpectScriptTrue("(result.a[0] = 42, true)");
+  EXPECT_EQ(42, static_cast<uint8_t*>(backing_stores_[0]->Data())[0]);
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, RoundTripString) {
+  std::vector<uint8_t> encoded =
+      EncodeTest("['abcd'.repeat(8), '\\u03a9'.repeat(8), 'short']");
+  ASSERT_EQ(2u, backing_stores_.size());
+  EXPECT_EQ(32u, backing_stores_[0]->ByteLength());
+  EXPECT_EQ(16u, backing_stores_[1]->ByteLength());
+  DecodeTest(encoded);
+  ExpectScriptTrue("result[0] === 'abcd'.repeat(8)");
+  ExpectScriptTrue("result[1] === '\\u03a9'.repeat(8)");
+  ExpectScriptTrue("result[2] === 'short'");
+}
+
+TEST_F(ValueSerializerTestWithOutOfBandContents, MissingBackingStore) {
+  std::vector<uint8_t> encoded = EncodeTest("new Uint8Array(64)");
+  ASSERT_EQ(1u, backing_stores_.size());
+  backing_stores_.clear();
+  InvalidDecodeTest(encoded);
+}
+
 TEST_F(ValueSerializerTest, UnsupportedHostObject) {
   InvalidEncodeTest("new ExampleHostObject()");
   InvalidEncodeTest("({ a: new ExampleHostObject() })");
@@ -4,6 +4,7 @@
 
 #include "src/base/platform/platform.h"
 #include "src/objects/backing-store.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -70,6 +71,29 @@ TEST_F(BackingStoreTest, CopyWasmMemory) {
   EXPECT_EQ(3 * wasm::kWasmPageSize, bs2->byte_capacity());
 }
 
+TEST_F(BackingStoreTest, ReusePooledGuardRegion) {
+  FlagScope<unsigned> pool_size(&FLAG_wasm_guard_region_pool_size, 1);
+  auto bs1 =
+      BackingStore::AllocateWasmMemory(isolate(), 1, 2, SharedFlag::kNotShared);
+  CHECK(bs1);
+  // Only reservations with guard regions are pooled.
+  if (!bs1->has_guard_regions()) return;
+  void* buffer_start = bs1->buffer_start();
+  memset(buffer_start, 0xab, wasm::kWasmPageSize);
+  bs1.reset();
+
+  auto bs2 =
+      BackingStore::AllocateWasmMemory(isolate(), 2, 2, SharedFlag::kNotShared);
+  CHECK(bs2);
+  EXPECT_EQ(buffer_start, bs2->buffer_start());
+  EXPECT_EQ(2 * wasm::kWasmPageSize, bs2->byte_length());
+  // The reused memory is zero-initialized.
+  const uint8_t* bytes = static_cast<const uint8_t*>(bs2->buffer_start());
+  for (size_t i = 0; i < bs2->byte_length(); i += 1024) {
+    EXPECT_EQ(0, bytes[i]);
+  }
+}
+
 class GrowerThread : public base::Thread {
  public:
   GrowerThread(Isolate* isolate, uint32_t increment, uint32_t max,
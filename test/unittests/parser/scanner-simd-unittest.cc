@@ -0,0 +1,60 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-simd.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const uint16_t* Find(const std::vector<uint16_t>& chars) {
+  return FindNonAsciiOrAnyOf(chars.data(), chars.data() + chars.size(), '"',
+                             '\\', '\n', '\r');
+}
+
+}  // namespace
+
+TEST(ScannerSimdTest, FindsNothingInPlainAscii) {
+  for (size_t length = 0; length < 40; length++) {
+    std::vector<uint16_t> chars(length, 'a');
+    EXPECT_EQ(chars.data() + length, Find(chars));
+  }
+}
+
+TEST(ScannerSimdTest, FindsFirstInterestingCodeUnit) {
+  // Cover every position in and across the blocks of the vectorized loop as
+  // well as the scalar tail.
+  const uint16_t kInteresting[] = {'"', '\\', '\n', '\r', 0x80, 0x2028,
+                                   0xFFFF};
+  for (size_t length = 1; length < 40; length++) {
+    for (size_t position = 0; position < length; position++) {
+      for (uint16_t c : kInteresting) {
+        std::vector<uint16_t> chars(length, 'x');
+        chars[position] = c;
+        // Later interesting code units don't matter.
+        if (position + 1 < length) chars[length - 1] = '"';
+        EXPECT_EQ(chars.data() + position, Find(chars));
+      }
+    }
+  }
+}
+
+TEST(ScannerSimdTest, IgnoresOtherAsciiCharacters) {
+  std::vector<uint16_t> chars;
+  for (uint16_t c = 0; c <= 0x7F; c++) {
+    if (c == '"' || c == '\\' || c == '\n' || c == '\r') continue;
+    chars.push_back(c);
+  }
+  EXPECT_EQ(chars.data() + chars.size(), Find(chars));
+  chars.push_back(0x100);
+  EXPECT_EQ(chars.data() + chars.size() - 1, Find(chars));
+}
+
+}  // namespace internal
+}  // namespace v8
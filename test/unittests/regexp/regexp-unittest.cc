@@ -19,12 +19,15 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
+#include "src/regexp/regexp-character-search.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
 #include "src/regexp/regexp-parser.h"
+#include "src/regexp/regexp-stack.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-stream.h"
 #include "src/strings/unicode-inl.h"
@@ -2323,6 +2326,57 @@ TEST_F(RegExpTestWithContext, UnicodePropertyEscapeCodeSize) {
   }
 }
 
+TEST_F(RegExpTestWithContext, StackPool) {
+  i::FlagScope<bool> f(&v8::internal::FLAG_regexp_tier_up, false);
+
+  v8::HandleScope scope(isolate());
+  RegExpStack* regexp_stack = i_isolate()->regexp_stack();
+  CHECK(RunJS("/(?:a|b)*c/.test('ab'.repeat(100000) + 'c')")->IsTrue());
+  if (kSystemPointerSize == 8) {
+    // The grown stack stays in the pool.
+    CHECK_LT(100000, regexp_stack->allocated_size());
+  } else {
+    CHECK_EQ(0, regexp_stack->allocated_size());
+  }
+  v8::HeapStatistics heap_statistics;
+  isolate()->GetHeapStatistics(&heap_statistics);
+  CHECK_EQ(regexp_stack->allocated_size(), heap_statistics.regexp_stack_size());
+
+  // Pooled memory that later executions do not need is given back.
+  CHECK(RunJS("for (let i = 0; i < 1000; i++) /a+b/.exec('aab'); true")
+            ->IsTrue());
+  CHECK_EQ(0, regexp_stack->allocated_size());
+}
+
+TEST_F(RegExpTestWithContext, BytecodeCache) {
+  i::FlagScope<bool> f1(&v8::internal::FLAG_regexp_bytecode_cache, true);
+  i::FlagScope<bool> f2(&v8::internal::FLAG_regexp_interpret_all, true);
+  RegExpBytecodeCache::ClearForTesting();
+
+  v8::HandleScope scope(isolate());
+  const char* kSource =
+      "const r = new RegExp('(?<year>\\\\d+)-(\\\\d+)');"
+      "const m = r.exec('on 2022-10');"
+      "m.groups.year + ' ' + m[2] + ' ' + m.index;";
+  CHECK(RunJS(kSource)->StrictEquals(NewString("2022 10 3")));
+
+  Handle<String> pattern = MakeString("(?<year>\\d+)-(\\d+)");
+  std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+      RegExpBytecodeCache::Lookup(pattern, RegExpFlags{}, true,
+                                  JSRegExp::kNoBacktrackLimit);
+  CHECK(entry);
+  CHECK_EQ(size_t{1}, entry->named_captures.size());
+  CHECK_EQ(1, entry->named_captures[0].second);
+
+  // A new JSRegExp gets its bytecode from the cache.
+  i_isolate()->compilation_cache()->Clear();
+  v8::Local<v8::Context> context = v8::Context::New(isolate());
+  v8::Context::Scope context_scope(context);
+  CHECK(RunJS(kSource)->StrictEquals(NewString("2022 10 3")));
+
+  RegExpBytecodeCache::ClearForTesting();
+}
+
 namespace {
 
 struct RegExpExecData {
@@ -2365,6 +2419,66 @@ TEST_F(RegExpTestWithContext, RegExpInterruptReentrantExecution) {
   CHECK(result->IsNull());
 }
 
+TEST_F(RegExpTest, FindMaskedCharacters) {
+  // Long enough for matches in both the vectorized and the scalar loop.
+  static constexpr int kLength = 100;
+  uint8_t one_byte[kLength];
+  base::uc16 two_byte[kLength];
+  for (int i = 0; i < kLength; i++) one_byte[i] = two_byte[i] = 'x';
+  const uint8_t* one_byte_end = one_byte + kLength;
+  const base::uc16* two_byte_end = two_byte + kLength;
+
+  CHECK_EQ(one_byte_end,
+           FindMaskedCharacter(one_byte, one_byte_end, 'a', 0xFFFF));
+  CHECK_EQ(two_byte_end,
+           FindMaskedCharacter(two_byte, two_byte_end, 'a', 0xFFFF));
+
+  for (int position : {5, 40, kLength - 2}) {
+    one_byte[position] = two_byte[position] = 'a';
+    one_byte[position + 1] = two_byte[position + 1] = 'b';
+    CHECK_EQ(one_byte + position,
+             FindMaskedCharacter(one_byte, one_byte_end, 'a', 0xFFFF));
+    CHECK_EQ(two_byte + position,
+             FindMaskedCharacter(two_byte, two_byte_end, 'a', 0xFFFF));
+    CHECK_EQ(one_byte + position,
+             FindMaskedCharacterPair(one_byte, one_byte_end - 1, 'a', 'b',
+                                     0xFFFF));
+    CHECK_EQ(two_byte + position,
+             FindMaskedCharacterPair(two_byte, two_byte_end - 1, 'a', 'b',
+                                     0xFFFF));
+    // Only match the pair where both characters match.
+    CHECK_EQ(one_byte_end - 1,
+             FindMaskedCharacterPair(one_byte, one_byte_end - 1, 'a', 'c',
+                                     0xFFFF));
+    CHECK_EQ(two_byte_end - 1,
+             FindMaskedCharacterPair(two_byte, two_byte_end - 1, 'b', 'a',
+                                     0xFFFF));
+    // Searching from the match finds it, searching past it does not.
+    CHECK_EQ(one_byte + position,
+             FindMaskedCharacter(one_byte + position, one_byte_end, 'a',
+                                 0xFFFF));
+    CHECK_EQ(one_byte_end, FindMaskedCharacter(one_byte + position + 1,
+                                               one_byte_end, 'a', 0xFFFF));
+    one_byte[position] = two_byte[position] = 'x';
+    one_byte[position + 1] = two_byte[position + 1] = 'x';
+  }
+
+  // The mask applies to the subject, e.g. 0xE1 & 0x7F == 'a'.
+  one_byte[60] = 0xE1;
+  two_byte[60] = 0x161;
+  CHECK_EQ(one_byte_end,
+           FindMaskedCharacter(one_byte, one_byte_end, 'a', 0xFFFF));
+  CHECK_EQ(one_byte + 60,
+           FindMaskedCharacter(one_byte, one_byte_end, 'a', 0x7F));
+  CHECK_EQ(two_byte + 60,
+           FindMaskedCharacter(two_byte, two_byte_end, 'a', 0x7F));
+  // Characters that no masked subject character can be equal to.
+  CHECK_EQ(one_byte_end,
+           FindMaskedCharacter(one_byte, one_byte_end, 0x161, 0xFFFF));
+  CHECK_EQ(two_byte_end,
+           FindMaskedCharacter(two_byte, two_byte_end, 0xE1, 0x7F));
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
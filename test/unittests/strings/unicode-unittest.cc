@@ -493,5 +493,36 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, AsciiRunsBetweenMultibyteCharacters) {
+  // The ASCII runs are decoded in bulk, so vary their lengths around the
+  // block sizes and put them before, between and after (partial) multibyte
+  // sequences.
+  const std::vector<std::vector<byte>> multibyte = {
+      {0xC3, 0xA9}, {0xE2, 0x98, 0x83}, {0xF0, 0x9F, 0x98, 0x80}, {0xE2, 0x98},
+      {0xFF}};
+  for (size_t run = 0; run < 70; run++) {
+    for (const std::vector<byte>& sequence : multibyte) {
+      std::vector<byte> bytes(run, 'a');
+      bytes.insert(bytes.end(), sequence.begin(), sequence.end());
+      bytes.insert(bytes.end(), run + 1, 'b');
+      bytes.insert(bytes.end(), sequence.begin(), sequence.end());
+
+      std::vector<unibrow::uchar> output_normal;
+      DecodeNormally(bytes, &output_normal);
+      std::vector<unibrow::uchar> output_utf16;
+      DecodeUtf16(bytes, &output_utf16);
+      CHECK_EQ(output_normal.size(), output_utf16.size());
+      for (size_t i = 0; i < output_normal.size(); ++i) {
+        CHECK_EQ(output_normal[i], output_utf16[i]);
+      }
+
+      auto utf8_data = base::Vector<const uint8_t>::cast(base::VectorOf(bytes));
+      Utf8Decoder decoder(utf8_data);
+      CHECK(!decoder.is_ascii());
+      CHECK_LE(decoder.non_ascii_start(), static_cast<int>(run));
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,98 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include "src/wasm/wasm-module.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class TieringProfileTest : public ::testing::Test {
+ public:
+  TieringProfileTest() {
+    module_.num_imported_functions = 1;
+    module_.num_declared_functions = 3;
+  }
+
+  WasmModule* module() { return &module_; }
+
+ private:
+  WasmModule module_;
+};
+
+TEST_F(TieringProfileTest, RoundTrip) {
+  {
+    FunctionTypeFeedback& hot =
+        module()->type_feedback.feedback_for_function[2];
+    hot.tierup_priority = 4;
+    hot.positions[7] = 0;
+    hot.positions[12] = 1;
+    hot.feedback_vector = {{3, 100}, {-1, -1}};
+    // Functions that only recorded call positions are not hot.
+    module()->type_feedback.feedback_for_function[3].positions[5] = 0;
+  }
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module());
+
+  WasmModule other;
+  other.num_imported_functions = 1;
+  other.num_declared_functions = 3;
+  std::unique_ptr<ProfileInformation> info =
+      DeserializeTieringProfile(&other, profile.as_vector());
+  ASSERT_NE(nullptr, info);
+  ASSERT_EQ(1u, info->hot_functions().size());
+  EXPECT_EQ(2u, info->hot_functions()[0].func_index);
+  EXPECT_EQ(4, info->hot_functions()[0].tierup_priority);
+
+  const FunctionTypeFeedback& restored =
+      other.type_feedback.feedback_for_function[2];
+  EXPECT_EQ(4, restored.tierup_priority);
+  EXPECT_EQ(2u, restored.positions.size());
+  EXPECT_EQ(1, restored.positions.at(12));
+  ASSERT_EQ(2u, restored.feedback_vector.size());
+  EXPECT_EQ(3, restored.feedback_vector[0].function_index);
+  EXPECT_EQ(100, restored.feedback_vector[0].absolute_call_frequency);
+  EXPECT_EQ(-1, restored.feedback_vector[1].function_index);
+  EXPECT_EQ(0u, other.type_feedback.feedback_for_function.count(3));
+}
+
+TEST_F(TieringProfileTest, RejectMismatchingModule) {
+  module()->type_feedback.feedback_for_function[1].tierup_priority = 1;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module());
+
+  WasmModule other;
+  other.num_imported_functions = 1;
+  other.num_declared_functions = 2;
+  EXPECT_EQ(nullptr, DeserializeTieringProfile(&other, profile.as_vector()));
+  EXPECT_TRUE(other.type_feedback.feedback_for_function.empty());
+}
+
+TEST_F(TieringProfileTest, RejectTruncatedProfile) {
+  module()->type_feedback.feedback_for_function[3].tierup_priority = 2;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module());
+  for (size_t length = 0; length < profile.size(); ++length) {
+    WasmModule other;
+    other.num_imported_functions = 1;
+    other.num_declared_functions = 3;
+    EXPECT_EQ(nullptr, DeserializeTieringProfile(
+                           &other, profile.as_vector().SubVector(0, length)));
+    EXPECT_TRUE(other.type_feedback.feedback_for_function.empty());
+  }
+}
+
+// Feedback collected in this process is kept.
+TEST_F(TieringProfileTest, KeepExistingFeedback) {
+  module()->type_feedback.feedback_for_function[1].tierup_priority = 8;
+  base::OwnedVector<uint8_t> profile = SerializeTieringProfile(module());
+  module()->type_feedback.feedback_for_function[1].tierup_priority = 2;
+  EXPECT_NE(nullptr, DeserializeTieringProfile(module(), profile.as_vector()));
+  EXPECT_EQ(2,
+            module()->type_feedback.feedback_for_function[1].tierup_priority);
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
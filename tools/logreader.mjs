@@ -35,6 +35,113 @@
 export function parseString(field) { return field };
 export const parseVarArgs = 'parse-var-args';
 
+/**
+ * Turns a log written with --log-binary back into log lines, see
+ * BinaryLogEncoder in src/logging/log-file.h.
+ */
+export class BinaryLogDecoder {
+  static HEADER = '\0v8-binary-log-1\n';
+  static kEndOfRecord = 0;
+  static kInteger = 1;
+  static kAddress = 2;
+  static kString = 3;
+  static kStringRef = 4;
+  static kLongString = 5;
+
+  /**
+   * @param {ArrayBuffer} buffer The whole binary log.
+   */
+  constructor(buffer) {
+    this.bytes_ = new Uint8Array(buffer);
+    const header = BinaryLogDecoder.HEADER;
+    for (let i = 0; i < header.length; i++) {
+      if (this.bytes_[i] !== header.charCodeAt(i)) {
+        throw new Error('Not a binary V8 log');
+      }
+    }
+    this.pos_ = header.length;
+    this.strings_ = [];
+    this.previousAddress_ = 0n;
+  }
+
+  /**
+   * Yields the records of the log as CSV log lines.
+   */
+  *lines() {
+    const fields = [];
+    while (this.pos_ < this.bytes_.length) {
+      const tag = this.bytes_[this.pos_++];
+      switch (tag) {
+        case BinaryLogDecoder.kEndOfRecord:
+          yield fields.join(',');
+          fields.length = 0;
+          break;
+        case BinaryLogDecoder.kInteger:
+          fields.push(this.readZigZag_().toString());
+          break;
+        case BinaryLogDecoder.kAddress:
+          this.previousAddress_ =
+              BigInt.asUintN(64, this.previousAddress_ + this.readZigZag_());
+          fields.push('0x' + this.previousAddress_.toString(16));
+          break;
+        case BinaryLogDecoder.kString: {
+          const string = this.readString_();
+          this.strings_.push(string);
+          fields.push(string);
+          break;
+        }
+        case BinaryLogDecoder.kStringRef:
+          fields.push(this.strings_[this.readVarint_()]);
+          break;
+        case BinaryLogDecoder.kLongString:
+          fields.push(this.readString_());
+          break;
+        default:
+          throw new Error(`Invalid tag ${tag} at offset ${this.pos_ - 1}`);
+      }
+    }
+  }
+
+  readVarint_() {
+    let value = 0;
+    let multiplier = 1;
+    let byte;
+    do {
+      byte = this.bytes_[this.pos_++];
+      value += (byte & 0x7F) * multiplier;
+      multiplier *= 128;
+    } while (byte & 0x80);
+    return value;
+  }
+
+  readZigZag_() {
+    let value = 0n;
+    let shift = 0n;
+    let byte;
+    do {
+      byte = this.bytes_[this.pos_++];
+      value |= BigInt(byte & 0x7F) << shift;
+      shift += 7n;
+    } while (byte & 0x80);
+    return (value >> 1n) ^ -(value & 1n);
+  }
+
+  readString_() {
+    const length = this.readVarint_();
+    const end = this.pos_ + length;
+    let result = '';
+    // Convert in chunks to stay within the maximum number of arguments.
+    const kChunkSize = 4096;
+    while (this.pos_ < end) {
+      const chunkEnd = Math.min(end, this.pos_ + kChunkSize);
+      result += String.fromCharCode.apply(
+          null, this.bytes_.subarray(this.pos_, chunkEnd));
+      this.pos_ = chunkEnd;
+    }
+    return result;
+  }
+}
+
 /**
  * Base class for processing log files.
  *
@@ -133,6 +240,17 @@ export class LogReader {
     }
   }
 
+  /**
+   * Processes a whole log written with --log-binary.
+   *
+   * @param {ArrayBuffer} buffer The contents of the log file.
+   */
+  async processBinaryLog(buffer) {
+    for (const line of new BinaryLogDecoder(buffer).lines()) {
+      await this.processLogLine(line);
+    }
+  }
+
   /**
    * Processes a line of V8 profiler event log.
    *
@@ -702,8 +702,14 @@ export class TickProcessor extends LogReader {
 
   async processLogFile(fileName) {
     this.lastLogFileName_ = fileName;
-    let line;
-    while (line = readline()) {
+    let line = readline();
+    if (line === '') {
+      // Binary logs start with a NUL byte, which reads as an empty line. The
+      // rest cannot be read line by line from stdin.
+      await this.processBinaryLog(readbuffer(fileName));
+      return;
+    }
+    for (; line; line = readline()) {
       await this.processLogLine(line);
     }
   }